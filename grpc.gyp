@@ -437,6 +437,7 @@
         'src/core/lib/gpr/env_windows.cc',
         'src/core/lib/gpr/log.cc',
         'src/core/lib/gpr/log_android.cc',
+        'src/core/lib/gpr/log_async.cc',
         'src/core/lib/gpr/log_linux.cc',
         'src/core/lib/gpr/log_posix.cc',
         'src/core/lib/gpr/log_windows.cc',
@@ -513,6 +514,7 @@
         'src/core/ext/filters/client_channel/lb_policy/priority/priority.cc',
         'src/core/ext/filters/client_channel/lb_policy/ring_hash/ring_hash.cc',
         'src/core/ext/filters/client_channel/lb_policy/round_robin/round_robin.cc',
+        'src/core/ext/filters/client_channel/lb_policy/weighted_round_robin/weighted_round_robin.cc',
         'src/core/ext/filters/client_channel/lb_policy/weighted_target/weighted_target.cc',
         'src/core/ext/filters/client_channel/lb_policy/xds/cds.cc',
         'src/core/ext/filters/client_channel/lb_policy/xds/xds_cluster_impl.cc',
@@ -599,6 +601,7 @@
         'src/core/ext/transport/chttp2/transport/writing.cc',
         'src/core/ext/transport/inproc/inproc_plugin.cc',
         'src/core/ext/transport/inproc/inproc_transport.cc',
+        'src/core/ext/transport/shm/shm_ring_buffer.cc',
         'src/core/ext/upb-generated/envoy/admin/v3/config_dump.upb.c',
         'src/core/ext/upb-generated/envoy/annotations/deprecation.upb.c',
         'src/core/ext/upb-generated/envoy/annotations/resource.upb.c',
@@ -821,6 +824,7 @@
         'src/core/lib/debug/trace.cc',
         'src/core/lib/event_engine/endpoint_config.cc',
         'src/core/lib/event_engine/event_engine.cc',
+        'src/core/lib/event_engine/uring/uring_ring.cc',
         'src/core/lib/event_engine/sockaddr.cc',
         'src/core/lib/http/format_request.cc',
         'src/core/lib/http/httpcli.cc',
@@ -900,6 +904,7 @@
         'src/core/lib/iomgr/tcp_client_windows.cc',
         'src/core/lib/iomgr/tcp_custom.cc',
         'src/core/lib/iomgr/tcp_posix.cc',
+        'src/core/lib/iomgr/tcp_rio_windows.cc',
         'src/core/lib/iomgr/tcp_server.cc',
         'src/core/lib/iomgr/tcp_server_custom.cc',
         'src/core/lib/iomgr/tcp_server_posix.cc',
@@ -1175,6 +1180,7 @@
         'src/core/ext/filters/client_channel/lb_policy/priority/priority.cc',
         'src/core/ext/filters/client_channel/lb_policy/ring_hash/ring_hash.cc',
         'src/core/ext/filters/client_channel/lb_policy/round_robin/round_robin.cc',
+        'src/core/ext/filters/client_channel/lb_policy/weighted_round_robin/weighted_round_robin.cc',
         'src/core/ext/filters/client_channel/lb_policy/weighted_target/weighted_target.cc',
         'src/core/ext/filters/client_channel/lb_policy_registry.cc',
         'src/core/ext/filters/client_channel/local_subchannel_pool.cc',
@@ -1253,6 +1259,7 @@
         'src/core/ext/transport/chttp2/transport/writing.cc',
         'src/core/ext/transport/inproc/inproc_plugin.cc',
         'src/core/ext/transport/inproc/inproc_transport.cc',
+        'src/core/ext/transport/shm/shm_ring_buffer.cc',
         'src/core/ext/upb-generated/src/proto/grpc/health/v1/health.upb.c',
         'src/core/ext/upb-generated/src/proto/grpc/lb/v1/load_balancer.upb.c',
         'src/core/ext/upb-generated/udpa/data/orca/v1/orca_load_report.upb.c',
@@ -1284,6 +1291,7 @@
         'src/core/lib/debug/trace.cc',
         'src/core/lib/event_engine/endpoint_config.cc',
         'src/core/lib/event_engine/event_engine.cc',
+        'src/core/lib/event_engine/uring/uring_ring.cc',
         'src/core/lib/event_engine/sockaddr.cc',
         'src/core/lib/http/format_request.cc',
         'src/core/lib/http/httpcli.cc',
@@ -1362,6 +1370,7 @@
         'src/core/lib/iomgr/tcp_client_windows.cc',
         'src/core/lib/iomgr/tcp_custom.cc',
         'src/core/lib/iomgr/tcp_posix.cc',
+        'src/core/lib/iomgr/tcp_rio_windows.cc',
         'src/core/lib/iomgr/tcp_server.cc',
         'src/core/lib/iomgr/tcp_server_custom.cc',
         'src/core/lib/iomgr/tcp_server_posix.cc',
@@ -1477,6 +1486,7 @@
         'src/cpp/common/channel_filter.cc',
         'src/cpp/common/completion_queue_cc.cc',
         'src/cpp/common/core_codegen.cc',
+        'src/cpp/common/decode_offload.cc',
         'src/cpp/common/resource_quota_cc.cc',
         'src/cpp/common/rpc_method.cc',
         'src/cpp/common/secure_auth_context.cc',
@@ -1607,6 +1617,7 @@
         'src/cpp/common/channel_filter.cc',
         'src/cpp/common/completion_queue_cc.cc',
         'src/cpp/common/core_codegen.cc',
+        'src/cpp/common/decode_offload.cc',
         'src/cpp/common/insecure_create_auth_context.cc',
         'src/cpp/common/resource_quota_cc.cc',
         'src/cpp/common/rpc_method.cc',
@@ -45,6 +45,25 @@ extern "C" {
 GRPCAPI void grpc_metadata_array_init(grpc_metadata_array* array);
 GRPCAPI void grpc_metadata_array_destroy(grpc_metadata_array* array);
 
+/** EXPERIMENTAL API - Subject to change.
+
+    Validates a set of constant metadata elements once, up front, performing
+    the per-element legality checks that grpc_call_start_batch() would
+    otherwise repeat on every call. Returns NULL if any element is invalid.
+    Calls that attach these key/value slices in a grpc_metadata array with
+    the GRPC_WRITE_METADATA_NO_COPY flag set skip per-call validation,
+    interning and copying; the slices are referenced in place, so the handle
+    (which holds references to them) must not be destroyed while any such
+    call is in flight. */
+GRPCAPI grpc_validated_metadata* grpc_validated_metadata_create(
+    const grpc_metadata* metadata, size_t count);
+
+/** EXPERIMENTAL API - Subject to change.
+
+    Releases a handle created by grpc_validated_metadata_create(). */
+GRPCAPI void grpc_validated_metadata_destroy(
+    grpc_validated_metadata* validated);
+
 GRPCAPI void grpc_call_details_init(grpc_call_details* details);
 GRPCAPI void grpc_call_details_destroy(grpc_call_details* details);
 
@@ -80,6 +99,16 @@ GRPCAPI void grpc_init(void);
     have been destroyed. */
 GRPCAPI void grpc_shutdown(void);
 
+/** EXPERIMENTAL API - Subject to change.
+
+    Eagerly performs the library initialization work that grpc_init()
+    defers to first use (running registered plugins: resolvers, load
+    balancing policies, channel filters). Entirely optional: intended for
+    long-lived servers that prefer to pay this cost at startup rather than
+    on the first channel, server or registry lookup. Must be called after
+    grpc_init(). */
+GRPCAPI void grpc_prewarm(void);
+
 /** EXPERIMENTAL. Returns 1 if the grpc library has been initialized.
     TODO(ericgribkoff) Decide if this should be promoted to non-experimental as
     part of stabilizing the fork support API, as tracked in
@@ -134,6 +163,25 @@ GRPCAPI grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
                                               gpr_timespec deadline,
                                               void* reserved);
 
+/** EXPERIMENTAL API - Subject to change.
+
+    Batched variant of grpc_completion_queue_next. Blocks (up to deadline)
+    like grpc_completion_queue_next for the first event, then drains up to
+    max_events - 1 further events that are already ready, without blocking
+    again, so the cost of entering the pollset amortizes across the batch.
+
+    Writes at least one event into events (possibly of type
+    GRPC_QUEUE_TIMEOUT or GRPC_QUEUE_SHUTDOWN, with the same meaning as for
+    grpc_completion_queue_next) and returns the number of events written.
+    Events after the first are always of type GRPC_OP_COMPLETE.
+
+    The simultaneous-use restrictions of grpc_completion_queue_next apply. */
+GRPCAPI size_t grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                                grpc_event* events,
+                                                size_t max_events,
+                                                gpr_timespec deadline,
+                                                void* reserved);
+
 /** Blocks until an event with tag 'tag' is available, the completion queue is
     being shutdown or deadline is reached.
 
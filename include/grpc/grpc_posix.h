@@ -55,6 +55,31 @@ GRPCAPI grpc_channel* grpc_insecure_channel_create_from_fd(
 GRPCAPI void grpc_server_add_insecure_channel_from_fd(grpc_server* server,
                                                       void* reserved, int fd);
 
+struct iovec;
+
+/** Opaque handle pinning the memory exported by
+    grpc_byte_buffer_export_iovec(). */
+typedef struct grpc_byte_buffer_iovec_handle grpc_byte_buffer_iovec_handle;
+
+/** EXPERIMENTAL API - Subject to change.
+
+    Pins \a buffer's payload and exports its full scatter list: *iov is set
+    to an array of *iov_count iovec entries pointing directly at the buffer's
+    slice contents (no copy), suitable for pwritev() or io_uring submission.
+    The returned handle owns references on the underlying slices, so the
+    exported memory stays valid after the buffer - and the call it was
+    received on - has been destroyed; release it with
+    grpc_byte_buffer_iovec_handle_destroy() once the I/O has completed.
+    Returns NULL for NULL or compressed buffers. */
+GRPCAPI grpc_byte_buffer_iovec_handle* grpc_byte_buffer_export_iovec(
+    grpc_byte_buffer* buffer, struct iovec** iov, size_t* iov_count);
+
+/** EXPERIMENTAL API - Subject to change.
+
+    Unpins the memory exported by grpc_byte_buffer_export_iovec(). */
+GRPCAPI void grpc_byte_buffer_iovec_handle_destroy(
+    grpc_byte_buffer_iovec_handle* handle);
+
 #ifdef __cplusplus
 }
 #endif
@@ -52,6 +52,15 @@ extern "C" {
  * be ignored). */
 #define GRPC_COMPRESSION_CHANNEL_ENABLED_ALGORITHMS_BITSET \
   "grpc.compression_enabled_algorithms_bitset"
+/** EXPERIMENTAL: Minimum average compression savings, in percent, below
+ * which the channel adaptively stops compressing messages. The achieved
+ * compression ratio is tracked with an exponentially weighted moving
+ * average; once the average savings drop below this threshold, messages are
+ * sent uncompressed (with occasional probes to detect when the payload mix
+ * becomes compressible again). An int between 0 and 100; 0 (the default)
+ * disables adaptive bypass. */
+#define GRPC_COMPRESSION_CHANNEL_ADAPTIVE_BYPASS_THRESHOLD \
+  "grpc.compression_adaptive_bypass_threshold"
 /** \} */
 
 /** The various compression algorithms supported by gRPC (not sorted by
@@ -170,6 +170,40 @@ typedef struct {
  * channel goes back into IDLE state. Int valued, milliseconds. INT_MAX means
  * unlimited. The default value is 30 minutes and the min value is 1 second. */
 #define GRPC_ARG_CLIENT_IDLE_TIMEOUT_MS "grpc.client_idle_timeout_ms"
+/** EXPERIMENTAL. When set to a positive value, the client channel keeps its
+   last resolver result while in IDLE state and reuses it on the next RPC if
+   the result is younger than this bound, so that exiting IDLE does not wait
+   for a fresh name resolution. The resolver is still restarted, and its next
+   result replaces the reused one. Int valued, milliseconds. 0 (the default)
+   disables retention. */
+#define GRPC_ARG_EXPERIMENTAL_WARM_IDLE_RESULT_STALENESS_MS \
+  "grpc.experimental.warm_idle_result_staleness_ms"
+/** EXPERIMENTAL. Number of decoded incoming messages a streaming call may
+   pull from the transport and buffer ahead of application reads, so that
+   each read does not wait a full application/transport round trip for the
+   next message. Int valued, clamped to [0, 64]. 0 (the default) disables
+   readahead. */
+#define GRPC_ARG_EXPERIMENTAL_RECV_MESSAGE_READAHEAD \
+  "grpc.experimental.recv_message_readahead"
+/** EXPERIMENTAL. If non-zero, channels created with this arg share one
+   resolver per target instead of each running their own: resolver results
+   fan out to every subscribed channel and re-resolution requests are
+   coalesced, so N channels to the same target generate the name-service
+   traffic of one. Channels opting in for the same target should use
+   identical resolution-affecting channel args, since the shared resolver is
+   configured from the args of the first such channel. Int valued, 0 (the
+   default) disables sharing. */
+#define GRPC_ARG_EXPERIMENTAL_SHARE_RESOLVER "grpc.experimental.share_resolver"
+/** EXPERIMENTAL. Shared dictionary used to seed stream compression
+   contexts, so that small messages compress against known application
+   vocabulary instead of starting from an empty window. String valued. Only
+   takes effect on transports that negotiate stream compression, and both
+   peers must be configured with identical dictionary bytes: a seeded
+   context uses raw deflate framing, which a peer without the same
+   dictionary cannot decode. Unset (the default) leaves stream compression
+   unseeded. */
+#define GRPC_ARG_EXPERIMENTAL_STREAM_COMPRESSION_DICTIONARY \
+  "grpc.experimental.stream_compression_dictionary"
 /** Enable/disable support for per-message compression. Defaults to 1, unless
     GRPC_ARG_MINIMAL_STACK is enabled, in which case it defaults to 0. */
 #define GRPC_ARG_ENABLE_PER_MESSAGE_COMPRESSION "grpc.per_message_compression"
@@ -195,6 +229,12 @@ typedef struct {
 /** How much memory to use for hpack encoding. Int valued, bytes. */
 #define GRPC_ARG_HTTP2_HPACK_TABLE_SIZE_ENCODER \
   "grpc.http2.hpack_table_size.encoder"
+/** Track header emission frequency with a count-min sketch when choosing
+    which literals to promote into the hpack encoder's dynamic table, instead
+    of the default coarse popularity filter. Helps workloads whose hottest
+    headers are application-provided (tracing or tenant ids). Bool valued. */
+#define GRPC_ARG_HTTP2_HPACK_ADAPTIVE_INDEXING \
+  "grpc.experimental.http2_hpack_adaptive_indexing"
 /** How big a frame are we willing to receive via HTTP2.
     Min 16384, max 16777215. Larger values give lower CPU usage for large
     messages, but more head of line blocking for small messages. */
@@ -231,6 +271,27 @@ typedef struct {
 /** How much data are we willing to queue up per stream if
     GRPC_WRITE_BUFFER_HINT is set? This is an upper bound */
 #define GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE "grpc.http2.write_buffer_size"
+/** If non-zero, hold outgoing http2 frame passes that gathered fewer bytes
+    than this in the transport's write buffer, for up to
+    GRPC_ARG_HTTP2_WRITE_COALESCE_MAX_DELAY_MS, so that frames from later
+    passes are flushed in the same (larger) endpoint write. Defaults to 0
+    (every pass is flushed immediately). */
+#define GRPC_ARG_HTTP2_WRITE_COALESCE_MIN_BYTES \
+  "grpc.experimental.http2_write_coalesce_min_bytes"
+/** Longest time (milliseconds) a sub-threshold write pass may be deferred
+    waiting for more frames to coalesce. Only used when
+    GRPC_ARG_HTTP2_WRITE_COALESCE_MIN_BYTES is non-zero. Defaults to 1. */
+#define GRPC_ARG_HTTP2_WRITE_COALESCE_MAX_DELAY_MS \
+  "grpc.experimental.http2_write_coalesce_max_delay_ms"
+/** If non-zero, enables weighted write scheduling across the streams of an
+    http2 connection: each write pass lets a stream contribute at most
+    (quantum * stream weight) flow-controlled bytes before yielding to other
+    writable streams, instead of draining streams strictly FIFO. The value is
+    the per-weight-unit byte quantum. Streams default to weight 16; calls
+    tagged with GRPC_INITIAL_METADATA_LOW_WRITE_PRIORITY get weight 1.
+    Defaults to 0 (FIFO scheduling). */
+#define GRPC_ARG_HTTP2_WRITE_SCHEDULING_QUANTUM \
+  "grpc.experimental.http2_write_scheduling_quantum"
 /** Should we allow receipt of true-binary data on http2 connections?
     Defaults to on (1) */
 #define GRPC_ARG_HTTP2_ENABLE_TRUE_BINARY "grpc.http2.true_binary"
@@ -261,12 +322,52 @@ typedef struct {
 /** The time between the first and second connection attempts, in ms */
 #define GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS \
   "grpc.initial_reconnect_backoff_ms"
+/** If non-zero, reconnect attempts are admitted through a process-wide
+    controller that spaces them out, so that subchannels which all lost
+    their transport at the same instant (typically a server restart) do
+    not retry as one synchronized wave. Together with
+    GRPC_ARG_EXPERIMENTAL_MAX_CONCURRENT_RECONNECTS this bounds the
+    process to roughly that many attempts per window of this many ms; an
+    attempt is never delayed past its own backoff deadline plus one
+    window. Defaults to 0 (admission control disabled).
+    This is an EXPERIMENTAL argument and may be removed. */
+#define GRPC_ARG_EXPERIMENTAL_RECONNECT_SPREAD_MS \
+  "grpc.experimental.reconnect_spread_ms"
+/** Number of reconnect attempts admitted per
+    GRPC_ARG_EXPERIMENTAL_RECONNECT_SPREAD_MS window when reconnect
+    spreading is enabled. Defaults to 8.
+    This is an EXPERIMENTAL argument and may be removed. */
+#define GRPC_ARG_EXPERIMENTAL_MAX_CONCURRENT_RECONNECTS \
+  "grpc.experimental.max_concurrent_reconnects"
+/** If non-zero, pick_first races connection attempts in the style of
+    RFC 8305 (Happy Eyeballs): when an attempt to an address has not
+    completed within this many ms, an attempt to the next address is
+    started in parallel and the first one to become READY wins. The
+    RFC-recommended value is 250 ms. Defaults to 0 (racing disabled).
+    This is an EXPERIMENTAL argument and may be removed. */
+#define GRPC_ARG_EXPERIMENTAL_HAPPY_EYEBALLS_DELAY_MS \
+  "grpc.experimental.happy_eyeballs_delay_ms"
 /** Minimum amount of time between DNS resolutions, in ms */
 #define GRPC_ARG_DNS_MIN_TIME_BETWEEN_RESOLUTIONS_MS \
   "grpc.dns_min_time_between_resolutions_ms"
 /** The timeout used on servers for finishing handshaking on an incoming
     connection.  Defaults to 120 seconds. */
 #define GRPC_ARG_SERVER_HANDSHAKE_TIMEOUT_MS "grpc.server_handshake_timeout_ms"
+/** If non-zero, bounds the number of incoming calls the server will hold
+    pending per method while the application has no free request slot. While
+    bounded, pending calls are matched newest-first and calls shed to stay
+    within the bound (oldest first, preferring calls whose deadlines have
+    already expired) are cancelled with RESOURCE_EXHAUSTED before incurring
+    any further per-call work. Int valued; 0 (the default) keeps the
+    unbounded FIFO pending queue. */
+#define GRPC_ARG_SERVER_MAX_PENDING_REQUESTS "grpc.server_max_pending_requests"
+/** If non-zero, bounds graceful server shutdown in milliseconds: streams
+    still running this long after grpc_server_shutdown_and_notify() are
+    cancelled and their connections disconnected, so shutdown completes
+    within the budget instead of waiting on the slowest call. Int valued;
+    0 (the default) drains without a time limit. */
+#define GRPC_ARG_SERVER_SHUTDOWN_DRAIN_TIMEOUT_MS \
+  "grpc.server_shutdown_drain_timeout_ms"
 /** This *should* be used for testing only.
     The caller of the secure_channel_create functions may override the target
     name used for SSL host name checking using this channel argument which is of
@@ -279,6 +380,14 @@ typedef struct {
     grpc_ssl_session_cache*). (use grpc_ssl_session_cache_arg_vtable() to fetch
     an appropriate pointer arg vtable) */
 #define GRPC_SSL_SESSION_CACHE_ARG "grpc.ssl_session_cache"
+/** EXPERIMENTAL. If non-zero, offer TLS 1.3 0-RTT early data on
+    session-ticket resumed reconnects where the SSL implementation supports
+    it. Bytes written before the server accepts the handshake may be
+    replayed by an attacker, so enable this only on channels whose early
+    traffic is idempotent. If the server rejects the early data the
+    connection attempt fails and is retried with a full handshake. */
+#define GRPC_ARG_EXPERIMENTAL_TLS_ENABLE_EARLY_DATA \
+  "grpc.experimental.tls_enable_early_data"
 /** If non-zero, it will determine the maximum frame size used by TSI's frame
  *  protector.
  *
@@ -349,6 +458,33 @@ typedef struct {
    issued by the tcp_write(). By default, this is set to 4. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS \
   "grpc.experimental.tcp_tx_zerocopy_max_simultaneous_sends"
+/* TCP RX Zerocopy enable state: zero is disabled, non-zero is enabled. When
+   enabled, reads large enough to cover whole pages map payload directly from
+   the kernel via TCP_ZEROCOPY_RECEIVE instead of copying through recvmsg.
+   Falls back to the copying read path on kernels without support. By default,
+   it is disabled. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED \
+  "grpc.experimental.tcp_rx_zerocopy_enabled"
+/* TCP RX Zerocopy read threshold: only attempt a zerocopy receive if the read
+   is offered >= this many bytes of buffer. By default, this is set to 1MB. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_READ_BYTES_THRESHOLD \
+  "grpc.experimental.tcp_rx_zerocopy_read_bytes_threshold"
+/* If non-zero on Linux, sets TCP_NOTSENT_LOWAT on the connection so that the
+   poller only reports the socket writable while fewer than this many
+   not-yet-sent bytes sit in the kernel send buffer, and the write path stops
+   flushing once the unsent backlog reaches that mark. Data queued behind the
+   mark stays in userspace, where the transport can still reprioritize it,
+   bounding per-connection kernel buffering to roughly this many bytes. Zero
+   (the default) writes until EAGAIN, preserving the historical behavior. */
+#define GRPC_ARG_TCP_TX_NOTSENT_LOWAT_BYTES \
+  "grpc.experimental.tcp_tx_notsent_lowat_bytes"
+/* Maximum number of connections a posix TCP server accepts per listener
+   wakeup before handing the remainder of the listen queue drain to an
+   executor thread, so connection setup parallelizes during reconnect storms
+   instead of monopolizing one pollset worker. Zero (the default) drains the
+   queue inline, preserving the historical behavior. */
+#define GRPC_ARG_TCP_SERVER_ACCEPT_BURST_SIZE \
+  "grpc.experimental.tcp_server_accept_burst_size"
 /* Timeout in milliseconds to use for calls to the grpclb load balancer.
    If 0 or unset, the balancer calls will have no deadline. */
 #define GRPC_ARG_GRPCLB_CALL_TIMEOUT_MS "grpc.grpclb_call_timeout_ms"
@@ -405,6 +541,13 @@ typedef struct {
 #define GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING "grpc.experimental.enable_hedging"
 /** Per-RPC retry buffer size, in bytes. Default is 256 KiB. */
 #define GRPC_ARG_PER_RPC_RETRY_BUFFER_SIZE "grpc.per_rpc_retry_buffer_size"
+/** Channel args whose keys start with this prefix are classified as not
+    affecting how a subchannel connects or behaves once connected, and are
+    excluded from subchannel keys. Channels that differ only in such args
+    (plus a built-in list of known connection-irrelevant args) therefore
+    share established subchannels from the subchannel pool instead of
+    reconnecting. */
+#define GRPC_ARG_NO_SUBCHANNEL_PREFIX "grpc.internal.no_subchannel."
 /** Channel arg that carries the bridged objective c object for custom metrics
  * logging filter. */
 #define GRPC_ARG_MOBILE_LOG_CONTEXT "grpc.mobile_log_context"
@@ -437,6 +580,49 @@ typedef struct {
 /** If set, uses a local subchannel pool within the channel. Otherwise, uses the
  * global subchannel pool. */
 #define GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL "grpc.use_local_subchannel_pool"
+/** If set to N > 1, the channel maintains N parallel subchannel connections
+    per resolved address, and the LB policy stripes RPCs across them. Most
+    useful together with round_robin to scale throughput to a single target
+    past the limits of one HTTP/2 connection. */
+#define GRPC_ARG_SUBCHANNEL_SHARDS "grpc.subchannel_shards"
+/** If non-zero, the channel starts name resolution and connection
+    establishment as soon as it is created, instead of waiting for the
+    first RPC (or an explicit connectivity-state poll) to trigger them.
+    This warms DNS + TCP + TLS + SETTINGS ahead of demand so the first
+    RPC does not pay the cold-start cost. This is an EXPERIMENTAL
+    argument and may be removed. */
+#define GRPC_ARG_EXPERIMENTAL_PRECONNECT_ON_CREATION \
+  "grpc.experimental.preconnect_on_creation"
+/** If non-zero, collect timestamps for every transport write made on behalf
+    of a call on this channel and report them to the call's tracer (if one is
+    installed). On Linux kernels with SO_TIMESTAMPING support the transport
+    additionally arranges for kernel scheduled/sent/acked timestamps to be
+    collected for these writes; on other platforms the timestamps fall back
+    to the userspace clock. This is an EXPERIMENTAL argument and may be
+    removed. */
+#define GRPC_ARG_EXPERIMENTAL_COLLECT_WRITE_TIMESTAMPS \
+  "grpc.experimental.collect_write_timestamps"
+/** If non-zero, use deferred TCP Fast Open connects on kernels that support
+    TCP_FASTOPEN_CONNECT (Linux 4.11+): connect() completes immediately and
+    the first bytes written to the socket - the TLS ClientHello or the
+    HTTP/2 client preface - are carried in the SYN payload when a Fast Open
+    cookie for the destination is cached, saving one round trip per
+    reconnect. Falls back to a regular three-way handshake when no cookie is
+    available or the kernel lacks support. Connection failures then surface
+    as I/O errors on the established endpoint rather than as connect errors.
+    This is an EXPERIMENTAL argument and may be removed. */
+#define GRPC_ARG_EXPERIMENTAL_TCP_FASTOPEN_CONNECT \
+  "grpc.experimental.tcp_fastopen_connect"
+/** If positive, sets SO_BUSY_POLL on this channel's TCP sockets so the
+    kernel busy-polls the device queue for up to this many microseconds
+    before sleeping in a blocking receive, trading CPU for lower wakeup
+    latency. Requires CAP_NET_ADMIN and a driver with busy-poll support;
+    silently ignored otherwise. Usually combined with the
+    grpc_experimental_epoll1_busy_poll_usec configuration variable, which
+    makes poller threads spin in userspace before blocking in epoll_wait.
+    This is an EXPERIMENTAL argument and may be removed. */
+#define GRPC_ARG_EXPERIMENTAL_TCP_BUSY_POLL_USEC \
+  "grpc.experimental.tcp_busy_poll_usec"
 /** gRPC Objective-C channel pooling domain string. */
 #define GRPC_ARG_CHANNEL_POOL_DOMAIN "grpc.channel_pooling_domain"
 /** gRPC Objective-C channel pooling id. */
@@ -520,6 +706,16 @@ typedef enum grpc_call_error {
 #define GRPC_INITIAL_METADATA_WAIT_FOR_READY_EXPLICITLY_SET (0x00000080u)
 /** Signal that the initial metadata should be corked */
 #define GRPC_INITIAL_METADATA_CORKED (0x00000100u)
+/** Signal that the call's outgoing DATA frames should yield to other streams
+    sharing the connection when the transport has weighted write scheduling
+    enabled (see GRPC_ARG_HTTP2_WRITE_SCHEDULING_QUANTUM). */
+#define GRPC_INITIAL_METADATA_LOW_WRITE_PRIORITY (0x00000200u)
+/** Signal that the metadata attached to this operation was validated up
+    front via grpc_validated_metadata_create() and is backed by
+    application-owned slices that outlive the call: the library references
+    the slices directly instead of validating, interning or copying them on
+    every call. */
+#define GRPC_WRITE_METADATA_NO_COPY (0x00000400u)
 
 /** Mask of all valid flags */
 #define GRPC_INITIAL_METADATA_USED_MASK                  \
@@ -527,7 +723,9 @@ typedef enum grpc_call_error {
    GRPC_INITIAL_METADATA_WAIT_FOR_READY |                \
    GRPC_INITIAL_METADATA_CACHEABLE_REQUEST |             \
    GRPC_INITIAL_METADATA_WAIT_FOR_READY_EXPLICITLY_SET | \
-   GRPC_INITIAL_METADATA_CORKED | GRPC_WRITE_THROUGH)
+   GRPC_INITIAL_METADATA_CORKED |                        \
+   GRPC_INITIAL_METADATA_LOW_WRITE_PRIORITY |            \
+   GRPC_WRITE_METADATA_NO_COPY | GRPC_WRITE_THROUGH)
 
 /** A single metadata element */
 typedef struct grpc_metadata {
@@ -544,6 +742,10 @@ typedef struct grpc_metadata {
   } internal_data;
 } grpc_metadata;
 
+/** Opaque handle to a set of metadata elements validated once, up front; see
+    grpc_validated_metadata_create(). */
+typedef struct grpc_validated_metadata grpc_validated_metadata;
+
 /** The type of completion (for grpc_event) */
 typedef enum grpc_completion_type {
   /** Shutting down */
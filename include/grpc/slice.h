@@ -75,6 +75,14 @@ GPRAPI grpc_slice grpc_slice_malloc_large(size_t length);
    of bytes is a slice which points to the same memory. */
 GPRAPI grpc_slice grpc_slice_intern(grpc_slice slice);
 
+/** EXPERIMENTAL API. Registers \a str as a well-known metadata string (for
+   example a custom header name sent on every call). Must be called before
+   grpc_init(); the string is copied. Registered strings are pre-interned at
+   initialization into a lock-free lookup table consulted alongside gRPC's
+   own static metadata, so interning them never takes the slow path.
+   Registrations persist across grpc_shutdown()/grpc_init() cycles. */
+GPRAPI void grpc_slice_register_well_known_string(const char* str);
+
 /** Create a slice by copying a string.
    Does not preserve null terminators.
    Equivalent to:
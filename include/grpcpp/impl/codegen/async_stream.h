@@ -577,6 +577,28 @@ class ClientAsyncReaderWriter final
     call_.PerformOps(&write_ops_);
   }
 
+  /// Write \a msg, taking over its contents and leaving it empty. For
+  /// ByteBuffer relays this splices the received slices straight into the
+  /// send path instead of duplicating the buffer per hop; a relay that
+  /// only issues its next Read once this Write completes gets end-to-end
+  /// backpressure from the transports' flow control, with in-flight bytes
+  /// bounded by one message plus the flow-control windows.
+  void Write(W&& msg, ::grpc::WriteOptions options, void* tag) {
+    GPR_CODEGEN_ASSERT(started_);
+    write_ops_.set_output_tag(tag);
+    if (options.is_last_message()) {
+      options.set_buffer_hint();
+      write_ops_.ClientSendClose();
+    }
+    GPR_CODEGEN_ASSERT(
+        write_ops_.SendMessage(static_cast<W&&>(msg), options).ok());
+    call_.PerformOps(&write_ops_);
+  }
+
+  void Write(W&& msg, void* tag) {
+    Write(static_cast<W&&>(msg), ::grpc::WriteOptions(), tag);
+  }
+
   void WritesDone(void* tag) override {
     GPR_CODEGEN_ASSERT(started_);
     write_ops_.set_output_tag(tag);
@@ -1058,6 +1080,27 @@ class ServerAsyncReaderWriter final
     call_.PerformOps(&write_ops_);
   }
 
+  /// Write \a msg, taking over its contents and leaving it empty. For
+  /// ByteBuffer relays this splices the received slices straight into the
+  /// send path instead of duplicating the buffer per hop; a relay that
+  /// only issues its next Read once this Write completes gets end-to-end
+  /// backpressure from the transports' flow control, with in-flight bytes
+  /// bounded by one message plus the flow-control windows.
+  void Write(W&& msg, ::grpc::WriteOptions options, void* tag) {
+    write_ops_.set_output_tag(tag);
+    if (options.is_last_message()) {
+      options.set_buffer_hint();
+    }
+    EnsureInitialMetadataSent(&write_ops_);
+    GPR_CODEGEN_ASSERT(
+        write_ops_.SendMessage(static_cast<W&&>(msg), options).ok());
+    call_.PerformOps(&write_ops_);
+  }
+
+  void Write(W&& msg, void* tag) {
+    Write(static_cast<W&&>(msg), ::grpc::WriteOptions(), tag);
+  }
+
   /// See the \a ServerAsyncReaderWriterInterface.WriteAndFinish
   /// method for semantics.
   ///
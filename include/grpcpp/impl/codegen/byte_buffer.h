@@ -95,6 +95,12 @@ class ByteBuffer final {
   /// size-independent.
   ByteBuffer(const ByteBuffer& buf) : buffer_(nullptr) { operator=(buf); }
 
+  /// Construct a byte buffer by taking over the contents of \a buf, which
+  /// is left empty. Unlike copying, no slice references change hands.
+  ByteBuffer(ByteBuffer&& buf) noexcept : buffer_(buf.buffer_) {
+    buf.buffer_ = nullptr;
+  }
+
   ~ByteBuffer() {
     if (buffer_) {
       g_core_codegen_interface->grpc_byte_buffer_destroy(buffer_);
@@ -115,6 +121,17 @@ class ByteBuffer final {
     return *this;
   }
 
+  /// Take over the contents of \a buf, which is left empty. Unlike copying,
+  /// no slice references change hands.
+  ByteBuffer& operator=(ByteBuffer&& buf) noexcept {
+    if (this != &buf) {
+      Clear();
+      buffer_ = buf.buffer_;
+      buf.buffer_ = nullptr;
+    }
+    return *this;
+  }
+
   // If this ByteBuffer's representation is a single flat slice, returns a
   // slice referencing that array.
   Status TrySingleSlice(Slice* slice) const;
@@ -122,6 +139,14 @@ class ByteBuffer final {
   /// Dump (read) the buffer contents into \a slics.
   Status DumpToSingleSlice(Slice* slice) const;
 
+  /// Point \a slice at a single contiguous region holding this buffer's
+  /// bytes. If the buffer is already a single uncompressed slice, the
+  /// returned slice references (ref-counts) that storage without copying;
+  /// otherwise the contents are flattened into a new slice. Either way the
+  /// returned slice owns its data and stays valid after this buffer -- and
+  /// the call it was received on -- goes away.
+  Status PinSingleSlice(Slice* slice) const;
+
   /// Dump (read) the buffer contents into \a slices.
   Status Dump(std::vector<Slice>* slices) const;
 
@@ -0,0 +1,77 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPCPP_IMPL_CODEGEN_CALL_ARENA_ALLOCATOR_H
+#define GRPCPP_IMPL_CODEGEN_CALL_ARENA_ALLOCATOR_H
+
+// IWYU pragma: private, include <grpcpp/support/call_arena_allocator.h>
+
+#include <cstddef>
+
+#include <grpcpp/impl/codegen/core_codegen_interface.h>
+
+namespace grpc {
+namespace experimental {
+
+/// EXPERIMENTAL: STL-compatible allocator drawing memory from a call's
+/// arena. Allocations live until the call is destroyed; \a deallocate is
+/// a no-op, so this is only suitable for request-scoped scratch memory
+/// whose footprint is bounded by the life of the RPC. Obtain an instance
+/// from ClientContext::call_arena_allocator() or
+/// ServerContextBase::call_arena_allocator().
+template <typename T>
+class CallArenaAllocator {
+ public:
+  using value_type = T;
+
+  explicit CallArenaAllocator(grpc_call* call) : call_(call) {}
+
+  template <typename U>
+  CallArenaAllocator(const CallArenaAllocator<U>& other)  // NOLINT
+      : call_(other.call()) {}
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(g_core_codegen_interface->grpc_call_arena_alloc(
+        call_, n * sizeof(T)));
+  }
+
+  // Arena memory is released in one shot when the call is destroyed.
+  void deallocate(T* /*p*/, std::size_t /*n*/) {}
+
+  grpc_call* call() const { return call_; }
+
+ private:
+  grpc_call* call_;
+};
+
+template <typename T, typename U>
+bool operator==(const CallArenaAllocator<T>& a,
+                const CallArenaAllocator<U>& b) {
+  return a.call() == b.call();
+}
+
+template <typename T, typename U>
+bool operator!=(const CallArenaAllocator<T>& a,
+                const CallArenaAllocator<U>& b) {
+  return !(a == b);
+}
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_IMPL_CODEGEN_CALL_ARENA_ALLOCATOR_H
@@ -36,6 +36,7 @@
 #include <grpcpp/impl/codegen/completion_queue_tag.h>
 #include <grpcpp/impl/codegen/config.h>
 #include <grpcpp/impl/codegen/core_codegen_interface.h>
+#include <grpcpp/impl/codegen/decode_offload.h>
 #include <grpcpp/impl/codegen/intercepted_channel.h>
 #include <grpcpp/impl/codegen/interceptor_common.h>
 #include <grpcpp/impl/codegen/serialization_traits.h>
@@ -80,7 +81,7 @@ inline grpc_metadata* FillMetadataArray(
 /// Per-message write options.
 class WriteOptions {
  public:
-  WriteOptions() : flags_(0), last_message_(false) {}
+  WriteOptions() : flags_(0), last_message_(false), write_ahead_(false) {}
 
   /// Clear all flags.
   inline void Clear() { flags_ = 0; }
@@ -182,6 +183,28 @@ class WriteOptions {
   /// \sa GRPC_WRITE_LAST_MESSAGE
   bool is_last_message() const { return last_message_; }
 
+  /// write-ahead bit: lets a blocking Write return as soon as the message has
+  /// been handed to the transport instead of waiting for the write to
+  /// complete, so the application can prepare the next message while the
+  /// previous one is still being flushed. The deferred completion is reaped
+  /// by the next operation on the stream (or by the end of the RPC), which is
+  /// where a failure of a write-ahead write is reported. Currently honored
+  /// only by the synchronous server-side streaming APIs.
+  inline WriteOptions& set_write_ahead() {
+    write_ahead_ = true;
+    return *this;
+  }
+
+  /// Clears the write-ahead bit, restoring fully blocking Write semantics.
+  inline WriteOptions& clear_write_ahead() {
+    write_ahead_ = false;
+    return *this;
+  }
+
+  /// Get value for the flag indicating that the write may complete before the
+  /// transport finishes flushing the message.
+  bool is_write_ahead() const { return write_ahead_; }
+
  private:
   void SetBit(const uint32_t mask) { flags_ |= mask; }
 
@@ -191,6 +214,7 @@ class WriteOptions {
 
   uint32_t flags_;
   bool last_message_;
+  bool write_ahead_;
 };
 
 namespace internal {
@@ -203,6 +227,7 @@ class CallNoOp {
  protected:
   void AddOp(grpc_op* /*ops*/, size_t* /*nops*/) {}
   void FinishOp(bool* /*status*/) {}
+  void MaybeOffloadDecode(bool /*status*/, DecodeOffloadTask* /*task*/) {}
   void SetInterceptionHookPoint(
       InterceptorBatchMethodsImpl* /*interceptor_methods*/) {}
   void SetFinishInterceptionHookPoint(
@@ -254,6 +279,8 @@ class CallOpSendInitialMetadata {
     send_ = false;
   }
 
+  void MaybeOffloadDecode(bool /*status*/, DecodeOffloadTask* /*task*/) {}
+
   void SetInterceptionHookPoint(
       InterceptorBatchMethodsImpl* interceptor_methods) {
     if (!send_) return;
@@ -294,6 +321,16 @@ class CallOpSendMessage {
   template <class M>
   Status SendMessage(const M& message) GRPC_MUST_USE_RESULT;
 
+  /// Send \a message, taking over its contents and leaving it empty. This
+  /// splices the buffer's slices straight into the send path by pointer:
+  /// unlike the copying overload, no byte buffer is duplicated and no slice
+  /// references change hands, which matters for relays that forward each
+  /// received ByteBuffer to another call.
+  Status SendMessage(ByteBuffer&& message,
+                     WriteOptions options) GRPC_MUST_USE_RESULT;
+
+  Status SendMessage(ByteBuffer&& message) GRPC_MUST_USE_RESULT;
+
   /// Send \a message using \a options for the write. The \a options are cleared
   /// after use. This form of SendMessage allows gRPC to reference \a message
   /// beyond the lifetime of SendMessage.
@@ -337,6 +374,8 @@ class CallOpSendMessage {
     }
   }
 
+  void MaybeOffloadDecode(bool /*status*/, DecodeOffloadTask* /*task*/) {}
+
   void SetInterceptionHookPoint(
       InterceptorBatchMethodsImpl* interceptor_methods) {
     if (msg_ == nullptr && !send_buf_.Valid()) return;
@@ -395,6 +434,17 @@ Status CallOpSendMessage::SendMessage(const M& message) {
   return SendMessage(message, WriteOptions());
 }
 
+inline Status CallOpSendMessage::SendMessage(ByteBuffer&& message,
+                                             WriteOptions options) {
+  write_options_ = options;
+  send_buf_ = static_cast<ByteBuffer&&>(message);
+  return Status();
+}
+
+inline Status CallOpSendMessage::SendMessage(ByteBuffer&& message) {
+  return SendMessage(static_cast<ByteBuffer&&>(message), WriteOptions());
+}
+
 template <class M>
 Status CallOpSendMessage::SendMessagePtr(const M* message,
                                          WriteOptions options) {
@@ -435,6 +485,7 @@ class CallOpRecvMessage {
  protected:
   void AddOp(grpc_op* ops, size_t* nops) {
     if (message_ == nullptr || hijacked_) return;
+    offload_done_ = false;
     grpc_op* op = &ops[(*nops)++];
     op->op = GRPC_OP_RECV_MESSAGE;
     op->flags = 0;
@@ -444,6 +495,11 @@ class CallOpRecvMessage {
 
   void FinishOp(bool* status) {
     if (message_ == nullptr) return;
+    if (offload_done_) {
+      // The decode offload pool already parsed this message.
+      got_message = *status = offload_ok_;
+      return;
+    }
     if (recv_buf_.Valid()) {
       if (*status) {
         got_message = *status =
@@ -467,6 +523,20 @@ class CallOpRecvMessage {
     }
   }
 
+  void MaybeOffloadDecode(bool status, DecodeOffloadTask* task) {
+    if (!status || message_ == nullptr || hijacked_ || !recv_buf_.Valid() ||
+        recv_buf_.Length() < g_decode_offload_threshold) {
+      return;
+    }
+    task->Add([this] {
+      offload_ok_ =
+          SerializationTraits<R>::Deserialize(recv_buf_.bbuf_ptr(), message_)
+              .ok();
+      recv_buf_.Release();
+      offload_done_ = true;
+    });
+  }
+
   void SetInterceptionHookPoint(
       InterceptorBatchMethodsImpl* interceptor_methods) {
     if (message_ == nullptr) return;
@@ -503,6 +573,8 @@ class CallOpRecvMessage {
   bool allow_not_getting_message_ = false;
   bool hijacked_ = false;
   bool hijacked_recv_message_failed_ = false;
+  bool offload_done_ = false;
+  bool offload_ok_ = false;
 };
 
 class DeserializeFunc {
@@ -544,6 +616,7 @@ class CallOpGenericRecvMessage {
  protected:
   void AddOp(grpc_op* ops, size_t* nops) {
     if (!deserialize_ || hijacked_) return;
+    offload_done_ = false;
     grpc_op* op = &ops[(*nops)++];
     op->op = GRPC_OP_RECV_MESSAGE;
     op->flags = 0;
@@ -553,6 +626,12 @@ class CallOpGenericRecvMessage {
 
   void FinishOp(bool* status) {
     if (!deserialize_) return;
+    if (offload_done_) {
+      // The decode offload pool already parsed this message.
+      got_message = true;
+      *status = offload_ok_;
+      return;
+    }
     if (recv_buf_.Valid()) {
       if (*status) {
         got_message = true;
@@ -578,6 +657,18 @@ class CallOpGenericRecvMessage {
     }
   }
 
+  void MaybeOffloadDecode(bool status, DecodeOffloadTask* task) {
+    if (!status || !deserialize_ || hijacked_ || !recv_buf_.Valid() ||
+        recv_buf_.Length() < g_decode_offload_threshold) {
+      return;
+    }
+    task->Add([this] {
+      offload_ok_ = deserialize_->Deserialize(&recv_buf_).ok();
+      recv_buf_.Release();
+      offload_done_ = true;
+    });
+  }
+
   void SetInterceptionHookPoint(
       InterceptorBatchMethodsImpl* interceptor_methods) {
     if (!deserialize_) return;
@@ -616,6 +707,8 @@ class CallOpGenericRecvMessage {
   bool allow_not_getting_message_ = false;
   bool hijacked_ = false;
   bool hijacked_recv_message_failed_ = false;
+  bool offload_done_ = false;
+  bool offload_ok_ = false;
 };
 
 class CallOpClientSendClose {
@@ -634,6 +727,8 @@ class CallOpClientSendClose {
   }
   void FinishOp(bool* /*status*/) { send_ = false; }
 
+  void MaybeOffloadDecode(bool /*status*/, DecodeOffloadTask* /*task*/) {}
+
   void SetInterceptionHookPoint(
       InterceptorBatchMethodsImpl* interceptor_methods) {
     if (!send_) return;
@@ -691,6 +786,8 @@ class CallOpServerSendStatus {
     send_status_available_ = false;
   }
 
+  void MaybeOffloadDecode(bool /*status*/, DecodeOffloadTask* /*task*/) {}
+
   void SetInterceptionHookPoint(
       InterceptorBatchMethodsImpl* interceptor_methods) {
     if (!send_status_available_) return;
@@ -743,6 +840,8 @@ class CallOpRecvInitialMetadata {
     if (metadata_map_ == nullptr || hijacked_) return;
   }
 
+  void MaybeOffloadDecode(bool /*status*/, DecodeOffloadTask* /*task*/) {}
+
   void SetInterceptionHookPoint(
       InterceptorBatchMethodsImpl* interceptor_methods) {
     interceptor_methods->SetRecvInitialMetadata(metadata_map_);
@@ -817,6 +916,8 @@ class CallOpClientRecvStatus {
     g_core_codegen_interface->grpc_slice_unref(error_message_);
   }
 
+  void MaybeOffloadDecode(bool /*status*/, DecodeOffloadTask* /*task*/) {}
+
   void SetInterceptionHookPoint(
       InterceptorBatchMethodsImpl* interceptor_methods) {
     interceptor_methods->SetRecvStatus(recv_status_);
@@ -877,6 +978,7 @@ class CallOpSet : public CallOpSetInterface,
         return_tag_(this),
         call_(other.call_),
         done_intercepting_(false),
+        offload_pending_(false),
         interceptor_methods_(InterceptorBatchMethodsImpl()) {}
 
   CallOpSet& operator=(const CallOpSet& other) {
@@ -887,12 +989,14 @@ class CallOpSet : public CallOpSetInterface,
     return_tag_ = this;
     call_ = other.call_;
     done_intercepting_ = false;
+    offload_pending_ = false;
     interceptor_methods_ = InterceptorBatchMethodsImpl();
     return *this;
   }
 
   void FillOps(Call* call) override {
     done_intercepting_ = false;
+    offload_pending_ = false;
     g_core_codegen_interface->grpc_call_ref(call->call());
     call_ =
         *call;  // It's fine to create a copy of call since it's just pointers
@@ -918,6 +1022,40 @@ class CallOpSet : public CallOpSetInterface,
       return true;
     }
 
+    if (offload_pending_) {
+      // The decode offload pool finished parsing and bounced the tag back
+      // to us; resume with the original batch status.
+      offload_pending_ = false;
+      call_.cq()->CompleteAvalanching();
+      *status = saved_status_;
+    } else if (g_decode_offload_pool != nullptr && core_cq_tag_ == this) {
+      DecodeOffloadTask task;
+      this->Op1::MaybeOffloadDecode(*status, &task);
+      this->Op2::MaybeOffloadDecode(*status, &task);
+      this->Op3::MaybeOffloadDecode(*status, &task);
+      this->Op4::MaybeOffloadDecode(*status, &task);
+      this->Op5::MaybeOffloadDecode(*status, &task);
+      this->Op6::MaybeOffloadDecode(*status, &task);
+      if (!task.empty()) {
+        // Swallow the event: parse on the pool, then bounce an empty batch
+        // through the call so the tag resurfaces with the message ready.
+        offload_pending_ = true;
+        saved_status_ = *status;
+        // This schedules another batch, so delay cq shutdown until the
+        // bounced batch comes back.
+        call_.cq()->RegisterAvalanching();
+        grpc_call* call = call_.call();
+        void* core_cq_tag = core_cq_tag_;
+        g_decode_offload_pool->Schedule([task, call, core_cq_tag]() mutable {
+          task.Run();
+          GPR_CODEGEN_ASSERT(g_core_codegen_interface->grpc_call_start_batch(
+                                 call, nullptr, 0, core_cq_tag, nullptr) ==
+                             GRPC_CALL_OK);
+        });
+        return false;
+      }
+    }
+
     this->Op1::FinishOp(status);
     this->Op2::FinishOp(status);
     this->Op3::FinishOp(status);
@@ -995,18 +1133,22 @@ class CallOpSet : public CallOpSetInterface,
  private:
   // Returns true if no interceptors need to be run
   bool RunInterceptors() {
+    interceptor_methods_.SetCall(&call_);
+    if (interceptor_methods_.InterceptorsListEmpty()) {
+      // Common case: the call has no interceptors attached, so skip the hook
+      // bookkeeping entirely - the SetInterceptionHookPoint calls below only
+      // record state for interceptors to inspect and have no effect of their
+      // own.
+      return true;
+    }
     interceptor_methods_.ClearState();
     interceptor_methods_.SetCallOpSetInterface(this);
-    interceptor_methods_.SetCall(&call_);
     this->Op1::SetInterceptionHookPoint(&interceptor_methods_);
     this->Op2::SetInterceptionHookPoint(&interceptor_methods_);
     this->Op3::SetInterceptionHookPoint(&interceptor_methods_);
     this->Op4::SetInterceptionHookPoint(&interceptor_methods_);
     this->Op5::SetInterceptionHookPoint(&interceptor_methods_);
     this->Op6::SetInterceptionHookPoint(&interceptor_methods_);
-    if (interceptor_methods_.InterceptorsListEmpty()) {
-      return true;
-    }
     // This call will go through interceptors and would need to
     // schedule new batches, so delay completion queue shutdown
     call_.cq()->RegisterAvalanching();
@@ -1014,7 +1156,10 @@ class CallOpSet : public CallOpSetInterface,
   }
   // Returns true if no interceptors need to be run
   bool RunInterceptorsPostRecv() {
-    // Call and OpSet had already been set on the set state.
+    // Call had already been set on the set state by RunInterceptors. Unlike
+    // the pre-batch hooks, the finish hooks double as per-op cleanup
+    // (releasing send buffers, resetting deserializers), so they run whether
+    // or not any interceptor is attached.
     // SetReverse also clears previously set hook points
     interceptor_methods_.SetReverse();
     this->Op1::SetFinishInterceptionHookPoint(&interceptor_methods_);
@@ -1023,6 +1168,11 @@ class CallOpSet : public CallOpSetInterface,
     this->Op4::SetFinishInterceptionHookPoint(&interceptor_methods_);
     this->Op5::SetFinishInterceptionHookPoint(&interceptor_methods_);
     this->Op6::SetFinishInterceptionHookPoint(&interceptor_methods_);
+    if (interceptor_methods_.InterceptorsListEmpty()) {
+      // RunInterceptors() below requires the op set interface, which is only
+      // installed when the pre-batch hooks actually run.
+      return true;
+    }
     return interceptor_methods_.RunInterceptors();
   }
 
@@ -1030,6 +1180,7 @@ class CallOpSet : public CallOpSetInterface,
   void* return_tag_;
   Call call_;
   bool done_intercepting_ = false;
+  bool offload_pending_ = false;
   InterceptorBatchMethodsImpl interceptor_methods_;
   bool saved_status_;
 };
@@ -29,7 +29,8 @@
 /// compression options, can be made persistent at channel construction time
 /// (see \a grpc::CreateCustomChannel).
 ///
-/// \warning ClientContext instances should \em not be reused across rpcs.
+/// \warning ClientContext instances should \em not be reused across rpcs,
+/// except via the (experimental) \a Reset method.
 
 #ifndef GRPCPP_IMPL_CODEGEN_CLIENT_CONTEXT_H
 #define GRPCPP_IMPL_CODEGEN_CLIENT_CONTEXT_H
@@ -42,6 +43,7 @@
 
 #include <grpc/impl/codegen/compression_types.h>
 #include <grpc/impl/codegen/propagation_bits.h>
+#include <grpcpp/impl/codegen/call_arena_allocator.h>
 #include <grpcpp/impl/codegen/client_interceptor.h>
 #include <grpcpp/impl/codegen/config.h>
 #include <grpcpp/impl/codegen/core_codegen_interface.h>
@@ -189,7 +191,8 @@ class PropagationOptions {
 /// compression options, can be made persistent at channel construction time
 /// (see \a grpc::CreateCustomChannel).
 ///
-/// \warning ClientContext instances should \em not be reused across rpcs.
+/// \warning ClientContext instances should \em not be reused across rpcs,
+///          except via the (experimental) \a Reset method.
 /// \warning The ClientContext instance used for creating an rpc must remain
 ///          alive and valid for the lifetime of the rpc.
 class ClientContext {
@@ -402,6 +405,20 @@ class ClientContext {
   /// (though their ok result may reflect the effect of cancellation).
   void TryCancel();
 
+  /// EXPERIMENTAL API
+  ///
+  /// Restores this context to a freshly constructed state so that it can be
+  /// used for another call, retaining the configuration applied to it: added
+  /// initial metadata, credentials, authority, compression settings,
+  /// propagation setup and the census context all carry over, as does
+  /// already-allocated metadata storage. The deadline is cleared and must be
+  /// set again if one is required. GlobalCallbacks are not re-run.
+  ///
+  /// It is only valid to call this once any previous RPC issued with this
+  /// context has completed: the sync API has returned, or (for async and
+  /// callback APIs) all of the RPC's tags have been delivered.
+  void Reset();
+
   /// Global Callbacks
   ///
   /// Can be set exactly once per application to install hooks whenever
@@ -418,6 +435,18 @@ class ClientContext {
   /// Applications never need to call this method.
   grpc_call* c_call() { return call_; }
 
+  /// EXPERIMENTAL API
+  ///
+  /// Returns an allocator bound to this call's arena, suitable for
+  /// request-scoped scratch allocations. Memory obtained through it is
+  /// released in one shot when the call is destroyed, so it must not
+  /// outlive the RPC. Only valid once the RPC has started, since the
+  /// underlying call (and its arena) does not exist before then.
+  template <typename T>
+  grpc::experimental::CallArenaAllocator<T> call_arena_allocator() {
+    return grpc::experimental::CallArenaAllocator<T>(call_);
+  }
+
   /// EXPERIMENTAL debugging API
   ///
   /// if status is not ok() for an RPC, this will return a detailed string
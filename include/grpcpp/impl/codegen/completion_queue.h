@@ -187,6 +187,22 @@ class CompletionQueue : private ::grpc::GrpcLibraryCodegen {
                                   GPR_CLOCK_REALTIME)) == GOT_EVENT);
   }
 
+  /// EXPERIMENTAL
+  /// Batched variant of \a Next: blocks until at least one event is
+  /// available (or the queue shuts down), then opportunistically drains
+  /// further already-ready events without blocking again, amortizing the
+  /// wakeup cost across the batch.
+  ///
+  /// \param[out] tags Array of at least \a max_events entries; entry i is
+  ///        filled like \a Next's tag for the i-th event.
+  /// \param[out] oks Array of at least \a max_events entries, filled like
+  ///        \a Next's ok.
+  /// \param[in] max_events Capacity of the two arrays.
+  ///
+  /// \return The number of events delivered; 0 means the queue is fully
+  ///         drained and shut down.
+  size_t NextBatch(void** tags, bool* oks, size_t max_events);
+
   /// Read from the queue, blocking up to \a deadline (or the queue's shutdown).
   /// Both \a tag and \a ok are updated upon success (if an event is available
   /// within the \a deadline).  A \a tag points to an arbitrary location usually
@@ -0,0 +1,69 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPCPP_IMPL_CODEGEN_DECODE_OFFLOAD_H
+#define GRPCPP_IMPL_CODEGEN_DECODE_OFFLOAD_H
+
+// IWYU pragma: private, include <grpcpp/support/decode_offload.h>
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace grpc {
+namespace internal {
+
+/// The deserialization work a call op set wants moved off the
+/// completion-queue thread: one closure per pending received message.
+class DecodeOffloadTask {
+ public:
+  void Add(std::function<void()> decode) {
+    decodes_.push_back(std::move(decode));
+  }
+  bool empty() const { return decodes_.empty(); }
+  void Run() {
+    for (auto& decode : decodes_) {
+      decode();
+    }
+  }
+
+ private:
+  std::vector<std::function<void()>> decodes_;
+};
+
+/// Interface to the bounded decoder pool; the implementation lives in the
+/// library proper (src/cpp/common/decode_offload.cc).
+class DecodeOffloadPoolInterface {
+ public:
+  virtual ~DecodeOffloadPoolInterface() {}
+  virtual void Schedule(std::function<void()> work) = 0;
+};
+
+/// Pool installed by grpc::experimental::EnableDecodeOffload; null while
+/// the offload stage is disabled (the default).
+extern DecodeOffloadPoolInterface* g_decode_offload_pool;
+
+/// Received messages at least this many bytes long are parsed on the pool;
+/// smaller ones are deserialized inline as usual.
+extern size_t g_decode_offload_threshold;
+
+}  // namespace internal
+}  // namespace grpc
+
+#endif  // GRPCPP_IMPL_CODEGEN_DECODE_OFFLOAD_H
@@ -38,33 +38,38 @@ class MetadataMap {
 
   ~MetadataMap() { Destroy(); }
 
-  std::string GetBinaryErrorDetails() {
-    // if filled_, extract from the multimap for O(log(n))
+  // Looks up the first occurrence of \a key. While the multimap has not been
+  // materialized this is a scan of the received headers costing no
+  // allocations; afterwards it is an O(log(n)) multimap lookup. Returns false
+  // if the key is absent.
+  // TODO(ncteisen): plumb grpc-status-details-bin through core as a first
+  // class object, just like code and message.
+  bool Lookup(grpc::string_ref key, grpc::string_ref* value) {
     if (filled_) {
-      auto iter = map_.find(kBinaryErrorDetailsKey);
-      if (iter != map_.end()) {
-        return std::string(iter->second.begin(), iter->second.length());
-      }
+      auto iter = map_.find(key);
+      if (iter == map_.end()) return false;
+      *value = iter->second;
+      return true;
     }
-    // if not yet filled, take the O(n) lookup to avoid allocating the
-    // multimap until it is requested.
-    // TODO(ncteisen): plumb this through core as a first class object, just
-    // like code and message.
-    else {
-      for (size_t i = 0; i < arr_.count; i++) {
-        if (strncmp(reinterpret_cast<const char*>(
-                        GRPC_SLICE_START_PTR(arr_.metadata[i].key)),
-                    kBinaryErrorDetailsKey,
-                    GRPC_SLICE_LENGTH(arr_.metadata[i].key)) == 0) {
-          return std::string(reinterpret_cast<const char*>(
-                                 GRPC_SLICE_START_PTR(arr_.metadata[i].value)),
-                             GRPC_SLICE_LENGTH(arr_.metadata[i].value));
-        }
+    for (size_t i = 0; i < arr_.count; i++) {
+      if (StringRefFromSlice(&arr_.metadata[i].key) == key) {
+        *value = StringRefFromSlice(&arr_.metadata[i].value);
+        return true;
       }
     }
+    return false;
+  }
+
+  std::string GetBinaryErrorDetails() {
+    grpc::string_ref value;
+    if (Lookup(kBinaryErrorDetailsKey, &value)) {
+      return std::string(value.begin(), value.length());
+    }
     return std::string();
   }
 
+  // The full multimap view. The map is materialized lazily, on the first
+  // call here; callers that only need a single key should prefer Lookup().
   std::multimap<grpc::string_ref, grpc::string_ref>* map() {
     FillMap();
     return &map_;
@@ -94,9 +99,12 @@ class MetadataMap {
     filled_ = true;
     for (size_t i = 0; i < arr_.count; i++) {
       // TODO(yangg) handle duplicates?
-      map_.insert(std::pair<grpc::string_ref, grpc::string_ref>(
-          StringRefFromSlice(&arr_.metadata[i].key),
-          StringRefFromSlice(&arr_.metadata[i].value)));
+      // Headers mostly arrive in key order, so an end-hinted insert is
+      // usually O(1) and never worse than an unhinted one.
+      map_.insert(map_.end(),
+                  std::pair<grpc::string_ref, grpc::string_ref>(
+                      StringRefFromSlice(&arr_.metadata[i].key),
+                      StringRefFromSlice(&arr_.metadata[i].value)));
     }
   }
 };
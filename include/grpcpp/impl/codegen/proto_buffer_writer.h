@@ -29,6 +29,7 @@
 #include <grpcpp/impl/codegen/config_protobuf.h>
 #include <grpcpp/impl/codegen/core_codegen_interface.h>
 #include <grpcpp/impl/codegen/serialization_traits.h>
+#include <grpcpp/impl/codegen/slice.h>
 #include <grpcpp/impl/codegen/status.h>
 
 /// This header provides an object that writes bytes directly into a
@@ -72,6 +73,26 @@ class ProtoBufferWriter : public ::grpc::protobuf::io::ZeroCopyOutputStream {
     slice_buffer_ = &bp->data.raw.slice_buffer;
   }
 
+  /// Constructor for a writer that serializes into \a backing_buffer
+  /// before allocating any new slices. This lets callers that manage
+  /// their own pool of large buffers (e.g. wrapped into slices via
+  /// grpc_slice_new_with_user_data, which also makes them eligible for
+  /// the zero-copy send path) have the message serialized directly into
+  /// pool memory. The buffer must not be an inlined slice; if the
+  /// message outgrows it, additional slices are allocated as usual.
+  ///
+  /// \param[out] byte_buffer A pointer to the grpc::ByteBuffer created
+  /// \param block_size How big are the chunks to allocate at a time
+  /// \param total_size How many total bytes are required for this proto
+  /// \param backing_buffer The buffer to serialize into first
+  ProtoBufferWriter(ByteBuffer* byte_buffer, int block_size, int total_size,
+                    const Slice& backing_buffer)
+      : ProtoBufferWriter(byte_buffer, block_size, total_size) {
+    backup_slice_ = backing_buffer.c_slice();
+    GPR_CODEGEN_ASSERT(backup_slice_.refcount != nullptr);
+    have_backup_ = true;
+  }
+
   ~ProtoBufferWriter() override {
     if (have_backup_) {
       g_core_codegen_interface->grpc_slice_unref(backup_slice_);
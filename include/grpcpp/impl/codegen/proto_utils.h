@@ -29,6 +29,7 @@
 #include <grpcpp/impl/codegen/byte_buffer.h>
 #include <grpcpp/impl/codegen/config_protobuf.h>
 #include <grpcpp/impl/codegen/core_codegen_interface.h>
+#include <grpcpp/impl/codegen/method_handler.h>
 #include <grpcpp/impl/codegen/proto_buffer_reader.h>
 #include <grpcpp/impl/codegen/proto_buffer_writer.h>
 #include <grpcpp/impl/codegen/serialization_traits.h>
@@ -93,6 +94,43 @@ Status GenericDeserialize(ByteBuffer* buffer,
   return result;
 }
 
+// Variant of GenericDeserialize that retains the wire payload instead of
+// releasing it: on success \a payload takes over \a buffer's (ref-counted)
+// slices, which remain valid after the call and its arena are destroyed.
+// Intended for SerializationTraits specializations of wrapper types whose
+// Deserialize parses metadata into \a msg but serves large payload bytes
+// directly out of the pinned buffer -- via ByteBuffer::PinSingleSlice() or
+// another ProtoBufferReader -- rather than copying them a second time.
+template <class ProtoBufferReader, class T>
+Status GenericDeserializePinned(ByteBuffer* buffer,
+                                grpc::protobuf::MessageLite* msg,
+                                ByteBuffer* payload) {
+  static_assert(std::is_base_of<protobuf::io::ZeroCopyInputStream,
+                                ProtoBufferReader>::value,
+                "ProtoBufferReader must be a subclass of "
+                "::protobuf::io::ZeroCopyInputStream");
+  if (buffer == nullptr) {
+    return Status(StatusCode::INTERNAL, "No payload");
+  }
+  Status result = g_core_codegen_interface->ok();
+  {
+    ProtoBufferReader reader(buffer);
+    if (!reader.status().ok()) {
+      return reader.status();
+    }
+    if (!msg->ParseFromZeroCopyStream(&reader)) {
+      result = Status(StatusCode::INTERNAL, msg->InitializationErrorString());
+    }
+  }
+  if (result.ok()) {
+    payload->Clear();
+    payload->Swap(buffer);
+  } else {
+    buffer->Clear();
+  }
+  return result;
+}
+
 // this is needed so the following class does not conflict with protobuf
 // serializers that utilize internal-only tools.
 #ifdef GRPC_OPEN_SOURCE_PROTO
@@ -116,6 +154,86 @@ class SerializationTraits<
 };
 #endif
 
+namespace internal {
+
+/// A unary method handler that places the request and response messages on
+/// a \a grpc::protobuf::Arena whose first block is carved out of the call's
+/// own arena, so the submessage and string allocations protobuf makes
+/// during deserialization are batched together and released wholesale when
+/// the call completes instead of hitting malloc individually. Selected by
+/// generated code when the `use_message_arenas` codegen option is set.
+template <class ServiceType, class RequestType, class ResponseType>
+class ArenaRpcMethodHandler : public ::grpc::internal::MethodHandler {
+ public:
+  ArenaRpcMethodHandler(
+      std::function<::grpc::Status(ServiceType*, ::grpc::ServerContext*,
+                                   const RequestType*, ResponseType*)>
+          func,
+      ServiceType* service)
+      : func_(func), service_(service) {}
+
+  void RunHandler(const HandlerParameter& param) final {
+    ::grpc::Status status = param.status;
+    if (status.ok()) {
+      auto* arena = static_cast<grpc::protobuf::Arena*>(param.internal_data);
+      auto* rsp = grpc::protobuf::Arena::CreateMessage<ResponseType>(arena);
+      status = CatchingFunctionHandler([this, &param, rsp] {
+        return func_(service_,
+                     static_cast<::grpc::ServerContext*>(param.server_context),
+                     static_cast<RequestType*>(param.request), rsp);
+      });
+      UnaryRunHandlerHelper(
+          param, static_cast<grpc::protobuf::MessageLite*>(rsp), status);
+      // The request and response both live on the arena; destroying it
+      // releases every block in one sweep. The arena object itself sits on
+      // the call arena and is freed with the call.
+      arena->~Arena();
+    } else {
+      // Deserialization failed and already destroyed the arena; there is
+      // no message to send, only the (non-OK) status.
+      UnaryRunHandlerHelper(
+          param, static_cast<grpc::protobuf::MessageLite*>(nullptr), status);
+    }
+  }
+
+  void* Deserialize(grpc_call* call, grpc_byte_buffer* req,
+                    ::grpc::Status* status, void** handler_data) final {
+    char* storage =
+        static_cast<char*>(g_core_codegen_interface->grpc_call_arena_alloc(
+            call, sizeof(grpc::protobuf::Arena) + kInitialBlockSize));
+    grpc::protobuf::ArenaOptions options;
+    options.initial_block = storage + sizeof(grpc::protobuf::Arena);
+    options.initial_block_size = kInitialBlockSize;
+    auto* arena = new (storage) grpc::protobuf::Arena(options);
+    *handler_data = arena;
+    auto* request = grpc::protobuf::Arena::CreateMessage<RequestType>(arena);
+    ::grpc::ByteBuffer buf;
+    buf.set_buffer(req);
+    *status = SerializationTraits<RequestType>::Deserialize(
+        &buf, static_cast<grpc::protobuf::MessageLite*>(request));
+    buf.Release();
+    if (status->ok()) {
+      return request;
+    }
+    arena->~Arena();
+    return nullptr;
+  }
+
+ private:
+  // Size of the first arena block, carved from the call arena so that small
+  // requests never touch malloc at all.
+  static constexpr size_t kInitialBlockSize = 1024;
+
+  /// Application provided rpc handler function.
+  std::function<::grpc::Status(ServiceType*, ::grpc::ServerContext*,
+                               const RequestType*, ResponseType*)>
+      func_;
+  // The class the above handler function lives in.
+  ServiceType* service_;
+};
+
+}  // namespace internal
+
 }  // namespace grpc
 
 #endif  // GRPCPP_IMPL_CODEGEN_PROTO_UTILS_H
@@ -32,6 +32,7 @@
 
 #include <grpc/impl/codegen/compression_types.h>
 #include <grpcpp/impl/codegen/call.h>
+#include <grpcpp/impl/codegen/call_arena_allocator.h>
 #include <grpcpp/impl/codegen/call_op_set.h>
 #include <grpcpp/impl/codegen/callback_common.h>
 #include <grpcpp/impl/codegen/completion_queue_tag.h>
@@ -283,6 +284,17 @@ class ServerContextBase {
   /// Applications never need to call this method.
   grpc_call* c_call() { return call_.call; }
 
+  /// EXPERIMENTAL API
+  ///
+  /// Returns an allocator bound to this call's arena, suitable for
+  /// request-scoped scratch allocations. Memory obtained through it is
+  /// released in one shot when the call is destroyed, so it must not
+  /// outlive the RPC.
+  template <typename T>
+  ::grpc::experimental::CallArenaAllocator<T> call_arena_allocator() {
+    return ::grpc::experimental::CallArenaAllocator<T>(call_.call);
+  }
+
  protected:
   /// Async only. Has to be called before the rpc starts.
   /// Returns the tag in completion queue when the rpc finishes.
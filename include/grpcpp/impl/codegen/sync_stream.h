@@ -668,6 +668,15 @@ class ServerWriter final : public ServerWriterInterface<W> {
       options.set_buffer_hint();
     }
 
+    // A previous write-ahead write still owns pending_ops_; reap its
+    // completion before reusing the op set. This is also where a failure of
+    // that earlier write is reported.
+    if (ctx_->has_pending_ops_) {
+      ctx_->has_pending_ops_ = false;
+      if (!call_->cq()->Pluck(&ctx_->pending_ops_)) {
+        return false;
+      }
+    }
     if (!ctx_->pending_ops_.SendMessagePtr(&msg, options).ok()) {
       return false;
     }
@@ -683,7 +692,9 @@ class ServerWriter final : public ServerWriterInterface<W> {
     // if this is the last message we defer the pluck until AFTER we start
     // the trailing md op. This prevents hangs. See
     // https://github.com/grpc/grpc/issues/11546
-    if (options.is_last_message()) {
+    // Write-ahead writes defer the pluck the same way, so the application
+    // can prepare the next message while this one is flushed.
+    if (options.is_last_message() || options.is_write_ahead()) {
       ctx_->has_pending_ops_ = true;
       return true;
     }
@@ -751,6 +762,15 @@ class ServerReaderWriterBody final {
     if (options.is_last_message()) {
       options.set_buffer_hint();
     }
+    // A previous write-ahead write still owns pending_ops_; reap its
+    // completion before reusing the op set. This is also where a failure of
+    // that earlier write is reported.
+    if (ctx_->has_pending_ops_) {
+      ctx_->has_pending_ops_ = false;
+      if (!call_->cq()->Pluck(&ctx_->pending_ops_)) {
+        return false;
+      }
+    }
     if (!ctx_->pending_ops_.SendMessagePtr(&msg, options).ok()) {
       return false;
     }
@@ -766,7 +786,9 @@ class ServerReaderWriterBody final {
     // if this is the last message we defer the pluck until AFTER we start
     // the trailing md op. This prevents hangs. See
     // https://github.com/grpc/grpc/issues/11546
-    if (options.is_last_message()) {
+    // Write-ahead writes defer the pluck the same way, so the application
+    // can prepare the next message while this one is flushed.
+    if (options.is_last_message() || options.is_write_ahead()) {
       ctx_->has_pending_ops_ = true;
       return true;
     }
@@ -39,6 +39,17 @@ void RegisterOpenCensusPlugin();
 // ViewDescriptors below.
 void RegisterOpenCensusViewsForExport();
 
+// Sets the probability with which the plugin records stats for a call.
+// The decision is head-based: it is made once when the call is created and
+// applies to all of the call's attempts, so per-call measures stay
+// consistent. Calls that are not selected skip all per-call stats recording
+// (and the associated tag-map copies), reducing the plugin's per-call
+// overhead to a few nanoseconds; views then reflect the sampled subset of
+// calls. Tracing is unaffected--span sampling is controlled by the
+// OpenCensus trace sampler as before. The default probability is 1.0
+// (record everything). Values outside [0, 1] are clamped.
+void SetOpenCensusStatsSamplingProbability(double probability);
+
 // Returns the tracing Span for the current RPC.
 ::opencensus::trace::Span GetSpanFromServerContext(ServerContext* context);
 
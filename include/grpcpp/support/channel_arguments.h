@@ -70,6 +70,13 @@ class ChannelArguments {
   /// the resolver.
   void SetGrpclbFallbackTimeout(int fallback_timeout);
 
+  /// Set the number of parallel subchannel connections the channel
+  /// maintains per resolved address. RPCs are striped across the
+  /// connections by the load balancing policy (use round_robin), scaling
+  /// throughput to a single target past the limits of one HTTP/2
+  /// connection without application-level channel pooling.
+  void SetSubchannelShards(int num_shards);
+
   /// Set a mutator for the underlying socket.
   void SetSocketMutator(grpc_socket_mutator* mutator);
 
@@ -0,0 +1,44 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPCPP_SUPPORT_DECODE_OFFLOAD_H
+#define GRPCPP_SUPPORT_DECODE_OFFLOAD_H
+
+#include <cstddef>
+
+#include <grpcpp/impl/codegen/decode_offload.h>  // IWYU pragma: export
+
+namespace grpc {
+namespace experimental {
+
+/// EXPERIMENTAL API
+///
+/// Enables the decode-offload pipeline stage for completion-queue based
+/// calls: received messages of at least \a min_message_bytes are
+/// deserialized on a bounded pool of \a num_decoder_threads before their
+/// tag is surfaced from the completion queue, so a large decode cannot
+/// stall the thread calling Next(). Smaller messages keep the inline
+/// path. Must be called at most once, before any calls are created, and
+/// the stage stays enabled for the lifetime of the process.
+void EnableDecodeOffload(size_t num_decoder_threads,
+                         size_t min_message_bytes);
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_SUPPORT_DECODE_OFFLOAD_H
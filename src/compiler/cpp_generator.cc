@@ -2022,20 +2022,37 @@ void PrintSourceService(grpc_generator::Printer* printer,
     (*vars)["Request"] = method->input_type_name();
     (*vars)["Response"] = method->output_type_name();
     if (method->NoStreaming()) {
-      printer->Print(
-          *vars,
-          "AddMethod(new ::grpc::internal::RpcServiceMethod(\n"
-          "    $prefix$$Service$_method_names[$Idx$],\n"
-          "    ::grpc::internal::RpcMethod::NORMAL_RPC,\n"
-          "    new ::grpc::internal::RpcMethodHandler< $ns$$Service$::Service, "
-          "$Request$, $Response$, ::grpc::protobuf::MessageLite, "
-          "::grpc::protobuf::MessageLite>(\n"
-          "        []($ns$$Service$::Service* service,\n"
-          "           ::grpc::ServerContext* ctx,\n"
-          "           const $Request$* req,\n"
-          "           $Response$* resp) {\n"
-          "             return service->$Method$(ctx, req, resp);\n"
-          "           }, this)));\n");
+      if ((*vars)["UseMessageArenas"] == "true") {
+        printer->Print(
+            *vars,
+            "AddMethod(new ::grpc::internal::RpcServiceMethod(\n"
+            "    $prefix$$Service$_method_names[$Idx$],\n"
+            "    ::grpc::internal::RpcMethod::NORMAL_RPC,\n"
+            "    new ::grpc::internal::ArenaRpcMethodHandler< "
+            "$ns$$Service$::Service, $Request$, $Response$>(\n"
+            "        []($ns$$Service$::Service* service,\n"
+            "           ::grpc::ServerContext* ctx,\n"
+            "           const $Request$* req,\n"
+            "           $Response$* resp) {\n"
+            "             return service->$Method$(ctx, req, resp);\n"
+            "           }, this)));\n");
+      } else {
+        printer->Print(
+            *vars,
+            "AddMethod(new ::grpc::internal::RpcServiceMethod(\n"
+            "    $prefix$$Service$_method_names[$Idx$],\n"
+            "    ::grpc::internal::RpcMethod::NORMAL_RPC,\n"
+            "    new ::grpc::internal::RpcMethodHandler< "
+            "$ns$$Service$::Service, "
+            "$Request$, $Response$, ::grpc::protobuf::MessageLite, "
+            "::grpc::protobuf::MessageLite>(\n"
+            "        []($ns$$Service$::Service* service,\n"
+            "           ::grpc::ServerContext* ctx,\n"
+            "           const $Request$* req,\n"
+            "           $Response$* resp) {\n"
+            "             return service->$Method$(ctx, req, resp);\n"
+            "           }, this)));\n");
+      }
     } else if (ClientOnlyStreaming(method.get())) {
       printer->Print(
           *vars,
@@ -2110,6 +2127,7 @@ std::string GetSourceServices(grpc_generator::File* file,
       vars["ns"] = "";
       vars["prefix"] = "";
     }
+    vars["UseMessageArenas"] = params.use_message_arenas ? "true" : "false";
 
     for (int i = 0; i < file->service_count(); ++i) {
       PrintSourceService(printer.get(), file->service(i).get(), &vars);
@@ -64,6 +64,9 @@ struct Parameters {
   std::string message_header_extension;
   // Whether to include headers corresponding to imports in source file.
   bool include_import_headers;
+  // Allocate unary request/response messages on a protobuf arena backed by
+  // the call arena instead of heap-constructing them per call.
+  bool use_message_arenas;
 };
 
 // Return the prologue of the generated header file.
@@ -50,7 +50,10 @@ std::map<absl::string_view, double> ParseMap(
 
 const LoadBalancingPolicy::BackendMetricData* ParseBackendMetricData(
     const grpc_slice& serialized_load_report, Arena* arena) {
-  upb::Arena upb_arena;
+  // Load reports arrive with every response on streams that use them, so
+  // seed the parse arena from the stack; only unusually large utilization
+  // maps spill to the heap.
+  upb::InlinedArena<1024> upb_arena;
   udpa_data_orca_v1_OrcaLoadReport* msg =
       udpa_data_orca_v1_OrcaLoadReport_parse(
           reinterpret_cast<const char*>(
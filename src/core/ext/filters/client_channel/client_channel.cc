@@ -59,7 +59,9 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/connected_channel.h"
 #include "src/core/lib/channel/status_util.h"
+#include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gpr/string.h"
+#include "src/core/lib/gpr/tls.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/iomgr.h"
 #include "src/core/lib/iomgr/polling_entity.h"
@@ -88,6 +90,63 @@ using internal::ClientChannelServiceConfigParser;
 TraceFlag grpc_client_channel_call_trace(false, "client_channel_call");
 TraceFlag grpc_client_channel_routing_trace(false, "client_channel_routing");
 
+//
+// Picker hazard slots
+//
+
+namespace {
+
+// A minimal hazard-pointer domain used to reclaim pickers.  Each thread
+// that performs LB picks owns one slot; while a lock-free pick is in
+// flight, the slot holds the picker being used.  After swapping in a new
+// picker, UpdateStateAndPickerLocked() scans the slots and defers
+// destruction of the old picker until no slot references it.  Slots are
+// never freed: a thread's slot simply stays empty once the thread exits,
+// so the scan cost is bounded by the high-water mark of picking threads.
+struct PickerHazardSlot {
+  std::atomic<void*> hazard{nullptr};
+  std::atomic<PickerHazardSlot*> next{nullptr};
+};
+
+std::atomic<PickerHazardSlot*> g_picker_hazard_slots{nullptr};
+GPR_THREAD_LOCAL(PickerHazardSlot*) g_picker_hazard_slot_for_thread;
+
+PickerHazardSlot* GetPickerHazardSlot() {
+  PickerHazardSlot* slot = g_picker_hazard_slot_for_thread;
+  if (GPR_UNLIKELY(slot == nullptr)) {
+    slot = new PickerHazardSlot();
+    PickerHazardSlot* head =
+        g_picker_hazard_slots.load(std::memory_order_acquire);
+    do {
+      slot->next.store(head, std::memory_order_relaxed);
+    } while (!g_picker_hazard_slots.compare_exchange_weak(
+        head, slot, std::memory_order_acq_rel, std::memory_order_acquire));
+    g_picker_hazard_slot_for_thread = slot;
+  }
+  return slot;
+}
+
+bool PickerIsHazard(LoadBalancingPolicy::SubchannelPicker* picker) {
+  for (PickerHazardSlot* slot =
+           g_picker_hazard_slots.load(std::memory_order_acquire);
+       slot != nullptr; slot = slot->next.load(std::memory_order_acquire)) {
+    // seq_cst to pair with the seq_cst picker_ exchange in
+    // UpdateStateAndPickerLocked() and the seq_cst hazard publication in
+    // PickSubchannelLocked(): the scan must not be able to run "before"
+    // the exchange and miss a pin whose validating picker_ re-load still
+    // saw the old picker.
+    if (slot->hazard.load(std::memory_order_seq_cst) == picker) return true;
+  }
+  return false;
+}
+
+// One in how many LB calls samples the call_pick_us histogram (see
+// stats_data.yaml).  Thread local so that sampling costs no atomic op.
+constexpr uint32_t kPickLatencySamplePeriod = 64;
+GPR_THREAD_LOCAL(uint32_t) g_pick_latency_sample_counter;
+
+}  // namespace
+
 //
 // ClientChannel::CallData definition
 //
@@ -215,6 +274,11 @@ class ClientChannel::CallData {
 
   RefCountedPtr<DynamicFilters> dynamic_filters_;
   RefCountedPtr<DynamicFilters::Call> dynamic_call_;
+  // Set instead of dynamic_call_ when the dynamic filter stack would
+  // contain only the termination filter; the LB call is then created
+  // directly, skipping a call stack layer. At most one of dynamic_call_
+  // and lb_call_ is non-null.
+  OrphanablePtr<ClientChannel::LoadBalancedCall> lb_call_;
 
   // Batches are added to this list when received from above.
   // They are removed when we are done handling the batch (i.e., when
@@ -1077,6 +1141,10 @@ ClientChannel::ClientChannel(grpc_channel_element_args* args,
                              grpc_error_handle* error)
     : deadline_checking_enabled_(
           grpc_deadline_checking_enabled(args->channel_args)),
+      warm_idle_result_staleness_ms_(grpc_channel_args_find_integer(
+          args->channel_args,
+          GRPC_ARG_EXPERIMENTAL_WARM_IDLE_RESULT_STALENESS_MS,
+          {0, 0, INT_MAX})),
       owning_stack_(args->channel_stack),
       client_channel_factory_(
           ClientChannelFactory::GetFromChannelArgs(args->channel_args)),
@@ -1134,14 +1202,28 @@ ClientChannel::ClientChannel(grpc_channel_element_args* args,
   channel_args_ = grpc_channel_args_copy_and_remove(
       new_args != nullptr ? new_args : args->channel_args, &arg_to_remove, 1);
   grpc_channel_args_destroy(new_args);
-  keepalive_time_ = grpc_channel_args_find_integer(
-      channel_args_, GRPC_ARG_KEEPALIVE_TIME_MS,
-      {-1 /* default value, unset */, 1, INT_MAX});
+  // Preprocess the channel args once, so that the lookups below (and any
+  // future reads of channel_args_) are O(1) instead of rescanning the
+  // array.
+  preprocessed_args_ = ChannelArgs::Create(channel_args_);
+  keepalive_time_ = preprocessed_args_->FindInteger(
+      GRPC_ARG_KEEPALIVE_TIME_MS, {-1 /* default value, unset */, 1, INT_MAX});
   if (!ResolverRegistry::IsValidTarget(target_uri_.get())) {
     *error = GRPC_ERROR_CREATE_FROM_CPP_STRING(
         absl::StrCat("the target uri is not valid: ", target_uri_.get()));
     return;
   }
+  // If requested, proactively kick off name resolution and connection
+  // establishment now instead of waiting for the first RPC, so that the
+  // first RPC does not pay the cold-start cost.  This is the same path
+  // used by CheckConnectivityState(try_to_connect=true).
+  if (preprocessed_args_->FindBool(GRPC_ARG_EXPERIMENTAL_PRECONNECT_ON_CREATION,
+                                   false)) {
+    GRPC_CHANNEL_STACK_REF(owning_stack_, "TryToConnect");
+    work_serializer_->Run([this]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(
+                              work_serializer_) { TryToConnectLocked(); },
+                          DEBUG_LOCATION);
+  }
   *error = GRPC_ERROR_NONE;
 }
 
@@ -1150,6 +1232,9 @@ ClientChannel::~ClientChannel() {
     gpr_log(GPR_INFO, "chand=%p: destroying channel", this);
   }
   DestroyResolverAndLbPolicyLocked();
+  // No picks can be in flight at this point, so the picker can be
+  // destroyed without consulting the hazard slots.
+  delete picker_.load(std::memory_order_relaxed);
   grpc_channel_args_destroy(channel_args_);
   GRPC_ERROR_UNREF(resolver_transient_failure_error_);
   // Stop backup polling.
@@ -1222,6 +1307,13 @@ void ClientChannel::OnResolverResultChangedLocked(Resolver::Result result) {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_routing_trace)) {
     gpr_log(GPR_INFO, "chand=%p: got resolver result", this);
   }
+  // Retain the result so that it can be reused if the channel exits IDLE
+  // before the result goes stale -- unless this call is itself replaying
+  // the retained result, which must not refresh its timestamp.
+  if (warm_idle_result_staleness_ms_ > 0 && !replaying_warm_idle_result_) {
+    warm_idle_saved_result_ = result;
+    warm_idle_result_time_ = ExecCtx::Get()->Now();
+  }
   // We only want to trace the address resolution in the follow cases:
   // (a) Address resolution resulted in service config change.
   // (b) Address resolution that causes number of backends to go from
@@ -1376,9 +1468,32 @@ void ClientChannel::OnResolverErrorLocked(grpc_error_handle error) {
   GRPC_ERROR_UNREF(error);
 }
 
+// Distinguishes the per-shard copies of an address created for
+// GRPC_ARG_SUBCHANNEL_SHARDS, so that each copy yields its own subchannel.
+#define GRPC_ARG_SUBCHANNEL_SHARD_INDEX "grpc.internal.subchannel_shard_index"
+
 void ClientChannel::CreateOrUpdateLbPolicyLocked(
     RefCountedPtr<LoadBalancingPolicy::Config> lb_policy_config,
     Resolver::Result result) {
+  // If subchannel sharding is enabled, expand each address into one copy
+  // per shard, each carrying a distinct shard-index channel arg.  The
+  // copies produce distinct subchannel keys, so the channel maintains that
+  // many parallel connections per address, and LB policies that spread
+  // load across addresses (e.g. round_robin) stripe RPCs over them.
+  const int num_shards = grpc_channel_args_find_integer(
+      result.args, GRPC_ARG_SUBCHANNEL_SHARDS, {1, 1, INT_MAX});
+  if (num_shards > 1) {
+    ServerAddressList sharded_addresses;
+    sharded_addresses.reserve(result.addresses.size() * num_shards);
+    for (const ServerAddress& address : result.addresses) {
+      for (int i = 0; i < num_shards; ++i) {
+        sharded_addresses.emplace_back(
+            address.WithArg(grpc_channel_arg_integer_create(
+                const_cast<char*>(GRPC_ARG_SUBCHANNEL_SHARD_INDEX), i)));
+      }
+    }
+    result.addresses = std::move(sharded_addresses);
+  }
   // Construct update.
   LoadBalancingPolicy::UpdateArgs update_args;
   update_args.addresses = std::move(result.addresses);
@@ -1514,13 +1629,18 @@ void ClientChannel::UpdateServiceConfigInDataPlaneLocked() {
   // Construct dynamic filter stack.
   std::vector<const grpc_channel_filter*> filters =
       config_selector->GetFilters();
+  bool passthrough = false;
   if (enable_retries) {
     filters.push_back(&kRetryFilterVtable);
   } else {
     filters.push_back(&DynamicTerminationFilter::kFilterVtable);
+    // With no retry filter and no config-selector filters, the dynamic
+    // stack would do nothing but forward batches to the LB call, so calls
+    // can skip it entirely.
+    passthrough = filters.size() == 1;
   }
   RefCountedPtr<DynamicFilters> dynamic_filters =
-      DynamicFilters::Create(new_args, std::move(filters));
+      DynamicFilters::Create(new_args, std::move(filters), passthrough);
   GPR_ASSERT(dynamic_filters != nullptr);
   grpc_channel_args_destroy(new_args);
   // Grab data plane lock to update service config.
@@ -1640,7 +1760,9 @@ void ClientChannel::UpdateStateAndPickerLocked(
   // the refs until after we release the lock, and then unref them at
   // that point.  This includes the following:
   // - refs to subchannel wrappers in the keys of pending_subchannel_updates_
-  // - ownership of the existing picker in picker_
+  // - ownership of the existing picker, which cannot be destroyed until
+  //   no in-flight lock-free pick still references it
+  LoadBalancingPolicy::SubchannelPicker* old_picker = nullptr;
   {
     MutexLock lock(&data_plane_mu_);
     // Handle subchannel updates.
@@ -1656,9 +1778,16 @@ void ClientChannel::UpdateStateAndPickerLocked(
       // we wait until we've released the lock to clear the map.
       p.first->set_connected_subchannel_in_data_plane(std::move(p.second));
     }
-    // Swap out the picker.
-    // Note: Original value will be destroyed after the lock is released.
-    picker_.swap(picker);
+    // Publish the new picker via atomic swap and bump the version so
+    // that concurrent lock-free picks can tell that they raced with us.
+    // Note: Original value will be destroyed after the lock is released
+    // and all in-flight picks using it have drained.
+    // seq_cst: the hazard scan below must be store-load ordered after this
+    // exchange, or it could miss a pin from a reader whose validating
+    // re-load of picker_ still saw the old picker (acq_rel exchange
+    // followed by acquire loads does not give that guarantee).
+    old_picker = picker_.exchange(picker.release(), std::memory_order_seq_cst);
+    picker_version_.fetch_add(1, std::memory_order_release);
     // Re-process queued picks.
     for (LbQueuedCall* call = lb_queued_calls_; call != nullptr;
          call = call->next) {
@@ -1680,6 +1809,17 @@ void ClientChannel::UpdateStateAndPickerLocked(
   // Clear the pending update map after releasing the lock, to keep the
   // critical section small.
   pending_subchannel_updates_.clear();
+  // Defer destruction of the old picker until no in-flight lock-free pick
+  // still has it pinned in a hazard slot.  Hazard windows only span a
+  // single Pick() invocation, so this terminates quickly, and we are on
+  // the control-plane work serializer where brief blocking is acceptable.
+  if (old_picker != nullptr) {
+    while (PickerIsHazard(old_picker)) {
+      gpr_sleep_until(gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
+                                   gpr_time_from_micros(100, GPR_TIMESPAN)));
+    }
+    delete old_picker;
+  }
 }
 
 namespace {
@@ -1722,8 +1862,11 @@ grpc_error_handle ClientChannel::DoPingLocked(grpc_transport_op* op) {
   }
   LoadBalancingPolicy::PickResult result;
   {
+    // Holding data_plane_mu_ keeps the current picker alive (it cannot be
+    // swapped out, and destruction only happens after a swap).
     MutexLock lock(&data_plane_mu_);
-    result = picker_->Pick(LoadBalancingPolicy::PickArgs());
+    result = picker_.load(std::memory_order_relaxed)
+                 ->Pick(LoadBalancingPolicy::PickArgs());
   }
   return HandlePickResult<grpc_error_handle>(
       &result,
@@ -1800,6 +1943,7 @@ void ClientChannel::StartTransportOpLocked(grpc_transport_op* op) {
       // Disconnect.
       GPR_ASSERT(disconnect_error_ == GRPC_ERROR_NONE);
       disconnect_error_ = op->disconnect_with_error;
+      warm_idle_saved_result_.reset();
       UpdateStateAndPickerLocked(
           GRPC_CHANNEL_SHUTDOWN, absl::Status(), "shutdown from API",
           absl::make_unique<LoadBalancingPolicy::TransientFailurePicker>(
@@ -1880,6 +2024,25 @@ void ClientChannel::TryToConnectLocked() {
     lb_policy_->ExitIdleLocked();
   } else if (resolver_ == nullptr) {
     CreateResolverLocked();
+    // Warm idle: if a sufficiently fresh resolver result was retained
+    // across the IDLE period, replay it now so that connection
+    // establishment starts immediately instead of waiting for the
+    // resolver.  The resolver's next result will replace it.
+    if (warm_idle_saved_result_.has_value()) {
+      if (ExecCtx::Get()->Now() - warm_idle_result_time_ <=
+          warm_idle_result_staleness_ms_) {
+        if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_routing_trace)) {
+          gpr_log(GPR_INFO,
+                  "chand=%p: exiting IDLE with retained resolver result", this);
+        }
+        replaying_warm_idle_result_ = true;
+        OnResolverResultChangedLocked(*warm_idle_saved_result_);
+        replaying_warm_idle_result_ = false;
+      } else {
+        // Too stale to be trusted; wait for the resolver instead.
+        warm_idle_saved_result_.reset();
+      }
+    }
   }
   GRPC_CHANNEL_STACK_UNREF(owning_stack_, "TryToConnect");
 }
@@ -1956,9 +2119,15 @@ void ClientChannel::CallData::Destroy(
   CallData* calld = static_cast<CallData*>(elem->call_data);
   RefCountedPtr<DynamicFilters::Call> dynamic_call =
       std::move(calld->dynamic_call_);
+  RefCountedPtr<SubchannelCall> subchannel_call;
+  if (calld->lb_call_ != nullptr) {
+    subchannel_call = calld->lb_call_->subchannel_call();
+  }
   calld->~CallData();
   if (GPR_LIKELY(dynamic_call != nullptr)) {
     dynamic_call->SetAfterCallStackDestroy(then_schedule_closure);
+  } else if (subchannel_call != nullptr) {
+    subchannel_call->SetAfterCallStackDestroy(then_schedule_closure);
   } else {
     // TODO(yashkt) : This can potentially be a Closure::Run
     ExecCtx::Run(DEBUG_LOCATION, then_schedule_closure, GRPC_ERROR_NONE);
@@ -1991,6 +2160,15 @@ void ClientChannel::CallData::StartTransportStreamOpBatch(
     calld->dynamic_call_->StartTransportStreamOpBatch(batch);
     return;
   }
+  // Likewise for a directly created LB call.
+  if (calld->lb_call_ != nullptr) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_call_trace)) {
+      gpr_log(GPR_INFO, "chand=%p calld=%p: starting batch on lb_call=%p",
+              chand, calld, calld->lb_call_.get());
+    }
+    calld->lb_call_->StartTransportStreamOpBatch(batch);
+    return;
+  }
   // We do not yet have a dynamic call.
   //
   // If we've previously been cancelled, immediately fail any new batches.
@@ -2147,7 +2325,11 @@ void ClientChannel::CallData::ResumePendingBatchInCallCombiner(
       static_cast<grpc_call_element*>(batch->handler_private.extra_arg);
   auto* calld = static_cast<CallData*>(elem->call_data);
   // Note: This will release the call combiner.
-  calld->dynamic_call_->StartTransportStreamOpBatch(batch);
+  if (calld->lb_call_ != nullptr) {
+    calld->lb_call_->StartTransportStreamOpBatch(batch);
+  } else {
+    calld->dynamic_call_->StartTransportStreamOpBatch(batch);
+  }
 }
 
 // This is called via the call combiner, so access to calld is synchronized.
@@ -2445,6 +2627,28 @@ bool ClientChannel::CallData::CheckResolutionLocked(grpc_call_element* elem,
 
 void ClientChannel::CallData::CreateDynamicCall(grpc_call_element* elem) {
   auto* chand = static_cast<ClientChannel*>(elem->channel_data);
+  if (dynamic_filters_->passthrough()) {
+    // The dynamic stack contains only the termination filter; create the
+    // LB call directly instead of a call stack whose only job would be to
+    // forward batches to it.
+    dynamic_filters_.reset();
+    grpc_call_element_args lb_args = {owning_call_,     nullptr,
+                                      call_context_,    path_,
+                                      /*start_time=*/0, deadline_,
+                                      arena_,           call_combiner_};
+    auto* service_config_call_data = static_cast<ServiceConfigCallData*>(
+        call_context_[GRPC_CONTEXT_SERVICE_CONFIG_CALL_DATA].value);
+    lb_call_ = chand->CreateLoadBalancedCall(
+        lb_args, pollent_, nullptr,
+        service_config_call_data->call_dispatch_controller(),
+        /*is_transparent_retry=*/false);
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_routing_trace)) {
+      gpr_log(GPR_INFO, "chand=%p calld=%p: created lb_call=%p directly",
+              chand, this, lb_call_.get());
+    }
+    PendingBatchesResume(elem);
+    return;
+  }
   DynamicFilters::Call::Args args = {std::move(dynamic_filters_),
                                      pollent_,
                                      path_,
@@ -2590,7 +2794,20 @@ ClientChannel::LoadBalancedCall::LoadBalancedCall(
       on_call_destruction_complete_(on_call_destruction_complete),
       call_dispatch_controller_(call_dispatch_controller),
       call_attempt_tracer_(
-          GetCallAttemptTracer(args.context, is_transparent_retry)) {}
+          GetCallAttemptTracer(args.context, is_transparent_retry)) {
+  if (call_attempt_tracer_ != nullptr) {
+    // Make the attempt tracer visible to layers below us, so that the
+    // transport can report per-write timestamps for this attempt (see
+    // CallAttemptTracer::RecordWriteTimestamps).
+    call_context_[GRPC_CONTEXT_CALL_ATTEMPT_TRACER].value =
+        call_attempt_tracer_;
+  }
+  if (GPR_UNLIKELY(++g_pick_latency_sample_counter >=
+                   kPickLatencySamplePeriod)) {
+    g_pick_latency_sample_counter = 0;
+    pick_latency_sampled_ = true;
+  }
+}
 
 ClientChannel::LoadBalancedCall::~LoadBalancedCall() {
   grpc_slice_unref_internal(path_);
@@ -3065,6 +3282,12 @@ void ClientChannel::LoadBalancedCall::PickDone(void* arg,
     self->PendingBatchesFail(GRPC_ERROR_REF(error), YieldCallCombiner);
     return;
   }
+  if (GPR_UNLIKELY(self->pick_latency_sampled_)) {
+    const gpr_timespec elapsed = gpr_cycle_counter_sub(
+        gpr_get_cycle_counter(), self->lb_call_start_time_);
+    GRPC_STATS_INC_CALL_PICK_US(elapsed.tv_sec * GPR_US_PER_SEC +
+                                elapsed.tv_nsec / GPR_NS_PER_US);
+  }
   self->call_dispatch_controller_->Commit();
   self->CreateSubchannelCall();
 }
@@ -3072,17 +3295,143 @@ void ClientChannel::LoadBalancedCall::PickDone(void* arg,
 void ClientChannel::LoadBalancedCall::PickSubchannel(void* arg,
                                                      grpc_error_handle error) {
   auto* self = static_cast<LoadBalancedCall*>(arg);
-  bool pick_complete;
-  {
-    MutexLock lock(&self->chand_->data_plane_mu_);
-    pick_complete = self->PickSubchannelLocked(&error);
-  }
+  bool pick_complete = self->PickSubchannelLockFree(&error);
   if (pick_complete) {
     PickDone(self, error);
     GRPC_ERROR_UNREF(error);
   }
 }
 
+bool ClientChannel::LoadBalancedCall::PickSubchannelLockFree(
+    grpc_error_handle* error) {
+  GPR_ASSERT(connected_subchannel_ == nullptr);
+  GPR_ASSERT(subchannel_call_ == nullptr);
+  // Grab initial metadata.
+  auto& send_initial_metadata =
+      pending_batches_[0]->payload->send_initial_metadata;
+  grpc_metadata_batch* initial_metadata_batch =
+      send_initial_metadata.send_initial_metadata;
+  const uint32_t send_initial_metadata_flags =
+      send_initial_metadata.send_initial_metadata_flags;
+  PickerHazardSlot* hazard_slot = GetPickerHazardSlot();
+  while (true) {
+    // Read the picker version before the picker itself: if the version is
+    // still unchanged when we act on the pick result under the mutex, the
+    // picker we used was the current one for the whole pick.
+    const uint64_t version =
+        chand_->picker_version_.load(std::memory_order_acquire);
+    // Pin the current picker in our hazard slot so that
+    // UpdateStateAndPickerLocked() will not destroy it while Pick() runs.
+    LoadBalancingPolicy::SubchannelPicker* picker;
+    while (true) {
+      picker = chand_->picker_.load(std::memory_order_seq_cst);
+      hazard_slot->hazard.store(picker, std::memory_order_seq_cst);
+      if (chand_->picker_.load(std::memory_order_seq_cst) == picker) break;
+    }
+    // Perform LB pick.
+    LoadBalancingPolicy::PickArgs pick_args;
+    pick_args.path = StringViewFromSlice(path_);
+    LbCallState lb_call_state(this);
+    pick_args.call_state = &lb_call_state;
+    Metadata initial_metadata(this, initial_metadata_batch);
+    pick_args.initial_metadata = &initial_metadata;
+    auto result = picker->Pick(pick_args);
+    hazard_slot->hazard.store(nullptr, std::memory_order_seq_cst);
+    bool stale = false;
+    const bool pick_complete = HandlePickResult<bool>(
+        &result,
+        // CompletePick
+        [this, &stale,
+         version](LoadBalancingPolicy::PickResult::Complete* complete_pick) {
+          MutexLock lock(&chand_->data_plane_mu_);
+          // If the picker changed while we were picking, the connected
+          // subchannel handoff invariant below no longer holds; re-pick
+          // with the new picker instead.
+          if (chand_->picker_version_.load(std::memory_order_relaxed) !=
+              version) {
+            stale = true;
+            return false;
+          }
+          if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_routing_trace)) {
+            gpr_log(GPR_INFO,
+                    "chand=%p lb_call=%p: LB pick succeeded: subchannel=%p",
+                    chand_, this, complete_pick->subchannel.get());
+          }
+          GPR_ASSERT(complete_pick->subchannel != nullptr);
+          // Grab a ref to the connected subchannel while we're still
+          // holding the data plane mutex.
+          connected_subchannel_ = chand_->GetConnectedSubchannelInDataPlane(
+              complete_pick->subchannel.get());
+          GPR_ASSERT(connected_subchannel_ != nullptr);
+          lb_recv_trailing_metadata_ready_ =
+              std::move(complete_pick->recv_trailing_metadata_ready);
+          return true;
+        },
+        // QueuePick
+        [this, &stale,
+         version](LoadBalancingPolicy::PickResult::Queue* /*queue_pick*/) {
+          MutexLock lock(&chand_->data_plane_mu_);
+          // Only queue if the verdict came from the current picker;
+          // otherwise the queue may already have been drained for the
+          // update we raced with, and we would miss our wakeup.
+          if (chand_->picker_version_.load(std::memory_order_relaxed) !=
+              version) {
+            stale = true;
+            return false;
+          }
+          if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_routing_trace)) {
+            gpr_log(GPR_INFO, "chand=%p lb_call=%p: LB pick queued", chand_,
+                    this);
+          }
+          MaybeAddCallToLbQueuedCallsLocked();
+          return false;
+        },
+        // FailPick
+        [this, &stale, version, send_initial_metadata_flags,
+         &error](LoadBalancingPolicy::PickResult::Fail* fail_pick) {
+          if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_routing_trace)) {
+            gpr_log(GPR_INFO, "chand=%p lb_call=%p: LB pick failed: %s",
+                    chand_, this, fail_pick->status.ToString().c_str());
+          }
+          // If wait_for_ready is false, then the error indicates the RPC
+          // attempt's final status.  The call was never queued on this
+          // path, so there is nothing to remove from the queued list.
+          if ((send_initial_metadata_flags &
+               GRPC_INITIAL_METADATA_WAIT_FOR_READY) == 0) {
+            grpc_error_handle lb_error =
+                absl_status_to_grpc_error(fail_pick->status);
+            *error = GRPC_ERROR_CREATE_REFERENCING_FROM_STATIC_STRING(
+                "Failed to pick subchannel", &lb_error, 1);
+            GRPC_ERROR_UNREF(lb_error);
+            return true;
+          }
+          // If wait_for_ready is true, then queue to retry when we get a new
+          // picker; same staleness rule as for QueuePick.
+          MutexLock lock(&chand_->data_plane_mu_);
+          if (chand_->picker_version_.load(std::memory_order_relaxed) !=
+              version) {
+            stale = true;
+            return false;
+          }
+          MaybeAddCallToLbQueuedCallsLocked();
+          return false;
+        },
+        // DropPick
+        [this, &error](LoadBalancingPolicy::PickResult::Drop* drop_pick) {
+          if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_routing_trace)) {
+            gpr_log(GPR_INFO, "chand=%p lb_call=%p: LB pick dropped: %s",
+                    chand_, this, drop_pick->status.ToString().c_str());
+          }
+          *error =
+              grpc_error_set_int(absl_status_to_grpc_error(drop_pick->status),
+                                 GRPC_ERROR_INT_LB_POLICY_DROP, 1);
+          return true;
+        });
+    if (!stale) return pick_complete;
+    // Raced with a picker update; try again with the new picker.
+  }
+}
+
 bool ClientChannel::LoadBalancedCall::PickSubchannelLocked(
     grpc_error_handle* error) {
   GPR_ASSERT(connected_subchannel_ == nullptr);
@@ -3101,7 +3450,8 @@ bool ClientChannel::LoadBalancedCall::PickSubchannelLocked(
   pick_args.call_state = &lb_call_state;
   Metadata initial_metadata(this, initial_metadata_batch);
   pick_args.initial_metadata = &initial_metadata;
-  auto result = chand_->picker_->Pick(pick_args);
+  auto result =
+      chand_->picker_.load(std::memory_order_relaxed)->Pick(pick_args);
   return HandlePickResult<bool>(
       &result,
       // CompletePick
@@ -19,6 +19,7 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <set>
@@ -271,9 +272,14 @@ class ClientChannel {
   // Fields set at construction and never modified.
   //
   const bool deadline_checking_enabled_;
+  // When positive, the channel keeps its last resolver result across IDLE
+  // periods and reuses it on IDLE exit if younger than this bound.
+  const int warm_idle_result_staleness_ms_;
   grpc_channel_stack* owning_stack_;
   ClientChannelFactory* client_channel_factory_;
   const grpc_channel_args* channel_args_;
+  // Preprocessed view of channel_args_ with O(1) lookup.
+  RefCountedPtr<ChannelArgs> preprocessed_args_;
   RefCountedPtr<ServiceConfig> default_service_config_;
   std::string server_name_;
   UniquePtr<char> target_uri_;
@@ -301,8 +307,19 @@ class ClientChannel {
   // Fields used in the data plane.  Guarded by data_plane_mu_.
   //
   mutable Mutex data_plane_mu_;
-  std::unique_ptr<LoadBalancingPolicy::SubchannelPicker> picker_
-      ABSL_GUARDED_BY(data_plane_mu_);
+  // The current picker, owned via this atomic.  It is published by atomic
+  // swap in UpdateStateAndPickerLocked() (under data_plane_mu_) and read
+  // without the mutex by the pick fast path, which pins it in a hazard
+  // slot while Pick() runs (see client_channel.cc); the old picker is
+  // destroyed only once no hazard slot references it.  Holding
+  // data_plane_mu_ also keeps the current picker alive, since it cannot
+  // be swapped out (a precondition for destruction) while the mutex is
+  // held.
+  std::atomic<LoadBalancingPolicy::SubchannelPicker*> picker_{nullptr};
+  // Bumped (under data_plane_mu_) on every picker swap, so that lock-free
+  // picks can detect that their verdict came from a stale picker before
+  // acting on it.
+  std::atomic<uint64_t> picker_version_{0};
   // Linked list of calls queued waiting for LB pick.
   LbQueuedCall* lb_queued_calls_ ABSL_GUARDED_BY(data_plane_mu_) = nullptr;
 
@@ -318,6 +335,16 @@ class ClientChannel {
       ABSL_GUARDED_BY(work_serializer_);
   RefCountedPtr<ConfigSelector> saved_config_selector_
       ABSL_GUARDED_BY(work_serializer_);
+  // Warm idle state: the last resolver result and when it arrived.  Kept
+  // only when warm_idle_result_staleness_ms_ is positive; cleared on
+  // disconnect.  See TryToConnectLocked().
+  absl::optional<Resolver::Result> warm_idle_saved_result_
+      ABSL_GUARDED_BY(work_serializer_);
+  grpc_millis warm_idle_result_time_ ABSL_GUARDED_BY(work_serializer_) = 0;
+  // True while a retained result is being replayed into
+  // OnResolverResultChangedLocked(), so the replay does not refresh the
+  // retained result's timestamp.
+  bool replaying_warm_idle_result_ ABSL_GUARDED_BY(work_serializer_) = false;
   absl::optional<std::string> health_check_service_name_
       ABSL_GUARDED_BY(work_serializer_);
   OrphanablePtr<LoadBalancingPolicy> lb_policy_
@@ -386,9 +413,16 @@ class ClientChannel::LoadBalancedCall
 
   // Invoked by channel for queued LB picks when the picker is updated.
   static void PickSubchannel(void* arg, grpc_error_handle error);
+  // Helper function for performing an LB pick without holding the data
+  // plane mutex around the picker invocation; the mutex is taken only on
+  // the queue slow path and for the connected subchannel handoff.  Picks
+  // that raced with a picker update are retried against the new picker.
+  // Returns true if the pick is complete, in which case the caller must
+  // invoke PickDone() or AsyncPickDone() with the returned error.
+  bool PickSubchannelLockFree(grpc_error_handle* error);
   // Helper function for performing an LB pick while holding the data plane
-  // mutex.  Returns true if the pick is complete, in which case the caller
-  // must invoke PickDone() or AsyncPickDone() with the returned error.
+  // mutex; used to re-process queued picks when a new picker is swapped
+  // in.  Return value is as for PickSubchannelLockFree().
   bool PickSubchannelLocked(grpc_error_handle* error)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannel::data_plane_mu_);
   // Schedules a callback to process the completed pick.  The callback
@@ -467,6 +501,9 @@ class ClientChannel::LoadBalancedCall
 
   gpr_cycle_counter lb_call_start_time_ = gpr_get_cycle_counter();
 
+  // Whether this call was selected for the sampled call_pick_us histogram.
+  bool pick_latency_sampled_ = false;
+
   // Set when we get a cancel_stream op.
   grpc_error_handle cancel_error_ = GRPC_ERROR_NONE;
 
@@ -156,7 +156,7 @@ std::pair<grpc_channel_stack*, grpc_error_handle> CreateChannelStack(
 
 RefCountedPtr<DynamicFilters> DynamicFilters::Create(
     const grpc_channel_args* args,
-    std::vector<const grpc_channel_filter*> filters) {
+    std::vector<const grpc_channel_filter*> filters, bool passthrough) {
   // Attempt to create channel stack from requested filters.
   auto p = CreateChannelStack(args, std::move(filters));
   if (p.second != GRPC_ERROR_NONE) {
@@ -170,8 +170,10 @@ RefCountedPtr<DynamicFilters> DynamicFilters::Create(
     p = CreateChannelStack(new_args, {&grpc_lame_filter});
     GPR_ASSERT(p.second == GRPC_ERROR_NONE);
     grpc_channel_args_destroy(new_args);
+    // The lame stack must actually be called into.
+    passthrough = false;
   }
-  return MakeRefCounted<DynamicFilters>(p.first);
+  return MakeRefCounted<DynamicFilters>(p.first, passthrough);
 }
 
 DynamicFilters::~DynamicFilters() {
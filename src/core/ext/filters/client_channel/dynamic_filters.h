@@ -79,19 +79,32 @@ class DynamicFilters : public RefCounted<DynamicFilters> {
     grpc_closure* after_call_stack_destroy_ = nullptr;
   };
 
+  // If passthrough is true, the caller promises that filters consists
+  // solely of its own termination filter, in which case it may bypass the
+  // dynamic call stack entirely (see passthrough() below). The flag is
+  // dropped if stack creation fails and the lame filter is substituted.
   static RefCountedPtr<DynamicFilters> Create(
       const grpc_channel_args* args,
-      std::vector<const grpc_channel_filter*> filters);
+      std::vector<const grpc_channel_filter*> filters,
+      bool passthrough = false);
 
-  explicit DynamicFilters(grpc_channel_stack* channel_stack)
-      : channel_stack_(channel_stack) {}
+  DynamicFilters(grpc_channel_stack* channel_stack, bool passthrough)
+      : channel_stack_(channel_stack), passthrough_(passthrough) {}
 
   ~DynamicFilters() override;
 
   RefCountedPtr<Call> CreateCall(Call::Args args, grpc_error_handle* error);
 
+  // True if the stack contains only the creating channel's termination
+  // filter, so a call through it would do nothing but trampoline batches.
+  // Callers may then skip CreateCall() and invoke whatever the termination
+  // filter would have invoked directly, avoiding a second arena-allocated
+  // call stack with its own refcount and closure wrapping.
+  bool passthrough() const { return passthrough_; }
+
  private:
   grpc_channel_stack* channel_stack_;
+  const bool passthrough_;
 };
 
 }  // namespace grpc_core
@@ -50,12 +50,12 @@ RefCountedPtr<GlobalSubchannelPool> GlobalSubchannelPool::instance() {
 RefCountedPtr<Subchannel> GlobalSubchannelPool::RegisterSubchannel(
     const SubchannelKey& key, RefCountedPtr<Subchannel> constructed) {
   MutexLock lock(&mu_);
-  auto it = subchannel_map_.find(key);
-  if (it != subchannel_map_.end()) {
-    RefCountedPtr<Subchannel> existing = it->second->RefIfNonZero();
+  Subchannel* const* existing_entry = subchannel_map_.Lookup(key);
+  if (existing_entry != nullptr) {
+    RefCountedPtr<Subchannel> existing = (*existing_entry)->RefIfNonZero();
     if (existing != nullptr) return existing;
   }
-  subchannel_map_[key] = constructed.get();
+  subchannel_map_ = subchannel_map_.Add(key, constructed.get());
   return constructed;
 }
 
@@ -64,20 +64,20 @@ RefCountedPtr<GlobalSubchannelPool>* GlobalSubchannelPool::instance_ = nullptr;
 void GlobalSubchannelPool::UnregisterSubchannel(const SubchannelKey& key,
                                                 Subchannel* subchannel) {
   MutexLock lock(&mu_);
-  auto it = subchannel_map_.find(key);
+  Subchannel* const* entry = subchannel_map_.Lookup(key);
   // delete only if key hasn't been re-registered to a different subchannel
   // between strong-unreffing and unregistration of subchannel.
-  if (it != subchannel_map_.end() && it->second == subchannel) {
-    subchannel_map_.erase(it);
+  if (entry != nullptr && *entry == subchannel) {
+    subchannel_map_ = subchannel_map_.Remove(key);
   }
 }
 
 RefCountedPtr<Subchannel> GlobalSubchannelPool::FindSubchannel(
     const SubchannelKey& key) {
   MutexLock lock(&mu_);
-  auto it = subchannel_map_.find(key);
-  if (it == subchannel_map_.end()) return nullptr;
-  return it->second->RefIfNonZero();
+  Subchannel* const* entry = subchannel_map_.Lookup(key);
+  if (entry == nullptr) return nullptr;
+  return (*entry)->RefIfNonZero();
 }
 
 }  // namespace grpc_core
@@ -21,9 +21,8 @@
 
 #include <grpc/support/port_platform.h>
 
-#include <map>
-
 #include "src/core/ext/filters/client_channel/subchannel_pool_interface.h"
+#include "src/core/lib/gprpp/flat_map.h"
 #include "src/core/lib/gprpp/sync.h"
 
 namespace grpc_core {
@@ -62,8 +61,10 @@ class GlobalSubchannelPool final : public SubchannelPoolInterface {
   // non-local static object can be trivially destructible.)
   static RefCountedPtr<GlobalSubchannelPool>* instance_;
 
-  // A map from subchannel key to subchannel.
-  std::map<SubchannelKey, Subchannel*> subchannel_map_ ABSL_GUARDED_BY(mu_);
+  // A map from subchannel key to subchannel.  The flat sorted-array map
+  // keeps lookups cache-linear; registrations are rare enough that the
+  // copy-on-update cost is noise.
+  FlatMap<SubchannelKey, Subchannel*> subchannel_map_ ABSL_GUARDED_BY(mu_);
   // To protect subchannel_map_.
   Mutex mu_;
 };
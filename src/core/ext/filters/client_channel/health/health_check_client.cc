@@ -23,6 +23,11 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
 #include "upb/upb.hpp"
 
 #include "src/core/lib/debug/trace.h"
@@ -182,7 +187,9 @@ namespace {
 
 void EncodeRequest(const std::string& service_name,
                    ManualConstructor<SliceBufferByteStream>* send_message) {
-  upb::Arena arena;
+  // Health messages are tiny; seed the arena from the stack so that
+  // encoding one does not touch the heap.
+  upb::InlinedArena<512> arena;
   grpc_health_v1_HealthCheckRequest* request_struct =
       grpc_health_v1_HealthCheckRequest_new(arena.ptr());
   grpc_health_v1_HealthCheckRequest_set_service(
@@ -225,8 +232,9 @@ bool DecodeResponse(grpc_slice_buffer* slice_buffer, grpc_error_handle* error) {
       offset += GRPC_SLICE_LENGTH(slice_buffer->slices[i]);
     }
   }
-  // Deserialize message.
-  upb::Arena arena;
+  // Deserialize message. As above, a stack-seeded arena keeps the
+  // per-message parse allocation-free.
+  upb::InlinedArena<512> arena;
   grpc_health_v1_HealthCheckResponse* response_struct =
       grpc_health_v1_HealthCheckResponse_parse(
           reinterpret_cast<char*>(recv_message), slice_buffer->length,
@@ -612,4 +620,180 @@ void HealthCheckClient::CallState::CallEndedLocked(bool retry) {
   call_->Unref(DEBUG_LOCATION, "call_ended");
 }
 
+//
+// SharedHealthChecker
+//
+
+// Multiplexing state for a single (endpoint address, service name) pair.
+// Owns the one HealthCheckClient shared by all handles for that pair and
+// fans its state out to each handle's watcher.  Entries live in the
+// process-wide registry below; handle registration and removal happen with
+// the registry lock held, so a checker is in the registry exactly as long
+// as it has at least one handle.
+class SharedHealthChecker : public RefCounted<SharedHealthChecker> {
+ public:
+  SharedHealthChecker(std::string key, std::string service_name)
+      : key_(std::move(key)), service_name_(std::move(service_name)) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_health_check_client_trace)) {
+      gpr_log(GPR_INFO, "created SharedHealthChecker %p for \"%s\"", this,
+              key_.c_str());
+    }
+  }
+
+  const std::string& key() const { return key_; }
+
+  // Called with the registry lock held.
+  void AddHandle(HealthCheckWatchHandle* handle) {
+    MutexLock lock(&mu_);
+    handles_.push_back(handle);
+    // Catch the new watcher up with the current health state.
+    if (seen_state_) handle->watcher_->Notify(state_, status_);
+    if (owner_ == nullptr) {
+      owner_ = handle;
+      StartClientLocked();
+    }
+  }
+
+  // Called with the registry lock held.  Returns true if this was the last
+  // handle, in which case the caller removes us from the registry.
+  bool RemoveHandle(HealthCheckWatchHandle* handle) {
+    MutexLock lock(&mu_);
+    handles_.erase(std::remove(handles_.begin(), handles_.end(), handle),
+                   handles_.end());
+    if (handle == owner_) {
+      // The handle carrying the shared call is going away; restart the
+      // call on one of the remaining handles, if any.
+      client_.reset();
+      current_forwarder_ = nullptr;
+      owner_ = nullptr;
+      if (!handles_.empty()) {
+        owner_ = handles_.front();
+        StartClientLocked();
+      }
+    }
+    return handles_.empty();
+  }
+
+ private:
+  // Forwards state from the shared HealthCheckClient into the checker.
+  // Asynchronous so that the client may safely notify while the checker
+  // is holding its own lock (e.g. while starting the client).
+  class StateForwarder : public AsyncConnectivityStateWatcherInterface {
+   public:
+    explicit StateForwarder(RefCountedPtr<SharedHealthChecker> checker)
+        : checker_(std::move(checker)) {}
+
+   private:
+    void OnConnectivityStateChange(grpc_connectivity_state new_state,
+                                   const absl::Status& status) override {
+      checker_->OnHealthStateChange(this, new_state, status);
+    }
+
+    RefCountedPtr<SharedHealthChecker> checker_;
+  };
+
+  void OnHealthStateChange(StateForwarder* forwarder,
+                           grpc_connectivity_state state,
+                           const absl::Status& status) {
+    MutexLock lock(&mu_);
+    // Ignore notifications from a previous client that raced with its
+    // replacement.
+    if (forwarder != current_forwarder_) return;
+    seen_state_ = true;
+    state_ = state;
+    status_ = status;
+    for (HealthCheckWatchHandle* handle : handles_) {
+      handle->watcher_->Notify(state, status);
+    }
+  }
+
+  void StartClientLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    auto forwarder = MakeRefCounted<StateForwarder>(Ref());
+    current_forwarder_ = forwarder.get();
+    client_ = MakeOrphanable<HealthCheckClient>(
+        service_name_, owner_->connected_subchannel_,
+        owner_->interested_parties_, owner_->channelz_node_,
+        std::move(forwarder));
+  }
+
+  const std::string key_;
+  const std::string service_name_;
+
+  Mutex mu_;
+  std::vector<HealthCheckWatchHandle*> handles_ ABSL_GUARDED_BY(mu_);
+  // The handle whose connection carries the shared Watch call.
+  HealthCheckWatchHandle* owner_ ABSL_GUARDED_BY(mu_) = nullptr;
+  OrphanablePtr<HealthCheckClient> client_ ABSL_GUARDED_BY(mu_);
+  StateForwarder* current_forwarder_ ABSL_GUARDED_BY(mu_) = nullptr;
+  // Last state reported by the shared call, replayed to new handles.
+  bool seen_state_ ABSL_GUARDED_BY(mu_) = false;
+  grpc_connectivity_state state_ ABSL_GUARDED_BY(mu_) =
+      GRPC_CHANNEL_CONNECTING;
+  absl::Status status_ ABSL_GUARDED_BY(mu_);
+};
+
+//
+// HealthCheckWatchHandle
+//
+
+namespace {
+
+gpr_once g_registry_init = GPR_ONCE_INIT;
+Mutex* g_registry_mu = nullptr;
+std::map<std::string, SharedHealthChecker*>* g_shared_health_checkers =
+    nullptr;
+
+void RegistryInit() {
+  g_registry_mu = new Mutex();
+  g_shared_health_checkers = new std::map<std::string, SharedHealthChecker*>();
+}
+
+}  // namespace
+
+HealthCheckWatchHandle::HealthCheckWatchHandle(
+    RefCountedPtr<ConnectedSubchannel> connected_subchannel,
+    grpc_pollset_set* interested_parties,
+    RefCountedPtr<channelz::SubchannelNode> channelz_node,
+    RefCountedPtr<ConnectivityStateWatcherInterface> watcher)
+    : connected_subchannel_(std::move(connected_subchannel)),
+      interested_parties_(interested_parties),
+      channelz_node_(std::move(channelz_node)),
+      watcher_(std::move(watcher)) {}
+
+OrphanablePtr<HealthCheckWatchHandle> HealthCheckWatchHandle::Start(
+    const char* endpoint_address, std::string service_name,
+    RefCountedPtr<ConnectedSubchannel> connected_subchannel,
+    grpc_pollset_set* interested_parties,
+    RefCountedPtr<channelz::SubchannelNode> channelz_node,
+    RefCountedPtr<ConnectivityStateWatcherInterface> watcher) {
+  gpr_once_init(&g_registry_init, RegistryInit);
+  auto* handle = new HealthCheckWatchHandle(
+      std::move(connected_subchannel), interested_parties,
+      std::move(channelz_node), std::move(watcher));
+  std::string key = absl::StrCat(endpoint_address, " ", service_name);
+  MutexLock lock(g_registry_mu);
+  auto it = g_shared_health_checkers->find(key);
+  if (it != g_shared_health_checkers->end()) {
+    handle->checker_ = it->second->Ref();
+  } else {
+    handle->checker_ =
+        MakeRefCounted<SharedHealthChecker>(key, std::move(service_name));
+    g_shared_health_checkers->emplace(std::move(key), handle->checker_.get());
+  }
+  handle->checker_->AddHandle(handle);
+  return OrphanablePtr<HealthCheckWatchHandle>(handle);
+}
+
+HealthCheckWatchHandle::~HealthCheckWatchHandle() {}
+
+void HealthCheckWatchHandle::Orphan() {
+  {
+    MutexLock lock(g_registry_mu);
+    if (checker_->RemoveHandle(this)) {
+      g_shared_health_checkers->erase(checker_->key());
+    }
+  }
+  delete this;
+}
+
 }  // namespace grpc_core
@@ -172,6 +172,46 @@ class HealthCheckClient : public InternallyRefCounted<HealthCheckClient> {
   bool retry_timer_callback_pending_ ABSL_GUARDED_BY(mu_) = false;
 };
 
+class SharedHealthChecker;
+
+// A handle on a multiplexed health check watch.  All handles for the same
+// (endpoint address, health check service name) pair share a single
+// HealthCheckClient -- and thus a single streaming Watch call -- no matter
+// how many subchannels in the process point at that endpoint.  Health state
+// from the shared call is fanned out to every handle's watcher.
+class HealthCheckWatchHandle : public Orphanable {
+ public:
+  // Registers a watch for service_name on the backend at endpoint_address.
+  // The connected subchannel, pollset set, and channelz node are used to
+  // run the shared Watch call whenever this handle is the one carrying it.
+  static OrphanablePtr<HealthCheckWatchHandle> Start(
+      const char* endpoint_address, std::string service_name,
+      RefCountedPtr<ConnectedSubchannel> connected_subchannel,
+      grpc_pollset_set* interested_parties,
+      RefCountedPtr<channelz::SubchannelNode> channelz_node,
+      RefCountedPtr<ConnectivityStateWatcherInterface> watcher);
+
+  // Defined in the .cc file, where SharedHealthChecker is complete.
+  ~HealthCheckWatchHandle() override;
+
+  void Orphan() override;
+
+ private:
+  friend class SharedHealthChecker;
+
+  HealthCheckWatchHandle(
+      RefCountedPtr<ConnectedSubchannel> connected_subchannel,
+      grpc_pollset_set* interested_parties,
+      RefCountedPtr<channelz::SubchannelNode> channelz_node,
+      RefCountedPtr<ConnectivityStateWatcherInterface> watcher);
+
+  RefCountedPtr<SharedHealthChecker> checker_;
+  RefCountedPtr<ConnectedSubchannel> connected_subchannel_;
+  grpc_pollset_set* interested_parties_;  // Do not own.
+  RefCountedPtr<channelz::SubchannelNode> channelz_node_;
+  RefCountedPtr<ConnectivityStateWatcherInterface> watcher_;
+};
+
 }  // namespace grpc_core
 
 #endif /* GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_HEALTH_HEALTH_CHECK_CLIENT_H */
@@ -39,6 +39,7 @@
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/http/format_request.h"
 #include "src/core/lib/http/parser.h"
+#include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/uri/uri_parser.h"
 
@@ -46,6 +47,321 @@ namespace grpc_core {
 
 namespace {
 
+//
+// Pipelined CONNECT endpoint
+//
+
+// Endpoint wrapper used when GRPC_ARG_HTTP_CONNECT_PIPELINE is set.  The
+// wrapper is handed to the next handshaker while the CONNECT exchange is
+// still in flight: writes issued before the CONNECT request write has
+// completed are deferred (the wrapped endpoint must never see two
+// concurrent writes) and then flushed, so the TLS ClientHello rides out
+// immediately behind the CONNECT request; reads are intercepted until the
+// proxy's response has been parsed, and fail if the proxy returns a non-2xx
+// status, aborting the speculative handshake.  Once the tunnel is
+// established the wrapper is a plain passthrough, costing one extra
+// virtual dispatch per operation for the connection's lifetime.
+struct pipelined_connect_endpoint {
+  grpc_endpoint base;
+  grpc_endpoint* wrapped = nullptr;
+  gpr_refcount refs;
+  gpr_mu mu;
+
+  bool connect_write_pending = true;
+  bool tunnel_established = false;
+  grpc_error_handle connect_error = GRPC_ERROR_NONE;
+
+  // Write deferred while the CONNECT request write is in flight.
+  grpc_slice_buffer* deferred_write_slices = nullptr;
+  grpc_closure* deferred_write_cb = nullptr;
+  void* deferred_write_arg = nullptr;
+
+  // Intercepted read, pending until the CONNECT response is parsed.
+  grpc_slice_buffer* pending_read_slices = nullptr;
+  grpc_closure* pending_read_cb = nullptr;
+  bool pending_read_urgent = false;
+  grpc_slice_buffer read_staging;
+
+  // Objects for processing the HTTP CONNECT request and response.
+  grpc_slice_buffer connect_write_buffer;
+  grpc_http_parser http_parser;
+  grpc_http_response http_response;
+  grpc_closure on_connect_write_done;
+  grpc_closure on_connect_read_done;
+};
+
+void pipelined_connect_endpoint_unref(pipelined_connect_endpoint* ep) {
+  if (gpr_unref(&ep->refs)) {
+    grpc_endpoint_destroy(ep->wrapped);
+    grpc_slice_buffer_destroy_internal(&ep->read_staging);
+    grpc_slice_buffer_destroy_internal(&ep->connect_write_buffer);
+    grpc_http_parser_destroy(&ep->http_parser);
+    grpc_http_response_destroy(&ep->http_response);
+    GRPC_ERROR_UNREF(ep->connect_error);
+    gpr_mu_destroy(&ep->mu);
+    delete ep;
+  }
+}
+
+// Callback invoked when the CONNECT request write (issued at creation)
+// completes; flushes any write the next handshaker deferred behind it.
+void pipelined_connect_on_write_done(void* arg, grpc_error_handle error) {
+  auto* ep = static_cast<pipelined_connect_endpoint*>(arg);
+  grpc_slice_buffer* flush_slices = nullptr;
+  grpc_closure* flush_cb = nullptr;
+  void* flush_arg = nullptr;
+  grpc_error_handle flush_error = GRPC_ERROR_NONE;
+  gpr_mu_lock(&ep->mu);
+  ep->connect_write_pending = false;
+  if (error != GRPC_ERROR_NONE && ep->connect_error == GRPC_ERROR_NONE) {
+    ep->connect_error = GRPC_ERROR_REF(error);
+  }
+  if (ep->deferred_write_cb != nullptr) {
+    flush_slices = ep->deferred_write_slices;
+    flush_cb = ep->deferred_write_cb;
+    flush_arg = ep->deferred_write_arg;
+    flush_error = GRPC_ERROR_REF(ep->connect_error);
+    ep->deferred_write_slices = nullptr;
+    ep->deferred_write_cb = nullptr;
+    ep->deferred_write_arg = nullptr;
+  }
+  gpr_mu_unlock(&ep->mu);
+  if (flush_cb != nullptr) {
+    if (flush_error != GRPC_ERROR_NONE) {
+      ExecCtx::Run(DEBUG_LOCATION, flush_cb, flush_error);
+    } else {
+      grpc_endpoint_write(ep->wrapped, flush_slices, flush_cb, flush_arg);
+    }
+  }
+  pipelined_connect_endpoint_unref(ep);
+}
+
+// Callback invoked as CONNECT response data arrives in read_staging.
+void pipelined_connect_on_read_done(void* arg, grpc_error_handle error) {
+  auto* ep = static_cast<pipelined_connect_endpoint*>(arg);
+  grpc_closure* user_cb = nullptr;
+  grpc_slice_buffer* user_slices = nullptr;
+  grpc_error_handle user_error = GRPC_ERROR_NONE;
+  bool reissue = false;
+  bool passthrough = false;
+  bool urgent = false;
+  gpr_mu_lock(&ep->mu);
+  if (error != GRPC_ERROR_NONE) {
+    error = GRPC_ERROR_REF(error);
+  } else {
+    // Add buffer to parser.
+    for (size_t i = 0;
+         i < ep->read_staging.count && error == GRPC_ERROR_NONE; ++i) {
+      if (GRPC_SLICE_LENGTH(ep->read_staging.slices[i]) > 0) {
+        size_t body_start_offset = 0;
+        error = grpc_http_parser_parse(
+            &ep->http_parser, ep->read_staging.slices[i], &body_start_offset);
+        if (error != GRPC_ERROR_NONE) break;
+        if (ep->http_parser.state == GRPC_HTTP_BODY) {
+          // Make sure we got a 2xx response.
+          if (ep->http_response.status < 200 ||
+              ep->http_response.status >= 300) {
+            error = GRPC_ERROR_CREATE_FROM_CPP_STRING(
+                absl::StrCat("HTTP proxy returned response code ",
+                             ep->http_response.status));
+            break;
+          }
+          // Tunnel established: deliver the leftover bytes (if any) to the
+          // intercepted read.
+          ep->tunnel_established = true;
+          if (body_start_offset <
+              GRPC_SLICE_LENGTH(ep->read_staging.slices[i])) {
+            grpc_slice_buffer_add(
+                ep->pending_read_slices,
+                grpc_slice_split_tail(&ep->read_staging.slices[i],
+                                      body_start_offset));
+          }
+          for (size_t j = i + 1; j < ep->read_staging.count; ++j) {
+            grpc_slice_buffer_add(
+                ep->pending_read_slices,
+                grpc_slice_ref_internal(ep->read_staging.slices[j]));
+          }
+          break;
+        }
+      }
+    }
+  }
+  grpc_slice_buffer_reset_and_unref_internal(&ep->read_staging);
+  if (error != GRPC_ERROR_NONE) {
+    if (ep->connect_error == GRPC_ERROR_NONE) {
+      ep->connect_error = GRPC_ERROR_REF(error);
+    }
+    user_cb = ep->pending_read_cb;
+    user_error = error;
+  } else if (!ep->tunnel_established) {
+    // Response not fully received yet; read more data.
+    reissue = true;
+    urgent = ep->pending_read_urgent;
+  } else if (ep->pending_read_slices->count == 0) {
+    // No bytes arrived beyond the proxy's response: turn the intercepted
+    // read into a plain read on the wrapped endpoint.
+    passthrough = true;
+    user_cb = ep->pending_read_cb;
+    user_slices = ep->pending_read_slices;
+    urgent = ep->pending_read_urgent;
+  } else {
+    user_cb = ep->pending_read_cb;
+  }
+  if (!reissue) {
+    ep->pending_read_slices = nullptr;
+    ep->pending_read_cb = nullptr;
+  }
+  gpr_mu_unlock(&ep->mu);
+  if (reissue) {
+    // The read callback keeps our ref.
+    grpc_endpoint_read(ep->wrapped, &ep->read_staging,
+                       &ep->on_connect_read_done, urgent);
+    return;
+  }
+  if (passthrough) {
+    grpc_endpoint_read(ep->wrapped, user_slices, user_cb, urgent);
+  } else {
+    ExecCtx::Run(DEBUG_LOCATION, user_cb, user_error);
+  }
+  pipelined_connect_endpoint_unref(ep);
+}
+
+void pipelined_connect_ep_read(grpc_endpoint* base_ep,
+                               grpc_slice_buffer* slices, grpc_closure* cb,
+                               bool urgent) {
+  auto* ep = reinterpret_cast<pipelined_connect_endpoint*>(base_ep);
+  gpr_mu_lock(&ep->mu);
+  if (ep->tunnel_established) {
+    gpr_mu_unlock(&ep->mu);
+    grpc_endpoint_read(ep->wrapped, slices, cb, urgent);
+    return;
+  }
+  if (ep->connect_error != GRPC_ERROR_NONE) {
+    grpc_error_handle error = GRPC_ERROR_REF(ep->connect_error);
+    gpr_mu_unlock(&ep->mu);
+    ExecCtx::Run(DEBUG_LOCATION, cb, error);
+    return;
+  }
+  GPR_ASSERT(ep->pending_read_cb == nullptr);
+  ep->pending_read_slices = slices;
+  ep->pending_read_cb = cb;
+  ep->pending_read_urgent = urgent;
+  gpr_ref(&ep->refs);  // Held by the read callback.
+  gpr_mu_unlock(&ep->mu);
+  grpc_endpoint_read(ep->wrapped, &ep->read_staging,
+                     &ep->on_connect_read_done, urgent);
+}
+
+void pipelined_connect_ep_write(grpc_endpoint* base_ep,
+                                grpc_slice_buffer* slices, grpc_closure* cb,
+                                void* arg) {
+  auto* ep = reinterpret_cast<pipelined_connect_endpoint*>(base_ep);
+  gpr_mu_lock(&ep->mu);
+  if (ep->connect_error != GRPC_ERROR_NONE) {
+    grpc_error_handle error = GRPC_ERROR_REF(ep->connect_error);
+    gpr_mu_unlock(&ep->mu);
+    ExecCtx::Run(DEBUG_LOCATION, cb, error);
+    return;
+  }
+  if (ep->connect_write_pending) {
+    GPR_ASSERT(ep->deferred_write_cb == nullptr);
+    ep->deferred_write_slices = slices;
+    ep->deferred_write_cb = cb;
+    ep->deferred_write_arg = arg;
+    gpr_mu_unlock(&ep->mu);
+    return;
+  }
+  gpr_mu_unlock(&ep->mu);
+  grpc_endpoint_write(ep->wrapped, slices, cb, arg);
+}
+
+void pipelined_connect_ep_add_to_pollset(grpc_endpoint* base_ep,
+                                         grpc_pollset* pollset) {
+  auto* ep = reinterpret_cast<pipelined_connect_endpoint*>(base_ep);
+  grpc_endpoint_add_to_pollset(ep->wrapped, pollset);
+}
+
+void pipelined_connect_ep_add_to_pollset_set(grpc_endpoint* base_ep,
+                                             grpc_pollset_set* pollset_set) {
+  auto* ep = reinterpret_cast<pipelined_connect_endpoint*>(base_ep);
+  grpc_endpoint_add_to_pollset_set(ep->wrapped, pollset_set);
+}
+
+void pipelined_connect_ep_delete_from_pollset_set(
+    grpc_endpoint* base_ep, grpc_pollset_set* pollset_set) {
+  auto* ep = reinterpret_cast<pipelined_connect_endpoint*>(base_ep);
+  grpc_endpoint_delete_from_pollset_set(ep->wrapped, pollset_set);
+}
+
+void pipelined_connect_ep_shutdown(grpc_endpoint* base_ep,
+                                   grpc_error_handle why) {
+  auto* ep = reinterpret_cast<pipelined_connect_endpoint*>(base_ep);
+  grpc_endpoint_shutdown(ep->wrapped, why);
+}
+
+void pipelined_connect_ep_destroy(grpc_endpoint* base_ep) {
+  auto* ep = reinterpret_cast<pipelined_connect_endpoint*>(base_ep);
+  pipelined_connect_endpoint_unref(ep);
+}
+
+absl::string_view pipelined_connect_ep_get_peer(grpc_endpoint* base_ep) {
+  auto* ep = reinterpret_cast<pipelined_connect_endpoint*>(base_ep);
+  return grpc_endpoint_get_peer(ep->wrapped);
+}
+
+absl::string_view pipelined_connect_ep_get_local_address(
+    grpc_endpoint* base_ep) {
+  auto* ep = reinterpret_cast<pipelined_connect_endpoint*>(base_ep);
+  return grpc_endpoint_get_local_address(ep->wrapped);
+}
+
+int pipelined_connect_ep_get_fd(grpc_endpoint* base_ep) {
+  auto* ep = reinterpret_cast<pipelined_connect_endpoint*>(base_ep);
+  return grpc_endpoint_get_fd(ep->wrapped);
+}
+
+bool pipelined_connect_ep_can_track_err(grpc_endpoint* base_ep) {
+  auto* ep = reinterpret_cast<pipelined_connect_endpoint*>(base_ep);
+  return grpc_endpoint_can_track_err(ep->wrapped);
+}
+
+const grpc_endpoint_vtable pipelined_connect_endpoint_vtable = {
+    pipelined_connect_ep_read,
+    pipelined_connect_ep_write,
+    pipelined_connect_ep_add_to_pollset,
+    pipelined_connect_ep_add_to_pollset_set,
+    pipelined_connect_ep_delete_from_pollset_set,
+    pipelined_connect_ep_shutdown,
+    pipelined_connect_ep_destroy,
+    pipelined_connect_ep_get_peer,
+    pipelined_connect_ep_get_local_address,
+    pipelined_connect_ep_get_fd,
+    pipelined_connect_ep_can_track_err};
+
+// Takes ownership of \a wrapped and \a connect_request, and immediately
+// starts writing the CONNECT request.
+grpc_endpoint* pipelined_connect_endpoint_create(grpc_endpoint* wrapped,
+                                                 grpc_slice connect_request) {
+  auto* ep = new pipelined_connect_endpoint();
+  ep->base.vtable = &pipelined_connect_endpoint_vtable;
+  ep->wrapped = wrapped;
+  gpr_ref_init(&ep->refs, 1);
+  gpr_mu_init(&ep->mu);
+  grpc_slice_buffer_init(&ep->connect_write_buffer);
+  grpc_slice_buffer_init(&ep->read_staging);
+  grpc_http_parser_init(&ep->http_parser, GRPC_HTTP_RESPONSE,
+                        &ep->http_response);
+  GRPC_CLOSURE_INIT(&ep->on_connect_write_done, pipelined_connect_on_write_done,
+                    ep, grpc_schedule_on_exec_ctx);
+  GRPC_CLOSURE_INIT(&ep->on_connect_read_done, pipelined_connect_on_read_done,
+                    ep, grpc_schedule_on_exec_ctx);
+  grpc_slice_buffer_add(&ep->connect_write_buffer, connect_request);
+  gpr_ref(&ep->refs);  // Held by the write callback.
+  grpc_endpoint_write(wrapped, &ep->connect_write_buffer,
+                      &ep->on_connect_write_done, nullptr);
+  return &ep->base;
+}
+
 class HttpConnectHandshaker : public Handshaker {
  public:
   HttpConnectHandshaker();
@@ -345,13 +661,27 @@ void HttpConnectHandshaker::DoHandshake(grpc_tcp_server_acceptor* /*acceptor*/,
   request.http.body = nullptr;
   request.handshaker = &grpc_httpcli_plaintext;
   grpc_slice request_slice = grpc_httpcli_format_connect_request(&request);
-  grpc_slice_buffer_add(&write_buffer_, request_slice);
   // Clean up.
   gpr_free(headers);
   for (size_t i = 0; i < num_header_strings; ++i) {
     gpr_free(header_strings[i]);
   }
   gpr_free(header_strings);
+  // If requested, pipeline the rest of the handshake behind the CONNECT
+  // request: hand the next handshaker a wrapper endpoint that completes the
+  // CONNECT exchange in the background, so that its first write (e.g. the
+  // TLS ClientHello) goes out without waiting for the proxy's response.
+  if (grpc_channel_args_find_bool(args->args, GRPC_ARG_HTTP_CONNECT_PIPELINE,
+                                  false)) {
+    args->endpoint =
+        pipelined_connect_endpoint_create(args->endpoint, request_slice);
+    // The wrapper owns the exchange from here; mark this handshaker as done
+    // so that Shutdown() becomes a no-op.
+    is_shutdown_ = true;
+    ExecCtx::Run(DEBUG_LOCATION, on_handshake_done, GRPC_ERROR_NONE);
+    return;
+  }
+  grpc_slice_buffer_add(&write_buffer_, request_slice);
   // Take a new ref to be held by the write callback.
   Ref().release();
   grpc_endpoint_write(
@@ -32,6 +32,16 @@
 /// separated by colons.
 #define GRPC_ARG_HTTP_CONNECT_HEADERS "grpc.http_connect_headers"
 
+/// Channel arg (boolean) enabling speculative pipelining of the handshake
+/// through the HTTP proxy: the next handshaker is started as soon as the
+/// CONNECT request has been issued, so its first write (e.g. the TLS
+/// ClientHello) goes out without waiting for the proxy's response, saving
+/// one proxy round trip per connection.  If the proxy rejects the CONNECT
+/// request, the speculative handshake is aborted and the connection fails
+/// as it would have without pipelining.  Off by default, since some proxies
+/// drop connections that send data before the tunnel is established.
+#define GRPC_ARG_HTTP_CONNECT_PIPELINE "grpc.http_connect_pipeline"
+
 namespace grpc_core {
 
 // Register the HTTP Connect handshaker into the configuration builder.
@@ -64,6 +64,7 @@
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_join.h"
 #include "absl/strings/strip.h"
+#include "absl/types/optional.h"
 #include "upb/upb.hpp"
 
 #include <grpc/byte_buffer_reader.h>
@@ -296,8 +297,13 @@ class GrpcLb : public LoadBalancingPolicy {
     // Returns a text representation suitable for logging.
     std::string AsText() const;
 
-    // Extracts all non-drop entries into a ServerAddressList.
-    ServerAddressList GetServerAddressList(
+    // Extracts all non-drop entries into a ServerAddressList. The
+    // extraction is performed at most once per (serverlist, client_stats)
+    // pair and memoized, so child policy updates triggered by something
+    // other than a new serverlist (resolver arg changes, re-resolution)
+    // do not re-parse every entry. Must be called from the
+    // work_serializer only.
+    const ServerAddressList& GetServerAddressList(
         GrpcLbClientStats* client_stats) const;
 
     // Returns true if the serverlist contains at least one drop entry and
@@ -316,6 +322,11 @@ class GrpcLb : public LoadBalancingPolicy {
    private:
     std::vector<GrpcLbServer> serverlist_;
 
+    // Memoized result of GetServerAddressList() and the stats object it
+    // was computed against. Accessed from the work_serializer only.
+    mutable absl::optional<ServerAddressList> cached_addresses_;
+    mutable GrpcLbClientStats* cached_addresses_client_stats_ = nullptr;
+
     // Guarded by the channel's data plane mutex, NOT the control
     // plane work_serializer.  It should not be accessed by anything but the
     // picker via the ShouldDrop() method.
@@ -547,8 +558,12 @@ bool IsServerValid(const GrpcLbServer& server, size_t idx, bool log) {
 }
 
 // Returns addresses extracted from the serverlist.
-ServerAddressList GrpcLb::Serverlist::GetServerAddressList(
+const ServerAddressList& GrpcLb::Serverlist::GetServerAddressList(
     GrpcLbClientStats* client_stats) const {
+  if (cached_addresses_.has_value() &&
+      cached_addresses_client_stats_ == client_stats) {
+    return *cached_addresses_;
+  }
   RefCountedPtr<GrpcLbClientStats> stats;
   if (client_stats != nullptr) stats = client_stats->Ref();
   ServerAddressList addresses;
@@ -577,7 +592,9 @@ ServerAddressList GrpcLb::Serverlist::GetServerAddressList(
     // Add address.
     addresses.emplace_back(addr, /*args=*/nullptr, std::move(attributes));
   }
-  return addresses;
+  cached_addresses_ = std::move(addresses);
+  cached_addresses_client_stats_ = client_stats;
+  return *cached_addresses_;
 }
 
 bool GrpcLb::Serverlist::ContainsAllDropEntries() const {
@@ -769,8 +786,9 @@ GrpcLb::BalancerCallState::BalancerCallState(
       grpclb_policy_->interested_parties(),
       GRPC_MDSTR_SLASH_GRPC_DOT_LB_DOT_V1_DOT_LOADBALANCER_SLASH_BALANCELOAD,
       nullptr, deadline, nullptr);
-  // Init the LB call request payload.
-  upb::Arena arena;
+  // Init the LB call request payload. The request is tiny, so a
+  // stack-seeded arena avoids heap allocation.
+  upb::InlinedArena<512> arena;
   grpc_slice request_payload_slice = GrpcLbRequestCreate(
       grpclb_policy()->config_->service_name().empty()
           ? grpclb_policy()->server_name_.c_str()
@@ -952,8 +970,9 @@ void GrpcLb::BalancerCallState::SendClientLoadReportLocked() {
   } else {
     last_client_load_report_counters_were_zero_ = false;
   }
-  // Populate load report.
-  upb::Arena arena;
+  // Populate load report. Reports recur on every interval, so seed the
+  // arena from the stack; many drop token entries spill to the heap.
+  upb::InlinedArena<1024> arena;
   grpc_slice request_payload_slice = GrpcLbLoadReportRequestCreate(
       num_calls_started, num_calls_finished,
       num_calls_finished_with_client_failed_to_send,
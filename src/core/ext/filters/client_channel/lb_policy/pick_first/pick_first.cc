@@ -18,6 +18,7 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <limits.h>
 #include <string.h>
 
 #include <grpc/support/alloc.h>
@@ -29,6 +30,7 @@
 #include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/lib/transport/error_utils.h"
 
@@ -125,6 +127,14 @@ class PickFirst : public LoadBalancingPolicy {
 
   void AttemptToConnectUsingLatestUpdateArgsLocked();
 
+  // Starts the Happy Eyeballs timer after starting a connection attempt
+  // on the subchannel at \a index, if racing is enabled and there are
+  // more subchannels to try.
+  void MaybeStartConnectionAttemptTimerLocked(size_t index);
+  void MaybeCancelConnectionAttemptTimerLocked();
+  static void OnConnectionAttemptTimer(void* arg, grpc_error_handle error);
+  void OnConnectionAttemptTimerLocked(grpc_error_handle error);
+
   // Lateset update args.
   UpdateArgs latest_update_args_;
   // All our subchannels.
@@ -137,12 +147,24 @@ class PickFirst : public LoadBalancingPolicy {
   bool idle_ = false;
   // Are we shut down?
   bool shutdown_ = false;
+  // RFC 8305 (Happy Eyeballs) style connection racing: when a connection
+  // attempt has not completed within connection_attempt_delay_ms_, start
+  // an attempt on the next subchannel in parallel instead of waiting for
+  // the first attempt to fail. 0 means racing is disabled.
+  int connection_attempt_delay_ms_ = 0;
+  // Index of the last subchannel whose attempt started the timer.
+  size_t connection_attempt_index_ = 0;
+  bool connection_attempt_timer_pending_ = false;
+  grpc_timer connection_attempt_timer_;
+  grpc_closure on_connection_attempt_timer_;
 };
 
 PickFirst::PickFirst(Args args) : LoadBalancingPolicy(std::move(args)) {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace)) {
     gpr_log(GPR_INFO, "Pick First %p created.", this);
   }
+  GRPC_CLOSURE_INIT(&on_connection_attempt_timer_, OnConnectionAttemptTimer,
+                    this, grpc_schedule_on_exec_ctx);
 }
 
 PickFirst::~PickFirst() {
@@ -158,6 +180,7 @@ void PickFirst::ShutdownLocked() {
     gpr_log(GPR_INFO, "Pick First %p Shutting down", this);
   }
   shutdown_ = true;
+  MaybeCancelConnectionAttemptTimerLocked();
   subchannel_list_.reset();
   latest_pending_subchannel_list_.reset();
 }
@@ -181,6 +204,9 @@ void PickFirst::ResetBackoffLocked() {
 }
 
 void PickFirst::AttemptToConnectUsingLatestUpdateArgsLocked() {
+  // Any racing attempts were for subchannels in the list we're about to
+  // replace.
+  MaybeCancelConnectionAttemptTimerLocked();
   // Create a subchannel list from the latest_update_args_.
   auto subchannel_list = MakeOrphanable<PickFirstSubchannelList>(
       this, &grpc_lb_pick_first_trace, latest_update_args_.addresses,
@@ -230,6 +256,7 @@ void PickFirst::AttemptToConnectUsingLatestUpdateArgsLocked() {
     // state of all subchannels above.
     subchannel_list_->subchannel(0)->StartConnectivityWatchLocked();
     subchannel_list_->subchannel(0)->subchannel()->AttemptToConnect();
+    MaybeStartConnectionAttemptTimerLocked(0);
   } else {
     // We do have a selected subchannel (which means it's READY), so keep
     // using it until one of the subchannels in the new list reports READY.
@@ -256,6 +283,72 @@ void PickFirst::AttemptToConnectUsingLatestUpdateArgsLocked() {
   }
 }
 
+void PickFirst::MaybeStartConnectionAttemptTimerLocked(size_t index) {
+  if (connection_attempt_delay_ms_ <= 0) return;
+  if (connection_attempt_timer_pending_ || shutdown_ || selected_ != nullptr) {
+    return;
+  }
+  // Nothing left to race against.
+  if (subchannel_list_ == nullptr ||
+      index + 1 >= subchannel_list_->num_subchannels()) {
+    return;
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace)) {
+    gpr_log(GPR_INFO,
+            "Pick First %p starting %d ms connection attempt timer for "
+            "subchannel index %" PRIuPTR,
+            this, connection_attempt_delay_ms_, index);
+  }
+  connection_attempt_index_ = index;
+  connection_attempt_timer_pending_ = true;
+  Ref(DEBUG_LOCATION, "PickFirst+OnConnectionAttemptTimerLocked").release();
+  grpc_timer_init(&connection_attempt_timer_,
+                  ExecCtx::Get()->Now() + connection_attempt_delay_ms_,
+                  &on_connection_attempt_timer_);
+}
+
+void PickFirst::MaybeCancelConnectionAttemptTimerLocked() {
+  if (connection_attempt_timer_pending_) {
+    grpc_timer_cancel(&connection_attempt_timer_);
+    connection_attempt_timer_pending_ = false;
+  }
+}
+
+void PickFirst::OnConnectionAttemptTimer(void* arg, grpc_error_handle error) {
+  PickFirst* p = static_cast<PickFirst*>(arg);
+  GRPC_ERROR_REF(error);  // ref owned by lambda
+  p->work_serializer()->Run(
+      [p, error]() { p->OnConnectionAttemptTimerLocked(error); },
+      DEBUG_LOCATION);
+}
+
+void PickFirst::OnConnectionAttemptTimerLocked(grpc_error_handle error) {
+  if (error == GRPC_ERROR_NONE && connection_attempt_timer_pending_ &&
+      !shutdown_ && selected_ == nullptr && subchannel_list_ != nullptr) {
+    connection_attempt_timer_pending_ = false;
+    const size_t next_index = connection_attempt_index_ + 1;
+    if (next_index < subchannel_list_->num_subchannels()) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace)) {
+        gpr_log(GPR_INFO,
+                "Pick First %p racing connection attempt to subchannel "
+                "index %" PRIuPTR,
+                this, next_index);
+      }
+      PickFirstSubchannelData* sd = subchannel_list_->subchannel(next_index);
+      // The serial failure path in ProcessConnectivityChangeLocked() may
+      // have already started this attempt; if so, just leave it running.
+      if (!sd->connectivity_watch_pending()) {
+        sd->CheckConnectivityStateAndStartWatchingLocked();
+      }
+      // Note: the subchannel may have been selected above, in which case
+      // this is a no-op.
+      MaybeStartConnectionAttemptTimerLocked(next_index);
+    }
+  }
+  Unref(DEBUG_LOCATION, "PickFirst+OnConnectionAttemptTimerLocked");
+  GRPC_ERROR_UNREF(error);
+}
+
 void PickFirst::UpdateLocked(UpdateArgs args) {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace)) {
     gpr_log(GPR_INFO,
@@ -270,6 +363,9 @@ void PickFirst::UpdateLocked(UpdateArgs args) {
   std::swap(new_args, args.args);
   grpc_channel_args_destroy(new_args);
   latest_update_args_ = std::move(args);
+  connection_attempt_delay_ms_ = grpc_channel_args_find_integer(
+      latest_update_args_.args, GRPC_ARG_EXPERIMENTAL_HAPPY_EYEBALLS_DELAY_MS,
+      {0, 0, INT_MAX});
   // If we are not in idle, start connection attempt immediately.
   // Otherwise, we defer the attempt into ExitIdleLocked().
   if (!idle_) {
@@ -393,7 +489,11 @@ void PickFirst::PickFirstSubchannelData::ProcessConnectivityChangeLocked(
               absl::make_unique<TransientFailurePicker>(status));
         }
       }
-      sd->CheckConnectivityStateAndStartWatchingLocked();
+      // A racing Happy Eyeballs attempt may already be in flight for this
+      // subchannel; if so, just keep waiting on it.
+      if (!sd->connectivity_watch_pending()) {
+        sd->CheckConnectivityStateAndStartWatchingLocked();
+      }
       break;
     }
     case GRPC_CHANNEL_CONNECTING:
@@ -441,6 +541,8 @@ void PickFirst::PickFirstSubchannelData::ProcessUnselectedReadyLocked() {
     gpr_log(GPR_INFO, "Pick First %p selected subchannel %p", p, subchannel());
   }
   p->selected_ = this;
+  // This subchannel won any Happy Eyeballs race that was in progress.
+  p->MaybeCancelConnectionAttemptTimerLocked();
   p->channel_control_helper()->UpdateState(
       GRPC_CHANNEL_READY, absl::Status(),
       absl::make_unique<Picker>(subchannel()->Ref()));
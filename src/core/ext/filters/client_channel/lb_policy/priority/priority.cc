@@ -59,6 +59,11 @@ class PriorityLbConfig : public LoadBalancingPolicy::Config {
   struct PriorityLbChild {
     RefCountedPtr<LoadBalancingPolicy::Config> config;
     bool ignore_reresolution_requests = false;
+    // If true, the child is kept alive (and its subchannels connected) for
+    // as long as it remains in the config, even while a higher priority is
+    // in use, so that failing over to it is just a picker swap instead of
+    // a cold rebuild of the child policy and its connections.
+    bool warm_standby = false;
   };
 
   PriorityLbConfig(std::map<std::string, PriorityLbChild> children,
@@ -101,10 +106,14 @@ class PriorityLb : public LoadBalancingPolicy {
     const std::string& name() const { return name_; }
 
     void UpdateLocked(RefCountedPtr<LoadBalancingPolicy::Config> config,
-                      bool ignore_reresolution_requests);
+                      bool ignore_reresolution_requests, bool warm_standby);
     void ExitIdleLocked();
     void ResetBackoffLocked();
-    void DeactivateLocked();
+    // If allow_warm_standby is true and the child is configured as a warm
+    // standby, it is kept alive indefinitely instead of being scheduled
+    // for deletion.  Pass false when the child is removed from the config
+    // altogether.
+    void DeactivateLocked(bool allow_warm_standby);
     void MaybeReactivateLocked();
     void MaybeCancelFailoverTimerLocked();
 
@@ -187,6 +196,7 @@ class PriorityLb : public LoadBalancingPolicy {
     RefCountedPtr<PriorityLb> priority_policy_;
     const std::string name_;
     bool ignore_reresolution_requests_ = false;
+    bool warm_standby_ = false;
 
     OrphanablePtr<LoadBalancingPolicy> child_policy_;
 
@@ -310,12 +320,15 @@ void PriorityLb::UpdateLocked(UpdateArgs args) {
     auto& child = p.second;
     auto config_it = config_->children().find(child_name);
     if (config_it == config_->children().end()) {
-      // Existing child not found in new config.  Deactivate it.
-      child->DeactivateLocked();
+      // Existing child not found in new config.  Deactivate it.  Warm
+      // standby does not apply here: a child that is no longer in the
+      // config should not be kept alive indefinitely.
+      child->DeactivateLocked(/*allow_warm_standby=*/false);
     } else {
       // Existing child found in new config.  Update it.
       child->UpdateLocked(config_it->second.config,
-                          config_it->second.ignore_reresolution_requests);
+                          config_it->second.ignore_reresolution_requests,
+                          config_it->second.warm_standby);
     }
   }
   // Try to get connected.
@@ -435,7 +448,8 @@ void PriorityLb::TryNextPriorityLocked(bool report_connecting) {
       auto child_config = config_->children().find(child_name);
       GPR_DEBUG_ASSERT(child_config != config_->children().end());
       child->UpdateLocked(child_config->second.config,
-                          child_config->second.ignore_reresolution_requests);
+                          child_config->second.ignore_reresolution_requests,
+                          child_config->second.warm_standby);
       return;
     }
     // The child already exists.
@@ -489,7 +503,9 @@ void PriorityLb::SelectPriorityLocked(uint32_t priority) {
   for (uint32_t p = priority + 1; p < config_->priorities().size(); ++p) {
     const std::string& child_name = config_->priorities()[p];
     auto it = children_.find(child_name);
-    if (it != children_.end()) it->second->DeactivateLocked();
+    if (it != children_.end()) {
+      it->second->DeactivateLocked(/*allow_warm_standby=*/true);
+    }
   }
   // Update picker.
   auto& child = children_[config_->priorities()[priority]];
@@ -542,13 +558,14 @@ void PriorityLb::ChildPriority::Orphan() {
 
 void PriorityLb::ChildPriority::UpdateLocked(
     RefCountedPtr<LoadBalancingPolicy::Config> config,
-    bool ignore_reresolution_requests) {
+    bool ignore_reresolution_requests, bool warm_standby) {
   if (priority_policy_->shutting_down_) return;
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_priority_trace)) {
     gpr_log(GPR_INFO, "[priority_lb %p] child %s (%p): start update",
             priority_policy_.get(), name_.c_str(), this);
   }
   ignore_reresolution_requests_ = ignore_reresolution_requests;
+  warm_standby_ = warm_standby;
   // Create policy if needed.
   if (child_policy_ == nullptr) {
     child_policy_ = CreateChildPolicyLocked(priority_policy_->args_);
@@ -680,9 +697,22 @@ void PriorityLb::ChildPriority::OnFailoverTimerLocked(grpc_error_handle error) {
   GRPC_ERROR_UNREF(error);
 }
 
-void PriorityLb::ChildPriority::DeactivateLocked() {
+void PriorityLb::ChildPriority::DeactivateLocked(bool allow_warm_standby) {
   // If already deactivated, don't do it again.
   if (deactivation_timer_callback_pending_) return;
+  if (allow_warm_standby && warm_standby_) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_priority_trace)) {
+      gpr_log(GPR_INFO,
+              "[priority_lb %p] child %s (%p): deactivating -- entering warm "
+              "standby",
+              priority_policy_.get(), name_.c_str(), this);
+    }
+    MaybeCancelFailoverTimerLocked();
+    // Keep the child's subchannels connected so that failing over back to
+    // this priority is just a picker swap.
+    child_policy_->ExitIdleLocked();
+    return;
+  }
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_priority_trace)) {
     gpr_log(GPR_INFO,
             "[priority_lb %p] child %s (%p): deactivating -- will remove in %d "
@@ -840,6 +870,19 @@ class PriorityLbFactory : public LoadBalancingPolicyFactory {
                                  "be type boolean")));
               }
             }
+            bool warm_standby = false;
+            // If present, warm_standby must be of type boolean.
+            auto it4 = element.object_value().find("warm_standby");
+            if (it4 != element.object_value().end()) {
+              if (it4->second.type() == Json::Type::JSON_TRUE) {
+                warm_standby = true;
+              } else if (it4->second.type() != Json::Type::JSON_FALSE) {
+                error_list.push_back(GRPC_ERROR_CREATE_FROM_CPP_STRING(
+                    absl::StrCat("field:children key:", child_name,
+                                 " field:warm_standby:should be type "
+                                 "boolean")));
+              }
+            }
             if (config == nullptr) {
               GPR_DEBUG_ASSERT(parse_error != GRPC_ERROR_NONE);
               error_list.push_back(
@@ -851,6 +894,7 @@ class PriorityLbFactory : public LoadBalancingPolicyFactory {
             children[child_name].config = std::move(config);
             children[child_name].ignore_reresolution_requests =
                 ignore_resolution_requests;
+            children[child_name].warm_standby = warm_standby;
           }
         }
       }
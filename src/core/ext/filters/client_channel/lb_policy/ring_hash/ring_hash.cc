@@ -19,6 +19,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <map>
+#include <set>
+
 #include "absl/strings/numbers.h"
 #include "absl/strings/str_cat.h"
 #define XXH_INLINE_ALL
@@ -209,7 +212,6 @@ class RingHash : public LoadBalancingPolicy {
 
    private:
     struct RingEntry {
-      uint64_t hash;
       RefCountedPtr<SubchannelInterface> subchannel;
       grpc_connectivity_state connectivity_state;
     };
@@ -254,9 +256,18 @@ class RingHash : public LoadBalancingPolicy {
       absl::InlinedVector<RefCountedPtr<SubchannelInterface>, 10> subchannels_;
     };
 
+    // Returns the index of the first ring entry whose hash owns h.  Cheap
+    // enough to call once per key, so callers holding a picker ref can
+    // resolve many request hashes against one ring.
+    size_t FindFirstIndex(uint64_t h) const;
+
     RefCountedPtr<RingHash> parent_;
 
-    // A ring of subchannels.
+    // A ring of subchannels.  The hashes are kept in a separate, parallel
+    // array so that the binary search in Pick() walks a dense array of
+    // uint64s instead of pulling whole ring entries into cache:
+    // ring_hashes_[i] is the hash of ring_[i], sorted ascending.
+    std::vector<uint64_t> ring_hashes_;
     std::vector<RingEntry> ring_;
   };
 
@@ -269,6 +280,15 @@ class RingHash : public LoadBalancingPolicy {
   OrphanablePtr<RingHashSubchannelList> subchannel_list_;
   // indicating if we are shutting down.
   bool shutdown_ = false;
+
+  // Cache of per-address ring hashes, written only from the WorkSerializer
+  // (pickers are constructed there).  Entry i of an address's vector holds
+  // XXH64("<address>_<i>").  Ring rebuilds extend a vector only when an
+  // address needs more hashes than any previous ring gave it, so the common
+  // rebuild -- a connectivity state change with an unchanged address list --
+  // rehashes nothing, and an address list update rehashes only the new
+  // addresses.
+  std::map<std::string, std::vector<uint64_t>> address_hash_cache_;
 };
 
 //
@@ -329,48 +349,81 @@ RingHash::Picker::Picker(RefCountedPtr<RingHash> parent,
       static_cast<double>(max_ring_size));
   // Reserve memory for the entire ring up front.
   const uint64_t ring_size = std::ceil(scale);
-  ring_.reserve(ring_size);
+  struct RingItem {
+    uint64_t hash;
+    size_t subchannel_index;
+  };
+  std::vector<RingItem> items;
+  items.reserve(ring_size);
   // Populate the hash ring by walking through the (host, weight) pairs in
   // normalized_host_weights, and generating (scale * weight) hashes for each
   // host. Since these aren't necessarily whole numbers, we maintain running
-  // sums -- current_hashes and target_hashes -- which allows us to populate the
-  // ring in a mostly stable way.
+  // sums -- current_hashes and target_hashes -- which allows us to populate
+  // the ring in a mostly stable way. Hashes are pulled from the parent's
+  // per-address cache and computed only on a miss, so a rebuild triggered by
+  // a connectivity state change does no hashing at all.
   absl::InlinedVector<char, 196> hash_key_buffer;
   double current_hashes = 0.0;
   double target_hashes = 0.0;
   uint64_t min_hashes_per_host = ring_size;
   uint64_t max_hashes_per_host = 0;
+  std::vector<grpc_connectivity_state> subchannel_states(num_subchannels);
   for (size_t i = 0; i < num_subchannels; ++i) {
     const std::string& address_string = address_weights[i].address;
+    std::vector<uint64_t>& cached_hashes =
+        parent_->address_hash_cache_[address_string];
     hash_key_buffer.assign(address_string.begin(), address_string.end());
     hash_key_buffer.emplace_back('_');
     auto offset_start = hash_key_buffer.end();
     target_hashes += scale * address_weights[i].normalized_weight;
     size_t count = 0;
-    auto current_state =
+    subchannel_states[i] =
         subchannel_list->subchannel(i)->subchannel()->CheckConnectivityState();
     while (current_hashes < target_hashes) {
-      const std::string count_str = absl::StrCat(count);
-      hash_key_buffer.insert(offset_start, count_str.begin(), count_str.end());
-      absl::string_view hash_key(hash_key_buffer.data(),
-                                 hash_key_buffer.size());
-      const uint64_t hash = XXH64(hash_key.data(), hash_key.size(), 0);
-      ring_.push_back({hash,
-                       subchannel_list->subchannel(i)->subchannel()->Ref(),
-                       current_state});
+      if (count == cached_hashes.size()) {
+        const std::string count_str = absl::StrCat(count);
+        hash_key_buffer.insert(offset_start, count_str.begin(),
+                               count_str.end());
+        absl::string_view hash_key(hash_key_buffer.data(),
+                                   hash_key_buffer.size());
+        cached_hashes.push_back(XXH64(hash_key.data(), hash_key.size(), 0));
+        hash_key_buffer.erase(offset_start, hash_key_buffer.end());
+      }
+      items.push_back({cached_hashes[count], i});
       ++count;
       ++current_hashes;
-      hash_key_buffer.erase(offset_start, hash_key_buffer.end());
     }
     min_hashes_per_host =
         std::min(static_cast<uint64_t>(i), min_hashes_per_host);
     max_hashes_per_host =
         std::max(static_cast<uint64_t>(i), max_hashes_per_host);
   }
-  std::sort(ring_.begin(), ring_.end(),
-            [](const RingEntry& lhs, const RingEntry& rhs) -> bool {
+  // Drop cached hashes for addresses that are no longer present.
+  std::set<absl::string_view> current_addresses;
+  for (const AddressWeight& address_weight : address_weights) {
+    current_addresses.insert(address_weight.address);
+  }
+  for (auto it = parent_->address_hash_cache_.begin();
+       it != parent_->address_hash_cache_.end();) {
+    if (current_addresses.find(it->first) == current_addresses.end()) {
+      it = parent_->address_hash_cache_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  std::sort(items.begin(), items.end(),
+            [](const RingItem& lhs, const RingItem& rhs) -> bool {
               return lhs.hash < rhs.hash;
             });
+  ring_hashes_.reserve(items.size());
+  ring_.reserve(items.size());
+  for (const RingItem& item : items) {
+    ring_hashes_.push_back(item.hash);
+    ring_.push_back({subchannel_list->subchannel(item.subchannel_index)
+                         ->subchannel()
+                         ->Ref(),
+                     subchannel_states[item.subchannel_index]});
+  }
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_ring_hash_trace)) {
     gpr_log(GPR_INFO,
             "[RH %p picker %p] created picker from subchannel_list=%p "
@@ -379,28 +432,21 @@ RingHash::Picker::Picker(RefCountedPtr<RingHash> parent,
   }
 }
 
-RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
-  auto hash =
-      args.call_state->ExperimentalGetCallAttribute(kRequestRingHashAttribute);
-  uint64_t h;
-  if (!absl::SimpleAtoi(hash, &h)) {
-    return PickResult::Fail(
-        absl::InternalError("xds ring hash value is not a number"));
-  }
+size_t RingHash::Picker::FindFirstIndex(uint64_t h) const {
   // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
   // (ketama_get_server) NOTE: The algorithm depends on using signed integers
   // for lowp, highp, and first_index. Do not change them!
   int64_t lowp = 0;
-  int64_t highp = ring_.size();
+  int64_t highp = ring_hashes_.size();
   int64_t first_index = 0;
   while (true) {
     first_index = (lowp + highp) / 2;
-    if (first_index == static_cast<int64_t>(ring_.size())) {
+    if (first_index == static_cast<int64_t>(ring_hashes_.size())) {
       first_index = 0;
       break;
     }
-    uint64_t midval = ring_[first_index].hash;
-    uint64_t midval1 = first_index == 0 ? 0 : ring_[first_index - 1].hash;
+    uint64_t midval = ring_hashes_[first_index];
+    uint64_t midval1 = first_index == 0 ? 0 : ring_hashes_[first_index - 1];
     if (h <= midval && h > midval1) {
       break;
     }
@@ -414,6 +460,18 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
       break;
     }
   }
+  return static_cast<size_t>(first_index);
+}
+
+RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
+  auto hash =
+      args.call_state->ExperimentalGetCallAttribute(kRequestRingHashAttribute);
+  uint64_t h;
+  if (!absl::SimpleAtoi(hash, &h)) {
+    return PickResult::Fail(
+        absl::InternalError("xds ring hash value is not a number"));
+  }
+  const size_t first_index = FindFirstIndex(h);
   OrphanablePtr<SubchannelConnectionAttempter> subchannel_connection_attempter;
   auto ScheduleSubchannelConnectionAttempt =
       [&](RefCountedPtr<SubchannelInterface> subchannel) {
@@ -101,6 +101,13 @@ class SubchannelData {
     return connectivity_state_;
   }
 
+  // Returns true if a connectivity watch is in progress (i.e.,
+  // StartConnectivityWatchLocked() has been called and the watch has
+  // not yet been cancelled).
+  bool connectivity_watch_pending() const {
+    return pending_watcher_ != nullptr;
+  }
+
   // Resets the connection backoff.
   // TODO(roth): This method should go away when we move the backoff
   // code out of the subchannel and into the LB policies.
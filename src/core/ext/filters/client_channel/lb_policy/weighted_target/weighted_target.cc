@@ -50,6 +50,20 @@ constexpr char kWeightedTarget[] = "weighted_target_experimental";
 // the config.
 constexpr int kChildRetentionIntervalMs = 15 * 60 * 1000;
 
+// Cheap thread-local PRNG for picking a child.  rand() takes a
+// process-wide lock in common libc implementations, which shows up in
+// profiles of the pick path on many-core clients.
+uint32_t PickRandom() {
+  thread_local uint64_t state =
+      gpr_now(GPR_CLOCK_MONOTONIC).tv_nsec ^
+      reinterpret_cast<uintptr_t>(&state);
+  // xorshift64*
+  state ^= state >> 12;
+  state ^= state << 25;
+  state ^= state >> 27;
+  return static_cast<uint32_t>((state * 0x2545F4914F6CDD1Dull) >> 32);
+}
+
 // Config for weighted_target LB policy.
 class WeightedTargetLbConfig : public LoadBalancingPolicy::Config {
  public:
@@ -210,8 +224,11 @@ class WeightedTargetLb : public LoadBalancingPolicy {
 
 WeightedTargetLb::PickResult WeightedTargetLb::WeightedPicker::Pick(
     PickArgs args) {
+  // Fast path: with a single ready child (the common case of one
+  // locality), no random number or range search is needed.
+  if (pickers_.size() == 1) return pickers_[0].second->Pick(args);
   // Generate a random number in [0, total weight).
-  const uint32_t key = rand() % pickers_[pickers_.size() - 1].first;
+  const uint32_t key = PickRandom() % pickers_[pickers_.size() - 1].first;
   // Find the index in pickers_ corresponding to key.
   size_t mid = 0;
   size_t start_index = 0;
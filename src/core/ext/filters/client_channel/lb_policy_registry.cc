@@ -28,6 +28,7 @@
 #include "absl/strings/str_join.h"
 
 #include "src/core/lib/gpr/string.h"
+#include "src/core/lib/surface/init.h"
 
 namespace grpc_core {
 
@@ -92,6 +93,8 @@ void LoadBalancingPolicyRegistry::Builder::RegisterLoadBalancingPolicyFactory(
 OrphanablePtr<LoadBalancingPolicy>
 LoadBalancingPolicyRegistry::CreateLoadBalancingPolicy(
     const char* name, LoadBalancingPolicy::Args args) {
+  // LB policy factories are registered by plugins, which load lazily.
+  grpc_ensure_plugins_loaded();
   GPR_ASSERT(g_state != nullptr);
   // Find factory.
   LoadBalancingPolicyFactory* factory =
@@ -103,6 +106,7 @@ LoadBalancingPolicyRegistry::CreateLoadBalancingPolicy(
 
 bool LoadBalancingPolicyRegistry::LoadBalancingPolicyExists(
     const char* name, bool* requires_config) {
+  grpc_ensure_plugins_loaded();
   GPR_ASSERT(g_state != nullptr);
   auto* factory = g_state->GetLoadBalancingPolicyFactory(name);
   if (factory == nullptr) {
@@ -164,6 +168,7 @@ RefCountedPtr<LoadBalancingPolicy::Config>
 LoadBalancingPolicyRegistry::ParseLoadBalancingConfig(
     const Json& json, grpc_error_handle* error) {
   GPR_DEBUG_ASSERT(error != nullptr && *error == GRPC_ERROR_NONE);
+  grpc_ensure_plugins_loaded();
   GPR_ASSERT(g_state != nullptr);
   Json::Object::const_iterator policy;
   *error = ParseLoadBalancingConfigHelper(json, &policy);
@@ -23,6 +23,9 @@
 #include <string.h>
 #include <sys/types.h>
 
+#include <map>
+#include <string>
+
 #include <address_sorting/address_sorting.h>
 #include <ares.h>
 
@@ -33,6 +36,7 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
+#include <grpc/support/sync.h>
 #include <grpc/support/time.h>
 
 #include "src/core/ext/filters/client_channel/resolver/dns/c_ares/grpc_ares_ev_driver.h"
@@ -78,6 +82,18 @@ struct grpc_ares_request {
 
   /** the errors explaining query failures, appended to in query callbacks */
   grpc_error_handle error;
+
+  /** key under which this request is registered as a coalescing leader, or
+      null if it is not registered (see ares_coalesce_register_locked) */
+  char* coalesce_key;
+  /** the identical in-flight request this request is parked on, if any */
+  struct grpc_ares_request* coalesce_leader;
+  /** requests parked on this request, waiting for its result */
+  struct grpc_ares_request* coalesce_followers;
+  /** next request in the leader's follower list */
+  struct grpc_ares_request* coalesce_next;
+  /** true if this request was parked on an identical in-flight request */
+  bool coalesced;
 };
 
 typedef struct fd_node {
@@ -594,6 +610,133 @@ void grpc_cares_wrapper_address_sorting_sort(const grpc_ares_request* r,
   }
 }
 
+/*
+ * In-flight query coalescing.
+ *
+ * Many channels resolving the same target at roughly the same time (e.g. a
+ * large number of channels created at process startup) would otherwise each
+ * run their own full set of queries over their own ares channel. Instead,
+ * the first request for a given (dns server, name, port, query set) tuple
+ * becomes the leader and later identical requests are parked on it as
+ * followers; when the leader finishes, its results (or error) are copied
+ * out to every follower.
+ */
+
+static gpr_once g_coalesce_init = GPR_ONCE_INIT;
+static gpr_mu g_coalesce_mu;
+/* maps coalescing key to the in-flight leader request; guarded by
+   g_coalesce_mu */
+static std::map<std::string, grpc_ares_request*>* g_inflight_requests;
+
+static void ares_coalesce_init(void) {
+  gpr_mu_init(&g_coalesce_mu);
+  g_inflight_requests = new std::map<std::string, grpc_ares_request*>();
+}
+
+static std::string ares_coalesce_key(const char* dns_server, const char* name,
+                                     const char* default_port,
+                                     bool lookup_balancers,
+                                     bool lookup_service_config,
+                                     int query_timeout_ms) {
+  return absl::StrFormat("%s\n%s\n%s\n%d%d\n%d",
+                         dns_server == nullptr ? "" : dns_server, name,
+                         default_port == nullptr ? "" : default_port,
+                         lookup_balancers, lookup_service_config,
+                         query_timeout_ms);
+}
+
+/* Returns true if \a r was parked as a follower of an identical in-flight
+   request, in which case no queries should be started for it. Otherwise
+   registers \a r as the leader for \a key and returns false. */
+static bool ares_coalesce_register_locked(grpc_ares_request* r,
+                                          const std::string& key) {
+  gpr_once_init(&g_coalesce_init, ares_coalesce_init);
+  gpr_mu_lock(&g_coalesce_mu);
+  auto it = g_inflight_requests->find(key);
+  if (it != g_inflight_requests->end()) {
+    grpc_ares_request* leader = it->second;
+    r->coalesced = true;
+    r->coalesce_leader = leader;
+    r->coalesce_next = leader->coalesce_followers;
+    leader->coalesce_followers = r;
+    gpr_mu_unlock(&g_coalesce_mu);
+    GRPC_CARES_TRACE_LOG("request:%p coalesced with in-flight request:%p", r,
+                         leader);
+    return true;
+  }
+  r->coalesce_key = gpr_strdup(key.c_str());
+  (*g_inflight_requests)[key] = r;
+  gpr_mu_unlock(&g_coalesce_mu);
+  return false;
+}
+
+/* Unregisters leader \a r and completes any followers parked on it with a
+   copy of its results. Each follower's on_done closure gets its own
+   reference to \a error. No-op if \a r was never registered as a leader. */
+static void ares_coalesce_complete_locked(grpc_ares_request* r,
+                                          grpc_error_handle error) {
+  if (r->coalesce_key == nullptr) return;
+  gpr_mu_lock(&g_coalesce_mu);
+  g_inflight_requests->erase(r->coalesce_key);
+  grpc_ares_request* followers = r->coalesce_followers;
+  r->coalesce_followers = nullptr;
+  /* Detach the followers from the leader while holding the lock so that a
+     concurrent cancellation of a follower never touches the leader after
+     its owner has been given on_done and may have freed it. */
+  for (grpc_ares_request* f = followers; f != nullptr; f = f->coalesce_next) {
+    f->coalesce_leader = nullptr;
+  }
+  gpr_mu_unlock(&g_coalesce_mu);
+  gpr_free(r->coalesce_key);
+  r->coalesce_key = nullptr;
+  while (followers != nullptr) {
+    grpc_ares_request* f = followers;
+    followers = f->coalesce_next;
+    GRPC_CARES_TRACE_LOG("request:%p completing coalesced request:%p", r, f);
+    if (r->addresses_out != nullptr && *r->addresses_out != nullptr) {
+      *f->addresses_out =
+          absl::make_unique<ServerAddressList>(**r->addresses_out);
+    }
+    if (f->balancer_addresses_out != nullptr &&
+        r->balancer_addresses_out != nullptr &&
+        *r->balancer_addresses_out != nullptr) {
+      *f->balancer_addresses_out =
+          absl::make_unique<ServerAddressList>(**r->balancer_addresses_out);
+    }
+    if (f->service_config_json_out != nullptr &&
+        r->service_config_json_out != nullptr &&
+        *r->service_config_json_out != nullptr) {
+      *f->service_config_json_out = gpr_strdup(*r->service_config_json_out);
+    }
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, f->on_done, GRPC_ERROR_REF(error));
+  }
+}
+
+/* If \a r is a follower, detaches it from its leader (scheduling its on_done
+   with a cancelled error if the leader had not already completed it) and
+   returns true. Returns false for non-coalesced requests. */
+static bool ares_coalesce_maybe_cancel_follower(grpc_ares_request* r) {
+  if (!r->coalesced) return false;
+  bool unlinked = false;
+  gpr_mu_lock(&g_coalesce_mu);
+  grpc_ares_request* leader = r->coalesce_leader;
+  if (leader != nullptr) {
+    grpc_ares_request** prev = &leader->coalesce_followers;
+    while (*prev != nullptr && *prev != r) prev = &(*prev)->coalesce_next;
+    if (*prev == r) {
+      *prev = r->coalesce_next;
+      unlinked = true;
+    }
+    r->coalesce_leader = nullptr;
+  }
+  gpr_mu_unlock(&g_coalesce_mu);
+  if (unlinked) {
+    GRPC_CARES_TRACE_LOG("request:%p cancelled while coalesced", r);
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, r->on_done, GRPC_ERROR_CANCELLED);
+  }
+  return true;
+}
+
 static void grpc_ares_request_ref_locked(grpc_ares_request* r) {
   r->pending_queries++;
 }
@@ -623,6 +766,7 @@ void grpc_ares_complete_request_locked(grpc_ares_request* r) {
       grpc_cares_wrapper_address_sorting_sort(r, balancer_addresses);
     }
   }
+  ares_coalesce_complete_locked(r, r->error);
   grpc_core::ExecCtx::Run(DEBUG_LOCATION, r->on_done, r->error);
 }
 
@@ -921,6 +1065,7 @@ void grpc_dns_lookup_ares_continue_after_check_localhost_and_ip_literals_locked(
   return;
 
 error_cleanup:
+  ares_coalesce_complete_locked(r, error);
   grpc_core::ExecCtx::Run(DEBUG_LOCATION, r->on_done, error);
 }
 
@@ -1091,6 +1236,15 @@ static grpc_ares_request* grpc_dns_lookup_ares_locked_impl(
     r->balancer_addresses_out = nullptr;
     r->service_config_json_out = nullptr;
   }
+  // Coalesce with an identical in-flight request, if there is one; the
+  // leader's results will be copied out to this request when it completes.
+  if (ares_coalesce_register_locked(
+          r, ares_coalesce_key(dns_server, name, default_port,
+                               r->balancer_addresses_out != nullptr,
+                               r->service_config_json_out != nullptr,
+                               query_timeout_ms))) {
+    return r;
+  }
   // Look up name using c-ares lib.
   grpc_dns_lookup_ares_continue_after_check_localhost_and_ip_literals_locked(
       r, dns_server, name, default_port, interested_parties, query_timeout_ms,
@@ -1109,6 +1263,7 @@ grpc_ares_request* (*grpc_dns_lookup_ares_locked)(
 
 static void grpc_cancel_ares_request_locked_impl(grpc_ares_request* r) {
   GPR_ASSERT(r != nullptr);
+  if (ares_coalesce_maybe_cancel_follower(r)) return;
   if (r->ev_driver != nullptr) {
     grpc_ares_ev_driver_shutdown_locked(r->ev_driver);
   }
@@ -28,11 +28,14 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/string_util.h>
 
+#include "src/core/ext/filters/client_channel/resolver/sockaddr/sockaddr_resolver.h"
+
 #include "src/core/ext/filters/client_channel/resolver_registry.h"
 #include "src/core/ext/filters/client_channel/server_address.h"
 #include "src/core/lib/address_utils/parse_address.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/gpr/string.h"
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/iomgr/resolve_address.h"
 #include "src/core/lib/iomgr/unix_sockets_posix.h"
 #include "src/core/lib/slice/slice_internal.h"
@@ -88,6 +91,10 @@ bool ParseUri(const URI& uri,
             uri.scheme().c_str());
     return false;
   }
+  // An empty path is allowed: addresses may be supplied out of band via
+  // GRPC_ARG_PRE_RESOLVED_ADDRESSES, in which case the target carries only
+  // the scheme.
+  if (uri.path().empty()) return true;
   // Construct addresses.
   bool errors_found = false;
   for (absl::string_view ith_path : absl::StrSplit(uri.path(), ',')) {
@@ -106,6 +113,24 @@ bool ParseUri(const URI& uri,
 
 OrphanablePtr<Resolver> CreateSockaddrResolver(
     ResolverArgs args, bool parse(const URI& uri, grpc_resolved_address* dst)) {
+  // Fast path: callers that already hold binary sockaddrs pass them via
+  // GRPC_ARG_PRE_RESOLVED_ADDRESSES and skip address string parsing
+  // entirely.
+  RefCountedPtr<PreResolvedAddressList> pre_resolved =
+      PreResolvedAddressList::GetFromArgs(args.args);
+  if (pre_resolved != nullptr) {
+    // Channels sharing the same subchannels may have different pre-resolved
+    // address lists. Strip the arg so that it does not affect subchannel
+    // uniqueness when the args flow down to that layer.
+    const char* arg_to_remove = GRPC_ARG_PRE_RESOLVED_ADDRESSES;
+    grpc_channel_args* stripped_args =
+        grpc_channel_args_copy_and_remove(args.args, &arg_to_remove, 1);
+    args.args = stripped_args;
+    auto resolver = MakeOrphanable<SockaddrResolver>(
+        ServerAddressList(pre_resolved->addresses()), std::move(args));
+    grpc_channel_args_destroy(stripped_args);
+    return resolver;
+  }
   ServerAddressList addresses;
   if (!ParseUri(args.uri, parse, &addresses)) return nullptr;
   // Instantiate resolver.
@@ -175,8 +200,41 @@ class UnixAbstractResolverFactory : public ResolverFactory {
 };
 #endif  // GRPC_HAVE_UNIX_SOCKET
 
+void* PreResolvedAddressListArgCopy(void* p) {
+  auto* list = static_cast<PreResolvedAddressList*>(p);
+  list->Ref().release();
+  return p;
+}
+
+void PreResolvedAddressListArgDestroy(void* p) {
+  auto* list = static_cast<PreResolvedAddressList*>(p);
+  list->Unref();
+}
+
+int PreResolvedAddressListArgCmp(void* a, void* b) {
+  return QsortCompare(a, b);
+}
+
 }  // namespace
 
+const grpc_arg_pointer_vtable PreResolvedAddressList::kChannelArgPointerVtable =
+    {PreResolvedAddressListArgCopy, PreResolvedAddressListArgDestroy,
+     PreResolvedAddressListArgCmp};
+
+grpc_arg PreResolvedAddressList::MakeChannelArg(PreResolvedAddressList* list) {
+  return grpc_channel_arg_pointer_create(
+      const_cast<char*>(GRPC_ARG_PRE_RESOLVED_ADDRESSES), list,
+      &kChannelArgPointerVtable);
+}
+
+RefCountedPtr<PreResolvedAddressList> PreResolvedAddressList::GetFromArgs(
+    const grpc_channel_args* args) {
+  auto* list = grpc_channel_args_find_pointer<PreResolvedAddressList>(
+      args, GRPC_ARG_PRE_RESOLVED_ADDRESSES);
+  if (list == nullptr) return nullptr;
+  return list->Ref();
+}
+
 }  // namespace grpc_core
 
 void grpc_resolver_sockaddr_init() {
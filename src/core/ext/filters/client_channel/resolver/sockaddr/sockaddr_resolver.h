@@ -0,0 +1,63 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_RESOLVER_SOCKADDR_SOCKADDR_RESOLVER_H
+#define GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_RESOLVER_SOCKADDR_SOCKADDR_RESOLVER_H
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/filters/client_channel/server_address.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+
+/// Channel arg (pointer type) containing a PreResolvedAddressList. When
+/// present, the sockaddr resolvers ("ipv4", "ipv6", "unix", ...) take their
+/// addresses directly from it instead of parsing the target URI path, so
+/// callers that already hold binary sockaddrs skip address string parsing
+/// entirely. The target then only needs to carry the scheme, e.g. "ipv4:".
+#define GRPC_ARG_PRE_RESOLVED_ADDRESSES "grpc.internal.pre_resolved_addresses"
+
+namespace grpc_core {
+
+/// A pre-built address list handed to the sockaddr resolvers via channel
+/// args (see \a MakeChannelArg()). Refcounted because channel args require
+/// copyable pointer values.
+class PreResolvedAddressList : public RefCounted<PreResolvedAddressList> {
+ public:
+  static const grpc_arg_pointer_vtable kChannelArgPointerVtable;
+
+  explicit PreResolvedAddressList(ServerAddressList addresses)
+      : addresses_(std::move(addresses)) {}
+
+  const ServerAddressList& addresses() const { return addresses_; }
+
+  // Returns a channel arg containing \a list.
+  static grpc_arg MakeChannelArg(PreResolvedAddressList* list);
+
+  // Returns the address list in \a args, or null if not found.
+  static RefCountedPtr<PreResolvedAddressList> GetFromArgs(
+      const grpc_channel_args* args);
+
+ private:
+  const ServerAddressList addresses_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_RESOLVER_SOCKADDR_SOCKADDR_RESOLVER_H
@@ -18,6 +18,7 @@
 
 #include <grpc/support/port_platform.h>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_join.h"
 #include "absl/strings/str_split.h"
@@ -32,6 +33,7 @@
 #include "src/core/ext/xds/xds_client.h"
 #include "src/core/ext/xds/xds_http_filters.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/transport/timeout_encoding.h"
@@ -242,6 +244,16 @@ class XdsResolver : public Resolver {
     RouteTable route_table_;
     std::map<absl::string_view, RefCountedPtr<ClusterState>> clusters_;
     std::vector<const grpc_channel_filter*> filters_;
+
+    // Memoized path -> route_table_ index for paths whose route selection
+    // is fully determined by the path (see GetCallConfig()). Bounded; a
+    // config update replaces the whole XdsConfigSelector, so the cache
+    // never outlives the route table it indexes into. The transparent
+    // comparator lets lookups use the path string_view without copying it.
+    static constexpr size_t kRouteCacheMaxSize = 128;
+    Mutex route_cache_mu_;
+    absl::flat_hash_map<std::string, size_t> route_cache_
+        ABSL_GUARDED_BY(route_cache_mu_);
   };
 
   void OnListenerUpdate(XdsApi::LdsUpdate listener);
@@ -642,23 +654,55 @@ bool UnderFraction(const uint32_t fraction_per_million) {
 
 ConfigSelector::CallConfig XdsResolver::XdsConfigSelector::GetCallConfig(
     GetCallConfigArgs args) {
-  for (const auto& entry : route_table_) {
-    // Path matching.
-    if (!entry.route.matchers.path_matcher.Match(
-            StringViewFromSlice(*args.path))) {
-      continue;
-    }
-    // Header Matching.
-    if (!HeadersMatch(entry.route.matchers.header_matchers,
-                      args.initial_metadata)) {
-      continue;
-    }
-    // Match fraction check
-    if (entry.route.matchers.fraction_per_million.has_value() &&
-        !UnderFraction(entry.route.matchers.fraction_per_million.value())) {
-      continue;
-    }
-    // Found a route match
+  absl::string_view path = StringViewFromSlice(*args.path);
+  const Route* matched_route = nullptr;
+  {
+    MutexLock lock(&route_cache_mu_);
+    auto cache_it = route_cache_.find(path);
+    if (cache_it != route_cache_.end()) {
+      matched_route = &route_table_[cache_it->second];
+    }
+  }
+  if (matched_route == nullptr) {
+    // A route decision can be memoized only when it depends on nothing
+    // but the path: the matched entry must be free of header matchers
+    // and runtime fractions, and so must every earlier entry whose path
+    // matcher also matched, since such an entry could win for the same
+    // path on a later call.
+    bool cacheable = true;
+    for (size_t i = 0; i < route_table_.size(); ++i) {
+      const auto& entry = route_table_[i];
+      // Path matching.
+      if (!entry.route.matchers.path_matcher.Match(path)) {
+        continue;
+      }
+      // Header Matching.
+      if (!HeadersMatch(entry.route.matchers.header_matchers,
+                        args.initial_metadata)) {
+        cacheable = false;
+        continue;
+      }
+      // Match fraction check
+      if (entry.route.matchers.fraction_per_million.has_value() &&
+          !UnderFraction(entry.route.matchers.fraction_per_million.value())) {
+        cacheable = false;
+        continue;
+      }
+      // Found a route match
+      if (cacheable && entry.route.matchers.header_matchers.empty() &&
+          !entry.route.matchers.fraction_per_million.has_value()) {
+        MutexLock lock(&route_cache_mu_);
+        if (route_cache_.size() < kRouteCacheMaxSize) {
+          route_cache_.emplace(std::string(path), i);
+        }
+      }
+      matched_route = &entry;
+      break;
+    }
+    if (matched_route == nullptr) return CallConfig();
+  }
+  {
+    const auto& entry = *matched_route;
     absl::string_view cluster_name;
     RefCountedPtr<ServiceConfig> method_config;
     if (entry.route.weighted_clusters.empty()) {
@@ -746,7 +790,6 @@ ConfigSelector::CallConfig XdsResolver::XdsConfigSelector::GetCallConfig(
         args.arena->New<XdsCallDispatchController>(it->second->Ref());
     return call_config;
   }
-  return CallConfig();
 }
 
 //
@@ -22,13 +22,24 @@
 
 #include <string.h>
 
+#include <map>
+#include <vector>
+
 #include "absl/container/inlined_vector.h"
+#include "absl/memory/memory.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
+#include "absl/types/optional.h"
 
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
+#include <grpc/support/sync.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/surface/init.h"
 
 namespace grpc_core {
 
@@ -109,6 +120,329 @@ class RegistryState {
 
 static RegistryState* g_state = nullptr;
 
+//
+// Shared resolvers (GRPC_ARG_EXPERIMENTAL_SHARE_RESOLVER)
+//
+
+class SharedResolverState;
+class SharedResolverProxy;
+
+gpr_once g_shared_resolver_once = GPR_ONCE_INIT;
+Mutex* g_shared_resolver_mu = nullptr;
+std::map<std::string, SharedResolverState*>* g_shared_resolvers
+    ABSL_GUARDED_BY(*g_shared_resolver_mu) = nullptr;
+
+void SharedResolverGlobalInit() {
+  g_shared_resolver_mu = new Mutex();
+  g_shared_resolvers = new std::map<std::string, SharedResolverState*>();
+}
+
+// Process-wide state for one shared resolver: the inner resolver, the
+// channels subscribed to it, and the last result it returned. The inner
+// resolver runs under its own work serializer; results are copied and
+// hopped onto each subscriber's serializer, and re-resolution requests
+// from subscribers are coalesced so that N channels to the same target
+// generate the name-service traffic of one.
+class SharedResolverState : public RefCounted<SharedResolverState> {
+ public:
+  SharedResolverState(std::string target, const grpc_channel_args* args);
+  ~SharedResolverState() override;
+
+  grpc_pollset_set* interested_parties() const { return interested_parties_; }
+
+  // Adds \a proxy to the fan-out list, scheduling delivery of the cached
+  // result (if any) on its serializer, and starts the inner resolver on
+  // first use. Called from the proxy's StartLocked().
+  void Subscribe(RefCountedPtr<Resolver> proxy);
+
+  // Called from the proxy's ShutdownLocked(). Removes \a proxy from the
+  // fan-out list; the last proxy takes this state out of the shared map
+  // and shuts down the inner resolver.
+  void RemoveProxy(SharedResolverProxy* proxy);
+
+  // Forwards one re-resolution request to the inner resolver, swallowing
+  // further requests until its next result arrives.
+  void RequestReresolution();
+
+  void ResetBackoff();
+
+  void AddProxyLocked()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(*g_shared_resolver_mu) {
+    ++proxy_count_;
+  }
+
+ private:
+  class InnerResultHandler : public Resolver::ResultHandler {
+   public:
+    explicit InnerResultHandler(RefCountedPtr<SharedResolverState> state)
+        : state_(std::move(state)) {}
+    void ReturnResult(Resolver::Result result) override {
+      state_->OnResult(std::move(result));
+    }
+    void ReturnError(grpc_error_handle error) override {
+      state_->OnError(error);
+    }
+
+   private:
+    RefCountedPtr<SharedResolverState> state_;
+  };
+
+  void StartInnerLocked();
+  void OnResult(Resolver::Result result);
+  void OnError(grpc_error_handle error);
+
+  std::string target_;
+  const grpc_channel_args* args_;
+  std::shared_ptr<WorkSerializer> work_serializer_;
+  grpc_pollset_set* interested_parties_;
+
+  Mutex mu_;
+  std::vector<RefCountedPtr<Resolver>> subscribers_ ABSL_GUARDED_BY(mu_);
+  bool started_ ABSL_GUARDED_BY(mu_) = false;
+  bool reresolution_requested_ ABSL_GUARDED_BY(mu_) = false;
+  absl::optional<Resolver::Result> last_result_ ABSL_GUARDED_BY(mu_);
+
+  // The inner resolver; only touched under work_serializer_. Orphaning it
+  // releases the InnerResultHandler's ref to this state, breaking the
+  // ownership cycle.
+  OrphanablePtr<Resolver> resolver_;
+
+  // Live proxies, including ones that have not started yet; guarded by the
+  // map mutex so that map insertion and removal stay consistent with it.
+  int proxy_count_ ABSL_GUARDED_BY(*g_shared_resolver_mu) = 0;
+};
+
+// Per-channel resolver handed back to the client channel: forwards
+// start/re-resolution/backoff-reset calls to the shared state and relays
+// fanned-out results to the channel's result handler under the channel's
+// work serializer.
+class SharedResolverProxy : public Resolver {
+ public:
+  SharedResolverProxy(RefCountedPtr<SharedResolverState> state,
+                      grpc_pollset_set* pollset_set,
+                      std::shared_ptr<WorkSerializer> work_serializer,
+                      std::unique_ptr<ResultHandler> result_handler)
+      : state_(std::move(state)),
+        pollset_set_(pollset_set),
+        work_serializer_(std::move(work_serializer)),
+        result_handler_(std::move(result_handler)) {
+    grpc_pollset_set_add_pollset_set(state_->interested_parties(),
+                                     pollset_set_);
+  }
+
+  void StartLocked() override { state_->Subscribe(Ref()); }
+
+  void RequestReresolutionLocked() override { state_->RequestReresolution(); }
+
+  void ResetBackoffLocked() override { state_->ResetBackoff(); }
+
+  const std::shared_ptr<WorkSerializer>& work_serializer() const {
+    return work_serializer_;
+  }
+
+  // Delivery entry points used by the shared state's fan-out. Both run
+  // under work_serializer_, like ShutdownLocked(), so checking shutdown_
+  // needs no lock.
+  void DeliverResult(Resolver::Result result) {
+    if (shutdown_) return;
+    result_handler_->ReturnResult(std::move(result));
+  }
+  void DeliverError(grpc_error_handle error) {
+    if (shutdown_) {
+      GRPC_ERROR_UNREF(error);
+      return;
+    }
+    result_handler_->ReturnError(error);
+  }
+
+ private:
+  void ShutdownLocked() override {
+    shutdown_ = true;
+    state_->RemoveProxy(this);
+    grpc_pollset_set_del_pollset_set(state_->interested_parties(),
+                                     pollset_set_);
+  }
+
+  RefCountedPtr<SharedResolverState> state_;
+  grpc_pollset_set* pollset_set_;
+  std::shared_ptr<WorkSerializer> work_serializer_;
+  std::unique_ptr<ResultHandler> result_handler_;
+  bool shutdown_ = false;
+};
+
+SharedResolverState::SharedResolverState(std::string target,
+                                         const grpc_channel_args* args)
+    : target_(std::move(target)),
+      work_serializer_(std::make_shared<WorkSerializer>()),
+      interested_parties_(grpc_pollset_set_create()) {
+  // Strip the share arg so that it neither recurses into resolver creation
+  // nor leaks into resolver results.
+  const char* arg_to_remove = GRPC_ARG_EXPERIMENTAL_SHARE_RESOLVER;
+  args_ = grpc_channel_args_copy_and_remove(args, &arg_to_remove, 1);
+}
+
+SharedResolverState::~SharedResolverState() {
+  grpc_channel_args_destroy(args_);
+  grpc_pollset_set_destroy(interested_parties_);
+}
+
+void SharedResolverState::Subscribe(RefCountedPtr<Resolver> proxy) {
+  auto* subscriber = static_cast<SharedResolverProxy*>(proxy.get());
+  bool start = false;
+  absl::optional<Resolver::Result> cached;
+  {
+    MutexLock lock(&mu_);
+    if (last_result_.has_value()) cached = *last_result_;
+    subscribers_.push_back(proxy);
+    if (!started_) {
+      started_ = true;
+      start = true;
+    }
+  }
+  if (cached.has_value()) {
+    // Deliver the cached result to the new subscriber the same way fresh
+    // results fan out, so that it cannot arrive after a newer one.
+    Resolver::Result result = std::move(*cached);
+    subscriber->work_serializer()->Run(
+        [proxy, result]() mutable {
+          static_cast<SharedResolverProxy*>(proxy.get())
+              ->DeliverResult(std::move(result));
+        },
+        DEBUG_LOCATION);
+  }
+  if (start) {
+    RefCountedPtr<SharedResolverState> self = Ref();
+    work_serializer_->Run([self]() { self->StartInnerLocked(); },
+                          DEBUG_LOCATION);
+  }
+}
+
+void SharedResolverState::StartInnerLocked() {
+  resolver_ = ResolverRegistry::CreateResolver(
+      target_.c_str(), args_, interested_parties_, work_serializer_,
+      absl::make_unique<InnerResultHandler>(Ref()));
+  // Validity of the target was checked when the first proxy was created.
+  GPR_ASSERT(resolver_ != nullptr);
+  resolver_->StartLocked();
+}
+
+void SharedResolverState::OnResult(Resolver::Result result) {
+  std::vector<RefCountedPtr<Resolver>> subscribers;
+  {
+    MutexLock lock(&mu_);
+    reresolution_requested_ = false;
+    last_result_ = result;
+    subscribers = subscribers_;
+  }
+  for (RefCountedPtr<Resolver>& subscriber : subscribers) {
+    Resolver::Result copy = result;
+    auto* proxy = static_cast<SharedResolverProxy*>(subscriber.get());
+    proxy->work_serializer()->Run(
+        [subscriber, copy]() mutable {
+          static_cast<SharedResolverProxy*>(subscriber.get())
+              ->DeliverResult(std::move(copy));
+        },
+        DEBUG_LOCATION);
+  }
+}
+
+void SharedResolverState::OnError(grpc_error_handle error) {
+  std::vector<RefCountedPtr<Resolver>> subscribers;
+  {
+    MutexLock lock(&mu_);
+    subscribers = subscribers_;
+  }
+  for (RefCountedPtr<Resolver>& subscriber : subscribers) {
+    grpc_error_handle subscriber_error = GRPC_ERROR_REF(error);
+    auto* proxy = static_cast<SharedResolverProxy*>(subscriber.get());
+    proxy->work_serializer()->Run(
+        [subscriber, subscriber_error]() {
+          static_cast<SharedResolverProxy*>(subscriber.get())
+              ->DeliverError(subscriber_error);
+        },
+        DEBUG_LOCATION);
+  }
+  GRPC_ERROR_UNREF(error);
+}
+
+void SharedResolverState::RequestReresolution() {
+  {
+    MutexLock lock(&mu_);
+    if (reresolution_requested_) return;  // Coalesced with a pending one.
+    reresolution_requested_ = true;
+  }
+  RefCountedPtr<SharedResolverState> self = Ref();
+  work_serializer_->Run(
+      [self]() {
+        if (self->resolver_ != nullptr) {
+          self->resolver_->RequestReresolutionLocked();
+        }
+      },
+      DEBUG_LOCATION);
+}
+
+void SharedResolverState::ResetBackoff() {
+  RefCountedPtr<SharedResolverState> self = Ref();
+  work_serializer_->Run(
+      [self]() {
+        if (self->resolver_ != nullptr) self->resolver_->ResetBackoffLocked();
+      },
+      DEBUG_LOCATION);
+}
+
+void SharedResolverState::RemoveProxy(SharedResolverProxy* proxy) {
+  bool shutdown_inner = false;
+  {
+    MutexLock map_lock(g_shared_resolver_mu);
+    {
+      MutexLock lock(&mu_);
+      for (auto it = subscribers_.begin(); it != subscribers_.end(); ++it) {
+        if (it->get() == proxy) {
+          subscribers_.erase(it);
+          break;
+        }
+      }
+    }
+    if (--proxy_count_ == 0) {
+      g_shared_resolvers->erase(target_);
+      shutdown_inner = true;
+    }
+  }
+  if (shutdown_inner) {
+    RefCountedPtr<SharedResolverState> self = Ref();
+    work_serializer_->Run([self]() { self->resolver_.reset(); },
+                          DEBUG_LOCATION);
+  }
+}
+
+OrphanablePtr<Resolver> CreateSharedResolverProxy(
+    const char* target, const grpc_channel_args* args,
+    grpc_pollset_set* pollset_set,
+    std::shared_ptr<WorkSerializer> work_serializer,
+    std::unique_ptr<Resolver::ResultHandler> result_handler) {
+  gpr_once_init(&g_shared_resolver_once, SharedResolverGlobalInit);
+  // Canonicalize so that targets differing only by the default prefix
+  // still share.
+  grpc_core::UniquePtr<char> canonical_target =
+      ResolverRegistry::AddDefaultPrefixIfNeeded(target);
+  RefCountedPtr<SharedResolverState> state;
+  {
+    MutexLock lock(g_shared_resolver_mu);
+    auto it = g_shared_resolvers->find(canonical_target.get());
+    if (it == g_shared_resolvers->end()) {
+      state = MakeRefCounted<SharedResolverState>(canonical_target.get(),
+                                                  args);
+      (*g_shared_resolvers)[canonical_target.get()] = state.get();
+    } else {
+      state = it->second->Ref();
+    }
+    state->AddProxyLocked();
+  }
+  return MakeOrphanable<SharedResolverProxy>(std::move(state), pollset_set,
+                                             std::move(work_serializer),
+                                             std::move(result_handler));
+}
+
 }  // namespace
 
 //
@@ -140,11 +474,14 @@ void ResolverRegistry::Builder::RegisterResolverFactory(
 //
 
 ResolverFactory* ResolverRegistry::LookupResolverFactory(const char* scheme) {
+  // Resolver factories are registered by plugins, which load lazily.
+  grpc_ensure_plugins_loaded();
   GPR_ASSERT(g_state != nullptr);
   return g_state->LookupResolverFactory(scheme);
 }
 
 bool ResolverRegistry::IsValidTarget(absl::string_view target) {
+  grpc_ensure_plugins_loaded();
   URI uri;
   std::string canonical_target;
   ResolverFactory* factory =
@@ -157,11 +494,18 @@ OrphanablePtr<Resolver> ResolverRegistry::CreateResolver(
     grpc_pollset_set* pollset_set,
     std::shared_ptr<WorkSerializer> work_serializer,
     std::unique_ptr<Resolver::ResultHandler> result_handler) {
+  grpc_ensure_plugins_loaded();
   GPR_ASSERT(g_state != nullptr);
   ResolverArgs resolver_args;
   ResolverFactory* factory = g_state->FindResolverFactory(
       target, &resolver_args.uri, &resolver_args.uri_string);
   if (factory == nullptr) return nullptr;
+  if (grpc_channel_args_find_bool(args, GRPC_ARG_EXPERIMENTAL_SHARE_RESOLVER,
+                                  false)) {
+    return CreateSharedResolverProxy(target, args, pollset_set,
+                                     std::move(work_serializer),
+                                     std::move(result_handler));
+  }
   if (resolver_args.uri_string.empty()) resolver_args.uri_string = target;
   resolver_args.args = args;
   resolver_args.pollset_set = pollset_set;
@@ -171,6 +515,7 @@ OrphanablePtr<Resolver> ResolverRegistry::CreateResolver(
 }
 
 std::string ResolverRegistry::GetDefaultAuthority(absl::string_view target) {
+  grpc_ensure_plugins_loaded();
   GPR_ASSERT(g_state != nullptr);
   URI uri;
   std::string canonical_target;
@@ -183,6 +528,7 @@ std::string ResolverRegistry::GetDefaultAuthority(absl::string_view target) {
 
 grpc_core::UniquePtr<char> ResolverRegistry::AddDefaultPrefixIfNeeded(
     const char* target) {
+  grpc_ensure_plugins_loaded();
   GPR_ASSERT(g_state != nullptr);
   URI uri;
   std::string canonical_target;
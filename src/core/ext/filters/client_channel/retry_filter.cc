@@ -86,9 +86,15 @@
 // CallAttempt object against the state in the CallData object to see
 // which batches need to be sent on the LB call for a given attempt.
 
+// When hedging is enabled via GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING and a
+// hedgingPolicy is present in the method config, multiple call attempts
+// may be in flight at the same time: a hedging timer starts an
+// additional attempt after each hedging delay, and the first attempt to
+// receive a response from the server wins the call, at which point all
+// other attempts are cancelled in a single batched pass.
+//
 // TODO(roth): In subsequent PRs:
 // - add support for transparent retries (including initial metadata)
-// - implement hedging
 
 // By default, we buffer 256 KiB per RPC for retries.
 // TODO(roth): Do we have any data to suggest a better value?
@@ -209,7 +215,9 @@ class RetryFilter::CallData {
   };
 
   // State associated with each call attempt.
-  class CallAttempt : public RefCounted<CallAttempt> {
+  // Allocated on the arena.
+  class CallAttempt
+      : public RefCounted<CallAttempt, PolymorphicRefCount, kUnrefCallDtor> {
    public:
     explicit CallAttempt(CallData* calld);
     ~CallAttempt() override;
@@ -227,6 +235,17 @@ class RetryFilter::CallData {
     // Cancels the call attempt.
     void CancelFromSurface(grpc_transport_stream_op_batch* cancel_batch);
 
+    // Returns true if all cached send ops that have been started on
+    // this attempt have also completed, so that this attempt can have
+    // no in-flight reads from the send op caches.
+    bool SendOpsCompleted() const;
+
+    // Cancels and abandons this attempt after another hedged attempt
+    // has won the call.  The cancellation batch is added to closures
+    // rather than being run immediately, so that all losing attempts
+    // can be torn down in one batched pass.
+    void AbandonAsLosingHedge(CallCombinerClosureList* closures);
+
    private:
     // State used for starting a retryable batch on the call attempt's LB call.
     // This provides its own grpc_transport_stream_op_batch and other data
@@ -519,6 +538,50 @@ class RetryFilter::CallData {
   static void OnRetryTimer(void* arg, grpc_error_handle error);
   static void OnRetryTimerLocked(void* arg, grpc_error_handle error);
 
+  // Returns true if this call uses a hedging policy.
+  bool hedging_enabled() const {
+    return retry_policy_ != nullptr && retry_policy_->hedged();
+  }
+
+  // Returns true if cached send op data may still be read by abandoned
+  // hedged attempts, in which case freeing it is deferred until the
+  // CallData dtor runs.  Every child batch holds a ref to the call
+  // stack, so by the time the dtor runs, all attempts' batches have
+  // completed and the caches are quiescent.  Note that once this
+  // returns true, it remains true for the rest of the call, since no
+  // new attempts are started after the call is committed or cancelled.
+  bool DeferCachedSendOpFreesForHedging() const {
+    return hedging_enabled() && num_attempts_started_ > 1;
+  }
+
+  // Starts a timer to launch the next hedged attempt after delay.
+  // No-op if another hedged attempt cannot be started (call committed,
+  // max attempts reached, or timer already pending).
+  void MaybeStartHedgingTimer(grpc_millis delay);
+  void MaybeCancelHedgingTimer();
+
+  static void OnHedgingTimer(void* arg, grpc_error_handle error);
+  static void OnHedgingTimerLocked(void* arg, grpc_error_handle error);
+
+  // Returns true if every attempt still in flight has finished
+  // replaying cached send ops.  A new hedged attempt must not start
+  // reading the send op caches while another attempt's transport may
+  // still be writing to them, since ByteStreamCache provides no
+  // synchronization.
+  bool AllAttemptsQuiescentForSends() const;
+
+  // Drops our ref to failed_attempt and schedules the next hedged
+  // attempt.  Failure-driven hedges do not wait out the rest of the
+  // hedging delay; the next attempt is scheduled immediately, or after
+  // server push-back if present.
+  void ScheduleNextHedgedAttempt(CallAttempt* failed_attempt,
+                                 grpc_millis server_pushback_ms);
+
+  // Cancels and abandons all attempts other than winning_attempt, which
+  // becomes the current attempt.  The cancellations are run as a single
+  // batched closure list.  Called when the call commits.
+  void CancelOutstandingHedges(CallAttempt* winning_attempt);
+
   OrphanablePtr<ClientChannel::LoadBalancedCall> CreateLoadBalancedCall(
       ConfigSelector::CallDispatchController* call_dispatch_controller);
 
@@ -541,11 +604,15 @@ class RetryFilter::CallData {
 
   RefCountedPtr<CallStackDestructionBarrier> call_stack_destruction_barrier_;
 
-  // TODO(roth): As part of implementing hedging, we will need to maintain a
-  // list of all pending attempts, so that we can cancel them all if the call
-  // gets cancelled.
+  // The current (most recently started) call attempt.  Batches from the
+  // surface are routed to this attempt.
   RefCountedPtr<CallAttempt> call_attempt_;
 
+  // Older hedged attempts that are still in flight.  One of these may
+  // still win the call, at which point it is promoted back to
+  // call_attempt_ and all other attempts are cancelled.
+  absl::InlinedVector<RefCountedPtr<CallAttempt>, 2> outstanding_hedges_;
+
   // LB call used when we've committed to a call attempt and the retry
   // state for that attempt is no longer needed.  This provides a fast
   // path for long-running streaming calls that minimizes overhead.
@@ -562,12 +629,16 @@ class RetryFilter::CallData {
   bool pending_send_message_ : 1;
   bool pending_send_trailing_metadata_ : 1;
 
-  // Retry state.
+  // Retry/hedging state.
   bool retry_committed_ : 1;
   bool retry_timer_pending_ : 1;
+  bool hedging_timer_pending_ : 1;
   int num_attempts_completed_ = 0;
+  int num_attempts_started_ = 0;
   grpc_timer retry_timer_;
   grpc_closure retry_closure_;
+  grpc_timer hedging_timer_;
+  grpc_closure hedging_closure_;
 
   // Cached data for retrying send ops.
   // send_initial_metadata
@@ -591,10 +662,13 @@ class RetryFilter::CallData {
   // Note: We inline the cache for the first 3 send_message ops and use
   // dynamic allocation after that.  This number was essentially picked
   // at random; it could be changed in the future to tune performance.
-  // TODO(roth): As part of implementing hedging, we may need some
-  // synchronization here, since ByteStreamCache does not provide any
-  // synchronization, so it's not safe to have multiple
-  // CachingByteStreams read from the same ByteStreamCache concurrently.
+  // Note: ByteStreamCache provides no synchronization, so it's not safe
+  // to have multiple CachingByteStreams read from the same
+  // ByteStreamCache concurrently.  For hedged calls, we therefore only
+  // start a new attempt once every attempt in flight has completed the
+  // send ops it has started (see AllAttemptsQuiescentForSends()), which
+  // guarantees that a cache is fully populated and immutable before a
+  // second reader is created.
   absl::InlinedVector<ByteStreamCache*, 3> send_messages_;
   // send_trailing_metadata
   bool seen_send_trailing_metadata_ = false;
@@ -712,10 +786,9 @@ RetryFilter::CallData::CallAttempt::~CallAttempt() {
 }
 
 void RetryFilter::CallData::CallAttempt::FreeCachedSendOpDataAfterCommit() {
-  // TODO(roth): When we implement hedging, this logic will need to get
-  // a bit more complex, because there may be other (now abandoned) call
-  // attempts still using this data.  We may need to do some sort of
-  // ref-counting instead.
+  // If other hedged attempts were started, they may still be reading
+  // the cached data, so freeing is deferred to the CallData dtor.
+  if (calld_->DeferCachedSendOpFreesForHedging()) return;
   if (completed_send_initial_metadata_) {
     calld_->FreeCachedSendInitialMetadata();
   }
@@ -727,6 +800,32 @@ void RetryFilter::CallData::CallAttempt::FreeCachedSendOpDataAfterCommit() {
   }
 }
 
+bool RetryFilter::CallData::CallAttempt::SendOpsCompleted() const {
+  return (!calld_->seen_send_initial_metadata_ ||
+          completed_send_initial_metadata_) &&
+         completed_send_message_count_ == calld_->send_messages_.size() &&
+         (!calld_->seen_send_trailing_metadata_ ||
+          completed_send_trailing_metadata_);
+}
+
+void RetryFilter::CallData::CallAttempt::AbandonAsLosingHedge(
+    CallCombinerClosureList* closures) {
+  if (abandoned_) return;
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+    gpr_log(GPR_INFO,
+            "chand=%p calld=%p attempt=%p: cancelling losing hedged attempt",
+            calld_->chand_, calld_, this);
+  }
+  MaybeCancelPerAttemptRecvTimer();
+  AddBatchForCancelOp(
+      grpc_error_set_int(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+                             "hedged attempt cancelled: another attempt "
+                             "won the call"),
+                         GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_CANCELLED),
+      closures);
+  Abandon();
+}
+
 bool RetryFilter::CallData::CallAttempt::PendingBatchContainsUnstartedSendOps(
     PendingBatch* pending) {
   if (pending->batch->on_complete == nullptr) return false;
@@ -756,11 +855,11 @@ bool RetryFilter::CallData::CallAttempt::HaveSendOpsToReplay() {
 
 void RetryFilter::CallData::CallAttempt::MaybeSwitchToFastPath() {
   // If we're not yet committed, we can't switch yet.
-  // TODO(roth): As part of implementing hedging, this logic needs to
-  // check that *this* call attempt is the one that we've committed to.
-  // Might need to replace abandoned_ with an enum indicating whether we're
-  // in flight, abandoned, or the winning call attempt.
   if (!calld_->retry_committed_) return;
+  // If this is not the attempt that won the call, we can't switch.
+  // (When the call commits to a hedged attempt, that attempt is
+  // promoted to calld_->call_attempt_ and all others are abandoned.)
+  if (calld_->call_attempt_.get() != this) return;
   // If we've already switched to fast path, there's nothing to do here.
   if (calld_->committed_call_ != nullptr) return;
   // If the perAttemptRecvTimeout timer is pending, we can't switch yet.
@@ -1315,10 +1414,9 @@ RetryFilter::CallData::CallAttempt::BatchData::~BatchData() {
 void RetryFilter::CallData::CallAttempt::BatchData::
     FreeCachedSendOpDataForCompletedBatch() {
   auto* calld = call_attempt_->calld_;
-  // TODO(roth): When we implement hedging, this logic will need to get
-  // a bit more complex, because there may be other (now abandoned) call
-  // attempts still using this data.  We may need to do some sort of
-  // ref-counting instead.
+  // If other hedged attempts were started, they may still be reading
+  // the cached data, so freeing is deferred to the CallData dtor.
+  if (calld->DeferCachedSendOpFreesForHedging()) return;
   if (batch_.send_initial_metadata) {
     calld->FreeCachedSendInitialMetadata();
   }
@@ -1707,8 +1805,15 @@ void RetryFilter::CallData::CallAttempt::BatchData::RecvTrailingMetadataReady(
   grpc_millis server_pushback_ms = -1;
   if (call_attempt->ShouldRetry(status, is_lb_drop, server_pushback_md,
                                 &server_pushback_ms)) {
-    // Start retry timer.
-    calld->StartRetryTimer(server_pushback_ms);
+    if (calld->hedging_enabled()) {
+      // A non-fatal status on a hedged attempt does not use backoff;
+      // the next hedged attempt is scheduled immediately (or after
+      // server push-back).  Other attempts may still be in flight.
+      calld->ScheduleNextHedgedAttempt(call_attempt, server_pushback_ms);
+    } else {
+      // Start retry timer.
+      calld->StartRetryTimer(server_pushback_ms);
+    }
     // Cancel call attempt.
     CallCombinerClosureList closures;
     call_attempt->AddBatchForCancelOp(
@@ -2120,9 +2225,15 @@ RetryFilter::CallData::CallData(RetryFilter* chand,
       pending_send_message_(false),
       pending_send_trailing_metadata_(false),
       retry_committed_(false),
-      retry_timer_pending_(false) {}
+      retry_timer_pending_(false),
+      hedging_timer_pending_(false) {}
 
 RetryFilter::CallData::~CallData() {
+  // If freeing of cached send op data was deferred because abandoned
+  // hedged attempts might still have been reading it, free it now; all
+  // child batches have completed by this point, since each one holds a
+  // ref to the call stack.
+  if (DeferCachedSendOpFreesForHedging()) FreeAllCachedSendOpData();
   grpc_slice_unref_internal(path_);
   // Make sure there are no remaining pending batches.
   for (size_t i = 0; i < GPR_ARRAY_SIZE(pending_batches_); ++i) {
@@ -2150,13 +2261,13 @@ void RetryFilter::CallData::StartTransportStreamOpBatch(
     // the cancellation down to that attempt.  When the call fails, it
     // will not be retried, because we have committed it here.
     if (call_attempt_ != nullptr) {
+      // Note: If there are hedged attempts in flight, RetryCommit()
+      // cancels and abandons all of them other than the current one.
+      // Those cancellations use internal batches, so the on_complete
+      // from this batch is propagated back to the surface as soon as
+      // the current attempt's cancellation completes, without waiting
+      // for the others.
       RetryCommit(call_attempt_.get());
-      // TODO(roth): When implementing hedging, this will get more
-      // complex, because instead of just passing the batch down to a
-      // single call attempt, we'll need to cancel multiple call
-      // attempts and wait for the cancellation on_complete from each call
-      // attempt before we propagate the on_complete from this batch
-      // back to the surface.
       // Note: This will release the call combiner.
       call_attempt_->CancelFromSurface(batch);
       return;
@@ -2174,6 +2285,8 @@ void RetryFilter::CallData::StartTransportStreamOpBatch(
       grpc_timer_cancel(&retry_timer_);
       FreeAllCachedSendOpData();
     }
+    // Cancel hedging timer.
+    MaybeCancelHedgingTimer();
     // Fail pending batches.
     PendingBatchesFail(GRPC_ERROR_REF(cancel_error));
     // Note: This will release the call combiner.
@@ -2183,9 +2296,12 @@ void RetryFilter::CallData::StartTransportStreamOpBatch(
   }
   // Add the batch to the pending list.
   PendingBatch* pending = PendingBatchesAdd(batch);
-  // If the timer is pending, yield the call combiner and wait for it to
-  // run, since we don't want to start another call attempt until it does.
-  if (retry_timer_pending_) {
+  // If the retry timer is pending, yield the call combiner and wait for
+  // it to run, since we don't want to start another call attempt until
+  // it does.  Ditto for the hedging timer if there is no attempt in
+  // flight to route the batch to.
+  if (retry_timer_pending_ ||
+      (hedging_timer_pending_ && call_attempt_ == nullptr)) {
     GRPC_CALL_COMBINER_STOP(call_combiner_,
                             "added pending batch while retry timer pending");
     return;
@@ -2273,7 +2389,22 @@ RetryFilter::CallData::CreateLoadBalancedCall(
 }
 
 void RetryFilter::CallData::CreateCallAttempt() {
-  call_attempt_ = MakeRefCounted<CallAttempt>(this);
+  // For hedged calls, the previous attempt (if any) stays in flight:
+  // its response may still come back first and win the call.
+  if (call_attempt_ != nullptr) {
+    GPR_ASSERT(hedging_enabled());
+    outstanding_hedges_.push_back(std::move(call_attempt_));
+  }
+  // The attempt lives on the arena, so a call that never retries pays no
+  // heap allocation for its replay state; the number of attempts is
+  // bounded by the retry policy's maxAttempts, so the arena footprint is
+  // bounded as well.
+  call_attempt_ = RefCountedPtr<CallAttempt>(arena_->New<CallAttempt>(this));
+  ++num_attempts_started_;
+  // Under a hedging policy, schedule the next hedged attempt.
+  if (hedging_enabled()) {
+    MaybeStartHedgingTimer(retry_policy_->hedging_delay());
+  }
   call_attempt_->StartRetriableBatches();
 }
 
@@ -2520,6 +2651,14 @@ void RetryFilter::CallData::RetryCommit(CallAttempt* call_attempt) {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
     gpr_log(GPR_INFO, "chand=%p calld=%p: committing retries", chand_, this);
   }
+  // For hedged calls, the first response wins: cancel and abandon all
+  // attempts other than the one we're committing to.
+  if (call_attempt != nullptr && hedging_enabled()) {
+    MaybeCancelHedgingTimer();
+    if (!outstanding_hedges_.empty() || call_attempt_.get() != call_attempt) {
+      CancelOutstandingHedges(call_attempt);
+    }
+  }
   if (call_attempt != nullptr) {
     // If the call attempt's LB call has been committed, inform the call
     // dispatch controller that the call has been committed.
@@ -2579,6 +2718,162 @@ void RetryFilter::CallData::OnRetryTimerLocked(void* arg,
   GRPC_CALL_STACK_UNREF(calld->owning_call_, "OnRetryTimer");
 }
 
+//
+// hedging
+//
+
+void RetryFilter::CallData::MaybeStartHedgingTimer(grpc_millis delay) {
+  if (retry_committed_ || hedging_timer_pending_) return;
+  if (num_attempts_started_ >= retry_policy_->max_attempts()) return;
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+    gpr_log(GPR_INFO,
+            "chand=%p calld=%p: starting hedged attempt %d in %" PRId64 " ms",
+            chand_, this, num_attempts_started_ + 1, delay);
+  }
+  GRPC_CLOSURE_INIT(&hedging_closure_, OnHedgingTimer, this, nullptr);
+  GRPC_CALL_STACK_REF(owning_call_, "OnHedgingTimer");
+  hedging_timer_pending_ = true;
+  grpc_timer_init(&hedging_timer_, ExecCtx::Get()->Now() + delay,
+                  &hedging_closure_);
+}
+
+void RetryFilter::CallData::MaybeCancelHedgingTimer() {
+  if (hedging_timer_pending_) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+      gpr_log(GPR_INFO, "chand=%p calld=%p: cancelling hedging timer", chand_,
+              this);
+    }
+    hedging_timer_pending_ = false;  // Lame timer callback.
+    grpc_timer_cancel(&hedging_timer_);
+  }
+}
+
+void RetryFilter::CallData::OnHedgingTimer(void* arg, grpc_error_handle error) {
+  auto* calld = static_cast<CallData*>(arg);
+  GRPC_CLOSURE_INIT(&calld->hedging_closure_, OnHedgingTimerLocked, calld,
+                    nullptr);
+  GRPC_CALL_COMBINER_START(calld->call_combiner_, &calld->hedging_closure_,
+                           GRPC_ERROR_REF(error), "hedging timer fired");
+}
+
+void RetryFilter::CallData::OnHedgingTimerLocked(void* arg,
+                                                 grpc_error_handle error) {
+  auto* calld = static_cast<CallData*>(arg);
+  if (error == GRPC_ERROR_NONE && calld->hedging_timer_pending_) {
+    calld->hedging_timer_pending_ = false;
+    const bool have_attempts_in_flight =
+        calld->call_attempt_ != nullptr || !calld->outstanding_hedges_.empty();
+    if (calld->retry_committed_ ||
+        calld->cancelled_from_surface_ != GRPC_ERROR_NONE) {
+      GRPC_CALL_COMBINER_STOP(calld->call_combiner_,
+                              "hedging timer fired after call finished");
+    } else if (have_attempts_in_flight &&
+               calld->retry_throttle_data_ != nullptr &&
+               calld->retry_throttle_data_->IsRetryThrottled()) {
+      // Hedged attempts are paused while retries are throttled.  Skip
+      // this slot; a later non-fatal failure will resume the schedule
+      // via the usual throttle accounting in ShouldRetry().
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+        gpr_log(GPR_INFO, "chand=%p calld=%p: hedged attempt throttled",
+                calld->chand_, calld);
+      }
+      GRPC_CALL_COMBINER_STOP(calld->call_combiner_,
+                              "hedged attempt throttled");
+    } else if (have_attempts_in_flight &&
+               !calld->AllAttemptsQuiescentForSends()) {
+      // The new attempt would replay cached send ops that another
+      // attempt's transport may still be writing; try again after
+      // another hedging delay.
+      calld->MaybeStartHedgingTimer(calld->retry_policy_->hedging_delay());
+      GRPC_CALL_COMBINER_STOP(calld->call_combiner_,
+                              "hedged attempt waiting for send op replay");
+    } else {
+      // Note: This will release the call combiner.
+      calld->CreateCallAttempt();
+    }
+  } else {
+    GRPC_CALL_COMBINER_STOP(calld->call_combiner_, "hedging timer cancelled");
+  }
+  GRPC_CALL_STACK_UNREF(calld->owning_call_, "OnHedgingTimer");
+}
+
+bool RetryFilter::CallData::AllAttemptsQuiescentForSends() const {
+  if (call_attempt_ != nullptr && !call_attempt_->SendOpsCompleted()) {
+    return false;
+  }
+  for (const auto& attempt : outstanding_hedges_) {
+    if (!attempt->SendOpsCompleted()) return false;
+  }
+  return true;
+}
+
+void RetryFilter::CallData::ScheduleNextHedgedAttempt(
+    CallAttempt* failed_attempt, grpc_millis server_pushback_ms) {
+  // Failure-driven hedges do not wait out the rest of the hedging
+  // delay: the next attempt starts immediately, or after server
+  // push-back if present.
+  grpc_millis delay = server_pushback_ms >= 0 ? server_pushback_ms : 0;
+  // If the failed attempt may still be draining cached send ops into
+  // its transport, wait a full hedging delay instead, since the next
+  // attempt will read from the same unsynchronized caches.
+  if (!failed_attempt->SendOpsCompleted() &&
+      delay < retry_policy_->hedging_delay()) {
+    delay = retry_policy_->hedging_delay();
+  }
+  // Drop our ref to the failed attempt.  If it was the current attempt
+  // and older hedged attempts are still in flight, promote the newest
+  // of those, so that batches from the surface continue to be routed
+  // to an attempt.
+  if (call_attempt_.get() == failed_attempt) {
+    call_attempt_.reset(DEBUG_LOCATION, "ScheduleNextHedgedAttempt");
+    if (!outstanding_hedges_.empty()) {
+      call_attempt_ = std::move(outstanding_hedges_.back());
+      outstanding_hedges_.pop_back();
+    }
+  } else {
+    for (size_t i = 0; i < outstanding_hedges_.size(); ++i) {
+      if (outstanding_hedges_[i].get() == failed_attempt) {
+        outstanding_hedges_.erase(outstanding_hedges_.begin() + i);
+        break;
+      }
+    }
+  }
+  // Reschedule the hedging timer at the new deadline.
+  MaybeCancelHedgingTimer();
+  MaybeStartHedgingTimer(delay);
+}
+
+void RetryFilter::CallData::CancelOutstandingHedges(
+    CallAttempt* winning_attempt) {
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+    gpr_log(GPR_INFO,
+            "chand=%p calld=%p: committed to attempt=%p; cancelling other "
+            "hedged attempts",
+            chand_, this, winning_attempt);
+  }
+  // If an older hedged attempt won, make it the current attempt, so
+  // that subsequent batches from the surface are routed to it.
+  if (call_attempt_.get() != winning_attempt) {
+    for (auto& attempt : outstanding_hedges_) {
+      if (attempt.get() == winning_attempt) {
+        attempt.swap(call_attempt_);
+        break;
+      }
+    }
+  }
+  // Cancel the losing attempts in a single batched pass.
+  CallCombinerClosureList closures;
+  for (auto& attempt : outstanding_hedges_) {
+    attempt->AbandonAsLosingHedge(&closures);
+    attempt.reset(DEBUG_LOCATION, "CancelOutstandingHedges");
+  }
+  outstanding_hedges_.clear();
+  // Note: Runs the cancellation batches without yielding the call
+  // combiner, since the caller still needs it to finish processing the
+  // winning attempt's callback.
+  closures.RunClosuresWithoutYielding(call_combiner_);
+}
+
 }  // namespace
 
 const grpc_channel_filter kRetryFilterVtable = {
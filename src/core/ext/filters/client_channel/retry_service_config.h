@@ -48,13 +48,16 @@ class RetryMethodConfig : public ServiceConfigParser::ParsedConfig {
   RetryMethodConfig(int max_attempts, grpc_millis initial_backoff,
                     grpc_millis max_backoff, float backoff_multiplier,
                     StatusCodeSet retryable_status_codes,
-                    absl::optional<grpc_millis> per_attempt_recv_timeout)
+                    absl::optional<grpc_millis> per_attempt_recv_timeout,
+                    bool hedged, grpc_millis hedging_delay)
       : max_attempts_(max_attempts),
         initial_backoff_(initial_backoff),
         max_backoff_(max_backoff),
         backoff_multiplier_(backoff_multiplier),
         retryable_status_codes_(retryable_status_codes),
-        per_attempt_recv_timeout_(per_attempt_recv_timeout) {}
+        per_attempt_recv_timeout_(per_attempt_recv_timeout),
+        hedged_(hedged),
+        hedging_delay_(hedging_delay) {}
 
   int max_attempts() const { return max_attempts_; }
   grpc_millis initial_backoff() const { return initial_backoff_; }
@@ -66,6 +69,11 @@ class RetryMethodConfig : public ServiceConfigParser::ParsedConfig {
   absl::optional<grpc_millis> per_attempt_recv_timeout() const {
     return per_attempt_recv_timeout_;
   }
+  // If true, this config came from a hedgingPolicy rather than a
+  // retryPolicy.  In that case, retryable_status_codes() holds the
+  // policy's nonFatalStatusCodes, and the backoff fields are unused.
+  bool hedged() const { return hedged_; }
+  grpc_millis hedging_delay() const { return hedging_delay_; }
 
  private:
   int max_attempts_ = 0;
@@ -74,6 +82,8 @@ class RetryMethodConfig : public ServiceConfigParser::ParsedConfig {
   float backoff_multiplier_ = 0;
   StatusCodeSet retryable_status_codes_;
   absl::optional<grpc_millis> per_attempt_recv_timeout_;
+  bool hedged_ = false;
+  grpc_millis hedging_delay_ = 0;
 };
 
 class RetryServiceConfigParser : public ServiceConfigParser::Parser {
@@ -27,10 +27,9 @@
 
 #include <grpc/support/alloc.h>
 #include <grpc/support/atm.h>
-#include <grpc/support/string_util.h>
 #include <grpc/support/sync.h>
 
-#include "src/core/lib/avl/avl.h"
+#include "src/core/lib/gprpp/flat_map.h"
 
 namespace grpc_core {
 namespace internal {
@@ -102,6 +101,17 @@ bool ServerRetryThrottleData::RecordFailure() {
   return new_value > throttle_data->max_milli_tokens_ / 2;
 }
 
+bool ServerRetryThrottleData::IsRetryThrottled() {
+  // First, check if we are stale and need to be replaced.
+  ServerRetryThrottleData* throttle_data = this;
+  GetReplacementThrottleDataIfNeeded(&throttle_data);
+  // Unlike RecordFailure(), this does not consume any tokens; it just
+  // checks whether we are below the threshold (max_milli_tokens / 2).
+  const intptr_t value = static_cast<intptr_t>(
+      gpr_atm_acq_load(&throttle_data->milli_tokens_));
+  return value <= throttle_data->max_milli_tokens_ / 2;
+}
+
 void ServerRetryThrottleData::RecordSuccess() {
   // First, check if we are stale and need to be replaced.
   ServerRetryThrottleData* throttle_data = this;
@@ -114,55 +124,25 @@ void ServerRetryThrottleData::RecordSuccess() {
       static_cast<gpr_atm>(throttle_data->max_milli_tokens_));
 }
 
-//
-// avl vtable for string -> server_retry_throttle_data map
-//
-
-namespace {
-
-void* copy_server_name(void* key, void* /*unused*/) {
-  return gpr_strdup(static_cast<const char*>(key));
-}
-
-long compare_server_name(void* key1, void* key2, void* /*unused*/) {
-  return strcmp(static_cast<const char*>(key1), static_cast<const char*>(key2));
-}
-
-void destroy_server_retry_throttle_data(void* value, void* /*unused*/) {
-  ServerRetryThrottleData* throttle_data =
-      static_cast<ServerRetryThrottleData*>(value);
-  throttle_data->Unref();
-}
-
-void* copy_server_retry_throttle_data(void* value, void* /*unused*/) {
-  ServerRetryThrottleData* throttle_data =
-      static_cast<ServerRetryThrottleData*>(value);
-  return throttle_data->Ref().release();
-}
-
-void destroy_server_name(void* key, void* /*unused*/) { gpr_free(key); }
-
-const grpc_avl_vtable avl_vtable = {
-    destroy_server_name, copy_server_name, compare_server_name,
-    destroy_server_retry_throttle_data, copy_server_retry_throttle_data};
-
-}  // namespace
-
 //
 // ServerRetryThrottleMap
 //
 
+using ThrottleDataMap =
+    FlatMap<std::string, RefCountedPtr<ServerRetryThrottleData>>;
+
 static gpr_mu g_mu;
-static grpc_avl g_avl;
+static ThrottleDataMap* g_throttle_data_map;
 
 void ServerRetryThrottleMap::Init() {
   gpr_mu_init(&g_mu);
-  g_avl = grpc_avl_create(&avl_vtable);
+  g_throttle_data_map = new ThrottleDataMap();
 }
 
 void ServerRetryThrottleMap::Shutdown() {
   gpr_mu_destroy(&g_mu);
-  grpc_avl_unref(g_avl, nullptr);
+  delete g_throttle_data_map;
+  g_throttle_data_map = nullptr;
 }
 
 RefCountedPtr<ServerRetryThrottleData> ServerRetryThrottleMap::GetDataForServer(
@@ -170,17 +150,17 @@ RefCountedPtr<ServerRetryThrottleData> ServerRetryThrottleMap::GetDataForServer(
     intptr_t milli_token_ratio) {
   RefCountedPtr<ServerRetryThrottleData> result;
   gpr_mu_lock(&g_mu);
+  const RefCountedPtr<ServerRetryThrottleData>* entry =
+      g_throttle_data_map->Lookup(server_name);
   ServerRetryThrottleData* throttle_data =
-      static_cast<ServerRetryThrottleData*>(
-          grpc_avl_get(g_avl, const_cast<char*>(server_name.c_str()), nullptr));
+      entry == nullptr ? nullptr : entry->get();
   if (throttle_data == nullptr ||
       throttle_data->max_milli_tokens() != max_milli_tokens ||
       throttle_data->milli_token_ratio() != milli_token_ratio) {
     // Entry not found, or found with old parameters.  Create a new one.
     result = MakeRefCounted<ServerRetryThrottleData>(
         max_milli_tokens, milli_token_ratio, throttle_data);
-    g_avl = grpc_avl_add(g_avl, gpr_strdup(server_name.c_str()),
-                         result->Ref().release(), nullptr);
+    *g_throttle_data_map = g_throttle_data_map->Add(server_name, result);
   } else {
     // Entry found.  Return a new ref to it.
     result = throttle_data->Ref();
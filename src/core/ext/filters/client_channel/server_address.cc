@@ -148,6 +148,16 @@ ServerAddress ServerAddress::WithAttribute(
   return address;
 }
 
+// Returns a copy of the address with \a arg added to its channel args.
+ServerAddress ServerAddress::WithArg(const grpc_arg& arg) const {
+  ServerAddress address = *this;
+  grpc_channel_args* new_args =
+      grpc_channel_args_copy_and_add(address.args_, &arg, 1);
+  grpc_channel_args_destroy(address.args_);
+  address.args_ = new_args;
+  return address;
+}
+
 std::string ServerAddress::ToString() const {
   std::vector<std::string> parts = {
       grpc_sockaddr_to_string(&address_, false),
@@ -96,6 +96,9 @@ class ServerAddress {
   ServerAddress WithAttribute(const char* key,
                               std::unique_ptr<AttributeInterface> value) const;
 
+  // Returns a copy of the address with \a arg added to its channel args.
+  ServerAddress WithArg(const grpc_arg& arg) const;
+
   std::string ToString() const;
 
  private:
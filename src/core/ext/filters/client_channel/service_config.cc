@@ -18,6 +18,7 @@
 
 #include "src/core/ext/filters/client_channel/service_config.h"
 
+#include <algorithm>
 #include <string>
 
 #include "absl/strings/str_cat.h"
@@ -27,6 +28,7 @@
 #include "src/core/ext/filters/client_channel/service_config_parser.h"
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/slice/slice_internal.h"
+#include "src/core/lib/slice/slice_utils.h"
 
 namespace grpc_core {
 
@@ -63,12 +65,6 @@ ServiceConfig::ServiceConfig(const grpc_channel_args* args,
   }
 }
 
-ServiceConfig::~ServiceConfig() {
-  for (auto& p : parsed_method_configs_map_) {
-    grpc_slice_unref_internal(p.first);
-  }
-}
-
 grpc_error_handle ServiceConfig::ParseJsonMethodConfig(
     const grpc_channel_args* args, const Json& json) {
   std::vector<grpc_error_handle> error_list;
@@ -107,19 +103,9 @@ grpc_error_handle ServiceConfig::ParseJsonMethodConfig(
           }
           default_method_config_vector_ = vector_ptr;
         } else {
-          grpc_slice key = grpc_slice_from_copied_string(path.c_str());
-          // If the key is not already present in the map, this will
-          // store a ref to the key in the map.
-          auto& value = parsed_method_configs_map_[key];
-          if (value != nullptr) {
-            error_list.push_back(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
-                "field:name error:multiple method configs with same name"));
-            // The map entry already existed, so we need to unref the
-            // key we just created.
-            grpc_slice_unref_internal(key);
-          } else {
-            value = vector_ptr;
-          }
+          // Duplicate names are detected after sorting, in
+          // ParsePerMethodParams().
+          sorted_method_configs_.emplace_back(std::move(path), vector_ptr);
         }
       }
     }
@@ -151,6 +137,22 @@ grpc_error_handle ServiceConfig::ParsePerMethodParams(
       }
     }
   }
+  // Sort the method configs by path, so that lookups can binary-search
+  // them, and check for duplicate names, which the sort makes adjacent.
+  std::sort(sorted_method_configs_.begin(), sorted_method_configs_.end(),
+            [](const std::pair<std::string,
+                               const ServiceConfigParser::ParsedConfigVector*>&
+                   a,
+               const std::pair<std::string,
+                               const ServiceConfigParser::ParsedConfigVector*>&
+                   b) { return a.first < b.first; });
+  for (size_t i = 1; i < sorted_method_configs_.size(); ++i) {
+    if (sorted_method_configs_[i - 1].first ==
+        sorted_method_configs_[i].first) {
+      error_list.push_back(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+          "field:name error:multiple method configs with same name"));
+    }
+  }
   return GRPC_ERROR_CREATE_FROM_VECTOR("Method Params", &error_list);
 }
 
@@ -203,23 +205,35 @@ std::string ServiceConfig::ParseJsonMethodName(const Json& json,
                       method_name == nullptr ? "" : *method_name);
 }
 
+const ServiceConfigParser::ParsedConfigVector*
+ServiceConfig::FindSortedMethodConfig(absl::string_view path) const {
+  auto it = std::lower_bound(
+      sorted_method_configs_.begin(), sorted_method_configs_.end(), path,
+      [](const std::pair<std::string,
+                         const ServiceConfigParser::ParsedConfigVector*>&
+             entry,
+         absl::string_view p) { return entry.first < p; });
+  if (it != sorted_method_configs_.end() && it->first == path) {
+    return it->second;
+  }
+  return nullptr;
+}
+
 const ServiceConfigParser::ParsedConfigVector*
 ServiceConfig::GetMethodParsedConfigVector(const grpc_slice& path) const {
-  if (parsed_method_configs_map_.empty()) {
+  if (sorted_method_configs_.empty()) {
     return default_method_config_vector_;
   }
-  // Try looking up the full path in the map.
-  auto it = parsed_method_configs_map_.find(path);
-  if (it != parsed_method_configs_map_.end()) return it->second;
+  // Try looking up the full path.
+  absl::string_view path_view = StringViewFromSlice(path);
+  const auto* config_vector = FindSortedMethodConfig(path_view);
+  if (config_vector != nullptr) return config_vector;
   // If we didn't find a match for the path, try looking for a wildcard
   // entry (i.e., change "/service/method" to "/service/").
-  UniquePtr<char> path_str(grpc_slice_to_c_string(path));
-  char* sep = strrchr(path_str.get(), '/');
-  if (sep == nullptr) return nullptr;  // Shouldn't ever happen.
-  sep[1] = '\0';
-  grpc_slice wildcard_path = grpc_slice_from_static_string(path_str.get());
-  it = parsed_method_configs_map_.find(wildcard_path);
-  if (it != parsed_method_configs_map_.end()) return it->second;
+  size_t sep = path_view.rfind('/');
+  if (sep == absl::string_view::npos) return nullptr;  // Shouldn't happen.
+  config_vector = FindSortedMethodConfig(path_view.substr(0, sep + 1));
+  if (config_vector != nullptr) return config_vector;
   // Try default method config, if set.
   return default_method_config_vector_;
 }
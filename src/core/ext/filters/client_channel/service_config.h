@@ -19,9 +19,12 @@
 
 #include <grpc/support/port_platform.h>
 
-#include <unordered_map>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "absl/container/inlined_vector.h"
+#include "absl/strings/string_view.h"
 
 #include <grpc/impl/codegen/grpc_types.h>
 #include <grpc/support/string_util.h>
@@ -71,7 +74,6 @@ class ServiceConfig : public RefCounted<ServiceConfig> {
 
   ServiceConfig(const grpc_channel_args* args, std::string json_string,
                 Json json, grpc_error_handle* error);
-  ~ServiceConfig() override;
 
   const std::string& json_string() const { return json_string_; }
 
@@ -100,23 +102,30 @@ class ServiceConfig : public RefCounted<ServiceConfig> {
   static std::string ParseJsonMethodName(const Json& json,
                                          grpc_error_handle* error);
 
+  // Looks up \a path in sorted_method_configs_.  Returns null if not found.
+  const ServiceConfigParser::ParsedConfigVector* FindSortedMethodConfig(
+      absl::string_view path) const;
+
   std::string json_string_;
   Json json_;
 
   absl::InlinedVector<std::unique_ptr<ServiceConfigParser::ParsedConfig>,
                       ServiceConfigParser::kNumPreallocatedParsers>
       parsed_global_configs_;
-  // A map from the method name to the parsed config vector. Note that we are
-  // using a raw pointer and not a unique pointer so that we can use the same
-  // vector for multiple names.
-  std::unordered_map<grpc_slice, const ServiceConfigParser::ParsedConfigVector*,
-                     SliceHash>
-      parsed_method_configs_map_;
+  // Method configs, sorted by path so that lookups are a binary search
+  // over a flat array instead of a hash probe over interned slices.
+  // Wildcard entries (all methods of a service) are stored with the path
+  // "/service/", which sorts immediately before the service's methods.
+  // Note that we are using a raw pointer and not a unique pointer so
+  // that we can use the same vector for multiple names.
+  std::vector<
+      std::pair<std::string, const ServiceConfigParser::ParsedConfigVector*>>
+      sorted_method_configs_;
   // Default method config.
   const ServiceConfigParser::ParsedConfigVector* default_method_config_vector_ =
       nullptr;
   // Storage for all the vectors that are being used in
-  // parsed_method_configs_table_.
+  // sorted_method_configs_.
   absl::InlinedVector<std::unique_ptr<ServiceConfigParser::ParsedConfigVector>,
                       32>
       parsed_method_config_vectors_storage_;
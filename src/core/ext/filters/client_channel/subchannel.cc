@@ -478,13 +478,13 @@ class Subchannel::HealthWatcherMap::HealthWatcher
       status_ = status;
       watcher_list_.NotifyLocked(subchannel_.get(), state_, status);
       // We're not connected, so stop health checking.
-      health_check_client_.reset();
+      health_check_watch_.reset();
     }
   }
 
   void Orphan() override {
     watcher_list_.Clear();
-    health_check_client_.reset();
+    health_check_watch_.reset();
     Unref();
   }
 
@@ -492,7 +492,7 @@ class Subchannel::HealthWatcherMap::HealthWatcher
   void OnConnectivityStateChange(grpc_connectivity_state new_state,
                                  const absl::Status& status) override {
     MutexLock lock(&subchannel_->mu_);
-    if (new_state != GRPC_CHANNEL_SHUTDOWN && health_check_client_ != nullptr) {
+    if (new_state != GRPC_CHANNEL_SHUTDOWN && health_check_watch_ != nullptr) {
       state_ = new_state;
       status_ = status;
       watcher_list_.NotifyLocked(subchannel_.get(), new_state, status);
@@ -501,15 +501,16 @@ class Subchannel::HealthWatcherMap::HealthWatcher
 
   void StartHealthCheckingLocked()
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(subchannel_->mu_) {
-    GPR_ASSERT(health_check_client_ == nullptr);
-    health_check_client_ = MakeOrphanable<HealthCheckClient>(
-        health_check_service_name_, subchannel_->connected_subchannel_,
-        subchannel_->pollset_set_, subchannel_->channelz_node_, Ref());
+    GPR_ASSERT(health_check_watch_ == nullptr);
+    health_check_watch_ = HealthCheckWatchHandle::Start(
+        subchannel_->GetTargetAddress(), health_check_service_name_,
+        subchannel_->connected_subchannel_, subchannel_->pollset_set_,
+        subchannel_->channelz_node_, Ref());
   }
 
   WeakRefCountedPtr<Subchannel> subchannel_;
   std::string health_check_service_name_;
-  OrphanablePtr<HealthCheckClient> health_check_client_;
+  OrphanablePtr<HealthCheckWatchHandle> health_check_watch_;
   grpc_connectivity_state state_;
   absl::Status status_;
   ConnectivityStateWatcherList watcher_list_;
@@ -631,6 +632,43 @@ BackOff::Options ParseArgsForBackoffValues(
       .set_max_backoff(max_backoff_ms);
 }
 
+// Process-wide spreading of reconnect attempts. Subchannels that all lost
+// their transport at the same instant (typically a server restart) compute
+// nearly identical backoff deadlines, and per-subchannel jitter only smears
+// the resulting wave a little. Subchannels that opt in via
+// GRPC_ARG_EXPERIMENTAL_RECONNECT_SPREAD_MS instead reserve admission slots
+// here, spacing their attempts out across the configured horizon.
+class ReconnectAdmissionController {
+ public:
+  // Returns the earliest time at or after \a desired_time at which the
+  // caller may start a connection attempt, and reserves that slot. Slots
+  // are spaced so that roughly \a max_concurrent attempts are admitted per
+  // \a spread_ms window, but an attempt is never delayed past
+  // desired_time + spread_ms: under an extreme herd a second, smaller wave
+  // beats starving subchannels.
+  grpc_millis ReserveAttemptSlot(grpc_millis desired_time,
+                                 grpc_millis spread_ms, int max_concurrent) {
+    if (spread_ms <= 0) return desired_time;
+    const grpc_millis spacing = std::max<grpc_millis>(
+        1, spread_ms / std::max(1, max_concurrent));
+    MutexLock lock(&mu_);
+    const grpc_millis slot =
+        std::min(std::max(desired_time, next_slot_), desired_time + spread_ms);
+    next_slot_ = slot + spacing;
+    return slot;
+  }
+
+  static ReconnectAdmissionController* Get() {
+    static ReconnectAdmissionController* controller =
+        new ReconnectAdmissionController();
+    return controller;
+  }
+
+ private:
+  Mutex mu_;
+  grpc_millis next_slot_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
 }  // namespace
 
 void Subchannel::ConnectivityStateWatcherInterface::PushConnectivityStateChange(
@@ -679,6 +717,13 @@ Subchannel::Subchannel(SubchannelKey key,
   if (new_args != nullptr) grpc_channel_args_destroy(new_args);
   GRPC_CLOSURE_INIT(&on_connecting_finished_, OnConnectingFinished, this,
                     grpc_schedule_on_exec_ctx);
+  reconnect_spread_ms_ = grpc_channel_arg_get_integer(
+      grpc_channel_args_find(args_, GRPC_ARG_EXPERIMENTAL_RECONNECT_SPREAD_MS),
+      {0, 0, INT_MAX});
+  max_concurrent_reconnects_ = grpc_channel_arg_get_integer(
+      grpc_channel_args_find(args_,
+                             GRPC_ARG_EXPERIMENTAL_MAX_CONCURRENT_RECONNECTS),
+      {8, 1, INT_MAX});
   const grpc_arg* arg = grpc_channel_args_find(args_, GRPC_ARG_ENABLE_CHANNELZ);
   const bool channelz_enabled =
       grpc_channel_arg_get_bool(arg, GRPC_ENABLE_CHANNELZ_DEFAULT);
@@ -949,8 +994,15 @@ void Subchannel::MaybeStartConnectingLocked() {
   } else {
     GPR_ASSERT(!have_retry_alarm_);
     have_retry_alarm_ = true;
-    const grpc_millis time_til_next =
-        next_attempt_deadline_ - ExecCtx::Get()->Now();
+    // With reconnect spreading enabled the backoff deadline is pushed out
+    // to this subchannel's process-wide admission slot, so that a herd of
+    // subchannels disconnected at the same instant does not retry as one
+    // synchronized wave.
+    const grpc_millis retry_deadline =
+        ReconnectAdmissionController::Get()->ReserveAttemptSlot(
+            next_attempt_deadline_, reconnect_spread_ms_,
+            max_concurrent_reconnects_);
+    const grpc_millis time_til_next = retry_deadline - ExecCtx::Get()->Now();
     if (time_til_next <= 0) {
       gpr_log(GPR_INFO, "Subchannel %p: Retry immediately", this);
     } else {
@@ -959,7 +1011,7 @@ void Subchannel::MaybeStartConnectingLocked() {
     }
     GRPC_CLOSURE_INIT(&on_retry_alarm_, OnRetryAlarm, this,
                       grpc_schedule_on_exec_ctx);
-    grpc_timer_init(&retry_alarm_, next_attempt_deadline_, &on_retry_alarm_);
+    grpc_timer_init(&retry_alarm_, retry_deadline, &on_retry_alarm_);
   }
 }
 
@@ -386,6 +386,10 @@ class Subchannel : public DualRefCounted<Subchannel> {
   grpc_millis next_attempt_deadline_ ABSL_GUARDED_BY(mu_);
   grpc_millis min_connect_timeout_ms_ ABSL_GUARDED_BY(mu_);
   bool backoff_begun_ ABSL_GUARDED_BY(mu_) = false;
+  // Process-wide reconnect admission control (see
+  // GRPC_ARG_EXPERIMENTAL_RECONNECT_SPREAD_MS); 0 disables it.
+  grpc_millis reconnect_spread_ms_ ABSL_GUARDED_BY(mu_) = 0;
+  int max_concurrent_reconnects_ ABSL_GUARDED_BY(mu_) = 8;
 
   // Retry alarm.
   grpc_timer retry_alarm_ ABSL_GUARDED_BY(mu_);
@@ -20,6 +20,10 @@
 
 #include "src/core/ext/filters/client_channel/subchannel_pool_interface.h"
 
+#include <string.h>
+
+#include <grpc/support/alloc.h>
+
 #include "src/core/lib/gpr/useful.h"
 
 // The subchannel pool to reuse subchannels.
@@ -31,8 +35,56 @@ namespace grpc_core {
 
 TraceFlag grpc_subchannel_pool_trace(false, "subchannel_pool");
 
+namespace {
+
+// Classifies whether a channel arg affects how a subchannel's connection is
+// established or behaves once established. Args that configure only the
+// layers above the subchannel (service config handling, retries, channel
+// idleness) or observability are excluded from subchannel keys, as is
+// anything under GRPC_ARG_NO_SUBCHANNEL_PREFIX, so that channels differing
+// only in such args adopt each other's established subchannels - and their
+// live transports - from the pool instead of forcing a reconnect.
+bool ArgAffectsConnection(const char* key) {
+  static const char* const kConnectionIrrelevantArgs[] = {
+      GRPC_ARG_ENABLE_CHANNELZ,
+      GRPC_ARG_MAX_CHANNEL_TRACE_EVENT_MEMORY_PER_NODE,
+      GRPC_ARG_ENABLE_RETRIES,
+      GRPC_ARG_SERVICE_CONFIG,
+      GRPC_ARG_SERVICE_CONFIG_DISABLE_RESOLUTION,
+      GRPC_ARG_CLIENT_IDLE_TIMEOUT_MS,
+  };
+  if (strncmp(key, GRPC_ARG_NO_SUBCHANNEL_PREFIX,
+              sizeof(GRPC_ARG_NO_SUBCHANNEL_PREFIX) - 1) == 0) {
+    return false;
+  }
+  for (const char* irrelevant : kConnectionIrrelevantArgs) {
+    if (strcmp(key, irrelevant) == 0) return false;
+  }
+  return true;
+}
+
+// Drops connection-irrelevant args, then normalizes the remainder into a
+// canonical order so that byte-wise comparison yields connection-equivalence.
+grpc_channel_args* NormalizeArgsForSubchannelKey(
+    const grpc_channel_args* args) {
+  grpc_channel_args filtered;
+  filtered.num_args = 0;
+  filtered.args =
+      static_cast<grpc_arg*>(gpr_malloc(sizeof(grpc_arg) * args->num_args));
+  for (size_t i = 0; i < args->num_args; i++) {
+    if (ArgAffectsConnection(args->args[i].key)) {
+      filtered.args[filtered.num_args++] = args->args[i];
+    }
+  }
+  grpc_channel_args* result = grpc_channel_args_normalize(&filtered);
+  gpr_free(filtered.args);
+  return result;
+}
+
+}  // namespace
+
 SubchannelKey::SubchannelKey(const grpc_channel_args* args) {
-  Init(args, grpc_channel_args_normalize);
+  Init(args, NormalizeArgsForSubchannelKey);
 }
 
 SubchannelKey::~SubchannelKey() {
@@ -24,6 +24,7 @@
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_stack_builder.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/surface/channel_init.h"
 #include "src/core/lib/transport/http2_errors.h"
@@ -48,74 +49,27 @@ TraceFlag grpc_trace_client_idle_filter(false, "client_idle_filter");
 namespace {
 
 /*
-  client_idle_filter maintains a state tracking if there are active calls in the
-  channel and its internal idle_timer_. The states are specified as following:
-
-  +--------------------------------------------+-------------+---------+
-  |               ChannelState                 | idle_timer_ | channel |
-  +--------------------------------------------+-------------+---------+
-  | IDLE                                       | unset       | idle    |
-  | CALLS_ACTIVE                               | unset       | busy    |
-  | TIMER_PENDING                              | set-valid   | idle    |
-  | TIMER_PENDING_CALLS_ACTIVE                 | set-invalid | busy    |
-  | TIMER_PENDING_CALLS_SEEN_SINCE_TIMER_START | set-invalid | idle    |
-  +--------------------------------------------+-------------+---------+
-
-  IDLE: The initial state of the client_idle_filter, indicating the channel is
-  in IDLE.
-
-  CALLS_ACTIVE: The channel has 1 or 1+ active calls and the timer is not set.
-
-  TIMER_PENDING: The state after the timer is set and no calls have arrived
-  after the timer is set. The channel must have 0 active call in this state. If
-  the timer is fired in this state, the channel will go into IDLE state.
-
-  TIMER_PENDING_CALLS_ACTIVE: The state after the timer is set and at least one
-  call has arrived after the timer is set. The channel must have 1 or 1+ active
-  calls in this state. If the timer is fired in this state, we won't reschedule
-  it.
-
-  TIMER_PENDING_CALLS_SEEN_SINCE_TIMER_START: The state after the timer is set
-  and at least one call has arrived after the timer is set, BUT the channel
-  currently has 0 active call. If the timer is fired in this state, we will
-  reschedule it according to the finish time of the latest call.
-
-  PROCESSING: The state set to block other threads when the setting thread is
-  doing some work to keep state consistency.
-
-  idle_timer_ will not be cancelled (unless the channel is shutting down).
-  If the timer callback is called when the idle_timer_ is valid (i.e. idle_state
-  is TIMER_PENDING), the channel will enter IDLE, otherwise the channel won't be
-  changed.
-
-  State transitions:
-                                            IDLE
-                                            |  ^
-            ---------------------------------  *
-            |                                  *
-            v                                  *
-      CALLS_ACTIVE =================> TIMER_PENDING
-            ^                               |  ^
-            *  ------------------------------  *
-            *  |                               *
-            *  v                               *
-TIMER_PENDING_CALLS_ACTIVE ===> TIMER_PENDING_CALLS_SEEN_SINCE_TIMER_START
-            ^                               |
-            |                               |
-            ---------------------------------
-
-  ---> Triggered by IncreaseCallCount()
-  ===> Triggered by DecreaseCallCount()
-  ***> Triggered by IdleTimerCallback()
+  client_idle_filter detects idleness passively. The per-call hot path only
+  maintains an active call counter and a last-activity timestamp, both with
+  relaxed atomic operations; it never sets or resets a timer. A single sweep
+  timer per channel periodically inspects this bookkeeping and moves the
+  channel into IDLE once no call has been active for client_idle_timeout_.
+  The sweep timer is retired when the channel enters IDLE and revived by the
+  first call that arrives afterwards.
+
+  The sweep is deliberately slack-tolerant: idleness may be detected up to
+  one sweep period after it actually begins. That is acceptable for an event
+  that is rare and has no latency-sensitive consumer, and it removes the
+  CAS-based state machine that previously ran on every call start/finish.
+
+  To revive the timer without locking on the hot path, IncreaseCallCount()
+  increments call_count_ with std::memory_order_seq_cst and then inspects
+  sweep_timer_armed_, while the sweep callback retires the timer by storing
+  to sweep_timer_armed_ with std::memory_order_seq_cst and then re-checking
+  call_count_. With both sides sequentially consistent, either the callback
+  observes the new call and re-arms itself, or the call observes the retired
+  timer and revives it under mu_ — the timer cannot be lost.
 */
-enum ChannelState {
-  IDLE,
-  CALLS_ACTIVE,
-  TIMER_PENDING,
-  TIMER_PENDING_CALLS_ACTIVE,
-  TIMER_PENDING_CALLS_SEEN_SINCE_TIMER_START,
-  PROCESSING
-};
 
 grpc_millis GetClientIdleTimeout(const grpc_channel_args* args) {
   return std::max(
@@ -147,7 +101,8 @@ class ChannelData {
   static void IdleTransportOpCompleteCallback(void* arg,
                                               grpc_error_handle error);
 
-  void StartIdleTimer();
+  void MaybeStartSweepTimer();
+  void StartSweepTimerLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
   void EnterIdle();
 
@@ -158,10 +113,18 @@ class ChannelData {
   // channel goes back into IDLE state.
   const grpc_millis client_idle_timeout_;
 
-  // Member data used to track the state of channel.
-  grpc_millis last_idle_time_;
+  // Per-call bookkeeping inspected by the sweep timer. Only touched with
+  // atomic operations on the hot path; see the file comment for the required
+  // orderings.
   std::atomic<intptr_t> call_count_{0};
-  std::atomic<ChannelState> state_{IDLE};
+  std::atomic<grpc_millis> last_activity_time_;
+  // Whether the sweep timer is currently set. Written only under mu_; read
+  // without mu_ on the hot path to decide whether the timer needs reviving.
+  std::atomic<bool> sweep_timer_armed_{false};
+
+  // Guards arming of the sweep timer.
+  Mutex mu_;
+  bool shutdown_ ABSL_GUARDED_BY(mu_) = false;
 
   // Idle timer and its callback closure.
   grpc_timer idle_timer_;
@@ -189,12 +152,12 @@ void ChannelData::StartTransportOp(grpc_channel_element* elem,
   ChannelData* chand = static_cast<ChannelData*>(elem->channel_data);
   // Catch the disconnect_with_error transport op.
   if (op->disconnect_with_error != GRPC_ERROR_NONE) {
-    // IncreaseCallCount() introduces a phony call and prevent the timer from
-    // being reset by other threads.
-    chand->IncreaseCallCount();
-    // If the timer has been set, cancel the timer.
-    // No synchronization issues here. grpc_timer_cancel() is valid as long as
-    // the timer has been init()ed before.
+    // Prevent the sweep timer from being revived, then cancel it.
+    // grpc_timer_cancel() is valid as long as the timer has been init()ed
+    // before; holding mu_ here excludes a concurrent re-arm in the sweep
+    // callback, so no armed timer survives shutdown.
+    MutexLock lock(&chand->mu_);
+    chand->shutdown_ = true;
     grpc_timer_cancel(&chand->idle_timer_);
   }
   // Pass the op to the next filter.
@@ -203,86 +166,24 @@ void ChannelData::StartTransportOp(grpc_channel_element* elem,
 
 void ChannelData::IncreaseCallCount() {
   const intptr_t previous_value =
-      call_count_.fetch_add(1, std::memory_order_relaxed);
+      call_count_.fetch_add(1, std::memory_order_seq_cst);
   GRPC_IDLE_FILTER_LOG("call counter has increased to %" PRIuPTR,
                        previous_value + 1);
-  if (previous_value == 0) {
-    // This call is the one that makes the channel busy.
-    // Loop here to make sure the previous decrease operation has finished.
-    ChannelState state = state_.load(std::memory_order_relaxed);
-    while (true) {
-      switch (state) {
-        // Timer has not been set. Switch to CALLS_ACTIVE.
-        case IDLE:
-          // In this case, no other threads will modify the state, so we can
-          // just store the value.
-          state_.store(CALLS_ACTIVE, std::memory_order_relaxed);
-          return;
-        // Timer has been set. Switch to TIMER_PENDING_CALLS_ACTIVE.
-        case TIMER_PENDING:
-        case TIMER_PENDING_CALLS_SEEN_SINCE_TIMER_START:
-          // At this point, the state may have been switched to IDLE by the
-          // idle timer callback. Therefore, use CAS operation to change the
-          // state atomically.
-          // Use std::memory_order_acquire on success to ensure last_idle_time_
-          // has been properly set in DecreaseCallCount().
-          if (state_.compare_exchange_weak(state, TIMER_PENDING_CALLS_ACTIVE,
-                                           std::memory_order_acquire,
-                                           std::memory_order_relaxed)) {
-            return;
-          }
-          break;
-        default:
-          // The state has not been switched to desired value yet, try again.
-          state = state_.load(std::memory_order_relaxed);
-          break;
-      }
-    }
+  // Revive the sweep timer if it was retired when the channel went IDLE.
+  // This branch is only taken on the first call after an idle period.
+  if (GPR_UNLIKELY(!sweep_timer_armed_.load(std::memory_order_seq_cst))) {
+    MaybeStartSweepTimer();
   }
 }
 
 void ChannelData::DecreaseCallCount() {
+  // Stamp before decrementing so that the sweep timer never observes a zero
+  // call count together with a timestamp older than this call's finish.
+  last_activity_time_.store(ExecCtx::Get()->Now(), std::memory_order_relaxed);
   const intptr_t previous_value =
       call_count_.fetch_sub(1, std::memory_order_relaxed);
   GRPC_IDLE_FILTER_LOG("call counter has decreased to %" PRIuPTR,
                        previous_value - 1);
-  if (previous_value == 1) {
-    // This call is the one that makes the channel idle.
-    // last_idle_time_ does not need to be std::atomic<> because busy-loops in
-    // IncreaseCallCount(), DecreaseCallCount() and IdleTimerCallback() will
-    // prevent multiple threads from simultaneously accessing this variable.
-    last_idle_time_ = ExecCtx::Get()->Now();
-    ChannelState state = state_.load(std::memory_order_relaxed);
-    while (true) {
-      switch (state) {
-        // Timer has not been set. Set the timer and switch to TIMER_PENDING
-        case CALLS_ACTIVE:
-          // Release store here to make other threads see the updated value of
-          // last_idle_time_.
-          StartIdleTimer();
-          state_.store(TIMER_PENDING, std::memory_order_release);
-          return;
-        // Timer has been set. Switch to
-        // TIMER_PENDING_CALLS_SEEN_SINCE_TIMER_START
-        case TIMER_PENDING_CALLS_ACTIVE:
-          // At this point, the state may have been switched to CALLS_ACTIVE by
-          // the idle timer callback. Therefore, use CAS operation to change the
-          // state atomically.
-          // Release store here to make the idle timer callback see the updated
-          // value of last_idle_time_ to properly reset the idle timer.
-          if (state_.compare_exchange_weak(
-                  state, TIMER_PENDING_CALLS_SEEN_SINCE_TIMER_START,
-                  std::memory_order_release, std::memory_order_relaxed)) {
-            return;
-          }
-          break;
-        default:
-          // The state has not been switched to desired value yet, try again.
-          state = state_.load(std::memory_order_relaxed);
-          break;
-      }
-    }
-  }
 }
 
 ChannelData::ChannelData(grpc_channel_element* elem,
@@ -290,13 +191,15 @@ ChannelData::ChannelData(grpc_channel_element* elem,
                          grpc_error_handle* /*error*/)
     : elem_(elem),
       channel_stack_(args->channel_stack),
-      client_idle_timeout_(GetClientIdleTimeout(args->channel_args)) {
+      client_idle_timeout_(GetClientIdleTimeout(args->channel_args)),
+      last_activity_time_(ExecCtx::Get()->Now()) {
   // If the idle filter is explicitly disabled in channel args, this ctor should
   // not get called.
   GPR_ASSERT(client_idle_timeout_ != GRPC_MILLIS_INF_FUTURE);
   GRPC_IDLE_FILTER_LOG("created with max_leisure_time = %" PRId64 " ms",
                        client_idle_timeout_);
-  // Initialize the idle timer without setting it.
+  // Initialize the idle timer without setting it. The channel starts out
+  // IDLE, so the sweep timer stays retired until the first call arrives.
   grpc_timer_init_unset(&idle_timer_);
   // Initialize the idle timer callback closure.
   GRPC_CLOSURE_INIT(&idle_timer_callback_, IdleTimerCallback, this,
@@ -315,46 +218,30 @@ void ChannelData::IdleTimerCallback(void* arg, grpc_error_handle error) {
     GRPC_CHANNEL_STACK_UNREF(chand->channel_stack_, "max idle timer callback");
     return;
   }
-  bool finished = false;
-  ChannelState state = chand->state_.load(std::memory_order_relaxed);
-  while (!finished) {
-    switch (state) {
-      case TIMER_PENDING:
-        // Change the state to PROCESSING to block IncreaseCallCout() until the
-        // EnterIdle() operation finishes, preventing mistakenly entering IDLE
-        // when active RPC exists.
-        finished = chand->state_.compare_exchange_weak(
-            state, PROCESSING, std::memory_order_acquire,
-            std::memory_order_relaxed);
-        if (finished) {
-          chand->EnterIdle();
-          chand->state_.store(IDLE, std::memory_order_relaxed);
-        }
-        break;
-      case TIMER_PENDING_CALLS_ACTIVE:
-        finished = chand->state_.compare_exchange_weak(
-            state, CALLS_ACTIVE, std::memory_order_relaxed,
-            std::memory_order_relaxed);
-        break;
-      case TIMER_PENDING_CALLS_SEEN_SINCE_TIMER_START:
-        // Change the state to PROCESSING to block IncreaseCallCount() until the
-        // StartIdleTimer() operation finishes, preventing mistakenly restarting
-        // the timer after grpc_timer_cancel() when shutdown.
-        finished = chand->state_.compare_exchange_weak(
-            state, PROCESSING, std::memory_order_acquire,
-            std::memory_order_relaxed);
-        if (finished) {
-          chand->StartIdleTimer();
-          chand->state_.store(TIMER_PENDING, std::memory_order_relaxed);
-        }
-        break;
-      default:
-        // The state has not been switched to desired value yet, try again.
-        state = chand->state_.load(std::memory_order_relaxed);
-        break;
+  bool enter_idle = false;
+  {
+    MutexLock lock(&chand->mu_);
+    if (!chand->shutdown_) {
+      // Tentatively retire the timer, then re-check the call count; see the
+      // file comment for why this ordering cannot lose the timer.
+      chand->sweep_timer_armed_.store(false, std::memory_order_seq_cst);
+      if (chand->call_count_.load(std::memory_order_seq_cst) == 0 &&
+          chand->last_activity_time_.load(std::memory_order_relaxed) +
+                  chand->client_idle_timeout_ <=
+              ExecCtx::Get()->Now()) {
+        // The channel has been quiet for a full timeout; leave the timer
+        // retired and enter IDLE below, outside of mu_.
+        enter_idle = true;
+      } else {
+        // Calls are active or finished too recently; keep sweeping.
+        chand->StartSweepTimerLocked();
+      }
     }
   }
   GRPC_IDLE_FILTER_LOG("timer finishes");
+  if (enter_idle) {
+    chand->EnterIdle();
+  }
   GRPC_CHANNEL_STACK_UNREF(chand->channel_stack_, "max idle timer callback");
 }
 
@@ -364,12 +251,29 @@ void ChannelData::IdleTransportOpCompleteCallback(void* arg,
   GRPC_CHANNEL_STACK_UNREF(chand->channel_stack_, "idle transport op");
 }
 
-void ChannelData::StartIdleTimer() {
-  GRPC_IDLE_FILTER_LOG("timer has started");
+void ChannelData::MaybeStartSweepTimer() {
+  MutexLock lock(&mu_);
+  if (shutdown_ || sweep_timer_armed_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  StartSweepTimerLocked();
+}
+
+void ChannelData::StartSweepTimerLocked() {
+  GRPC_IDLE_FILTER_LOG("sweep timer has started");
+  sweep_timer_armed_.store(true, std::memory_order_seq_cst);
   // Hold a ref to the channel stack for the timer callback.
   GRPC_CHANNEL_STACK_REF(channel_stack_, "max idle timer callback");
-  grpc_timer_init(&idle_timer_, last_idle_time_ + client_idle_timeout_,
-                  &idle_timer_callback_);
+  // If the channel is already quiet, sweep when the current idle period
+  // would expire; otherwise a full timeout from now is soon enough.
+  grpc_millis deadline;
+  if (call_count_.load(std::memory_order_relaxed) == 0) {
+    deadline = last_activity_time_.load(std::memory_order_relaxed) +
+               client_idle_timeout_;
+  } else {
+    deadline = ExecCtx::Get()->Now() + client_idle_timeout_;
+  }
+  grpc_timer_init(&idle_timer_, deadline, &idle_timer_callback_);
 }
 
 void ChannelData::EnterIdle() {
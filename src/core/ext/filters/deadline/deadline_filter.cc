@@ -27,6 +27,7 @@
 #include <grpc/support/time.h>
 
 #include "src/core/lib/channel/channel_stack_builder.h"
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/memory.h"
 #include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/slice/slice_internal.h"
@@ -105,6 +106,134 @@ class TimerState {
 
 }  // namespace grpc_core
 
+//
+// lazy deadline timer arming
+//
+
+// Calls whose deadline is more than two sweep periods away are parked on
+// one of these sharded lists instead of arming a per-call timer right
+// away.  A coarse sweep timer (armed only while its list is non-empty)
+// arms the real timer for any parked call whose deadline will arrive
+// before the sweep could see it again; calls that complete earlier just
+// unlink themselves.  This keeps the vast majority of calls -- which
+// finish quickly with generous deadlines -- out of the timer wheel
+// entirely.
+#define DEADLINE_SWEEP_SHARDS 8
+
+typedef struct deadline_sweep_shard {
+  gpr_mu mu;
+  grpc_deadline_state* head;
+  bool timer_armed;
+  grpc_timer timer;
+  grpc_closure closure;
+} deadline_sweep_shard;
+
+static const grpc_millis kDeadlineSweepPeriod = 1000;
+
+static gpr_once g_sweep_once = GPR_ONCE_INIT;
+static deadline_sweep_shard g_sweep_shards[DEADLINE_SWEEP_SHARDS];
+
+static void deadline_sweep_timer_cb(void* arg, grpc_error_handle error);
+
+static void deadline_sweep_global_init(void) {
+  for (size_t i = 0; i < DEADLINE_SWEEP_SHARDS; i++) {
+    deadline_sweep_shard* shard = &g_sweep_shards[i];
+    gpr_mu_init(&shard->mu);
+    shard->head = nullptr;
+    shard->timer_armed = false;
+    GRPC_CLOSURE_INIT(&shard->closure, deadline_sweep_timer_cb, shard,
+                      nullptr);
+  }
+}
+
+static deadline_sweep_shard* deadline_sweep_shard_for(
+    grpc_deadline_state* deadline_state) {
+  gpr_once_init(&g_sweep_once, deadline_sweep_global_init);
+  return &g_sweep_shards[grpc_core::HashPointer(deadline_state,
+                                                DEADLINE_SWEEP_SHARDS)];
+}
+
+static void deadline_sweep_unlink_locked(deadline_sweep_shard* shard,
+                                         grpc_deadline_state* deadline_state) {
+  if (deadline_state->sweep_prev == nullptr) {
+    shard->head = deadline_state->sweep_next;
+  } else {
+    deadline_state->sweep_prev->sweep_next = deadline_state->sweep_next;
+  }
+  if (deadline_state->sweep_next != nullptr) {
+    deadline_state->sweep_next->sweep_prev = deadline_state->sweep_prev;
+  }
+  deadline_state->sweep_prev = nullptr;
+  deadline_state->sweep_next = nullptr;
+  deadline_state->sweep_linked = false;
+}
+
+// Parks a call on its sweep shard instead of arming a timer.
+static void deadline_sweep_add(grpc_deadline_state* deadline_state,
+                               grpc_millis deadline) {
+  deadline_sweep_shard* shard = deadline_sweep_shard_for(deadline_state);
+  deadline_state->sweep_deadline = deadline;
+  deadline_state->sweep_used = true;
+  gpr_mu_lock(&shard->mu);
+  deadline_state->sweep_linked = true;
+  deadline_state->sweep_prev = nullptr;
+  deadline_state->sweep_next = shard->head;
+  if (shard->head != nullptr) shard->head->sweep_prev = deadline_state;
+  shard->head = deadline_state;
+  if (!shard->timer_armed) {
+    shard->timer_armed = true;
+    grpc_timer_init(&shard->timer,
+                    grpc_core::ExecCtx::Get()->Now() + kDeadlineSweepPeriod,
+                    &shard->closure);
+  }
+  gpr_mu_unlock(&shard->mu);
+}
+
+// Unparks a call from its sweep shard.  Returns true if the call was
+// still parked, i.e. no per-call timer was ever armed for it.
+static bool deadline_sweep_remove(grpc_deadline_state* deadline_state) {
+  deadline_sweep_shard* shard = deadline_sweep_shard_for(deadline_state);
+  gpr_mu_lock(&shard->mu);
+  const bool was_linked = deadline_state->sweep_linked;
+  if (was_linked) deadline_sweep_unlink_locked(shard, deadline_state);
+  gpr_mu_unlock(&shard->mu);
+  return was_linked;
+}
+
+static void deadline_sweep_timer_cb(void* arg, grpc_error_handle error) {
+  deadline_sweep_shard* shard = static_cast<deadline_sweep_shard*>(arg);
+  gpr_mu_lock(&shard->mu);
+  if (error != GRPC_ERROR_NONE) {
+    shard->timer_armed = false;
+    gpr_mu_unlock(&shard->mu);
+    return;
+  }
+  grpc_millis now = grpc_core::ExecCtx::Get()->Now();
+  grpc_deadline_state* deadline_state = shard->head;
+  while (deadline_state != nullptr) {
+    grpc_deadline_state* next = deadline_state->sweep_next;
+    // Arm the real timer for any call whose deadline could arrive before
+    // the next sweep.  The call cannot be destroyed while it is linked,
+    // and completion takes this shard's lock before looking at
+    // timer_state, so arming here is synchronized with
+    // cancel_timer_if_needed().
+    if (deadline_state->sweep_deadline <= now + 2 * kDeadlineSweepPeriod) {
+      deadline_sweep_unlink_locked(shard, deadline_state);
+      deadline_state->timer_state =
+          deadline_state->arena->New<grpc_core::TimerState>(
+              deadline_state->elem, deadline_state->sweep_deadline);
+    }
+    deadline_state = next;
+  }
+  if (shard->head != nullptr) {
+    grpc_timer_init(&shard->timer, now + kDeadlineSweepPeriod,
+                    &shard->closure);
+  } else {
+    shard->timer_armed = false;
+  }
+  gpr_mu_unlock(&shard->mu);
+}
+
 //
 // grpc_deadline_state
 //
@@ -120,6 +249,12 @@ static void start_timer_if_needed(grpc_call_element* elem,
   grpc_deadline_state* deadline_state =
       static_cast<grpc_deadline_state*>(elem->call_data);
   GPR_ASSERT(deadline_state->timer_state == nullptr);
+  // Far-off deadlines are parked on a sweep list rather than arming a
+  // timer that the call will almost certainly cancel within microseconds.
+  if (deadline - grpc_core::ExecCtx::Get()->Now() > 2 * kDeadlineSweepPeriod) {
+    deadline_sweep_add(deadline_state, deadline);
+    return;
+  }
   deadline_state->timer_state =
       deadline_state->arena->New<grpc_core::TimerState>(elem, deadline);
 }
@@ -128,6 +263,13 @@ static void start_timer_if_needed(grpc_call_element* elem,
 // This is called via the call combiner, so access to deadline_state is
 // synchronized.
 static void cancel_timer_if_needed(grpc_deadline_state* deadline_state) {
+  if (deadline_state->sweep_used) {
+    // If the call is still parked, unparking is all the cancellation
+    // needed.  Otherwise the sweep armed the timer under the shard lock
+    // that deadline_sweep_remove() just took, so timer_state is visible
+    // below.
+    if (deadline_sweep_remove(deadline_state)) return;
+  }
   if (deadline_state->timer_state != nullptr) {
     deadline_state->timer_state->Cancel();
     deadline_state->timer_state = nullptr;
@@ -192,7 +334,8 @@ grpc_deadline_state::grpc_deadline_state(grpc_call_element* elem,
                                          grpc_millis deadline)
     : call_stack(args.call_stack),
       call_combiner(args.call_combiner),
-      arena(args.arena) {
+      arena(args.arena),
+      elem(elem) {
   // Deadline will always be infinite on servers, so the timer will only be
   // set on clients with a finite deadline.
   if (deadline != GRPC_MILLIS_INF_FUTURE) {
@@ -37,7 +37,19 @@ struct grpc_deadline_state {
   grpc_call_stack* call_stack;
   grpc_core::CallCombiner* call_combiner;
   grpc_core::Arena* arena;
+  grpc_call_element* elem;
   grpc_core::TimerState* timer_state = nullptr;
+  // Lazy timer arming for far-off deadlines: instead of arming a per-call
+  // timer immediately, the call is parked on a sharded sweep list and the
+  // timer is only armed if the call survives until its deadline gets close.
+  // Most calls complete long before that, so they never touch the timer
+  // wheel.  The fields below are owned by the sweep shard (see
+  // deadline_filter.cc) while the call is on a sweep list.
+  grpc_millis sweep_deadline = GRPC_MILLIS_INF_FUTURE;
+  bool sweep_used = false;
+  bool sweep_linked = false;
+  grpc_deadline_state* sweep_prev = nullptr;
+  grpc_deadline_state* sweep_next = nullptr;
   // Closure to invoke when we receive trailing metadata.
   // We use this to cancel the timer.
   grpc_closure recv_trailing_metadata_ready;
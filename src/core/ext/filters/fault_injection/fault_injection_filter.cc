@@ -82,6 +82,29 @@ inline bool UnderFraction(const uint32_t numerator,
   return random_number < numerator;
 }
 
+using FaultSamplingState =
+    FaultInjectionMethodParsedConfig::FaultInjectionPolicy::SamplingState;
+
+// Like UnderFraction(), but amortized: instead of rolling a uniform number
+// for every call, the gap until the next fault is drawn from the matching
+// geometric distribution whenever a fault fires, and the calls in between
+// pass with a single decrement-and-branch on the shared counter.
+inline bool UnderFractionSampled(std::atomic<int64_t>* skips,
+                                 const uint32_t numerator,
+                                 const uint32_t denominator) {
+  if (numerator <= 0) return false;
+  if (numerator >= denominator) return true;
+  int64_t prev = skips->fetch_sub(1, std::memory_order_relaxed);
+  if (prev > 0) return false;
+  // The counter is used up; this call fires the fault and draws the gap
+  // until the next one. If several calls race past zero, only the one that
+  // wins the reset injects the fault and the rest pass through.
+  int64_t expected = prev - 1;
+  return skips->compare_exchange_strong(
+      expected, FaultSamplingState::DrawSkips(numerator, denominator),
+      std::memory_order_relaxed);
+}
+
 class ChannelData {
  public:
   static grpc_error_handle Init(grpc_channel_element* elem,
@@ -334,11 +357,9 @@ void CallData::DecideWhetherToInjectFaults(
     grpc_metadata_batch* initial_metadata) {
   FaultInjectionMethodParsedConfig::FaultInjectionPolicy* copied_policy =
       nullptr;
-  // Update the policy with values in initial metadata.
-  if (!fi_policy_->abort_code_header.empty() ||
-      !fi_policy_->abort_percentage_header.empty() ||
-      !fi_policy_->delay_header.empty() ||
-      !fi_policy_->delay_percentage_header.empty()) {
+  // Update the policy with values in initial metadata. Policies without
+  // header overrides never look at the metadata at all.
+  if (fi_policy_->has_header_overrides) {
     // Defer the actual copy until the first matched header.
     auto maybe_copy_policy_func = [this, &copied_policy]() {
       if (copied_policy == nullptr) {
@@ -384,13 +405,31 @@ void CallData::DecideWhetherToInjectFaults(
     });
     if (copied_policy != nullptr) fi_policy_ = copied_policy;
   }
-  // Roll the dice
-  delay_request_ = fi_policy_->delay != 0 &&
-                   UnderFraction(fi_policy_->delay_percentage_numerator,
-                                 fi_policy_->delay_percentage_denominator);
-  abort_request_ = fi_policy_->abort_code != GRPC_STATUS_OK &&
-                   UnderFraction(fi_policy_->abort_percentage_numerator,
-                                 fi_policy_->abort_percentage_denominator);
+  // Roll the dice. Calls running under an unmodified policy draw from the
+  // shared skip counters, so the common non-faulted call costs a single
+  // decrement instead of a fresh random roll; header-overridden policies
+  // changed the fractions, so they keep the per-call roll.
+  FaultSamplingState* sampling =
+      copied_policy == nullptr ? fi_policy_->sampling_state.get() : nullptr;
+  if (sampling != nullptr) {
+    delay_request_ =
+        fi_policy_->delay != 0 &&
+        UnderFractionSampled(&sampling->delay_skips,
+                             fi_policy_->delay_percentage_numerator,
+                             fi_policy_->delay_percentage_denominator);
+    abort_request_ =
+        fi_policy_->abort_code != GRPC_STATUS_OK &&
+        UnderFractionSampled(&sampling->abort_skips,
+                             fi_policy_->abort_percentage_numerator,
+                             fi_policy_->abort_percentage_denominator);
+  } else {
+    delay_request_ = fi_policy_->delay != 0 &&
+                     UnderFraction(fi_policy_->delay_percentage_numerator,
+                                   fi_policy_->delay_percentage_denominator);
+    abort_request_ = fi_policy_->abort_code != GRPC_STATUS_OK &&
+                     UnderFraction(fi_policy_->abort_percentage_numerator,
+                                   fi_policy_->abort_percentage_denominator);
+  }
   if (!delay_request_ && !abort_request_) {
     if (copied_policy != nullptr) copied_policy->~FaultInjectionPolicy();
     // No fault injection for this call
@@ -18,6 +18,8 @@
 
 #include "src/core/ext/filters/fault_injection/service_config_parser.h"
 
+#include <cmath>
+#include <cstdlib>
 #include <vector>
 
 #include "absl/strings/str_cat.h"
@@ -136,6 +138,35 @@ ParseFaultInjectionPolicy(const Json::Array& policies_json_array,
           absl::StrCat("failed to parse faultInjectionPolicy index ", i),
           &sub_error_list));
     }
+    fault_injection_policy.has_header_overrides =
+        !fault_injection_policy.abort_code_header.empty() ||
+        !fault_injection_policy.abort_percentage_header.empty() ||
+        !fault_injection_policy.delay_header.empty() ||
+        !fault_injection_policy.delay_percentage_header.empty();
+    // Seed the shared skip counters so that the first fault injected under
+    // this policy is spaced like every later one.
+    fault_injection_policy.sampling_state = std::make_shared<
+        FaultInjectionMethodParsedConfig::FaultInjectionPolicy::SamplingState>();
+    if (fault_injection_policy.delay_percentage_numerator > 0 &&
+        fault_injection_policy.delay_percentage_numerator <
+            fault_injection_policy.delay_percentage_denominator) {
+      fault_injection_policy.sampling_state->delay_skips.store(
+          FaultInjectionMethodParsedConfig::FaultInjectionPolicy::
+              SamplingState::DrawSkips(
+                  fault_injection_policy.delay_percentage_numerator,
+                  fault_injection_policy.delay_percentage_denominator),
+          std::memory_order_relaxed);
+    }
+    if (fault_injection_policy.abort_percentage_numerator > 0 &&
+        fault_injection_policy.abort_percentage_numerator <
+            fault_injection_policy.abort_percentage_denominator) {
+      fault_injection_policy.sampling_state->abort_skips.store(
+          FaultInjectionMethodParsedConfig::FaultInjectionPolicy::
+              SamplingState::DrawSkips(
+                  fault_injection_policy.abort_percentage_numerator,
+                  fault_injection_policy.abort_percentage_denominator),
+          std::memory_order_relaxed);
+    }
     policies.push_back(std::move(fault_injection_policy));
   }
   return policies;
@@ -143,6 +174,18 @@ ParseFaultInjectionPolicy(const Json::Array& policies_json_array,
 
 }  // namespace
 
+int64_t FaultInjectionMethodParsedConfig::FaultInjectionPolicy::SamplingState::
+    DrawSkips(uint32_t numerator, uint32_t denominator) {
+  GPR_DEBUG_ASSERT(numerator > 0 && numerator < denominator);
+  // Uniform in (0, 1]; uses the same generator as the per-call roll in
+  // fault_injection_filter.cc.
+  const double uniform =
+      (static_cast<double>(rand() % denominator) + 1.0) / denominator;
+  const double fraction =
+      static_cast<double>(numerator) / static_cast<double>(denominator);
+  return static_cast<int64_t>(std::log(uniform) / std::log1p(-fraction));
+}
+
 std::unique_ptr<ServiceConfigParser::ParsedConfig>
 FaultInjectionServiceConfigParser::ParsePerMethodParams(
     const grpc_channel_args* args, const Json& json, grpc_error_handle* error) {
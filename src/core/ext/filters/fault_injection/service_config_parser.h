@@ -19,6 +19,8 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
+#include <memory>
 #include <vector>
 
 #include "src/core/ext/filters/client_channel/service_config.h"
@@ -45,6 +47,28 @@ class FaultInjectionMethodParsedConfig
 
     // By default, the max allowed active faults are unlimited.
     uint32_t max_faults = std::numeric_limits<uint32_t>::max();
+
+    // Set at parse time if any of the four *_header fields above is
+    // non-empty; lets the filter skip inspecting initial metadata entirely
+    // for policies that do not use header overrides.
+    bool has_header_overrides = false;
+
+    // Shared by every call that evaluates this parsed policy. Holds, per
+    // fault kind, the number of calls still allowed to pass before the next
+    // fault decision fires; refreshed with a fresh geometric sample whenever
+    // a counter is consumed. Copies of the policy made for per-call header
+    // overrides share the pointer but never consult it, since the overridden
+    // fractions no longer match the sampled distribution.
+    struct SamplingState {
+      // Draws from the geometric distribution implied by
+      // numerator/denominator the number of calls to let pass before the
+      // next fault fires. Requires 0 < numerator < denominator.
+      static int64_t DrawSkips(uint32_t numerator, uint32_t denominator);
+
+      std::atomic<int64_t> delay_skips{0};
+      std::atomic<int64_t> abort_skips{0};
+    };
+    std::shared_ptr<SamplingState> sampling_state;
   };
 
   explicit FaultInjectionMethodParsedConfig(
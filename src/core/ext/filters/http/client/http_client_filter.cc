@@ -66,6 +66,10 @@ struct call_data {
     GRPC_CLOSURE_INIT(&recv_trailing_metadata_ready,
                       ::recv_trailing_metadata_ready, elem,
                       grpc_schedule_on_exec_ctx);
+    // When deferred, this closure is re-entered into the call combiner
+    // from recv_initial_metadata_ready().  It takes no locks, so let the
+    // combiner run it inline instead of taking a trip through the ExecCtx.
+    GRPC_CALL_COMBINER_BATCH(&recv_trailing_metadata_ready);
     GRPC_CLOSURE_INIT(&on_send_message_next_done, ::on_send_message_next_done,
                       elem, grpc_schedule_on_exec_ctx);
     GRPC_CLOSURE_INIT(&send_message_on_complete, ::send_message_on_complete,
@@ -23,6 +23,8 @@
 #include <assert.h>
 #include <string.h>
 
+#include <atomic>
+
 #include "absl/types/optional.h"
 
 #include <grpc/compression.h>
@@ -71,6 +73,9 @@ class ChannelData {
     enabled_stream_compression_algorithms_bitset_ =
         grpc_compression_bitset_to_stream_bitset(
             enabled_compression_algorithms_bitset_);
+    adaptive_bypass_threshold_pct_ = grpc_channel_args_find_integer(
+        args->channel_args, GRPC_COMPRESSION_CHANNEL_ADAPTIVE_BYPASS_THRESHOLD,
+        {0, 0, 100});
     GPR_ASSERT(!args->is_last);
   }
 
@@ -90,7 +95,42 @@ class ChannelData {
     return enabled_stream_compression_algorithms_bitset_;
   }
 
+  // Records the outcome of compressing one message, updating the EWMA of
+  // achieved savings. Racing updates may lose a sample; this is a heuristic
+  // and precision does not matter.
+  void RecordCompressionResult(size_t before_size, size_t after_size) {
+    if (adaptive_bypass_threshold_pct_ == 0 || before_size == 0) return;
+    int savings_permille = 0;
+    if (after_size < before_size) {
+      savings_permille =
+          static_cast<int>(1000 - (1000 * after_size) / before_size);
+    }
+    const int old = ewma_savings_permille_.load(std::memory_order_relaxed);
+    ewma_savings_permille_.store(old + (savings_permille - old) / 8,
+                                 std::memory_order_relaxed);
+  }
+
+  // Returns true if compression should be bypassed because the channel's
+  // payload mix has proven incompressible. Every so often a message is
+  // compressed anyway (a probe), so that the EWMA recovers if the payload
+  // mix becomes compressible again.
+  bool ShouldBypassCompression() {
+    if (adaptive_bypass_threshold_pct_ == 0) return false;
+    if (ewma_savings_permille_.load(std::memory_order_relaxed) >=
+        adaptive_bypass_threshold_pct_ * 10) {
+      return false;
+    }
+    if (bypassed_since_probe_.fetch_add(1, std::memory_order_relaxed) %
+            kCompressionProbeInterval ==
+        kCompressionProbeInterval - 1) {
+      return false;  // probe: compress this message to refresh the EWMA
+    }
+    return true;
+  }
+
  private:
+  static constexpr uint32_t kCompressionProbeInterval = 64;
+
   /** The default, channel-level, compression algorithm */
   grpc_compression_algorithm default_compression_algorithm_;
   /** Bitset of enabled compression algorithms */
@@ -99,6 +139,14 @@ class ChannelData {
   uint32_t enabled_message_compression_algorithms_bitset_;
   /** Bitset of enabled stream compression algorithms */
   uint32_t enabled_stream_compression_algorithms_bitset_;
+  /** Percent savings below which compression is adaptively bypassed
+     (0 = adaptive bypass disabled). */
+  int adaptive_bypass_threshold_pct_;
+  /** EWMA of achieved compression savings, in permille. Starts optimistic
+     so that new channels compress until real measurements accumulate. */
+  std::atomic<int> ewma_savings_permille_{1000};
+  /** Messages considered for bypass since the last compression probe. */
+  std::atomic<uint32_t> bypassed_since_probe_{0};
 };
 
 class CallData {
@@ -130,7 +178,7 @@ class CallData {
       grpc_call_element* elem, grpc_transport_stream_op_batch* batch);
 
  private:
-  bool SkipMessageCompression();
+  bool SkipMessageCompression(grpc_call_element* elem);
   void InitializeState(grpc_call_element* elem);
 
   grpc_error_handle ProcessSendInitialMetadata(
@@ -175,7 +223,7 @@ class CallData {
 };
 
 // Returns true if we should skip message compression for the current message.
-bool CallData::SkipMessageCompression() {
+bool CallData::SkipMessageCompression(grpc_call_element* elem) {
   // If the flags of this message indicate that it shouldn't be compressed, we
   // skip message compression.
   uint32_t flags =
@@ -185,7 +233,13 @@ bool CallData::SkipMessageCompression() {
   }
   // If this call doesn't have any message compression algorithm set, skip
   // message compression.
-  return message_compression_algorithm_ == GRPC_MESSAGE_COMPRESS_NONE;
+  if (message_compression_algorithm_ == GRPC_MESSAGE_COMPRESS_NONE) {
+    return true;
+  }
+  // Adaptively skip compression when the channel's recent payloads have
+  // proven incompressible (already-compressed data).
+  ChannelData* channeld = static_cast<ChannelData*>(elem->channel_data);
+  return channeld->ShouldBypassCompression();
 }
 
 // Determines the compression algorithm from the initial metadata and the
@@ -308,12 +362,12 @@ void CallData::FinishSendMessage(grpc_call_element* elem) {
   grpc_slice_buffer_init(&tmp);
   uint32_t send_flags =
       send_message_batch_->payload->send_message.send_message->flags();
+  const size_t before_size = slices_.length;
   bool did_compress =
       grpc_msg_compress(message_compression_algorithm_, &slices_, &tmp);
   if (did_compress) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_compression_trace)) {
       const char* algo_name;
-      const size_t before_size = slices_.length;
       const size_t after_size = tmp.length;
       const float savings_ratio = 1.0f - static_cast<float>(after_size) /
                                              static_cast<float>(before_size);
@@ -338,6 +392,11 @@ void CallData::FinishSendMessage(grpc_call_element* elem) {
     }
   }
   grpc_slice_buffer_destroy_internal(&tmp);
+  // Feed the achieved ratio into the channel's adaptive bypass estimate.
+  // A failed attempt (output not smaller than input) counts as 0% savings.
+  static_cast<ChannelData*>(elem->channel_data)
+      ->RecordCompressionResult(before_size,
+                                did_compress ? slices_.length : before_size);
   // Swap out the original byte stream with our new one and send the
   // batch down.
   new (&replacement_stream_)
@@ -428,7 +487,7 @@ void CallData::StartSendMessageBatch(void* elem_arg,
                                      grpc_error_handle /*unused*/) {
   grpc_call_element* elem = static_cast<grpc_call_element*>(elem_arg);
   CallData* calld = static_cast<CallData*>(elem->call_data);
-  if (calld->SkipMessageCompression()) {
+  if (calld->SkipMessageCompression(elem)) {
     calld->SendMessageBatchContinue(elem);
   } else {
     calld->ContinueReadingSendMessage(elem);
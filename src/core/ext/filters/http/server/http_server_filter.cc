@@ -56,6 +56,11 @@ struct call_data {
     GRPC_CLOSURE_INIT(&recv_trailing_metadata_ready,
                       hs_recv_trailing_metadata_ready, elem,
                       grpc_schedule_on_exec_ctx);
+    // When deferred, this closure is re-entered into the call combiner
+    // from hs_recv_initial_metadata_ready().  It takes no locks, so let
+    // the combiner run it inline instead of taking a trip through the
+    // ExecCtx.
+    GRPC_CALL_COMBINER_BATCH(&recv_trailing_metadata_ready);
   }
 
   ~call_data() {
@@ -25,6 +25,7 @@
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_stack_builder.h"
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/surface/channel_init.h"
 #include "src/core/lib/transport/http2_errors.h"
@@ -37,10 +38,14 @@
 #define DEFAULT_MAX_CONNECTION_IDLE_MS INT_MAX
 #define MAX_CONNECTION_AGE_JITTER 0.1
 
+#define DEFAULT_LOAD_SHED_PERIOD_MS 10000
+
 #define MAX_CONNECTION_AGE_INTEGER_OPTIONS \
   { DEFAULT_MAX_CONNECTION_AGE_MS, 1, INT_MAX }
 #define MAX_CONNECTION_IDLE_INTEGER_OPTIONS \
   { DEFAULT_MAX_CONNECTION_IDLE_MS, 1, INT_MAX }
+#define LOAD_SHED_PERIOD_INTEGER_OPTIONS \
+  { DEFAULT_LOAD_SHED_PERIOD_MS, 100, INT_MAX }
 
 /* States for idle_state in channel_data */
 #define MAX_IDLE_STATE_INIT ((gpr_atm)0)
@@ -144,6 +149,26 @@ struct channel_data {
   gpr_atm idle_state;
   /* Time when the channel finished its last outstanding call, in grpc_millis */
   gpr_atm last_enter_idle_time_millis;
+  /* Load shedding state; only used when a threshold provider channel arg is
+     present. Not owned. */
+  grpc_server_load_threshold_provider* load_threshold_provider;
+  /* Period at which this connection's call rate is sampled */
+  grpc_millis load_shed_period;
+  /* The timer driving load sampling */
+  grpc_timer load_shed_timer;
+  /* True if the load_shed timer callback is currently pending */
+  bool load_shed_timer_pending ABSL_GUARDED_BY(max_age_timer_mu) = false;
+  /* True once a graceful drain GOAWAY has been initiated for this connection,
+     either by max_age or by load shedding; prevents initiating a second
+     drain and re-using start_max_age_grace_timer_after_goaway_op. */
+  bool draining ABSL_GUARDED_BY(max_age_timer_mu) = false;
+  /* Closure to run when the load_shed timer fires */
+  grpc_closure load_shed_timer_cb;
+  /* Closure to run when the init of the channel stack is done and the
+     load_shed timer should be started */
+  grpc_closure start_load_shed_timer_after_init;
+  /* Number of calls started since the last load sample was taken */
+  gpr_atm calls_started_in_period;
 };
 }  // namespace
 
@@ -243,6 +268,10 @@ class ConnectivityWatcher : public AsyncConnectivityStateWatcherInterface {
         grpc_timer_cancel(&chand_->max_age_grace_timer);
         chand_->max_age_grace_timer_pending = false;
       }
+      if (chand_->load_shed_timer_pending) {
+        grpc_timer_cancel(&chand_->load_shed_timer);
+        chand_->load_shed_timer_pending = false;
+      }
     }
     /* If there are no active calls, this increasement will cancel
        max_idle_timer, and prevent max_idle_timer from being started in the
@@ -297,6 +326,86 @@ static void start_max_age_grace_timer_after_goaway_op(
                            "max_age start_max_age_grace_timer_after_goaway_op");
 }
 
+/* Time at which the last load-shed GOAWAY was sent, process wide. Shedding is
+   bounded to one connection per sampling period per process so that a
+   mis-published threshold cannot drain a server's whole connection set at
+   once. */
+static gpr_atm g_last_load_shed_time_millis;
+
+static bool acquire_load_shed_token(grpc_millis now,
+                                    grpc_millis min_interval) {
+  while (true) {
+    gpr_atm last = gpr_atm_acq_load(&g_last_load_shed_time_millis);
+    if (now - static_cast<grpc_millis>(last) < min_interval) return false;
+    if (gpr_atm_rel_cas(&g_last_load_shed_time_millis, last,
+                        static_cast<gpr_atm>(now))) {
+      return true;
+    }
+  }
+}
+
+static void start_load_shed_timer_after_init(void* arg,
+                                             grpc_error_handle /*error*/) {
+  channel_data* chand = static_cast<channel_data*>(arg);
+  {
+    grpc_core::MutexLock lock(&chand->max_age_timer_mu);
+    chand->load_shed_timer_pending = true;
+    GRPC_CHANNEL_STACK_REF(chand->channel_stack, "max_age load_shed_timer");
+    grpc_timer_init(&chand->load_shed_timer,
+                    grpc_core::ExecCtx::Get()->Now() + chand->load_shed_period,
+                    &chand->load_shed_timer_cb);
+  }
+  GRPC_CHANNEL_STACK_UNREF(chand->channel_stack,
+                           "max_age start_load_shed_timer_after_init");
+}
+
+static void load_shed_timer_cb(void* arg, grpc_error_handle error) {
+  channel_data* chand = static_cast<channel_data*>(arg);
+  bool shed = false;
+  bool rescheduled = false;
+  if (error == GRPC_ERROR_NONE) {
+    grpc_millis now = grpc_core::ExecCtx::Get()->Now();
+    /* Calls started per second over the elapsed period */
+    const double rate =
+        static_cast<double>(
+            gpr_atm_full_xchg(&chand->calls_started_in_period, 0)) *
+        1000.0 / static_cast<double>(chand->load_shed_period);
+    const double threshold = chand->load_threshold_provider->get_threshold(
+        chand->load_threshold_provider->user_data);
+    grpc_core::MutexLock lock(&chand->max_age_timer_mu);
+    chand->load_shed_timer_pending = false;
+    if (threshold > 0 && rate > threshold && !chand->draining &&
+        acquire_load_shed_token(now, chand->load_shed_period)) {
+      chand->draining = true;
+      shed = true;
+    } else if (!chand->draining) {
+      /* Keep sampling; the channel stack ref taken for the timer carries
+         over to the next tick. */
+      chand->load_shed_timer_pending = true;
+      grpc_timer_init(&chand->load_shed_timer, now + chand->load_shed_period,
+                      &chand->load_shed_timer_cb);
+      rescheduled = true;
+    }
+  }
+  if (shed) {
+    /* Same graceful drain as max_age: a GOAWAY op followed by the grace
+       timer that force-closes stragglers. */
+    GRPC_CHANNEL_STACK_REF(chand->channel_stack,
+                           "max_age start_max_age_grace_timer_after_goaway_op");
+    grpc_transport_op* op = grpc_make_transport_op(
+        &chand->start_max_age_grace_timer_after_goaway_op);
+    op->goaway_error =
+        grpc_error_set_int(GRPC_ERROR_CREATE_FROM_STATIC_STRING("load_shed"),
+                           GRPC_ERROR_INT_HTTP2_ERROR, GRPC_HTTP2_NO_ERROR);
+    grpc_channel_element* elem =
+        grpc_channel_stack_element(chand->channel_stack, 0);
+    elem->filter->start_transport_op(elem, op);
+  }
+  if (!rescheduled) {
+    GRPC_CHANNEL_STACK_UNREF(chand->channel_stack, "max_age load_shed_timer");
+  }
+}
+
 static void close_max_idle_channel(channel_data* chand) {
   /* Prevent the max idle timer from being set again */
   gpr_atm_no_barrier_fetch_add(&chand->call_count, 1);
@@ -355,11 +464,16 @@ static void max_idle_timer_cb(void* arg, grpc_error_handle error) {
 
 static void close_max_age_channel(void* arg, grpc_error_handle error) {
   channel_data* chand = static_cast<channel_data*>(arg);
+  bool already_draining;
   {
     grpc_core::MutexLock lock(&chand->max_age_timer_mu);
     chand->max_age_timer_pending = false;
+    /* Load shedding may have started a graceful drain already, in which case
+       the GOAWAY below (and the grace timer closure) must not be repeated. */
+    already_draining = chand->draining;
+    chand->draining = true;
   }
-  if (error == GRPC_ERROR_NONE) {
+  if (error == GRPC_ERROR_NONE && !already_draining) {
     GRPC_CHANNEL_STACK_REF(chand->channel_stack,
                            "max_age start_max_age_grace_timer_after_goaway_op");
     grpc_transport_op* op = grpc_make_transport_op(
@@ -418,6 +532,9 @@ static grpc_error_handle max_age_init_call_elem(
     grpc_call_element* elem, const grpc_call_element_args* /*args*/) {
   channel_data* chand = static_cast<channel_data*>(elem->channel_data);
   increase_call_count(chand);
+  if (chand->load_threshold_provider != nullptr) {
+    gpr_atm_no_barrier_fetch_add(&chand->calls_started_in_period, 1);
+  }
   return GRPC_ERROR_NONE;
 }
 
@@ -447,6 +564,9 @@ static grpc_error_handle max_age_init_channel_elem(
                                    : DEFAULT_MAX_CONNECTION_IDLE_MS;
   chand->idle_state = MAX_IDLE_STATE_INIT;
   gpr_atm_no_barrier_store(&chand->last_enter_idle_time_millis, GPR_ATM_MIN);
+  chand->load_threshold_provider = nullptr;
+  chand->load_shed_period = DEFAULT_LOAD_SHED_PERIOD_MS;
+  gpr_atm_no_barrier_store(&chand->calls_started_in_period, 0);
   for (size_t i = 0; i < args->channel_args->num_args; ++i) {
     if (0 == strcmp(args->channel_args->args[i].key,
                     GRPC_ARG_MAX_CONNECTION_AGE_MS)) {
@@ -468,6 +588,17 @@ static grpc_error_handle max_age_init_channel_elem(
           &args->channel_args->args[i], MAX_CONNECTION_IDLE_INTEGER_OPTIONS);
       chand->max_connection_idle =
           value == INT_MAX ? GRPC_MILLIS_INF_FUTURE : value;
+    } else if (0 == strcmp(args->channel_args->args[i].key,
+                           GRPC_ARG_SERVER_LOAD_SHED_THRESHOLD_PROVIDER)) {
+      if (args->channel_args->args[i].type == GRPC_ARG_POINTER) {
+        chand->load_threshold_provider =
+            static_cast<grpc_server_load_threshold_provider*>(
+                args->channel_args->args[i].value.pointer.p);
+      }
+    } else if (0 == strcmp(args->channel_args->args[i].key,
+                           GRPC_ARG_SERVER_LOAD_SHED_PERIOD_MS)) {
+      chand->load_shed_period = grpc_channel_arg_get_integer(
+          &args->channel_args->args[i], LOAD_SHED_PERIOD_INTEGER_OPTIONS);
     }
   }
   GRPC_CLOSURE_INIT(&chand->max_idle_timer_cb, max_idle_timer_cb, chand,
@@ -486,6 +617,11 @@ static grpc_error_handle max_age_init_channel_elem(
   GRPC_CLOSURE_INIT(&chand->start_max_age_grace_timer_after_goaway_op,
                     start_max_age_grace_timer_after_goaway_op, chand,
                     grpc_schedule_on_exec_ctx);
+  GRPC_CLOSURE_INIT(&chand->load_shed_timer_cb, load_shed_timer_cb, chand,
+                    grpc_schedule_on_exec_ctx);
+  GRPC_CLOSURE_INIT(&chand->start_load_shed_timer_after_init,
+                    start_load_shed_timer_after_init, chand,
+                    grpc_schedule_on_exec_ctx);
 
   if (chand->max_connection_age != GRPC_MILLIS_INF_FUTURE) {
     /* When the channel reaches its max age, we send down an op with
@@ -512,6 +648,14 @@ static grpc_error_handle max_age_init_channel_elem(
                             &chand->start_max_idle_timer_after_init,
                             GRPC_ERROR_NONE);
   }
+
+  if (chand->load_threshold_provider != nullptr) {
+    GRPC_CHANNEL_STACK_REF(chand->channel_stack,
+                           "max_age start_load_shed_timer_after_init");
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION,
+                            &chand->start_load_shed_timer_after_init,
+                            GRPC_ERROR_NONE);
+  }
   return GRPC_ERROR_NONE;
 }
 
@@ -521,6 +665,23 @@ static void max_age_destroy_channel_elem(grpc_channel_element* elem) {
   chand->~channel_data();
 }
 
+static void* load_threshold_provider_arg_copy(void* p) { return p; }
+static void load_threshold_provider_arg_destroy(void* /*p*/) {}
+static int load_threshold_provider_arg_cmp(void* a, void* b) {
+  return grpc_core::QsortCompare(a, b);
+}
+
+static const grpc_arg_pointer_vtable load_threshold_provider_arg_vtable = {
+    load_threshold_provider_arg_copy, load_threshold_provider_arg_destroy,
+    load_threshold_provider_arg_cmp};
+
+grpc_arg grpc_server_load_threshold_provider_to_arg(
+    grpc_server_load_threshold_provider* provider) {
+  return grpc_channel_arg_pointer_create(
+      const_cast<char*>(GRPC_ARG_SERVER_LOAD_SHED_THRESHOLD_PROVIDER),
+      provider, &load_threshold_provider_arg_vtable);
+}
+
 const grpc_channel_filter grpc_max_age_filter = {
     grpc_call_next_op,
     grpc_channel_next_op,
@@ -544,7 +705,10 @@ static bool maybe_add_max_age_filter(grpc_channel_stack_builder* builder,
           MAX_CONNECTION_AGE_INTEGER_OPTIONS) != INT_MAX ||
       grpc_channel_arg_get_integer(
           grpc_channel_args_find(channel_args, GRPC_ARG_MAX_CONNECTION_IDLE_MS),
-          MAX_CONNECTION_IDLE_INTEGER_OPTIONS) != INT_MAX;
+          MAX_CONNECTION_IDLE_INTEGER_OPTIONS) != INT_MAX ||
+      grpc_channel_args_find_pointer<grpc_server_load_threshold_provider>(
+          channel_args, GRPC_ARG_SERVER_LOAD_SHED_THRESHOLD_PROVIDER) !=
+          nullptr;
   if (enable) {
     return grpc_channel_stack_builder_prepend_filter(
         builder, &grpc_max_age_filter, nullptr, nullptr);
@@ -23,4 +23,29 @@
 
 extern const grpc_channel_filter grpc_max_age_filter;
 
+// Channel arg (pointer): a grpc_server_load_threshold_provider used to drive
+// load-based connection shedding on a server. Use
+// grpc_server_load_threshold_provider_to_arg to construct the arg. The
+// provider must outlive the server.
+#define GRPC_ARG_SERVER_LOAD_SHED_THRESHOLD_PROVIDER \
+  "grpc.server_load_shed_threshold_provider"
+
+// Channel arg (integer): period in milliseconds at which per-connection load
+// is sampled and compared against the provider's threshold.
+#define GRPC_ARG_SERVER_LOAD_SHED_PERIOD_MS "grpc.server_load_shed_period_ms"
+
+// Publishes the fleet-relative load threshold to the load shedding machinery.
+// get_threshold is called from a timer thread once per sampling period per
+// connection; it returns the per-connection load threshold in calls started
+// per second. Connections whose call rate exceeds the threshold are drained
+// with a graceful GOAWAY (at a bounded, process-wide rate). Returning a value
+// <= 0 disables shedding until the next sample.
+typedef struct grpc_server_load_threshold_provider {
+  double (*get_threshold)(void* user_data);
+  void* user_data;
+} grpc_server_load_threshold_provider;
+
+grpc_arg grpc_server_load_threshold_provider_to_arg(
+    grpc_server_load_threshold_provider* provider);
+
 #endif /* GRPC_CORE_EXT_FILTERS_MAX_AGE_MAX_AGE_FILTER_H */
@@ -151,6 +151,10 @@ struct call_data {
     GRPC_CLOSURE_INIT(&recv_trailing_metadata_ready,
                       ::recv_trailing_metadata_ready, elem,
                       grpc_schedule_on_exec_ctx);
+    // When deferred, this closure is re-entered into the call combiner
+    // from recv_message_ready().  It takes no locks, so let the combiner
+    // run it inline instead of taking a trip through the ExecCtx.
+    GRPC_CALL_COMBINER_BATCH(&recv_trailing_metadata_ready);
     // Get max sizes from channel data, then merge in per-method config values.
     // Note: Per-method config is only available on the client, so we
     // apply the max request size to the send limit and the max response
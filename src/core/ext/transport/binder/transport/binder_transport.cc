@@ -249,7 +249,11 @@ static void recv_message_locked(void* arg, grpc_error_handle /*error*/) {
       }
       grpc_slice_buffer buf;
       grpc_slice_buffer_init(&buf);
-      grpc_slice_buffer_add(&buf, grpc_slice_from_cpp_string(*args->message));
+      // Hand the message buffer over to a slice directly; the slice's
+      // refcount frees the buffer once the application is done with it, so
+      // the payload is not copied again on its way up the stack.
+      grpc_slice_buffer_add(
+          &buf, grpc_slice_from_cpp_string(std::move(*args->message)));
 
       gbs->sbs.Init(&buf, 0);
       gbs->recv_message->reset(gbs->sbs.get());
@@ -410,17 +414,18 @@ static void perform_stream_op_locked(void* stream_op,
 
         // Only client send method ref.
         GPR_ASSERT(gbt->is_client);
-        tx.SetMethodRef(path);
+        tx.SetMethodRef(std::move(path));
       } else {
         init_md.emplace_back(std::string(key), std::string(value));
       }
     });
-    tx.SetPrefix(init_md);
+    tx.SetPrefix(std::move(init_md));
   }
   if (op->send_message) {
     gpr_log(GPR_INFO, "send_message");
     size_t remaining = op->payload->send_message.send_message->length();
     std::string message_data;
+    message_data.reserve(remaining);
     while (remaining > 0) {
       grpc_slice message_slice;
       // TODO(waynetu): Temporarily assume that the message is ready.
@@ -433,11 +438,11 @@ static void perform_stream_op_locked(void* stream_op,
       uint8_t* p = GRPC_SLICE_START_PTR(message_slice);
       size_t len = GRPC_SLICE_LENGTH(message_slice);
       remaining -= len;
-      message_data += std::string(reinterpret_cast<char*>(p), len);
+      message_data.append(reinterpret_cast<char*>(p), len);
       grpc_slice_unref_internal(message_slice);
     }
     gpr_log(GPR_INFO, "message_data = %s", message_data.c_str());
-    tx.SetData(message_data);
+    tx.SetData(std::move(message_data));
     // TODO(b/192369787): Are we supposed to reset here to avoid
     // use-after-free issue in call.cc?
     op->payload->send_message.send_message.reset();
@@ -467,7 +472,7 @@ static void perform_stream_op_locked(void* stream_op,
     });
     // TODO(mingcl): Will we ever has key-value pair here? According to
     // wireformat client suffix data is always empty.
-    tx.SetSuffix(trailing_metadata);
+    tx.SetSuffix(std::move(trailing_metadata));
   }
   if (op->recv_initial_metadata) {
     gpr_log(GPR_INFO, "recv_initial_metadata");
@@ -88,8 +88,8 @@ binder_status_t f_onTransact(AIBinder* binder, transaction_code_t code,
   }
 }
 
-// StdStringAllocator, ReadString, StdVectorAllocator, and ReadVector's
-// implementations are copied from android/binder_parcel_utils.h
+// StdStringAllocator and ReadString's implementations are copied from
+// android/binder_parcel_utils.h
 // We cannot include the header because it does not compile in C++11
 
 bool StdStringAllocator(void* stringData, int32_t length, char** buffer) {
@@ -106,22 +106,24 @@ binder_status_t AParcelReadString(const AParcel* parcel, std::string* str) {
   return AParcel_readString(parcel, stringData, StdStringAllocator);
 }
 
-template <typename T>
-bool StdVectorAllocator(void* vectorData, int32_t length, T** outBuffer) {
+// Sizes the destination string so that the parcel copies message data into
+// its storage directly, rather than going through a temporary buffer.
+bool StdStringByteArrayAllocator(void* stringData, int32_t length,
+                                 int8_t** outBuffer) {
   if (length < 0) return false;
 
-  std::vector<T>* vec = static_cast<std::vector<T>*>(vectorData);
-  if (static_cast<size_t>(length) > vec->max_size()) return false;
+  std::string* str = static_cast<std::string*>(stringData);
+  if (static_cast<size_t>(length) > str->max_size()) return false;
 
-  vec->resize(static_cast<size_t>(length));
-  *outBuffer = vec->data();
+  str->resize(static_cast<size_t>(length));
+  *outBuffer = reinterpret_cast<int8_t*>(&(*str)[0]);
   return true;
 }
 
-binder_status_t AParcelReadVector(const AParcel* parcel,
-                                  std::vector<uint8_t>* vec) {
-  void* vectorData = static_cast<void*>(vec);
-  return AParcel_readByteArray(parcel, vectorData, StdVectorAllocator<int8_t>);
+binder_status_t AParcelReadByteArray(const AParcel* parcel, std::string* str) {
+  void* stringData = static_cast<void*>(str);
+  return AParcel_readByteArray(parcel, stringData,
+                               StdStringByteArrayAllocator);
 }
 
 }  // namespace
@@ -309,15 +311,9 @@ absl::Status ReadableParcelAndroid::ReadBinder(std::unique_ptr<Binder>* data) {
 }
 
 absl::Status ReadableParcelAndroid::ReadByteArray(std::string* data) {
-  std::vector<uint8_t> vec;
-  if (AParcelReadVector(parcel_, &vec) == STATUS_OK) {
-    data->resize(vec.size());
-    if (!vec.empty()) {
-      memcpy(&((*data)[0]), vec.data(), vec.size());
-    }
-    return absl::OkStatus();
-  }
-  return absl::InternalError("AParcel_readByteArray failed");
+  return AParcelReadByteArray(parcel_, data) == STATUS_OK
+             ? absl::OkStatus()
+             : absl::InternalError("AParcel_readByteArray failed");
 }
 
 absl::Status ReadableParcelAndroid::ReadString(std::string* str) {
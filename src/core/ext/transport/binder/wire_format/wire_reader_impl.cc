@@ -335,7 +335,14 @@ absl::Status WireReaderImpl::ProcessStreamingTransactionImpl(
       RETURN_IF_ERROR(parcel->ReadByteArray(&msg_data));
     }
     gpr_log(GPR_INFO, "msg_data = %s", msg_data.c_str());
-    message_buffer_[code] += msg_data;
+    std::string& buffered = message_buffer_[code];
+    if (buffered.empty()) {
+      // Common case: the message fits in a single transaction (or this is
+      // the first chunk), so no reassembly copy is needed.
+      buffered = std::move(msg_data);
+    } else {
+      buffered += msg_data;
+    }
     if ((flags & kFlagMessageDataIsPartial) == 0) {
       std::string s = std::move(message_buffer_[code]);
       message_buffer_.erase(code);
@@ -50,6 +50,7 @@
 #include "src/core/lib/slice/slice_string_helpers.h"
 #include "src/core/lib/transport/error_utils.h"
 #include "src/core/lib/transport/http2_errors.h"
+#include "src/core/lib/transport/metadata.h"
 #include "src/core/lib/transport/static_metadata.h"
 #include "src/core/lib/transport/status_conversion.h"
 #include "src/core/lib/transport/timeout_encoding.h"
@@ -71,9 +72,18 @@
 
 #define DEFAULT_MIN_RECV_PING_INTERVAL_WITHOUT_DATA_MS 300000 /* 5 minutes */
 #define DEFAULT_MAX_PINGS_BETWEEN_DATA 2
+#define DEFAULT_WRITE_COALESCE_MAX_DELAY_MS 1
 #define DEFAULT_MAX_PING_STRIKES 2
 
 #define DEFAULT_MAX_PENDING_INDUCED_FRAMES 10000
+/* Largest read that will be flattened into one contiguous slice before
+   parsing (see maybe_flatten_read_buffer). */
+#define MAX_READ_FLATTEN_BYTES 4096
+
+/* How long staged non-urgent control frames (ping acks, queued window
+   updates) may wait for a data write to ride on before a write is forced.
+   Window updates accumulated during the wait merge into a single frame. */
+#define DEFAULT_DEFERRED_WRITE_DELAY_MS 2
 
 static int g_default_client_keepalive_time_ms =
     DEFAULT_CLIENT_KEEPALIVE_TIME_MS;
@@ -104,8 +114,14 @@ static void write_action_begin_locked(void* t, grpc_error_handle error);
 static void write_action(void* t, grpc_error_handle error);
 static void write_action_end(void* t, grpc_error_handle error);
 static void write_action_end_locked(void* t, grpc_error_handle error);
+static void write_coalesce_flush(void* t, grpc_error_handle error);
+static void write_coalesce_flush_locked(void* t, grpc_error_handle error);
+static void deferred_write_timer_fired(void* t, grpc_error_handle error);
+static void deferred_write_timer_fired_locked(void* t,
+                                              grpc_error_handle error);
 
 static void read_action(void* t, grpc_error_handle error);
+static void batch_cancel_locked(void* t, grpc_error_handle error);
 static void read_action_locked(void* t, grpc_error_handle error);
 static void continue_read_action_locked(grpc_chttp2_transport* t);
 
@@ -214,6 +230,7 @@ grpc_chttp2_transport::~grpc_chttp2_transport() {
   cl = nullptr;
 
   grpc_slice_buffer_destroy_internal(&read_buffer);
+  grpc_slice_unref_internal(stream_compression_dictionary);
   grpc_chttp2_goaway_parser_destroy(&goaway_parser);
 
   for (i = 0; i < STREAM_LIST_COUNT; i++) {
@@ -281,6 +298,10 @@ static bool read_channel_args(grpc_chttp2_transport* t,
       if (value >= 0) {
         t->hpack_compressor.SetMaxUsableSize(value);
       }
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_HTTP2_HPACK_ADAPTIVE_INDEXING)) {
+      t->hpack_compressor.SetAdaptiveIndexing(
+          grpc_channel_arg_get_bool(&channel_args->args[i], false));
     } else if (0 == strcmp(channel_args->args[i].key,
                            GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA)) {
       t->ping_policy.max_pings_without_data = grpc_channel_arg_get_integer(
@@ -299,10 +320,35 @@ static bool read_channel_args(grpc_chttp2_transport* t,
               grpc_integer_options{
                   g_default_min_recv_ping_interval_without_data_ms, 0,
                   INT_MAX});
+    } else if (0 ==
+               strcmp(channel_args->args[i].key,
+                      GRPC_ARG_EXPERIMENTAL_STREAM_COMPRESSION_DICTIONARY)) {
+      if (channel_args->args[i].type == GRPC_ARG_STRING &&
+          channel_args->args[i].value.string != nullptr) {
+        grpc_slice_unref_internal(t->stream_compression_dictionary);
+        t->stream_compression_dictionary =
+            grpc_slice_from_copied_string(channel_args->args[i].value.string);
+      }
     } else if (0 == strcmp(channel_args->args[i].key,
                            GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE)) {
       t->write_buffer_size = static_cast<uint32_t>(grpc_channel_arg_get_integer(
           &channel_args->args[i], {0, 0, MAX_WRITE_BUFFER_SIZE}));
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_HTTP2_WRITE_COALESCE_MIN_BYTES)) {
+      t->write_coalesce_min_bytes =
+          static_cast<uint32_t>(grpc_channel_arg_get_integer(
+              &channel_args->args[i], {0, 0, MAX_WRITE_BUFFER_SIZE}));
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_HTTP2_WRITE_COALESCE_MAX_DELAY_MS)) {
+      t->write_coalesce_max_delay = grpc_channel_arg_get_integer(
+          &channel_args->args[i],
+          grpc_integer_options{DEFAULT_WRITE_COALESCE_MAX_DELAY_MS, 0,
+                               INT_MAX});
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_HTTP2_WRITE_SCHEDULING_QUANTUM)) {
+      t->write_scheduling_quantum =
+          static_cast<uint32_t>(grpc_channel_arg_get_integer(
+              &channel_args->args[i], {0, 0, MAX_WRITE_BUFFER_SIZE}));
     } else if (0 ==
                strcmp(channel_args->args[i].key, GRPC_ARG_HTTP2_BDP_PROBE)) {
       enable_bdp = grpc_channel_arg_get_bool(&channel_args->args[i], true);
@@ -335,6 +381,10 @@ static bool read_channel_args(grpc_chttp2_transport* t,
                strcmp(channel_args->args[i].key, GRPC_ARG_ENABLE_CHANNELZ)) {
       channelz_enabled = grpc_channel_arg_get_bool(
           &channel_args->args[i], GRPC_ENABLE_CHANNELZ_DEFAULT);
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_EXPERIMENTAL_COLLECT_WRITE_TIMESTAMPS)) {
+      t->collect_write_timestamps =
+          grpc_channel_arg_get_bool(&channel_args->args[i], false);
     } else {
       static const struct {
         const char* channel_arg_name;
@@ -425,15 +475,37 @@ static void configure_transport_ping_policy(grpc_chttp2_transport* t) {
       g_default_min_recv_ping_interval_without_data_ms;
 }
 
+/* Returns keepalive_time stretched by up to 10% of jitter, so that large
+   numbers of connections brought up at the same time spread their keepalive
+   pings out instead of waking in synchronized bursts. The jitter is never
+   negative: pinging earlier than the configured period could earn ping
+   strikes from a peer enforcing a minimum ping interval. Must only be
+   called when keepalive_time is finite. */
+static grpc_millis jittered_keepalive_period(grpc_chttp2_transport* t) {
+  /* Same minimal LCG as backoff.cc; seeded in init_keepalive_pings_if_enabled.
+   */
+  t->keepalive_rng_state = 1103515245 * t->keepalive_rng_state + 12345;
+  const grpc_millis jitter_range = t->keepalive_time / 10;
+  const grpc_millis jitter =
+      jitter_range > 0
+          ? static_cast<grpc_millis>(t->keepalive_rng_state % jitter_range)
+          : 0;
+  return t->keepalive_time + jitter;
+}
+
 static void init_keepalive_pings_if_enabled(grpc_chttp2_transport* t) {
   if (t->keepalive_time != GRPC_MILLIS_INF_FUTURE) {
     t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_WAITING;
+    t->keepalive_rng_state =
+        static_cast<uint32_t>(grpc_core::ExecCtx::Get()->Now()) ^
+        static_cast<uint32_t>(reinterpret_cast<uintptr_t>(t));
     GRPC_CHTTP2_REF_TRANSPORT(t, "init keepalive ping");
     GRPC_CLOSURE_INIT(&t->init_keepalive_ping_locked, init_keepalive_ping, t,
                       grpc_schedule_on_exec_ctx);
-    grpc_timer_init(&t->keepalive_ping_timer,
-                    grpc_core::ExecCtx::Get()->Now() + t->keepalive_time,
-                    &t->init_keepalive_ping_locked);
+    grpc_timer_init(
+        &t->keepalive_ping_timer,
+        grpc_core::ExecCtx::Get()->Now() + jittered_keepalive_period(t),
+        &t->init_keepalive_ping_locked);
   } else {
     // Use GRPC_CHTTP2_KEEPALIVE_STATE_DISABLED to indicate there are no
     //   inflight keeaplive timers
@@ -577,6 +649,9 @@ static void close_transport_locked(grpc_chttp2_transport* t,
     if (t->ping_state.is_delayed_ping_timer_set) {
       grpc_timer_cancel(&t->ping_state.delayed_ping_timer);
     }
+    if (t->deferred_write_timer_set) {
+      grpc_timer_cancel(&t->deferred_write_timer);
+    }
     if (t->have_next_bdp_ping_timer) {
       grpc_timer_cancel(&t->next_bdp_ping_timer);
     }
@@ -932,6 +1007,42 @@ void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
   }
 }
 
+void grpc_chttp2_initiate_write_deferred(
+    grpc_chttp2_transport* t, grpc_chttp2_initiate_write_reason reason) {
+  if (t->deferred_write_timer_set) return;
+  t->deferred_write_timer_set = true;
+  t->deferred_write_reason = reason;
+  GRPC_CHTTP2_REF_TRANSPORT(t, "deferred_write_timer");
+  GRPC_CLOSURE_INIT(&t->deferred_write_timer_locked, deferred_write_timer_fired,
+                    t, grpc_schedule_on_exec_ctx);
+  grpc_timer_init(
+      &t->deferred_write_timer,
+      grpc_core::ExecCtx::Get()->Now() + DEFAULT_DEFERRED_WRITE_DELAY_MS,
+      &t->deferred_write_timer_locked);
+}
+
+static void deferred_write_timer_fired(void* tp, grpc_error_handle error) {
+  grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(tp);
+  t->combiner->Run(
+      GRPC_CLOSURE_INIT(&t->deferred_write_timer_locked,
+                        deferred_write_timer_fired_locked, t, nullptr),
+      GRPC_ERROR_REF(error));
+}
+
+static void deferred_write_timer_fired_locked(void* tp,
+                                              grpc_error_handle error) {
+  grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(tp);
+  t->deferred_write_timer_set = false;
+  if (error == GRPC_ERROR_NONE && t->closed_with_error == GRPC_ERROR_NONE) {
+    // Note that this is not conditional on a write having happened in the
+    // interim: frames staged before an in-flight write began its gathering
+    // pass were not picked up by it, so a (possibly empty and therefore
+    // cheap) pass is always forced here.
+    grpc_chttp2_initiate_write(t, t->deferred_write_reason);
+  }
+  GRPC_CHTTP2_UNREF_TRANSPORT(t, "deferred_write_timer");
+}
+
 void grpc_chttp2_mark_stream_writable(grpc_chttp2_transport* t,
                                       grpc_chttp2_stream* s) {
   if (t->closed_with_error == GRPC_ERROR_NONE &&
@@ -948,6 +1059,18 @@ static const char* begin_writing_desc(bool partial) {
   }
 }
 
+// Refreshes the channelz socket's memory footprint gauges (write buffer,
+// read buffer, hpack tables). Called on the read and write paths where the
+// sizes are already at hand; the stores are relaxed atomics, so the
+// accounting is nearly free.
+static void update_channelz_buffer_footprint(grpc_chttp2_transport* t) {
+  if (t->channelz_socket == nullptr) return;
+  t->channelz_socket->UpdateBufferFootprint(
+      t->outbuf.length, t->read_buffer.length,
+      t->hpack_compressor.table_size(),
+      t->hpack_parser.hpack_table()->mem_used());
+}
+
 static void write_action_begin_locked(void* gt,
                                       grpc_error_handle /*error_ignored*/) {
   GPR_TIMER_SCOPE("write_action_begin_locked", 0);
@@ -963,6 +1086,25 @@ static void write_action_begin_locked(void* gt,
     if (r.partial) {
       GRPC_STATS_INC_HTTP2_PARTIAL_WRITES();
     }
+    if (!r.partial && t->write_coalesce_min_bytes > 0 &&
+        t->outbuf.length < t->write_coalesce_min_bytes &&
+        !t->reading_paused_on_pending_induced_frames) {
+      // This pass gathered fewer bytes than the coalescing threshold: hold
+      // the frames in outbuf and keep the write logically in flight, so
+      // later initiate_write calls move us to WRITING_WITH_MORE and
+      // write_coalesce_flush_locked can fold the frames they produce into
+      // the same endpoint write when the delay expires.
+      set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING,
+                      "begin deferred write for coalescing");
+      GRPC_CHTTP2_REF_TRANSPORT(t, "coalesce_flush");
+      grpc_timer_init(
+          &t->write_coalesce_timer,
+          grpc_core::ExecCtx::Get()->Now() + t->write_coalesce_max_delay,
+          GRPC_CLOSURE_INIT(&t->write_coalesce_flush_locked,
+                            write_coalesce_flush, t,
+                            grpc_schedule_on_exec_ctx));
+      return;
+    }
     set_write_state(t,
                     r.partial ? GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE
                               : GRPC_CHTTP2_WRITE_STATE_WRITING,
@@ -991,6 +1133,7 @@ static void write_action_begin_locked(void* gt,
 static void write_action(void* gt, grpc_error_handle /*error*/) {
   GPR_TIMER_SCOPE("write_action", 0);
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(gt);
+  update_channelz_buffer_footprint(t);
   void* cl = t->cl;
   t->cl = nullptr;
   grpc_endpoint_write(
@@ -1000,6 +1143,45 @@ static void write_action(void* gt, grpc_error_handle /*error*/) {
       cl);
 }
 
+static void write_coalesce_flush(void* tp, grpc_error_handle error) {
+  grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(tp);
+  t->combiner->Run(GRPC_CLOSURE_INIT(&t->write_coalesce_flush_locked,
+                                     write_coalesce_flush_locked, t, nullptr),
+                   GRPC_ERROR_REF(error));
+}
+
+// Flushes a write pass that write_action_begin_locked deferred because it
+// was below the coalescing threshold. If more frames became ready while we
+// waited, gather them first so they ride in the same endpoint write.
+static void write_coalesce_flush_locked(void* tp,
+                                        grpc_error_handle /*error_ignored*/) {
+  grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(tp);
+  GPR_ASSERT(t->write_state != GRPC_CHTTP2_WRITE_STATE_IDLE);
+  if (t->write_state == GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE &&
+      t->closed_with_error == GRPC_ERROR_NONE) {
+    grpc_chttp2_begin_write_result r = grpc_chttp2_begin_write(t);
+    if (r.partial) {
+      GRPC_STATS_INC_HTTP2_PARTIAL_WRITES();
+    }
+    set_write_state(t,
+                    r.partial ? GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE
+                              : GRPC_CHTTP2_WRITE_STATE_WRITING,
+                    "begin coalesced write");
+    if (t->reading_paused_on_pending_induced_frames) {
+      GPR_ASSERT(t->num_pending_induced_frames == 0);
+      GRPC_CHTTP2_IF_TRACING(gpr_log(
+          GPR_INFO,
+          "transport %p : Resuming reading after being paused due to too "
+          "many unwritten SETTINGS ACK, PINGS ACK and RST_STREAM frames",
+          t));
+      t->reading_paused_on_pending_induced_frames = false;
+      continue_read_action_locked(t);
+    }
+  }
+  write_action(t, GRPC_ERROR_NONE);
+  GRPC_CHTTP2_UNREF_TRANSPORT(t, "coalesce_flush");
+}
+
 static void write_action_end(void* tp, grpc_error_handle error) {
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(tp);
   t->combiner->Run(GRPC_CLOSURE_INIT(&t->write_action_end_locked,
@@ -1427,6 +1609,10 @@ static void perform_stream_op_locked(void* stream_op,
       s->stream_compression_ctx = nullptr;
       grpc_slice_buffer_init(&s->compressed_data_buffer);
     }
+    if (op_payload->send_initial_metadata.send_initial_metadata_flags &
+        GRPC_INITIAL_METADATA_LOW_WRITE_PRIORITY) {
+      s->write_weight = 1;
+    }
     s->send_initial_metadata_finished = add_closure_barrier(on_complete);
     s->send_initial_metadata =
         op_payload->send_initial_metadata.send_initial_metadata;
@@ -1453,9 +1639,14 @@ static void perform_stream_op_locked(void* stream_op,
       } else {
         GPR_ASSERT(s->id != 0);
         grpc_chttp2_mark_stream_writable(t, s);
+        // For a batch that carries the whole response the write is initiated
+        // once, by the send_trailing_metadata op below, after the message has
+        // been staged; together with the fusion check in writing.cc this lets
+        // HEADERS, DATA and trailers go out in one endpoint write.
         if (!(op->send_message &&
               (op->payload->send_message.send_message->flags() &
-               GRPC_WRITE_BUFFER_HINT))) {
+               GRPC_WRITE_BUFFER_HINT)) &&
+            !op->send_trailing_metadata) {
           grpc_chttp2_initiate_write(
               t, GRPC_CHTTP2_INITIATE_WRITE_SEND_INITIAL_METADATA);
         }
@@ -1641,11 +1832,53 @@ static void perform_stream_op(grpc_transport* gt, grpc_stream* gs,
 
   GRPC_CHTTP2_STREAM_REF(s, "perform_stream_op");
   op->handler_private.extra_arg = gs;
+  // Cancel-only batches are pushed onto a lock-free stack instead of each
+  // being scheduled on the combiner, so that a burst of cancellations
+  // (e.g. hedged RPCs being mass-cancelled) is drained in one combiner
+  // pass and its RST_STREAM frames are packed into one write. Only the
+  // pusher that finds the stack empty schedules the drain. Reordering a
+  // piggybacked cancel ahead of a previously scheduled batch on the same
+  // stream is benign: it is indistinguishable from the cancellation races
+  // the transport already tolerates.
+  if (op->cancel_stream && !op->send_initial_metadata &&
+      !op->send_trailing_metadata && !op->send_message &&
+      !op->recv_initial_metadata && !op->recv_message &&
+      !op->recv_trailing_metadata) {
+    while (true) {
+      gpr_atm head = gpr_atm_acq_load(&t->cancel_stream_queue);
+      op->handler_private.closure.next_data.scratch =
+          static_cast<uintptr_t>(head);
+      if (gpr_atm_full_cas(&t->cancel_stream_queue, head,
+                           reinterpret_cast<gpr_atm>(op))) {
+        if (head == 0) {
+          GRPC_CHTTP2_REF_TRANSPORT(t, "batch_cancel");
+          t->combiner->Run(GRPC_CLOSURE_INIT(&t->batch_cancel_locked,
+                                             batch_cancel_locked, t, nullptr),
+                           GRPC_ERROR_NONE);
+        }
+        return;
+      }
+    }
+  }
   t->combiner->Run(GRPC_CLOSURE_INIT(&op->handler_private.closure,
                                      perform_stream_op_locked, op, nullptr),
                    GRPC_ERROR_NONE);
 }
 
+static void batch_cancel_locked(void* tp, grpc_error_handle /*error_ignored*/) {
+  grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(tp);
+  gpr_atm head = gpr_atm_full_xchg(&t->cancel_stream_queue, 0);
+  // The stack is LIFO; cancellation order across streams does not matter.
+  while (head != 0) {
+    grpc_transport_stream_op_batch* op =
+        reinterpret_cast<grpc_transport_stream_op_batch*>(head);
+    // Read the link before the op is consumed (and possibly destroyed).
+    head = static_cast<gpr_atm>(op->handler_private.closure.next_data.scratch);
+    perform_stream_op_locked(op, GRPC_ERROR_NONE);
+  }
+  GRPC_CHTTP2_UNREF_TRANSPORT(t, "batch_cancel");
+}
+
 static void cancel_pings(grpc_chttp2_transport* t, grpc_error_handle error) {
   // callback remaining pings: they're not allowed to call into the transport,
   //   and maybe they hold resources that need to be freed
@@ -1862,7 +2095,7 @@ void grpc_chttp2_maybe_complete_recv_initial_metadata(
   }
 }
 
-void grpc_chttp2_maybe_complete_recv_message(grpc_chttp2_transport* /*t*/,
+void grpc_chttp2_maybe_complete_recv_message(grpc_chttp2_transport* t,
                                              grpc_chttp2_stream* s) {
   grpc_error_handle error = GRPC_ERROR_NONE;
   if (s->recv_message_ready != nullptr) {
@@ -1889,8 +2122,8 @@ void grpc_chttp2_maybe_complete_recv_message(grpc_chttp2_transport* /*t*/,
           bool end_of_context;
           if (!s->stream_decompression_ctx) {
             s->stream_decompression_ctx =
-                grpc_stream_compression_context_create(
-                    s->stream_decompression_method);
+                grpc_chttp2_stream_compression_context_create(
+                    t, s->stream_decompression_method);
           }
           if (!grpc_stream_decompress(
                   s->stream_decompression_ctx,
@@ -1983,8 +2216,9 @@ void grpc_chttp2_maybe_complete_recv_trailing_metadata(grpc_chttp2_transport* t,
       } else {
         bool end_of_context;
         if (!s->stream_decompression_ctx) {
-          s->stream_decompression_ctx = grpc_stream_compression_context_create(
-              s->stream_decompression_method);
+          s->stream_decompression_ctx =
+              grpc_chttp2_stream_compression_context_create(
+                  t, s->stream_decompression_method);
         }
         if (!grpc_stream_decompress(
                 s->stream_decompression_ctx, &s->frame_storage,
@@ -2055,6 +2289,9 @@ static void remove_stream(grpc_chttp2_transport* t, uint32_t id,
   }
   grpc_chttp2_list_remove_stalled_by_stream(t, s);
   grpc_chttp2_list_remove_stalled_by_transport(t, s);
+  if (grpc_chttp2_list_remove_cut_through_stream(t, s)) {
+    s->cut_through = false;
+  }
 
   GRPC_ERROR_UNREF(error);
 
@@ -2372,15 +2609,11 @@ static void close_from_api(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
 
   hdr = GRPC_SLICE_MALLOC(9);
   p = GRPC_SLICE_START_PTR(hdr);
-  *p++ = static_cast<uint8_t>(len >> 16);
-  *p++ = static_cast<uint8_t>(len >> 8);
-  *p++ = static_cast<uint8_t>(len);
-  *p++ = GRPC_CHTTP2_FRAME_HEADER;
-  *p++ = GRPC_CHTTP2_DATA_FLAG_END_STREAM | GRPC_CHTTP2_DATA_FLAG_END_HEADERS;
-  *p++ = static_cast<uint8_t>(s->id >> 24);
-  *p++ = static_cast<uint8_t>(s->id >> 16);
-  *p++ = static_cast<uint8_t>(s->id >> 8);
-  *p++ = static_cast<uint8_t>(s->id);
+  grpc_chttp2_fill_frame_header(
+      p, len, GRPC_CHTTP2_FRAME_HEADER,
+      GRPC_CHTTP2_DATA_FLAG_END_STREAM | GRPC_CHTTP2_DATA_FLAG_END_HEADERS,
+      s->id);
+  p += 9;
   GPR_ASSERT(p == GRPC_SLICE_END_PTR(hdr));
 
   grpc_slice_buffer_add(&t->qbuf, hdr);
@@ -2437,8 +2670,14 @@ static void WithUrgency(grpc_chttp2_transport* t,
       break;
     case grpc_core::chttp2::FlowControlAction::Urgency::UPDATE_IMMEDIATELY:
       grpc_chttp2_initiate_write(t, reason);
-      ABSL_FALLTHROUGH_INTENDED;
+      action();
+      break;
     case grpc_core::chttp2::FlowControlAction::Urgency::QUEUE_UPDATE:
+      // Not urgent (flow control is not near stalling): stage the update to
+      // ride on the next data write, bounded by a short deadline so it
+      // cannot be postponed indefinitely. Updates accumulated while staged
+      // merge into a single frame.
+      grpc_chttp2_initiate_write_deferred(t, reason);
       action();
       break;
   }
@@ -2494,6 +2733,29 @@ static grpc_error_handle try_http_parsing(grpc_chttp2_transport* t) {
   return error;
 }
 
+/* A read event delivered as several small slices forces the deframer
+   through its resumable slow paths every time a frame header or hpack
+   block straddles a slice boundary. When the whole read is small, it is
+   cheaper to coalesce it into one contiguous slice up front so the parser
+   only sees a boundary at the true end of the read event. The flattened
+   slice cannot be recycled across reads because parsed DATA sub-slices
+   may outlive the read action. */
+static void maybe_flatten_read_buffer(grpc_chttp2_transport* t) {
+  if (t->read_buffer.count <= 1 ||
+      t->read_buffer.length > MAX_READ_FLATTEN_BYTES) {
+    return;
+  }
+  grpc_slice flat = GRPC_SLICE_MALLOC(t->read_buffer.length);
+  uint8_t* dst = GRPC_SLICE_START_PTR(flat);
+  for (size_t i = 0; i < t->read_buffer.count; i++) {
+    const grpc_slice& s = t->read_buffer.slices[i];
+    memcpy(dst, GRPC_SLICE_START_PTR(s), GRPC_SLICE_LENGTH(s));
+    dst += GRPC_SLICE_LENGTH(s);
+  }
+  grpc_slice_buffer_reset_and_unref_internal(&t->read_buffer);
+  grpc_slice_buffer_add(&t->read_buffer, flat);
+}
+
 static void read_action(void* tp, grpc_error_handle error) {
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(tp);
   t->combiner->Run(
@@ -2517,8 +2779,14 @@ static void read_action_locked(void* tp, grpc_error_handle error) {
   }
   std::swap(err, error);
   GRPC_ERROR_UNREF(err);
+  // Parsing refs sub-slices of read_buffer into streams and deframing unrefs
+  // them again before this closure returns; defer those refcount updates to
+  // a single reconciliation when this scope closes (it also covers the
+  // read_buffer reset below, which drops the buffer's own slice refs).
+  grpc_core::SliceRefDeferralScope slice_ref_deferral;
   if (t->closed_with_error == GRPC_ERROR_NONE) {
     GPR_TIMER_SCOPE("reading_action.parse", 0);
+    maybe_flatten_read_buffer(t);
     size_t i = 0;
     grpc_error_handle errors[3] = {GRPC_ERROR_REF(error), GRPC_ERROR_NONE,
                                    GRPC_ERROR_NONE};
@@ -2535,6 +2803,15 @@ static void read_action_locked(void* tp, grpc_error_handle error) {
       GRPC_ERROR_UNREF(errors[i]);
     }
 
+    /* Close any cut-through delivery windows opened while parsing: the
+       closures scheduled above run as soon as this read action completes,
+       after which the application owns unprocessed_incoming_frames_buffer
+       again. */
+    grpc_chttp2_stream* cut_through_stream;
+    while (grpc_chttp2_list_pop_cut_through_stream(t, &cut_through_stream)) {
+      cut_through_stream->cut_through = false;
+    }
+
     GPR_TIMER_SCOPE("post_parse_locked", 0);
     if (t->initial_window_update != 0) {
       if (t->initial_window_update > 0) {
@@ -2549,6 +2826,8 @@ static void read_action_locked(void* tp, grpc_error_handle error) {
     }
   }
 
+  update_channelz_buffer_footprint(t);
+
   GPR_TIMER_SCOPE("post_reading_action_locked", 0);
   bool keep_reading = false;
   if (error == GRPC_ERROR_NONE && t->closed_with_error != GRPC_ERROR_NONE) {
@@ -2566,9 +2845,12 @@ static void read_action_locked(void* tp, grpc_error_handle error) {
     t->endpoint_reading = 0;
   } else if (t->closed_with_error == GRPC_ERROR_NONE) {
     keep_reading = true;
-    // Since we have read a byte, reset the keepalive timer
+    // Since we have read a byte, the keepalive ping due at the end of the
+    // current period can be suppressed (see init_keepalive_ping_locked);
+    // recording a timestamp is much cheaper than cancelling and re-arming
+    // the timer on every read.
     if (t->keepalive_state == GRPC_CHTTP2_KEEPALIVE_STATE_WAITING) {
-      grpc_timer_cancel(&t->keepalive_ping_timer);
+      t->keepalive_last_read = grpc_core::ExecCtx::Get()->Now();
     }
   }
   grpc_slice_buffer_reset_and_unref_internal(&t->read_buffer);
@@ -2771,8 +3053,20 @@ static void init_keepalive_ping_locked(void* arg, grpc_error_handle error) {
   if (t->destroying || t->closed_with_error != GRPC_ERROR_NONE) {
     t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_DYING;
   } else if (error == GRPC_ERROR_NONE) {
-    if (t->keepalive_permit_without_calls ||
-        grpc_chttp2_stream_map_size(&t->stream_map) > 0) {
+    const grpc_millis now = grpc_core::ExecCtx::Get()->Now();
+    if (t->keepalive_last_read != GRPC_MILLIS_INF_PAST &&
+        now - t->keepalive_last_read < t->keepalive_time) {
+      // Bytes were read during the last period, so the connection has
+      // already proved itself alive; skip this ping and wait out the
+      // remainder of a full period from the last read.
+      GRPC_CHTTP2_REF_TRANSPORT(t, "init keepalive ping");
+      GRPC_CLOSURE_INIT(&t->init_keepalive_ping_locked, init_keepalive_ping, t,
+                        grpc_schedule_on_exec_ctx);
+      grpc_timer_init(&t->keepalive_ping_timer,
+                      t->keepalive_last_read + jittered_keepalive_period(t),
+                      &t->init_keepalive_ping_locked);
+    } else if (t->keepalive_permit_without_calls ||
+               grpc_chttp2_stream_map_size(&t->stream_map) > 0) {
       t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_PINGING;
       GRPC_CHTTP2_REF_TRANSPORT(t, "keepalive ping end");
       grpc_timer_init_unset(&t->keepalive_watchdog_timer);
@@ -2782,18 +3076,20 @@ static void init_keepalive_ping_locked(void* arg, grpc_error_handle error) {
       GRPC_CHTTP2_REF_TRANSPORT(t, "init keepalive ping");
       GRPC_CLOSURE_INIT(&t->init_keepalive_ping_locked, init_keepalive_ping, t,
                         grpc_schedule_on_exec_ctx);
-      grpc_timer_init(&t->keepalive_ping_timer,
-                      grpc_core::ExecCtx::Get()->Now() + t->keepalive_time,
-                      &t->init_keepalive_ping_locked);
+      grpc_timer_init(
+          &t->keepalive_ping_timer,
+          grpc_core::ExecCtx::Get()->Now() + jittered_keepalive_period(t),
+          &t->init_keepalive_ping_locked);
     }
   } else if (error == GRPC_ERROR_CANCELLED) {
     // The keepalive ping timer may be cancelled by bdp
     GRPC_CHTTP2_REF_TRANSPORT(t, "init keepalive ping");
     GRPC_CLOSURE_INIT(&t->init_keepalive_ping_locked, init_keepalive_ping, t,
                       grpc_schedule_on_exec_ctx);
-    grpc_timer_init(&t->keepalive_ping_timer,
-                    grpc_core::ExecCtx::Get()->Now() + t->keepalive_time,
-                    &t->init_keepalive_ping_locked);
+    grpc_timer_init(
+        &t->keepalive_ping_timer,
+        grpc_core::ExecCtx::Get()->Now() + jittered_keepalive_period(t),
+        &t->init_keepalive_ping_locked);
   }
   GRPC_CHTTP2_UNREF_TRANSPORT(t, "init keepalive ping");
 }
@@ -2856,9 +3152,10 @@ static void finish_keepalive_ping_locked(void* arg, grpc_error_handle error) {
       GRPC_CHTTP2_REF_TRANSPORT(t, "init keepalive ping");
       GRPC_CLOSURE_INIT(&t->init_keepalive_ping_locked, init_keepalive_ping, t,
                         grpc_schedule_on_exec_ctx);
-      grpc_timer_init(&t->keepalive_ping_timer,
-                      grpc_core::ExecCtx::Get()->Now() + t->keepalive_time,
-                      &t->init_keepalive_ping_locked);
+      grpc_timer_init(
+          &t->keepalive_ping_timer,
+          grpc_core::ExecCtx::Get()->Now() + jittered_keepalive_period(t),
+          &t->init_keepalive_ping_locked);
     }
   }
   GRPC_CHTTP2_UNREF_TRANSPORT(t, "keepalive ping end");
@@ -3046,8 +3343,9 @@ void Chttp2IncomingByteStream::MaybeCreateStreamDecompressionCtx() {
   GPR_DEBUG_ASSERT(stream_->stream_decompression_method !=
                    GRPC_STREAM_COMPRESSION_IDENTITY_DECOMPRESS);
   if (!stream_->stream_decompression_ctx) {
-    stream_->stream_decompression_ctx = grpc_stream_compression_context_create(
-        stream_->stream_decompression_method);
+    stream_->stream_decompression_ctx =
+        grpc_chttp2_stream_compression_context_create(
+            transport_, stream_->stream_decompression_method);
   }
 }
 
@@ -3180,6 +3478,12 @@ static void benign_reclaimer(void* arg, grpc_error_handle error) {
 
 static void benign_reclaimer_locked(void* arg, grpc_error_handle error) {
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(arg);
+  if (error == GRPC_ERROR_NONE) {
+    // Cheapest tier first: sweep unreferenced interned metadata out of the
+    // global table. This costs nothing connection-visible and can release a
+    // large cold cache fleet-wide before any transport has to disconnect.
+    grpc_mdctx_gc();
+  }
   if (error == GRPC_ERROR_NONE &&
       grpc_chttp2_stream_map_size(&t->stream_map) == 0) {
     // Channel with no active streams: send a goaway to try and make it
@@ -3218,7 +3522,22 @@ static void destructive_reclaimer_locked(void* arg, grpc_error_handle error) {
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(arg);
   size_t n = grpc_chttp2_stream_map_size(&t->stream_map);
   t->destructive_reclaimer_registered = false;
-  if (error == GRPC_ERROR_NONE && n > 0) {
+  if (error == GRPC_ERROR_NONE && t->hpack_compressor.table_size() > 0) {
+    // Dropping the hpack encoder's dynamic table degrades compression for
+    // the rest of the connection but is still cheaper than abandoning a
+    // stream, so it forms its own reclamation round. The peer learns about
+    // it through a table size update on the next HEADERS frame.
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_resource_quota_trace)) {
+      gpr_log(GPR_INFO, "HTTP2: %s - drop hpack encoder table (%u bytes)",
+              t->peer_string.c_str(), t->hpack_compressor.table_size());
+    }
+    t->hpack_compressor.SetMaxUsableSize(0);
+    if (n > 0) {
+      // If the quota is still short it should abandon streams next time
+      // around rather than finding this tier empty and giving up.
+      post_destructive_reclaimer(t);
+    }
+  } else if (error == GRPC_ERROR_NONE && n > 0) {
     grpc_chttp2_stream* s = static_cast<grpc_chttp2_stream*>(
         grpc_chttp2_stream_map_rand(&t->stream_map));
     if (GRPC_TRACE_FLAG_ENABLED(grpc_resource_quota_trace)) {
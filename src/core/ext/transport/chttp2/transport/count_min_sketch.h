@@ -0,0 +1,86 @@
+// Copyright 2021 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_COUNT_MIN_SKETCH_H
+#define GRPC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_COUNT_MIN_SKETCH_H
+
+#include <grpc/impl/codegen/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace grpc_core {
+
+// A count-min sketch over 32-bit hashes: a sharper-resolution alternative to
+// PopularityCount for deciding which literals deserve a slot in the HPACK
+// compression table. Each element is counted in one counter per row (rows
+// use independently mixed indices), and its frequency estimate is the
+// minimum across rows, so two elements only pollute each other's estimates
+// if they collide in every row. Counters are 8-bit and all rows are halved
+// whenever one counter saturates, aging out stale traffic like
+// PopularityCount does.
+template <size_t kRows, size_t kCols>
+class CountMinSketch {
+ public:
+  static_assert((kCols & (kCols - 1)) == 0,
+                "kCols must be a power of two");
+
+  CountMinSketch() : sum_{0}, counters_{} {}
+
+  // Count one occurrence of hash; returns true if this element seems to be
+  // popular (its estimated count is at least twice the per-column average),
+  // false otherwise.
+  bool AddElement(uint32_t hash) {
+    uint8_t estimate = 255;
+    bool saturated = false;
+    for (size_t row = 0; row < kRows; row++) {
+      uint8_t& counter = counters_[row][MixForRow(hash, row)];
+      counter++;
+      if (GPR_UNLIKELY(counter == 255)) saturated = true;
+      if (counter < estimate) estimate = counter;
+    }
+    sum_++;
+    if (GPR_UNLIKELY(saturated)) HalveSketch();
+    return estimate >= 2 * sum_ / kCols;
+  }
+
+ private:
+  static size_t MixForRow(uint32_t hash, size_t row) {
+    // Fibonacci-style multiplicative mix, salted per row.
+    const uint32_t mixed =
+        (hash ^ (0x9e3779b9u * static_cast<uint32_t>(row + 1))) * 2654435761u;
+    return mixed >> (32 - ColBits());
+  }
+
+  static constexpr size_t ColBits(size_t n = kCols) {
+    return n == 1 ? 0 : 1 + ColBits(n / 2);
+  }
+
+  // Halve all counters because one of them saturated.
+  void HalveSketch() {
+    sum_ /= 2;
+    for (size_t row = 0; row < kRows; row++) {
+      for (size_t col = 0; col < kCols; col++) {
+        counters_[row][col] /= 2;
+      }
+    }
+  }
+
+  uint32_t sum_;
+  uint8_t counters_[kRows][kCols];
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_COUNT_MIN_SKETCH_H
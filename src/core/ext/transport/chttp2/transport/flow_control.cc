@@ -362,7 +362,12 @@ FlowControlAction::Urgency TransportFlowControl::DeltaUrgency(
   int64_t delta = value - static_cast<int64_t>(
                               t_->settings[GRPC_LOCAL_SETTINGS][setting_id]);
   // TODO(ncteisen): tune this
-  if (delta != 0 && (delta <= -value / 5 || delta >= value / 5)) {
+  if (delta != 0 && (delta <= -value || delta >= value / 2)) {
+    // The target at least doubled or halved: this is typical of the first
+    // few BDP probes on a high bandwidth-delay link, so advertise the new
+    // value right away instead of waiting for a write to be scheduled.
+    return FlowControlAction::Urgency::UPDATE_IMMEDIATELY;
+  } else if (delta != 0 && (delta <= -value / 5 || delta >= value / 5)) {
     return FlowControlAction::Urgency::QUEUE_UPDATE;
   } else {
     return FlowControlAction::Urgency::NO_ACTION_NEEDED;
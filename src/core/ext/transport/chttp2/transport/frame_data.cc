@@ -73,15 +73,9 @@ void grpc_chttp2_encode_data(uint32_t id, grpc_slice_buffer* inbuf,
   hdr = GRPC_SLICE_MALLOC(header_size);
   p = GRPC_SLICE_START_PTR(hdr);
   GPR_ASSERT(write_bytes < (1 << 24));
-  *p++ = static_cast<uint8_t>(write_bytes >> 16);
-  *p++ = static_cast<uint8_t>(write_bytes >> 8);
-  *p++ = static_cast<uint8_t>(write_bytes);
-  *p++ = GRPC_CHTTP2_FRAME_DATA;
-  *p++ = is_eof ? GRPC_CHTTP2_DATA_FLAG_END_STREAM : 0;
-  *p++ = static_cast<uint8_t>(id >> 24);
-  *p++ = static_cast<uint8_t>(id >> 16);
-  *p++ = static_cast<uint8_t>(id >> 8);
-  *p++ = static_cast<uint8_t>(id);
+  grpc_chttp2_fill_frame_header(
+      p, static_cast<uint32_t>(write_bytes), GRPC_CHTTP2_FRAME_DATA,
+      is_eof ? GRPC_CHTTP2_DATA_FLAG_END_STREAM : 0, id);
   grpc_slice_buffer_add(outbuf, hdr);
 
   grpc_slice_buffer_move_first_no_ref(inbuf, write_bytes, outbuf);
@@ -284,6 +278,18 @@ grpc_error_handle grpc_chttp2_data_parser_parse(void* /*parser*/,
     grpc_slice_ref_internal(slice);
     grpc_slice_buffer_add(&s->frame_storage, slice);
     grpc_chttp2_maybe_complete_recv_message(t, s);
+    /* If a byte stream was handed out above, its recv_message_ready closure
+       cannot run before the current read action completes, so later slices
+       from the same read may cut through to the buffer the application will
+       drain - avoiding a frame_storage detour and a combiner round trip per
+       Next() for large messages. Not safe when stream decompression may have
+       left decompressed bytes in the buffer. */
+    if (s->pending_byte_stream && s->frame_storage.length == 0 &&
+        s->stream_decompression_method ==
+            GRPC_STREAM_COMPRESSION_IDENTITY_DECOMPRESS) {
+      s->cut_through = true;
+      grpc_chttp2_list_add_cut_through_stream(t, s);
+    }
   } else if (s->on_next) {
     GPR_ASSERT(s->frame_storage.length == 0);
     grpc_slice_ref_internal(slice);
@@ -291,6 +297,14 @@ grpc_error_handle grpc_chttp2_data_parser_parse(void* /*parser*/,
     grpc_core::ExecCtx::Run(DEBUG_LOCATION, s->on_next, GRPC_ERROR_NONE);
     s->on_next = nullptr;
     s->unprocessed_incoming_frames_decompressed = false;
+    /* As above: the closure just scheduled cannot run until the read action
+       completes, so keep delivering directly for the rest of it. */
+    s->cut_through = true;
+    grpc_chttp2_list_add_cut_through_stream(t, s);
+  } else if (s->cut_through) {
+    GPR_ASSERT(s->frame_storage.length == 0);
+    grpc_slice_ref_internal(slice);
+    grpc_slice_buffer_add(&s->unprocessed_incoming_frames_buffer, slice);
   } else {
     grpc_slice_ref_internal(slice);
     grpc_slice_buffer_add(&s->frame_storage, slice);
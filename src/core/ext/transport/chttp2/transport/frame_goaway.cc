@@ -157,19 +157,10 @@ void grpc_chttp2_goaway_append(uint32_t last_stream_id, uint32_t error_code,
   GPR_ASSERT(GRPC_SLICE_LENGTH(debug_data) < UINT32_MAX - 4 - 4);
   frame_length = 4 + 4 + static_cast<uint32_t> GRPC_SLICE_LENGTH(debug_data);
 
-  /* frame header: length */
-  *p++ = static_cast<uint8_t>(frame_length >> 16);
-  *p++ = static_cast<uint8_t>(frame_length >> 8);
-  *p++ = static_cast<uint8_t>(frame_length);
-  /* frame header: type */
-  *p++ = GRPC_CHTTP2_FRAME_GOAWAY;
-  /* frame header: flags */
-  *p++ = 0;
-  /* frame header: stream id */
-  *p++ = 0;
-  *p++ = 0;
-  *p++ = 0;
-  *p++ = 0;
+  /* frame header */
+  grpc_chttp2_fill_frame_header(p, frame_length, GRPC_CHTTP2_FRAME_GOAWAY, 0,
+                                0);
+  p += 9;
   /* payload: last stream id */
   *p++ = static_cast<uint8_t>(last_stream_id >> 24);
   *p++ = static_cast<uint8_t>(last_stream_id >> 16);
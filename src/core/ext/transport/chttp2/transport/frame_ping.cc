@@ -35,15 +35,8 @@ grpc_slice grpc_chttp2_ping_create(uint8_t ack, uint64_t opaque_8bytes) {
   grpc_slice slice = GRPC_SLICE_MALLOC(9 + 8);
   uint8_t* p = GRPC_SLICE_START_PTR(slice);
 
-  *p++ = 0;
-  *p++ = 0;
-  *p++ = 8;
-  *p++ = GRPC_CHTTP2_FRAME_PING;
-  *p++ = ack ? 1 : 0;
-  *p++ = 0;
-  *p++ = 0;
-  *p++ = 0;
-  *p++ = 0;
+  grpc_chttp2_fill_frame_header(p, 8, GRPC_CHTTP2_FRAME_PING, ack ? 1 : 0, 0);
+  p += 9;
   *p++ = static_cast<uint8_t>(opaque_8bytes >> 56);
   *p++ = static_cast<uint8_t>(opaque_8bytes >> 48);
   *p++ = static_cast<uint8_t>(opaque_8bytes >> 40);
@@ -119,7 +112,10 @@ grpc_error_handle grpc_chttp2_ping_parser_parse(void* parser,
         }
         t->num_pending_induced_frames++;
         t->ping_acks[t->ping_ack_count++] = p->opaque_8bytes;
-        grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_PING_RESPONSE);
+        /* The ack need not go out on its own: let it ride on the next data
+           write if one happens within the deferral deadline. */
+        grpc_chttp2_initiate_write_deferred(
+            t, GRPC_CHTTP2_INITIATE_WRITE_PING_RESPONSE);
       }
     }
   }
@@ -38,19 +38,9 @@ grpc_slice grpc_chttp2_rst_stream_create(uint32_t id, uint32_t code,
   if (stats != nullptr) stats->framing_bytes += frame_size;
   uint8_t* p = GRPC_SLICE_START_PTR(slice);
 
-  // Frame size.
-  *p++ = 0;
-  *p++ = 0;
-  *p++ = 4;
-  // Frame type.
-  *p++ = GRPC_CHTTP2_FRAME_RST_STREAM;
-  // Flags.
-  *p++ = 0;
-  // Stream ID.
-  *p++ = static_cast<uint8_t>(id >> 24);
-  *p++ = static_cast<uint8_t>(id >> 16);
-  *p++ = static_cast<uint8_t>(id >> 8);
-  *p++ = static_cast<uint8_t>(id);
+  // Frame header.
+  grpc_chttp2_fill_frame_header(p, 4, GRPC_CHTTP2_FRAME_RST_STREAM, 0, id);
+  p += 9;
   // Error code.
   *p++ = static_cast<uint8_t>(code >> 24);
   *p++ = static_cast<uint8_t>(code >> 16);
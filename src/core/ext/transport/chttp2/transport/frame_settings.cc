@@ -34,16 +34,9 @@
 #include "src/core/lib/transport/http2_errors.h"
 
 static uint8_t* fill_header(uint8_t* out, uint32_t length, uint8_t flags) {
-  *out++ = static_cast<uint8_t>(length >> 16);
-  *out++ = static_cast<uint8_t>(length >> 8);
-  *out++ = static_cast<uint8_t>(length);
-  *out++ = GRPC_CHTTP2_FRAME_SETTINGS;
-  *out++ = flags;
-  *out++ = 0;
-  *out++ = 0;
-  *out++ = 0;
-  *out++ = 0;
-  return out;
+  grpc_chttp2_fill_frame_header(out, length, GRPC_CHTTP2_FRAME_SETTINGS, flags,
+                                0);
+  return out + 9;
 }
 
 grpc_slice grpc_chttp2_settings_create(uint32_t* old_settings,
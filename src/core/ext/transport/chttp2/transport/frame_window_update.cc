@@ -37,15 +37,8 @@ grpc_slice grpc_chttp2_window_update_create(
 
   GPR_ASSERT(window_delta);
 
-  *p++ = 0;
-  *p++ = 0;
-  *p++ = 4;
-  *p++ = GRPC_CHTTP2_FRAME_WINDOW_UPDATE;
-  *p++ = 0;
-  *p++ = static_cast<uint8_t>(id >> 24);
-  *p++ = static_cast<uint8_t>(id >> 16);
-  *p++ = static_cast<uint8_t>(id >> 8);
-  *p++ = static_cast<uint8_t>(id);
+  grpc_chttp2_fill_frame_header(p, 4, GRPC_CHTTP2_FRAME_WINDOW_UPDATE, 0, id);
+  p += 9;
   *p++ = static_cast<uint8_t>(window_delta >> 24);
   *p++ = static_cast<uint8_t>(window_delta >> 16);
   *p++ = static_cast<uint8_t>(window_delta >> 8);
@@ -68,15 +68,7 @@ static void FillHeader(uint8_t* p, uint8_t type, uint32_t id, size_t len,
      which has a max allowable value of 16777215 (see chttp_transport.cc).
      Thus, the following assert can be a debug assert. */
   GPR_DEBUG_ASSERT(len < 16777316);
-  *p++ = static_cast<uint8_t>(len >> 16);
-  *p++ = static_cast<uint8_t>(len >> 8);
-  *p++ = static_cast<uint8_t>(len);
-  *p++ = type;
-  *p++ = flags;
-  *p++ = static_cast<uint8_t>(id >> 24);
-  *p++ = static_cast<uint8_t>(id >> 16);
-  *p++ = static_cast<uint8_t>(id >> 8);
-  *p++ = static_cast<uint8_t>(id);
+  grpc_chttp2_fill_frame_header(p, static_cast<uint32_t>(len), type, flags, id);
 }
 
 size_t HPackCompressor::Framer::CurrentFrameSize() const {
@@ -400,13 +392,17 @@ void HPackCompressor::Framer::EncodeDynamic(grpc_mdelem elem) {
                           GRPC_MDELEM_DATA(elem))
                           ->hash();
     bool can_add_to_hashtable =
-        compressor_->filter_elems_.AddElement(elem_hash % kNumFilterValues);
+        compressor_->adaptive_indexing_
+            ? compressor_->sketch_elems_.AddElement(elem_hash)
+            : compressor_->filter_elems_.AddElement(elem_hash %
+                                                    kNumFilterValues);
     /* is this elem currently in the decoders table? */
     auto indices_key =
         compressor_->elem_index_.Lookup(KeyElem(elem, elem_hash));
     if (indices_key.has_value() &&
         compressor_->table_.ConvertableToDynamicIndex(*indices_key)) {
       EmitIndexed(compressor_->table_.DynamicIndex(*indices_key));
+      RecordTemplateElem(elem, *indices_key, /*is_static=*/false);
       return;
     }
     /* Didn't hit either cuckoo index, so no emit. */
@@ -448,15 +444,136 @@ void HPackCompressor::Framer::EncodeDynamic(grpc_mdelem elem) {
   }
 }
 
+// Pick the metadata template led by the first element of an initial metadata
+// batch, or claim a slot to record a new one.
+void HPackCompressor::Framer::SelectTemplate(grpc_mdelem md) {
+  for (size_t i = 0; i < compressor_->num_metadata_templates_; i++) {
+    MetadataTemplate* tmpl = &compressor_->metadata_templates_[i];
+    if (tmpl->num_elems > 0 && tmpl->elems[0].payload == md.payload) {
+      template_ = tmpl;
+      template_state_ = TemplateState::kMatch;
+      return;
+    }
+  }
+  // No template led by this element yet: record one, recycling slots in
+  // FIFO order once all are in use (like the timeout cache above).
+  MetadataTemplate* slot;
+  if (compressor_->num_metadata_templates_ < kNumMetadataTemplates) {
+    slot = &compressor_
+                ->metadata_templates_[compressor_->num_metadata_templates_++];
+  } else {
+    slot =
+        &compressor_->metadata_templates_[compressor_->next_metadata_template_];
+    compressor_->next_metadata_template_ =
+        (compressor_->next_metadata_template_ + 1) % kNumMetadataTemplates;
+    compressor_->InvalidateTemplate(slot);
+  }
+  template_ = slot;
+  template_state_ = TemplateState::kRecord;
+}
+
+// Replay one element of the selected metadata template. Returns false if the
+// batch diverges from the recorded run or a recorded table entry has been
+// evicted; the element then goes through the regular encoding path.
+bool HPackCompressor::Framer::TryMatchTemplate(grpc_mdelem md) {
+  MetadataTemplate* tmpl = template_;
+  if (template_pos_ == tmpl->num_elems ||
+      tmpl->elems[template_pos_].payload != md.payload) {
+    // The batch diverged from the recorded run: the template stays valid
+    // (this may be a one-off batch), but the rest of this batch takes the
+    // regular path.
+    template_state_ = TemplateState::kOff;
+    return false;
+  }
+  const uint32_t index = tmpl->indices[template_pos_];
+  if (!tmpl->is_static[template_pos_] &&
+      !compressor_->table_.ConvertableToDynamicIndex(index)) {
+    // A recorded element was evicted from the table: drop the template and
+    // re-record once the elements have been re-indexed.
+    compressor_->InvalidateTemplate(tmpl);
+    template_state_ = TemplateState::kOff;
+    return false;
+  }
+#ifndef NDEBUG
+  if (GRPC_SLICE_START_PTR(GRPC_MDKEY(md))[0] != ':') {
+    seen_regular_header_ = true;
+  }
+#endif
+  EmitIndexed(tmpl->is_static[template_pos_]
+                  ? index
+                  : compressor_->table_.DynamicIndex(index));
+  template_pos_++;
+  return true;
+}
+
+// Append an element that was emitted as a pure index reference to the
+// template under recording.
+void HPackCompressor::Framer::RecordTemplateElem(grpc_mdelem md,
+                                                 uint32_t index,
+                                                 bool is_static) {
+  if (template_state_ != TemplateState::kRecord) return;
+  template_->elems[template_pos_] = GRPC_MDELEM_REF(md);
+  template_->indices[template_pos_] = index;
+  template_->is_static[template_pos_] = is_static;
+  template_pos_++;
+  if (template_pos_ == MetadataTemplate::kMaxElems) EndTemplate();
+}
+
+// Commit a template under recording and stop templating for the remainder of
+// the batch. Recorded entries only become visible to later batches here, so
+// there is no partially recorded state to unwind.
+void HPackCompressor::Framer::EndTemplate() {
+  if (template_state_ == TemplateState::kRecord) {
+    template_->num_elems = template_pos_;
+  }
+  template_state_ = TemplateState::kOff;
+}
+
 void HPackCompressor::Framer::EncodeDeadline(grpc_millis deadline) {
+  // Deadlines differ from call to call, so they never belong in a template.
+  EndTemplate();
+  const grpc_millis timeout = grpc_http2_round_timeout(
+      deadline - grpc_core::ExecCtx::Get()->Now());
+  for (size_t i = 0; i < compressor_->num_cached_timeouts_; i++) {
+    if (compressor_->cached_timeouts_[i].timeout == timeout) {
+      EncodeDynamic(compressor_->cached_timeouts_[i].mdelem);
+      return;
+    }
+  }
   char timeout_str[GRPC_HTTP2_TIMEOUT_ENCODE_MIN_BUFSIZE];
-  grpc_mdelem mdelem;
-  grpc_http2_encode_timeout(deadline - grpc_core::ExecCtx::Get()->Now(),
-                            timeout_str);
-  mdelem = grpc_mdelem_from_slices(
+  grpc_http2_encode_timeout(timeout, timeout_str);
+  grpc_mdelem mdelem = grpc_mdelem_from_slices(
       GRPC_MDSTR_GRPC_TIMEOUT, grpc_core::UnmanagedMemorySlice(timeout_str));
   EncodeDynamic(mdelem);
-  GRPC_MDELEM_UNREF(mdelem);
+  // Keep the built mdelem for later calls with the same rounded timeout,
+  // recycling cache slots in FIFO order once the cache is full.
+  CachedTimeout* slot;
+  if (compressor_->num_cached_timeouts_ < kNumCachedTimeouts) {
+    slot = &compressor_->cached_timeouts_[compressor_->num_cached_timeouts_++];
+  } else {
+    slot = &compressor_->cached_timeouts_[compressor_->next_cached_timeout_];
+    compressor_->next_cached_timeout_ =
+        (compressor_->next_cached_timeout_ + 1) % kNumCachedTimeouts;
+    GRPC_MDELEM_UNREF(slot->mdelem);
+  }
+  slot->timeout = timeout;
+  slot->mdelem = mdelem;
+}
+
+HPackCompressor::~HPackCompressor() {
+  for (size_t i = 0; i < num_cached_timeouts_; i++) {
+    GRPC_MDELEM_UNREF(cached_timeouts_[i].mdelem);
+  }
+  for (size_t i = 0; i < num_metadata_templates_; i++) {
+    InvalidateTemplate(&metadata_templates_[i]);
+  }
+}
+
+void HPackCompressor::InvalidateTemplate(MetadataTemplate* tmpl) {
+  for (size_t i = 0; i < tmpl->num_elems; i++) {
+    GRPC_MDELEM_UNREF(tmpl->elems[i]);
+  }
+  tmpl->num_elems = 0;
 }
 
 void HPackCompressor::SetMaxUsableSize(uint32_t max_table_size) {
@@ -484,6 +601,8 @@ HPackCompressor::Framer::Framer(const EncodeHeaderOptions& options,
       output_(output),
       stats_(options.stats),
       compressor_(compressor),
+      template_state_(options.is_initial_metadata ? TemplateState::kSelect
+                                                  : TemplateState::kOff),
       prefix_(BeginFrame()) {
   if (absl::exchange(compressor_->advertise_table_size_change_, false)) {
     AdvertiseTableSizeChange();
@@ -491,16 +610,27 @@ HPackCompressor::Framer::Framer(const EncodeHeaderOptions& options,
 }
 
 void HPackCompressor::Framer::Encode(grpc_mdelem md) {
+  if (template_state_ == TemplateState::kSelect) SelectTemplate(md);
+  if (template_state_ == TemplateState::kMatch && TryMatchTemplate(md)) return;
   if (GRPC_MDELEM_STORAGE(md) == GRPC_MDELEM_STORAGE_STATIC) {
     const uintptr_t static_index =
         reinterpret_cast<grpc_core::StaticMetadata*>(GRPC_MDELEM_DATA(md))
             ->StaticIndex();
     if (static_index < hpack_constants::kLastStaticEntry) {
-      EmitIndexed(static_cast<uint32_t>(static_index + 1));
+      const uint32_t index = static_cast<uint32_t>(static_index + 1);
+      EmitIndexed(index);
+      RecordTemplateElem(md, index, /*is_static=*/true);
       return;
     }
   }
+  const size_t pos_before = template_pos_;
   EncodeDynamic(md);
+  // EncodeDynamic() records into the template only when it emitted a pure
+  // index reference; a literal emission ends the constant prefix.
+  if (template_state_ == TemplateState::kRecord &&
+      template_pos_ == pos_before) {
+    EndTemplate();
+  }
 }
 
 }  // namespace grpc_core
@@ -24,6 +24,7 @@
 #include <grpc/slice.h>
 #include <grpc/slice_buffer.h>
 
+#include "src/core/ext/transport/chttp2/transport/count_min_sketch.h"
 #include "src/core/ext/transport/chttp2/transport/frame.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder_index.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder_table.h"
@@ -80,24 +81,34 @@ metadata_detail::ConcatMetadata<A, B> ConcatMetadata(const A& a, const B& b) {
 class HPackCompressor {
  public:
   HPackCompressor() = default;
-  ~HPackCompressor() = default;
+  ~HPackCompressor();
 
   // Maximum table size we'll actually use.
   static constexpr uint32_t kMaxTableSize = 1024 * 1024;
 
   void SetMaxTableSize(uint32_t max_table_size);
   void SetMaxUsableSize(uint32_t max_table_size);
+  // Use a count-min sketch instead of the coarse popularity filter when
+  // deciding which literals to promote into the compression table. See
+  // GRPC_ARG_HTTP2_HPACK_ADAPTIVE_INDEXING.
+  void SetAdaptiveIndexing(bool enable) { adaptive_indexing_ = enable; }
 
   uint32_t test_only_table_size() const {
     return table_.test_only_table_size();
   }
 
+  // Current dynamic table size, for channelz memory accounting.
+  uint32_t table_size() const { return table_.test_only_table_size(); }
+
   struct EncodeHeaderOptions {
     uint32_t stream_id;
     bool is_end_of_stream;
     bool use_true_binary_metadata;
     size_t max_frame_size;
     grpc_transport_one_way_stats* stats;
+    // True when encoding a send-initial-metadata batch: enables the
+    // metadata template cache for the constant leading run of headers.
+    bool is_initial_metadata;
   };
 
   template <typename HeaderSet>
@@ -107,11 +118,18 @@ class HPackCompressor {
     headers.Encode(&framer);
   }
 
+ private:
+  struct MetadataTemplate;
+
+ public:
   class Framer {
    public:
     Framer(const EncodeHeaderOptions& options, HPackCompressor* compressor,
            grpc_slice_buffer* output);
-    ~Framer() { FinishFrame(true); }
+    ~Framer() {
+      EndTemplate();
+      FinishFrame(true);
+    }
 
     Framer(const Framer&) = delete;
     Framer& operator=(const Framer&) = delete;
@@ -137,6 +155,22 @@ class HPackCompressor {
     void EncodeDynamic(grpc_mdelem elem);
     static GPR_ATTRIBUTE_NOINLINE void Log(grpc_mdelem elem);
 
+    // Metadata template handling (see MetadataTemplate below).
+    enum class TemplateState : uint8_t {
+      // not an initial metadata batch, or templating ended for this batch
+      kOff,
+      // initial metadata: waiting on the first element to pick a template
+      kSelect,
+      // replaying a previously recorded template
+      kMatch,
+      // recording a new template
+      kRecord,
+    };
+    void SelectTemplate(grpc_mdelem md);
+    bool TryMatchTemplate(grpc_mdelem md);
+    void RecordTemplateElem(grpc_mdelem md, uint32_t index, bool is_static);
+    void EndTemplate();
+
     void EmitLitHdrIncIdx(uint32_t key_index, grpc_mdelem elem);
     void EmitLitHdrNotIdx(uint32_t key_index, grpc_mdelem elem);
     void EmitLitHdrWithStringKeyIncIdx(grpc_mdelem elem);
@@ -160,6 +194,10 @@ class HPackCompressor {
     grpc_slice_buffer* const output_;
     grpc_transport_one_way_stats* const stats_;
     HPackCompressor* const compressor_;
+    TemplateState template_state_;
+    MetadataTemplate* template_ = nullptr;
+    // elements matched (or recorded) against template_ so far
+    size_t template_pos_ = 0;
     FramePrefix prefix_;
   };
 
@@ -189,6 +227,54 @@ class HPackCompressor {
   // been seen. When that count reaches max (255), all values are halved.
   grpc_core::PopularityCount<kNumFilterValues> filter_elems_;
 
+  // When adaptive indexing is enabled, emission frequencies are tracked in
+  // this sketch instead: its per-row mixing makes hot application headers
+  // (tracing ids, tenant ids) much less likely to lose their popularity
+  // signal to a hash collision than in the 64-slot filter above.
+  bool adaptive_indexing_ = false;
+  grpc_core::CountMinSketch<4, 256> sketch_elems_;
+
+  // Small cache of recently emitted grpc-timeout values. Deadlines cluster
+  // around a handful of canonical timeouts and the wire encoding rounds to
+  // three significant figures, so most calls re-emit an identical header
+  // value; caching the built mdelem saves the format, slice creation and
+  // mdelem lookup on those calls. Only touched from the transport's write
+  // path, so no synchronization is needed.
+  struct CachedTimeout {
+    grpc_millis timeout;
+    grpc_mdelem mdelem;
+  };
+  static constexpr size_t kNumCachedTimeouts = 4;
+  CachedTimeout cached_timeouts_[kNumCachedTimeouts];
+  size_t num_cached_timeouts_ = 0;
+  size_t next_cached_timeout_ = 0;
+
+  // Templates for the constant run of headers that begins every initial
+  // metadata batch sent on a channel (:path/:scheme/:authority/te/
+  // content-type/user-agent on clients, :status/content-type on servers).
+  // After those elements have been emitted once they are all pure index
+  // references into the compression tables, so rather than re-running the
+  // hash and index lookups for every call we remember the element
+  // identities and their table positions and replay the index emissions
+  // directly. Entries record absolute table positions rather than wire
+  // indices because HPACK wire indices shift with every later insertion;
+  // positions are re-based (and re-checked for eviction) at replay time.
+  // Only touched from the transport's write path, so no synchronization is
+  // needed.
+  struct MetadataTemplate {
+    static constexpr size_t kMaxElems = 8;
+    grpc_mdelem elems[kMaxElems];  // owned refs, released on invalidation
+    // wire index for static elements, absolute table position otherwise
+    uint32_t indices[kMaxElems];
+    bool is_static[kMaxElems];
+    size_t num_elems = 0;
+  };
+  static constexpr size_t kNumMetadataTemplates = 4;
+  void InvalidateTemplate(MetadataTemplate* tmpl);
+  MetadataTemplate metadata_templates_[kNumMetadataTemplates];
+  size_t num_metadata_templates_ = 0;
+  size_t next_metadata_template_ = 0;
+
   class KeyElem {
    public:
     class Stored {
@@ -692,6 +692,10 @@ class HPackParser::String {
     if (pfx->huff) {
       // Huffman coded
       std::vector<uint8_t> output;
+      // The shortest HPACK Huffman code is 5 bits, so decoding can expand the
+      // input by at most 8/5; reserving that up front keeps the per-byte emit
+      // path free of reallocation.
+      output.reserve(8 * static_cast<size_t>(pfx->length) / 5 + 1);
       auto v = ParseHuff(input, pfx->length,
                          [&output](uint8_t c) { output.push_back(c); });
       if (!v) return {};
@@ -717,6 +721,8 @@ class HPackParser::String {
     } else {
       // Huffman encoded...
       std::vector<uint8_t> decompressed;
+      // See Parse(): 8/5 is the worst-case Huffman expansion.
+      decompressed.reserve(8 * static_cast<size_t>(pfx->length) / 5 + 1);
       // State here says either we don't know if it's base64 or binary, or we do
       // and what is it.
       enum class State { kUnsure, kBinary, kBase64 };
@@ -42,21 +42,20 @@ HPackTable::HPackTable() = default;
 
 HPackTable::~HPackTable() {
   for (size_t i = 0; i < num_entries_; i++) {
-    GRPC_MDELEM_UNREF(entries_[(first_entry_ + i) % entries_.size()]);
+    GRPC_MDELEM_UNREF(entries_[(first_entry_ + i) % entries_.size()].md);
   }
 }
 
 /* Evict one element from the table */
 void HPackTable::EvictOne() {
-  grpc_mdelem first_entry = entries_[first_entry_];
-  size_t elem_bytes = GRPC_SLICE_LENGTH(GRPC_MDKEY(first_entry)) +
-                      GRPC_SLICE_LENGTH(GRPC_MDVALUE(first_entry)) +
-                      hpack_constants::kEntryOverhead;
-  GPR_ASSERT(elem_bytes <= mem_used_);
-  mem_used_ -= static_cast<uint32_t>(elem_bytes);
+  const Entry first_entry = entries_[first_entry_];
+  // The entry carries its hpack-accounted size, so eviction doesn't need to
+  // touch the element's slices.
+  GPR_ASSERT(first_entry.elem_bytes <= mem_used_);
+  mem_used_ -= first_entry.elem_bytes;
   first_entry_ = ((first_entry_ + 1) % entries_.size());
   num_entries_--;
-  GRPC_MDELEM_UNREF(first_entry);
+  GRPC_MDELEM_UNREF(first_entry.md);
 }
 
 void HPackTable::Rebuild(uint32_t new_cap) {
@@ -147,8 +146,8 @@ grpc_error_handle HPackTable::Add(grpc_mdelem md) {
   }
 
   // copy the finalized entry in
-  entries_[(first_entry_ + num_entries_) % entries_.size()] =
-      GRPC_MDELEM_REF(md);
+  entries_[(first_entry_ + num_entries_) % entries_.size()] = {
+      GRPC_MDELEM_REF(md), static_cast<uint32_t>(elem_bytes)};
 
   // update accounting values
   num_entries_++;
@@ -31,6 +31,17 @@
 
 namespace grpc_core {
 
+namespace hpack_table_detail {
+// Hint the CPU to pull addr into cache ahead of an expected read.
+inline void PrefetchForRead(const void* addr) {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(addr, /*rw=*/0, /*locality=*/3);
+#else
+  (void)addr;
+#endif
+}
+}  // namespace hpack_table_detail
+
 // HPACK header table
 class HPackTable {
  public:
@@ -54,9 +65,19 @@ class HPackTable {
   // Current entry count in the table.
   uint32_t num_entries() const { return num_entries_; }
 
+  // Current hpack-accounted memory used by the table.
+  uint32_t mem_used() const { return mem_used_; }
+
  private:
   enum { kInlineEntries = hpack_constants::kInitialTableEntries };
-  using EntriesVec = absl::InlinedVector<grpc_mdelem, kInlineEntries>;
+  // A dynamic table entry: the element together with its hpack-accounted
+  // size, stored contiguously so that eviction and size accounting never
+  // need to dereference the element's slices.
+  struct Entry {
+    grpc_mdelem md;
+    uint32_t elem_bytes;
+  };
+  using EntriesVec = absl::InlinedVector<Entry, kInlineEntries>;
 
   /* lookup a table entry based on its hpack index */
   template <bool take_ref>
@@ -81,7 +102,17 @@ class HPackTable {
     if (tbl_index < num_entries_) {
       uint32_t offset =
           (num_entries_ - 1u - tbl_index + first_entry_) % entries_.size();
-      grpc_mdelem md = entries_[offset];
+      grpc_mdelem md = entries_[offset].md;
+      // Indexed fields tend to arrive in runs, so start pulling the
+      // neighboring (next higher index) entry's element data into cache
+      // while the parser works on this one.
+      if (tbl_index + 1 < num_entries_) {
+        const uint32_t next_offset =
+            offset == 0 ? static_cast<uint32_t>(entries_.size()) - 1u
+                        : offset - 1u;
+        hpack_table_detail::PrefetchForRead(
+            GRPC_MDELEM_DATA(entries_[next_offset].md));
+      }
       if (take_ref) {
         GRPC_MDELEM_REF(md);
       }
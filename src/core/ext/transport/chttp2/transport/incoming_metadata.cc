@@ -35,8 +35,15 @@ grpc_error_handle grpc_chttp2_incoming_metadata_buffer_add(
     storage = &buffer->preallocated_mdelems[buffer->count];
     buffer->count++;
   } else {
-    storage = static_cast<grpc_linked_mdelem*>(
-        buffer->arena->Alloc(sizeof(grpc_linked_mdelem)));
+    if (buffer->overflow_chunk == nullptr ||
+        buffer->overflow_used == buffer->kOverflowChunkElems) {
+      buffer->overflow_chunk =
+          static_cast<grpc_linked_mdelem*>(buffer->arena->Alloc(
+              buffer->kOverflowChunkElems * sizeof(grpc_linked_mdelem)));
+      buffer->overflow_used = 0;
+    }
+    storage = &buffer->overflow_chunk[buffer->overflow_used];
+    buffer->overflow_used++;
   }
   storage->md = elem;
   return buffer->batch.LinkTail(storage);
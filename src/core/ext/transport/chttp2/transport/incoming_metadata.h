@@ -29,12 +29,19 @@ struct grpc_chttp2_incoming_metadata_buffer {
   ~grpc_chttp2_incoming_metadata_buffer() = default;
 
   static constexpr size_t kPreallocatedMDElem = 10;
+  // Elements past kPreallocatedMDElem are carved out of arena chunks of this
+  // many entries, so a long header list stays contiguous in memory instead of
+  // scattering one arena allocation per element.
+  static constexpr size_t kOverflowChunkElems = 8;
 
   grpc_core::Arena* arena;
   size_t size = 0;   // total size of metadata.
   size_t count = 0;  // minimum of count of metadata and kPreallocatedMDElem.
   // These preallocated mdelems are used while count < kPreallocatedMDElem.
   grpc_linked_mdelem preallocated_mdelems[kPreallocatedMDElem];
+  // Current overflow chunk and how many of its entries are used.
+  grpc_linked_mdelem* overflow_chunk = nullptr;
+  size_t overflow_used = 0;
   grpc_metadata_batch batch;
 };
 
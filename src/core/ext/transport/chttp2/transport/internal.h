@@ -63,6 +63,10 @@ typedef enum {
   /** streams that are waiting to start because there are too many concurrent
       streams on the connection */
   GRPC_CHTTP2_LIST_WAITING_FOR_CONCURRENCY,
+  /** streams whose parsed DATA payload slices are being delivered straight
+      into unprocessed_incoming_frames_buffer for the remainder of the
+      current read action (see grpc_chttp2_data_parser_parse) */
+  GRPC_CHTTP2_LIST_CUT_THROUGH,
   STREAM_LIST_COUNT /* must be last */
 } grpc_chttp2_stream_list_id;
 
@@ -326,6 +330,13 @@ struct grpc_chttp2_transport {
 
   grpc_closure read_action_locked;
 
+  /** LIFO stack of cancel-only stream op batches, pushed lock-free from
+      arbitrary threads and drained in a single combiner pass so that a
+      cancellation storm costs one combiner run and one write instead of
+      one per stream (see batch_cancel_locked in chttp2_transport.cc) */
+  gpr_atm cancel_stream_queue = 0;
+  grpc_closure batch_cancel_locked;
+
   /** incoming read bytes */
   grpc_slice_buffer read_buffer;
 
@@ -356,6 +367,18 @@ struct grpc_chttp2_transport {
    */
   uint32_t write_buffer_size = grpc_core::chttp2::kDefaultWindow;
 
+  /** when non-zero, a begin_write pass that gathered fewer bytes than this
+      is held in outbuf for up to write_coalesce_max_delay so that frames
+      from later passes share one endpoint write */
+  uint32_t write_coalesce_min_bytes = 0;
+  /** longest time (ms) a sub-threshold write pass may be deferred */
+  grpc_millis write_coalesce_max_delay = 1;
+  /** when non-zero, writable streams are serviced in weighted turns of
+      (quantum * stream write_weight) bytes instead of being drained FIFO */
+  uint32_t write_scheduling_quantum = 0;
+  grpc_timer write_coalesce_timer;
+  grpc_closure write_coalesce_flush_locked;
+
   /** Set to a grpc_error object if a goaway frame is received. By default, set
    * to GRPC_ERROR_NONE */
   grpc_error_handle goaway_error = GRPC_ERROR_NONE;
@@ -387,6 +410,16 @@ struct grpc_chttp2_transport {
   uint64_t ping_ctr = 0; /* unique id for pings */
   grpc_closure retry_initiate_ping_locked;
 
+  /** Staged-control-frame flush timer: non-urgent control frames (ping acks,
+      queued window updates) wait up to a short deadline for a data write to
+      ride on; when this timer fires a write is forced so they cannot be
+      postponed indefinitely. */
+  grpc_timer deferred_write_timer;
+  bool deferred_write_timer_set = false;
+  grpc_chttp2_initiate_write_reason deferred_write_reason =
+      GRPC_CHTTP2_INITIATE_WRITE_INITIAL_WRITE;
+  grpc_closure deferred_write_timer_locked;
+
   /** ping acks */
   size_t ping_ack_count = 0;
   size_t ping_ack_capacity = 0;
@@ -479,6 +512,13 @@ struct grpc_chttp2_transport {
   grpc_timer keepalive_watchdog_timer;
   /** time duration in between pings */
   grpc_millis keepalive_time;
+  /** time of the most recent read from the endpoint, used to suppress the
+      keepalive ping at the end of a period in which the connection already
+      proved itself alive */
+  grpc_millis keepalive_last_read = GRPC_MILLIS_INF_PAST;
+  /** rng state used to jitter keepalive deadlines, so that many connections
+      brought up together do not wake and write in synchronized bursts */
+  uint32_t keepalive_rng_state = 0;
   /** grace period for a ping to complete before watchdog kicks in */
   grpc_millis keepalive_timeout;
   /** if keepalive pings are allowed when there's no outstanding streams */
@@ -488,6 +528,15 @@ struct grpc_chttp2_transport {
   /** keep-alive state machine state */
   grpc_chttp2_keepalive_state keepalive_state;
   grpc_core::ContextList* cl = nullptr;
+  /** if set (GRPC_ARG_EXPERIMENTAL_COLLECT_WRITE_TIMESTAMPS), every stream
+      write is timestamped and reported to the call's attempt tracer, with a
+      userspace-clock fallback when the endpoint cannot collect kernel
+      timestamps */
+  bool collect_write_timestamps = false;
+  /** shared dictionary used to seed every stream compression context on
+      this transport (GRPC_ARG_EXPERIMENTAL_STREAM_COMPRESSION_DICTIONARY);
+      empty when unset */
+  grpc_slice stream_compression_dictionary = grpc_empty_slice();
   grpc_core::RefCountedPtr<grpc_core::channelz::SocketNode> channelz_socket;
   uint32_t num_messages_in_next_write = 0;
   /** The number of pending induced frames (SETTINGS_ACK, PINGS_ACK and
@@ -524,12 +573,27 @@ struct grpc_chttp2_stream {
   grpc_closure destroy_stream;
   grpc_closure* destroy_stream_arg;
 
+  /* The list links, list membership flags, id, flow control counters and
+     scheduling weight below are the fields the write and parse loops touch
+     on every visit to a stream; they are declared together so that high
+     stream churn keeps them within a few cache lines. */
   grpc_chttp2_stream_link links[STREAM_LIST_COUNT];
   uint8_t included[STREAM_LIST_COUNT] = {};
 
   /** HTTP2 stream id for this stream, or zero if one has not been assigned */
   uint32_t id = 0;
 
+  /** weight used by weighted write scheduling: with the transport's
+      write_scheduling_quantum enabled, one scheduling turn may emit at most
+      (quantum * write_weight) flow-controlled bytes from this stream */
+  uint8_t write_weight = 16;
+
+  grpc_core::PolymorphicManualConstructor<
+      grpc_core::chttp2::StreamFlowControlBase,
+      grpc_core::chttp2::StreamFlowControl,
+      grpc_core::chttp2::StreamFlowControlDisabled>
+      flow_control;
+
   /** things the upper layers would like to send */
   grpc_metadata_batch* send_initial_metadata = nullptr;
   grpc_closure* send_initial_metadata_finished = nullptr;
@@ -596,6 +660,13 @@ struct grpc_chttp2_stream {
 
   grpc_closure* on_next = nullptr;  /* protected by t combiner */
   bool pending_byte_stream = false; /* protected by t combiner */
+  /** True while parsed DATA payload slices may bypass frame_storage and be
+      appended directly to unprocessed_incoming_frames_buffer: the closure
+      that hands the buffer to the application was scheduled during the read
+      action that is still executing, so the application cannot observe the
+      buffer before the read action completes. Always reset before the read
+      action finishes. Protected by t combiner. */
+  bool cut_through = false;
   // cached length of buffer to be used by the transport thread in cases where
   // stream->pending_byte_stream == true. The value is saved before
   // application threads are allowed to modify
@@ -612,6 +683,10 @@ struct grpc_chttp2_stream {
 
   grpc_millis deadline = GRPC_MILLIS_INF_FUTURE;
 
+  /** time this stream entered one of the flow control stalled lists, or 0
+      if it is not currently stalled */
+  grpc_millis stalled_since = 0;
+
   /** saw some stream level error */
   grpc_error_handle forced_close_error = GRPC_ERROR_NONE;
   /** how many header frames have we received? */
@@ -627,12 +702,6 @@ struct grpc_chttp2_stream {
   bool sent_initial_metadata = false;
   bool sent_trailing_metadata = false;
 
-  grpc_core::PolymorphicManualConstructor<
-      grpc_core::chttp2::StreamFlowControlBase,
-      grpc_core::chttp2::StreamFlowControl,
-      grpc_core::chttp2::StreamFlowControlDisabled>
-      flow_control;
-
   grpc_slice_buffer flow_controlled_buffer;
 
   grpc_chttp2_write_cb* on_flow_controlled_cbs = nullptr;
@@ -689,6 +758,24 @@ struct grpc_chttp2_stream {
 void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
                                 grpc_chttp2_initiate_write_reason reason);
 
+/** Creates a stream compression or decompression context for a stream on
+    transport \a t, seeding it with the transport's shared dictionary when
+    one is configured. */
+inline grpc_stream_compression_context*
+grpc_chttp2_stream_compression_context_create(
+    grpc_chttp2_transport* t, grpc_stream_compression_method method) {
+  return grpc_stream_compression_context_create_with_dictionary(
+      method, &t->stream_compression_dictionary);
+}
+
+/** As above, but for control frames that do not have to go out immediately
+    (ping acks, non-urgent window updates): the write is deferred for a short
+    while so that the staged frames can ride on an upcoming data write
+    instead of triggering a dedicated small write; a flush is forced once the
+    deadline expires. */
+void grpc_chttp2_initiate_write_deferred(
+    grpc_chttp2_transport* t, grpc_chttp2_initiate_write_reason reason);
+
 struct grpc_chttp2_begin_write_result {
   /** are we writing? */
   bool writing;
@@ -747,6 +834,13 @@ bool grpc_chttp2_list_pop_stalled_by_stream(grpc_chttp2_transport* t,
 bool grpc_chttp2_list_remove_stalled_by_stream(grpc_chttp2_transport* t,
                                                grpc_chttp2_stream* s);
 
+void grpc_chttp2_list_add_cut_through_stream(grpc_chttp2_transport* t,
+                                             grpc_chttp2_stream* s);
+bool grpc_chttp2_list_pop_cut_through_stream(grpc_chttp2_transport* t,
+                                             grpc_chttp2_stream** s);
+bool grpc_chttp2_list_remove_cut_through_stream(grpc_chttp2_transport* t,
+                                                grpc_chttp2_stream* s);
+
 /********* Flow Control ***************/
 
 // Takes in a flow control action and performs all the needed operations.
@@ -110,6 +110,22 @@ grpc_error_handle grpc_chttp2_perform_read(grpc_chttp2_transport* t,
       ABSL_FALLTHROUGH_INTENDED;
     case GRPC_DTS_FH_0:
       GPR_DEBUG_ASSERT(cur < end);
+      /* fast path: the whole nine byte frame header is available in this
+         slice, so decode it in one pass instead of one byte per state */
+      if (static_cast<size_t>(end - cur) >= 9) {
+        t->incoming_frame_size = (static_cast<uint32_t>(cur[0]) << 16) |
+                                 (static_cast<uint32_t>(cur[1]) << 8) |
+                                 static_cast<uint32_t>(cur[2]);
+        t->incoming_frame_type = cur[3];
+        t->incoming_frame_flags = cur[4];
+        t->incoming_stream_id = ((static_cast<uint32_t>(cur[5]) & 0x7f) << 24) |
+                                (static_cast<uint32_t>(cur[6]) << 16) |
+                                (static_cast<uint32_t>(cur[7]) << 8) |
+                                static_cast<uint32_t>(cur[8]);
+        /* leave cur on the last header byte, as GRPC_DTS_FH_8 does */
+        cur += 8;
+        goto dts_fh_8;
+      }
       t->incoming_frame_size = (static_cast<uint32_t>(*cur)) << 16;
       if (++cur == end) {
         t->deframe_state = GRPC_DTS_FH_1;
@@ -175,6 +191,7 @@ grpc_error_handle grpc_chttp2_perform_read(grpc_chttp2_transport* t,
     case GRPC_DTS_FH_8:
       GPR_DEBUG_ASSERT(cur < end);
       t->incoming_stream_id |= (static_cast<uint32_t>(*cur));
+    dts_fh_8:
       t->deframe_state = GRPC_DTS_FRAME;
       err = init_frame_parser(t);
       if (err != GRPC_ERROR_NONE) {
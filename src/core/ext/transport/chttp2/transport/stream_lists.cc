@@ -22,6 +22,9 @@
 
 #include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
 #include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/lib/channel/call_tracer.h"
+#include "src/core/lib/channel/context.h"
+#include "src/core/lib/debug/stats.h"
 
 static const char* stream_list_id_string(grpc_chttp2_stream_list_id id) {
   switch (id) {
@@ -35,6 +38,8 @@ static const char* stream_list_id_string(grpc_chttp2_stream_list_id id) {
       return "stalled_by_stream";
     case GRPC_CHTTP2_LIST_WAITING_FOR_CONCURRENCY:
       return "waiting_for_concurrency";
+    case GRPC_CHTTP2_LIST_CUT_THROUGH:
+      return "cut_through";
     case STREAM_LIST_COUNT:
       GPR_UNREACHABLE_CODE(return "unknown");
   }
@@ -136,6 +141,53 @@ static bool stream_list_add(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
   return true;
 }
 
+/* flow control stall accounting */
+
+static void stall_begun(grpc_chttp2_stream* s, grpc_chttp2_stream_list_id id) {
+  if (id == GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT) {
+    GRPC_STATS_INC_HTTP2_TRANSPORT_WINDOW_STALLS();
+  } else {
+    GRPC_STATS_INC_HTTP2_STREAM_WINDOW_STALLS();
+  }
+  if (s->stalled_since == 0) {
+    s->stalled_since = grpc_core::ExecCtx::Get()->Now();
+  }
+}
+
+/* Records how long \a s spent stalled once it has left both stalled lists,
+   in global stats and on the call attempt tracer published in the stream's
+   call context, if any. The tracer is still alive on every removal path:
+   RecordEnd() is not invoked until the call is destroyed, which cannot
+   happen before the transport stream is destroyed. */
+static void stall_ended(grpc_chttp2_stream* s, grpc_chttp2_stream_list_id id) {
+  if (s->stalled_since == 0) return;
+  if (s->included[GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT] ||
+      s->included[GRPC_CHTTP2_LIST_STALLED_BY_STREAM]) {
+    /* Still parked on the other stalled list. */
+    return;
+  }
+  grpc_millis stalled_ms = grpc_core::ExecCtx::Get()->Now() - s->stalled_since;
+  s->stalled_since = 0;
+  if (id == GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT) {
+    GRPC_STATS_INC_HTTP2_TRANSPORT_WINDOW_STALL_MS(stalled_ms);
+  } else {
+    GRPC_STATS_INC_HTTP2_STREAM_WINDOW_STALL_MS(stalled_ms);
+  }
+  if (s->context == nullptr) return;
+  auto* tracer = static_cast<grpc_core::CallTracer::CallAttemptTracer*>(
+      static_cast<grpc_call_context_element*>(
+          s->context)[GRPC_CONTEXT_CALL_ATTEMPT_TRACER]
+          .value);
+  if (tracer == nullptr) return;
+  tracer->RecordFlowControlStall(
+      id == GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT
+          ? grpc_core::CallTracer::CallAttemptTracer::FlowControlStallCause::
+                kTransportWindow
+          : grpc_core::CallTracer::CallAttemptTracer::FlowControlStallCause::
+                kStreamWindow,
+      stalled_ms);
+}
+
 /* wrappers for specializations */
 
 bool grpc_chttp2_list_add_writable_stream(grpc_chttp2_transport* t,
@@ -186,31 +238,64 @@ void grpc_chttp2_list_remove_waiting_for_concurrency(grpc_chttp2_transport* t,
 void grpc_chttp2_list_add_stalled_by_transport(grpc_chttp2_transport* t,
                                                grpc_chttp2_stream* s) {
   GPR_ASSERT(t->flow_control->flow_control_enabled());
-  stream_list_add(t, s, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT);
+  if (stream_list_add(t, s, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT)) {
+    stall_begun(s, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT);
+  }
 }
 
 bool grpc_chttp2_list_pop_stalled_by_transport(grpc_chttp2_transport* t,
                                                grpc_chttp2_stream** s) {
-  return stream_list_pop(t, s, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT);
+  if (!stream_list_pop(t, s, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT)) {
+    return false;
+  }
+  stall_ended(*s, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT);
+  return true;
 }
 
 void grpc_chttp2_list_remove_stalled_by_transport(grpc_chttp2_transport* t,
                                                   grpc_chttp2_stream* s) {
-  stream_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT);
+  if (stream_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT)) {
+    stall_ended(s, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT);
+  }
 }
 
 void grpc_chttp2_list_add_stalled_by_stream(grpc_chttp2_transport* t,
                                             grpc_chttp2_stream* s) {
   GPR_ASSERT(t->flow_control->flow_control_enabled());
-  stream_list_add(t, s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM);
+  if (stream_list_add(t, s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM)) {
+    stall_begun(s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM);
+  }
 }
 
 bool grpc_chttp2_list_pop_stalled_by_stream(grpc_chttp2_transport* t,
                                             grpc_chttp2_stream** s) {
-  return stream_list_pop(t, s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM);
+  if (!stream_list_pop(t, s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM)) {
+    return false;
+  }
+  stall_ended(*s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM);
+  return true;
 }
 
 bool grpc_chttp2_list_remove_stalled_by_stream(grpc_chttp2_transport* t,
                                                grpc_chttp2_stream* s) {
-  return stream_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM);
+  if (!stream_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM)) {
+    return false;
+  }
+  stall_ended(s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM);
+  return true;
+}
+
+void grpc_chttp2_list_add_cut_through_stream(grpc_chttp2_transport* t,
+                                             grpc_chttp2_stream* s) {
+  stream_list_add(t, s, GRPC_CHTTP2_LIST_CUT_THROUGH);
+}
+
+bool grpc_chttp2_list_pop_cut_through_stream(grpc_chttp2_transport* t,
+                                             grpc_chttp2_stream** s) {
+  return stream_list_pop(t, s, GRPC_CHTTP2_LIST_CUT_THROUGH);
+}
+
+bool grpc_chttp2_list_remove_cut_through_stream(grpc_chttp2_transport* t,
+                                                grpc_chttp2_stream* s) {
+  return stream_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_CUT_THROUGH);
 }
@@ -20,21 +20,31 @@
 
 #include "src/core/ext/transport/chttp2/transport/stream_map.h"
 
+#include <stdlib.h>
 #include <string.h>
 
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
+/* Fibonacci hashing: spreads the mostly-sequential stream ids across the
+   table while keeping neighbouring ids in distinct slots. */
+static size_t hash_key(uint32_t key, size_t capacity) {
+  return static_cast<size_t>(key * 2654435761u) & (capacity - 1);
+}
+
 void grpc_chttp2_stream_map_init(grpc_chttp2_stream_map* map,
                                  size_t initial_capacity) {
   GPR_DEBUG_ASSERT(initial_capacity > 1);
+  size_t capacity = 2;
+  while (capacity < initial_capacity) capacity <<= 1;
   map->keys =
-      static_cast<uint32_t*>(gpr_malloc(sizeof(uint32_t) * initial_capacity));
+      static_cast<uint32_t*>(gpr_malloc(sizeof(uint32_t) * capacity));
   map->values =
-      static_cast<void**>(gpr_malloc(sizeof(void*) * initial_capacity));
+      static_cast<void**>(gpr_zalloc(sizeof(void*) * capacity));
   map->count = 0;
-  map->free = 0;
-  map->capacity = initial_capacity;
+  map->capacity = capacity;
+  map->last_key = 0;
+  map->last_value = nullptr;
 }
 
 void grpc_chttp2_stream_map_destroy(grpc_chttp2_stream_map* map) {
@@ -42,125 +52,117 @@ void grpc_chttp2_stream_map_destroy(grpc_chttp2_stream_map* map) {
   gpr_free(map->values);
 }
 
-static size_t compact(uint32_t* keys, void** values, size_t count) {
-  size_t i, out;
+/* Return the slot holding key, or the empty slot at which the probe for key
+   ends. The load factor is capped below 1, so an empty slot always exists. */
+static size_t find_slot(grpc_chttp2_stream_map* map, uint32_t key) {
+  const size_t mask = map->capacity - 1;
+  size_t idx = hash_key(key, map->capacity);
+  while (map->values[idx] != nullptr) {
+    if (map->keys[idx] == key) return idx;
+    idx = (idx + 1) & mask;
+  }
+  return idx;
+}
+
+static void grow(grpc_chttp2_stream_map* map) {
+  const size_t old_capacity = map->capacity;
+  uint32_t* old_keys = map->keys;
+  void** old_values = map->values;
 
-  for (i = 0, out = 0; i < count; i++) {
-    if (values[i]) {
-      keys[out] = keys[i];
-      values[out] = values[i];
-      out++;
+  map->capacity = 2 * old_capacity;
+  map->keys =
+      static_cast<uint32_t*>(gpr_malloc(sizeof(uint32_t) * map->capacity));
+  map->values =
+      static_cast<void**>(gpr_zalloc(sizeof(void*) * map->capacity));
+  for (size_t i = 0; i < old_capacity; i++) {
+    if (old_values[i] != nullptr) {
+      size_t idx = find_slot(map, old_keys[i]);
+      map->keys[idx] = old_keys[i];
+      map->values[idx] = old_values[i];
     }
   }
-
-  return out;
+  gpr_free(old_keys);
+  gpr_free(old_values);
 }
 
 void grpc_chttp2_stream_map_add(grpc_chttp2_stream_map* map, uint32_t key,
                                 void* value) {
-  size_t count = map->count;
-  size_t capacity = map->capacity;
-  uint32_t* keys = map->keys;
-  void** values = map->values;
-
-  // The first assertion ensures that the table is monotonically increasing.
-  GPR_ASSERT(count == 0 || keys[count - 1] < key);
   GPR_DEBUG_ASSERT(value);
-  // Asserting that the key is not already in the map can be a debug assertion.
-  // Why: we're already checking that the map elements are monotonically
-  // increasing. If we re-add a key, i.e. if the key is already present, then
-  // either it is the most recently added key in the map (in which case the
-  // first assertion fails due to key == last_key) or there is a more recently
-  // added (larger) key at the end of the map: in which case the first assertion
-  // still fails due to key < last_key.
   GPR_DEBUG_ASSERT(grpc_chttp2_stream_map_find(map, key) == nullptr);
 
-  if (count == capacity) {
-    if (map->free > capacity / 4) {
-      count = compact(keys, values, count);
-      map->free = 0;
-    } else {
-      /* resize when less than 25% of the table is free, because compaction
-         won't help much */
-      map->capacity = capacity = 2 * capacity;
-      map->keys = keys = static_cast<uint32_t*>(
-          gpr_realloc(keys, capacity * sizeof(uint32_t)));
-      map->values = values =
-          static_cast<void**>(gpr_realloc(values, capacity * sizeof(void*)));
-    }
-  }
-
-  keys[count] = key;
-  values[count] = value;
-  map->count = count + 1;
-}
-
-template <bool strict_find>
-static void** find(grpc_chttp2_stream_map* map, uint32_t key) {
-  size_t min_idx = 0;
-  size_t max_idx = map->count;
-  size_t mid_idx;
-  uint32_t* keys = map->keys;
-  void** values = map->values;
-  uint32_t mid_key;
-
-  GPR_DEBUG_ASSERT(!strict_find || max_idx > 0);
-  if (!strict_find && max_idx == 0) return nullptr;
-
-  while (min_idx < max_idx) {
-    /* find the midpoint, avoiding overflow */
-    mid_idx = min_idx + ((max_idx - min_idx) / 2);
-    mid_key = keys[mid_idx];
-
-    if (mid_key < key) {
-      min_idx = mid_idx + 1;
-    } else if (mid_key > key) {
-      max_idx = mid_idx;
-    } else /* mid_key == key */
-    {
-      return &values[mid_idx];
-    }
+  /* grow at 3/4 load: with linear probing we want some slack to keep probe
+     chains short */
+  if ((map->count + 1) * 4 > map->capacity * 3) {
+    grow(map);
   }
 
-  GPR_DEBUG_ASSERT(!strict_find);
-  return nullptr;
+  size_t idx = find_slot(map, key);
+  GPR_DEBUG_ASSERT(map->values[idx] == nullptr);
+  map->keys[idx] = key;
+  map->values[idx] = value;
+  map->count++;
 }
 
 void* grpc_chttp2_stream_map_delete(grpc_chttp2_stream_map* map, uint32_t key) {
-  void** pvalue = find<true>(map, key);
-  GPR_DEBUG_ASSERT(pvalue != nullptr);
-  void* out = *pvalue;
-  GPR_DEBUG_ASSERT(out != nullptr);
-  *pvalue = nullptr;
-  map->free++;
-  /* recognize complete emptyness and ensure we can skip
-     defragmentation later */
-  if (map->free == map->count) {
-    map->free = map->count = 0;
+  const size_t mask = map->capacity - 1;
+  size_t idx = find_slot(map, key);
+  GPR_DEBUG_ASSERT(map->values[idx] != nullptr);
+  if (map->values[idx] == nullptr) return nullptr;
+  void* out = map->values[idx];
+  map->values[idx] = nullptr;
+  map->count--;
+  if (map->last_key == key) {
+    map->last_value = nullptr;
+  }
+  /* backward-shift deletion: pull every displaced entry in the probe chain
+     after idx back over the hole, so no tombstone is left behind */
+  size_t hole = idx;
+  size_t next = (idx + 1) & mask;
+  while (map->values[next] != nullptr) {
+    const size_t ideal = hash_key(map->keys[next], map->capacity);
+    /* the entry at next may move into the hole only if doing so does not
+       place it before its ideal slot in the probe order */
+    if (((next - ideal) & mask) >= ((next - hole) & mask)) {
+      map->keys[hole] = map->keys[next];
+      map->values[hole] = map->values[next];
+      map->values[next] = nullptr;
+      hole = next;
+    }
+    next = (next + 1) & mask;
   }
   GPR_DEBUG_ASSERT(grpc_chttp2_stream_map_find(map, key) == nullptr);
   return out;
 }
 
 void* grpc_chttp2_stream_map_find(grpc_chttp2_stream_map* map, uint32_t key) {
-  void** pvalue = find<false>(map, key);
-  return pvalue != nullptr ? *pvalue : nullptr;
+  if (map->last_value != nullptr && map->last_key == key) {
+    return map->last_value;
+  }
+  size_t idx = find_slot(map, key);
+  void* value = map->values[idx];
+  if (value != nullptr) {
+    map->last_key = key;
+    map->last_value = value;
+  }
+  return value;
 }
 
 size_t grpc_chttp2_stream_map_size(grpc_chttp2_stream_map* map) {
-  return map->count - map->free;
+  return map->count;
 }
 
 void* grpc_chttp2_stream_map_rand(grpc_chttp2_stream_map* map) {
-  if (map->count == map->free) {
+  if (map->count == 0) {
     return nullptr;
   }
-  if (map->free != 0) {
-    map->count = compact(map->keys, map->values, map->count);
-    map->free = 0;
-    GPR_ASSERT(map->count > 0);
+  /* start at a random slot and take the next populated one; only
+     approximately uniform, but callers just need "some stream" */
+  const size_t mask = map->capacity - 1;
+  size_t idx = static_cast<size_t>(rand()) & mask;
+  while (map->values[idx] == nullptr) {
+    idx = (idx + 1) & mask;
   }
-  return map->values[(static_cast<size_t>(rand())) % map->count];
+  return map->values[idx];
 }
 
 void grpc_chttp2_stream_map_for_each(grpc_chttp2_stream_map* map,
@@ -169,7 +171,7 @@ void grpc_chttp2_stream_map_for_each(grpc_chttp2_stream_map* map,
                                      void* user_data) {
   size_t i;
 
-  for (i = 0; i < map->count; i++) {
+  for (i = 0; i < map->capacity; i++) {
     if (map->values[i]) {
       f(user_data, map->keys[i], map->values[i]);
     }
@@ -25,23 +25,25 @@
 
 /* Data structure to map a uint32_t to a data object (represented by a void*)
 
-   Represented as a sorted array of keys, and a corresponding array of values.
-   Lookups are performed with binary search.
-   Adds are restricted to strictly higher keys than previously seen (this is
-   guaranteed by http2). */
+   Represented as an open-addressed hash table with linear probing and
+   backward-shift deletion, so deletions leave no tombstones behind and
+   lookups stay short on long-lived connections with high stream churn.
+   A one-entry cache remembers the most recently found stream, since frames
+   for a single stream tend to arrive in bursts. */
 struct grpc_chttp2_stream_map {
   uint32_t* keys;
-  void** values;
+  void** values; /* an empty slot holds NULL */
   size_t count;
-  size_t free;
-  size_t capacity;
+  size_t capacity; /* always a power of two */
+  /* one-entry cache of the most recently found key */
+  uint32_t last_key;
+  void* last_value;
 };
 void grpc_chttp2_stream_map_init(grpc_chttp2_stream_map* map,
                                  size_t initial_capacity);
 void grpc_chttp2_stream_map_destroy(grpc_chttp2_stream_map* map);
 
-/* Add a new key: given http2 semantics, new keys must always be greater than
-   existing keys - this is asserted */
+/* Add a new key: the key must not already be present - this is asserted */
 void grpc_chttp2_stream_map_add(grpc_chttp2_stream_map* map, uint32_t key,
                                 void* value);
 
@@ -58,7 +60,7 @@ void* grpc_chttp2_stream_map_rand(grpc_chttp2_stream_map* map);
 /* How many (populated) entries are in the stream map? */
 size_t grpc_chttp2_stream_map_size(grpc_chttp2_stream_map* map);
 
-/* Callback on each stream */
+/* Callback on each stream; iteration order is unspecified */
 void grpc_chttp2_stream_map_for_each(grpc_chttp2_stream_map* map,
                                      void (*f)(void* user_data, uint32_t key,
                                                void* value),
@@ -20,7 +20,7 @@
 
 #include "src/core/ext/transport/chttp2/transport/varint.h"
 
-#include "absl/base/attributes.h"
+#include <string.h>
 
 namespace grpc_core {
 
@@ -40,23 +40,17 @@ uint32_t VarintLength(uint32_t tail_value) {
 
 void VarintWriteTail(uint32_t tail_value, uint8_t* target,
                      uint32_t tail_length) {
-  switch (tail_length) {
-    case 5:
-      target[4] = static_cast<uint8_t>((tail_value >> 28) | 0x80);
-      ABSL_FALLTHROUGH_INTENDED;
-    case 4:
-      target[3] = static_cast<uint8_t>((tail_value >> 21) | 0x80);
-      ABSL_FALLTHROUGH_INTENDED;
-    case 3:
-      target[2] = static_cast<uint8_t>((tail_value >> 14) | 0x80);
-      ABSL_FALLTHROUGH_INTENDED;
-    case 2:
-      target[1] = static_cast<uint8_t>((tail_value >> 7) | 0x80);
-      ABSL_FALLTHROUGH_INTENDED;
-    case 1:
-      target[0] = static_cast<uint8_t>((tail_value) | 0x80);
-  }
-  target[tail_length - 1] &= 0x7f;
+  /* Fill every possible continuation byte into a scratch buffer
+     unconditionally; the length-limited copy below is then the only
+     data-dependent operation, so the encode stays branch-free regardless of
+     how many bytes the value needs. */
+  uint8_t scratch[5] = {static_cast<uint8_t>(tail_value | 0x80),
+                        static_cast<uint8_t>((tail_value >> 7) | 0x80),
+                        static_cast<uint8_t>((tail_value >> 14) | 0x80),
+                        static_cast<uint8_t>((tail_value >> 21) | 0x80),
+                        static_cast<uint8_t>((tail_value >> 28) | 0x80)};
+  scratch[tail_length - 1] &= 0x7f;
+  memcpy(target, scratch, tail_length);
 }
 
 }  // namespace grpc_core
@@ -25,6 +25,8 @@
 #include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
 #include "src/core/ext/transport/chttp2/transport/context_list.h"
 #include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/lib/channel/call_tracer.h"
+#include "src/core/lib/channel/context.h"
 #include "src/core/lib/compression/stream_compression.h"
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/profiling/timers.h"
@@ -336,10 +338,24 @@ class DataSendContext {
   }
 
   uint32_t max_outgoing() const {
-    return static_cast<uint32_t>(std::min(
+    uint32_t max = static_cast<uint32_t>(std::min(
         t_->settings[GRPC_PEER_SETTINGS][GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE],
         static_cast<uint32_t>(std::min(int64_t(stream_remote_window()),
                                        t_->flow_control->remote_window()))));
+    if (t_->write_scheduling_quantum != 0) {
+      // Weighted write scheduling: bound this scheduling turn to
+      // (quantum * weight) bytes so one stream with a deep backlog yields
+      // to other writable streams instead of draining FIFO. A stream with
+      // leftover data re-enters the writable list and gets further turns.
+      const uint64_t turn_budget =
+          static_cast<uint64_t>(t_->write_scheduling_quantum) *
+          s_->write_weight;
+      const uint64_t sent_this_turn = s_->sending_bytes - sending_bytes_before_;
+      max = static_cast<uint32_t>(std::min<uint64_t>(
+          max, turn_budget > sent_this_turn ? turn_budget - sent_this_turn
+                                            : 0));
+    }
+    return max;
   }
 
   bool AnyOutgoing() const { return max_outgoing() > 0; }
@@ -400,7 +416,8 @@ class DataSendContext {
 
     if (s_->stream_compression_ctx == nullptr) {
       s_->stream_compression_ctx =
-          grpc_stream_compression_context_create(s_->stream_compression_method);
+          grpc_chttp2_stream_compression_context_create(
+              t_, s_->stream_compression_method);
     }
     s_->uncompressed_data_size = s_->flow_controlled_buffer.length;
     if (GPR_UNLIKELY(!grpc_stream_compress(
@@ -448,6 +465,19 @@ class StreamWriteContext {
     if (s_->sent_initial_metadata) return;
     if (s_->send_initial_metadata == nullptr) return;
 
+    // The whole response is pending (trailing metadata has been queued) but
+    // the message is still being fetched from its byte stream. Hold the
+    // HEADERS back until the fetch completes - which re-marks the stream
+    // writable - so HEADERS, DATA and the trailing HEADERS are staged
+    // contiguously and leave in a single endpoint write, instead of a
+    // headers-only packet now and the rest in a later write.
+    if (s_->send_trailing_metadata != nullptr &&
+        s_->fetching_send_message != nullptr) {
+      GRPC_CHTTP2_IF_TRACING(gpr_log(
+          GPR_INFO, "deferring initial_metadata for single-write response"));
+      return;
+    }
+
     // We skip this on the server side if there is no custom initial
     // metadata, there are no messages to send, and we are also sending
     // trailing metadata.  This results in a Trailers-Only response,
@@ -471,7 +501,8 @@ class StreamWriteContext {
               t_->settings
                   [GRPC_PEER_SETTINGS]
                   [GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE],  // max_frame_size
-              &s_->stats.outgoing                         // stats
+              &s_->stats.outgoing,                        // stats
+              true                                        // is_initial_metadata
           },
           *s_->send_initial_metadata, &t_->outbuf);
       grpc_chttp2_reset_ping_clock(t_);
@@ -513,6 +544,15 @@ class StreamWriteContext {
       return;  // early out: nothing to do
     }
 
+    // Same single-write fusion as in FlushInitialMetadata: if the final
+    // message is still being fetched, what is buffered so far is a strict
+    // prefix of it (possibly just the length prefix). Wait for the fetch to
+    // finish rather than emitting a runt DATA frame.
+    if (s_->send_trailing_metadata != nullptr &&
+        s_->fetching_send_message != nullptr) {
+      return;
+    }
+
     DataSendContext data_send_context(write_context_, t_, s_);
 
     if (!data_send_context.AnyOutgoing()) {
@@ -579,7 +619,7 @@ class StreamWriteContext {
                   0,
               t_->settings[GRPC_PEER_SETTINGS]
                           [GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE],
-              &s_->stats.outgoing},
+              &s_->stats.outgoing, false},
           grpc_core::ConcatMetadata(
               grpc_core::MetadataArray(
                   extra_headers_for_trailing_metadata_,
@@ -646,6 +686,24 @@ class StreamWriteContext {
 };
 }  // namespace
 
+/* Reports a userspace-clock write timestamp to the attempt tracer published
+   in the stream's call context, if any. May only be called while an op whose
+   bytes are part of the current write is still pending: its completion
+   closure has not yet run, so the call - and therefore the tracer - is
+   guaranteed to still be alive. */
+static void report_write_timestamp(grpc_chttp2_stream* s) {
+  if (s->context == nullptr) return;
+  auto* tracer = static_cast<grpc_core::CallTracer::CallAttemptTracer*>(
+      static_cast<grpc_call_context_element*>(
+          s->context)[GRPC_CONTEXT_CALL_ATTEMPT_TRACER]
+          .value);
+  if (tracer == nullptr) return;
+  grpc_core::Timestamps ts = {};
+  ts.sendmsg_time.time = gpr_now(GPR_CLOCK_REALTIME);
+  ts.byte_offset = static_cast<uint32_t>(s->byte_counter);
+  tracer->RecordWriteTimestamps(ts);
+}
+
 grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
     grpc_chttp2_transport* t) {
   WriteContext ctx(t);
@@ -664,15 +722,26 @@ grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
     StreamWriteContext stream_ctx(&ctx, s);
     size_t orig_len = t->outbuf.length;
     stream_ctx.FlushInitialMetadata();
+    size_t len_after_metadata = t->outbuf.length;
     stream_ctx.FlushWindowUpdates();
+    size_t len_after_window_updates = t->outbuf.length;
     stream_ctx.FlushData();
     stream_ctx.FlushTrailingMetadata();
     if (t->outbuf.length > orig_len) {
       /* Add this stream to the list of the contexts to be traced at TCP */
       s->byte_counter += t->outbuf.length - orig_len;
-      if (s->traced && grpc_endpoint_can_track_err(t->ep)) {
+      if ((s->traced || t->collect_write_timestamps) &&
+          grpc_endpoint_can_track_err(t->ep)) {
         grpc_core::ContextList::Append(&t->cl, s);
       }
+      /* Only op flushes (not window updates) prove that a completion closure
+         is still queued, which report_write_timestamp relies on */
+      if (t->collect_write_timestamps &&
+          t->outbuf.length - len_after_window_updates +
+                  (len_after_metadata - orig_len) >
+              0) {
+        report_write_timestamp(s);
+      }
     }
     if (stream_ctx.stream_became_writable()) {
       if (!grpc_chttp2_list_add_writing_stream(t, s)) {
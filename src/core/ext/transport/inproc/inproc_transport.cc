@@ -309,9 +309,16 @@ grpc_error_handle fill_in_metadata(inproc_stream* s,
     if (error != GRPC_ERROR_NONE) return;
     grpc_linked_mdelem* nelem =
         static_cast<grpc_linked_mdelem*>(s->arena->Alloc(sizeof(*nelem)));
-    nelem->md = grpc_mdelem_from_slices(grpc_slice_intern(GRPC_MDKEY(md)),
-                                        grpc_slice_intern(GRPC_MDVALUE(md)));
-
+    // Fast path: refcounted elements can be handed to the peer stream by
+    // reference, skipping two global intern-table lookups per element.
+    // Only non-refcounted (EXTERNAL) elements need the interned copy,
+    // since their backing storage dies with the sender's batch.
+    if (GRPC_MDELEM_STORAGE(md) != GRPC_MDELEM_STORAGE_EXTERNAL) {
+      nelem->md = GRPC_MDELEM_REF(md);
+    } else {
+      nelem->md = grpc_mdelem_from_slices(grpc_slice_intern(GRPC_MDKEY(md)),
+                                          grpc_slice_intern(GRPC_MDVALUE(md)));
+    }
     error = out_md->LinkTail(nelem);
   });
   return error;
@@ -0,0 +1,277 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/transport/shm/shm_ring_buffer.h"
+
+#ifdef GPR_LINUX
+
+#include <errno.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+
+#include <grpc/support/log.h>
+
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+
+namespace grpc_core {
+
+namespace {
+
+constexpr uint32_t kShmRingMagic = 0x52534d47;  // "GMSR"
+// The control block gets a page of its own so the data region starts
+// page-aligned.
+constexpr size_t kControlRegionSize = 4096;
+
+// Note: no FUTEX_PRIVATE_FLAG -- the word is shared between processes.
+int FutexWait(std::atomic<uint32_t>* addr, uint32_t expected, int timeout_ms) {
+  struct timespec ts;
+  struct timespec* tsp = nullptr;
+  if (timeout_ms >= 0) {
+    ts.tv_sec = timeout_ms / 1000;
+    ts.tv_nsec = static_cast<long>(timeout_ms % 1000) * 1000000;
+    tsp = &ts;
+  }
+  return static_cast<int>(syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr),
+                                  FUTEX_WAIT, expected, tsp, nullptr, 0));
+}
+
+void FutexWake(std::atomic<uint32_t>* addr) {
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr), FUTEX_WAKE, INT_MAX,
+          nullptr, nullptr, 0);
+}
+
+size_t RoundUpToPowerOfTwo(size_t n) {
+  size_t result = 1;
+  while (result < n) result <<= 1;
+  return result;
+}
+
+}  // namespace
+
+// Lives at the start of the shared mapping. head_ and tail_ are
+// free-running counters (the data size is a power of two, so position is
+// counter & (size - 1)); tail_ - head_ is the number of unread bytes. The
+// doorbell words exist only to be waited on and woken: the writer bumps
+// data_doorbell after taking the ring out of the empty state, the reader
+// bumps space_doorbell after taking it out of the full state, so a waiter
+// that observed the old doorbell value never misses a wakeup.
+struct ShmRingBuffer::Control {
+  uint32_t magic;
+  uint32_t data_size;
+  char pad0[56];
+  std::atomic<uint32_t> head;
+  std::atomic<uint32_t> data_doorbell;
+  char pad1[56];
+  std::atomic<uint32_t> tail;
+  std::atomic<uint32_t> space_doorbell;
+};
+
+std::unique_ptr<ShmRingBuffer> ShmRingBuffer::Create(size_t capacity) {
+  static_assert(sizeof(Control) <= kControlRegionSize,
+                "control block must fit in its reserved region");
+  size_t data_size = RoundUpToPowerOfTwo(capacity);
+  if (data_size > (1u << 30)) {
+    gpr_log(GPR_ERROR, "shm ring capacity %" PRIuPTR " too large", capacity);
+    return nullptr;
+  }
+  const size_t map_size = kControlRegionSize + data_size;
+  int fd = static_cast<int>(
+      syscall(SYS_memfd_create, "grpc-shm-ring", MFD_CLOEXEC));
+  if (fd < 0) {
+    gpr_log(GPR_ERROR, "memfd_create: %s", strerror(errno));
+    return nullptr;
+  }
+  if (ftruncate(fd, static_cast<off_t>(map_size)) != 0) {
+    gpr_log(GPR_ERROR, "ftruncate(shm ring): %s", strerror(errno));
+    close(fd);
+    return nullptr;
+  }
+  void* map =
+      mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (map == MAP_FAILED) {
+    gpr_log(GPR_ERROR, "mmap(shm ring): %s", strerror(errno));
+    close(fd);
+    return nullptr;
+  }
+  Control* control = static_cast<Control*>(map);
+  control->data_size = static_cast<uint32_t>(data_size);
+  control->head.store(0, std::memory_order_relaxed);
+  control->tail.store(0, std::memory_order_relaxed);
+  control->data_doorbell.store(0, std::memory_order_relaxed);
+  control->space_doorbell.store(0, std::memory_order_relaxed);
+  // Publish the magic last so Attach() never sees a half-initialized ring.
+  control->magic = kShmRingMagic;
+  return std::unique_ptr<ShmRingBuffer>(new ShmRingBuffer(
+      fd, control, static_cast<uint8_t*>(map) + kControlRegionSize, map_size));
+}
+
+std::unique_ptr<ShmRingBuffer> ShmRingBuffer::Attach(int fd) {
+  struct stat st;
+  if (fstat(fd, &st) != 0 ||
+      static_cast<size_t>(st.st_size) <= kControlRegionSize) {
+    gpr_log(GPR_ERROR, "shm ring attach: bad fd");
+    close(fd);
+    return nullptr;
+  }
+  const size_t map_size = static_cast<size_t>(st.st_size);
+  void* map =
+      mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (map == MAP_FAILED) {
+    gpr_log(GPR_ERROR, "mmap(shm ring attach): %s", strerror(errno));
+    close(fd);
+    return nullptr;
+  }
+  Control* control = static_cast<Control*>(map);
+  if (control->magic != kShmRingMagic ||
+      control->data_size != map_size - kControlRegionSize ||
+      (control->data_size & (control->data_size - 1)) != 0) {
+    gpr_log(GPR_ERROR, "shm ring attach: invalid control block");
+    munmap(map, map_size);
+    close(fd);
+    return nullptr;
+  }
+  return std::unique_ptr<ShmRingBuffer>(new ShmRingBuffer(
+      fd, control, static_cast<uint8_t*>(map) + kControlRegionSize, map_size));
+}
+
+ShmRingBuffer::ShmRingBuffer(int fd, Control* control, uint8_t* data,
+                             size_t map_size)
+    : fd_(fd), control_(control), data_(data), map_size_(map_size) {}
+
+ShmRingBuffer::~ShmRingBuffer() {
+  munmap(control_, map_size_);
+  close(fd_);
+}
+
+size_t ShmRingBuffer::capacity() const { return control_->data_size; }
+
+size_t ShmRingBuffer::Write(const void* data, size_t len) {
+  const uint32_t size = control_->data_size;
+  const uint32_t mask = size - 1;
+  const uint32_t head = control_->head.load(std::memory_order_acquire);
+  const uint32_t tail = control_->tail.load(std::memory_order_relaxed);
+  const uint32_t unread = tail - head;
+  const size_t n = std::min(len, static_cast<size_t>(size - unread));
+  if (n == 0) return 0;
+  const uint32_t pos = tail & mask;
+  const size_t first = std::min(n, static_cast<size_t>(size - pos));
+  memcpy(data_ + pos, data, first);
+  memcpy(data_, static_cast<const char*>(data) + first, n - first);
+  control_->tail.store(tail + static_cast<uint32_t>(n),
+                       std::memory_order_release);
+  // Deciding whether to ring the doorbell from the pre-publish head sample
+  // races with the reader draining the ring and going to sleep: both sides
+  // would act on stale values and the reader would never be woken. Classic
+  // Dekker store-load: publish tail, then a full fence, then re-read head.
+  // Paired with the fence in WaitForData(), at least one side is guaranteed
+  // to see the other's store.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (control_->head.load(std::memory_order_relaxed) == tail) {
+    // The reader has consumed everything published before this write, so it
+    // may be asleep (or about to sleep) in WaitForData().
+    control_->data_doorbell.fetch_add(1, std::memory_order_release);
+    FutexWake(&control_->data_doorbell);
+  }
+  return n;
+}
+
+size_t ShmRingBuffer::Read(void* data, size_t len) {
+  const uint32_t size = control_->data_size;
+  const uint32_t mask = size - 1;
+  const uint32_t tail = control_->tail.load(std::memory_order_acquire);
+  const uint32_t head = control_->head.load(std::memory_order_relaxed);
+  const uint32_t unread = tail - head;
+  const size_t n = std::min(len, static_cast<size_t>(unread));
+  if (n == 0) return 0;
+  const uint32_t pos = head & mask;
+  const size_t first = std::min(n, static_cast<size_t>(size - pos));
+  memcpy(data, data_ + pos, first);
+  memcpy(static_cast<char*>(data) + first, data_, n - first);
+  control_->head.store(head + static_cast<uint32_t>(n),
+                       std::memory_order_release);
+  // Symmetric to Write(): re-read tail after a full fence so this read and
+  // the writer's fullness check in WaitForSpace() cannot both see stale
+  // values and strand a sleeping writer.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (control_->tail.load(std::memory_order_relaxed) - head == size) {
+    // The ring was full immediately before this read, so the writer may be
+    // asleep (or about to sleep) in WaitForSpace().
+    control_->space_doorbell.fetch_add(1, std::memory_order_release);
+    FutexWake(&control_->space_doorbell);
+  }
+  return n;
+}
+
+bool ShmRingBuffer::WaitForData(int timeout_ms) {
+  while (true) {
+    const uint32_t doorbell =
+        control_->data_doorbell.load(std::memory_order_acquire);
+    // Pairs with the fence in Write(): order this side's last head publish
+    // before the emptiness check, so the writer's post-publish head re-read
+    // and this tail load cannot both be stale.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (control_->tail.load(std::memory_order_acquire) !=
+        control_->head.load(std::memory_order_relaxed)) {
+      return true;
+    }
+    if (FutexWait(&control_->data_doorbell, doorbell, timeout_ms) != 0 &&
+        errno == ETIMEDOUT) {
+      return control_->tail.load(std::memory_order_acquire) !=
+             control_->head.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+bool ShmRingBuffer::WaitForSpace(int timeout_ms) {
+  const uint32_t size = control_->data_size;
+  while (true) {
+    const uint32_t doorbell =
+        control_->space_doorbell.load(std::memory_order_acquire);
+    // Pairs with the fence in Read(); see WaitForData().
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (control_->tail.load(std::memory_order_relaxed) -
+            control_->head.load(std::memory_order_acquire) !=
+        size) {
+      return true;
+    }
+    if (FutexWait(&control_->space_doorbell, doorbell, timeout_ms) != 0 &&
+        errno == ETIMEDOUT) {
+      return control_->tail.load(std::memory_order_relaxed) -
+                 control_->head.load(std::memory_order_acquire) !=
+             size;
+    }
+  }
+}
+
+}  // namespace grpc_core
+
+#endif  // GPR_LINUX
@@ -0,0 +1,94 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_EXT_TRANSPORT_SHM_SHM_RING_BUFFER_H
+#define GRPC_CORE_EXT_TRANSPORT_SHM_SHM_RING_BUFFER_H
+
+#include <grpc/support/port_platform.h>
+
+#ifdef GPR_LINUX
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+
+namespace grpc_core {
+
+// A single-producer single-consumer byte ring over an anonymous memory-backed
+// file (memfd), usable across process boundaries: the creating side hands
+// fd() to its peer (e.g. over a unix socket via SCM_RIGHTS) and the peer maps
+// the same pages with Attach(). Each direction of an RPC connection uses one
+// ring; the writer and reader signal each other through futex doorbells
+// embedded in the shared control page, so a side blocked on an empty (or
+// full) ring is woken directly by its peer without a trip through the I/O
+// poller.
+//
+// This is the data-plane primitive for a same-host shared-memory transport.
+// Linux only (memfd_create + cross-process futex).
+class ShmRingBuffer {
+ public:
+  // Creates a ring whose data region holds at least capacity bytes (rounded
+  // up to a power of two). Returns nullptr on failure.
+  static std::unique_ptr<ShmRingBuffer> Create(size_t capacity);
+
+  // Maps a ring created by a peer's Create(). Takes ownership of fd even on
+  // failure. Returns nullptr if fd does not refer to a valid ring.
+  static std::unique_ptr<ShmRingBuffer> Attach(int fd);
+
+  ~ShmRingBuffer();
+
+  ShmRingBuffer(const ShmRingBuffer&) = delete;
+  ShmRingBuffer& operator=(const ShmRingBuffer&) = delete;
+
+  // The fd backing the shared mapping; dup() and pass to the peer process.
+  int fd() const { return fd_; }
+
+  // Usable size of the data region in bytes.
+  size_t capacity() const;
+
+  // Copy up to len bytes into (out of) the ring. Both return the number of
+  // bytes moved -- 0 when the ring is full (empty) -- and never block. The
+  // peer's doorbell is rung when the ring leaves the empty (full) state.
+  // Single producer, single consumer: each end of the ring must be driven
+  // from one thread at a time.
+  size_t Write(const void* data, size_t len);
+  size_t Read(void* data, size_t len);
+
+  // Block until the ring has readable bytes (writable space) or timeout_ms
+  // milliseconds elapse; timeout_ms < 0 blocks indefinitely. Returns true if
+  // the ring is ready, false on timeout.
+  bool WaitForData(int timeout_ms);
+  bool WaitForSpace(int timeout_ms);
+
+ private:
+  struct Control;  // layout of the shared control page
+
+  ShmRingBuffer(int fd, Control* control, uint8_t* data, size_t map_size);
+
+  int fd_;
+  Control* control_;
+  uint8_t* data_;
+  size_t map_size_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GPR_LINUX
+
+#endif  // GRPC_CORE_EXT_TRANSPORT_SHM_SHM_RING_BUFFER_H
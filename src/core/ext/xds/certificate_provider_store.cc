@@ -68,9 +68,34 @@ CertificateProviderStore::CreateCertificateProviderLocked(
             plugin_config_it->second.plugin_name.c_str());
     return nullptr;
   }
+  RefCountedPtr<grpc_tls_certificate_provider> provider =
+      FindEquivalentProviderLocked(plugin_config_it->second);
+  if (provider == nullptr) {
+    provider =
+        factory->CreateCertificateProvider(plugin_config_it->second.config);
+  }
   return MakeRefCounted<CertificateProviderWrapper>(
-      factory->CreateCertificateProvider(plugin_config_it->second.config),
-      Ref(), plugin_config_it->first);
+      std::move(provider), Ref(), plugin_config_it->first);
+}
+
+RefCountedPtr<grpc_tls_certificate_provider>
+CertificateProviderStore::FindEquivalentProviderLocked(
+    const PluginDefinition& definition) {
+  for (const auto& p : certificate_providers_map_) {
+    auto config_it = plugin_config_map_.find(std::string(p.first));
+    if (config_it == plugin_config_map_.end()) continue;
+    const PluginDefinition& existing = config_it->second;
+    if (existing.plugin_name != definition.plugin_name ||
+        existing.config->ToString() != definition.config->ToString()) {
+      continue;
+    }
+    // A wrapper is removed from the map only by ReleaseCertificateProvider(),
+    // which needs mu_; so even if this wrapper is concurrently losing its
+    // last ref, its underlying provider is still alive here and taking a new
+    // ref to it (rather than to the wrapper) is safe.
+    return p.second->certificate_provider();
+  }
+  return nullptr;
 }
 
 void CertificateProviderStore::ReleaseCertificateProvider(
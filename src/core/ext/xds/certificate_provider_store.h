@@ -85,6 +85,10 @@ class CertificateProviderStore
 
     absl::string_view key() const { return key_; }
 
+    RefCountedPtr<grpc_tls_certificate_provider> certificate_provider() const {
+      return certificate_provider_;
+    }
+
    private:
     RefCountedPtr<grpc_tls_certificate_provider> certificate_provider_;
     RefCountedPtr<CertificateProviderStore> store_;
@@ -94,6 +98,14 @@ class CertificateProviderStore
   RefCountedPtr<CertificateProviderWrapper> CreateCertificateProviderLocked(
       absl::string_view key) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
+  // Returns the underlying provider of an existing wrapper whose plugin
+  // definition (plugin name and config) is identical to \a definition, or
+  // nullptr if there is none. Used to share one provider (and hence one set
+  // of file watches and one distributor) between plugin instances that are
+  // registered under different names but configured identically.
+  RefCountedPtr<grpc_tls_certificate_provider> FindEquivalentProviderLocked(
+      const PluginDefinition& definition) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   // Releases a previously created certificate provider from the certificate
   // provider map if the value matches \a wrapper.
   void ReleaseCertificateProvider(absl::string_view key,
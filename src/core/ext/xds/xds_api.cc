@@ -3349,6 +3349,7 @@ grpc_error_handle AdsResponseParse(
     const envoy_service_discovery_v3_DiscoveryResponse* response,
     const char* resource_type_string,
     const std::set<absl::string_view>& expected_resource_names,
+    const XdsApi::ResourceSerializedProtoMap& cached_serialized_protos,
     UpdateMap* update_map, std::set<std::string>* resource_names_failed) {
   std::vector<grpc_error_handle> errors;
   // Get the resources from the response.
@@ -3391,6 +3392,15 @@ grpc_error_handle AdsResponseParse(
       resource_names_failed->insert(resource_name);
       continue;
     }
+    // If the serialized bytes are identical to the copy the client has
+    // already accepted, skip validation; decoding the resource again
+    // would produce an update identical to the cached one.
+    auto cached_it = cached_serialized_protos.find(resource_name);
+    if (cached_it != cached_serialized_protos.end() &&
+        cached_it->second == UpbStringToAbsl(serialized_resource)) {
+      (*update_map)[resource_name].unchanged = true;
+      continue;
+    }
     // Validate resource.
     decltype(UpdateMap::mapped_type::resource) update;
     grpc_error_handle error =
@@ -3453,7 +3463,11 @@ XdsApi::AdsParseResult XdsApi::ParseAdsResponse(
     const std::set<absl::string_view>& expected_listener_names,
     const std::set<absl::string_view>& expected_route_configuration_names,
     const std::set<absl::string_view>& expected_cluster_names,
-    const std::set<absl::string_view>& expected_eds_service_names) {
+    const std::set<absl::string_view>& expected_eds_service_names,
+    const ResourceSerializedProtoMap& cached_listener_protos,
+    const ResourceSerializedProtoMap& cached_route_configuration_protos,
+    const ResourceSerializedProtoMap& cached_cluster_protos,
+    const ResourceSerializedProtoMap& cached_eds_service_protos) {
   AdsParseResult result;
   upb::Arena arena;
   const EncodingContext context = {client_,
@@ -3489,26 +3503,27 @@ XdsApi::AdsParseResult XdsApi::ParseAdsResponse(
     result.parse_error = AdsResponseParse(
         context, envoy_config_listener_v3_Listener_parse, LdsResourceName,
         IsLds, MaybeLogListener, LdsResourceParse, response, "LDS",
-        expected_listener_names, &result.lds_update_map,
-        &result.resource_names_failed);
+        expected_listener_names, cached_listener_protos,
+        &result.lds_update_map, &result.resource_names_failed);
   } else if (IsRds(result.type_url)) {
     result.parse_error = AdsResponseParse(
         context, envoy_config_route_v3_RouteConfiguration_parse,
         RdsResourceName, IsRds, MaybeLogRouteConfiguration, RouteConfigParse,
         response, "RDS", expected_route_configuration_names,
-        &result.rds_update_map, &result.resource_names_failed);
+        cached_route_configuration_protos, &result.rds_update_map,
+        &result.resource_names_failed);
   } else if (IsCds(result.type_url)) {
     result.parse_error = AdsResponseParse(
         context, envoy_config_cluster_v3_Cluster_parse, CdsResourceName, IsCds,
         MaybeLogCluster, CdsResourceParse, response, "CDS",
-        expected_cluster_names, &result.cds_update_map,
+        expected_cluster_names, cached_cluster_protos, &result.cds_update_map,
         &result.resource_names_failed);
   } else if (IsEds(result.type_url)) {
     result.parse_error = AdsResponseParse(
         context, envoy_config_endpoint_v3_ClusterLoadAssignment_parse,
         EdsResourceName, IsEds, MaybeLogClusterLoadAssignment, EdsResourceParse,
-        response, "EDS", expected_eds_service_names, &result.eds_update_map,
-        &result.resource_names_failed);
+        response, "EDS", expected_eds_service_names, cached_eds_service_protos,
+        &result.eds_update_map, &result.resource_names_failed);
   }
   return result;
 }
@@ -3617,7 +3632,9 @@ void LocalityStatsPopulate(
 
 grpc_slice XdsApi::CreateLrsRequest(
     ClusterLoadReportMap cluster_load_report_map) {
-  upb::Arena arena;
+  // Load reports are sent on every LRS interval; a stack-seeded arena keeps
+  // the common small report off the heap (large ones spill gracefully).
+  upb::InlinedArena<2048> arena;
   const EncodingContext context = {
       client_,     tracer_, symtab_.ptr(),
       arena.ptr(), false,   certificate_provider_definition_map_};
@@ -3684,7 +3701,9 @@ grpc_error_handle XdsApi::ParseLrsResponse(
     const grpc_slice& encoded_response, bool* send_all_clusters,
     std::set<std::string>* cluster_names,
     grpc_millis* load_reporting_interval) {
-  upb::Arena arena;
+  // The response carries only cluster names and an interval; parse it in a
+  // stack-seeded arena.
+  upb::InlinedArena<1024> arena;
   // Decode the response.
   const envoy_service_load_stats_v3_LoadStatsResponse* decoded_response =
       envoy_service_load_stats_v3_LoadStatsResponse_parse(
@@ -389,6 +389,10 @@ class XdsApi {
   struct LdsResourceData {
     LdsUpdate resource;
     std::string serialized_proto;
+    // True if the resource's serialized bytes were identical to the
+    // copy the client had already accepted, in which case resource and
+    // serialized_proto are not populated.
+    bool unchanged = false;
   };
 
   using LdsUpdateMap = std::map<std::string /*server_name*/, LdsResourceData>;
@@ -396,6 +400,8 @@ class XdsApi {
   struct RdsResourceData {
     RdsUpdate resource;
     std::string serialized_proto;
+    // See LdsResourceData.
+    bool unchanged = false;
   };
 
   using RdsUpdateMap =
@@ -453,6 +459,8 @@ class XdsApi {
   struct CdsResourceData {
     CdsUpdate resource;
     std::string serialized_proto;
+    // See LdsResourceData.
+    bool unchanged = false;
   };
 
   using CdsUpdateMap = std::map<std::string /*cluster_name*/, CdsResourceData>;
@@ -542,6 +550,8 @@ class XdsApi {
   struct EdsResourceData {
     EdsUpdate resource;
     std::string serialized_proto;
+    // See LdsResourceData.
+    bool unchanged = false;
   };
 
   using EdsUpdateMap =
@@ -595,6 +605,12 @@ class XdsApi {
   };
   using ResourceMetadataMap =
       std::map<absl::string_view /*resource_name*/, const ResourceMetadata*>;
+  // Maps a resource name to the serialized bytes of the last accepted
+  // copy of the resource, used to skip re-validating resources that did
+  // not change between ADS responses.
+  using ResourceSerializedProtoMap =
+      std::map<absl::string_view /*resource_name*/,
+               absl::string_view /*serialized_proto*/>;
   struct ResourceTypeMetadata {
     absl::string_view version;
     ResourceMetadataMap resource_metadata_map;
@@ -650,12 +666,19 @@ class XdsApi {
                               bool populate_node);
 
   // Parses an ADS response.
+  // Resources whose serialized bytes are found unchanged in the
+  // corresponding cached_*_protos map are marked unchanged in the
+  // resulting update map instead of being re-validated.
   AdsParseResult ParseAdsResponse(
       const XdsBootstrap::XdsServer& server, const grpc_slice& encoded_response,
       const std::set<absl::string_view>& expected_listener_names,
       const std::set<absl::string_view>& expected_route_configuration_names,
       const std::set<absl::string_view>& expected_cluster_names,
-      const std::set<absl::string_view>& expected_eds_service_names);
+      const std::set<absl::string_view>& expected_eds_service_names,
+      const ResourceSerializedProtoMap& cached_listener_protos,
+      const ResourceSerializedProtoMap& cached_route_configuration_protos,
+      const ResourceSerializedProtoMap& cached_cluster_protos,
+      const ResourceSerializedProtoMap& cached_eds_service_protos);
 
   // Creates an initial LRS request.
   grpc_slice CreateLrsInitialRequest(const XdsBootstrap::XdsServer& server);
@@ -891,6 +891,22 @@ bool XdsClient::ChannelState::AdsCallState::HasSubscribedResources() const {
 
 namespace {
 
+// Build a map from resource name to the serialized bytes of the last
+// accepted copy of each cached resource, so that the parser can skip
+// re-validating resources that did not change.
+template <typename StateMap>
+XdsApi::ResourceSerializedProtoMap GetCachedSerializedProtos(
+    const StateMap& state_map) {
+  XdsApi::ResourceSerializedProtoMap protos;
+  for (const auto& p : state_map) {
+    if (p.second.update.has_value() &&
+        p.second.meta.client_status == XdsApi::ResourceMetadata::ACKED) {
+      protos[p.first] = p.second.meta.serialized_proto;
+    }
+  }
+  return protos;
+}
+
 // Build a resource metadata struct for ADS result accepting methods and CSDS.
 XdsApi::ResourceMetadata CreateResourceMetadataAcked(
     std::string serialized_proto, std::string version,
@@ -922,6 +938,26 @@ void XdsClient::ChannelState::AdsCallState::AcceptLdsUpdateLocked(
     XdsApi::LdsUpdate& lds_update = p.second.resource;
     auto& state = lds_state.subscribed_resources[listener_name];
     if (state != nullptr) state->Finish();
+    // If the resource's bytes were identical to the copy we already
+    // accepted, there is nothing to update; just record the RDS
+    // resource name from the cached copy.
+    if (p.second.unchanged) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
+        gpr_log(GPR_INFO,
+                "[xds_client %p] LDS update for %s identical to current, "
+                "ignoring.",
+                xds_client(), listener_name.c_str());
+      }
+      auto it = xds_client()->listener_map_.find(listener_name);
+      if (it != xds_client()->listener_map_.end() &&
+          it->second.update.has_value() &&
+          !it->second.update->http_connection_manager.route_config_name
+               .empty()) {
+        rds_resource_names_seen.insert(
+            it->second.update->http_connection_manager.route_config_name);
+      }
+      continue;
+    }
     if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
       gpr_log(GPR_INFO, "[xds_client %p] LDS resource %s: %s", xds_client(),
               listener_name.c_str(), lds_update.ToString().c_str());
@@ -1020,6 +1056,16 @@ void XdsClient::ChannelState::AdsCallState::AcceptRdsUpdateLocked(
     XdsApi::RdsUpdate& rds_update = p.second.resource;
     auto& state = rds_state.subscribed_resources[route_config_name];
     if (state != nullptr) state->Finish();
+    // If the resource's bytes were identical to the copy we already
+    // accepted, there is nothing to update.
+    if (p.second.unchanged) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
+        gpr_log(GPR_INFO,
+                "[xds_client %p] RDS resource identical to current, ignoring",
+                xds_client());
+      }
+      continue;
+    }
     if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
       gpr_log(GPR_INFO, "[xds_client %p] RDS resource:\n%s", xds_client(),
               rds_update.ToString().c_str());
@@ -1064,6 +1110,25 @@ void XdsClient::ChannelState::AdsCallState::AcceptCdsUpdateLocked(
     XdsApi::CdsUpdate& cds_update = p.second.resource;
     auto& state = cds_state.subscribed_resources[cluster_name];
     if (state != nullptr) state->Finish();
+    // If the resource's bytes were identical to the copy we already
+    // accepted, there is nothing to update; just record the EDS
+    // resource name from the cached copy.
+    if (p.second.unchanged) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
+        gpr_log(GPR_INFO,
+                "[xds_client %p] CDS update identical to current, ignoring.",
+                xds_client());
+      }
+      auto it = xds_client()->cluster_map_.find(cluster_name);
+      if (it != xds_client()->cluster_map_.end() &&
+          it->second.update.has_value()) {
+        eds_resource_names_seen.insert(
+            it->second.update->eds_service_name.empty()
+                ? cluster_name
+                : it->second.update->eds_service_name);
+      }
+      continue;
+    }
     if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
       gpr_log(GPR_INFO, "[xds_client %p] cluster=%s: %s", xds_client(),
               cluster_name, cds_update.ToString().c_str());
@@ -1158,6 +1223,16 @@ void XdsClient::ChannelState::AdsCallState::AcceptEdsUpdateLocked(
     XdsApi::EdsUpdate& eds_update = p.second.resource;
     auto& state = eds_state.subscribed_resources[eds_service_name];
     if (state != nullptr) state->Finish();
+    // If the resource's bytes were identical to the copy we already
+    // accepted, there is nothing to update.
+    if (p.second.unchanged) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
+        gpr_log(GPR_INFO,
+                "[xds_client %p] EDS update identical to current, ignoring.",
+                xds_client());
+      }
+      continue;
+    }
     if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
       gpr_log(GPR_INFO, "[xds_client %p] EDS resource %s: %s", xds_client(),
               eds_service_name, eds_update.ToString().c_str());
@@ -1289,7 +1364,11 @@ bool XdsClient::ChannelState::AdsCallState::OnResponseReceivedLocked() {
       ResourceNamesForRequest(XdsApi::kLdsTypeUrl),
       ResourceNamesForRequest(XdsApi::kRdsTypeUrl),
       ResourceNamesForRequest(XdsApi::kCdsTypeUrl),
-      ResourceNamesForRequest(XdsApi::kEdsTypeUrl));
+      ResourceNamesForRequest(XdsApi::kEdsTypeUrl),
+      GetCachedSerializedProtos(xds_client()->listener_map_),
+      GetCachedSerializedProtos(xds_client()->route_config_map_),
+      GetCachedSerializedProtos(xds_client()->cluster_map_),
+      GetCachedSerializedProtos(xds_client()->endpoint_map_));
   grpc_slice_unref_internal(response_slice);
   if (result.type_url.empty()) {
     // Ignore unparsable response.
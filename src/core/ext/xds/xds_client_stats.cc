@@ -23,6 +23,7 @@
 #include <string.h>
 
 #include <grpc/support/atm.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/string_util.h>
 
 #include "src/core/ext/xds/xds_client.h"
@@ -106,6 +107,11 @@ XdsClusterLocalityStats::XdsClusterLocalityStats(
       cluster_name_(cluster_name),
       eds_service_name_(eds_service_name),
       name_(std::move(name)) {
+  num_cores_ = std::max(1u, gpr_cpu_num_cores());
+  per_cpu_counter_data_storage_.reserve(num_cores_);
+  for (size_t i = 0; i < num_cores_; ++i) {
+    per_cpu_counter_data_storage_.emplace_back();
+  }
   if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
     gpr_log(GPR_INFO,
             "[xds_client %p] created locality stats %p for {%s, %s, %s, %s}",
@@ -132,29 +138,39 @@ XdsClusterLocalityStats::~XdsClusterLocalityStats() {
 
 XdsClusterLocalityStats::Snapshot
 XdsClusterLocalityStats::GetSnapshotAndReset() {
-  Snapshot snapshot = {
-      GetAndResetCounter(&total_successful_requests_),
-      // Don't reset total_requests_in_progress because it's
-      // not related to a single reporting interval.
-      total_requests_in_progress_.load(std::memory_order_relaxed),
-      GetAndResetCounter(&total_error_requests_),
-      GetAndResetCounter(&total_issued_requests_),
-      {}};
+  Snapshot snapshot = {0, 0, 0, 0, {}};
+  for (size_t i = 0; i < num_cores_; ++i) {
+    AtomicCounterData& data = per_cpu_counter_data_storage_[i];
+    snapshot.total_successful_requests +=
+        GetAndResetCounter(&data.total_successful_requests);
+    // Don't reset total_requests_in_progress because it's
+    // not related to a single reporting interval.
+    snapshot.total_requests_in_progress +=
+        data.total_requests_in_progress.load(std::memory_order_relaxed);
+    snapshot.total_error_requests +=
+        GetAndResetCounter(&data.total_error_requests);
+    snapshot.total_issued_requests +=
+        GetAndResetCounter(&data.total_issued_requests);
+  }
   MutexLock lock(&backend_metrics_mu_);
   snapshot.backend_metrics = std::move(backend_metrics_);
   return snapshot;
 }
 
 void XdsClusterLocalityStats::AddCallStarted() {
-  total_issued_requests_.fetch_add(1, std::memory_order_relaxed);
-  total_requests_in_progress_.fetch_add(1, std::memory_order_relaxed);
+  AtomicCounterData& data =
+      per_cpu_counter_data_storage_[ExecCtx::Get()->starting_cpu()];
+  data.total_issued_requests.fetch_add(1, std::memory_order_relaxed);
+  data.total_requests_in_progress.fetch_add(1, std::memory_order_relaxed);
 }
 
 void XdsClusterLocalityStats::AddCallFinished(bool fail) {
+  AtomicCounterData& data =
+      per_cpu_counter_data_storage_[ExecCtx::Get()->starting_cpu()];
   std::atomic<uint64_t>& to_increment =
-      fail ? total_error_requests_ : total_successful_requests_;
+      fail ? data.total_error_requests : data.total_successful_requests;
   to_increment.fetch_add(1, std::memory_order_relaxed);
-  total_requests_in_progress_.fetch_add(-1, std::memory_order_acq_rel);
+  data.total_requests_in_progress.fetch_add(-1, std::memory_order_acq_rel);
 }
 
 }  // namespace grpc_core
@@ -25,6 +25,7 @@
 #include <map>
 #include <string>
 
+#include "absl/container/inlined_vector.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
@@ -221,10 +222,36 @@ class XdsClusterLocalityStats : public RefCounted<XdsClusterLocalityStats> {
   absl::string_view eds_service_name_;
   RefCountedPtr<XdsLocalityName> name_;
 
-  std::atomic<uint64_t> total_successful_requests_{0};
-  std::atomic<uint64_t> total_requests_in_progress_{0};
-  std::atomic<uint64_t> total_error_requests_{0};
-  std::atomic<uint64_t> total_issued_requests_{0};
+  // The request counters are sharded per CPU (same scheme as channelz's
+  // CallCountingHelper) so that data-plane threads on different cores do not
+  // bounce one cache line on every call; GetSnapshotAndReset() aggregates the
+  // shards. In-progress counts may be incremented and decremented on
+  // different shards as threads migrate, so individual shard values can wrap;
+  // the sums are computed modulo 2^64 and remain exact.
+  struct AtomicCounterData {
+    // Define the ctors so that we can use this structure in InlinedVector.
+    AtomicCounterData() = default;
+    AtomicCounterData(const AtomicCounterData& that)
+        : total_successful_requests(
+              that.total_successful_requests.load(std::memory_order_relaxed)),
+          total_requests_in_progress(
+              that.total_requests_in_progress.load(std::memory_order_relaxed)),
+          total_error_requests(
+              that.total_error_requests.load(std::memory_order_relaxed)),
+          total_issued_requests(
+              that.total_issued_requests.load(std::memory_order_relaxed)) {}
+
+    std::atomic<uint64_t> total_successful_requests{0};
+    std::atomic<uint64_t> total_requests_in_progress{0};
+    std::atomic<uint64_t> total_error_requests{0};
+    std::atomic<uint64_t> total_issued_requests{0};
+    // Make sure the size is exactly one cache line.
+    uint8_t padding[GPR_CACHELINE_SIZE - 4 * sizeof(std::atomic<uint64_t>)];
+  };
+
+  // Really zero-sized, but 0-sized arrays are illegal on MSVC.
+  absl::InlinedVector<AtomicCounterData, 1> per_cpu_counter_data_storage_;
+  size_t num_cores_ = 0;
 
   // Protects backend_metrics_. A mutex is necessary because the length of
   // backend_metrics_ can be accessed by both the callback intercepting the
@@ -18,6 +18,8 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <algorithm>
+
 #include "absl/strings/str_replace.h"
 
 #include "src/core/ext/xds/xds_certificate_provider.h"
@@ -48,7 +50,9 @@ class FilterChainMatchManager
       absl::optional<XdsApi::LdsUpdate::FilterChainData> default_filter_chain)
       : xds_client_(xds_client),
         filter_chain_map_(std::move(filter_chain_map)),
-        default_filter_chain_(std::move(default_filter_chain)) {}
+        default_filter_chain_(std::move(default_filter_chain)) {
+    CompileFilterChainMap();
+  }
 
   absl::StatusOr<grpc_channel_args*> UpdateChannelArgsForConnection(
       grpc_channel_args* args, grpc_endpoint* tcp) override;
@@ -76,10 +80,40 @@ class FilterChainMatchManager
   CreateOrGetXdsCertificateProviderFromFilterChainData(
       const XdsApi::LdsUpdate::FilterChainData* filter_chain);
 
+  // Filter chain matching runs for every incoming connection, so instead of
+  // interpreting the raw filter chain map each time, we compile it once at
+  // construction: ip entries are ordered longest prefix first (catch-alls
+  // last) so that the match scans can stop at the first subnet hit, and the
+  // decision of which source-type list applies is precomputed per
+  // destination entry. All pointers point into filter_chain_map_, which is
+  // immutable for the lifetime of this object.
+  struct CompiledDestinationIp {
+    const XdsApi::LdsUpdate::FilterChainMap::DestinationIp* destination_ip;
+    // Source ip entries per connection source type, longest prefix first
+    std::array<std::vector<const XdsApi::LdsUpdate::FilterChainMap::SourceIp*>,
+               3>
+        source_ips;
+    // True if the kSameIpOrLoopback and kExternal lists are both empty, in
+    // which case every connection uses the kAny list
+    bool use_any_source_type;
+  };
+
+  void CompileFilterChainMap();
+
+  static const XdsApi::LdsUpdate::FilterChainData*
+  FindFilterChainDataForSourceType(const CompiledDestinationIp& destination,
+                                   grpc_endpoint* tcp,
+                                   absl::string_view destination_ip);
+
+  const XdsApi::LdsUpdate::FilterChainData* FindFilterChainDataForDestinationIp(
+      grpc_endpoint* tcp) const;
+
   const RefCountedPtr<XdsClient> xds_client_;
   const XdsApi::LdsUpdate::FilterChainMap filter_chain_map_;
   const absl::optional<XdsApi::LdsUpdate::FilterChainData>
       default_filter_chain_;
+  // Compiled form of filter_chain_map_, longest destination prefixes first
+  std::vector<CompiledDestinationIp> compiled_destination_ips_;
   Mutex mu_;
   std::map<const XdsApi::LdsUpdate::FilterChainData*, CertificateProviders>
       certificate_providers_map_ ABSL_GUARDED_BY(mu_);
@@ -122,36 +156,50 @@ const XdsApi::LdsUpdate::FilterChainData* FindFilterChainDataForSourcePort(
   return nullptr;
 }
 
+// Orders ip entries so that longer prefixes come first and catch-all entries
+// (no prefix range) come last. A linear scan over the result can then stop at
+// the first matching entry, which is necessarily the longest prefix match.
+// The sort is stable, so entries with equal prefix lengths keep their
+// original order, preserving the previous first-wins tie-break.
+template <typename T>
+std::vector<const T*> SortByPrefixLength(const std::vector<T>& entries) {
+  std::vector<const T*> sorted;
+  sorted.reserve(entries.size());
+  for (const auto& entry : entries) {
+    sorted.push_back(&entry);
+  }
+  std::stable_sort(sorted.begin(), sorted.end(), [](const T* a, const T* b) {
+    const int a_len = a->prefix_range.has_value()
+                          ? static_cast<int>(a->prefix_range->prefix_len)
+                          : -1;
+    const int b_len = b->prefix_range.has_value()
+                          ? static_cast<int>(b->prefix_range->prefix_len)
+                          : -1;
+    return a_len > b_len;
+  });
+  return sorted;
+}
+
 const XdsApi::LdsUpdate::FilterChainData* FindFilterChainDataForSourceIp(
-    const XdsApi::LdsUpdate::FilterChainMap::SourceIpVector& source_ip_vector,
+    const std::vector<const XdsApi::LdsUpdate::FilterChainMap::SourceIp*>&
+        source_ips,
     const grpc_resolved_address* source_ip, absl::string_view port) {
-  const XdsApi::LdsUpdate::FilterChainMap::SourceIp* best_match = nullptr;
-  for (const auto& entry : source_ip_vector) {
-    // Special case for catch-all
-    if (!entry.prefix_range.has_value()) {
-      if (best_match == nullptr) {
-        best_match = &entry;
-      }
-      continue;
-    }
-    if (best_match != nullptr && best_match->prefix_range.has_value() &&
-        best_match->prefix_range->prefix_len >=
-            entry.prefix_range->prefix_len) {
-      continue;
-    }
-    if (grpc_sockaddr_match_subnet(source_ip, &entry.prefix_range->address,
-                                   entry.prefix_range->prefix_len)) {
-      best_match = &entry;
+  // Entries are longest prefix first with catch-alls last, so the first hit
+  // is the best match
+  for (const auto* entry : source_ips) {
+    if (!entry->prefix_range.has_value() ||
+        grpc_sockaddr_match_subnet(source_ip, &entry->prefix_range->address,
+                                   entry->prefix_range->prefix_len)) {
+      return FindFilterChainDataForSourcePort(entry->ports_map, port);
     }
   }
-  if (best_match == nullptr) return nullptr;
-  return FindFilterChainDataForSourcePort(best_match->ports_map, port);
+  return nullptr;
 }
 
-const XdsApi::LdsUpdate::FilterChainData* FindFilterChainDataForSourceType(
-    const XdsApi::LdsUpdate::FilterChainMap::ConnectionSourceTypesArray&
-        source_types_array,
-    grpc_endpoint* tcp, absl::string_view destination_ip) {
+const XdsApi::LdsUpdate::FilterChainData*
+FilterChainMatchManager::FindFilterChainDataForSourceType(
+    const CompiledDestinationIp& destination, grpc_endpoint* tcp,
+    absl::string_view destination_ip) {
   auto source_uri = URI::Parse(grpc_endpoint_get_peer(tcp));
   if (!source_uri.ok() ||
       (source_uri->scheme() != "ipv4" && source_uri->scheme() != "ipv6")) {
@@ -171,38 +219,32 @@ const XdsApi::LdsUpdate::FilterChainData* FindFilterChainDataForSourceType(
     GRPC_ERROR_UNREF(error);
     return nullptr;
   }
-  // Use kAny only if kSameIporLoopback and kExternal are empty
-  if (source_types_array[static_cast<int>(
-                             XdsApi::LdsUpdate::FilterChainMap::
-                                 ConnectionSourceType::kSameIpOrLoopback)]
-          .empty() &&
-      source_types_array[static_cast<int>(XdsApi::LdsUpdate::FilterChainMap::
-                                              ConnectionSourceType::kExternal)]
-          .empty()) {
+  // Use kAny only if kSameIporLoopback and kExternal are empty; this was
+  // determined when the filter chain map was compiled
+  if (destination.use_any_source_type) {
     return FindFilterChainDataForSourceIp(
-        source_types_array[static_cast<int>(
+        destination.source_ips[static_cast<int>(
             XdsApi::LdsUpdate::FilterChainMap::ConnectionSourceType::kAny)],
         &source_addr, port);
   }
   if (IsLoopbackIp(&source_addr) || host == destination_ip) {
     return FindFilterChainDataForSourceIp(
-        source_types_array[static_cast<int>(
+        destination.source_ips[static_cast<int>(
             XdsApi::LdsUpdate::FilterChainMap::ConnectionSourceType::
                 kSameIpOrLoopback)],
         &source_addr, port);
   } else {
     return FindFilterChainDataForSourceIp(
-        source_types_array[static_cast<int>(
+        destination.source_ips[static_cast<int>(
             XdsApi::LdsUpdate::FilterChainMap::ConnectionSourceType::
                 kExternal)],
         &source_addr, port);
   }
 }
 
-const XdsApi::LdsUpdate::FilterChainData* FindFilterChainDataForDestinationIp(
-    const XdsApi::LdsUpdate::FilterChainMap::DestinationIpVector
-        destination_ip_vector,
-    grpc_endpoint* tcp) {
+const XdsApi::LdsUpdate::FilterChainData*
+FilterChainMatchManager::FindFilterChainDataForDestinationIp(
+    grpc_endpoint* tcp) const {
   auto destination_uri = URI::Parse(grpc_endpoint_get_local_address(tcp));
   if (!destination_uri.ok() || (destination_uri->scheme() != "ipv4" &&
                                 destination_uri->scheme() != "ipv6")) {
@@ -222,29 +264,43 @@ const XdsApi::LdsUpdate::FilterChainData* FindFilterChainDataForDestinationIp(
     GRPC_ERROR_UNREF(error);
     return nullptr;
   }
-  const XdsApi::LdsUpdate::FilterChainMap::DestinationIp* best_match = nullptr;
-  for (const auto& entry : destination_ip_vector) {
-    // Special case for catch-all
-    if (!entry.prefix_range.has_value()) {
-      if (best_match == nullptr) {
-        best_match = &entry;
-      }
-      continue;
+  // Entries are longest prefix first with catch-alls last, so the first hit
+  // is the best match
+  for (const auto& entry : compiled_destination_ips_) {
+    const auto& prefix_range = entry.destination_ip->prefix_range;
+    if (!prefix_range.has_value() ||
+        grpc_sockaddr_match_subnet(&destination_addr, &prefix_range->address,
+                                   prefix_range->prefix_len)) {
+      return FindFilterChainDataForSourceType(entry, tcp, host);
     }
-    if (best_match != nullptr && best_match->prefix_range.has_value() &&
-        best_match->prefix_range->prefix_len >=
-            entry.prefix_range->prefix_len) {
-      continue;
-    }
-    if (grpc_sockaddr_match_subnet(&destination_addr,
-                                   &entry.prefix_range->address,
-                                   entry.prefix_range->prefix_len)) {
-      best_match = &entry;
+  }
+  return nullptr;
+}
+
+void FilterChainMatchManager::CompileFilterChainMap() {
+  const auto sorted_destinations =
+      SortByPrefixLength(filter_chain_map_.destination_ip_vector);
+  compiled_destination_ips_.reserve(sorted_destinations.size());
+  for (const auto* destination_ip : sorted_destinations) {
+    CompiledDestinationIp compiled;
+    compiled.destination_ip = destination_ip;
+    for (size_t i = 0; i < compiled.source_ips.size(); ++i) {
+      compiled.source_ips[i] =
+          SortByPrefixLength(destination_ip->source_types_array[i]);
     }
+    compiled.use_any_source_type =
+        destination_ip
+            ->source_types_array[static_cast<int>(
+                XdsApi::LdsUpdate::FilterChainMap::ConnectionSourceType::
+                    kSameIpOrLoopback)]
+            .empty() &&
+        destination_ip
+            ->source_types_array[static_cast<int>(
+                XdsApi::LdsUpdate::FilterChainMap::ConnectionSourceType::
+                    kExternal)]
+            .empty();
+    compiled_destination_ips_.push_back(std::move(compiled));
   }
-  if (best_match == nullptr) return nullptr;
-  return FindFilterChainDataForSourceType(best_match->source_types_array, tcp,
-                                          host);
 }
 
 absl::StatusOr<RefCountedPtr<XdsCertificateProvider>>
@@ -314,8 +370,7 @@ FilterChainMatchManager::CreateOrGetXdsCertificateProviderFromFilterChainData(
 absl::StatusOr<grpc_channel_args*>
 FilterChainMatchManager::UpdateChannelArgsForConnection(grpc_channel_args* args,
                                                         grpc_endpoint* tcp) {
-  const auto* filter_chain = FindFilterChainDataForDestinationIp(
-      filter_chain_map_.destination_ip_vector, tcp);
+  const auto* filter_chain = FindFilterChainDataForDestinationIp(tcp);
   if (filter_chain == nullptr && default_filter_chain_.has_value()) {
     filter_chain = &default_filter_chain_.value();
   }
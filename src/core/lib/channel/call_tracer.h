@@ -24,6 +24,7 @@
 #include "absl/strings/string_view.h"
 
 #include "src/core/lib/channel/channel_stack.h"
+#include "src/core/lib/iomgr/buffer_list.h"
 #include "src/core/lib/transport/byte_stream.h"
 #include "src/core/lib/transport/metadata_batch.h"
 
@@ -53,6 +54,29 @@ class CallTracer {
     virtual void RecordSendTrailingMetadata(
         grpc_metadata_batch* send_trailing_metadata) = 0;
     virtual void RecordSendMessage(const ByteStream& send_message) = 0;
+    // If the channel has write timestamp collection enabled (see
+    // GRPC_ARG_EXPERIMENTAL_COLLECT_WRITE_TIMESTAMPS), invoked once per
+    // transport write that carried outgoing message bytes of this attempt,
+    // when the endpoint write completes and while the corresponding send op
+    // is still pending. The sendmsg/sent times are taken from the userspace
+    // clock so they are available on every platform; kernel scheduled/sent/
+    // acked timestamps (Linux SO_TIMESTAMPING, see buffer_list.h) continue
+    // to be delivered through the timestamps callback pipeline when
+    // configured. byte_offset is the number of bytes written for this call
+    // so far, including this write.
+    virtual void RecordWriteTimestamps(const Timestamps& /*timestamps*/) {}
+    // Reason the transport stalled this attempt's stream waiting for HTTP/2
+    // flow control credit.
+    enum class FlowControlStallCause {
+      kTransportWindow,
+      kStreamWindow,
+    };
+    // Invoked when the transport resumes (or abandons) this attempt's stream
+    // after it was parked waiting for flow control credit, with the cause and
+    // how long the stream was parked. Default is a no-op so that tracers
+    // uninterested in stalls pay nothing.
+    virtual void RecordFlowControlStall(FlowControlStallCause /*cause*/,
+                                        grpc_millis /*stalled_ms*/) {}
     // The `RecordReceivedInitialMetadata()` and `RecordReceivedMessage()`
     // methods should only be invoked when the metadata/message was
     // successfully received, i.e., without any error.
@@ -35,6 +35,7 @@
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
 
+#include "src/core/lib/gpr/murmur_hash.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gpr/useful.h"
 
@@ -318,6 +319,66 @@ bool grpc_channel_args_want_minimal_stack(const grpc_channel_args* args) {
       grpc_channel_args_find(args, GRPC_ARG_MINIMAL_STACK), false);
 }
 
+namespace grpc_core {
+
+RefCountedPtr<ChannelArgs> ChannelArgs::Create(const grpc_channel_args* args) {
+  return RefCountedPtr<ChannelArgs>(new ChannelArgs(args));
+}
+
+ChannelArgs::ChannelArgs(const grpc_channel_args* args) {
+  static const grpc_channel_args kEmptyArgs = {0, nullptr};
+  if (args == nullptr) args = &kEmptyArgs;
+  grpc_channel_args* normalized = grpc_channel_args_normalize(args);
+  // The sort is stable and Find() must return the first occurrence of a
+  // duplicated key (matching grpc_channel_args_find()), so keep the first
+  // arg of each equal-key run.
+  std::vector<grpc_arg> kept;
+  kept.reserve(normalized->num_args);
+  for (size_t i = 0; i < normalized->num_args; ++i) {
+    if (!kept.empty() &&
+        strcmp(normalized->args[i].key, kept.back().key) == 0) {
+      continue;
+    }
+    kept.push_back(normalized->args[i]);
+  }
+  grpc_channel_args deduplicated = {kept.size(),
+                                    kept.empty() ? nullptr : kept.data()};
+  args_ = grpc_channel_args_copy(&deduplicated);
+  grpc_channel_args_destroy(normalized);
+  // Build the lookup table.
+  if (args_->num_args > 0) {
+    size_t table_size = 8;
+    while (table_size < 2 * args_->num_args) table_size *= 2;
+    table_.assign(table_size, 0);
+    const size_t mask = table_size - 1;
+    for (size_t i = 0; i < args_->num_args; ++i) {
+      const char* key = args_->args[i].key;
+      size_t slot = gpr_murmur_hash3(key, strlen(key), 0) & mask;
+      while (table_[slot] != 0) {
+        slot = (slot + 1) & mask;
+      }
+      table_[slot] = static_cast<uint32_t>(i + 1);
+    }
+  }
+}
+
+ChannelArgs::~ChannelArgs() { grpc_channel_args_destroy(args_); }
+
+const grpc_arg* ChannelArgs::Find(const char* name) const {
+  if (table_.empty() || name == nullptr) return nullptr;
+  const size_t mask = table_.size() - 1;
+  size_t slot = gpr_murmur_hash3(name, strlen(name), 0) & mask;
+  while (true) {
+    const uint32_t index = table_[slot];
+    if (index == 0) return nullptr;
+    const grpc_arg* arg = &args_->args[index - 1];
+    if (strcmp(arg->key, name) == 0) return arg;
+    slot = (slot + 1) & mask;
+  }
+}
+
+}  // namespace grpc_core
+
 grpc_arg grpc_channel_arg_string_create(char* name, char* value) {
   grpc_arg arg;
   arg.type = GRPC_ARG_STRING;
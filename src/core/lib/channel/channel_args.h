@@ -22,9 +22,12 @@
 #include <grpc/support/port_platform.h>
 
 #include <string>
+#include <vector>
 
 #include <grpc/grpc.h>
 
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/surface/channel_stack_type.h"
 
 // Channel args are intentionally immutable, to avoid the need for locking.
@@ -110,6 +113,61 @@ T* grpc_channel_args_find_pointer(const grpc_channel_args* args,
   return static_cast<T*>(arg->value.pointer.p);
 }
 
+namespace grpc_core {
+
+// An immutable, preprocessed view of a set of channel args.  The args are
+// copied, stably sorted and deduplicated at construction and indexed by a
+// small open-addressed hash table keyed on the arg name, so that each
+// lookup is O(1) instead of the linear scan in grpc_channel_args_find().
+// The object is refcounted so that one preprocessed copy can be shared
+// across the channel, subchannel and transport layers instead of each
+// layer rescanning (or renormalizing) the same array.
+class ChannelArgs : public RefCounted<ChannelArgs> {
+ public:
+  // Makes a preprocessed copy of \a args (which may be null).
+  static RefCountedPtr<ChannelArgs> Create(const grpc_channel_args* args);
+
+  ~ChannelArgs() override;
+
+  // Returns the arg named \a name, or null if not present.  Duplicate keys
+  // in the source args resolve to the first occurrence, matching
+  // grpc_channel_args_find().
+  const grpc_arg* Find(const char* name) const;
+
+  // Typed lookups, with the same semantics as the corresponding
+  // grpc_channel_args_find_* helpers.
+  int FindInteger(const char* name, grpc_integer_options options) const {
+    return grpc_channel_arg_get_integer(Find(name), options);
+  }
+  bool FindBool(const char* name, bool default_value) const {
+    return grpc_channel_arg_get_bool(Find(name), default_value);
+  }
+  char* FindString(const char* name) const {
+    return grpc_channel_arg_get_string(Find(name));
+  }
+  template <typename T>
+  T* FindPointer(const char* name) const {
+    const grpc_arg* arg = Find(name);
+    if (arg == nullptr || arg->type != GRPC_ARG_POINTER) return nullptr;
+    return static_cast<T*>(arg->value.pointer.p);
+  }
+
+  // The underlying normalized, deduplicated args, for passing to code that
+  // still takes a raw grpc_channel_args array.
+  const grpc_channel_args* args() const { return args_; }
+
+ private:
+  explicit ChannelArgs(const grpc_channel_args* args);
+
+  grpc_channel_args* args_ = nullptr;  // Owned.
+  // Open-addressed table of indices into args_->args, offset by one so
+  // that zero means an empty slot.  Sized to a power of two at least twice
+  // the number of args, so probe chains stay short.
+  std::vector<uint32_t> table_;
+};
+
+}  // namespace grpc_core
+
 // Helpers for creating channel args.
 grpc_arg grpc_channel_arg_string_create(char* name, char* value);
 grpc_arg grpc_channel_arg_integer_create(char* name, int value);
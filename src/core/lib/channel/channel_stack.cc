@@ -27,6 +27,7 @@
 #include <grpc/support/log.h>
 
 #include "src/core/lib/gpr/alloc.h"
+#include "src/core/lib/promise/exec_ctx_wakeup_scheduler.h"
 
 grpc_core::TraceFlag grpc_trace_channel(false, "channel");
 
@@ -121,9 +122,14 @@ grpc_error_handle grpc_channel_stack_init(
               GPR_ROUND_UP_TO_ALIGNMENT_SIZE(filter_count *
                                              sizeof(grpc_channel_element));
 
-  /* init per-filter data */
+  /* init per-filter data; the stack can run on the promise engine only if
+     every filter can */
+  stack->can_run_promise = filter_count > 0;
   grpc_error_handle first_error = GRPC_ERROR_NONE;
   for (i = 0; i < filter_count; i++) {
+    if (filters[i]->make_call_promise == nullptr) {
+      stack->can_run_promise = false;
+    }
     args.channel_stack = stack;
     args.channel_args = channel_args;
     args.optional_transport = optional_transport;
@@ -164,6 +170,41 @@ void grpc_channel_stack_destroy(grpc_channel_stack* stack) {
   }
 }
 
+namespace {
+
+grpc_core::Promise<absl::Status> MakeCallPromiseFromElem(
+    grpc_channel_stack* stack, size_t elem_idx,
+    grpc_core::CallArgs call_args) {
+  grpc_channel_element* elem = grpc_channel_stack_element(stack, elem_idx);
+  return elem->filter->make_call_promise(
+      elem, std::move(call_args),
+      [stack, elem_idx](grpc_core::CallArgs call_args) {
+        /* the terminating element must not request a next promise */
+        GPR_ASSERT(elem_idx + 1 < stack->count);
+        return MakeCallPromiseFromElem(stack, elem_idx + 1,
+                                       std::move(call_args));
+      });
+}
+
+}  // namespace
+
+grpc_core::Promise<absl::Status> grpc_channel_stack_make_call_promise(
+    grpc_channel_stack* stack, grpc_core::CallArgs call_args) {
+  GPR_ASSERT(stack->can_run_promise);
+  return MakeCallPromiseFromElem(stack, 0, std::move(call_args));
+}
+
+grpc_core::ActivityPtr grpc_channel_stack_spawn_call_promise(
+    grpc_channel_stack* stack, grpc_core::CallArgs call_args,
+    std::function<void(absl::Status)> on_done) {
+  return grpc_core::MakeActivity(
+      [stack, call_args]() mutable {
+        return grpc_channel_stack_make_call_promise(stack,
+                                                    std::move(call_args));
+      },
+      grpc_core::ExecCtxWakeupScheduler(), std::move(on_done));
+}
+
 grpc_error_handle grpc_call_stack_init(
     grpc_channel_stack* channel_stack, int initial_refs,
     grpc_iomgr_cb_func destroy, void* destroy_arg,
@@ -235,24 +276,6 @@ void grpc_call_stack_destroy(grpc_call_stack* stack,
   }
 }
 
-void grpc_call_next_op(grpc_call_element* elem,
-                       grpc_transport_stream_op_batch* op) {
-  grpc_call_element* next_elem = elem + 1;
-  GRPC_CALL_LOG_OP(GPR_INFO, next_elem, op);
-  next_elem->filter->start_transport_stream_op_batch(next_elem, op);
-}
-
-void grpc_channel_next_get_info(grpc_channel_element* elem,
-                                const grpc_channel_info* channel_info) {
-  grpc_channel_element* next_elem = elem + 1;
-  next_elem->filter->get_channel_info(next_elem, channel_info);
-}
-
-void grpc_channel_next_op(grpc_channel_element* elem, grpc_transport_op* op) {
-  grpc_channel_element* next_elem = elem + 1;
-  next_elem->filter->start_transport_op(next_elem, op);
-}
-
 grpc_channel_stack* grpc_channel_stack_from_top_element(
     grpc_channel_element* elem) {
   return reinterpret_cast<grpc_channel_stack*>(
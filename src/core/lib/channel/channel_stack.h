@@ -52,11 +52,15 @@
 #include <grpc/support/log.h>
 #include <grpc/support/time.h>
 
+#include "absl/status/status.h"
+
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gpr/time_precise.h"
 #include "src/core/lib/gprpp/arena.h"
 #include "src/core/lib/iomgr/call_combiner.h"
 #include "src/core/lib/iomgr/polling_entity.h"
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/promise.h"
 #include "src/core/lib/transport/transport.h"
 
 typedef struct grpc_channel_element grpc_channel_element;
@@ -94,6 +98,22 @@ struct grpc_call_final_info {
   const char* error_string = nullptr;
 };
 
+namespace grpc_core {
+
+/* Arguments to a filter's call promise (see make_call_promise below). For
+   now this carries only the client's initial metadata; further call data
+   will be threaded through here as filters are converted. */
+struct CallArgs {
+  grpc_metadata_batch* client_initial_metadata;
+};
+
+/* Constructs the promise for the remainder of the stack below a filter. A
+   filter's call promise invokes this (at most once) to obtain the next
+   element's promise and composes its own logic around it. */
+using NextPromiseFactory = std::function<Promise<absl::Status>(CallArgs)>;
+
+}  // namespace grpc_core
+
 /* Channel filters specify:
    1. the amount of memory needed in the channel & call (via the sizeof_XXX
       members)
@@ -160,6 +180,19 @@ struct grpc_channel_filter {
 
   /* The name of this filter */
   const char* name;
+
+  /* Optional, may be null: construct a promise that executes one call
+     through this filter and everything below it. This is the staging point
+     for the promise-based call execution engine: once every filter in a
+     stack implements it, calls on that stack can run as a single Activity
+     polled in one loop rather than as a chain of batches and closures.
+     Filters above the terminating element receive a factory producing the
+     next element's promise; the terminating element must not invoke it.
+     Filter definitions that omit this member zero-initialize it and keep
+     using the batch path above. */
+  grpc_core::Promise<absl::Status> (*make_call_promise)(
+      grpc_channel_element* elem, grpc_core::CallArgs call_args,
+      grpc_core::NextPromiseFactory next_promise_factory);
 };
 /* A channel_element tracks its filter and the filter requested memory within
    a channel allocation */
@@ -185,6 +218,10 @@ struct grpc_channel_stack {
   /* Memory required for a call stack (computed at channel stack
      initialization) */
   size_t call_stack_size;
+  /* True if every filter implements make_call_promise, i.e. calls on this
+     stack can run on the promise engine (computed at channel stack
+     initialization) */
+  bool can_run_promise;
 };
 
 /* A call stack tracks a set of related filters for one call, and guarantees
@@ -226,6 +263,19 @@ grpc_error_handle grpc_channel_stack_init(
 /* Destroy a channel stack */
 void grpc_channel_stack_destroy(grpc_channel_stack* stack);
 
+/* Construct the promise executing one call across every filter in the
+   stack. Requires stack->can_run_promise. */
+grpc_core::Promise<absl::Status> grpc_channel_stack_make_call_promise(
+    grpc_channel_stack* stack, grpc_core::CallArgs call_args);
+
+/* Spawn the promise for one call on its own activity, scheduling wakeups
+   through the ExecCtx; on_done receives the call's final status. The
+   returned ActivityPtr owns the call's execution: dropping it cancels the
+   call. */
+grpc_core::ActivityPtr grpc_channel_stack_spawn_call_promise(
+    grpc_channel_stack* stack, grpc_core::CallArgs call_args,
+    std::function<void(absl::Status)> on_done);
+
 /* Initialize a call stack given a channel stack. transport_server_data is
    expected to be NULL on a client, or an opaque transport owned pointer on the
    server. */
@@ -280,16 +330,6 @@ void grpc_call_stack_destroy(grpc_call_stack* stack,
  * at all. Does nothing. */
 void grpc_call_stack_ignore_set_pollset_or_pollset_set(
     grpc_call_element* elem, grpc_polling_entity* pollent);
-/* Call the next operation in a call stack */
-void grpc_call_next_op(grpc_call_element* elem,
-                       grpc_transport_stream_op_batch* op);
-/* Call the next operation (depending on call directionality) in a channel
-   stack */
-void grpc_channel_next_op(grpc_channel_element* elem, grpc_transport_op* op);
-/* Pass through a request to get_channel_info() to the next child element */
-void grpc_channel_next_get_info(grpc_channel_element* elem,
-                                const grpc_channel_info* channel_info);
-
 /* Given the top element of a channel stack, get the channel stack itself */
 grpc_channel_stack* grpc_channel_stack_from_top_element(
     grpc_channel_element* elem);
@@ -309,4 +349,31 @@ extern grpc_core::TraceFlag grpc_trace_channel;
     }                                                  \
   } while (0)
 
+/* These dispatch helpers sit on the per-op fast path of every filter, so
+   they are defined inline: the calling filter then jumps straight through
+   the next filter's vtable instead of through an extra out-of-line hop. */
+
+/* Call the next operation in a call stack */
+inline void grpc_call_next_op(grpc_call_element* elem,
+                              grpc_transport_stream_op_batch* op) {
+  grpc_call_element* next_elem = elem + 1;
+  GRPC_CALL_LOG_OP(GPR_INFO, next_elem, op);
+  next_elem->filter->start_transport_stream_op_batch(next_elem, op);
+}
+
+/* Call the next operation (depending on call directionality) in a channel
+   stack */
+inline void grpc_channel_next_op(grpc_channel_element* elem,
+                                 grpc_transport_op* op) {
+  grpc_channel_element* next_elem = elem + 1;
+  next_elem->filter->start_transport_op(next_elem, op);
+}
+
+/* Pass through a request to get_channel_info() to the next child element */
+inline void grpc_channel_next_get_info(grpc_channel_element* elem,
+                                       const grpc_channel_info* channel_info) {
+  grpc_channel_element* next_elem = elem + 1;
+  next_elem->filter->get_channel_info(next_elem, channel_info);
+}
+
 #endif /* GRPC_CORE_LIB_CHANNEL_CHANNEL_STACK_H */
@@ -201,6 +201,26 @@ bool grpc_channel_stack_builder_remove_filter(
   return true;
 }
 
+size_t grpc_channel_stack_builder_num_filters(
+    grpc_channel_stack_builder* builder) {
+  size_t num_filters = 0;
+  for (filter_node* p = builder->begin.next; p != &builder->end; p = p->next) {
+    num_filters++;
+  }
+  return num_filters;
+}
+
+void grpc_channel_stack_builder_export_filters(
+    grpc_channel_stack_builder* builder,
+    grpc_channel_stack_builder_filter_entry* entries) {
+  for (filter_node* p = builder->begin.next; p != &builder->end; p = p->next) {
+    entries->filter = p->filter;
+    entries->post_init_func = p->init;
+    entries->user_data = p->init_arg;
+    entries++;
+  }
+}
+
 bool grpc_channel_stack_builder_prepend_filter(
     grpc_channel_stack_builder* builder, const grpc_channel_filter* filter,
     grpc_post_filter_create_init_func post_init_func, void* user_data) {
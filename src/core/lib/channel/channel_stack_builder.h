@@ -139,6 +139,24 @@ bool grpc_channel_stack_builder_append_filter(
 bool grpc_channel_stack_builder_remove_filter(
     grpc_channel_stack_builder* builder, const char* filter_name);
 
+/// A snapshot of one filter entry in a builder, as captured by
+/// grpc_channel_stack_builder_export_filters.
+typedef struct {
+  const grpc_channel_filter* filter;
+  grpc_post_filter_create_init_func post_init_func;
+  void* user_data;
+} grpc_channel_stack_builder_filter_entry;
+
+/// Returns the number of filters currently added to \a builder.
+size_t grpc_channel_stack_builder_num_filters(
+    grpc_channel_stack_builder* builder);
+
+/// Copies the builder's current filter list, in order, into \a entries, which
+/// must have room for grpc_channel_stack_builder_num_filters() elements.
+void grpc_channel_stack_builder_export_filters(
+    grpc_channel_stack_builder* builder,
+    grpc_channel_stack_builder_filter_entry* entries);
+
 /// Terminate iteration and destroy \a iterator
 void grpc_channel_stack_builder_iterator_destroy(
     grpc_channel_stack_builder_iterator* iterator);
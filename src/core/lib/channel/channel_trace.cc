@@ -24,11 +24,14 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <algorithm>
+
 #include <grpc/grpc.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
 
+#include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/channel/status_util.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gpr/useful.h"
@@ -42,36 +45,22 @@
 namespace grpc_core {
 namespace channelz {
 
-ChannelTrace::TraceEvent::TraceEvent(Severity severity, const grpc_slice& data,
-                                     RefCountedPtr<BaseNode> referenced_entity)
-    : severity_(severity),
-      data_(data),
-      timestamp_(grpc_millis_to_timespec(grpc_core::ExecCtx::Get()->Now(),
-                                         GPR_CLOCK_REALTIME)),
-      next_(nullptr),
-      referenced_entity_(std::move(referenced_entity)),
-      memory_usage_(sizeof(TraceEvent) + grpc_slice_memory_usage(data)) {}
-
-ChannelTrace::TraceEvent::TraceEvent(Severity severity, const grpc_slice& data)
-    : severity_(severity),
-      data_(data),
-      timestamp_(grpc_millis_to_timespec(grpc_core::ExecCtx::Get()->Now(),
-                                         GPR_CLOCK_REALTIME)),
-      next_(nullptr),
-      memory_usage_(sizeof(TraceEvent) + grpc_slice_memory_usage(data)) {}
-
-ChannelTrace::TraceEvent::~TraceEvent() { grpc_slice_unref_internal(data_); }
+constexpr size_t ChannelTrace::kEventDescriptionSize;
 
 ChannelTrace::ChannelTrace(size_t max_event_memory)
     : num_events_logged_(0),
-      event_list_memory_usage_(0),
       max_event_memory_(max_event_memory),
-      head_trace_(nullptr),
-      tail_trace_(nullptr) {
+      num_slots_(max_event_memory / sizeof(EventRecord)),
+      next_slot_(0),
+      events_(nullptr) {
   if (max_event_memory_ == 0) {
     return;  // tracing is disabled if max_event_memory_ == 0
   }
   gpr_mu_init(&tracer_mu_);
+  if (num_slots_ > 0) {
+    events_ = static_cast<EventRecord*>(
+        gpr_malloc(num_slots_ * sizeof(EventRecord)));
+  }
   time_created_ = grpc_millis_to_timespec(grpc_core::ExecCtx::Get()->Now(),
                                           GPR_CLOCK_REALTIME);
 }
@@ -80,54 +69,51 @@ ChannelTrace::~ChannelTrace() {
   if (max_event_memory_ == 0) {
     return;  // tracing is disabled if max_event_memory_ == 0
   }
-  TraceEvent* it = head_trace_;
-  while (it != nullptr) {
-    TraceEvent* to_free = it;
-    it = it->next();
-    delete to_free;
-  }
+  gpr_free(events_);
   gpr_mu_destroy(&tracer_mu_);
 }
 
-void ChannelTrace::AddTraceEventHelper(TraceEvent* new_trace_event) {
+void ChannelTrace::AddTraceEventHelper(Severity severity,
+                                       const grpc_slice& data,
+                                       BaseNode* referenced_entity) {
   ++num_events_logged_;
-  // first event case
-  if (head_trace_ == nullptr) {
-    head_trace_ = tail_trace_ = new_trace_event;
-  }
-  // regular event add case
-  else {
-    tail_trace_->set_next(new_trace_event);
-    tail_trace_ = tail_trace_->next();
-  }
-  event_list_memory_usage_ += new_trace_event->memory_usage();
-  // maybe garbage collect the tail until we are under the memory limit.
-  while (event_list_memory_usage_ > max_event_memory_) {
-    TraceEvent* to_free = head_trace_;
-    event_list_memory_usage_ -= to_free->memory_usage();
-    head_trace_ = head_trace_->next();
-    delete to_free;
+  // The memory limit may be too small to hold even a single record.
+  if (num_slots_ == 0) return;
+  // Overwrite the oldest record once the ring has wrapped.
+  EventRecord* event = &events_[next_slot_];
+  next_slot_ = (next_slot_ + 1) % num_slots_;
+  event->timestamp = grpc_millis_to_timespec(grpc_core::ExecCtx::Get()->Now(),
+                                             GPR_CLOCK_REALTIME);
+  event->severity = severity;
+  if (referenced_entity != nullptr) {
+    event->referenced_uuid = referenced_entity->uuid();
+    event->referenced_entity_is_channel =
+        referenced_entity->type() == BaseNode::EntityType::kTopLevelChannel ||
+        referenced_entity->type() == BaseNode::EntityType::kInternalChannel;
+  } else {
+    event->referenced_uuid = 0;
+    event->referenced_entity_is_channel = false;
   }
+  const size_t data_length =
+      std::min(GRPC_SLICE_LENGTH(data), kEventDescriptionSize - 1);
+  memcpy(event->description, GRPC_SLICE_START_PTR(data), data_length);
+  event->description[data_length] = '\0';
 }
 
 void ChannelTrace::AddTraceEvent(Severity severity, const grpc_slice& data) {
-  if (max_event_memory_ == 0) {
-    grpc_slice_unref_internal(data);
-    return;  // tracing is disabled if max_event_memory_ == 0
+  if (max_event_memory_ > 0) {
+    AddTraceEventHelper(severity, data, nullptr);
   }
-  AddTraceEventHelper(new TraceEvent(severity, data));
+  grpc_slice_unref_internal(data);
 }
 
 void ChannelTrace::AddTraceEventWithReference(
     Severity severity, const grpc_slice& data,
     RefCountedPtr<BaseNode> referenced_entity) {
-  if (max_event_memory_ == 0) {
-    grpc_slice_unref_internal(data);
-    return;  // tracing is disabled if max_event_memory_ == 0
+  if (max_event_memory_ > 0) {
+    AddTraceEventHelper(severity, data, referenced_entity.get());
   }
-  // create and fill up the new event
-  AddTraceEventHelper(
-      new TraceEvent(severity, data, std::move(referenced_entity)));
+  grpc_slice_unref_internal(data);
 }
 
 namespace {
@@ -147,26 +133,6 @@ const char* severity_string(ChannelTrace::Severity severity) {
 
 }  // anonymous namespace
 
-Json ChannelTrace::TraceEvent::RenderTraceEvent() const {
-  char* description = grpc_slice_to_c_string(data_);
-  Json::Object object = {
-      {"description", description},
-      {"severity", severity_string(severity_)},
-      {"timestamp", gpr_format_timespec(timestamp_)},
-  };
-  gpr_free(description);
-  if (referenced_entity_ != nullptr) {
-    const bool is_channel =
-        (referenced_entity_->type() == BaseNode::EntityType::kTopLevelChannel ||
-         referenced_entity_->type() == BaseNode::EntityType::kInternalChannel);
-    object[is_channel ? "channelRef" : "subchannelRef"] = Json::Object{
-        {(is_channel ? "channelId" : "subchannelId"),
-         std::to_string(referenced_entity_->uuid())},
-    };
-  }
-  return object;
-}
-
 Json ChannelTrace::RenderJson() const {
   // Tracing is disabled if max_event_memory_ == 0.
   if (max_event_memory_ == 0) {
@@ -178,11 +144,29 @@ Json ChannelTrace::RenderJson() const {
   if (num_events_logged_ > 0) {
     object["numEventsLogged"] = std::to_string(num_events_logged_);
   }
-  // Only add in the event list if it is non-empty.
-  if (head_trace_ != nullptr) {
+  // Materialize the stored records, oldest first. Only add in the event
+  // list if it is non-empty.
+  const size_t num_stored =
+      std::min(static_cast<size_t>(num_events_logged_), num_slots_);
+  if (num_stored > 0) {
     Json::Array array;
-    for (TraceEvent* it = head_trace_; it != nullptr; it = it->next()) {
-      array.emplace_back(it->RenderTraceEvent());
+    size_t slot = num_events_logged_ > num_slots_ ? next_slot_ : 0;
+    for (size_t i = 0; i < num_stored; ++i) {
+      const EventRecord& event = events_[slot];
+      slot = (slot + 1) % num_slots_;
+      Json::Object event_json = {
+          {"description", event.description},
+          {"severity", severity_string(event.severity)},
+          {"timestamp", gpr_format_timespec(event.timestamp)},
+      };
+      if (event.referenced_uuid != 0) {
+        const bool is_channel = event.referenced_entity_is_channel;
+        event_json[is_channel ? "channelRef" : "subchannelRef"] = Json::Object{
+            {(is_channel ? "channelId" : "subchannelId"),
+             std::to_string(event.referenced_uuid)},
+        };
+      }
+      array.emplace_back(std::move(event_json));
     }
     object["events"] = std::move(array);
   }
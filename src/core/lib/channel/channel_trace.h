@@ -52,12 +52,17 @@ class ChannelTrace {
     Error
   };
 
+  // Maximum description length stored with an event; longer descriptions
+  // are truncated. Keeping descriptions inline makes event records fixed
+  // size, so the ring buffer below is a single allocation and adding an
+  // event never touches the heap.
+  static constexpr size_t kEventDescriptionSize = 64;
+
   // Adds a new trace event to the tracing object
   //
-  // NOTE: each ChannelTrace tracks the memory used by its list of trace
-  // events, so adding an event with a large amount of data could cause other
-  // trace event to be evicted. If a single trace is larger than the limit, it
-  // will cause all events to be evicted. The limit is set with the arg:
+  // NOTE: events are stored in a fixed-size ring buffer sized from the
+  // memory limit, so once it is full each new event evicts the oldest
+  // one. The limit is set with the arg:
   // GRPC_ARG_MAX_CHANNEL_TRACE_EVENT_MEMORY_PER_NODE.
   //
   // TODO(ncteisen): as this call is used more and more throughout the gRPC
@@ -70,7 +75,8 @@ class ChannelTrace {
   // channel has created a new subchannel, then it would record that with
   // a TraceEvent referencing the new subchannel.
   //
-  // NOTE: see the note in the method above.
+  // NOTE: see the note in the method above. Only the uuid and entity type
+  // of the referenced entity are recorded; no ref is retained.
   //
   // TODO(ncteisen): see the todo in the method above.
   void AddTraceEventWithReference(Severity severity, const grpc_slice& data,
@@ -83,49 +89,32 @@ class ChannelTrace {
  private:
   friend size_t testing::GetSizeofTraceEvent(void);
 
-  // Private class to encapsulate all the data and bookkeeping needed for a
-  // a trace event.
-  class TraceEvent {
-   public:
-    // Constructor for a TraceEvent that references a channel.
-    TraceEvent(Severity severity, const grpc_slice& data,
-               RefCountedPtr<BaseNode> referenced_entity_);
-
-    // Constructor for a TraceEvent that does not reverence a different
-    // channel.
-    TraceEvent(Severity severity, const grpc_slice& data);
-
-    ~TraceEvent();
-
-    // Renders the data inside of this TraceEvent into a json object. This is
-    // used by the ChannelTrace, when it is rendering itself.
-    Json RenderTraceEvent() const;
-
-    // set and get for the next_ pointer.
-    TraceEvent* next() const { return next_; }
-    void set_next(TraceEvent* next) { next_ = next; }
-
-    size_t memory_usage() const { return memory_usage_; }
-
-   private:
-    Severity severity_;
-    grpc_slice data_;
-    gpr_timespec timestamp_;
-    TraceEvent* next_;
-    // the tracer object for the (sub)channel that this trace event refers to.
-    RefCountedPtr<BaseNode> referenced_entity_;
-    size_t memory_usage_;
-  };  // TraceEvent
-
-  // Internal helper to add and link in a trace event
-  void AddTraceEventHelper(TraceEvent* new_trace_event);
+  // POD record holding all the data for a single trace event. Strings are
+  // only materialized from these records at channelz render time.
+  struct EventRecord {
+    gpr_timespec timestamp;
+    Severity severity;
+    // uuid of the channelz entity referenced by this event, or 0 if the
+    // event does not reference another entity.
+    intptr_t referenced_uuid;
+    bool referenced_entity_is_channel;
+    // NUL-terminated (truncated) copy of the event description.
+    char description[kEventDescriptionSize];
+  };  // EventRecord
+
+  // Internal helper to fill in the next ring-buffer slot.
+  void AddTraceEventHelper(Severity severity, const grpc_slice& data,
+                           BaseNode* referenced_entity);
 
   gpr_mu tracer_mu_;
   uint64_t num_events_logged_;
-  size_t event_list_memory_usage_;
   size_t max_event_memory_;
-  TraceEvent* head_trace_;
-  TraceEvent* tail_trace_;
+  // Fixed-size ring buffer of event records; next_slot_ is the index that
+  // the next event will be written to, which is also the oldest record
+  // once the ring has wrapped.
+  size_t num_slots_;
+  size_t next_slot_;
+  EventRecord* events_;
   gpr_timespec time_created_;
 };
 
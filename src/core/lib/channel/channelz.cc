@@ -189,6 +189,12 @@ Json ChannelNode::RenderJson() {
   }
   // Ask CallCountingHelper to populate call count data.
   call_counter_.PopulateCallCounts(&data);
+  // Memory attribution: cumulative arena bytes used by this channel's calls.
+  int64_t call_arena_bytes =
+      call_arena_bytes_.load(std::memory_order_relaxed);
+  if (call_arena_bytes != 0) {
+    data["callArenaBytesAllocated"] = std::to_string(call_arena_bytes);
+  }
   // Construct outer object.
   Json::Object json = {
       {"ref",
@@ -316,6 +322,12 @@ Json ServerNode::RenderJson() {
   }
   // Ask CallCountingHelper to populate call count data.
   call_counter_.PopulateCallCounts(&data);
+  // Memory attribution: cumulative arena bytes used by this server's calls.
+  int64_t call_arena_bytes =
+      call_arena_bytes_.load(std::memory_order_relaxed);
+  if (call_arena_bytes != 0) {
+    data["callArenaBytesAllocated"] = std::to_string(call_arena_bytes);
+  }
   // Construct top-level object.
   Json::Object object = {
       {"ref",
@@ -554,6 +566,28 @@ Json SocketNode::RenderJson() {
   if (keepalives_sent != 0) {
     data["keepAlivesSent"] = std::to_string(keepalives_sent);
   }
+  // Memory attribution: transport buffer footprint gauges, updated by the
+  // transport as it reads and writes.
+  int64_t write_buffer_bytes =
+      write_buffer_bytes_.load(std::memory_order_relaxed);
+  if (write_buffer_bytes != 0) {
+    data["writeBufferBytes"] = std::to_string(write_buffer_bytes);
+  }
+  int64_t read_buffer_bytes =
+      read_buffer_bytes_.load(std::memory_order_relaxed);
+  if (read_buffer_bytes != 0) {
+    data["readBufferBytes"] = std::to_string(read_buffer_bytes);
+  }
+  int64_t hpack_encoder_table_bytes =
+      hpack_encoder_table_bytes_.load(std::memory_order_relaxed);
+  if (hpack_encoder_table_bytes != 0) {
+    data["hpackEncoderTableBytes"] = std::to_string(hpack_encoder_table_bytes);
+  }
+  int64_t hpack_parser_table_bytes =
+      hpack_parser_table_bytes_.load(std::memory_order_relaxed);
+  if (hpack_parser_table_bytes != 0) {
+    data["hpackParserTableBytes"] = std::to_string(hpack_parser_table_bytes);
+  }
   // Create and fill the parent object.
   Json::Object object = {
       {"ref",
@@ -195,6 +195,11 @@ class ChannelNode : public BaseNode {
   void RecordCallStarted() { call_counter_.RecordCallStarted(); }
   void RecordCallFailed() { call_counter_.RecordCallFailed(); }
   void RecordCallSucceeded() { call_counter_.RecordCallSucceeded(); }
+  // Records the arena footprint of a finished call, so that per-channel
+  // memory usage can be attributed externally.
+  void RecordCallArenaDestroyed(size_t bytes) {
+    call_arena_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+  }
 
   void SetConnectivityState(grpc_connectivity_state state);
 
@@ -222,6 +227,9 @@ class ChannelNode : public BaseNode {
   // bits are a grpc_connectivity_state value.
   std::atomic<int> connectivity_state_{0};
 
+  // Cumulative arena bytes allocated by calls on this channel.
+  std::atomic<int64_t> call_arena_bytes_{0};
+
   Mutex child_mu_;  // Guards sets below.
   std::set<intptr_t> child_channels_;
   std::set<intptr_t> child_subchannels_;
@@ -260,10 +268,17 @@ class ServerNode : public BaseNode {
   void RecordCallStarted() { call_counter_.RecordCallStarted(); }
   void RecordCallFailed() { call_counter_.RecordCallFailed(); }
   void RecordCallSucceeded() { call_counter_.RecordCallSucceeded(); }
+  // Records the arena footprint of a finished call, so that per-server
+  // memory usage can be attributed externally.
+  void RecordCallArenaDestroyed(size_t bytes) {
+    call_arena_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+  }
 
  private:
   CallCountingHelper call_counter_;
   ChannelTrace trace_;
+  // Cumulative arena bytes allocated by calls on this server.
+  std::atomic<int64_t> call_arena_bytes_{0};
   Mutex child_mu_;  // Guards child maps below.
   std::map<intptr_t, RefCountedPtr<SocketNode>> child_sockets_;
   std::map<intptr_t, RefCountedPtr<ListenSocketNode>> child_listen_sockets_;
@@ -320,6 +335,21 @@ class SocketNode : public BaseNode {
   void RecordKeepaliveSent() {
     keepalives_sent_.fetch_add(1, std::memory_order_relaxed);
   }
+  // Updates the transport's buffer footprint gauges (write buffer, read
+  // buffer, hpack encoder/parser tables), making the memory held by a
+  // connection visible externally. Called by the transport at points where
+  // the sizes are naturally at hand, so the accounting is nearly free.
+  void UpdateBufferFootprint(int64_t write_buffer_bytes,
+                             int64_t read_buffer_bytes,
+                             int64_t hpack_encoder_table_bytes,
+                             int64_t hpack_parser_table_bytes) {
+    write_buffer_bytes_.store(write_buffer_bytes, std::memory_order_relaxed);
+    read_buffer_bytes_.store(read_buffer_bytes, std::memory_order_relaxed);
+    hpack_encoder_table_bytes_.store(hpack_encoder_table_bytes,
+                                     std::memory_order_relaxed);
+    hpack_parser_table_bytes_.store(hpack_parser_table_bytes,
+                                    std::memory_order_relaxed);
+  }
 
   const std::string& remote() { return remote_; }
 
@@ -334,6 +364,10 @@ class SocketNode : public BaseNode {
   std::atomic<gpr_cycle_counter> last_remote_stream_created_cycle_{0};
   std::atomic<gpr_cycle_counter> last_message_sent_cycle_{0};
   std::atomic<gpr_cycle_counter> last_message_received_cycle_{0};
+  std::atomic<int64_t> write_buffer_bytes_{0};
+  std::atomic<int64_t> read_buffer_bytes_{0};
+  std::atomic<int64_t> hpack_encoder_table_bytes_{0};
+  std::atomic<int64_t> hpack_parser_table_bytes_{0};
   std::string local_;
   std::string remote_;
   RefCountedPtr<Security> const security_;
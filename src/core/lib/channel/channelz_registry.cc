@@ -60,13 +60,26 @@ void ChannelzRegistry::InternalRegister(BaseNode* node) {
   MutexLock lock(&mu_);
   node->uuid_ = ++uuid_generator_;
   node_map_[node->uuid_] = node;
+  if (node->type() == BaseNode::EntityType::kTopLevelChannel) {
+    top_level_channel_map_[node->uuid_] = node;
+  } else if (node->type() == BaseNode::EntityType::kServer) {
+    server_map_[node->uuid_] = node;
+  }
 }
 
 void ChannelzRegistry::InternalUnregister(intptr_t uuid) {
   GPR_ASSERT(uuid >= 1);
   MutexLock lock(&mu_);
   GPR_ASSERT(uuid <= uuid_generator_);
-  node_map_.erase(uuid);
+  auto it = node_map_.find(uuid);
+  if (it != node_map_.end()) {
+    if (it->second->type() == BaseNode::EntityType::kTopLevelChannel) {
+      top_level_channel_map_.erase(uuid);
+    } else if (it->second->type() == BaseNode::EntityType::kServer) {
+      server_map_.erase(uuid);
+    }
+    node_map_.erase(it);
+  }
 }
 
 RefCountedPtr<BaseNode> ChannelzRegistry::InternalGet(intptr_t uuid) {
@@ -88,12 +101,11 @@ std::string ChannelzRegistry::InternalGetTopChannels(
   RefCountedPtr<BaseNode> node_after_pagination_limit;
   {
     MutexLock lock(&mu_);
-    for (auto it = node_map_.lower_bound(start_channel_id);
-         it != node_map_.end(); ++it) {
+    for (auto it = top_level_channel_map_.lower_bound(start_channel_id);
+         it != top_level_channel_map_.end(); ++it) {
       BaseNode* node = it->second;
       RefCountedPtr<BaseNode> node_ref;
-      if (node->type() == BaseNode::EntityType::kTopLevelChannel &&
-          (node_ref = node->RefIfNonZero()) != nullptr) {
+      if ((node_ref = node->RefIfNonZero()) != nullptr) {
         // Check if we are over pagination limit to determine if we need to set
         // the "end" element. If we don't go through this block, we know that
         // when the loop terminates, we have <= to kPaginationLimit.
@@ -127,12 +139,11 @@ std::string ChannelzRegistry::InternalGetServers(intptr_t start_server_id) {
   RefCountedPtr<BaseNode> node_after_pagination_limit;
   {
     MutexLock lock(&mu_);
-    for (auto it = node_map_.lower_bound(start_server_id);
-         it != node_map_.end(); ++it) {
+    for (auto it = server_map_.lower_bound(start_server_id);
+         it != server_map_.end(); ++it) {
       BaseNode* node = it->second;
       RefCountedPtr<BaseNode> node_ref;
-      if (node->type() == BaseNode::EntityType::kServer &&
-          (node_ref = node->RefIfNonZero()) != nullptr) {
+      if ((node_ref = node->RefIfNonZero()) != nullptr) {
         // Check if we are over pagination limit to determine if we need to set
         // the "end" element. If we don't go through this block, we know that
         // when the loop terminates, we have <= to kPaginationLimit.
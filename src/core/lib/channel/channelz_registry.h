@@ -90,6 +90,11 @@ class ChannelzRegistry {
   // protects members
   Mutex mu_;
   std::map<intptr_t, BaseNode*> node_map_;
+  // Secondary indexes for the paginated queries, so that a scrape of a
+  // small number of servers does not scan every subchannel and socket
+  // while holding mu_.
+  std::map<intptr_t, BaseNode*> top_level_channel_map_;
+  std::map<intptr_t, BaseNode*> server_map_;
   intptr_t uuid_generator_ = 0;
 };
 
@@ -35,6 +35,11 @@ typedef enum {
   /// Value is a CallTracer object.
   GRPC_CONTEXT_CALL_TRACER,
 
+  /// Value is a CallTracer::CallAttemptTracer object for the current call
+  /// attempt, published by the client channel for use by layers below it
+  /// (e.g. the transport's write timestamp reporting).
+  GRPC_CONTEXT_CALL_ATTEMPT_TRACER,
+
   /// Reserved for traffic_class_context.
   GRPC_CONTEXT_TRAFFIC,
 
@@ -27,17 +27,19 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/gpr/spinlock.h"
 #include "src/core/lib/slice/slice_internal.h"
 
 #define OUTPUT_BLOCK_SIZE 1024
 
 static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
                      grpc_slice_buffer* output,
-                     int (*flate)(z_stream* zs, int flush)) {
+                     int (*flate)(z_stream* zs, int flush),
+                     size_t first_block_size) {
   int r = Z_STREAM_END; /* Do not fail on an empty input. */
   int flush;
   size_t i;
-  grpc_slice outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(first_block_size);
   const uInt uint_max = ~static_cast<uInt>(0);
 
   GPR_ASSERT(GRPC_SLICE_LENGTH(outbuf) <= uint_max);
@@ -52,6 +54,8 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
     do {
       if (zs->avail_out == 0) {
         grpc_slice_buffer_add_indexed(output, outbuf);
+        /* Overflow blocks are fixed size: first_block_size is only a hint
+           for how big the whole output is expected to be. */
         outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
         GPR_ASSERT(GRPC_SLICE_LENGTH(outbuf) <= uint_max);
         zs->avail_out = static_cast<uInt> GRPC_SLICE_LENGTH(outbuf);
@@ -62,7 +66,9 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
         gpr_log(GPR_INFO, "zlib error (%d)", r);
         goto error;
       }
-    } while (zs->avail_out == 0);
+      /* Stop on Z_STREAM_END even with avail_out == 0, so a stream that
+         exactly fills the block does not allocate an empty extra one. */
+    } while (zs->avail_out == 0 && r != Z_STREAM_END);
     if (zs->avail_in) {
       gpr_log(GPR_INFO, "zlib: not all input consumed");
       goto error;
@@ -91,20 +97,72 @@ static void* zalloc_gpr(void* /*opaque*/, unsigned int items,
 
 static void zfree_gpr(void* /*opaque*/, void* address) { gpr_free(address); }
 
+/* Initializing a zlib context is expensive relative to (de)compressing a
+   typical message: deflateInit2 alone allocates several hundred KB of
+   internal state. Keep a small global pool of initialized contexts per
+   (direction, format) pair and recycle them with deflateReset/inflateReset
+   instead of tearing them down after every message. The pools are accessed
+   with trylock only, so contention degrades to the old init-per-message
+   behavior rather than blocking. */
+#define ZLIB_CONTEXT_POOL_SIZE 8
+
+typedef struct zlib_context_pool {
+  gpr_spinlock lock;
+  size_t count;
+  z_stream* streams[ZLIB_CONTEXT_POOL_SIZE];
+} zlib_context_pool;
+
+/* Indexed by the gzip flag: contexts initialized for raw deflate and for
+   gzip framing are not interchangeable. */
+static zlib_context_pool g_compress_pools[2] = {
+    {GPR_SPINLOCK_STATIC_INITIALIZER, 0, {}},
+    {GPR_SPINLOCK_STATIC_INITIALIZER, 0, {}}};
+static zlib_context_pool g_decompress_pools[2] = {
+    {GPR_SPINLOCK_STATIC_INITIALIZER, 0, {}},
+    {GPR_SPINLOCK_STATIC_INITIALIZER, 0, {}}};
+
+static z_stream* zlib_context_acquire(zlib_context_pool* pool) {
+  z_stream* zs = nullptr;
+  if (gpr_spinlock_trylock(&pool->lock)) {
+    if (pool->count > 0) {
+      zs = pool->streams[--pool->count];
+    }
+    gpr_spinlock_unlock(&pool->lock);
+  }
+  return zs;
+}
+
+/* Returns true if the context was pooled; the caller owns it otherwise. */
+static bool zlib_context_release(zlib_context_pool* pool, z_stream* zs) {
+  bool pooled = false;
+  if (gpr_spinlock_trylock(&pool->lock)) {
+    if (pool->count < ZLIB_CONTEXT_POOL_SIZE) {
+      pool->streams[pool->count++] = zs;
+      pooled = true;
+    }
+    gpr_spinlock_unlock(&pool->lock);
+  }
+  return pooled;
+}
+
 static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
                          int gzip) {
-  z_stream zs;
+  zlib_context_pool* pool = &g_compress_pools[gzip ? 1 : 0];
+  z_stream* zs = zlib_context_acquire(pool);
   int r;
   size_t i;
   size_t count_before = output->count;
   size_t length_before = output->length;
-  memset(&zs, 0, sizeof(zs));
-  zs.zalloc = zalloc_gpr;
-  zs.zfree = zfree_gpr;
-  r = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | (gzip ? 16 : 0),
-                   8, Z_DEFAULT_STRATEGY);
-  GPR_ASSERT(r == Z_OK);
-  r = zlib_body(&zs, input, output, deflate) && output->length < input->length;
+  if (zs == nullptr) {
+    zs = static_cast<z_stream*>(gpr_zalloc(sizeof(*zs)));
+    zs->zalloc = zalloc_gpr;
+    zs->zfree = zfree_gpr;
+    r = deflateInit2(zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                     15 | (gzip ? 16 : 0), 8, Z_DEFAULT_STRATEGY);
+    GPR_ASSERT(r == Z_OK);
+  }
+  r = zlib_body(zs, input, output, deflate, OUTPUT_BLOCK_SIZE) &&
+      output->length < input->length;
   if (!r) {
     for (i = count_before; i < output->count; i++) {
       grpc_slice_unref_internal(output->slices[i]);
@@ -112,23 +170,73 @@ static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
     output->count = count_before;
     output->length = length_before;
   }
-  deflateEnd(&zs);
+  /* deflateReset is valid from any post-init state, including after an
+     error from deflate, and preserves the parameters from deflateInit2. */
+  if (deflateReset(zs) != Z_OK || !zlib_context_release(pool, zs)) {
+    deflateEnd(zs);
+    gpr_free(zs);
+  }
   return r;
 }
 
+/* The maximum uncompressed-size hint we act on. The gzip ISIZE field is
+   advisory (it records the length mod 2^32 and a peer can set it to
+   anything), so cap the up-front allocation; if a hint undershoots, the
+   body simply falls back to appending OUTPUT_BLOCK_SIZE chunks. */
+#define MAX_UNCOMPRESSED_SIZE_HINT (16 * 1024 * 1024)
+
+/* Reads the little-endian ISIZE field from the last four bytes of a gzip
+   stream, which records the uncompressed length mod 2^32. Returns 0 if the
+   input is too short to carry a gzip trailer. */
+static size_t gzip_uncompressed_size_hint(grpc_slice_buffer* input) {
+  uint8_t trailer[4];
+  size_t n = 0;
+  size_t i;
+  if (input->length < 18) return 0; /* shorter than any valid gzip stream */
+  /* walk backwards to collect the last four bytes; they may span slices */
+  for (i = input->count; i > 0 && n < 4; i--) {
+    const grpc_slice* slice = &input->slices[i - 1];
+    size_t len = GRPC_SLICE_LENGTH(*slice);
+    while (len > 0 && n < 4) {
+      trailer[3 - n] = GRPC_SLICE_START_PTR(*slice)[len - 1];
+      n++;
+      len--;
+    }
+  }
+  return (static_cast<size_t>(trailer[0])) |
+         (static_cast<size_t>(trailer[1]) << 8) |
+         (static_cast<size_t>(trailer[2]) << 16) |
+         (static_cast<size_t>(trailer[3]) << 24);
+}
+
 static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
                            int gzip) {
-  z_stream zs;
+  zlib_context_pool* pool = &g_decompress_pools[gzip ? 1 : 0];
+  z_stream* zs = zlib_context_acquire(pool);
   int r;
   size_t i;
   size_t count_before = output->count;
   size_t length_before = output->length;
-  memset(&zs, 0, sizeof(zs));
-  zs.zalloc = zalloc_gpr;
-  zs.zfree = zfree_gpr;
-  r = inflateInit2(&zs, 15 | (gzip ? 16 : 0));
-  GPR_ASSERT(r == Z_OK);
-  r = zlib_body(&zs, input, output, inflate);
+  size_t first_block_size = OUTPUT_BLOCK_SIZE;
+  if (gzip) {
+    /* Size the first output block from the trailer's length hint so that a
+       well-formed stream inflates into a single exactly-sized slice rather
+       than a chain of fixed-size blocks. Hints small enough to fit in an
+       inlined slice are ignored: zlib_body requires a refcounted block. */
+    size_t size_hint = gzip_uncompressed_size_hint(input);
+    if (size_hint > GRPC_SLICE_INLINED_SIZE &&
+        size_hint <= MAX_UNCOMPRESSED_SIZE_HINT) {
+      first_block_size = size_hint;
+    }
+  }
+  if (zs == nullptr) {
+    zs = static_cast<z_stream*>(gpr_zalloc(sizeof(*zs)));
+    zs->zalloc = zalloc_gpr;
+    zs->zfree = zfree_gpr;
+    r = inflateInit2(zs, 15 | (gzip ? 16 : 0));
+    GPR_ASSERT(r == Z_OK);
+  }
+  r = zlib_body(zs, input, output, inflate, first_block_size);
   if (!r) {
     for (i = count_before; i < output->count; i++) {
       grpc_slice_unref_internal(output->slices[i]);
@@ -136,7 +244,10 @@ static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
     output->count = count_before;
     output->length = length_before;
   }
-  inflateEnd(&zs);
+  if (inflateReset(zs) != Z_OK || !zlib_context_release(pool, zs)) {
+    inflateEnd(zs);
+    gpr_free(zs);
+  }
   return r;
 }
 
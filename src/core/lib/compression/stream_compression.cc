@@ -59,6 +59,25 @@ grpc_stream_compression_context* grpc_stream_compression_context_create(
   }
 }
 
+grpc_stream_compression_context*
+grpc_stream_compression_context_create_with_dictionary(
+    grpc_stream_compression_method method, const grpc_slice* dictionary) {
+  switch (method) {
+    case GRPC_STREAM_COMPRESSION_IDENTITY_COMPRESS:
+    case GRPC_STREAM_COMPRESSION_IDENTITY_DECOMPRESS:
+      /* Identity passes bytes through untouched; a dictionary is
+         meaningless. */
+      return grpc_stream_compression_identity_vtable.context_create(method);
+    case GRPC_STREAM_COMPRESSION_GZIP_COMPRESS:
+    case GRPC_STREAM_COMPRESSION_GZIP_DECOMPRESS:
+      return grpc_stream_compression_context_create_gzip_with_dictionary(
+          method, dictionary);
+    default:
+      gpr_log(GPR_ERROR, "Unknown stream compression method: %d", method);
+      return nullptr;
+  }
+}
+
 void grpc_stream_compression_context_destroy(
     grpc_stream_compression_context* ctx) {
   ctx->vtable->context_destroy(ctx);
@@ -102,6 +102,20 @@ bool grpc_stream_decompress(grpc_stream_compression_context* ctx,
 grpc_stream_compression_context* grpc_stream_compression_context_create(
     grpc_stream_compression_method method);
 
+/**
+ * Like grpc_stream_compression_context_create(), but pre-seeds the context
+ * with \a dictionary so that early bytes compress against known content.
+ * Because gzip framing cannot express preset dictionaries, a seeded gzip
+ * context uses raw deflate framing instead: the compressing and
+ * decompressing peers must be created with identical dictionary bytes. A
+ * null or empty \a dictionary behaves exactly like
+ * grpc_stream_compression_context_create(). Does not take ownership of
+ * \a dictionary.
+ */
+grpc_stream_compression_context*
+grpc_stream_compression_context_create_with_dictionary(
+    grpc_stream_compression_method method, const grpc_slice* dictionary);
+
 /**
  * Destroys a stream compression context.
  */
@@ -181,9 +181,9 @@ static bool grpc_stream_decompress_gzip(grpc_stream_compression_context* ctx,
                     Z_SYNC_FLUSH, end_of_context);
 }
 
-static grpc_stream_compression_context*
-grpc_stream_compression_context_create_gzip(
-    grpc_stream_compression_method method) {
+grpc_stream_compression_context*
+grpc_stream_compression_context_create_gzip_with_dictionary(
+    grpc_stream_compression_method method, const grpc_slice* dictionary) {
   GPR_ASSERT(method == GRPC_STREAM_COMPRESSION_GZIP_COMPRESS ||
              method == GRPC_STREAM_COMPRESSION_GZIP_DECOMPRESS);
   grpc_stream_compression_context_gzip* gzip_ctx =
@@ -193,13 +193,31 @@ grpc_stream_compression_context_create_gzip(
   if (gzip_ctx == nullptr) {
     return nullptr;
   }
+  const bool has_dictionary =
+      dictionary != nullptr && GRPC_SLICE_LENGTH(*dictionary) > 0;
+  /* Preset dictionaries cannot be expressed in gzip framing, so a seeded
+     context uses raw deflate framing; the peer must be seeded with the
+     same bytes. */
+  const int window_bits = has_dictionary ? -15 : 0x1F;
   if (method == GRPC_STREAM_COMPRESSION_GZIP_DECOMPRESS) {
-    r = inflateInit2(&gzip_ctx->zs, 0x1F);
+    r = inflateInit2(&gzip_ctx->zs, window_bits);
     gzip_ctx->flate = inflate;
+    if (r == Z_OK && has_dictionary) {
+      r = inflateSetDictionary(
+          &gzip_ctx->zs, GRPC_SLICE_START_PTR(*dictionary),
+          static_cast<uInt>(GRPC_SLICE_LENGTH(*dictionary)));
+      if (r != Z_OK) inflateEnd(&gzip_ctx->zs);
+    }
   } else {
-    r = deflateInit2(&gzip_ctx->zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 0x1F, 8,
-                     Z_DEFAULT_STRATEGY);
+    r = deflateInit2(&gzip_ctx->zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                     window_bits, 8, Z_DEFAULT_STRATEGY);
     gzip_ctx->flate = deflate;
+    if (r == Z_OK && has_dictionary) {
+      r = deflateSetDictionary(
+          &gzip_ctx->zs, GRPC_SLICE_START_PTR(*dictionary),
+          static_cast<uInt>(GRPC_SLICE_LENGTH(*dictionary)));
+      if (r != Z_OK) deflateEnd(&gzip_ctx->zs);
+    }
   }
   if (r != Z_OK) {
     gpr_free(gzip_ctx);
@@ -210,6 +228,13 @@ grpc_stream_compression_context_create_gzip(
   return reinterpret_cast<grpc_stream_compression_context*>(gzip_ctx);
 }
 
+static grpc_stream_compression_context*
+grpc_stream_compression_context_create_gzip(
+    grpc_stream_compression_method method) {
+  return grpc_stream_compression_context_create_gzip_with_dictionary(method,
+                                                                     nullptr);
+}
+
 static void grpc_stream_compression_context_destroy_gzip(
     grpc_stream_compression_context* ctx) {
   if (ctx == nullptr) {
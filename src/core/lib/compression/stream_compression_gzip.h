@@ -25,4 +25,10 @@
 
 extern const grpc_stream_compression_vtable grpc_stream_compression_gzip_vtable;
 
+/* Creates a gzip stream compression context seeded with \a dictionary; see
+   grpc_stream_compression_context_create_with_dictionary(). */
+grpc_stream_compression_context*
+grpc_stream_compression_context_create_gzip_with_dictionary(
+    grpc_stream_compression_method method, const grpc_slice* dictionary);
+
 #endif  // GRPC_CORE_LIB_COMPRESSION_STREAM_COMPRESSION_GZIP_H
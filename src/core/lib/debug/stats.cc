@@ -32,29 +32,59 @@
 #include <grpc/support/string_util.h>
 
 #include "src/core/lib/gpr/string.h"
+#include "src/core/lib/gpr/tls.h"
 #include "src/core/lib/gpr/useful.h"
 
-grpc_stats_data* grpc_stats_per_cpu_storage = nullptr;
-static size_t g_num_cores;
+/* Stats are sharded per thread: each thread lazily allocates a shard that
+   only it writes to, and shards are linked into a global list that
+   grpc_stats_collect walks. Shards are never freed: a thread that outlives
+   a grpc_init/grpc_shutdown cycle keeps a valid pointer, and the next
+   grpc_stats_init just zeroes whatever shards already exist. */
+typedef struct grpc_stats_shard {
+  grpc_stats_data data;
+  struct grpc_stats_shard* next;
+} grpc_stats_shard;
+
+static gpr_atm g_shard_list_head; /* grpc_stats_shard* */
+static GPR_THREAD_LOCAL(grpc_stats_shard*) g_thread_shard;
+
+grpc_stats_data* grpc_stats_shard_for_thread(void) {
+  grpc_stats_shard* shard = g_thread_shard;
+  if (GPR_UNLIKELY(shard == nullptr)) {
+    shard = static_cast<grpc_stats_shard*>(gpr_zalloc(sizeof(*shard)));
+    gpr_atm old;
+    do {
+      old = gpr_atm_acq_load(&g_shard_list_head);
+      shard->next = reinterpret_cast<grpc_stats_shard*>(old);
+    } while (!gpr_atm_rel_cas(&g_shard_list_head, old,
+                              reinterpret_cast<gpr_atm>(shard)));
+    g_thread_shard = shard;
+  }
+  return &shard->data;
+}
 
 void grpc_stats_init(void) {
-  g_num_cores = std::max(1u, gpr_cpu_num_cores());
-  grpc_stats_per_cpu_storage = static_cast<grpc_stats_data*>(
-      gpr_zalloc(sizeof(grpc_stats_data) * g_num_cores));
+  for (grpc_stats_shard* shard = reinterpret_cast<grpc_stats_shard*>(
+           gpr_atm_acq_load(&g_shard_list_head));
+       shard != nullptr; shard = shard->next) {
+    memset(&shard->data, 0, sizeof(shard->data));
+  }
 }
 
-void grpc_stats_shutdown(void) { gpr_free(grpc_stats_per_cpu_storage); }
+void grpc_stats_shutdown(void) {}
 
 void grpc_stats_collect(grpc_stats_data* output) {
   memset(output, 0, sizeof(*output));
-  for (size_t core = 0; core < g_num_cores; core++) {
+  for (grpc_stats_shard* shard = reinterpret_cast<grpc_stats_shard*>(
+           gpr_atm_acq_load(&g_shard_list_head));
+       shard != nullptr; shard = shard->next) {
     for (size_t i = 0; i < GRPC_STATS_COUNTER_COUNT; i++) {
-      output->counters[i] += gpr_atm_no_barrier_load(
-          &grpc_stats_per_cpu_storage[core].counters[i]);
+      output->counters[i] +=
+          gpr_atm_no_barrier_load(&shard->data.counters[i]);
     }
     for (size_t i = 0; i < GRPC_STATS_HISTOGRAM_BUCKETS; i++) {
-      output->histograms[i] += gpr_atm_no_barrier_load(
-          &grpc_stats_per_cpu_storage[core].histograms[i]);
+      output->histograms[i] +=
+          gpr_atm_no_barrier_load(&shard->data.histograms[i]);
     }
   }
 }
@@ -33,21 +33,29 @@ typedef struct grpc_stats_data {
   gpr_atm histograms[GRPC_STATS_HISTOGRAM_BUCKETS];
 } grpc_stats_data;
 
-extern grpc_stats_data* grpc_stats_per_cpu_storage;
+/* Returns this thread's stats shard, allocating and registering it on first
+   use. Each shard has exactly one writer (its owning thread), so increments
+   are plain load/store pairs rather than atomic RMWs; grpc_stats_collect
+   sums the shards lazily. */
+grpc_stats_data* grpc_stats_shard_for_thread(void);
 
-#define GRPC_THREAD_STATS_DATA() \
-  (&grpc_stats_per_cpu_storage[grpc_core::ExecCtx::Get()->starting_cpu()])
+#define GRPC_THREAD_STATS_DATA() grpc_stats_shard_for_thread()
 
 /* Only collect stats if GRPC_COLLECT_STATS is defined or it is a debug build.
  */
 #if defined(GRPC_COLLECT_STATS) || !defined(NDEBUG)
-#define GRPC_STATS_INC_COUNTER(ctr) \
-  (gpr_atm_no_barrier_fetch_add(&GRPC_THREAD_STATS_DATA()->counters[(ctr)], 1))
+#define GRPC_STATS_INC_COUNTER(ctr)                                  \
+  do {                                                               \
+    gpr_atm* cell = &GRPC_THREAD_STATS_DATA()->counters[(ctr)];      \
+    gpr_atm_no_barrier_store(cell, gpr_atm_no_barrier_load(cell) + 1); \
+  } while (0)
 
-#define GRPC_STATS_INC_HISTOGRAM(histogram, index)                             \
-  (gpr_atm_no_barrier_fetch_add(                                               \
-      &GRPC_THREAD_STATS_DATA()->histograms[histogram##_FIRST_SLOT + (index)], \
-      1))
+#define GRPC_STATS_INC_HISTOGRAM(histogram, index)                 \
+  do {                                                             \
+    gpr_atm* cell = &GRPC_THREAD_STATS_DATA()                      \
+                         ->histograms[histogram##_FIRST_SLOT + (index)]; \
+    gpr_atm_no_barrier_store(cell, gpr_atm_no_barrier_load(cell) + 1); \
+  } while (0)
 #else /* defined(GRPC_COLLECT_STATS) || !defined(NDEBUG) */
 #define GRPC_STATS_INC_COUNTER(ctr)
 #define GRPC_STATS_INC_HISTOGRAM(histogram, index)
@@ -125,6 +125,9 @@ const char* grpc_stats_counter_name[GRPC_STATS_COUNTER_COUNT] = {
     "cq_ev_queue_trylock_failures",
     "cq_ev_queue_trylock_successes",
     "cq_ev_queue_transient_pop_failures",
+    "http2_transport_window_stalls",
+    "http2_stream_window_stalls",
+    "tcp_backpressure_writes",
 };
 const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "Number of client side calls created by this process",
@@ -252,6 +255,12 @@ const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "queue.",
     "Number of times NULL was popped out of completion queue's event queue "
     "even though the event queue was not empty",
+    "Number of times a stream was parked because the peer's connection-level "
+    "flow control window was exhausted",
+    "Number of times a stream was parked because the peer's stream-level flow "
+    "control window was exhausted",
+    "Number of TCP writes that stopped early because the kernel could not "
+    "accept more data (EAGAIN or the TCP_NOTSENT_LOWAT mark)",
 };
 const char* grpc_stats_histogram_name[GRPC_STATS_HISTOGRAM_COUNT] = {
     "call_initial_size",
@@ -267,6 +276,13 @@ const char* grpc_stats_histogram_name[GRPC_STATS_HISTOGRAM_COUNT] = {
     "http2_send_trailing_metadata_per_write",
     "http2_send_flowctl_per_write",
     "server_cqs_checked",
+    "call_pick_us",
+    "call_first_send_us",
+    "call_first_recv_msg_us",
+    "call_completion_us",
+    "http2_transport_window_stall_ms",
+    "http2_stream_window_stall_ms",
+    "tcp_backpressure_stall_ms",
 };
 const char* grpc_stats_histogram_doc[GRPC_STATS_HISTOGRAM_COUNT] = {
     "Initial size of the grpc_call arena created at call start",
@@ -284,6 +300,19 @@ const char* grpc_stats_histogram_doc[GRPC_STATS_HISTOGRAM_COUNT] = {
     // NOLINTNEXTLINE(bugprone-suspicious-missing-comma)
     "How many completion queues were checked looking for a CQ that had "
     "requested the incoming call",
+    "Microseconds from client call start until the load balancing pick "
+    "completed (sampled)",
+    "Microseconds from call creation until the first batch carrying initial "
+    "metadata was passed down the filter stack (sampled)",
+    "Microseconds from call creation until the first message was surfaced by a "
+    "receive operation (sampled)",
+    "Microseconds from call creation until the call was destroyed (sampled)",
+    "Milliseconds streams spent parked on the connection-level flow control "
+    "stalled list",
+    "Milliseconds streams spent parked on the stream-level flow control "
+    "stalled list",
+    "Milliseconds from a TCP write stopping on socket backpressure until the "
+    "poller reported the socket writable again",
 };
 const int grpc_stats_table_0[65] = {
     0,      1,      2,      3,      4,     5,     7,     9,     11,    14,
@@ -352,6 +381,22 @@ const uint8_t grpc_stats_table_7[102] = {
     42, 42, 43, 44, 44, 45, 46, 46, 47, 48, 48, 49, 49, 50, 50, 51, 51};
 const int grpc_stats_table_8[9] = {0, 1, 2, 4, 7, 13, 23, 39, 64};
 const uint8_t grpc_stats_table_9[9] = {0, 0, 1, 2, 2, 3, 4, 4, 5};
+const int grpc_stats_table_10[65] = {
+    0,       1,       2,       3,       4,       6,       8,       11,
+    14,      18,      23,      30,      39,      50,      64,      82,
+    105,     134,     171,     218,     277,     352,     447,     568,
+    721,     916,     1163,    1477,    1875,    2380,    3021,    3835,
+    4868,    6179,    7843,    9955,    12635,   16036,   20353,   25832,
+    32785,   41610,   52810,   67024,   85064,   107959,  137017,  173895,
+    220699,  280100,  355489,  451169,  572601,  726716,  922311,  1170550,
+    1485602, 1885449, 2392914, 3036962, 3854353, 4891743, 6208344, 7879305,
+    10000000};
+const uint8_t grpc_stats_table_11[83] = {
+    0,  0,  1,  1,  2,  3,  3,  4,  5,  6,  6,  7,  8,  8,  9,  9,  10,
+    11, 12, 12, 13, 14, 15, 15, 16, 17, 18, 18, 19, 20, 20, 21, 22, 23,
+    23, 24, 25, 26, 26, 27, 28, 28, 29, 30, 31, 31, 32, 33, 34, 34, 35,
+    35, 36, 37, 38, 38, 39, 40, 41, 41, 42, 43, 44, 44, 45, 46, 47, 47,
+    48, 49, 49, 50, 51, 52, 52, 53, 54, 55, 55, 56, 57, 58, 58};
 void grpc_stats_inc_call_initial_size(int value) {
   value = grpc_core::Clamp(value, 0, 262144);
   if (value < 6) {
@@ -663,17 +708,190 @@ void grpc_stats_inc_server_cqs_checked(int value) {
       GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED,
       grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_8, 8));
 }
-const int grpc_stats_histo_buckets[13] = {64, 128, 64, 64, 64, 64, 64,
-                                          64, 64,  64, 64, 64, 8};
-const int grpc_stats_histo_start[13] = {0,   64,  192, 256, 320, 384, 448,
-                                        512, 576, 640, 704, 768, 832};
-const int* const grpc_stats_histo_bucket_boundaries[13] = {
-    grpc_stats_table_0, grpc_stats_table_2, grpc_stats_table_4,
-    grpc_stats_table_6, grpc_stats_table_4, grpc_stats_table_4,
-    grpc_stats_table_6, grpc_stats_table_4, grpc_stats_table_6,
-    grpc_stats_table_6, grpc_stats_table_6, grpc_stats_table_6,
-    grpc_stats_table_8};
-void (*const grpc_stats_inc_histogram[13])(int x) = {
+void grpc_stats_inc_call_pick_us(int value) {
+  value = grpc_core::Clamp(value, 0, 10000000);
+  if (value < 5) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_CALL_PICK_US, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4682617712558473216ull) {
+    int bucket =
+        grpc_stats_table_11[((_val.uint - 4617315517961601024ull) >> 50)] + 5;
+    _bkt.dbl = grpc_stats_table_10[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_CALL_PICK_US, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_CALL_PICK_US,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_10, 64));
+}
+void grpc_stats_inc_call_first_send_us(int value) {
+  value = grpc_core::Clamp(value, 0, 10000000);
+  if (value < 5) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_CALL_FIRST_SEND_US, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4682617712558473216ull) {
+    int bucket =
+        grpc_stats_table_11[((_val.uint - 4617315517961601024ull) >> 50)] + 5;
+    _bkt.dbl = grpc_stats_table_10[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_CALL_FIRST_SEND_US, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_CALL_FIRST_SEND_US,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_10, 64));
+}
+void grpc_stats_inc_call_first_recv_msg_us(int value) {
+  value = grpc_core::Clamp(value, 0, 10000000);
+  if (value < 5) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_CALL_FIRST_RECV_MSG_US,
+                             value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4682617712558473216ull) {
+    int bucket =
+        grpc_stats_table_11[((_val.uint - 4617315517961601024ull) >> 50)] + 5;
+    _bkt.dbl = grpc_stats_table_10[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_CALL_FIRST_RECV_MSG_US,
+                             bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_CALL_FIRST_RECV_MSG_US,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_10, 64));
+}
+void grpc_stats_inc_call_completion_us(int value) {
+  value = grpc_core::Clamp(value, 0, 10000000);
+  if (value < 5) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_CALL_COMPLETION_US, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4682617712558473216ull) {
+    int bucket =
+        grpc_stats_table_11[((_val.uint - 4617315517961601024ull) >> 50)] + 5;
+    _bkt.dbl = grpc_stats_table_10[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_CALL_COMPLETION_US, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_CALL_COMPLETION_US,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_10, 64));
+}
+void grpc_stats_inc_http2_transport_window_stall_ms(int value) {
+  value = grpc_core::Clamp(value, 0, 10000000);
+  if (value < 5) {
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_HTTP2_TRANSPORT_WINDOW_STALL_MS, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4682617712558473216ull) {
+    int bucket =
+        grpc_stats_table_11[((_val.uint - 4617315517961601024ull) >> 50)] + 5;
+    _bkt.dbl = grpc_stats_table_10[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_HTTP2_TRANSPORT_WINDOW_STALL_MS, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_HTTP2_TRANSPORT_WINDOW_STALL_MS,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_10, 64));
+}
+void grpc_stats_inc_http2_stream_window_stall_ms(int value) {
+  value = grpc_core::Clamp(value, 0, 10000000);
+  if (value < 5) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_HTTP2_STREAM_WINDOW_STALL_MS,
+                             value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4682617712558473216ull) {
+    int bucket =
+        grpc_stats_table_11[((_val.uint - 4617315517961601024ull) >> 50)] + 5;
+    _bkt.dbl = grpc_stats_table_10[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_HTTP2_STREAM_WINDOW_STALL_MS,
+                             bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_HTTP2_STREAM_WINDOW_STALL_MS,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_10, 64));
+}
+void grpc_stats_inc_tcp_backpressure_stall_ms(int value) {
+  value = grpc_core::Clamp(value, 0, 10000000);
+  if (value < 5) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_TCP_BACKPRESSURE_STALL_MS,
+                             value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4682617712558473216ull) {
+    int bucket =
+        grpc_stats_table_11[((_val.uint - 4617315517961601024ull) >> 50)] + 5;
+    _bkt.dbl = grpc_stats_table_10[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_TCP_BACKPRESSURE_STALL_MS,
+                             bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_TCP_BACKPRESSURE_STALL_MS,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_10, 64));
+}
+const int grpc_stats_histo_buckets[20] = {64, 128, 64, 64, 64, 64, 64,
+                                          64, 64,  64, 64, 64, 8,  64,
+                                          64, 64,  64, 64, 64, 64};
+const int grpc_stats_histo_start[20] = {
+    0,   64,  192, 256, 320, 384,  448,  512,  576,  640,
+    704, 768, 832, 840, 904, 968,  1032, 1096, 1160, 1224};
+const int* const grpc_stats_histo_bucket_boundaries[20] = {
+    grpc_stats_table_0,  grpc_stats_table_2,  grpc_stats_table_4,
+    grpc_stats_table_6,  grpc_stats_table_4,  grpc_stats_table_4,
+    grpc_stats_table_6,  grpc_stats_table_4,  grpc_stats_table_6,
+    grpc_stats_table_6,  grpc_stats_table_6,  grpc_stats_table_6,
+    grpc_stats_table_8,  grpc_stats_table_10, grpc_stats_table_10,
+    grpc_stats_table_10, grpc_stats_table_10, grpc_stats_table_10,
+    grpc_stats_table_10, grpc_stats_table_10};
+void (*const grpc_stats_inc_histogram[20])(int x) = {
     grpc_stats_inc_call_initial_size,
     grpc_stats_inc_poll_events_returned,
     grpc_stats_inc_tcp_write_size,
@@ -686,4 +904,11 @@ void (*const grpc_stats_inc_histogram[13])(int x) = {
     grpc_stats_inc_http2_send_message_per_write,
     grpc_stats_inc_http2_send_trailing_metadata_per_write,
     grpc_stats_inc_http2_send_flowctl_per_write,
-    grpc_stats_inc_server_cqs_checked};
+    grpc_stats_inc_server_cqs_checked,
+    grpc_stats_inc_call_pick_us,
+    grpc_stats_inc_call_first_send_us,
+    grpc_stats_inc_call_first_recv_msg_us,
+    grpc_stats_inc_call_completion_us,
+    grpc_stats_inc_http2_transport_window_stall_ms,
+    grpc_stats_inc_http2_stream_window_stall_ms,
+    grpc_stats_inc_tcp_backpressure_stall_ms};
@@ -126,6 +126,9 @@ typedef enum {
   GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRYLOCK_FAILURES,
   GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRYLOCK_SUCCESSES,
   GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRANSIENT_POP_FAILURES,
+  GRPC_STATS_COUNTER_HTTP2_TRANSPORT_WINDOW_STALLS,
+  GRPC_STATS_COUNTER_HTTP2_STREAM_WINDOW_STALLS,
+  GRPC_STATS_COUNTER_TCP_BACKPRESSURE_WRITES,
   GRPC_STATS_COUNTER_COUNT
 } grpc_stats_counters;
 extern const char* grpc_stats_counter_name[GRPC_STATS_COUNTER_COUNT];
@@ -144,6 +147,13 @@ typedef enum {
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_TRAILING_METADATA_PER_WRITE,
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_FLOWCTL_PER_WRITE,
   GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED,
+  GRPC_STATS_HISTOGRAM_CALL_PICK_US,
+  GRPC_STATS_HISTOGRAM_CALL_FIRST_SEND_US,
+  GRPC_STATS_HISTOGRAM_CALL_FIRST_RECV_MSG_US,
+  GRPC_STATS_HISTOGRAM_CALL_COMPLETION_US,
+  GRPC_STATS_HISTOGRAM_HTTP2_TRANSPORT_WINDOW_STALL_MS,
+  GRPC_STATS_HISTOGRAM_HTTP2_STREAM_WINDOW_STALL_MS,
+  GRPC_STATS_HISTOGRAM_TCP_BACKPRESSURE_STALL_MS,
   GRPC_STATS_HISTOGRAM_COUNT
 } grpc_stats_histograms;
 extern const char* grpc_stats_histogram_name[GRPC_STATS_HISTOGRAM_COUNT];
@@ -175,7 +185,21 @@ typedef enum {
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_FLOWCTL_PER_WRITE_BUCKETS = 64,
   GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED_FIRST_SLOT = 832,
   GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED_BUCKETS = 8,
-  GRPC_STATS_HISTOGRAM_BUCKETS = 840
+  GRPC_STATS_HISTOGRAM_CALL_PICK_US_FIRST_SLOT = 840,
+  GRPC_STATS_HISTOGRAM_CALL_PICK_US_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_CALL_FIRST_SEND_US_FIRST_SLOT = 904,
+  GRPC_STATS_HISTOGRAM_CALL_FIRST_SEND_US_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_CALL_FIRST_RECV_MSG_US_FIRST_SLOT = 968,
+  GRPC_STATS_HISTOGRAM_CALL_FIRST_RECV_MSG_US_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_CALL_COMPLETION_US_FIRST_SLOT = 1032,
+  GRPC_STATS_HISTOGRAM_CALL_COMPLETION_US_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_HTTP2_TRANSPORT_WINDOW_STALL_MS_FIRST_SLOT = 1096,
+  GRPC_STATS_HISTOGRAM_HTTP2_TRANSPORT_WINDOW_STALL_MS_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_HTTP2_STREAM_WINDOW_STALL_MS_FIRST_SLOT = 1160,
+  GRPC_STATS_HISTOGRAM_HTTP2_STREAM_WINDOW_STALL_MS_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_TCP_BACKPRESSURE_STALL_MS_FIRST_SLOT = 1224,
+  GRPC_STATS_HISTOGRAM_TCP_BACKPRESSURE_STALL_MS_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_BUCKETS = 1288
 } grpc_stats_histogram_constants;
 #if defined(GRPC_COLLECT_STATS) || !defined(NDEBUG)
 #define GRPC_STATS_INC_CLIENT_CALLS_CREATED() \
@@ -396,6 +420,12 @@ typedef enum {
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRYLOCK_SUCCESSES)
 #define GRPC_STATS_INC_CQ_EV_QUEUE_TRANSIENT_POP_FAILURES() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRANSIENT_POP_FAILURES)
+#define GRPC_STATS_INC_HTTP2_TRANSPORT_WINDOW_STALLS() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_HTTP2_TRANSPORT_WINDOW_STALLS)
+#define GRPC_STATS_INC_HTTP2_STREAM_WINDOW_STALLS() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_HTTP2_STREAM_WINDOW_STALLS)
+#define GRPC_STATS_INC_TCP_BACKPRESSURE_WRITES() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_TCP_BACKPRESSURE_WRITES)
 #define GRPC_STATS_INC_CALL_INITIAL_SIZE(value) \
   grpc_stats_inc_call_initial_size((int)(value))
 void grpc_stats_inc_call_initial_size(int value);
@@ -435,6 +465,27 @@ void grpc_stats_inc_http2_send_flowctl_per_write(int value);
 #define GRPC_STATS_INC_SERVER_CQS_CHECKED(value) \
   grpc_stats_inc_server_cqs_checked((int)(value))
 void grpc_stats_inc_server_cqs_checked(int value);
+#define GRPC_STATS_INC_CALL_PICK_US(value) \
+  grpc_stats_inc_call_pick_us((int)(value))
+void grpc_stats_inc_call_pick_us(int value);
+#define GRPC_STATS_INC_CALL_FIRST_SEND_US(value) \
+  grpc_stats_inc_call_first_send_us((int)(value))
+void grpc_stats_inc_call_first_send_us(int value);
+#define GRPC_STATS_INC_CALL_FIRST_RECV_MSG_US(value) \
+  grpc_stats_inc_call_first_recv_msg_us((int)(value))
+void grpc_stats_inc_call_first_recv_msg_us(int value);
+#define GRPC_STATS_INC_CALL_COMPLETION_US(value) \
+  grpc_stats_inc_call_completion_us((int)(value))
+void grpc_stats_inc_call_completion_us(int value);
+#define GRPC_STATS_INC_HTTP2_TRANSPORT_WINDOW_STALL_MS(value) \
+  grpc_stats_inc_http2_transport_window_stall_ms((int)(value))
+void grpc_stats_inc_http2_transport_window_stall_ms(int value);
+#define GRPC_STATS_INC_HTTP2_STREAM_WINDOW_STALL_MS(value) \
+  grpc_stats_inc_http2_stream_window_stall_ms((int)(value))
+void grpc_stats_inc_http2_stream_window_stall_ms(int value);
+#define GRPC_STATS_INC_TCP_BACKPRESSURE_STALL_MS(value) \
+  grpc_stats_inc_tcp_backpressure_stall_ms((int)(value))
+void grpc_stats_inc_tcp_backpressure_stall_ms(int value);
 #else
 #define GRPC_STATS_INC_CLIENT_CALLS_CREATED()
 #define GRPC_STATS_INC_SERVER_CALLS_CREATED()
@@ -534,6 +585,9 @@ void grpc_stats_inc_server_cqs_checked(int value);
 #define GRPC_STATS_INC_CQ_EV_QUEUE_TRYLOCK_FAILURES()
 #define GRPC_STATS_INC_CQ_EV_QUEUE_TRYLOCK_SUCCESSES()
 #define GRPC_STATS_INC_CQ_EV_QUEUE_TRANSIENT_POP_FAILURES()
+#define GRPC_STATS_INC_HTTP2_TRANSPORT_WINDOW_STALLS()
+#define GRPC_STATS_INC_HTTP2_STREAM_WINDOW_STALLS()
+#define GRPC_STATS_INC_TCP_BACKPRESSURE_WRITES()
 #define GRPC_STATS_INC_CALL_INITIAL_SIZE(value)
 #define GRPC_STATS_INC_POLL_EVENTS_RETURNED(value)
 #define GRPC_STATS_INC_TCP_WRITE_SIZE(value)
@@ -547,10 +601,17 @@ void grpc_stats_inc_server_cqs_checked(int value);
 #define GRPC_STATS_INC_HTTP2_SEND_TRAILING_METADATA_PER_WRITE(value)
 #define GRPC_STATS_INC_HTTP2_SEND_FLOWCTL_PER_WRITE(value)
 #define GRPC_STATS_INC_SERVER_CQS_CHECKED(value)
+#define GRPC_STATS_INC_CALL_PICK_US(value)
+#define GRPC_STATS_INC_CALL_FIRST_SEND_US(value)
+#define GRPC_STATS_INC_CALL_FIRST_RECV_MSG_US(value)
+#define GRPC_STATS_INC_CALL_COMPLETION_US(value)
+#define GRPC_STATS_INC_HTTP2_TRANSPORT_WINDOW_STALL_MS(value)
+#define GRPC_STATS_INC_HTTP2_STREAM_WINDOW_STALL_MS(value)
+#define GRPC_STATS_INC_TCP_BACKPRESSURE_STALL_MS(value)
 #endif /* defined(GRPC_COLLECT_STATS) || !defined(NDEBUG) */
-extern const int grpc_stats_histo_buckets[13];
-extern const int grpc_stats_histo_start[13];
-extern const int* const grpc_stats_histo_bucket_boundaries[13];
-extern void (*const grpc_stats_inc_histogram[13])(int x);
+extern const int grpc_stats_histo_buckets[20];
+extern const int grpc_stats_histo_start[20];
+extern const int* const grpc_stats_histo_bucket_boundaries[20];
+extern void (*const grpc_stats_inc_histogram[20])(int x);
 
 #endif /* GRPC_CORE_LIB_DEBUG_STATS_DATA_H */
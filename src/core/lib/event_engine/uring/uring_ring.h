@@ -0,0 +1,120 @@
+// Copyright 2021 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_CORE_LIB_EVENT_ENGINE_URING_URING_RING_H
+#define GRPC_CORE_LIB_EVENT_ENGINE_URING_URING_RING_H
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_LINUX_IO_URING
+
+#include <linux/io_uring.h>
+#include <stdint.h>
+#include <sys/uio.h>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+// Thin wrapper around a kernel io_uring instance, implemented against the raw
+// io_uring_setup/io_uring_enter syscalls so no liburing dependency is needed.
+// One ring is intended per poller thread; the submission side is therefore
+// single-threaded and unsynchronized, while completions may be reaped from the
+// same thread only.
+class UringRing {
+ public:
+  struct Completion {
+    uint64_t user_data;
+    int32_t result;
+    uint32_t flags;
+  };
+
+  UringRing() = default;
+  ~UringRing();
+
+  UringRing(const UringRing&) = delete;
+  UringRing& operator=(const UringRing&) = delete;
+
+  // Creates the ring with space for \a entries submissions. If \a sq_poll is
+  // true, requests IORING_SETUP_SQPOLL so submissions do not require an
+  // io_uring_enter syscall while the kernel poller thread is live.
+  absl::Status Init(uint32_t entries, bool sq_poll);
+
+  // Queues a readv/writev/poll-add against \a fd. The operation completes
+  // asynchronously; \a user_data is handed back verbatim in the completion.
+  // Returns false if the submission queue is full (caller should Submit()
+  // and retry).
+  bool PrepareReadv(int fd, const struct iovec* iov, unsigned iovcnt,
+                    uint64_t user_data);
+  bool PrepareWritev(int fd, const struct iovec* iov, unsigned iovcnt,
+                     uint64_t user_data);
+  bool PreparePollAdd(int fd, uint32_t poll_events, uint64_t user_data);
+
+  // Flushes all queued submissions to the kernel. Returns the number of
+  // submissions consumed, or an error from io_uring_enter.
+  absl::StatusOr<int> Submit();
+
+  // Submits pending entries and blocks until at least \a min_complete
+  // completions are available, then drains up to \a max completions into
+  // \a completions. Returns the number of completions reaped.
+  absl::StatusOr<int> SubmitAndWait(uint32_t min_complete,
+                                    Completion* completions, uint32_t max);
+
+  // Non-blocking completion reap.
+  int Reap(Completion* completions, uint32_t max);
+
+  int ring_fd() const { return ring_fd_; }
+
+ private:
+  struct io_uring_sqe* GetSqe();
+  void PrepareRw(uint8_t opcode, int fd, const void* addr, uint32_t len,
+                 struct io_uring_sqe* sqe, uint64_t user_data);
+
+  int ring_fd_ = -1;
+  bool sq_poll_ = false;
+  // Submission queue mapping.
+  void* sq_ring_mem_ = nullptr;
+  size_t sq_ring_size_ = 0;
+  struct io_uring_sqe* sqes_ = nullptr;
+  size_t sqes_size_ = 0;
+  uint32_t* sq_head_ = nullptr;
+  uint32_t* sq_tail_ = nullptr;
+  uint32_t* sq_mask_ = nullptr;
+  uint32_t* sq_array_ = nullptr;
+  uint32_t* sq_flags_ = nullptr;
+  uint32_t sq_entries_ = 0;
+  uint32_t pending_submissions_ = 0;
+  // Completion queue mapping.
+  void* cq_ring_mem_ = nullptr;
+  size_t cq_ring_size_ = 0;
+  uint32_t* cq_head_ = nullptr;
+  uint32_t* cq_tail_ = nullptr;
+  uint32_t* cq_mask_ = nullptr;
+  struct io_uring_cqe* cqes_ = nullptr;
+};
+
+// Returns true if the running kernel supports the io_uring operations that
+// UringRing relies on (readv/writev/poll-add; kernel >= 5.1). The probe is
+// performed once and cached.
+bool IsUringSupported();
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_LINUX_IO_URING
+
+#endif  // GRPC_CORE_LIB_EVENT_ENGINE_URING_URING_RING_H
@@ -25,6 +25,7 @@
 #include <grpc/support/atm.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/gpr/log_async.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gprpp/global_config.h"
 
@@ -85,6 +86,18 @@ void gpr_log_message(const char* file, int line, gpr_log_severity severity,
   lfargs.line = line;
   lfargs.severity = severity;
   lfargs.message = message;
+  // ERROR-severity records and records that would carry a stack trace stay
+  // synchronous: the process may be about to abort, and a stack trace must
+  // be captured on the logging thread. Everything else may be handed to the
+  // asynchronous sink, which declines unless GRPC_ASYNC_LOGGING is set and
+  // the default log function is still installed.
+  if (severity != GPR_LOG_SEVERITY_ERROR &&
+      gpr_should_log_stacktrace(severity) == 0 &&
+      gpr_atm_no_barrier_load(&g_log_func) ==
+          reinterpret_cast<gpr_atm>(gpr_default_log) &&
+      gpr_log_async_enqueue(&lfargs)) {
+    return;
+  }
   reinterpret_cast<gpr_log_func>(gpr_atm_no_barrier_load(&g_log_func))(&lfargs);
 }
 
@@ -133,6 +146,8 @@ void gpr_log_verbosity_init() {
     gpr_atm_no_barrier_store(&g_min_severity_to_print_stacktrace,
                              min_severity_to_print_stacktrace);
   }
+  // Start the asynchronous log sink if it is configured on.
+  gpr_log_async_init();
 }
 
 void gpr_set_log_function(gpr_log_func f) {
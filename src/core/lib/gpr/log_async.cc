@@ -0,0 +1,188 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gpr/log_async.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <atomic>
+#include <new>
+#include <string>
+
+#ifndef GPR_WINDOWS
+#include <pthread.h>
+#endif
+
+#include "absl/strings/str_format.h"
+#include "absl/time/time.h"
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/sync.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/gprpp/global_config.h"
+#include "src/core/lib/gprpp/thd.h"
+
+GPR_GLOBAL_CONFIG_DEFINE_BOOL(
+    grpc_async_logging, false,
+    "Buffer log records below ERROR severity in memory and write them to "
+    "stderr from a background thread instead of the logging thread")
+
+namespace {
+
+// Ring capacity; must be a power of two. At 2048 records the ring absorbs
+// multi-millisecond stalls of the writer thread at full trace volume.
+constexpr size_t kRingSize = 2048;
+constexpr size_t kRingMask = kRingSize - 1;
+// Records longer than this are truncated; gpr_log messages are almost
+// always far shorter.
+constexpr size_t kMaxMessageSize = 256;
+
+// One slot of the bounded multi-producer/single-consumer ring, following
+// Dmitry Vyukov's bounded queue protocol: sequence holds the ticket of the
+// producer allowed to fill the slot while it is empty, and that ticket + 1
+// once the record is ready for the writer.
+struct AsyncLogRecord {
+  std::atomic<size_t> sequence;
+  gpr_log_severity severity;
+  const char* file;  // always a string literal, never freed
+  int line;
+  long tid;
+  gpr_timespec timestamp;
+  char message[kMaxMessageSize];
+};
+
+AsyncLogRecord* g_ring = nullptr;
+std::atomic<size_t> g_enqueue_pos{0};
+size_t g_dequeue_pos = 0;  // owned by the writer thread
+std::atomic<size_t> g_dropped{0};
+std::atomic<bool> g_enabled{false};
+
+long current_thread_id() {
+#ifdef GPR_WINDOWS
+  return static_cast<long>(GetCurrentThreadId());
+#else
+  // Same portability hack as the gettid helper in log_posix.cc: pthread_t
+  // is a pointer on some platforms and an integer on others.
+  return static_cast<long>((intptr_t)pthread_self());
+#endif
+}
+
+// Formats and writes one record in the same shape as the synchronous
+// gpr_default_log implementations, using the timestamp and thread id
+// captured when the record was logged.
+void write_record(const AsyncLogRecord* record) {
+  const char* display_file = record->file;
+  const char* slash = strrchr(record->file, '/');
+  if (slash != nullptr) display_file = slash + 1;
+  absl::Time timestamp = absl::FromUnixSeconds(record->timestamp.tv_sec) +
+                         absl::Nanoseconds(record->timestamp.tv_nsec);
+  std::string prefix = absl::StrFormat(
+      "%s%s %7ld %s:%d]", gpr_log_severity_string(record->severity),
+      absl::FormatTime("%m%d %H:%M:%E9S", timestamp, absl::LocalTimeZone()),
+      record->tid, display_file, record->line);
+  fprintf(stderr, "%-70s %s\n", prefix.c_str(), record->message);
+}
+
+void writer_thread(void* /*arg*/) {
+  for (;;) {
+    bool wrote = false;
+    for (;;) {
+      AsyncLogRecord* record = &g_ring[g_dequeue_pos & kRingMask];
+      if (record->sequence.load(std::memory_order_acquire) !=
+          g_dequeue_pos + 1) {
+        break;
+      }
+      write_record(record);
+      // Hand the slot back to producers kRingSize tickets from now.
+      record->sequence.store(g_dequeue_pos + kRingSize,
+                             std::memory_order_release);
+      ++g_dequeue_pos;
+      wrote = true;
+    }
+    size_t dropped = g_dropped.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0) {
+      fprintf(stderr,
+              "gpr async log: dropped %zu record(s); the ring filled faster "
+              "than stderr could be written\n",
+              dropped);
+    } else if (!wrote) {
+      gpr_sleep_until(gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
+                                   gpr_time_from_millis(1, GPR_TIMESPAN)));
+    }
+  }
+}
+
+void log_async_init_once(void) {
+  if (!GPR_GLOBAL_CONFIG_GET(grpc_async_logging)) return;
+  g_ring = static_cast<AsyncLogRecord*>(
+      gpr_malloc(sizeof(AsyncLogRecord) * kRingSize));
+  for (size_t i = 0; i < kRingSize; i++) {
+    new (&g_ring[i]) AsyncLogRecord;
+    g_ring[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  grpc_core::Thread writer(
+      "async_log_writer", writer_thread, nullptr, nullptr,
+      grpc_core::Thread::Options().set_joinable(false).set_tracked(false));
+  writer.Start();
+  g_enabled.store(true, std::memory_order_release);
+}
+
+}  // namespace
+
+void gpr_log_async_init(void) {
+  static gpr_once once = GPR_ONCE_INIT;
+  gpr_once_init(&once, log_async_init_once);
+}
+
+bool gpr_log_async_enqueue(const gpr_log_func_args* args) {
+  if (!g_enabled.load(std::memory_order_acquire)) return false;
+  size_t pos = g_enqueue_pos.load(std::memory_order_relaxed);
+  AsyncLogRecord* record;
+  for (;;) {
+    record = &g_ring[pos & kRingMask];
+    size_t seq = record->sequence.load(std::memory_order_acquire);
+    intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+    if (diff == 0) {
+      if (g_enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                              std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      // Ring full: drop the record rather than block the logging thread.
+      g_dropped.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    } else {
+      pos = g_enqueue_pos.load(std::memory_order_relaxed);
+    }
+  }
+  record->severity = args->severity;
+  record->file = args->file;
+  record->line = args->line;
+  record->tid = current_thread_id();
+  record->timestamp = gpr_now(GPR_CLOCK_REALTIME);
+  size_t len = strlen(args->message);
+  if (len >= kMaxMessageSize) len = kMaxMessageSize - 1;
+  memcpy(record->message, args->message, len);
+  record->message[len] = 0;
+  record->sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
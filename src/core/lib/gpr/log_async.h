@@ -0,0 +1,53 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_LIB_GPR_LOG_ASYNC_H
+#define GRPC_CORE_LIB_GPR_LOG_ASYNC_H
+
+#include <grpc/support/port_platform.h>
+
+#include <grpc/support/log.h>
+
+/* Optional asynchronous sink for gpr log records.
+
+   When enabled (GRPC_ASYNC_LOGGING, off by default), log records below
+   ERROR severity are copied into a fixed-size lock-free ring and written
+   to stderr by a background thread, so that enabling verbose tracing does
+   not block the threads being traced on stderr writes. The timestamp and
+   thread id recorded for each message are captured on the logging thread,
+   so deferred formatting does not perturb the reported timings.
+
+   If the ring is full the record is dropped rather than blocking the
+   caller; the writer thread reports the number of dropped records once it
+   catches up. Records still queued when the process exits may be lost,
+   which is why ERROR-severity records (and records carrying stack traces)
+   never take this path. The sink engages only while the default log
+   function is installed; gpr_set_log_function callbacks always run
+   synchronously on the logging thread. */
+
+/* Reads the configuration and starts the writer thread if the sink is
+   enabled. Called from gpr_log_verbosity_init; records logged before then
+   are written synchronously. */
+void gpr_log_async_init(void);
+
+/* Attempts to hand \a args to the background writer. Returns true if the
+   record was queued (or counted as dropped) and the caller should not log
+   it synchronously; returns false if the sink is disabled. */
+bool gpr_log_async_enqueue(const gpr_log_func_args* args);
+
+#endif /* GRPC_CORE_LIB_GPR_LOG_ASYNC_H */
@@ -37,6 +37,56 @@ gpr_atm gpr_counter_atm_cas = 0;
 gpr_atm gpr_counter_atm_add = 0;
 #endif
 
+#ifdef GPR_MU_ADAPTIVE_SPIN
+/* Opt-in adaptive spinning: briefly spin with a pause instruction before
+   parking in pthread_mutex_lock(). Critical sections under gpr_mu are
+   typically sub-microsecond, so a short spin often acquires the lock for the
+   cost of a few cache line reads instead of a futex sleep/wake pair.
+
+   The spin budget is learned with the same update rule glibc uses for
+   PTHREAD_MUTEX_ADAPTIVE_NP: a spin that succeeds after cnt iterations moves
+   the budget an eighth of the way toward cnt, and an exhausted spin moves it
+   toward the (capped) maximum so that locks held for long stretches quickly
+   stop paying for spinning. gpr_mu is ABI-frozen as a bare pthread_mutex_t,
+   so the budget is process-global rather than per lock site. */
+
+#define GPR_MU_SPIN_MAX_ITERATIONS 128
+
+static gpr_atm g_mu_spin_budget = 32;
+
+static void mu_spin_pause(void) {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  __asm__ __volatile__("yield");
+#else
+  __asm__ __volatile__("" : : : "memory");
+#endif
+}
+
+/* Returns non-zero if the mutex was acquired by spinning; otherwise the
+   caller must fall through to the parking pthread_mutex_lock(). */
+static int mu_adaptive_spin_lock(pthread_mutex_t* mutex) {
+  if (pthread_mutex_trylock(mutex) == 0) return 1;
+  int spins = static_cast<int>(gpr_atm_no_barrier_load(&g_mu_spin_budget));
+  int max_spins = 2 * spins + 10;
+  if (max_spins > GPR_MU_SPIN_MAX_ITERATIONS) {
+    max_spins = GPR_MU_SPIN_MAX_ITERATIONS;
+  }
+  int cnt = 0;
+  do {
+    if (++cnt > max_spins) {
+      gpr_atm_no_barrier_store(&g_mu_spin_budget,
+                               spins + (max_spins - spins) / 8);
+      return 0;
+    }
+    mu_spin_pause();
+  } while (pthread_mutex_trylock(mutex) != 0);
+  gpr_atm_no_barrier_store(&g_mu_spin_budget, spins + (cnt - spins) / 8);
+  return 1;
+}
+#endif /* GPR_MU_ADAPTIVE_SPIN */
+
 void gpr_mu_init(gpr_mu* mu) {
 #ifdef GRPC_ASAN_ENABLED
   GPR_ASSERT(pthread_mutex_init(&mu->mutex, nullptr) == 0);
@@ -62,8 +112,14 @@ void gpr_mu_lock(gpr_mu* mu) {
 #endif
   GPR_TIMER_SCOPE("gpr_mu_lock", 0);
 #ifdef GRPC_ASAN_ENABLED
+#ifdef GPR_MU_ADAPTIVE_SPIN
+  if (mu_adaptive_spin_lock(&mu->mutex)) return;
+#endif
   GPR_ASSERT(pthread_mutex_lock(&mu->mutex) == 0);
 #else
+#ifdef GPR_MU_ADAPTIVE_SPIN
+  if (mu_adaptive_spin_lock(mu)) return;
+#endif
   GPR_ASSERT(pthread_mutex_lock(mu) == 0);
 #endif
 }
@@ -34,17 +34,97 @@
 
 namespace {
 
-void* ArenaStorage(size_t initial_size) {
+/* Pool of retired initial-zone storage blocks, bucketed by power-of-two size
+   class. grpc_call creates and destroys one arena per call, so recycling the
+   initial block turns the per-call malloc into a freelist pop under an
+   uncontended spinlock. Requests are rounded up to their class size (the
+   arena just gets a slightly roomier initial zone); arenas larger than the
+   biggest class, and overflow zones, are not pooled. */
+constexpr size_t kMinPooledClassShift = 10; /* smallest class: 1KiB */
+constexpr size_t kNumPooledClasses = 6;     /* classes: 1KiB .. 32KiB */
+constexpr size_t kMaxPooledBlocksPerClass = 256;
+
+struct PooledBlock {
+  PooledBlock* next;
+};
+
+struct BlockPool {
+  gpr_spinlock lock = GPR_SPINLOCK_STATIC_INITIALIZER;
+  PooledBlock* head = nullptr;
+  size_t count = 0;
+};
+
+BlockPool g_block_pools[kNumPooledClasses];
+
+size_t PooledClassSize(size_t size_class) {
+  return size_t(1) << (kMinPooledClassShift + size_class);
+}
+
+/* Returns the smallest size class whose blocks hold at least alloc_size
+   bytes, or -1 if alloc_size is too large to pool. */
+int PooledClassIndex(size_t alloc_size) {
+  for (size_t i = 0; i < kNumPooledClasses; i++) {
+    if (alloc_size <= PooledClassSize(i)) return static_cast<int>(i);
+  }
+  return -1;
+}
+
+/* Allocates storage for an arena with *initial_size usable initial-zone
+   bytes, preferring a recycled block. *initial_size is updated to the usable
+   size actually provided (>= the request for pooled classes). */
+void* ArenaStorage(size_t* initial_size) {
   static constexpr size_t base_size =
       GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(grpc_core::Arena));
-  initial_size = GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_size);
-  size_t alloc_size = base_size + initial_size;
+  *initial_size = GPR_ROUND_UP_TO_ALIGNMENT_SIZE(*initial_size);
+  size_t alloc_size = base_size + *initial_size;
   static constexpr size_t alignment =
       (GPR_CACHELINE_SIZE > GPR_MAX_ALIGNMENT &&
        GPR_CACHELINE_SIZE % GPR_MAX_ALIGNMENT == 0)
           ? GPR_CACHELINE_SIZE
           : GPR_MAX_ALIGNMENT;
-  return gpr_malloc_aligned(alloc_size, alignment);
+  const int size_class = PooledClassIndex(alloc_size);
+  if (size_class < 0) {
+    return gpr_malloc_aligned(alloc_size, alignment);
+  }
+  *initial_size = PooledClassSize(size_class) - base_size;
+  BlockPool* pool = &g_block_pools[size_class];
+  PooledBlock* block = nullptr;
+  if (gpr_spinlock_trylock(&pool->lock)) {
+    block = pool->head;
+    if (block != nullptr) {
+      pool->head = block->next;
+      pool->count--;
+    }
+    gpr_spinlock_unlock(&pool->lock);
+  }
+  if (block != nullptr) return block;
+  return gpr_malloc_aligned(PooledClassSize(size_class), alignment);
+}
+
+/* Returns storage to its size-class pool; false if the block is unpooled (or
+   the pool is full) and the caller should free it. */
+bool ReturnArenaStorage(void* storage, size_t initial_size) {
+  static constexpr size_t base_size =
+      GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(grpc_core::Arena));
+  const size_t alloc_size = base_size + initial_size;
+  const int size_class = PooledClassIndex(alloc_size);
+  /* Only blocks sized by ArenaStorage exactly fill their class. */
+  if (size_class < 0 || alloc_size != PooledClassSize(size_class)) {
+    return false;
+  }
+  BlockPool* pool = &g_block_pools[size_class];
+  bool pooled = false;
+  if (gpr_spinlock_trylock(&pool->lock)) {
+    if (pool->count < kMaxPooledBlocksPerClass) {
+      PooledBlock* block = static_cast<PooledBlock*>(storage);
+      block->next = pool->head;
+      pool->head = block;
+      pool->count++;
+      pooled = true;
+    }
+    gpr_spinlock_unlock(&pool->lock);
+  }
+  return pooled;
 }
 
 }  // namespace
@@ -62,23 +142,27 @@ Arena::~Arena() {
 }
 
 Arena* Arena::Create(size_t initial_size) {
-  return new (ArenaStorage(initial_size)) Arena(initial_size);
+  void* storage = ArenaStorage(&initial_size);
+  return new (storage) Arena(initial_size);
 }
 
 std::pair<Arena*, void*> Arena::CreateWithAlloc(size_t initial_size,
                                                 size_t alloc_size) {
   static constexpr size_t base_size =
       GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(Arena));
-  auto* new_arena =
-      new (ArenaStorage(initial_size)) Arena(initial_size, alloc_size);
+  void* storage = ArenaStorage(&initial_size);
+  auto* new_arena = new (storage) Arena(initial_size, alloc_size);
   void* first_alloc = reinterpret_cast<char*>(new_arena) + base_size;
   return std::make_pair(new_arena, first_alloc);
 }
 
 size_t Arena::Destroy() {
   size_t size = total_used_.load(std::memory_order_relaxed);
+  size_t initial_size = initial_zone_size_;
   this->~Arena();
-  gpr_free_aligned(this);
+  if (!ReturnArenaStorage(this, initial_size)) {
+    gpr_free_aligned(this);
+  }
   return size;
 }
 
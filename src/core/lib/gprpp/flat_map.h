@@ -0,0 +1,118 @@
+//
+// Copyright 2021 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_CORE_LIB_GPRPP_FLAT_MAP_H
+#define GRPC_CORE_LIB_GPRPP_FLAT_MAP_H
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace grpc_core {
+
+// An immutable map backed by a sorted array.
+//
+// Lookups are a binary search over contiguous storage, and mutations
+// (Add/Remove) produce a new map by copying the array, so this is a good
+// fit for read-mostly maps of modest size -- subchannel indexes,
+// per-server state, and the like -- that would otherwise pay a per-node
+// allocation and pointer chasing in a balanced tree. Copies of a FlatMap
+// share storage, so taking a snapshot for reading outside a lock is a
+// single refcount bump.
+template <class K, class V, class Compare = std::less<K>>
+class FlatMap {
+ private:
+  using Entries = std::vector<std::pair<K, V>>;
+
+ public:
+  using const_iterator = typename Entries::const_iterator;
+
+  FlatMap() = default;
+  FlatMap(const FlatMap&) = default;
+  FlatMap& operator=(const FlatMap&) = default;
+  FlatMap(FlatMap&&) noexcept = default;
+  FlatMap& operator=(FlatMap&&) noexcept = default;
+
+  // Returns a map with key bound to value, replacing any existing
+  // binding. This map is unchanged.
+  FlatMap Add(K key, V value) const {
+    auto entries = std::make_shared<Entries>(
+        entries_ == nullptr ? Entries() : *entries_);
+    auto it = LowerBound(*entries, key);
+    if (it != entries->end() && !Compare()(key, it->first)) {
+      it->second = std::move(value);
+    } else {
+      entries->insert(it, std::make_pair(std::move(key), std::move(value)));
+    }
+    return FlatMap(std::move(entries));
+  }
+
+  // Returns a map with no binding for key. This map is unchanged.
+  FlatMap Remove(const K& key) const {
+    if (Lookup(key) == nullptr) return *this;
+    auto entries = std::make_shared<Entries>(*entries_);
+    entries->erase(LowerBound(*entries, key));
+    return FlatMap(std::move(entries));
+  }
+
+  // Returns the value bound to key, or null if not present. The returned
+  // pointer is valid for as long as any map sharing this storage lives.
+  const V* Lookup(const K& key) const {
+    if (entries_ == nullptr) return nullptr;
+    auto it = LowerBound(*entries_, key);
+    if (it == entries_->end() || Compare()(key, it->first)) return nullptr;
+    return &it->second;
+  }
+
+  bool Empty() const { return entries_ == nullptr || entries_->empty(); }
+  size_t Size() const { return entries_ == nullptr ? 0 : entries_->size(); }
+
+  const_iterator begin() const {
+    return entries_ == nullptr ? EmptyEntries()->begin() : entries_->begin();
+  }
+  const_iterator end() const {
+    return entries_ == nullptr ? EmptyEntries()->end() : entries_->end();
+  }
+
+ private:
+  explicit FlatMap(std::shared_ptr<const Entries> entries)
+      : entries_(std::move(entries)) {}
+
+  template <class Vec>
+  static auto LowerBound(Vec& entries, const K& key)
+      -> decltype(entries.begin()) {
+    return std::lower_bound(
+        entries.begin(), entries.end(), key,
+        [](const std::pair<K, V>& entry, const K& k) {
+          return Compare()(entry.first, k);
+        });
+  }
+
+  static const Entries* EmptyEntries() {
+    static const Entries* entries = new Entries();
+    return entries;
+  }
+
+  std::shared_ptr<const Entries> entries_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_LIB_GPRPP_FLAT_MAP_H
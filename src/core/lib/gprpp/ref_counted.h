@@ -169,6 +169,25 @@ class RefCount {
 #endif
     return prior == 1;
   }
+  // Decrements the ref-count by `n` and returns true if the ref-count reaches
+  // 0.
+  bool Unref(Value n) {
+#ifndef NDEBUG
+    // Grab a copy of the trace flag before the atomic change, since we
+    // will no longer be holding a ref afterwards and therefore can't
+    // safely access it, since another thread might free us in the interim.
+    auto* trace = trace_;
+#endif
+    const Value prior = value_.fetch_sub(n, std::memory_order_acq_rel);
+#ifndef NDEBUG
+    if (trace != nullptr) {
+      gpr_log(GPR_INFO, "%s:%p unref %" PRIdPTR " -> %" PRIdPTR, trace, this,
+              prior, prior - n);
+    }
+    GPR_DEBUG_ASSERT(prior >= n);
+#endif
+    return prior == n;
+  }
   bool Unref(const DebugLocation& location, const char* reason) {
 #ifndef NDEBUG
     // Grab a copy of the trace flag before the atomic change, since we
@@ -264,7 +264,8 @@ static grpc_error_handle finish_line(grpc_http_parser* parser,
   return GRPC_ERROR_NONE;
 }
 
-static grpc_error_handle addbyte_body(grpc_http_parser* parser, uint8_t byte) {
+static grpc_error_handle addbytes_body(grpc_http_parser* parser,
+                                       const uint8_t* bytes, size_t length) {
   size_t* body_length = nullptr;
   char** body = nullptr;
 
@@ -279,65 +280,19 @@ static grpc_error_handle addbyte_body(grpc_http_parser* parser, uint8_t byte) {
         return GRPC_ERROR_CREATE_FROM_STATIC_STRING("Should never reach here"));
   }
 
-  if (*body_length == parser->body_capacity) {
-    parser->body_capacity = std::max(size_t(8), parser->body_capacity * 3 / 2);
+  if (*body_length + length > parser->body_capacity) {
+    do {
+      parser->body_capacity =
+          std::max(size_t(8), parser->body_capacity * 3 / 2);
+    } while (*body_length + length > parser->body_capacity);
     *body = static_cast<char*>(gpr_realloc(*body, parser->body_capacity));
   }
-  (*body)[*body_length] = static_cast<char>(byte);
-  (*body_length)++;
+  memcpy(*body + *body_length, bytes, length);
+  *body_length += length;
 
   return GRPC_ERROR_NONE;
 }
 
-static bool check_line(grpc_http_parser* parser) {
-  if (parser->cur_line_length >= 2 &&
-      parser->cur_line[parser->cur_line_length - 2] == '\r' &&
-      parser->cur_line[parser->cur_line_length - 1] == '\n') {
-    return true;
-  }
-
-  // HTTP request with \n\r line termiantors.
-  else if (parser->cur_line_length >= 2 &&
-           parser->cur_line[parser->cur_line_length - 2] == '\n' &&
-           parser->cur_line[parser->cur_line_length - 1] == '\r') {
-    return true;
-  }
-
-  // HTTP request with only \n line terminators.
-  else if (parser->cur_line_length >= 1 &&
-           parser->cur_line[parser->cur_line_length - 1] == '\n') {
-    parser->cur_line_end_length = 1;
-    return true;
-  }
-
-  return false;
-}
-
-static grpc_error_handle addbyte(grpc_http_parser* parser, uint8_t byte,
-                                 bool* found_body_start) {
-  switch (parser->state) {
-    case GRPC_HTTP_FIRST_LINE:
-    case GRPC_HTTP_HEADERS:
-      if (parser->cur_line_length >= GRPC_HTTP_PARSER_MAX_HEADER_LENGTH) {
-        if (GRPC_TRACE_FLAG_ENABLED(grpc_http1_trace)) {
-          gpr_log(GPR_ERROR, "HTTP header max line length (%d) exceeded",
-                  GRPC_HTTP_PARSER_MAX_HEADER_LENGTH);
-        }
-        return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
-            "HTTP header max line length exceeded");
-      }
-      parser->cur_line[parser->cur_line_length] = byte;
-      parser->cur_line_length++;
-      if (check_line(parser)) {
-        return finish_line(parser, found_body_start);
-      }
-      return GRPC_ERROR_NONE;
-    case GRPC_HTTP_BODY:
-      return addbyte_body(parser, byte);
-  }
-  GPR_UNREACHABLE_CODE(return GRPC_ERROR_NONE);
-}
-
 void grpc_http_parser_init(grpc_http_parser* parser, grpc_http_type type,
                            void* request_or_response) {
   memset(parser, 0, sizeof(*parser));
@@ -374,12 +329,48 @@ void grpc_http_response_destroy(grpc_http_response* response) {
 grpc_error_handle grpc_http_parser_parse(grpc_http_parser* parser,
                                          const grpc_slice& slice,
                                          size_t* start_of_body) {
-  for (size_t i = 0; i < GRPC_SLICE_LENGTH(slice); i++) {
+  const uint8_t* const beg = GRPC_SLICE_START_PTR(slice);
+  const size_t length = GRPC_SLICE_LENGTH(slice);
+  size_t i = 0;
+  while (i != length) {
+    if (parser->state == GRPC_HTTP_BODY) {
+      // Everything that remains is body: append it in one go
+      return addbytes_body(parser, beg + i, length - i);
+    }
+    // Scan for the end of the current line in bulk rather than advancing the
+    // state machine one byte at a time. All supported line terminators
+    // (\r\n and a lone \n) end in \n, so memchr finds the boundary.
+    const uint8_t* newline =
+        static_cast<const uint8_t*>(memchr(beg + i, '\n', length - i));
+    const size_t chunk_length = newline == nullptr
+                                    ? length - i
+                                    : static_cast<size_t>(newline - beg) + 1 - i;
+    if (parser->cur_line_length + chunk_length >
+        GRPC_HTTP_PARSER_MAX_HEADER_LENGTH) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_http1_trace)) {
+        gpr_log(GPR_ERROR, "HTTP header max line length (%d) exceeded",
+                GRPC_HTTP_PARSER_MAX_HEADER_LENGTH);
+      }
+      return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+          "HTTP header max line length exceeded");
+    }
+    memcpy(parser->cur_line + parser->cur_line_length, beg + i, chunk_length);
+    parser->cur_line_length += chunk_length;
+    i += chunk_length;
+    if (newline == nullptr) {
+      // The line continues in a subsequent slice
+      return GRPC_ERROR_NONE;
+    }
+    if (!(parser->cur_line_length >= 2 &&
+          parser->cur_line[parser->cur_line_length - 2] == '\r')) {
+      // HTTP request with only \n line terminators; once seen, terminators
+      // stay a single byte for the rest of the message
+      parser->cur_line_end_length = 1;
+    }
     bool found_body_start = false;
-    grpc_error_handle err =
-        addbyte(parser, GRPC_SLICE_START_PTR(slice)[i], &found_body_start);
+    grpc_error_handle err = finish_line(parser, &found_body_start);
     if (err != GRPC_ERROR_NONE) return err;
-    if (found_body_start && start_of_body != nullptr) *start_of_body = i + 1;
+    if (found_body_start && start_of_body != nullptr) *start_of_body = i;
   }
   return GRPC_ERROR_NONE;
 }
@@ -25,6 +25,7 @@
 #include <grpc/support/log.h>
 
 #include "src/core/lib/debug/stats.h"
+#include "src/core/lib/gpr/tls.h"
 #include "src/core/lib/profiling/timers.h"
 
 namespace grpc_core {
@@ -45,6 +46,14 @@ gpr_atm EncodeCancelStateError(grpc_error_handle error) {
   return static_cast<gpr_atm>(1) | reinterpret_cast<gpr_atm>(error);
 }
 
+// Maximum number of nested inline closure runs per thread; see
+// GRPC_CALL_COMBINER_BATCH(). Bounds stack growth when a fused closure
+// chain re-enters the combiner (e.g., a filter continuing a deferred
+// recv_trailing_metadata callback from its recv_message callback).
+constexpr size_t kMaxInlineBatchDepth = 8;
+
+GPR_THREAD_LOCAL(size_t) g_inline_batch_depth;
+
 }  // namespace
 
 CallCombiner::CallCombiner() {
@@ -98,6 +107,16 @@ void CallCombiner::ScheduleClosure(grpc_closure* closure,
   original_closure_ = closure;
   ExecCtx::Run(DEBUG_LOCATION, &tsan_closure_, error);
 #else
+  if (closure->inlineable && g_inline_batch_depth < kMaxInlineBatchDepth) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_call_combiner_trace)) {
+      gpr_log(GPR_INFO, "  RUNNING INLINE (batch depth %" PRIuPTR ")",
+              static_cast<size_t>(g_inline_batch_depth));
+    }
+    g_inline_batch_depth = g_inline_batch_depth + 1;
+    Closure::Run(DEBUG_LOCATION, closure, error);
+    g_inline_batch_depth = g_inline_batch_depth - 1;
+    return;
+  }
   ExecCtx::Run(DEBUG_LOCATION, closure, error);
 #endif
 }
@@ -76,6 +76,12 @@ struct grpc_closure {
     uintptr_t scratch;
   } error_data;
 
+  /** If true, CallCombiner may run this closure inline instead of taking a
+      round trip through the ExecCtx closure list. Set via
+      GRPC_CALL_COMBINER_BATCH(); see call_combiner.h for the safety
+      requirements. */
+  bool inlineable;
+
 // extra tracing and debugging for grpc_closure. This incurs a decent amount of
 // overhead per closure, so it must be enabled at compile time.
 #ifndef NDEBUG
@@ -99,6 +105,7 @@ inline grpc_closure* grpc_closure_init(grpc_closure* closure,
   closure->cb = cb;
   closure->cb_arg = cb_arg;
   closure->error_data.error = GRPC_ERROR_NONE;
+  closure->inlineable = false;
 #ifndef NDEBUG
   closure->scheduled = false;
   closure->file_initiated = nullptr;
@@ -43,6 +43,14 @@ grpc_core::DebugOnlyTraceFlag grpc_combiner_trace(false, "combiner");
 #define STATE_UNORPHANED 1
 #define STATE_ELEM_COUNT_LOW_BIT 2
 
+// Adaptive inline-vs-offload policy: short closure chains are always run
+// inline to completion (offloading them costs more in thread hops and cold
+// caches than it saves), while a run that has held its thread longer than
+// the budget hands the remainder to the executor so that timers and other
+// exec ctx work are not starved behind a long chttp2 combiner run.
+#define COMBINER_MIN_CLOSURES_BEFORE_OFFLOAD 8
+#define COMBINER_RUN_BUDGET_MS 1
+
 static void combiner_exec(grpc_core::Combiner* lock, grpc_closure* closure,
                           grpc_error_handle error);
 static void combiner_finally_exec(grpc_core::Combiner* lock,
@@ -171,9 +179,23 @@ static void offload(void* arg, grpc_error_handle /*error*/) {
 static void queue_offload(grpc_core::Combiner* lock) {
   move_next();
   GRPC_COMBINER_TRACE(gpr_log(GPR_INFO, "C:%p queue_offload", lock));
+  // The thread that picks this up starts a fresh run (and a fresh budget).
+  lock->closures_this_run = 0;
   grpc_core::Executor::Run(&lock->offload, GRPC_ERROR_NONE);
 }
 
+// Returns true if the current run has executed enough closures and held its
+// thread for longer than the run budget.
+static bool combiner_run_over_budget(grpc_core::Combiner* lock) {
+  if (lock->closures_this_run < COMBINER_MIN_CLOSURES_BEFORE_OFFLOAD) {
+    return false;
+  }
+  gpr_timespec elapsed = gpr_cycle_counter_sub(gpr_get_cycle_counter(),
+                                               lock->run_start_cycles);
+  return gpr_time_cmp(elapsed, gpr_time_from_millis(COMBINER_RUN_BUDGET_MS,
+                                                    GPR_TIMESPAN)) > 0;
+}
+
 bool grpc_combiner_continue_exec_ctx() {
   grpc_core::Combiner* lock =
       grpc_core::ExecCtx::Get()->combiner_data()->active_combiner;
@@ -193,16 +215,28 @@ bool grpc_combiner_continue_exec_ctx() {
                               grpc_core::ExecCtx::Get()->IsReadyToFinish(),
                               lock->time_to_execute_final_list));
 
+  if (lock->closures_this_run == 0) {
+    lock->run_start_cycles = gpr_get_cycle_counter();
+  }
+
   // offload only if all the following conditions are true:
-  // 1. the combiner is contended and has more than one closure to execute
-  // 2. the current execution context needs to finish as soon as possible
-  // 3. the current thread is not a worker for any background poller
-  // 4. the DEFAULT executor is threaded
-  if (contended && grpc_core::ExecCtx::Get()->IsReadyToFinish() &&
+  // 1. either of:
+  //    a. the combiner is contended, the current execution context needs to
+  //       finish as soon as possible, and this run has already executed a
+  //       minimal inline burst (short chains complete inline rather than
+  //       paying a thread hop), or
+  //    b. this run has exceeded its time budget and more closures are
+  //       queued behind the current one
+  // 2. the current thread is not a worker for any background poller
+  // 3. the DEFAULT executor is threaded
+  if (((contended && grpc_core::ExecCtx::Get()->IsReadyToFinish() &&
+        lock->closures_this_run >= COMBINER_MIN_CLOSURES_BEFORE_OFFLOAD) ||
+       (combiner_run_over_budget(lock) &&
+        (gpr_atm_acq_load(&lock->state) >> 1) > 1)) &&
       !grpc_iomgr_platform_is_any_background_poller_thread() &&
       grpc_core::Executor::IsThreadedDefault()) {
-    // this execution context wants to move on: schedule remaining work to be
-    // picked up on the executor
+    // this execution context wants to move on (or this thread has run long
+    // enough): schedule remaining work to be picked up on the executor
     queue_offload(lock);
     return true;
   }
@@ -227,6 +261,7 @@ bool grpc_combiner_continue_exec_ctx() {
 #endif
     cl->cb(cl->cb_arg, cl_err);
     GRPC_ERROR_UNREF(cl_err);
+    lock->closures_this_run++;
   } else {
     grpc_closure* c = lock->final_list.head;
     GPR_ASSERT(c != nullptr);
@@ -242,6 +277,7 @@ bool grpc_combiner_continue_exec_ctx() {
 #endif
       c->cb(c->cb_arg, error);
       GRPC_ERROR_UNREF(error);
+      lock->closures_this_run++;
       c = next;
     }
   }
@@ -271,6 +307,7 @@ bool grpc_combiner_continue_exec_ctx() {
       break;
     case OLD_STATE_WAS(false, 1):
       // had one count, one unorphaned --> unlocked unorphaned
+      lock->closures_this_run = 0;
       return true;
     case OLD_STATE_WAS(true, 1):
       // and one count, one orphaned --> unlocked and orphaned
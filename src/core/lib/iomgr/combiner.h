@@ -26,6 +26,7 @@
 #include <grpc/support/atm.h>
 
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gpr/time_precise.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 
 namespace grpc_core {
@@ -51,6 +52,11 @@ class Combiner {
   grpc_closure_list final_list;
   grpc_closure offload;
   gpr_refcount refs;
+  // Accounting for the adaptive inline-vs-offload policy; only touched by
+  // the thread currently holding the combiner.  A "run" is the span of
+  // closures executed by one thread without relinquishing the combiner.
+  gpr_cycle_counter run_start_cycles = 0;
+  size_t closures_this_run = 0;
 };
 }  // namespace grpc_core
 
@@ -508,6 +508,32 @@ static void ref_errs(grpc_error_handle err) {
   }
 }
 
+// Unquoted names of the status codes representable as inline errors,
+// indexed by grpc_status_code.
+static const char* error_inline_status_names[] = {
+    "OK",
+    "CANCELLED",
+    "UNKNOWN",
+    "INVALID_ARGUMENT",
+    "DEADLINE_EXCEEDED",
+    "NOT_FOUND",
+    "ALREADY_EXISTS",
+    "PERMISSION_DENIED",
+    "RESOURCE_EXHAUSTED",
+    "FAILED_PRECONDITION",
+    "ABORTED",
+    "OUT_OF_RANGE",
+    "UNIMPLEMENTED",
+    "INTERNAL",
+    "UNAVAILABLE",
+    "DATA_LOSS",
+    "UNAUTHENTICATED",
+};
+
+static const char* error_inline_status_name(grpc_error_handle err) {
+  return error_inline_status_names[grpc_error_inline_status_code(err)];
+}
+
 static grpc_error_handle copy_error_and_unref(grpc_error_handle in) {
   grpc_error_handle out;
   if (grpc_error_is_special(in)) {
@@ -523,6 +549,12 @@ static grpc_error_handle copy_error_and_unref(grpc_error_handle in) {
       internal_set_str(&out, GRPC_ERROR_STR_DESCRIPTION,
                        grpc_slice_from_static_string("cancelled"));
       internal_set_int(&out, GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_CANCELLED);
+    } else if (grpc_error_is_inline_status(in)) {
+      grpc_slice name =
+          grpc_slice_from_static_string(error_inline_status_name(in));
+      internal_set_str(&out, GRPC_ERROR_STR_DESCRIPTION, name);
+      internal_set_int(&out, GRPC_ERROR_INT_GRPC_STATUS,
+                       grpc_error_inline_status_code(in));
     }
   } else if (gpr_ref_is_unique(&in->atomics.refs)) {
     out = in;
@@ -584,7 +616,11 @@ bool grpc_error_get_int(grpc_error_handle err, grpc_error_ints which,
                         intptr_t* p) {
   if (grpc_error_is_special(err)) {
     if (which != GRPC_ERROR_INT_GRPC_STATUS) return false;
-    *p = error_status_map[reinterpret_cast<size_t>(err)].code;
+    if (grpc_error_is_inline_status(err)) {
+      *p = grpc_error_inline_status_code(err);
+    } else {
+      *p = error_status_map[reinterpret_cast<size_t>(err)].code;
+    }
     return true;
   }
   uint8_t slot = err->ints[which];
@@ -607,12 +643,21 @@ bool grpc_error_get_str(grpc_error_handle err, grpc_error_strs which,
                         grpc_slice* str) {
   if (grpc_error_is_special(err)) {
     if (which != GRPC_ERROR_STR_GRPC_MESSAGE) return false;
-    const special_error_status_map& msg =
-        error_status_map[reinterpret_cast<size_t>(err)];
+    const char* msg;
+    size_t len;
+    if (grpc_error_is_inline_status(err)) {
+      msg = error_inline_status_name(err);
+      len = strlen(msg);
+    } else {
+      const special_error_status_map& entry =
+          error_status_map[reinterpret_cast<size_t>(err)];
+      msg = entry.msg;
+      len = entry.len;
+    }
     str->refcount = &grpc_core::kNoopRefcount;
     str->data.refcounted.bytes =
-        reinterpret_cast<uint8_t*>(const_cast<char*>(msg.msg));
-    str->data.refcounted.length = msg.len;
+        reinterpret_cast<uint8_t*>(const_cast<char*>(msg));
+    str->data.refcounted.length = len;
     return true;
   }
   uint8_t slot = err->strs[which];
@@ -860,6 +905,7 @@ const char* grpc_error_string(grpc_error_handle err) {
   if (err == GRPC_ERROR_NONE) return no_error_string;
   if (err == GRPC_ERROR_OOM) return oom_error_string;
   if (err == GRPC_ERROR_CANCELLED) return cancelled_error_string;
+  if (grpc_error_is_inline_status(err)) return error_inline_status_name(err);
 
   void* p =
       reinterpret_cast<void*>(gpr_atm_acq_load(&err->atomics.error_string));
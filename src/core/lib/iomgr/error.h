@@ -160,6 +160,12 @@ void grpc_enable_error_creation();
 #define GRPC_ERROR_OOM absl::Status(absl::ResourceExhaustedError(""))
 #define GRPC_ERROR_CANCELLED absl::CancelledError()
 
+/// A code-only status needs no extra allocation in this representation.
+inline grpc_error_handle grpc_error_from_inline_status(grpc_status_code code) {
+  if (code == GRPC_STATUS_OK) return GRPC_ERROR_NONE;
+  return absl::Status(static_cast<absl::StatusCode>(code), "");
+}
+
 #define GRPC_ERROR_REF(err) (err)
 #define GRPC_ERROR_UNREF(err)
 
@@ -236,12 +242,43 @@ absl::Status grpc_wsa_error(const grpc_core::DebugLocation& location, int err,
 #define GRPC_ERROR_OOM ((grpc_error_handle)2)
 #define GRPC_ERROR_RESERVED_2 ((grpc_error_handle)3)
 #define GRPC_ERROR_CANCELLED ((grpc_error_handle)4)
-#define GRPC_ERROR_SPECIAL_MAX GRPC_ERROR_CANCELLED
+
+/// Inline status-code errors: beyond the named specials above, any bare
+/// grpc_status_code can be encoded directly in the handle value as
+/// 6 + 2 * code.  Like the specials these are even (preserving the low
+/// bit for combiner locks and polling engines), never allocated and never
+/// refcounted; they carry GRPC_ERROR_INT_GRPC_STATUS and a static message
+/// naming the code.  Attaching any other attribute or a child expands them
+/// into a regular heap-allocated error.
+#define GRPC_ERROR_INLINE_STATUS_FIRST ((uintptr_t)6)
+#define GRPC_ERROR_INLINE_STATUS_LAST                 \
+  ((grpc_error_handle)(GRPC_ERROR_INLINE_STATUS_FIRST \
+                       + 2 * (uintptr_t)GRPC_STATUS_UNAUTHENTICATED))
+#define GRPC_ERROR_SPECIAL_MAX GRPC_ERROR_INLINE_STATUS_LAST
 
 inline bool grpc_error_is_special(grpc_error_handle err) {
   return err <= GRPC_ERROR_SPECIAL_MAX;
 }
 
+inline bool grpc_error_is_inline_status(grpc_error_handle err) {
+  return err >= (grpc_error_handle)GRPC_ERROR_INLINE_STATUS_FIRST &&
+         err <= GRPC_ERROR_INLINE_STATUS_LAST;
+}
+
+inline grpc_status_code grpc_error_inline_status_code(grpc_error_handle err) {
+  return (grpc_status_code)(
+      ((uintptr_t)err - GRPC_ERROR_INLINE_STATUS_FIRST) / 2);
+}
+
+/// Returns a zero-allocation error carrying just \a code.  OK and CANCELLED
+/// canonicalize to GRPC_ERROR_NONE and GRPC_ERROR_CANCELLED respectively.
+inline grpc_error_handle grpc_error_from_inline_status(grpc_status_code code) {
+  if (code == GRPC_STATUS_OK) return GRPC_ERROR_NONE;
+  if (code == GRPC_STATUS_CANCELLED) return GRPC_ERROR_CANCELLED;
+  return (grpc_error_handle)(GRPC_ERROR_INLINE_STATUS_FIRST +
+                             2 * (uintptr_t)code);
+}
+
 #ifndef NDEBUG
 grpc_error_handle grpc_error_do_ref(grpc_error_handle err, const char* file,
                                     int line);
@@ -45,22 +45,60 @@
 
 #include <grpc/support/alloc.h>
 #include <grpc/support/cpu.h>
+#include <grpc/support/time.h>
 
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gpr/tls.h"
 #include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
 #include "src/core/lib/iomgr/block_annotate.h"
 #include "src/core/lib/iomgr/ev_epoll1_linux.h"
 #include "src/core/lib/iomgr/ev_posix.h"
 #include "src/core/lib/iomgr/iomgr_internal.h"
 #include "src/core/lib/iomgr/lockfree_event.h"
+#include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/iomgr/wakeup_fd_posix.h"
 #include "src/core/lib/profiling/timers.h"
 
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_experimental_epoll1_numa_nodes, 0,
+    "Number of NUMA nodes to partition epoll1's pollset neighborhoods "
+    "across. When set to 2 or more, a finishing designated poller looks for "
+    "its successor among the neighborhoods of its own node before spilling "
+    "over to the other nodes, avoiding cross-node wakeups on multi-socket "
+    "machines. Assumes the OS enumerates CPUs in contiguous per-node blocks "
+    "(the common Linux layout). 0 or 1 disables the partitioning.");
+
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_experimental_epoll1_busy_poll_usec, 0,
+    "Number of microseconds the designated poller spins with non-blocking "
+    "epoll_wait calls before falling back to a blocking wait, trading one "
+    "core of CPU for the 5-10us of scheduler wakeup latency a sleeping "
+    "poller pays per event. Only the single designated poller thread "
+    "spins. Pairs with GRPC_ARG_EXPERIMENTAL_TCP_BUSY_POLL_USEC, which "
+    "makes the kernel busy-poll the device queue as well. 0 (the default) "
+    "disables spinning.");
+
 static grpc_wakeup_fd global_wakeup_fd;
 
+/* Non-zero while a wakeup written to global_wakeup_fd has not yet been
+   consumed by the designated poller. */
+static gpr_atm g_wakeup_fd_armed;
+
+/* Write to global_wakeup_fd, unless a previous wakeup is still pending
+   consumption: a single unconsumed eventfd write is enough to interrupt
+   epoll_wait, so further writes before the poller drains the fd are
+   redundant syscalls. Callers mark the target worker KICKED before calling
+   this, so the kick itself is never lost when the write is skipped. */
+static grpc_error_handle kick_global_wakeup_fd(void) {
+  if (!gpr_atm_full_cas(&g_wakeup_fd_armed, 0, 1)) {
+    return GRPC_ERROR_NONE;
+  }
+  return grpc_wakeup_fd_wakeup(&global_wakeup_fd);
+}
+
 /*******************************************************************************
  * Singleton epoll set related fields
  */
@@ -328,7 +366,14 @@ static void fork_fd_list_remove_grpc_fd(grpc_fd* fd) {
   }
 }
 
-static grpc_fd* fd_create(int fd, const char* name, bool track_err) {
+/* EPOLLEXCLUSIVE is supported by kernels 4.5+; registering with it on older
+ * kernels fails with EINVAL, which we handle by re-registering without it. */
+#ifndef EPOLLEXCLUSIVE
+#define EPOLLEXCLUSIVE (1u << 28)
+#endif
+
+static grpc_fd* fd_create_internal(int fd, const char* name, bool track_err,
+                                   bool listener) {
   grpc_fd* new_fd = nullptr;
 
   gpr_mu_lock(&fd_freelist_mu);
@@ -361,7 +406,11 @@ static grpc_fd* fd_create(int fd, const char* name, bool track_err) {
 #endif
 
   struct epoll_event ev;
-  ev.events = static_cast<uint32_t>(EPOLLIN | EPOLLOUT | EPOLLET);
+  /* Listener fds are only waited on for reads; registering them for
+   * exclusive wakeup stops a connection burst from waking every poller. */
+  ev.events = listener
+                  ? static_cast<uint32_t>(EPOLLIN | EPOLLET | EPOLLEXCLUSIVE)
+                  : static_cast<uint32_t>(EPOLLIN | EPOLLOUT | EPOLLET);
   /* Use the least significant bit of ev.data.ptr to store track_err. We expect
    * the addresses to be word aligned. We need to store track_err to avoid
    * synchronization issues when accessing it after receiving an event.
@@ -370,12 +419,27 @@ static grpc_fd* fd_create(int fd, const char* name, bool track_err) {
   ev.data.ptr = reinterpret_cast<void*>(reinterpret_cast<intptr_t>(new_fd) |
                                         (track_err ? 1 : 0));
   if (epoll_ctl(g_epoll_set.epfd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+    if (listener && errno == EINVAL) {
+      /* Pre-4.5 kernel: retry without EPOLLEXCLUSIVE. */
+      ev.events = static_cast<uint32_t>(EPOLLIN | EPOLLET);
+      if (epoll_ctl(g_epoll_set.epfd, EPOLL_CTL_ADD, fd, &ev) == 0) {
+        return new_fd;
+      }
+    }
     gpr_log(GPR_ERROR, "epoll_ctl failed: %s", strerror(errno));
   }
 
   return new_fd;
 }
 
+static grpc_fd* fd_create(int fd, const char* name, bool track_err) {
+  return fd_create_internal(fd, name, track_err, /*listener=*/false);
+}
+
+static grpc_fd* fd_create_listener(int fd, const char* name, bool track_err) {
+  return fd_create_internal(fd, name, track_err, /*listener=*/true);
+}
+
 static int fd_wrapped_fd(grpc_fd* fd) { return fd->fd; }
 
 /* if 'releasing_fd' is true, it means that we are going to detach the internal
@@ -471,6 +535,15 @@ static gpr_atm g_active_poller;
 
 static pollset_neighborhood* g_neighborhoods;
 static size_t g_num_neighborhoods;
+/* NUMA partitioning of the neighborhoods (see
+   grpc_experimental_epoll1_numa_nodes): number of nodes (<= 1 means
+   disabled) and neighborhoods per node block. */
+static size_t g_num_numa_nodes;
+static size_t g_numa_block_size;
+
+/* Spin budget for the designated poller before blocking in epoll_wait (see
+   grpc_experimental_epoll1_busy_poll_usec). 0 means no spinning. */
+static int g_busy_poll_usec;
 
 /* Return true if first in list */
 static bool worker_insert(grpc_pollset* pollset, grpc_pollset_worker* worker) {
@@ -513,8 +586,31 @@ static size_t choose_neighborhood(void) {
   return static_cast<size_t>(gpr_cpu_current_cpu()) % g_num_neighborhoods;
 }
 
+/* Index of the step'th neighborhood to scan when looking for a successor
+   designated poller, starting from start_idx. With NUMA partitioning
+   enabled, the neighborhoods in start_idx's node block are visited first so
+   the handoff prefers waking a same-node worker; otherwise (and for the
+   remainder of the scan) this is a plain rotation. */
+static size_t neighborhood_scan_index(size_t start_idx, size_t step) {
+  if (g_num_numa_nodes <= 1) {
+    return (start_idx + step) % g_num_neighborhoods;
+  }
+  const size_t node_begin = (start_idx / g_numa_block_size) * g_numa_block_size;
+  size_t node_end = node_begin + g_numa_block_size;
+  if (node_end > g_num_neighborhoods) node_end = g_num_neighborhoods;
+  const size_t node_size = node_end - node_begin;
+  if (step < node_size) {
+    return node_begin + (start_idx - node_begin + step) % node_size;
+  }
+  /* Walk the remaining neighborhoods starting just past our node block;
+     since the block is contiguous and step < g_num_neighborhoods, this never
+     revisits it. */
+  return (node_end + (step - node_size)) % g_num_neighborhoods;
+}
+
 static grpc_error_handle pollset_global_init(void) {
   gpr_atm_no_barrier_store(&g_active_poller, 0);
+  gpr_atm_no_barrier_store(&g_wakeup_fd_armed, 0);
   global_wakeup_fd.read_fd = -1;
   grpc_error_handle err = grpc_wakeup_fd_init(&global_wakeup_fd);
   if (err != GRPC_ERROR_NONE) return err;
@@ -532,6 +628,16 @@ static grpc_error_handle pollset_global_init(void) {
   for (size_t i = 0; i < g_num_neighborhoods; i++) {
     gpr_mu_init(&g_neighborhoods[i].mu);
   }
+  g_num_numa_nodes = static_cast<size_t>(
+      grpc_core::Clamp(GPR_GLOBAL_CONFIG_GET(grpc_experimental_epoll1_numa_nodes),
+                       int32_t(0), static_cast<int32_t>(g_num_neighborhoods)));
+  g_numa_block_size =
+      g_num_numa_nodes > 1
+          ? (g_num_neighborhoods + g_num_numa_nodes - 1) / g_num_numa_nodes
+          : g_num_neighborhoods;
+  g_busy_poll_usec = grpc_core::Clamp(
+      GPR_GLOBAL_CONFIG_GET(grpc_experimental_epoll1_busy_poll_usec),
+      int32_t(0), int32_t(1000000));
   return GRPC_ERROR_NONE;
 }
 
@@ -606,8 +712,7 @@ static grpc_error_handle pollset_kick_all(grpc_pollset* pollset) {
         case DESIGNATED_POLLER:
           GRPC_STATS_INC_POLLSET_KICK_WAKEUP_FD();
           SET_KICK_STATE(worker, KICKED);
-          append_error(&error, grpc_wakeup_fd_wakeup(&global_wakeup_fd),
-                       "pollset_kick_all");
+          append_error(&error, kick_global_wakeup_fd(), "pollset_kick_all");
           break;
       }
 
@@ -676,6 +781,11 @@ static grpc_error_handle process_epoll_events(grpc_pollset* /*pollset*/) {
     if (data_ptr == &global_wakeup_fd) {
       append_error(&error, grpc_wakeup_fd_consume_wakeup(&global_wakeup_fd),
                    err_desc);
+      /* Disarm only after the eventfd is drained: if the flag were cleared
+         first, a kick arriving in between would write the fd and have its
+         wakeup swallowed by the drain above, leaving the flag set with
+         nothing pending - and later kicks would then skip the write. */
+      gpr_atm_rel_store(&g_wakeup_fd_armed, 0);
     } else {
       grpc_fd* fd = reinterpret_cast<grpc_fd*>(
           reinterpret_cast<intptr_t>(data_ptr) & ~static_cast<intptr_t>(1));
@@ -714,18 +824,42 @@ static grpc_error_handle process_epoll_events(grpc_pollset* /*pollset*/) {
 static grpc_error_handle do_epoll_wait(grpc_pollset* ps, grpc_millis deadline) {
   GPR_TIMER_SCOPE("do_epoll_wait", 0);
 
-  int r;
+  int r = 0;
   int timeout = poll_deadline_to_millis_timeout(deadline);
-  if (timeout != 0) {
-    GRPC_SCHEDULING_START_BLOCKING_REGION;
-  }
-  do {
+  if (g_busy_poll_usec > 0 && timeout != 0) {
+    /* Spin with non-blocking epoll_wait calls for the configured budget
+       before paying the scheduler wakeup latency of a blocking wait. The
+       whole spin is counted as one poll in stats so the syscall_poll
+       metric keeps its meaning of "times the poller went looking for
+       events". */
     GRPC_STATS_INC_SYSCALL_POLL();
-    r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events, MAX_EPOLL_EVENTS,
-                   timeout);
-  } while (r < 0 && errno == EINTR);
-  if (timeout != 0) {
-    GRPC_SCHEDULING_END_BLOCKING_REGION;
+    gpr_timespec spin_deadline =
+        gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
+                     gpr_time_from_micros(g_busy_poll_usec, GPR_TIMESPAN));
+    do {
+      r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events, MAX_EPOLL_EVENTS,
+                     0);
+    } while ((r == 0 || (r < 0 && errno == EINTR)) &&
+             gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), spin_deadline) < 0);
+    if (r < 0 && errno == EINTR) r = 0;
+    if (r == 0) {
+      /* The spin consumed part of the deadline; recompute the timeout
+         before falling back to a blocking wait. */
+      timeout = poll_deadline_to_millis_timeout(deadline);
+    }
+  }
+  if (r == 0) {
+    if (timeout != 0) {
+      GRPC_SCHEDULING_START_BLOCKING_REGION;
+    }
+    do {
+      GRPC_STATS_INC_SYSCALL_POLL();
+      r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events, MAX_EPOLL_EVENTS,
+                     timeout);
+    } while (r < 0 && errno == EINTR);
+    if (timeout != 0) {
+      GRPC_SCHEDULING_END_BLOCKING_REGION;
+    }
   }
 
   if (r < 0) return GRPC_OS_ERROR(errno, "epoll_wait");
@@ -967,8 +1101,8 @@ static void end_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
       bool scan_state[MAX_NEIGHBORHOODS];
       for (size_t i = 0; !found_worker && i < g_num_neighborhoods; i++) {
         pollset_neighborhood* neighborhood =
-            &g_neighborhoods[(poller_neighborhood_idx + i) %
-                             g_num_neighborhoods];
+            &g_neighborhoods[neighborhood_scan_index(poller_neighborhood_idx,
+                                                     i)];
         if (gpr_mu_trylock(&neighborhood->mu)) {
           found_worker = check_neighborhood_for_available_poller(neighborhood);
           gpr_mu_unlock(&neighborhood->mu);
@@ -980,8 +1114,8 @@ static void end_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
       for (size_t i = 0; !found_worker && i < g_num_neighborhoods; i++) {
         if (scan_state[i]) continue;
         pollset_neighborhood* neighborhood =
-            &g_neighborhoods[(poller_neighborhood_idx + i) %
-                             g_num_neighborhoods];
+            &g_neighborhoods[neighborhood_scan_index(poller_neighborhood_idx,
+                                                     i)];
         gpr_mu_lock(&neighborhood->mu);
         found_worker = check_neighborhood_for_available_poller(neighborhood);
         gpr_mu_unlock(&neighborhood->mu);
@@ -1043,8 +1177,14 @@ static grpc_error_handle pollset_work(grpc_pollset* ps,
        accurately grpc_core::ExecCtx::Get()->Flush() happens in end_worker()
        AFTER selecting a designated poller). So we are not waiting long periods
        without a designated poller */
-    if (gpr_atm_acq_load(&g_epoll_set.cursor) ==
-        gpr_atm_acq_load(&g_epoll_set.num_events)) {
+    /* Cooperatively check timers before blocking in epoll: when nothing is
+       due this is a single atomic load, and busy pollers checking here allow
+       the timer manager to quiesce (see timer_manager.cc). If timers did
+       fire, their closures are now queued on the ExecCtx; skip the epoll
+       wait for this iteration so that end_worker() flushes them promptly. */
+    if (grpc_timer_check(nullptr) != GRPC_TIMERS_FIRED &&
+        gpr_atm_acq_load(&g_epoll_set.cursor) ==
+            gpr_atm_acq_load(&g_epoll_set.num_events)) {
       append_error(&error, do_epoll_wait(ps, deadline), err_desc);
     }
     append_error(&error, process_epoll_events(ps), err_desc);
@@ -1122,7 +1262,7 @@ static grpc_error_handle pollset_kick(grpc_pollset* pollset,
           gpr_log(GPR_INFO, " .. kicked %p", root_worker);
         }
         SET_KICK_STATE(root_worker, KICKED);
-        ret_err = grpc_wakeup_fd_wakeup(&global_wakeup_fd);
+        ret_err = kick_global_wakeup_fd();
         goto done;
       } else if (next_worker->state == UNKICKED) {
         GRPC_STATS_INC_POLLSET_KICK_WAKEUP_CV();
@@ -1154,7 +1294,7 @@ static grpc_error_handle pollset_kick(grpc_pollset* pollset,
                     root_worker);
           }
           SET_KICK_STATE(next_worker, KICKED);
-          ret_err = grpc_wakeup_fd_wakeup(&global_wakeup_fd);
+          ret_err = kick_global_wakeup_fd();
           goto done;
         }
       } else {
@@ -1194,7 +1334,7 @@ static grpc_error_handle pollset_kick(grpc_pollset* pollset,
       gpr_log(GPR_INFO, " .. kick active poller");
     }
     SET_KICK_STATE(specific_worker, KICKED);
-    ret_err = grpc_wakeup_fd_wakeup(&global_wakeup_fd);
+    ret_err = kick_global_wakeup_fd();
     goto done;
   } else if (specific_worker->initialized_cv) {
     GRPC_STATS_INC_POLLSET_KICK_WAKEUP_CV();
@@ -1273,6 +1413,7 @@ static const grpc_event_engine_vtable vtable = {
     false,
 
     fd_create,
+    fd_create_listener,
     fd_wrapped_fd,
     fd_orphan,
     fd_shutdown,
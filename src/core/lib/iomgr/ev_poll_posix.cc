@@ -1346,6 +1346,7 @@ static const grpc_event_engine_vtable vtable = {
     false,
 
     fd_create,
+    nullptr, /* fd_create_listener */
     fd_wrapped_fd,
     fd_orphan,
     fd_shutdown,
@@ -256,6 +256,17 @@ grpc_fd* grpc_fd_create(int fd, const char* name, bool track_err) {
       fd, name, track_err && grpc_event_engine_can_track_errors());
 }
 
+grpc_fd* grpc_fd_create_listener(int fd, const char* name, bool track_err) {
+  GRPC_POLLING_API_TRACE("fd_create_listener(%d, %s, %d)", fd, name,
+                         track_err);
+  GRPC_FD_TRACE("fd_create_listener(%d, %s, %d)", fd, name, track_err);
+  track_err = track_err && grpc_event_engine_can_track_errors();
+  if (g_event_engine->fd_create_listener != nullptr) {
+    return g_event_engine->fd_create_listener(fd, name, track_err);
+  }
+  return g_event_engine->fd_create(fd, name, track_err);
+}
+
 int grpc_fd_wrapped_fd(grpc_fd* fd) {
   return g_event_engine->fd_wrapped_fd(fd);
 }
@@ -49,6 +49,10 @@ typedef struct grpc_event_engine_vtable {
   bool run_in_background;
 
   grpc_fd* (*fd_create)(int fd, const char* name, bool track_err);
+  /* Optional (may be null): like fd_create, but for listening sockets that
+     are only waited on for reads; the engine may register such fds for
+     exclusive wakeup. */
+  grpc_fd* (*fd_create_listener)(int fd, const char* name, bool track_err);
   int (*fd_wrapped_fd)(grpc_fd* fd);
   void (*fd_orphan)(grpc_fd* fd, grpc_closure* on_done, int* release_fd,
                     const char* reason);
@@ -122,6 +126,13 @@ bool grpc_event_engine_run_in_background();
    This takes ownership of closing fd. */
 grpc_fd* grpc_fd_create(int fd, const char* name, bool track_err);
 
+/* Like grpc_fd_create, but hints that \a fd is a listening socket that is
+   only ever waited on for reads. Engines that support it register the fd for
+   exclusive wakeup (EPOLLEXCLUSIVE), so that a burst of incoming connections
+   wakes a single poller rather than every thread watching the fd; engines
+   without support fall back to a regular fd_create. */
+grpc_fd* grpc_fd_create_listener(int fd, const char* name, bool track_err);
+
 /* Return the wrapped fd, or -1 if it has been released or closed. */
 int grpc_fd_wrapped_fd(grpc_fd* fd);
 
@@ -20,13 +20,26 @@
 
 #include "src/core/lib/iomgr/exec_ctx.h"
 
+#include <atomic>
+
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
 
+#include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/iomgr/combiner.h"
 #include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/executor.h"
+#include "src/core/lib/iomgr/iomgr_internal.h"
 #include "src/core/lib/profiling/timers.h"
 
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_exec_ctx_flush_budget, 0,
+    "Maximum number of closures a single ExecCtx::Flush runs inline before "
+    "offloading the remainder of the batch to the executor, so one long "
+    "closure cascade cannot starve the thread (typically a pollset worker) "
+    "that is flushing. 0 (the default) means unlimited, preserving the "
+    "historical fully-inline drain.");
+
 static void exec_ctx_run(grpc_closure* closure, grpc_error_handle error) {
 #ifndef NDEBUG
   closure->scheduled = false;
@@ -143,8 +156,11 @@ void ExecCtx::GlobalInit(void) {
 }
 
 bool ExecCtx::Flush() {
+  static const int32_t flush_budget =
+      GPR_GLOBAL_CONFIG_GET(grpc_exec_ctx_flush_budget);
   bool did_something = false;
   GPR_TIMER_SCOPE("grpc_exec_ctx_flush", 0);
+  size_t closures_run = 0;
   for (;;) {
     if (!grpc_closure_list_empty(closure_list_)) {
       grpc_closure* c = closure_list_.head;
@@ -155,6 +171,20 @@ bool ExecCtx::Flush() {
         did_something = true;
         exec_ctx_run(c, error);
         c = next;
+        if (flush_budget > 0 &&
+            ++closures_run >= static_cast<size_t>(flush_budget) &&
+            Executor::IsThreadedDefault() &&
+            !grpc_iomgr_platform_is_any_background_poller_thread()) {
+          // Budget exhausted: hand the rest of this batch to the executor so
+          // that the flushing thread can get back to its own work (polling,
+          // usually). Mirrors the combiner's contended-offload policy.
+          while (c != nullptr) {
+            grpc_closure* offloaded_next = c->next_data.next;
+            Executor::Run(c, c->error_data.error);
+            c = offloaded_next;
+          }
+          closures_run = 0;
+        }
       }
     } else if (!grpc_combiner_continue_exec_ctx()) {
       break;
@@ -164,14 +194,97 @@ bool ExecCtx::Flush() {
   return did_something;
 }
 
+/* A process-wide coarse timestamp, following the kernel's jiffies pattern:
+   whenever some thread pays for a precise clock read, the result is published
+   here together with the cycle count at which it was taken. Other threads'
+   ExecCtxs can then satisfy Now() with a few relaxed loads and a
+   cycle-counter read instead of a clock_gettime. The (millis, cycle) pair is
+   guarded by a seqlock so that a reader can never pair one publication's
+   timestamp with another's cycle count and misjudge the timestamp's age; a
+   reader that races with a publication simply falls back to the precise
+   clock. Disabled when the cycle counter is itself backed by the realtime
+   clock. */
+#if !GPR_CYCLE_COUNTER_FALLBACK
+#define GRPC_EXEC_CTX_COARSE_CLOCK 1
+
+/* Odd while a publication is in progress. */
+static std::atomic<uint64_t> g_coarse_now_version{0};
+static std::atomic<int64_t> g_coarse_now_millis{-1};
+static std::atomic<int64_t> g_coarse_now_cycle{0};
+
+/* Maximum age of a published timestamp before readers fall back to (and
+   republish from) the precise clock. */
+static constexpr int32_t kCoarseClockMaxAgeNanos = 50 * 1000;
+
+static bool coarse_clock_now(grpc_millis* result) {
+  const uint64_t version =
+      g_coarse_now_version.load(std::memory_order_acquire);
+  if ((version & 1) != 0) return false;  /* Publication in progress. */
+  const int64_t millis = g_coarse_now_millis.load(std::memory_order_relaxed);
+  const int64_t cycle = g_coarse_now_cycle.load(std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (g_coarse_now_version.load(std::memory_order_relaxed) != version) {
+    return false;  /* Raced with a publication; the pair may be torn. */
+  }
+  if (millis < 0) return false;
+  const gpr_timespec age =
+      gpr_cycle_counter_sub(gpr_get_cycle_counter(), cycle);
+  if (age.tv_sec != 0 || age.tv_nsec < 0 ||
+      age.tv_nsec > kCoarseClockMaxAgeNanos) {
+    return false;
+  }
+  *result = static_cast<grpc_millis>(millis);
+  return true;
+}
+#endif /* !GPR_CYCLE_COUNTER_FALLBACK */
+
+/* Reads the precise clock and publishes the result for coarse readers. The
+   cycle count is taken before the clock read so that the published
+   timestamp's age is never understated. Only one thread publishes at a time;
+   a thread that loses the race skips publication, since a fresh enough
+   result is being published anyway. */
+static grpc_millis precise_clock_now_and_publish() {
+#ifdef GRPC_EXEC_CTX_COARSE_CLOCK
+  uint64_t version = g_coarse_now_version.load(std::memory_order_relaxed);
+  const bool publish =
+      (version & 1) == 0 &&
+      g_coarse_now_version.compare_exchange_strong(version, version + 1,
+                                                   std::memory_order_acq_rel,
+                                                   std::memory_order_relaxed);
+  const gpr_cycle_counter cycle = publish ? gpr_get_cycle_counter() : 0;
+#endif
+  const grpc_millis now =
+      timespec_to_millis_round_down(gpr_now(GPR_CLOCK_MONOTONIC));
+#ifdef GRPC_EXEC_CTX_COARSE_CLOCK
+  if (publish) {
+    g_coarse_now_millis.store(now, std::memory_order_relaxed);
+    g_coarse_now_cycle.store(cycle, std::memory_order_relaxed);
+    g_coarse_now_version.store(version + 2, std::memory_order_release);
+  }
+#endif
+  return now;
+}
+
 grpc_millis ExecCtx::Now() {
   if (!now_is_valid_) {
-    now_ = timespec_to_millis_round_down(gpr_now(GPR_CLOCK_MONOTONIC));
+#ifdef GRPC_EXEC_CTX_COARSE_CLOCK
+    if (!coarse_clock_now(&now_)) {
+      now_ = precise_clock_now_and_publish();
+    }
+#else
+    now_ = precise_clock_now_and_publish();
+#endif
     now_is_valid_ = true;
   }
   return now_;
 }
 
+grpc_millis ExecCtx::NowPrecise() {
+  now_ = precise_clock_now_and_publish();
+  now_is_valid_ = true;
+  return now_;
+}
+
 void ExecCtx::Run(const DebugLocation& location, grpc_closure* closure,
                   grpc_error_handle error) {
   (void)location;
@@ -191,6 +191,14 @@ class ExecCtx {
    */
   grpc_millis Now();
 
+  /** Like Now(), but always backed by a fresh precise clock read, which also
+   *  refreshes the stored value. Now() may serve a process-wide coarse
+   *  timestamp that trails the precise clock by a few tens of microseconds;
+   *  use this where that slack matters, e.g. when deciding whether timer
+   *  deadlines are due.
+   */
+  grpc_millis NowPrecise();
+
   /** Invalidates the stored time value. A new time value will be set on calling
    *  Now().
    */
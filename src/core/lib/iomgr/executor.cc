@@ -158,6 +158,7 @@ void Executor::SetThreading(bool threading) {
       thd_state_[i].name = name_;
       thd_state_[i].thd = grpc_core::Thread();
       thd_state_[i].elems = GRPC_CLOSURE_LIST_INIT;
+      thd_state_[i].owner = this;
     }
 
     thd_state_[0].thd =
@@ -211,6 +212,48 @@ void Executor::SetThreading(bool threading) {
 
 void Executor::Shutdown() { SetThreading(false); }
 
+bool Executor::TrySteal(ThreadState* thief) {
+  size_t cur_thread_count =
+      static_cast<size_t>(gpr_atm_acq_load(&num_threads_));
+  for (size_t i = 1; i < cur_thread_count; i++) {
+    ThreadState* victim = &thd_state_[(thief->id + i) % cur_thread_count];
+    // Victim locks are only try-acquired while thief->mu is held, so the
+    // thief->victim ordering cannot deadlock with a concurrent steal in the
+    // other direction.
+    if (!gpr_mu_trylock(&victim->mu)) continue;
+    if (victim->depth < 2 || grpc_closure_list_empty(victim->elems)) {
+      gpr_mu_unlock(&victim->mu);
+      continue;
+    }
+    // Leave the older half with the victim - it preserves FIFO order for
+    // work that was already headed there - and take the newer half.
+    size_t keep = victim->depth - victim->depth / 2;
+    grpc_closure* c = victim->elems.head;
+    for (size_t n = 1; n < keep; n++) {
+      c = c->next_data.next;
+    }
+    grpc_closure_list stolen;
+    stolen.head = c->next_data.next;
+    stolen.tail = victim->elems.tail;
+    c->next_data.next = nullptr;
+    victim->elems.tail = c;
+    size_t stolen_count = victim->depth - keep;
+    victim->depth = keep;
+    size_t victim_id = victim->id;
+    // NB: if a long job happened to be in the stolen half,
+    // victim->queued_long_job stays conservatively true until the victim
+    // next runs dry. That only diverts future enqueues; no work is lost.
+    gpr_mu_unlock(&victim->mu);
+    grpc_closure_list_move(&stolen, &thief->elems);
+    thief->depth += stolen_count;
+    EXECUTOR_TRACE("(%s) [%" PRIdPTR "]: stole %" PRIdPTR
+                   " closures from thread %" PRIdPTR,
+                   thief->name, thief->id, stolen_count, victim_id);
+    return true;
+  }
+  return false;
+}
+
 void Executor::ThreadMain(void* arg) {
   ThreadState* ts = static_cast<ThreadState*>(arg);
   g_this_thread_state = ts;
@@ -226,6 +269,10 @@ void Executor::ThreadMain(void* arg) {
     ts->depth -= subtract_depth;
     // Wait for closures to be enqueued or for the executor to be shutdown
     while (grpc_closure_list_empty(ts->elems) && !ts->shutdown) {
+      // Out of local work: take over a share of another thread's backlog
+      // before parking, so a thread stuck behind a long-running closure
+      // does not head-of-line-block the short ones queued after it.
+      if (ts->owner->TrySteal(ts)) continue;
       ts->queued_long_job = false;
       gpr_cv_wait(&ts->cv, &ts->mu, gpr_inf_future(GPR_CLOCK_MONOTONIC));
     }
@@ -27,6 +27,8 @@
 
 namespace grpc_core {
 
+class Executor;
+
 struct ThreadState {
   gpr_mu mu;
   size_t id;         // For debugging purposes
@@ -37,6 +39,7 @@ struct ThreadState {
   bool shutdown;
   bool queued_long_job;
   grpc_core::Thread thd;
+  Executor* owner;  // The executor this thread belongs to (for stealing)
 };
 
 enum class ExecutorType {
@@ -107,6 +110,10 @@ class Executor {
   static size_t RunClosures(const char* executor_name, grpc_closure_list list);
   static void ThreadMain(void* arg);
 
+  // Moves roughly half of another thread's queued closures onto \a thief.
+  // Called by an executor thread (with thief->mu held) before it parks.
+  bool TrySteal(ThreadState* thief);
+
   const char* name_;
   ThreadState* thd_state_;
   size_t max_threads_;
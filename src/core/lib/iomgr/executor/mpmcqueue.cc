@@ -181,4 +181,227 @@ void InfLenFIFOQueue::RemoveWaiter(Waiter* waiter) {
 
 InfLenFIFOQueue::Waiter* InfLenFIFOQueue::TopWaiter() { return waiters_.next; }
 
+LockFreeMPMCQueue::LockFreeMPMCQueue() {
+  slots_ = new Slot[kRingSize];
+  // Slot i is free for the producer at position i when sequence == i.
+  for (int i = 0; i < kRingSize; ++i) {
+    slots_[i].sequence.store(static_cast<size_t>(i),
+                             std::memory_order_relaxed);
+  }
+  waiters_.next = &waiters_;
+  waiters_.prev = &waiters_;
+}
+
+LockFreeMPMCQueue::~LockFreeMPMCQueue() {
+  GPR_ASSERT(count_.load(std::memory_order_relaxed) == 0);
+  GPR_ASSERT(overflow_head_ == nullptr);
+  delete[] slots_;
+}
+
+bool LockFreeMPMCQueue::TryRingPut(void* elem,
+                                   const gpr_timespec& insert_time) {
+  size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  for (;;) {
+    Slot* slot = &slots_[pos & (kRingSize - 1)];
+    size_t seq = slot->sequence.load(std::memory_order_acquire);
+    intptr_t dif =
+        static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+    if (dif == 0) {
+      // Slot is free for this position; claim it.
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        slot->content = elem;
+        slot->insert_time = insert_time;
+        // Publishes content to the consumer at this position.
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+      }
+      // CAS failure reloaded pos; retry with the new position.
+    } else if (dif < 0) {
+      // The consumer lags a full lap behind: ring is full.
+      return false;
+    } else {
+      // Another producer claimed this position; move on.
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+bool LockFreeMPMCQueue::TryRingGet(void** elem, gpr_timespec* insert_time) {
+  size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+  for (;;) {
+    Slot* slot = &slots_[pos & (kRingSize - 1)];
+    size_t seq = slot->sequence.load(std::memory_order_acquire);
+    intptr_t dif =
+        static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+    if (dif == 0) {
+      // Slot holds an element for this position; claim it.
+      if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        *elem = slot->content;
+        *insert_time = slot->insert_time;
+        // Frees the slot for the producer one lap ahead.
+        slot->sequence.store(pos + kRingSize, std::memory_order_release);
+        return true;
+      }
+    } else if (dif < 0) {
+      // No element published at this position yet: ring is empty.
+      return false;
+    } else {
+      // Another consumer claimed this position; move on.
+      pos = dequeue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+void LockFreeMPMCQueue::UpdateStatsOnGet(const gpr_timespec& insert_time) {
+  gpr_timespec wait_time =
+      gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), insert_time);
+  MutexLock l(&mu_);
+  stats_.num_completed++;
+  stats_.total_queue_time = gpr_time_add(stats_.total_queue_time, wait_time);
+  stats_.max_queue_time = gpr_time_max(
+      gpr_convert_clock_type(stats_.max_queue_time, GPR_TIMESPAN), wait_time);
+  gpr_log(GPR_INFO,
+          "[LockFreeMPMCQueue Get] num_completed:        %" PRIu64
+          " total_queue_time: %f max_queue_time:   %f",
+          stats_.num_completed,
+          gpr_timespec_to_micros(stats_.total_queue_time),
+          gpr_timespec_to_micros(stats_.max_queue_time));
+}
+
+void LockFreeMPMCQueue::Put(void* elem) {
+  gpr_timespec insert_time = gpr_time_0(GPR_TIMESPAN);
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_thread_pool_trace)) {
+    insert_time = gpr_now(GPR_CLOCK_MONOTONIC);
+  }
+  // While the overflow list is non-empty new elements must follow it, or
+  // elements parked there would be starved and FIFO order lost.
+  if (overflow_count_.load(std::memory_order_relaxed) > 0 ||
+      !TryRingPut(elem, insert_time)) {
+    MutexLock l(&mu_);
+    OverflowNode* node = new OverflowNode();
+    node->content = elem;
+    node->insert_time = insert_time;
+    if (overflow_tail_ == nullptr) {
+      overflow_head_ = overflow_tail_ = node;
+    } else {
+      overflow_tail_->next = node;
+      overflow_tail_ = node;
+    }
+    overflow_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_thread_pool_trace)) {
+    MutexLock l(&mu_);
+    stats_.num_started++;
+    gpr_log(GPR_INFO, "[LockFreeMPMCQueue Put] num_started:        %" PRIu64,
+            stats_.num_started);
+  }
+  // The count_ increment must be seq_cst so that it cannot be reordered
+  // with the num_waiters_ load below: either this store is visible to a
+  // consumer about to sleep, or that consumer's num_waiters_ increment is
+  // visible here and we signal it.
+  count_.fetch_add(1, std::memory_order_seq_cst);
+  if (num_waiters_.load(std::memory_order_seq_cst) > 0) {
+    MutexLock l(&mu_);
+    // Signaling the dummy head when the waiter list went empty in the
+    // meantime is harmless.
+    TopWaiter()->cv.Signal();
+  }
+}
+
+void* LockFreeMPMCQueue::Get(gpr_timespec* wait_time) {
+  gpr_timespec total_wait = gpr_time_0(GPR_TIMESPAN);
+  for (;;) {
+    void* elem;
+    gpr_timespec insert_time;
+    if (TryRingGet(&elem, &insert_time)) {
+      count_.fetch_sub(1, std::memory_order_relaxed);
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_thread_pool_trace)) {
+        UpdateStatsOnGet(insert_time);
+        if (wait_time != nullptr) *wait_time = total_wait;
+      }
+      // Wake another consumer if elements remain; the LIFO waiter list
+      // means the most recently parked thread runs first (cache warmth),
+      // same as InfLenFIFOQueue.
+      if (count_.load(std::memory_order_relaxed) > 0 &&
+          num_waiters_.load(std::memory_order_relaxed) > 0) {
+        MutexLock l(&mu_);
+        TopWaiter()->cv.Signal();
+      }
+      return elem;
+    }
+    if (overflow_count_.load(std::memory_order_relaxed) > 0) {
+      MutexLock l(&mu_);
+      if (overflow_head_ != nullptr) {
+        OverflowNode* node = overflow_head_;
+        overflow_head_ = node->next;
+        if (overflow_head_ == nullptr) overflow_tail_ = nullptr;
+        overflow_count_.fetch_sub(1, std::memory_order_relaxed);
+        void* content = node->content;
+        insert_time = node->insert_time;
+        delete node;
+        count_.fetch_sub(1, std::memory_order_relaxed);
+        if (GRPC_TRACE_FLAG_ENABLED(grpc_thread_pool_trace)) {
+          gpr_timespec queue_time =
+              gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), insert_time);
+          stats_.num_completed++;
+          stats_.total_queue_time =
+              gpr_time_add(stats_.total_queue_time, queue_time);
+          stats_.max_queue_time = gpr_time_max(
+              gpr_convert_clock_type(stats_.max_queue_time, GPR_TIMESPAN),
+              queue_time);
+          if (wait_time != nullptr) *wait_time = total_wait;
+        }
+        return content;
+      }
+      // Overflow drained between the check and the lock; start over.
+      continue;
+    }
+    // Queue looks empty: park on the waiter list. The num_waiters_
+    // increment pairs with the seq_cst count_/num_waiters_ ordering in
+    // Put (see comment there) so no wakeup can be lost.
+    gpr_timespec start_time = gpr_time_0(GPR_TIMESPAN);
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_thread_pool_trace) &&
+        wait_time != nullptr) {
+      start_time = gpr_now(GPR_CLOCK_MONOTONIC);
+    }
+    {
+      MutexLock l(&mu_);
+      Waiter self;
+      PushWaiter(&self);
+      num_waiters_.fetch_add(1, std::memory_order_seq_cst);
+      while (count_.load(std::memory_order_seq_cst) == 0) {
+        self.cv.Wait(&mu_);
+      }
+      num_waiters_.fetch_sub(1, std::memory_order_relaxed);
+      RemoveWaiter(&self);
+    }
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_thread_pool_trace) &&
+        wait_time != nullptr) {
+      total_wait = gpr_time_add(
+          total_wait, gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start_time));
+    }
+    // count_ > 0 does not guarantee this thread wins the element; loop
+    // and retry the lock-free paths.
+  }
+}
+
+void LockFreeMPMCQueue::PushWaiter(Waiter* waiter) {
+  waiter->next = waiters_.next;
+  waiter->prev = &waiters_;
+  waiter->next->prev = waiter;
+  waiter->prev->next = waiter;
+}
+
+void LockFreeMPMCQueue::RemoveWaiter(Waiter* waiter) {
+  GPR_DEBUG_ASSERT(waiter != &waiters_);
+  waiter->next->prev = waiter->prev;
+  waiter->prev->next = waiter->next;
+}
+
+LockFreeMPMCQueue::Waiter* LockFreeMPMCQueue::TopWaiter() {
+  return waiters_.next;
+}
+
 }  // namespace grpc_core
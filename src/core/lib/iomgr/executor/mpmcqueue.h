@@ -171,6 +171,113 @@ class InfLenFIFOQueue : public MPMCQueueInterface {
   Node* AllocateNodes(int num);
 };
 
+// An MPMC queue whose fast path is lock-free: a bounded ring of
+// sequence-numbered slots (Dmitry Vyukov's bounded MPMC algorithm). The
+// mutex is only taken on the edges - a mutex-guarded overflow list absorbs
+// Puts while the ring is full (so Put never blocks) and a CondVar sleep
+// path parks consumers while the queue is empty. In the common case (ring
+// neither empty nor full, no sleeping consumer) producers and consumers
+// proceed on CAS loops alone instead of convoying on a single mutex.
+class LockFreeMPMCQueue : public MPMCQueueInterface {
+ public:
+  LockFreeMPMCQueue();
+
+  // Releases all resources held by the queue. The queue must be empty, and
+  // no one waits on conditional variables.
+  ~LockFreeMPMCQueue() override;
+
+  // Puts elem into the queue immediately at the end of queue. Never blocks
+  // and never fails: when the ring is full the element goes to the
+  // overflow list, and while the overflow list is non-empty new elements
+  // follow it to keep FIFO order.
+  void Put(void* elem) override;
+
+  // Removes the oldest element from the queue and returns it.
+  // This routine will cause the thread to block if queue is currently empty.
+  // Argument wait_time should be passed in when trace flag turning on (for
+  // collecting stats info purpose.)
+  void* Get(gpr_timespec* wait_time) override;
+
+  // Returns number of elements in queue currently.
+  // There might be concurrently add/remove on queue, so count might change
+  // quickly.
+  int count() const override { return count_.load(std::memory_order_relaxed); }
+
+  // For test purpose only. Returns the number of slots in the ring.
+  int ring_size() const { return kRingSize; }
+
+ private:
+  // One ring slot. The sequence number tells producers and consumers
+  // whether the slot is free to write (sequence == position) or holds an
+  // element ready to read (sequence == position + 1); see TryRingPut and
+  // TryRingGet.
+  struct Slot {
+    std::atomic<size_t> sequence{0};
+    void* content = nullptr;
+    gpr_timespec insert_time;  // Time for stats, filled when tracing
+  };
+
+  // Overflow element, kept in a singly linked list guarded by mu_.
+  struct OverflowNode {
+    OverflowNode* next = nullptr;
+    void* content = nullptr;
+    gpr_timespec insert_time;  // Time for stats, filled when tracing
+  };
+
+  // Node for waiting thread queue; same LIFO wakeup scheme as
+  // InfLenFIFOQueue.
+  struct Waiter {
+    CondVar cv;
+    Waiter* next;
+    Waiter* prev;
+  };
+
+  // Subset of InfLenFIFOQueue's stats that still makes sense when Get
+  // runs concurrently; only touched under mu_ and only when the
+  // thread_pool trace flag is on.
+  struct Stats {
+    uint64_t num_started = 0;
+    uint64_t num_completed = 0;
+    gpr_timespec total_queue_time;
+    gpr_timespec max_queue_time;
+
+    Stats() {
+      total_queue_time = gpr_time_0(GPR_TIMESPAN);
+      max_queue_time = gpr_time_0(GPR_TIMESPAN);
+    }
+  };
+
+  // Lock-free attempt to enqueue into / dequeue from the ring. Return
+  // false when the ring is full (Put) or empty (Get).
+  bool TryRingPut(void* elem, const gpr_timespec& insert_time);
+  bool TryRingGet(void** elem, gpr_timespec* insert_time);
+
+  // Updates stats_ after a successful Get; takes mu_ internally.
+  void UpdateStatsOnGet(const gpr_timespec& insert_time);
+
+  // Waiter list helpers, all require mu_ held.
+  void PushWaiter(Waiter* waiter);
+  void RemoveWaiter(Waiter* waiter);
+  Waiter* TopWaiter();
+
+  // Number of slots in the ring; must be a power of two.
+  static const int kRingSize = 1024;
+
+  Slot* slots_;
+  std::atomic<size_t> enqueue_pos_{0};
+  std::atomic<size_t> dequeue_pos_{0};
+  std::atomic<int> count_{0};
+  std::atomic<int> num_waiters_{0};
+  std::atomic<int> overflow_count_{0};
+
+  Mutex mu_;        // Guards overflow list, waiter list and stats; never
+                    // taken on the lock-free fast path
+  Waiter waiters_;  // Head of waiting thread queue
+  OverflowNode* overflow_head_ = nullptr;
+  OverflowNode* overflow_tail_ = nullptr;
+  Stats stats_;  // Stats info, collected only in debug trace mode
+};
+
 }  // namespace grpc_core
 
 #endif /* GRPC_CORE_LIB_IOMGR_EXECUTOR_MPMCQUEUE_H */
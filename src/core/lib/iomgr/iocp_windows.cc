@@ -155,4 +155,6 @@ void grpc_iocp_add_socket(grpc_winsocket* socket) {
   GPR_ASSERT(ret == g_iocp);
 }
 
+HANDLE grpc_iocp_handle(void) { return g_iocp; }
+
 #endif /* GRPC_WINSOCK_SOCKET */
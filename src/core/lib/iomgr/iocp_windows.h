@@ -42,6 +42,8 @@ void grpc_iocp_kick(void);
 void grpc_iocp_flush(void);
 void grpc_iocp_shutdown(void);
 void grpc_iocp_add_socket(grpc_winsocket*);
+/* The process-wide completion port handle that all sockets are attached to. */
+HANDLE grpc_iocp_handle(void);
 
 #endif
 
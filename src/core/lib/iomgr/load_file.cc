@@ -29,6 +29,14 @@
 
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/iomgr/block_annotate.h"
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_POSIX_SOCKET
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 grpc_error_handle grpc_load_file(const char* filename, int add_null_terminator,
                                  grpc_slice* output) {
@@ -79,3 +87,45 @@ end:
   GRPC_SCHEDULING_END_BLOCKING_REGION_NO_EXEC_CTX;
   return error;
 }
+
+#ifdef GRPC_POSIX_SOCKET
+
+static void unmap_file_slice(void* addr, size_t len) { munmap(addr, len); }
+
+grpc_error_handle grpc_load_file_mmap(const char* filename,
+                                      grpc_slice* output) {
+  int fd;
+  struct stat st;
+  void* addr = MAP_FAILED;
+  GRPC_SCHEDULING_START_BLOCKING_REGION;
+  fd = open(filename, O_RDONLY);
+  if (fd >= 0) {
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+      addr = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ,
+                  MAP_PRIVATE, fd, 0);
+    }
+    /* The mapping remains valid after the descriptor is closed. */
+    close(fd);
+  }
+  GRPC_SCHEDULING_END_BLOCKING_REGION_NO_EXEC_CTX;
+  if (addr == MAP_FAILED) {
+    /* Missing or empty file, or a filesystem that cannot be mapped: take
+       the copying path, which also produces the error for the caller. */
+    return grpc_load_file(filename, 0, output);
+  }
+  /* Large payloads are typically written out from the front, so let the
+     kernel read ahead aggressively instead of faulting page by page. */
+  madvise(addr, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+  *output = grpc_slice_new_with_len(addr, static_cast<size_t>(st.st_size),
+                                    unmap_file_slice);
+  return GRPC_ERROR_NONE;
+}
+
+#else /* GRPC_POSIX_SOCKET */
+
+grpc_error_handle grpc_load_file_mmap(const char* filename,
+                                      grpc_slice* output) {
+  return grpc_load_file(filename, 0, output);
+}
+
+#endif /* GRPC_POSIX_SOCKET */
@@ -32,4 +32,14 @@
 grpc_error_handle grpc_load_file(const char* filename, int add_null_terminator,
                                  grpc_slice* output);
 
+/* Loads the content of a file into a slice by mapping the file into memory
+   rather than copying it, with the kernel advised of sequential access;
+   intended for large payloads (e.g. file artifacts served over streaming
+   calls) where the copy and the page-cache double-buffering matter. The
+   mapping is released when the last reference to the slice is dropped.
+   Falls back to grpc_load_file on platforms without mmap, for empty files,
+   and for filesystems that cannot be mapped. */
+grpc_error_handle grpc_load_file_mmap(const char* filename,
+                                      grpc_slice* output);
+
 #endif /* GRPC_CORE_LIB_IOMGR_LOAD_FILE_H */
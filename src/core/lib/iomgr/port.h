@@ -52,10 +52,32 @@
 /* Linux has TCP_INQ support since 4.18, but it is safe to set
    the socket option on older kernels. */
 #define GRPC_HAVE_TCP_INQ 1
+/* Linux has TCP_NOTSENT_LOWAT and the SIOCOUTQNSD ioctl since 3.12;
+   setting the option on older kernels fails harmlessly. */
+#define GRPC_HAVE_TCP_NOTSENT_LOWAT 1
+/* Linux reports the CPU that is delivering a socket's packets via
+   SO_INCOMING_CPU since 3.19; querying it on older kernels fails
+   harmlessly. */
+#define GRPC_HAVE_SO_INCOMING_CPU 1
 #ifdef LINUX_VERSION_CODE
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
 #define GRPC_LINUX_ERRQUEUE 1
 #endif /* LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0) */
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 18, 0)
+#define GRPC_LINUX_TCP_ZEROCOPY_RECEIVE 1
+/* UDP generic segmentation offload on the send path (UDP_SEGMENT). */
+#define GRPC_LINUX_UDP_SEGMENT 1
+#endif /* LINUX_VERSION_CODE >= KERNEL_VERSION(4, 18, 0) */
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 0, 0)
+/* UDP generic receive offload (UDP_GRO): the kernel coalesces trains of
+   datagrams from the same flow into a single large payload. */
+#define GRPC_LINUX_UDP_GRO 1
+#endif /* LINUX_VERSION_CODE >= KERNEL_VERSION(5, 0, 0) */
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 1, 0)
+/* io_uring headers are available; actual kernel support is probed at
+   runtime. */
+#define GRPC_LINUX_IO_URING 1
+#endif /* LINUX_VERSION_CODE >= KERNEL_VERSION(5, 1, 0) */
 #endif /* LINUX_VERSION_CODE */
 #define GRPC_LINUX_MULTIPOLL_WITH_EPOLL 1
 #define GRPC_POSIX_FORK 1
@@ -25,6 +25,7 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <algorithm>
 #include <string>
 
 #include "absl/strings/str_cat.h"
@@ -34,7 +35,10 @@
 #include <grpc/support/log.h>
 
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gpr/spinlock.h"
 #include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/iomgr/combiner.h"
 #include "src/core/lib/slice/slice_internal.h"
 
@@ -42,6 +46,13 @@ grpc_core::TraceFlag grpc_resource_quota_trace(false, "resource_quota");
 
 #define MEMORY_USAGE_ESTIMATION_MAX 65536
 
+/* Size of the per-user free-pool cache, in bytes. Quota refills grant this
+   much beyond a user's immediate deficit (when the quota can spare it), and
+   a user's pool is published back to the quota once it grows past twice this
+   amount, so the steady alloc/free cycle of a connection's read buffers
+   stays out of the quota combiner. */
+#define GRPC_RU_FREE_POOL_CACHE_SIZE 32768
+
 /* Internal linked list pointers for a resource user */
 struct grpc_resource_user_link {
   grpc_resource_user* next;
@@ -346,8 +357,13 @@ static bool rq_alloc(grpc_resource_quota* resource_quota) {
     }
     if (resource_user->free_pool < 0 &&
         -resource_user->free_pool <= resource_quota->free_pool) {
-      int64_t amt = -resource_user->free_pool;
-      resource_user->free_pool = 0;
+      /* Grant the deficit plus a cache batch, as far as the quota can spare
+         it, so this user's next allocations are satisfied without another
+         combiner hop. */
+      int64_t amt = std::min<int64_t>(
+          -resource_user->free_pool + GRPC_RU_FREE_POOL_CACHE_SIZE,
+          resource_quota->free_pool);
+      resource_user->free_pool += amt;
       resource_quota->free_pool -= amt;
       rq_update_estimate(resource_quota);
       if (GRPC_TRACE_FLAG_ENABLED(grpc_resource_quota_trace)) {
@@ -441,38 +457,128 @@ static bool rq_reclaim(grpc_resource_quota* resource_quota, bool destructive) {
 
 namespace grpc_core {
 
+class RuSliceRefcount;
+
+// A small pool of read slices recycled between reads on the same slice
+// allocator, so that steady-state ingest reuses a handful of buffers instead
+// of churning an allocation per read. Pooled slices keep their quota debit;
+// the pool is bounded so idle transports hold back at most
+// kMaxEntries * read-chunk-size bytes. The pool is shared (via refcount)
+// with the refcounts of the slices it has handed out, because the last
+// reference to a read slice may be dropped on any thread, including after
+// the owning allocator has been destroyed.
+class RuSlicePool : public RefCounted<RuSlicePool> {
+ public:
+  static constexpr size_t kMaxEntries = 16;
+
+  // Accepts a slice refcount whose last reference was just dropped. Returns
+  // false if the pool is closed or full, in which case the caller frees the
+  // refcount as usual.
+  bool Return(RuSliceRefcount* rc);
+  // Removes and returns a pooled refcount of exactly \a size bytes, or
+  // nullptr if none is available.
+  RuSliceRefcount* Take(size_t size);
+  // Rejects future returns and moves the pooled entries (at most
+  // kMaxEntries) into \a entries, returning how many there were. Called
+  // while the resource user is still alive so the entries' quota debits can
+  // be returned.
+  size_t Close(RuSliceRefcount** entries);
+
+ private:
+  gpr_spinlock lock_ = GPR_SPINLOCK_INITIALIZER;
+  bool closed_ = false;
+  size_t count_ = 0;
+  RuSliceRefcount* entries_[kMaxEntries];
+};
+
+constexpr size_t RuSlicePool::kMaxEntries;
+
 class RuSliceRefcount {
  public:
   static void Destroy(void* p) {
     auto* rc = static_cast<RuSliceRefcount*>(p);
+    // Read slices go back to their allocator's pool for the next read; the
+    // quota debit stays with the refcount until it is finally freed.
+    if (rc->pool_ != nullptr && rc->pool_->Return(rc)) return;
     rc->~RuSliceRefcount();
     gpr_free(rc);
   }
-  RuSliceRefcount(grpc_resource_user* resource_user, size_t size)
+  RuSliceRefcount(grpc_resource_user* resource_user, size_t size,
+                  RefCountedPtr<RuSlicePool> pool)
       : base_(grpc_slice_refcount::Type::REGULAR, &refs_, Destroy, this,
               &base_),
         resource_user_(resource_user),
-        size_(size) {
+        size_(size),
+        pool_(std::move(pool)) {
     // Nothing to do here.
   }
   ~RuSliceRefcount() { grpc_resource_user_free(resource_user_, size_); }
 
   grpc_slice_refcount* base_refcount() { return &base_; }
+  size_t size() const { return size_; }
+  // Re-arms a refcount taken from the pool (where it sat with zero refs) so
+  // the slice can be handed out again.
+  void Reuse() { refs_.Ref(); }
 
  private:
   grpc_slice_refcount base_;
   RefCount refs_;
   grpc_resource_user* resource_user_;
   size_t size_;
+  RefCountedPtr<RuSlicePool> pool_;
 };
 
+bool RuSlicePool::Return(RuSliceRefcount* rc) {
+  gpr_spinlock_lock(&lock_);
+  if (closed_ || count_ == kMaxEntries) {
+    gpr_spinlock_unlock(&lock_);
+    return false;
+  }
+  entries_[count_++] = rc;
+  gpr_spinlock_unlock(&lock_);
+  return true;
+}
+
+RuSliceRefcount* RuSlicePool::Take(size_t size) {
+  gpr_spinlock_lock(&lock_);
+  for (size_t i = 0; i < count_; i++) {
+    if (entries_[i]->size() == size) {
+      RuSliceRefcount* rc = entries_[i];
+      entries_[i] = entries_[--count_];
+      gpr_spinlock_unlock(&lock_);
+      return rc;
+    }
+  }
+  gpr_spinlock_unlock(&lock_);
+  return nullptr;
+}
+
+size_t RuSlicePool::Close(RuSliceRefcount** entries) {
+  gpr_spinlock_lock(&lock_);
+  closed_ = true;
+  size_t count = count_;
+  for (size_t i = 0; i < count; i++) entries[i] = entries_[i];
+  count_ = 0;
+  gpr_spinlock_unlock(&lock_);
+  return count;
+}
+
 }  // namespace grpc_core
 
-static grpc_slice ru_slice_create(grpc_resource_user* resource_user,
+static grpc_slice ru_slice_create(grpc_slice_allocator* slice_allocator,
                                   size_t size) {
-  auto* rc = static_cast<grpc_core::RuSliceRefcount*>(
-      gpr_malloc(sizeof(grpc_core::RuSliceRefcount) + size));
-  new (rc) grpc_core::RuSliceRefcount(resource_user, size);
+  grpc_core::RuSliceRefcount* rc = slice_allocator->slice_pool->Take(size);
+  if (rc != nullptr) {
+    // A pooled slice still carries its original quota debit, so hand back
+    // the duplicate debit taken for this request.
+    grpc_resource_user_free(slice_allocator->resource_user, size);
+    rc->Reuse();
+  } else {
+    rc = static_cast<grpc_core::RuSliceRefcount*>(
+        gpr_malloc(sizeof(grpc_core::RuSliceRefcount) + size));
+    new (rc) grpc_core::RuSliceRefcount(slice_allocator->resource_user, size,
+                                        slice_allocator->slice_pool->Ref());
+  }
   grpc_slice slice;
 
   slice.refcount = rc->base_refcount();
@@ -603,8 +709,8 @@ static void ru_destroy(void* ru, grpc_error_handle /*error*/) {
 static void ru_alloc_slices(grpc_slice_allocator* slice_allocator) {
   for (size_t i = 0; i < slice_allocator->count; i++) {
     grpc_slice_buffer_add_indexed(
-        slice_allocator->dest, ru_slice_create(slice_allocator->resource_user,
-                                               slice_allocator->length));
+        slice_allocator->dest,
+        ru_slice_create(slice_allocator, slice_allocator->length));
   }
 }
 
@@ -970,8 +1076,13 @@ void grpc_resource_user_free(grpc_resource_user* resource_user, size_t size) {
             resource_user->resource_quota->name.c_str(),
             resource_user->name.c_str(), size, resource_user->free_pool);
   }
+  /* Publish the pool back to the quota when it first becomes positive (so a
+     quota under pressure can always harvest it) or once it outgrows the
+     cache bound; in between, freed bytes stay cached here for this user's
+     next allocations. */
   bool is_bigger_than_zero = resource_user->free_pool > 0;
-  if (is_bigger_than_zero && was_zero_or_negative &&
+  if (((is_bigger_than_zero && was_zero_or_negative) ||
+       resource_user->free_pool > 2 * GRPC_RU_FREE_POOL_CACHE_SIZE) &&
       !resource_user->added_to_free_pool) {
     resource_user->added_to_free_pool = true;
     resource_quota->combiner->Run(&resource_user->add_to_free_pool_closure,
@@ -1013,12 +1124,23 @@ grpc_slice_allocator* grpc_slice_allocator_create(
       {GRPC_SLICE_ALLOCATOR_MAX_ALLOCATE_SIZE, -1, INT_MAX});
   slice_allocator->resource_user =
       grpc_resource_user_create(resource_quota, name);
+  slice_allocator->slice_pool = new grpc_core::RuSlicePool();
   GRPC_CLOSURE_INIT(&slice_allocator->on_allocated, ru_allocated_slices,
                     slice_allocator, grpc_schedule_on_exec_ctx);
   return slice_allocator;
 }
 
 void grpc_slice_allocator_destroy(grpc_slice_allocator* slice_allocator) {
+  // Drain the recycled slices while the resource user can still take their
+  // quota debits back. Slices still referenced elsewhere free themselves once
+  // their last reference is dropped and the (now closed) pool rejects them.
+  grpc_core::RuSliceRefcount* drained[grpc_core::RuSlicePool::kMaxEntries];
+  size_t drained_count = slice_allocator->slice_pool->Close(drained);
+  for (size_t i = 0; i < drained_count; i++) {
+    drained[i]->~RuSliceRefcount();
+    gpr_free(drained[i]);
+  }
+  slice_allocator->slice_pool->Unref();
   ru_unref_by(slice_allocator->resource_user, 1);
   delete slice_allocator;
 }
@@ -146,6 +146,12 @@ void grpc_resource_user_post_reclaimer(grpc_resource_user* resource_user,
 /* Finish a reclamation step */
 void grpc_resource_user_finish_reclamation(grpc_resource_user* resource_user);
 
+namespace grpc_core {
+// A pool of recycled read slices shared between a slice allocator and the
+// refcounts of the slices it has handed out; defined in resource_quota.cc.
+class RuSlicePool;
+}  // namespace grpc_core
+
 /* Helper to allocate slices from a resource user */
 typedef struct grpc_slice_allocator {
   /* Closure for when a resource user allocation completes */
@@ -164,6 +170,9 @@ typedef struct grpc_slice_allocator {
   grpc_slice_buffer* dest;
   /* Parent resource user */
   grpc_resource_user* resource_user;
+  /* Pool of recycled read slices (owns one ref; slices handed out hold the
+     others) */
+  grpc_core::RuSlicePool* slice_pool;
 } grpc_slice_allocator;
 
 /// Constructs a slice allocator using configuration from \a args.
@@ -41,6 +41,25 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#if defined(GRPC_LINUX_UDP_SEGMENT) || defined(GRPC_LINUX_UDP_GRO)
+#include <netinet/udp.h>
+/* The socket options were added to the kernel before they were exported in
+   the libc headers, so define them here if the headers predate them. */
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+#endif /* GRPC_LINUX_UDP_SEGMENT || GRPC_LINUX_UDP_GRO */
+
+#ifdef GRPC_HAVE_TCP_NOTSENT_LOWAT
+/* In the kernel since 3.12; define it here if the libc headers predate it. */
+#ifndef TCP_NOTSENT_LOWAT
+#define TCP_NOTSENT_LOWAT 25
+#endif
+#endif /* GRPC_HAVE_TCP_NOTSENT_LOWAT */
+
 #include <string>
 
 #include <grpc/support/alloc.h>
@@ -67,6 +86,21 @@ grpc_error_handle grpc_set_socket_zerocopy(int fd) {
 #endif
 }
 
+/* set TCP_NOTSENT_LOWAT */
+grpc_error_handle grpc_set_socket_notsent_lowat(int fd, int lowat) {
+#ifdef GRPC_HAVE_TCP_NOTSENT_LOWAT
+  if (0 != setsockopt(fd, IPPROTO_TCP, TCP_NOTSENT_LOWAT, &lowat,
+                      sizeof(lowat))) {
+    return GRPC_OS_ERROR(errno, "setsockopt(TCP_NOTSENT_LOWAT)");
+  }
+  return GRPC_ERROR_NONE;
+#else
+  (void)fd;
+  (void)lowat;
+  return GRPC_OS_ERROR(ENOSYS, "setsockopt(TCP_NOTSENT_LOWAT)");
+#endif
+}
+
 /* set a socket to non blocking mode */
 grpc_error_handle grpc_set_socket_nonblocking(int fd, int non_blocking) {
   int oldflags = fcntl(fd, F_GETFL, 0);
@@ -134,6 +168,33 @@ grpc_error_handle grpc_set_socket_ipv6_recvpktinfo_if_possible(int fd) {
   return GRPC_ERROR_NONE;
 }
 
+grpc_error_handle grpc_set_socket_udp_gro_if_possible(int fd) {
+  // Use conditionally-important parameter to avoid warning
+  (void)fd;
+#ifdef GRPC_LINUX_UDP_GRO
+  int enable_gro = 1;
+  if (0 !=
+      setsockopt(fd, IPPROTO_UDP, UDP_GRO, &enable_gro, sizeof(enable_gro))) {
+    return GRPC_OS_ERROR(errno, "setsockopt(UDP_GRO)");
+  }
+#endif
+  return GRPC_ERROR_NONE;
+}
+
+grpc_error_handle grpc_set_socket_udp_gso_segment_if_possible(
+    int fd, int segment_size) {
+  // Use conditionally-important parameters to avoid warnings
+  (void)fd;
+  (void)segment_size;
+#ifdef GRPC_LINUX_UDP_SEGMENT
+  if (0 != setsockopt(fd, IPPROTO_UDP, UDP_SEGMENT, &segment_size,
+                      sizeof(segment_size))) {
+    return GRPC_OS_ERROR(errno, "setsockopt(UDP_SEGMENT)");
+  }
+#endif
+  return GRPC_ERROR_NONE;
+}
+
 grpc_error_handle grpc_set_socket_sndbuf(int fd, int buffer_size_bytes) {
   return 0 == setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &buffer_size_bytes,
                          sizeof(buffer_size_bytes))
@@ -248,6 +309,57 @@ grpc_error_handle grpc_set_socket_low_latency(int fd, int low_latency) {
   return GRPC_ERROR_NONE;
 }
 
+#if GPR_LINUX == 1
+/* TCP_FASTOPEN_CONNECT is available since Linux 4.11; define it for builds
+   against older kernel headers and probe at runtime. */
+#ifndef TCP_FASTOPEN_CONNECT
+#define TCP_FASTOPEN_CONNECT 30
+#endif
+#endif /* GPR_LINUX == 1 */
+
+/* enable deferred TCP Fast Open connects */
+grpc_error_handle grpc_set_socket_tcp_fastopen_connect(int fd) {
+#ifdef TCP_FASTOPEN_CONNECT
+  int val = 1;
+  if (0 != setsockopt(fd, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, &val,
+                      sizeof(val))) {
+    /* Kernel without support: silently fall back to a regular connect. */
+    if (errno == ENOPROTOOPT || errno == EINVAL) return GRPC_ERROR_NONE;
+    return GRPC_OS_ERROR(errno, "setsockopt(TCP_FASTOPEN_CONNECT)");
+  }
+#else
+  (void)fd;
+#endif
+  return GRPC_ERROR_NONE;
+}
+
+#if GPR_LINUX == 1
+/* SO_BUSY_POLL is available since Linux 3.11; define it for builds against
+   older kernel headers and probe at runtime. */
+#ifndef SO_BUSY_POLL
+#define SO_BUSY_POLL 46
+#endif
+#endif /* GPR_LINUX == 1 */
+
+/* set SO_BUSY_POLL */
+grpc_error_handle grpc_set_socket_busy_poll(int fd, int busy_poll_usec) {
+#ifdef SO_BUSY_POLL
+  if (0 != setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, &busy_poll_usec,
+                      sizeof(busy_poll_usec))) {
+    /* Kernel without support, or caller without CAP_NET_ADMIN: busy
+       polling is a latency optimization, so fall back silently. */
+    if (errno == ENOPROTOOPT || errno == EINVAL || errno == EPERM) {
+      return GRPC_ERROR_NONE;
+    }
+    return GRPC_OS_ERROR(errno, "setsockopt(SO_BUSY_POLL)");
+  }
+#else
+  (void)fd;
+  (void)busy_poll_usec;
+#endif
+  return GRPC_ERROR_NONE;
+}
+
 /* The default values for TCP_USER_TIMEOUT are currently configured to be in
  * line with the default values of KEEPALIVE_TIMEOUT as proposed in
  * https://github.com/grpc/proposal/blob/master/A18-tcp-user-timeout.md */
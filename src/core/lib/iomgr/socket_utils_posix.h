@@ -62,6 +62,10 @@ bool grpc_is_socket_reuse_port_supported();
 /* disable nagle */
 grpc_error_handle grpc_set_socket_low_latency(int fd, int low_latency);
 
+/* Set TCP_NOTSENT_LOWAT so the poller only reports the socket writable
+   while the kernel holds fewer than lowat not-yet-sent bytes. */
+grpc_error_handle grpc_set_socket_notsent_lowat(int fd, int lowat);
+
 /* set SO_REUSEPORT */
 grpc_error_handle grpc_set_socket_reuse_port(int fd, int reuse);
 
@@ -72,6 +76,16 @@ void config_default_tcp_user_timeout(bool enable, int timeout, bool is_client);
 grpc_error_handle grpc_set_socket_tcp_user_timeout(
     int fd, const grpc_channel_args* channel_args, bool is_client);
 
+/* Enable deferred TCP Fast Open connects (TCP_FASTOPEN_CONNECT). A no-op
+   (returning GRPC_ERROR_NONE) on platforms or kernels without support. */
+grpc_error_handle grpc_set_socket_tcp_fastopen_connect(int fd);
+
+/* Set SO_BUSY_POLL so the kernel busy-polls the device queue for up to
+   busy_poll_usec microseconds before sleeping in a blocking receive. A
+   no-op (returning GRPC_ERROR_NONE) on platforms or kernels without
+   support, or when the caller lacks CAP_NET_ADMIN. */
+grpc_error_handle grpc_set_socket_busy_poll(int fd, int busy_poll_usec);
+
 /* Returns true if this system can create AF_INET6 sockets bound to ::1.
    The value is probed once, and cached for the life of the process.
 
@@ -94,6 +108,20 @@ grpc_error_handle grpc_set_socket_ip_pktinfo_if_possible(int fd);
    If IPV6_RECVPKTINFO is not available, returns 1. */
 grpc_error_handle grpc_set_socket_ipv6_recvpktinfo_if_possible(int fd);
 
+/* Tries to enable UDP generic receive offload (UDP_GRO) on a UDP socket,
+   so that the kernel coalesces trains of datagrams from the same flow
+   into a single payload. Readers must consult the UDP_GRO cmsg for the
+   segment size to recover datagram boundaries. A no-op on platforms
+   without UDP_GRO support. */
+grpc_error_handle grpc_set_socket_udp_gro_if_possible(int fd);
+
+/* Tries to set the UDP generic segmentation offload segment size
+   (UDP_SEGMENT) on a UDP socket, so that a single large sendmsg() payload
+   is split into \a segment_size byte datagrams by the kernel (or the
+   NIC). A no-op on platforms without UDP_SEGMENT support. */
+grpc_error_handle grpc_set_socket_udp_gso_segment_if_possible(
+    int fd, int segment_size);
+
 /* Tries to set the socket's send buffer to given size. */
 grpc_error_handle grpc_set_socket_sndbuf(int fd, int buffer_size_bytes);
 
@@ -40,6 +40,10 @@
 #include "src/core/lib/iomgr/sockaddr_windows.h"
 #include "src/core/lib/iomgr/socket_windows.h"
 
+#ifndef WSA_FLAG_REGISTERED_IO
+#define WSA_FLAG_REGISTERED_IO 0x100
+#endif
+
 static DWORD s_wsa_socket_flags;
 
 grpc_winsocket* grpc_winsocket_create(SOCKET socket, const char* name) {
@@ -197,6 +201,15 @@ void grpc_wsa_socket_flags_init() {
     s_wsa_socket_flags |= WSA_FLAG_NO_HANDLE_INHERIT;
     closesocket(sock);
   }
+  /* WSA_FLAG_REGISTERED_IO (Windows 8 / Server 2012 or later) makes the
+     sockets usable with the registered I/O endpoint; it is harmless for
+     sockets that end up using the classic endpoint. */
+  sock = WSASocket(AF_INET6, SOCK_STREAM, IPPROTO_TCP, NULL, 0,
+                   s_wsa_socket_flags | WSA_FLAG_REGISTERED_IO);
+  if (sock != INVALID_SOCKET) {
+    s_wsa_socket_flags |= WSA_FLAG_REGISTERED_IO;
+    closesocket(sock);
+  }
 }
 
 #endif /* GRPC_WINSOCK_SOCKET */
@@ -23,6 +23,7 @@
 #ifdef GRPC_POSIX_SOCKET_TCP_CLIENT
 
 #include <errno.h>
+#include <limits.h>
 #include <netinet/in.h>
 #include <string.h>
 #include <unistd.h>
@@ -84,6 +85,20 @@ static grpc_error_handle prepare_socket(const grpc_resolved_address* addr,
     err = grpc_set_socket_tcp_user_timeout(fd, channel_args,
                                            true /* is_client */);
     if (err != GRPC_ERROR_NONE) goto error;
+    if (grpc_channel_args_find_bool(
+            channel_args, GRPC_ARG_EXPERIMENTAL_TCP_FASTOPEN_CONNECT, false)) {
+      err = grpc_set_socket_tcp_fastopen_connect(fd);
+      if (err != GRPC_ERROR_NONE) goto error;
+    }
+    {
+      int busy_poll_usec = grpc_channel_args_find_integer(
+          channel_args, GRPC_ARG_EXPERIMENTAL_TCP_BUSY_POLL_USEC,
+          {0, 0, INT_MAX});
+      if (busy_poll_usec > 0) {
+        err = grpc_set_socket_busy_poll(fd, busy_poll_usec);
+        if (err != GRPC_ERROR_NONE) goto error;
+      }
+    }
   }
   err = grpc_set_socket_no_sigpipe_if_possible(fd);
   if (err != GRPC_ERROR_NONE) goto error;
@@ -300,6 +315,13 @@ void grpc_tcp_client_create_from_prepared_fd(
   grpc_fd* fdobj = grpc_fd_create(fd, name.c_str(), true);
 
   if (err >= 0) {
+    /* Connected synchronously. This is also the normal path when
+       TCP_FASTOPEN_CONNECT is enabled: connect() succeeds immediately and
+       the kernel defers the SYN until the first write, so the handshaker's
+       ClientHello (or the HTTP/2 client preface) rides in the SYN payload
+       when a Fast Open cookie is cached. No pollset registration or
+       writability wait is needed; connection failures surface as I/O
+       errors on the endpoint. */
     *ep = grpc_tcp_client_create_from_fd(fdobj, channel_args,
                                          grpc_sockaddr_to_uri(addr).c_str(),
                                          slice_allocator);
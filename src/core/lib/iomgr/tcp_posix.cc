@@ -30,6 +30,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -85,6 +86,36 @@
 #define MSG_ZEROCOPY 0x4000000
 #endif
 
+#ifdef GRPC_HAVE_TCP_NOTSENT_LOWAT
+#include <sys/ioctl.h>
+// ioctl that reports the number of not-yet-sent bytes in the socket send
+// queue. Defined here as a fallback for older library headers, following the
+// MSG_ZEROCOPY rationale above.
+#ifndef SIOCOUTQNSD
+#define SIOCOUTQNSD 0x894B
+#endif
+#endif /* GRPC_HAVE_TCP_NOTSENT_LOWAT */
+
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+// TCP zero copy receive socket option. Defined here as a fallback for older
+// library headers, following the MSG_ZEROCOPY rationale above.
+#ifndef TCP_ZEROCOPY_RECEIVE
+#define TCP_ZEROCOPY_RECEIVE 35
+#endif
+namespace {
+// Mirrors the original (4.18) layout of the kernel's struct
+// tcp_zerocopy_receive. Defined locally so we do not need linux/tcp.h, which
+// conflicts with netinet/tcp.h above; later kernels only append fields, and
+// getsockopt dispatches on the optlen we pass.
+struct tcp_zerocopy_receive_args {
+  uint64_t address;       /* in: address of mapping */
+  uint32_t length;        /* in/out: number of bytes to map/mapped */
+  uint32_t recv_skip_hint; /* out: bytes to read via recvmsg before mapping
+                              more */
+};
+}  // namespace
+#endif /* GRPC_LINUX_TCP_ZEROCOPY_RECEIVE */
+
 #ifdef GRPC_MSG_IOVLEN_TYPE
 typedef GRPC_MSG_IOVLEN_TYPE msg_iovlen_type;
 #else
@@ -419,6 +450,19 @@ struct grpc_tcp {
                                       on errors anymore */
   TcpZerocopySendCtx tcp_zerocopy_send_ctx;
   TcpZerocopySendRecord* current_zerocopy_send = nullptr;
+
+  bool rx_zerocopy_enabled = false;
+  /* Cleared the first time the kernel rejects a zerocopy receive, so we probe
+   * at most once per endpoint. */
+  bool rx_zerocopy_capable = true;
+  size_t rx_zerocopy_read_bytes_thresh = 0;
+
+  /* TCP_NOTSENT_LOWAT value in effect on this socket, or 0 if disabled. */
+  int tx_notsent_lowat = 0;
+  /* Time the last flush stopped on socket backpressure (EAGAIN or the
+   * TCP_NOTSENT_LOWAT mark), or 0. Used to record how long the socket
+   * stayed unwritable. */
+  grpc_millis backpressured_since = 0;
 };
 
 struct backup_poller {
@@ -681,9 +725,85 @@ static void call_read_cb(grpc_tcp* tcp, grpc_error_handle error) {
   grpc_core::Closure::Run(DEBUG_LOCATION, cb, error);
 }
 
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+struct ZerocopyReceiveRegion {
+  void* addr;
+  size_t length;
+};
+
+static void tcp_zerocopy_receive_unmap(void* arg) {
+  ZerocopyReceiveRegion* region = static_cast<ZerocopyReceiveRegion*>(arg);
+  munmap(region->addr, region->length);
+  gpr_free(region);
+}
+
+/* Attempts to satisfy a large read by mapping payload pages directly out of
+ * the kernel receive queue via TCP_ZEROCOPY_RECEIVE. Returns true if the read
+ * completed (the read callback has been invoked); false to fall back to the
+ * recvmsg path with the incoming buffer untouched. */
+static bool tcp_do_zerocopy_read(grpc_tcp* tcp) {
+  static const size_t kPageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const size_t budget = tcp->incoming_buffer->length & ~(kPageSize - 1);
+  if (budget == 0) return false;
+  void* addr = mmap(nullptr, budget, PROT_READ, MAP_SHARED, tcp->fd, 0);
+  if (addr == MAP_FAILED) {
+    /* The kernel lacks TCP_ZEROCOPY_RECEIVE (or this socket cannot be
+     * mapped); do not try again on this endpoint. */
+    tcp->rx_zerocopy_capable = false;
+    return false;
+  }
+  tcp_zerocopy_receive_args zc;
+  memset(&zc, 0, sizeof(zc));
+  zc.address = reinterpret_cast<uint64_t>(addr);
+  zc.length = static_cast<uint32_t>(budget);
+  socklen_t zc_len = sizeof(zc);
+  int err;
+  do {
+    err = getsockopt(tcp->fd, SOL_TCP, TCP_ZEROCOPY_RECEIVE, &zc, &zc_len);
+  } while (err < 0 && errno == EINTR);
+  if (err < 0 || zc.length == 0) {
+    munmap(addr, budget);
+    if (err < 0 && errno != EAGAIN && errno != EIO) {
+      tcp->rx_zerocopy_capable = false;
+    }
+    return false;
+  }
+  /* Release the pages the kernel did not remap; the slice refcount owns the
+   * munmap of the rest. */
+  const size_t mapped = (zc.length + kPageSize - 1) & ~(kPageSize - 1);
+  if (mapped < budget) {
+    munmap(static_cast<char*>(addr) + mapped, budget - mapped);
+  }
+  ZerocopyReceiveRegion* region =
+      static_cast<ZerocopyReceiveRegion*>(gpr_malloc(sizeof(*region)));
+  region->addr = addr;
+  region->length = mapped;
+  grpc_slice_buffer_reset_and_unref_internal(tcp->incoming_buffer);
+  grpc_slice_buffer_add(tcp->incoming_buffer,
+                        grpc_slice_new_with_user_data(
+                            addr, zc.length, tcp_zerocopy_receive_unmap,
+                            region));
+  GRPC_STATS_INC_TCP_READ_SIZE(zc.length);
+  add_to_estimate(tcp, zc.length);
+  /* Any recv_skip_hint bytes (an unaligned tail the kernel could not remap)
+   * stay queued; the next read picks them up through recvmsg. */
+  tcp->inq = 1;
+  call_read_cb(tcp, GRPC_ERROR_NONE);
+  TCP_UNREF(tcp, "read");
+  return true;
+}
+#endif /* GRPC_LINUX_TCP_ZEROCOPY_RECEIVE */
+
 #define MAX_READ_IOVEC 4
 static void tcp_do_read(grpc_tcp* tcp) {
   GPR_TIMER_SCOPE("tcp_do_read", 0);
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+  if (tcp->rx_zerocopy_enabled && tcp->rx_zerocopy_capable &&
+      tcp->incoming_buffer->length >= tcp->rx_zerocopy_read_bytes_thresh &&
+      tcp_do_zerocopy_read(tcp)) {
+    return;
+  }
+#endif /* GRPC_LINUX_TCP_ZEROCOPY_RECEIVE */
   struct msghdr msg;
   struct iovec iov[MAX_READ_IOVEC];
   ssize_t read_bytes;
@@ -1303,6 +1423,34 @@ void TcpZerocopySendRecord::UpdateOffsetForBytesSent(size_t sending_length,
 }
 
 // returns true if done, false if pending; if returning true, *error is set
+/* Notes that a flush stopped because the kernel could not accept more data,
+ * so the time until the poller reports the socket writable again counts as
+ * socket backpressure. */
+static void tcp_note_backpressured(grpc_tcp* tcp) {
+  GRPC_STATS_INC_TCP_BACKPRESSURE_WRITES();
+  tcp->backpressured_since = grpc_core::ExecCtx::Get()->Now();
+}
+
+/* Returns true if TCP_NOTSENT_LOWAT is in effect on this socket and the
+ * kernel already holds at least that many not-yet-sent bytes. In that case we
+ * stop flushing and wait for the socket to become writable again: with the
+ * low-water mark set, the poller does not report the socket writable until
+ * the unsent backlog drains below it. */
+static bool tcp_notsent_lowat_reached(grpc_tcp* tcp) {
+#ifdef GRPC_HAVE_TCP_NOTSENT_LOWAT
+  if (tcp->tx_notsent_lowat <= 0) return false;
+  int notsent = 0;
+  if (ioctl(tcp->fd, SIOCOUTQNSD, &notsent) < 0) {
+    /* If the query fails, fall back to writing until EAGAIN. */
+    return false;
+  }
+  return notsent >= tcp->tx_notsent_lowat;
+#else
+  (void)tcp;
+  return false;
+#endif
+}
+
 static bool do_tcp_flush_zerocopy(grpc_tcp* tcp, TcpZerocopySendRecord* record,
                                   grpc_error_handle* error) {
   msg_iovlen_type iov_size;
@@ -1353,6 +1501,7 @@ static bool do_tcp_flush_zerocopy(grpc_tcp* tcp, TcpZerocopySendRecord* record,
       tcp->tcp_zerocopy_send_ctx.UndoSend();
       if (errno == EAGAIN) {
         record->UnwindIfThrottled(unwind_slice_idx, unwind_byte_idx);
+        tcp_note_backpressured(tcp);
         return false;
       } else if (errno == EPIPE) {
         *error = tcp_annotate_error(GRPC_OS_ERROR(errno, "sendmsg"), tcp);
@@ -1371,6 +1520,14 @@ static bool do_tcp_flush_zerocopy(grpc_tcp* tcp, TcpZerocopySendRecord* record,
       *error = GRPC_ERROR_NONE;
       return true;
     }
+    if (tcp_notsent_lowat_reached(tcp)) {
+      /* As with EAGAIN: wait for the poller to report the socket writable
+       * once the unsent backlog drains below the low-water mark. The record's
+       * offset already reflects the bytes sent, so there is nothing to
+       * unwind. */
+      tcp_note_backpressured(tcp);
+      return false;
+    }
   }
 }
 
@@ -1463,6 +1620,7 @@ static bool tcp_flush(grpc_tcp* tcp, grpc_error_handle* error) {
         for (size_t idx = 0; idx < unwind_slice_idx; ++idx) {
           grpc_slice_buffer_remove_first(tcp->outgoing_buffer);
         }
+        tcp_note_backpressured(tcp);
         return false;
       } else if (errno == EPIPE) {
         *error = tcp_annotate_error(GRPC_OS_ERROR(errno, "sendmsg"), tcp);
@@ -1498,6 +1656,18 @@ static bool tcp_flush(grpc_tcp* tcp, grpc_error_handle* error) {
       grpc_slice_buffer_reset_and_unref_internal(tcp->outgoing_buffer);
       return true;
     }
+    if (tcp_notsent_lowat_reached(tcp)) {
+      /* Behave as if the send queue were full: forget the slices written so
+       * far and wait for the poller to report the socket writable again,
+       * which happens once the unsent backlog drains below the low-water
+       * mark. Data not yet handed to the kernel stays in userspace, where
+       * the transport can still reprioritize it. */
+      for (size_t idx = 0; idx < outgoing_slice_idx; ++idx) {
+        grpc_slice_buffer_remove_first(tcp->outgoing_buffer);
+      }
+      tcp_note_backpressured(tcp);
+      return false;
+    }
   }
 }
 
@@ -1506,6 +1676,12 @@ static void tcp_handle_write(void* arg /* grpc_tcp */,
   grpc_tcp* tcp = static_cast<grpc_tcp*>(arg);
   grpc_closure* cb;
 
+  if (tcp->backpressured_since != 0) {
+    GRPC_STATS_INC_TCP_BACKPRESSURE_STALL_MS(grpc_core::ExecCtx::Get()->Now() -
+                                             tcp->backpressured_since);
+    tcp->backpressured_since = 0;
+  }
+
   if (error != GRPC_ERROR_NONE) {
     cb = tcp->write_cb;
     tcp->write_cb = nullptr;
@@ -1673,6 +1849,9 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
                                const char* peer_string,
                                grpc_slice_allocator* slice_allocator) {
   static constexpr bool kZerocpTxEnabledDefault = false;
+  static constexpr bool kZerocpRxEnabledDefault = false;
+  static constexpr int kZerocpRxReadBytesThreshDefault = 1024 * 1024;
+  static constexpr int kTxNotsentLowatDefault = 0;
   int tcp_read_chunk_size = GRPC_TCP_DEFAULT_READ_SLICE_SIZE;
   int tcp_max_read_chunk_size = 4 * 1024 * 1024;
   int tcp_min_read_chunk_size = 256;
@@ -1681,6 +1860,9 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
       grpc_core::TcpZerocopySendCtx::kDefaultSendBytesThreshold;
   int tcp_tx_zerocopy_max_simult_sends =
       grpc_core::TcpZerocopySendCtx::kDefaultMaxSends;
+  bool tcp_rx_zerocopy_enabled = kZerocpRxEnabledDefault;
+  int tcp_rx_zerocopy_read_bytes_thresh = kZerocpRxReadBytesThreshDefault;
+  int tcp_tx_notsent_lowat = kTxNotsentLowatDefault;
   if (channel_args != nullptr) {
     for (size_t i = 0; i < channel_args->num_args; i++) {
       if (0 ==
@@ -1715,6 +1897,21 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
             grpc_core::TcpZerocopySendCtx::kDefaultMaxSends, 0, INT_MAX};
         tcp_tx_zerocopy_max_simult_sends =
             grpc_channel_arg_get_integer(&channel_args->args[i], options);
+      } else if (0 == strcmp(channel_args->args[i].key,
+                             GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED)) {
+        tcp_rx_zerocopy_enabled = grpc_channel_arg_get_bool(
+            &channel_args->args[i], kZerocpRxEnabledDefault);
+      } else if (0 == strcmp(channel_args->args[i].key,
+                             GRPC_ARG_TCP_RX_ZEROCOPY_READ_BYTES_THRESHOLD)) {
+        grpc_integer_options options = {kZerocpRxReadBytesThreshDefault, 0,
+                                        INT_MAX};
+        tcp_rx_zerocopy_read_bytes_thresh =
+            grpc_channel_arg_get_integer(&channel_args->args[i], options);
+      } else if (0 == strcmp(channel_args->args[i].key,
+                             GRPC_ARG_TCP_TX_NOTSENT_LOWAT_BYTES)) {
+        grpc_integer_options options = {kTxNotsentLowatDefault, 0, INT_MAX};
+        tcp_tx_notsent_lowat =
+            grpc_channel_arg_get_integer(&channel_args->args[i], options);
       }
     }
   }
@@ -1757,6 +1954,14 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
   tcp->socket_ts_enabled = false;
   tcp->ts_capable = true;
   tcp->outgoing_buffer_arg = nullptr;
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+  tcp->rx_zerocopy_enabled = tcp_rx_zerocopy_enabled;
+  tcp->rx_zerocopy_read_bytes_thresh =
+      static_cast<size_t>(tcp_rx_zerocopy_read_bytes_thresh);
+#else
+  (void)tcp_rx_zerocopy_enabled;
+  (void)tcp_rx_zerocopy_read_bytes_thresh;
+#endif /* GRPC_LINUX_TCP_ZEROCOPY_RECEIVE */
   if (tcp_tx_zerocopy_enabled && !tcp->tcp_zerocopy_send_ctx.memory_limited()) {
 #ifdef GRPC_LINUX_ERRQUEUE
     const int enable = 1;
@@ -1769,6 +1974,19 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
     }
 #endif
   }
+  if (tcp_tx_notsent_lowat > 0) {
+    grpc_error_handle err =
+        grpc_set_socket_notsent_lowat(tcp->fd, tcp_tx_notsent_lowat);
+    if (err == GRPC_ERROR_NONE) {
+      tcp->tx_notsent_lowat = tcp_tx_notsent_lowat;
+    } else {
+      /* Leave the low-water mark disabled; we fall back to writing until
+       * EAGAIN, which is the historical behavior. */
+      gpr_log(GPR_ERROR, "Failed to set TCP_NOTSENT_LOWAT on the socket: %s",
+              grpc_error_std_string(err).c_str());
+      GRPC_ERROR_UNREF(err);
+    }
+  }
   /* paired with unref in grpc_tcp_destroy */
   new (&tcp->refcount) grpc_core::RefCount(
       1, GRPC_TRACE_FLAG_ENABLED(grpc_tcp_trace) ? "tcp" : nullptr);
@@ -0,0 +1,654 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_WINSOCK_SOCKET
+
+#include <limits.h>
+
+#include <mswsock.h>
+
+#include <grpc/slice_buffer.h>
+#include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
+#include <grpc/support/log_windows.h>
+
+#include "src/core/lib/address_utils/sockaddr_utils.h"
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/iomgr/iocp_windows.h"
+#include "src/core/lib/iomgr/sockaddr.h"
+#include "src/core/lib/iomgr/sockaddr_windows.h"
+#include "src/core/lib/iomgr/socket_windows.h"
+#include "src/core/lib/iomgr/tcp_rio_windows.h"
+#include "src/core/lib/iomgr/tcp_windows.h"
+#include "src/core/lib/slice/slice_internal.h"
+
+/* The RIO extension only exists in Windows 8+ SDK headers. */
+#ifdef WSAID_MULTIPLE_RIO
+
+extern grpc_core::TraceFlag grpc_tcp_trace;
+
+/* The registered region is split into fixed-size slots: a pipeline of
+   receive slots that always have a RIOReceive posted into them, and a set
+   of send slots that outgoing slices are staged through. 4x16KB per
+   direction keeps a full pipeline for typical flow-control windows while
+   pinning only 128KB per connection. */
+#define GRPC_RIO_SLOT_SIZE (16 * 1024)
+#define GRPC_RIO_RECV_SLOTS 4
+#define GRPC_RIO_SEND_SLOTS 4
+
+static RIO_EXTENSION_FUNCTION_TABLE g_rio_table;
+static bool g_rio_available = false;
+static gpr_once g_rio_once = GPR_ONCE_INIT;
+
+static void rio_load_extension_table(void) {
+  SOCKET sock = WSASocket(AF_INET6, SOCK_STREAM, IPPROTO_TCP, NULL, 0,
+                          grpc_get_default_wsa_socket_flags());
+  if (sock == INVALID_SOCKET) return;
+  GUID rio_guid = WSAID_MULTIPLE_RIO;
+  DWORD bytes = 0;
+  int status = WSAIoctl(sock, SIO_GET_MULTIPLE_EXTENSION_FUNCTION_POINTER,
+                        &rio_guid, sizeof(rio_guid), &g_rio_table,
+                        sizeof(g_rio_table), &bytes, NULL, NULL);
+  g_rio_available = (status == 0);
+  closesocket(sock);
+  if (!g_rio_available && grpc_tcp_trace.enabled()) {
+    gpr_log(GPR_INFO, "RIO extension functions unavailable: %d",
+            WSAGetLastError());
+  }
+}
+
+bool grpc_tcp_rio_available(void) {
+  gpr_once_init(&g_rio_once, rio_load_extension_table);
+  return g_rio_available;
+}
+
+typedef struct grpc_rio_recv_result {
+  ULONG slot;
+  ULONG bytes;
+  int wsa_error;
+} grpc_rio_recv_result;
+
+typedef struct grpc_tcp_rio {
+  /* This is our C++ class derivation emulation. */
+  grpc_endpoint base;
+  /* The one socket this endpoint is using. */
+  grpc_winsocket* socket;
+  /* Refcounting how many operations are in progress. */
+  gpr_refcount refcount;
+
+  grpc_closure on_recv_notify;
+  grpc_closure on_send_notify;
+
+  grpc_closure* read_cb;
+  grpc_closure* write_cb;
+  grpc_slice_buffer* read_slices;
+  grpc_slice_buffer* write_slices;
+
+  grpc_slice_allocator* slice_allocator;
+
+  RIO_RQ rq;
+  RIO_CQ recv_cq;
+  RIO_CQ send_cq;
+  RIO_BUFFERID region_id;
+  char* region;
+
+  /* Receive pipeline: slots cycle posted -> completed -> drained ->
+     reposted. Completions for a TCP socket are delivered in posted order,
+     so a ring suffices. */
+  grpc_rio_recv_result completed_recvs[GRPC_RIO_RECV_SLOTS];
+  ULONG completed_recv_head;
+  ULONG completed_recv_count;
+
+  /* Send staging: how much of write_slices is still to be enqueued, and
+     which send slots have a RIOSend in flight. */
+  size_t write_offset;
+  bool send_slot_in_flight[GRPC_RIO_SEND_SLOTS];
+  ULONG outstanding_sends;
+  int send_wsa_error;
+
+  /* The IO Completion Port runs from another thread. We need some mechanism
+     to protect ourselves when requesting a shutdown. */
+  gpr_mu mu;
+  int shutting_down;
+  grpc_error_handle shutdown_error;
+
+  std::string peer_string;
+  std::string local_address;
+} grpc_tcp_rio;
+
+static char* rio_recv_slot_ptr(grpc_tcp_rio* tcp, ULONG slot) {
+  return tcp->region + slot * GRPC_RIO_SLOT_SIZE;
+}
+
+static char* rio_send_slot_ptr(grpc_tcp_rio* tcp, ULONG slot) {
+  return tcp->region + (GRPC_RIO_RECV_SLOTS + slot) * GRPC_RIO_SLOT_SIZE;
+}
+
+static void rio_free(grpc_tcp_rio* tcp) {
+  g_rio_table.RIOCloseCompletionQueue(tcp->recv_cq);
+  g_rio_table.RIOCloseCompletionQueue(tcp->send_cq);
+  g_rio_table.RIODeregisterBuffer(tcp->region_id);
+  gpr_free(tcp->region);
+  grpc_winsocket_destroy(tcp->socket);
+  gpr_mu_destroy(&tcp->mu);
+  grpc_slice_allocator_destroy(tcp->slice_allocator);
+  if (tcp->shutting_down) GRPC_ERROR_UNREF(tcp->shutdown_error);
+  delete tcp;
+}
+
+#define RIO_TCP_UNREF(tcp, reason) rio_unref((tcp))
+#define RIO_TCP_REF(tcp, reason) rio_ref((tcp))
+static void rio_unref(grpc_tcp_rio* tcp) {
+  if (gpr_unref(&tcp->refcount)) {
+    rio_free(tcp);
+  }
+}
+
+static void rio_ref(grpc_tcp_rio* tcp) { gpr_ref(&tcp->refcount); }
+
+/* Posts a RIOReceive for \a slot. Caller must hold tcp->mu. */
+static bool rio_post_receive(grpc_tcp_rio* tcp, ULONG slot) {
+  RIO_BUF buf;
+  buf.BufferId = tcp->region_id;
+  buf.Offset = static_cast<ULONG>(slot * GRPC_RIO_SLOT_SIZE);
+  buf.Length = GRPC_RIO_SLOT_SIZE;
+  return g_rio_table.RIOReceive(tcp->rq, &buf, 1, 0,
+                                reinterpret_cast<void*>(
+                                    static_cast<uintptr_t>(slot))) == TRUE;
+}
+
+/* Re-arms the IOCP notification for the receive completion queue. The
+   notification is delivered through the socket's read_info overlapped, so
+   the regular IOCP poller wakes on_recv_notify. */
+static void rio_notify_on_recv(grpc_tcp_rio* tcp) {
+  grpc_socket_notify_on_read(tcp->socket, &tcp->on_recv_notify);
+  g_rio_table.RIONotify(tcp->recv_cq);
+}
+
+static void rio_notify_on_send(grpc_tcp_rio* tcp) {
+  grpc_socket_notify_on_write(tcp->socket, &tcp->on_send_notify);
+  g_rio_table.RIONotify(tcp->send_cq);
+}
+
+/* Moves freshly dequeued receive completions into the completed ring.
+   Caller must hold tcp->mu. Returns false if the queue was corrupted. */
+static void rio_drain_recv_cq(grpc_tcp_rio* tcp) {
+  RIORESULT results[GRPC_RIO_RECV_SLOTS];
+  ULONG n = g_rio_table.RIODequeueCompletion(tcp->recv_cq, results,
+                                             GRPC_RIO_RECV_SLOTS);
+  if (n == RIO_CORRUPT_CQ) {
+    gpr_log(GPR_ERROR, "RIODequeueCompletion: corrupt completion queue");
+    return;
+  }
+  for (ULONG i = 0; i < n; i++) {
+    ULONG idx =
+        (tcp->completed_recv_head + tcp->completed_recv_count) %
+        GRPC_RIO_RECV_SLOTS;
+    tcp->completed_recvs[idx].slot = static_cast<ULONG>(
+        reinterpret_cast<uintptr_t>(results[i].RequestContext));
+    tcp->completed_recvs[idx].bytes = results[i].BytesTransferred;
+    tcp->completed_recvs[idx].wsa_error = static_cast<int>(results[i].Status);
+    tcp->completed_recv_count++;
+  }
+}
+
+/* Copies every buffered completed receive into read_slices and reposts the
+   drained slots. Caller must hold tcp->mu. Returns the error to deliver, or
+   GRPC_ERROR_NONE with *delivered set if any bytes were produced. */
+static grpc_error_handle rio_flush_completed_recvs(grpc_tcp_rio* tcp,
+                                                   bool* delivered) {
+  *delivered = false;
+  while (tcp->completed_recv_count > 0) {
+    grpc_rio_recv_result* r = &tcp->completed_recvs[tcp->completed_recv_head];
+    if (r->wsa_error != 0) {
+      return GRPC_WSA_ERROR(r->wsa_error, "RIOReceive");
+    }
+    if (r->bytes == 0) {
+      return GRPC_ERROR_CREATE_FROM_STATIC_STRING("End of TCP stream");
+    }
+    grpc_slice slice = GRPC_SLICE_MALLOC(r->bytes);
+    memcpy(GRPC_SLICE_START_PTR(slice), rio_recv_slot_ptr(tcp, r->slot),
+           r->bytes);
+    grpc_slice_buffer_add(tcp->read_slices, slice);
+    *delivered = true;
+    if (!tcp->shutting_down && !rio_post_receive(tcp, r->slot)) {
+      return GRPC_WSA_ERROR(WSAGetLastError(), "RIOReceive");
+    }
+    tcp->completed_recv_head =
+        (tcp->completed_recv_head + 1) % GRPC_RIO_RECV_SLOTS;
+    tcp->completed_recv_count--;
+  }
+  return GRPC_ERROR_NONE;
+}
+
+/* Asynchronous callback from the IOCP: the receive CQ has entries. */
+static void rio_on_recv_notify(void* tcpp, grpc_error_handle error) {
+  grpc_tcp_rio* tcp = (grpc_tcp_rio*)tcpp;
+  grpc_closure* cb = nullptr;
+  grpc_error_handle cb_error = GRPC_ERROR_REF(error);
+
+  gpr_mu_lock(&tcp->mu);
+  rio_drain_recv_cq(tcp);
+  if (tcp->read_cb != nullptr) {
+    if (cb_error == GRPC_ERROR_NONE && tcp->shutting_down) {
+      cb_error = GRPC_ERROR_CREATE_REFERENCING_FROM_STATIC_STRING(
+          "TCP stream shutting down", &tcp->shutdown_error, 1);
+    }
+    if (cb_error == GRPC_ERROR_NONE) {
+      bool delivered = false;
+      cb_error = rio_flush_completed_recvs(tcp, &delivered);
+      if (cb_error == GRPC_ERROR_NONE && !delivered) {
+        /* Spurious wakeup (e.g. notify raced a previous drain): keep
+           waiting. */
+        rio_notify_on_recv(tcp);
+        gpr_mu_unlock(&tcp->mu);
+        return;
+      }
+    }
+    if (cb_error != GRPC_ERROR_NONE) {
+      grpc_slice_buffer_reset_and_unref_internal(tcp->read_slices);
+    }
+    cb = tcp->read_cb;
+    tcp->read_cb = nullptr;
+  }
+  gpr_mu_unlock(&tcp->mu);
+
+  if (cb != nullptr) {
+    RIO_TCP_UNREF(tcp, "read");
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, cb, cb_error);
+  } else {
+    GRPC_ERROR_UNREF(cb_error);
+  }
+}
+
+static void win_rio_read(grpc_endpoint* ep, grpc_slice_buffer* read_slices,
+                         grpc_closure* cb, bool urgent) {
+  grpc_tcp_rio* tcp = (grpc_tcp_rio*)ep;
+
+  if (grpc_tcp_trace.enabled()) {
+    gpr_log(GPR_INFO, "TCP:%p win_rio_read", tcp);
+  }
+
+  gpr_mu_lock(&tcp->mu);
+  if (tcp->shutting_down) {
+    gpr_mu_unlock(&tcp->mu);
+    grpc_core::ExecCtx::Run(
+        DEBUG_LOCATION, cb,
+        GRPC_ERROR_CREATE_REFERENCING_FROM_STATIC_STRING(
+            "TCP socket is shutting down", &tcp->shutdown_error, 1));
+    return;
+  }
+
+  tcp->read_slices = read_slices;
+  grpc_slice_buffer_reset_and_unref_internal(read_slices);
+
+  /* The receive pipeline runs ahead of read requests, so data may already
+     be buffered in completed slots. */
+  rio_drain_recv_cq(tcp);
+  bool delivered = false;
+  grpc_error_handle error = rio_flush_completed_recvs(tcp, &delivered);
+  if (error != GRPC_ERROR_NONE || delivered) {
+    gpr_mu_unlock(&tcp->mu);
+    if (error != GRPC_ERROR_NONE) {
+      grpc_slice_buffer_reset_and_unref_internal(read_slices);
+    }
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, cb, error);
+    return;
+  }
+
+  /* Nothing buffered: wait for the next completion. */
+  tcp->read_cb = cb;
+  RIO_TCP_REF(tcp, "read");
+  rio_notify_on_recv(tcp);
+  gpr_mu_unlock(&tcp->mu);
+}
+
+/* Stages as much of write_slices as fits into free send slots and enqueues
+   RIOSends for it. Caller must hold tcp->mu. Returns false on submission
+   failure (send_wsa_error is set). */
+static bool rio_continue_write(grpc_tcp_rio* tcp) {
+  while (tcp->write_offset < tcp->write_slices->length &&
+         tcp->outstanding_sends < GRPC_RIO_SEND_SLOTS) {
+    ULONG slot = 0;
+    while (slot < GRPC_RIO_SEND_SLOTS && tcp->send_slot_in_flight[slot]) {
+      slot++;
+    }
+    GPR_ASSERT(slot < GRPC_RIO_SEND_SLOTS);
+    char* dst = rio_send_slot_ptr(tcp, slot);
+    size_t staged = 0;
+    /* Flatten slice data into the registered slot. */
+    size_t remaining_offset = tcp->write_offset;
+    for (size_t i = 0; i < tcp->write_slices->count; i++) {
+      if (staged == GRPC_RIO_SLOT_SIZE) break;
+      grpc_slice* s = &tcp->write_slices->slices[i];
+      size_t len = GRPC_SLICE_LENGTH(*s);
+      if (remaining_offset >= len) {
+        remaining_offset -= len;
+        continue;
+      }
+      size_t copy = len - remaining_offset;
+      if (copy > GRPC_RIO_SLOT_SIZE - staged) {
+        copy = GRPC_RIO_SLOT_SIZE - staged;
+      }
+      memcpy(dst + staged, GRPC_SLICE_START_PTR(*s) + remaining_offset, copy);
+      staged += copy;
+      remaining_offset = 0;
+    }
+    RIO_BUF buf;
+    buf.BufferId = tcp->region_id;
+    buf.Offset = static_cast<ULONG>(
+        (GRPC_RIO_RECV_SLOTS + slot) * GRPC_RIO_SLOT_SIZE);
+    buf.Length = static_cast<ULONG>(staged);
+    if (g_rio_table.RIOSend(tcp->rq, &buf, 1, 0,
+                            reinterpret_cast<void*>(
+                                static_cast<uintptr_t>(slot))) != TRUE) {
+      tcp->send_wsa_error = WSAGetLastError();
+      return false;
+    }
+    tcp->write_offset += staged;
+    tcp->send_slot_in_flight[slot] = true;
+    tcp->outstanding_sends++;
+  }
+  return true;
+}
+
+/* Asynchronous callback from the IOCP: the send CQ has entries. */
+static void rio_on_send_notify(void* tcpp, grpc_error_handle error) {
+  grpc_tcp_rio* tcp = (grpc_tcp_rio*)tcpp;
+  grpc_closure* cb = nullptr;
+  grpc_error_handle cb_error = GRPC_ERROR_REF(error);
+
+  gpr_mu_lock(&tcp->mu);
+  RIORESULT results[GRPC_RIO_SEND_SLOTS];
+  ULONG n = g_rio_table.RIODequeueCompletion(tcp->send_cq, results,
+                                             GRPC_RIO_SEND_SLOTS);
+  if (n != RIO_CORRUPT_CQ) {
+    for (ULONG i = 0; i < n; i++) {
+      ULONG slot = static_cast<ULONG>(
+          reinterpret_cast<uintptr_t>(results[i].RequestContext));
+      tcp->send_slot_in_flight[slot] = false;
+      tcp->outstanding_sends--;
+      if (results[i].Status != 0 && tcp->send_wsa_error == 0) {
+        tcp->send_wsa_error = static_cast<int>(results[i].Status);
+      }
+    }
+  }
+  if (tcp->write_cb != nullptr) {
+    if (cb_error == GRPC_ERROR_NONE && tcp->send_wsa_error != 0) {
+      cb_error = GRPC_WSA_ERROR(tcp->send_wsa_error, "RIOSend");
+    }
+    if (cb_error == GRPC_ERROR_NONE) {
+      if (!rio_continue_write(tcp)) {
+        cb_error = GRPC_WSA_ERROR(tcp->send_wsa_error, "RIOSend");
+      } else if (tcp->write_offset < tcp->write_slices->length ||
+                 tcp->outstanding_sends > 0) {
+        /* More rounds to go: wait for further completions. */
+        rio_notify_on_send(tcp);
+        gpr_mu_unlock(&tcp->mu);
+        GRPC_ERROR_UNREF(cb_error);
+        return;
+      }
+    }
+    cb = tcp->write_cb;
+    tcp->write_cb = nullptr;
+  }
+  gpr_mu_unlock(&tcp->mu);
+
+  if (cb != nullptr) {
+    RIO_TCP_UNREF(tcp, "write");
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, cb, cb_error);
+  } else {
+    GRPC_ERROR_UNREF(cb_error);
+  }
+}
+
+static void win_rio_write(grpc_endpoint* ep, grpc_slice_buffer* slices,
+                          grpc_closure* cb, void* arg) {
+  grpc_tcp_rio* tcp = (grpc_tcp_rio*)ep;
+
+  if (grpc_tcp_trace.enabled()) {
+    gpr_log(GPR_INFO, "TCP:%p win_rio_write %" PRIuPTR " bytes", tcp,
+            slices->length);
+  }
+
+  gpr_mu_lock(&tcp->mu);
+  if (tcp->shutting_down) {
+    gpr_mu_unlock(&tcp->mu);
+    grpc_core::ExecCtx::Run(
+        DEBUG_LOCATION, cb,
+        GRPC_ERROR_CREATE_REFERENCING_FROM_STATIC_STRING(
+            "TCP socket is shutting down", &tcp->shutdown_error, 1));
+    return;
+  }
+
+  tcp->write_slices = slices;
+  tcp->write_offset = 0;
+  tcp->send_wsa_error = 0;
+  if (!rio_continue_write(tcp)) {
+    int wsa_error = tcp->send_wsa_error;
+    gpr_mu_unlock(&tcp->mu);
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, cb,
+                            GRPC_WSA_ERROR(wsa_error, "RIOSend"));
+    return;
+  }
+  if (tcp->outstanding_sends == 0) {
+    /* Zero-length write. */
+    gpr_mu_unlock(&tcp->mu);
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, cb, GRPC_ERROR_NONE);
+    return;
+  }
+  tcp->write_cb = cb;
+  RIO_TCP_REF(tcp, "write");
+  rio_notify_on_send(tcp);
+  gpr_mu_unlock(&tcp->mu);
+}
+
+static void win_rio_add_to_pollset(grpc_endpoint* ep, grpc_pollset* ps) {
+  grpc_tcp_rio* tcp;
+  (void)ps;
+  tcp = (grpc_tcp_rio*)ep;
+  grpc_iocp_add_socket(tcp->socket);
+}
+
+static void win_rio_add_to_pollset_set(grpc_endpoint* ep,
+                                       grpc_pollset_set* pss) {
+  grpc_tcp_rio* tcp;
+  (void)pss;
+  tcp = (grpc_tcp_rio*)ep;
+  grpc_iocp_add_socket(tcp->socket);
+}
+
+static void win_rio_delete_from_pollset_set(grpc_endpoint* ep,
+                                            grpc_pollset_set* pss) {}
+
+static void win_rio_shutdown(grpc_endpoint* ep, grpc_error_handle why) {
+  grpc_tcp_rio* tcp = (grpc_tcp_rio*)ep;
+  gpr_mu_lock(&tcp->mu);
+  if (!tcp->shutting_down) {
+    tcp->shutting_down = 1;
+    tcp->shutdown_error = why;
+  } else {
+    GRPC_ERROR_UNREF(why);
+  }
+  grpc_winsocket_shutdown(tcp->socket);
+  gpr_mu_unlock(&tcp->mu);
+}
+
+static void win_rio_destroy(grpc_endpoint* ep) {
+  grpc_tcp_rio* tcp = (grpc_tcp_rio*)ep;
+  RIO_TCP_UNREF(tcp, "destroy");
+}
+
+static absl::string_view win_rio_get_peer(grpc_endpoint* ep) {
+  grpc_tcp_rio* tcp = (grpc_tcp_rio*)ep;
+  return tcp->peer_string;
+}
+
+static absl::string_view win_rio_get_local_address(grpc_endpoint* ep) {
+  grpc_tcp_rio* tcp = (grpc_tcp_rio*)ep;
+  return tcp->local_address;
+}
+
+static int win_rio_get_fd(grpc_endpoint* ep) { return -1; }
+
+static bool win_rio_can_track_err(grpc_endpoint* ep) { return false; }
+
+static grpc_endpoint_vtable rio_vtable = {win_rio_read,
+                                          win_rio_write,
+                                          win_rio_add_to_pollset,
+                                          win_rio_add_to_pollset_set,
+                                          win_rio_delete_from_pollset_set,
+                                          win_rio_shutdown,
+                                          win_rio_destroy,
+                                          win_rio_get_peer,
+                                          win_rio_get_local_address,
+                                          win_rio_get_fd,
+                                          win_rio_can_track_err};
+
+grpc_endpoint* grpc_tcp_rio_create(grpc_winsocket* socket,
+                                   const char* peer_string,
+                                   grpc_slice_allocator* slice_allocator) {
+  if (!grpc_tcp_rio_available()) return nullptr;
+
+  grpc_tcp_rio* tcp = new grpc_tcp_rio;
+  tcp->base.vtable = &rio_vtable;
+  tcp->socket = socket;
+  tcp->read_cb = nullptr;
+  tcp->write_cb = nullptr;
+  tcp->read_slices = nullptr;
+  tcp->write_slices = nullptr;
+  tcp->completed_recv_head = 0;
+  tcp->completed_recv_count = 0;
+  tcp->write_offset = 0;
+  for (ULONG slot = 0; slot < GRPC_RIO_SEND_SLOTS; slot++) {
+    tcp->send_slot_in_flight[slot] = false;
+  }
+  tcp->outstanding_sends = 0;
+  tcp->send_wsa_error = 0;
+  tcp->shutting_down = 0;
+  tcp->shutdown_error = GRPC_ERROR_NONE;
+
+  /* Completion notifications are posted to the regular IOCP through the
+     socket's read/write overlapped structures, so the existing poller
+     dispatches them like classic overlapped completions. */
+  RIO_NOTIFICATION_COMPLETION recv_nc;
+  recv_nc.Type = RIO_IOCP_COMPLETION;
+  recv_nc.Iocp.IocpHandle = grpc_iocp_handle();
+  recv_nc.Iocp.CompletionKey = socket;
+  recv_nc.Iocp.Overlapped = &socket->read_info.overlapped;
+  tcp->recv_cq =
+      g_rio_table.RIOCreateCompletionQueue(GRPC_RIO_RECV_SLOTS, &recv_nc);
+  RIO_NOTIFICATION_COMPLETION send_nc;
+  send_nc.Type = RIO_IOCP_COMPLETION;
+  send_nc.Iocp.IocpHandle = grpc_iocp_handle();
+  send_nc.Iocp.CompletionKey = socket;
+  send_nc.Iocp.Overlapped = &socket->write_info.overlapped;
+  tcp->send_cq =
+      g_rio_table.RIOCreateCompletionQueue(GRPC_RIO_SEND_SLOTS, &send_nc);
+  if (tcp->recv_cq == RIO_INVALID_CQ || tcp->send_cq == RIO_INVALID_CQ) {
+    if (tcp->recv_cq != RIO_INVALID_CQ) {
+      g_rio_table.RIOCloseCompletionQueue(tcp->recv_cq);
+    }
+    if (tcp->send_cq != RIO_INVALID_CQ) {
+      g_rio_table.RIOCloseCompletionQueue(tcp->send_cq);
+    }
+    delete tcp;
+    return nullptr;
+  }
+
+  tcp->rq = g_rio_table.RIOCreateRequestQueue(
+      socket->socket, GRPC_RIO_RECV_SLOTS, 1, GRPC_RIO_SEND_SLOTS, 1,
+      tcp->recv_cq, tcp->send_cq, tcp);
+  const size_t region_size =
+      (GRPC_RIO_RECV_SLOTS + GRPC_RIO_SEND_SLOTS) * GRPC_RIO_SLOT_SIZE;
+  tcp->region = static_cast<char*>(gpr_malloc(region_size));
+  tcp->region_id = g_rio_table.RIORegisterBuffer(
+      tcp->region, static_cast<DWORD>(region_size));
+  if (tcp->rq == RIO_INVALID_RQ || tcp->region_id == RIO_INVALID_BUFFERID) {
+    g_rio_table.RIOCloseCompletionQueue(tcp->recv_cq);
+    g_rio_table.RIOCloseCompletionQueue(tcp->send_cq);
+    if (tcp->region_id != RIO_INVALID_BUFFERID) {
+      g_rio_table.RIODeregisterBuffer(tcp->region_id);
+    }
+    gpr_free(tcp->region);
+    delete tcp;
+    return nullptr;
+  }
+
+  gpr_mu_init(&tcp->mu);
+  gpr_ref_init(&tcp->refcount, 1);
+  GRPC_CLOSURE_INIT(&tcp->on_recv_notify, rio_on_recv_notify, tcp,
+                    grpc_schedule_on_exec_ctx);
+  GRPC_CLOSURE_INIT(&tcp->on_send_notify, rio_on_send_notify, tcp,
+                    grpc_schedule_on_exec_ctx);
+  grpc_resolved_address resolved_local_addr;
+  resolved_local_addr.len = sizeof(resolved_local_addr.addr);
+  if (getsockname(tcp->socket->socket,
+                  reinterpret_cast<sockaddr*>(resolved_local_addr.addr),
+                  &resolved_local_addr.len) < 0) {
+    tcp->local_address = "";
+  } else {
+    tcp->local_address = grpc_sockaddr_to_uri(&resolved_local_addr);
+  }
+  tcp->peer_string = peer_string;
+  tcp->slice_allocator = slice_allocator;
+
+  /* Prime the receive pipeline. */
+  for (ULONG slot = 0; slot < GRPC_RIO_RECV_SLOTS; slot++) {
+    if (!rio_post_receive(tcp, slot)) {
+      if (grpc_tcp_trace.enabled()) {
+        gpr_log(GPR_INFO, "TCP:%p RIOReceive failed at setup: %d", tcp,
+                WSAGetLastError());
+      }
+      /* The caller keeps ownership of the socket and slice allocator and
+         falls back to the classic endpoint; the request queue left on the
+         socket is released when the socket is eventually closed. */
+      g_rio_table.RIOCloseCompletionQueue(tcp->recv_cq);
+      g_rio_table.RIOCloseCompletionQueue(tcp->send_cq);
+      g_rio_table.RIODeregisterBuffer(tcp->region_id);
+      gpr_free(tcp->region);
+      gpr_mu_destroy(&tcp->mu);
+      delete tcp;
+      return nullptr;
+    }
+  }
+
+  if (grpc_tcp_trace.enabled()) {
+    gpr_log(GPR_INFO, "TCP:%p RIO endpoint created (peer=%s)", tcp,
+            peer_string);
+  }
+  return &tcp->base;
+}
+
+#else /* !WSAID_MULTIPLE_RIO */
+
+bool grpc_tcp_rio_available(void) { return false; }
+
+grpc_endpoint* grpc_tcp_rio_create(grpc_winsocket* /*socket*/,
+                                   const char* /*peer_string*/,
+                                   grpc_slice_allocator* /*slice_allocator*/) {
+  return nullptr;
+}
+
+#endif /* WSAID_MULTIPLE_RIO */
+
+#endif /* GRPC_WINSOCK_SOCKET */
@@ -0,0 +1,59 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_LIB_IOMGR_TCP_RIO_WINDOWS_H
+#define GRPC_CORE_LIB_IOMGR_TCP_RIO_WINDOWS_H
+/*
+   TCP endpoint built on Windows Registered I/O (RIO).
+
+   Unlike the classic endpoint in tcp_windows.cc, which posts one
+   WSARecv/WSASend with a fresh OVERLAPPED per operation, this endpoint
+   registers a fixed buffer region with the kernel once, keeps a pipeline of
+   receives posted into it, and drains send/receive completions in batches
+   from RIO completion queues. Completion-queue notifications are delivered
+   through the existing IOCP poller, so no extra threads are involved.
+*/
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_WINSOCK_SOCKET
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/socket_windows.h"
+
+/* Channel arg (bool): enable the registered I/O endpoint for this channel's
+   connections. Off by default; connections fall back to the classic
+   endpoint when RIO is unavailable on the running system. */
+#define GRPC_ARG_EXPERIMENTAL_WINDOWS_RIO "grpc.experimental.windows_rio"
+
+/* Returns true if the RIO extension functions are available on this
+   system (Windows 8 / Server 2012 or later). */
+bool grpc_tcp_rio_available(void);
+
+/* Create a RIO-based tcp endpoint given a winsock handle. Takes ownership
+   of the handle on success. Returns nullptr (without taking ownership) if
+   RIO resources could not be set up for this socket, in which case the
+   caller should fall back to grpc_tcp_create. */
+grpc_endpoint* grpc_tcp_rio_create(grpc_winsocket* socket,
+                                   const char* peer_string,
+                                   grpc_slice_allocator* slice_allocator);
+
+#endif
+
+#endif /* GRPC_CORE_LIB_IOMGR_TCP_RIO_WINDOWS_H */
@@ -52,6 +52,7 @@
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gprpp/memory.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/executor.h"
 #include "src/core/lib/iomgr/resolve_address.h"
 #include "src/core/lib/iomgr/sockaddr.h"
 #include "src/core/lib/iomgr/socket_utils_posix.h"
@@ -68,6 +69,7 @@ static grpc_error_handle tcp_server_create(
       static_cast<grpc_tcp_server*>(gpr_zalloc(sizeof(grpc_tcp_server)));
   s->so_reuseport = grpc_is_socket_reuse_port_supported();
   s->expand_wildcard_addrs = false;
+  s->accept_burst_size = 0;
   for (size_t i = 0; i < (args == nullptr ? 0 : args->num_args); i++) {
     if (0 == strcmp(GRPC_ARG_ALLOW_REUSEPORT, args->args[i].key)) {
       if (args->args[i].type == GRPC_ARG_INTEGER) {
@@ -88,6 +90,17 @@ static grpc_error_handle tcp_server_create(
         return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
             GRPC_ARG_EXPAND_WILDCARD_ADDRS " must be an integer");
       }
+    } else if (0 ==
+               strcmp(GRPC_ARG_TCP_SERVER_ACCEPT_BURST_SIZE,
+                      args->args[i].key)) {
+      if (args->args[i].type == GRPC_ARG_INTEGER) {
+        s->accept_burst_size = args->args[i].value.integer;
+      } else {
+        gpr_free(s);
+        grpc_slice_allocator_factory_destroy(slice_allocator_factory);
+        return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+            GRPC_ARG_TCP_SERVER_ACCEPT_BURST_SIZE " must be an integer");
+      }
     }
   }
   gpr_ref_init(&s->refs, 1);
@@ -187,10 +200,35 @@ static void tcp_server_destroy(grpc_tcp_server* s) {
   }
 }
 
+/* Pick the pollset that will be notified of reads on an accepted \a fd.
+   Where the kernel reports which CPU delivers the connection's packets
+   (SO_INCOMING_CPU), steer all connections arriving on the same CPU - and
+   therefore the same NIC RX queue - to the same pollset, so that packet
+   data, the epoll wakeup and transport parsing tend to stay on one cache
+   domain instead of shipping every packet's cache lines across the die.
+   Fall back to round-robin assignment when the kernel cannot tell us. */
+static grpc_pollset* assign_read_notifier_pollset(grpc_tcp_server* s, int fd) {
+  const size_t num_pollsets = s->pollsets->size();
+#ifdef GRPC_HAVE_SO_INCOMING_CPU
+  if (num_pollsets > 1) {
+    int cpu = -1;
+    socklen_t optlen = sizeof(cpu);
+    if (getsockopt(fd, SOL_SOCKET, SO_INCOMING_CPU, &cpu, &optlen) == 0 &&
+        cpu >= 0) {
+      return (*(s->pollsets))[static_cast<size_t>(cpu) % num_pollsets];
+    }
+  }
+#endif
+  return (*(s->pollsets))[static_cast<size_t>(gpr_atm_no_barrier_fetch_add(
+                              &s->next_pollset_to_assign, 1)) %
+                          num_pollsets];
+}
+
 /* event manager callback when reads are ready */
 static void on_read(void* arg, grpc_error_handle err) {
   grpc_tcp_listener* sp = static_cast<grpc_tcp_listener*>(arg);
   grpc_pollset* read_notifier_pollset;
+  int accepted_this_wakeup = 0;
   if (err != GRPC_ERROR_NONE) {
     goto error;
   }
@@ -253,10 +291,7 @@ static void on_read(void* arg, grpc_error_handle err) {
     std::string name = absl::StrCat("tcp-server-connection:", addr_str);
     grpc_fd* fdobj = grpc_fd_create(fd, name.c_str(), true);
 
-    read_notifier_pollset = (*(sp->server->pollsets))
-        [static_cast<size_t>(gpr_atm_no_barrier_fetch_add(
-             &sp->server->next_pollset_to_assign, 1)) %
-         sp->server->pollsets->size()];
+    read_notifier_pollset = assign_read_notifier_pollset(sp->server, fd);
 
     grpc_pollset_add_fd(read_notifier_pollset, fdobj);
 
@@ -275,6 +310,17 @@ static void on_read(void* arg, grpc_error_handle err) {
                             absl::StrCat("tcp_server_posix:", addr_str),
                             sp->server->channel_args)),
         read_notifier_pollset, acceptor);
+
+    if (sp->server->accept_burst_size > 0 &&
+        ++accepted_this_wakeup >= sp->server->accept_burst_size) {
+      /* Bound the work done per wakeup: continue draining this listener's
+         queue on an executor thread so connection setup parallelizes during
+         accept storms instead of monopolizing one pollset worker. */
+      grpc_core::Executor::Run(&sp->read_closure, GRPC_ERROR_NONE,
+                               grpc_core::ExecutorType::DEFAULT,
+                               grpc_core::ExecutorJobType::LONG);
+      return;
+    }
   }
 
   GPR_UNREACHABLE_CODE(return );
@@ -387,7 +433,7 @@ static grpc_error_handle clone_port(grpc_tcp_listener* listener,
     listener->sibling = sp;
     sp->server = listener->server;
     sp->fd = fd;
-    sp->emfd = grpc_fd_create(
+    sp->emfd = grpc_fd_create_listener(
         fd,
         absl::StrFormat("tcp-server-listener:%s/clone-%d", addr_str.c_str(), i)
             .c_str(),
@@ -603,10 +649,7 @@ class ExternalConnectionHandler : public grpc_core::TcpServerFdHandler {
     }
     std::string name = absl::StrCat("tcp-server-connection:", addr_str);
     grpc_fd* fdobj = grpc_fd_create(fd, name.c_str(), true);
-    read_notifier_pollset =
-        (*(s_->pollsets))[static_cast<size_t>(gpr_atm_no_barrier_fetch_add(
-                              &s_->next_pollset_to_assign, 1)) %
-                          s_->pollsets->size()];
+    read_notifier_pollset = assign_read_notifier_pollset(s_, fd);
     grpc_pollset_add_fd(read_notifier_pollset, fdobj);
     grpc_tcp_server_acceptor* acceptor =
         static_cast<grpc_tcp_server_acceptor*>(gpr_malloc(sizeof(*acceptor)));
@@ -70,6 +70,9 @@ struct grpc_tcp_server {
   bool so_reuseport;
   /* expand wildcard addresses to a list of all local addresses */
   bool expand_wildcard_addrs;
+  /* maximum accepts per listener wakeup before the drain continues on an
+     executor thread; 0 drains inline until EAGAIN */
+  int accept_burst_size;
 
   /* linked list of server ports */
   grpc_tcp_listener* head;
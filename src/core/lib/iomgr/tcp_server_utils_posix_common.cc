@@ -36,6 +36,7 @@
 #include <grpc/support/sync.h>
 
 #include "src/core/lib/address_utils/sockaddr_utils.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/sockaddr.h"
 #include "src/core/lib/iomgr/tcp_server_utils_posix.h"
@@ -106,7 +107,7 @@ static grpc_error_handle add_socket_to_server(grpc_tcp_server* s, int fd,
     s->tail = sp;
     sp->server = s;
     sp->fd = fd;
-    sp->emfd = grpc_fd_create(fd, name.c_str(), true);
+    sp->emfd = grpc_fd_create_listener(fd, name.c_str(), true);
     memcpy(&sp->addr, addr, sizeof(grpc_resolved_address));
     sp->port = port;
     sp->port_index = port_index;
@@ -177,6 +178,16 @@ grpc_error_handle grpc_tcp_server_prepare_socket(
     err = grpc_set_socket_tcp_user_timeout(fd, s->channel_args,
                                            false /* is_client */);
     if (err != GRPC_ERROR_NONE) goto error;
+    {
+      /* Accepted sockets inherit SO_BUSY_POLL from the listener. */
+      int busy_poll_usec = grpc_channel_args_find_integer(
+          s->channel_args, GRPC_ARG_EXPERIMENTAL_TCP_BUSY_POLL_USEC,
+          {0, 0, INT_MAX});
+      if (busy_poll_usec > 0) {
+        err = grpc_set_socket_busy_poll(fd, busy_poll_usec);
+        if (err != GRPC_ERROR_NONE) goto error;
+      }
+    }
   }
   err = grpc_set_socket_no_sigpipe_if_possible(fd);
   if (err != GRPC_ERROR_NONE) goto error;
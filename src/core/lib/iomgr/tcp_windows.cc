@@ -31,12 +31,14 @@
 #include <grpc/support/string_util.h>
 
 #include "src/core/lib/address_utils/sockaddr_utils.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/iomgr/iocp_windows.h"
 #include "src/core/lib/iomgr/sockaddr.h"
 #include "src/core/lib/iomgr/sockaddr_windows.h"
 #include "src/core/lib/iomgr/socket_windows.h"
 #include "src/core/lib/iomgr/tcp_client.h"
+#include "src/core/lib/iomgr/tcp_rio_windows.h"
 #include "src/core/lib/iomgr/tcp_windows.h"
 #include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/slice/slice_internal.h"
@@ -504,6 +506,14 @@ grpc_endpoint* grpc_tcp_create(grpc_winsocket* socket,
                                grpc_channel_args* channel_args,
                                const char* peer_string,
                                grpc_slice_allocator* slice_allocator) {
+  if (grpc_channel_args_find_bool(channel_args,
+                                  GRPC_ARG_EXPERIMENTAL_WINDOWS_RIO, false) &&
+      grpc_tcp_rio_available()) {
+    grpc_endpoint* rio =
+        grpc_tcp_rio_create(socket, peer_string, slice_allocator);
+    if (rio != nullptr) return rio;
+    /* RIO setup failed for this socket; fall back to the classic endpoint. */
+  }
   grpc_tcp* tcp = new grpc_tcp;
   memset(tcp, 0, sizeof(grpc_tcp));
   tcp->base.vtable = &vtable;
@@ -36,6 +36,10 @@ void grpc_timer_init(grpc_timer* timer, grpc_millis deadline,
 void grpc_timer_cancel(grpc_timer* timer) { grpc_timer_impl->cancel(timer); }
 
 grpc_timer_check_result grpc_timer_check(grpc_millis* next) {
+  // A null 'next' indicates a caller other than the timer manager (which
+  // always wants the next deadline back). Note the cooperative check so the
+  // manager can relax its own wakeups while such checks keep arriving.
+  if (next == nullptr) grpc_timer_manager_note_cooperative_check();
   return grpc_timer_impl->check(next);
 }
 
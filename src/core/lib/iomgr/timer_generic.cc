@@ -45,6 +45,12 @@
 #define MIN_QUEUE_WINDOW_DURATION 0.01
 #define MAX_QUEUE_WINDOW_DURATION 1.0
 
+/* Timers at least this far in the future take the lock-free insertion path.
+   Must exceed MAX_QUEUE_WINDOW_DURATION (by a comfortable margin) so that a
+   racy unlocked read of queue_deadline_cap can never classify a timer as far
+   when it actually belongs in the shard's heap. */
+#define FAR_TIMER_LEAD_MILLIS (10 * 1000)
+
 grpc_core::TraceFlag grpc_timer_trace(false, "timer");
 grpc_core::TraceFlag grpc_timer_check_trace(false, "timer_check");
 
@@ -71,6 +77,10 @@ struct timer_shard {
   grpc_timer_heap heap;
   /* This holds timers whose deadline is >= queue_deadline_cap. */
   grpc_timer list;
+  /* Lock-free stack (top == head pointer) of far-deadline timers inserted
+     without taking mu. Spliced into 'list'/'heap' by drain_far_timer_stack()
+     whenever mu is next held. Timers in this stack are chained via 'next'. */
+  gpr_atm far_timer_stack;
 };
 static size_t g_num_shards;
 
@@ -307,6 +317,26 @@ static void list_remove(grpc_timer* timer) {
   timer->prev->next = timer->next;
 }
 
+/* Splices any timers inserted through the lock-free far-deadline path into
+   the shard's regular containers. Far timers land in 'list'; the heap branch
+   is defensive, for the (unreachable by construction) case where
+   queue_deadline_cap has overtaken a stacked timer's deadline.
+   REQUIRES: shard->mu locked */
+static void drain_far_timer_stack(timer_shard* shard) {
+  grpc_timer* timer = reinterpret_cast<grpc_timer*>(
+      gpr_atm_full_xchg(&shard->far_timer_stack, static_cast<gpr_atm>(0)));
+  while (timer != nullptr) {
+    grpc_timer* next = timer->next;
+    if (timer->deadline < shard->queue_deadline_cap) {
+      grpc_timer_heap_add(&shard->heap, timer);
+    } else {
+      timer->heap_index = INVALID_HEAP_INDEX;
+      list_join(&shard->list, timer);
+    }
+    timer = next;
+  }
+}
+
 static void swap_adjacent_shards_in_queue(uint32_t first_shard_queue_index) {
   timer_shard* temp;
   temp = g_shard_queue[first_shard_queue_index];
@@ -360,6 +390,32 @@ static void timer_init(grpc_timer* timer, grpc_millis deadline,
     return;
   }
 
+  grpc_millis fast_path_now = grpc_core::ExecCtx::Get()->Now();
+  if (deadline > saturating_add(fast_path_now, FAR_TIMER_LEAD_MILLIS)) {
+    /* Far-deadline fast path: the timer cannot possibly belong in the heap
+       (queue_deadline_cap never exceeds now + MAX_QUEUE_WINDOW_DURATION), so
+       push it onto the shard's lock-free stack instead of taking shard->mu.
+       It is spliced into the overflow list the next time the shard is
+       processed, which happens well before the deadline since the shard's
+       min_deadline is never more than one queue window away. Far timers are
+       deliberately excluded from the queue-window stats: the window should
+       track the timers that actually populate the heap. */
+    timer->pending = true;
+    timer->heap_index = INVALID_HEAP_INDEX;
+    ADD_TO_HASH_TABLE(timer);
+    gpr_atm old;
+    do {
+      old = gpr_atm_acq_load(&shard->far_timer_stack);
+      timer->next = reinterpret_cast<grpc_timer*>(old);
+    } while (!gpr_atm_rel_cas(&shard->far_timer_stack, old,
+                              reinterpret_cast<gpr_atm>(timer)));
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_trace)) {
+      gpr_log(GPR_INFO, "  .. push to shard %d far-timer stack",
+              static_cast<int>(shard - g_shards));
+    }
+    return;
+  }
+
   gpr_mu_lock(&shard->mu);
   timer->pending = true;
   grpc_millis now = grpc_core::ExecCtx::Get()->Now();
@@ -446,6 +502,10 @@ static void timer_cancel(grpc_timer* timer) {
 
   timer_shard* shard = &g_shards[grpc_core::HashPointer(timer, g_num_shards)];
   gpr_mu_lock(&shard->mu);
+  /* The timer being cancelled may still be sitting in the far-deadline
+     stack; splice stacked timers into the regular containers first so the
+     list/heap removal below finds it. */
+  drain_far_timer_stack(shard);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_trace)) {
     gpr_log(GPR_INFO, "TIMER %p: CANCEL pending=%s", timer,
             timer->pending ? "true" : "false");
@@ -507,11 +567,20 @@ static bool refill_heap(timer_shard* shard, grpc_millis now) {
   return !grpc_timer_heap_is_empty(&shard->heap);
 }
 
-/* This pops the next non-cancelled timer with deadline <= now from the
-   queue, or returns NULL if there isn't one.
-   REQUIRES: shard->mu locked */
-static grpc_timer* pop_one(timer_shard* shard, grpc_millis now) {
-  grpc_timer* timer;
+/* Number of expired timers pulled from the heap per batch while firing;
+   bounds the stack footprint of pop_timers(). */
+#define TIMER_FIRE_BATCH_SIZE 32
+
+/* REQUIRES: shard->mu unlocked */
+static size_t pop_timers(timer_shard* shard, grpc_millis now,
+                         grpc_millis* new_min_deadline,
+                         grpc_error_handle error) {
+  size_t n = 0;
+  grpc_timer* fired[TIMER_FIRE_BATCH_SIZE];
+  gpr_mu_lock(&shard->mu);
+  /* Splice in lock-free insertions before refill_heap() recomputes the
+     queue window, so they are classified against the fresh cap. */
+  drain_far_timer_stack(shard);
   for (;;) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_check_trace)) {
       gpr_log(GPR_INFO, "  .. shard[%d]: heap_empty=%s",
@@ -519,38 +588,24 @@ static grpc_timer* pop_one(timer_shard* shard, grpc_millis now) {
               grpc_timer_heap_is_empty(&shard->heap) ? "true" : "false");
     }
     if (grpc_timer_heap_is_empty(&shard->heap)) {
-      if (now < shard->queue_deadline_cap) return nullptr;
-      if (!refill_heap(shard, now)) return nullptr;
+      if (now < shard->queue_deadline_cap) break;
+      if (!refill_heap(shard, now)) break;
     }
-    timer = grpc_timer_heap_top(&shard->heap);
-    if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_check_trace)) {
-      gpr_log(GPR_INFO,
-              "  .. check top timer deadline=%" PRId64 " now=%" PRId64,
-              timer->deadline, now);
-    }
-    if (timer->deadline > now) return nullptr;
-    if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_trace)) {
-      gpr_log(GPR_INFO, "TIMER %p: FIRE %" PRId64 "ms late", timer,
-              now - timer->deadline);
+    size_t popped = grpc_timer_heap_pop_expired(&shard->heap, now, fired,
+                                                GPR_ARRAY_SIZE(fired));
+    if (popped == 0) break;
+    for (size_t i = 0; i < popped; i++) {
+      grpc_timer* timer = fired[i];
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_trace)) {
+        gpr_log(GPR_INFO, "TIMER %p: FIRE %" PRId64 "ms late", timer,
+                now - timer->deadline);
+      }
+      timer->pending = false;
+      REMOVE_FROM_HASH_TABLE(timer);
+      grpc_core::ExecCtx::Run(DEBUG_LOCATION, timer->closure,
+                              GRPC_ERROR_REF(error));
+      n++;
     }
-    timer->pending = false;
-    grpc_timer_heap_pop(&shard->heap);
-    return timer;
-  }
-}
-
-/* REQUIRES: shard->mu unlocked */
-static size_t pop_timers(timer_shard* shard, grpc_millis now,
-                         grpc_millis* new_min_deadline,
-                         grpc_error_handle error) {
-  size_t n = 0;
-  grpc_timer* timer;
-  gpr_mu_lock(&shard->mu);
-  while ((timer = pop_one(shard, now))) {
-    REMOVE_FROM_HASH_TABLE(timer);
-    grpc_core::ExecCtx::Run(DEBUG_LOCATION, timer->closure,
-                            GRPC_ERROR_REF(error));
-    n++;
   }
   *new_min_deadline = compute_min_deadline(shard);
   gpr_mu_unlock(&shard->mu);
@@ -672,6 +727,13 @@ static grpc_timer_check_result timer_check(grpc_millis* next) {
     return GRPC_TIMERS_CHECKED_AND_EMPTY;
   }
 
+  /* Timers may be due: upgrade to a precise timestamp so that a coarse Now()
+     cannot delay firing decisions. (INF_FUTURE indicates iomgr shutdown and
+     must be preserved.) */
+  if (now != GRPC_MILLIS_INF_FUTURE) {
+    now = grpc_core::ExecCtx::Get()->NowPrecise();
+  }
+
   grpc_error_handle shutdown_error =
       now != GRPC_MILLIS_INF_FUTURE
           ? GRPC_ERROR_NONE
@@ -27,43 +27,63 @@
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/iomgr/port.h"
 
+/* The heap is 4-ary: the four children of a node occupy adjacent slots, so
+   one sift-down step usually reads a single cache line, and the tree is
+   half as deep as a binary heap's for the same timer count. */
+#define TIMER_HEAP_ARITY 4u
+
+#if defined(__GNUC__) || defined(__clang__)
+#define TIMER_HEAP_PREFETCH(addr) __builtin_prefetch((addr), 0 /* read */, 3)
+#else
+#define TIMER_HEAP_PREFETCH(addr) ((void)0)
+#endif
+
 /* Adjusts a heap so as to move a hole at position i closer to the root,
    until a suitable position is found for element t. Then, copies t into that
    position. This functor is called each time immediately after modifying a
    value in the underlying container, with the offset of the modified element as
    its argument. */
-static void adjust_upwards(grpc_timer** first, uint32_t i, grpc_timer* t) {
+static void adjust_upwards(grpc_timer_heap_entry* first, uint32_t i,
+                           grpc_timer_heap_entry t) {
   while (i > 0) {
-    uint32_t parent = static_cast<uint32_t>((static_cast<int>(i) - 1) / 2);
-    if (first[parent]->deadline <= t->deadline) break;
+    uint32_t parent = (i - 1u) / TIMER_HEAP_ARITY;
+    if (first[parent].deadline <= t.deadline) break;
     first[i] = first[parent];
-    first[i]->heap_index = i;
+    first[i].timer->heap_index = i;
     i = parent;
   }
   first[i] = t;
-  t->heap_index = i;
+  t.timer->heap_index = i;
 }
 
 /* Adjusts a heap so as to move a hole at position i farther away from the root,
    until a suitable position is found for element t.  Then, copies t into that
    position. */
-static void adjust_downwards(grpc_timer** first, uint32_t i, uint32_t length,
-                             grpc_timer* t) {
+static void adjust_downwards(grpc_timer_heap_entry* first, uint32_t i,
+                             uint32_t length, grpc_timer_heap_entry t) {
   for (;;) {
-    uint32_t left_child = 1u + 2u * i;
-    if (left_child >= length) break;
-    uint32_t right_child = left_child + 1;
-    uint32_t next_i = right_child < length && first[left_child]->deadline >
-                                                  first[right_child]->deadline
-                          ? right_child
-                          : left_child;
-    if (t->deadline <= first[next_i]->deadline) break;
+    uint32_t first_child = TIMER_HEAP_ARITY * i + 1u;
+    if (first_child >= length) break;
+    uint32_t end = std::min(first_child + TIMER_HEAP_ARITY, length);
+    uint32_t next_i = first_child;
+    grpc_millis min_deadline = first[first_child].deadline;
+    for (uint32_t c = first_child + 1; c < end; ++c) {
+      if (first[c].deadline < min_deadline) {
+        min_deadline = first[c].deadline;
+        next_i = c;
+      }
+    }
+    if (t.deadline <= min_deadline) break;
+    /* The next round scans the children of next_i; start pulling their
+       cache line in while this one finishes. */
+    uint32_t grandchild = TIMER_HEAP_ARITY * next_i + 1u;
+    if (grandchild < length) TIMER_HEAP_PREFETCH(&first[grandchild]);
     first[i] = first[next_i];
-    first[i]->heap_index = i;
+    first[i].timer->heap_index = i;
     i = next_i;
   }
   first[i] = t;
-  t->heap_index = i;
+  t.timer->heap_index = i;
 }
 
 #define SHRINK_MIN_ELEMS 8
@@ -73,18 +93,20 @@ static void maybe_shrink(grpc_timer_heap* heap) {
   if (heap->timer_count >= 8 &&
       heap->timer_count <= heap->timer_capacity / SHRINK_FULLNESS_FACTOR / 2) {
     heap->timer_capacity = heap->timer_count * SHRINK_FULLNESS_FACTOR;
-    heap->timers = static_cast<grpc_timer**>(
-        gpr_realloc(heap->timers, heap->timer_capacity * sizeof(grpc_timer*)));
+    heap->timers = static_cast<grpc_timer_heap_entry*>(gpr_realloc(
+        heap->timers, heap->timer_capacity * sizeof(grpc_timer_heap_entry)));
   }
 }
 
-static void note_changed_priority(grpc_timer_heap* heap, grpc_timer* timer) {
-  uint32_t i = timer->heap_index;
-  uint32_t parent = static_cast<uint32_t>((static_cast<int>(i) - 1) / 2);
-  if (heap->timers[parent]->deadline > timer->deadline) {
-    adjust_upwards(heap->timers, i, timer);
+static void note_changed_priority(grpc_timer_heap* heap,
+                                  grpc_timer_heap_entry entry) {
+  uint32_t i = entry.timer->heap_index;
+  uint32_t parent = static_cast<uint32_t>((static_cast<int>(i) - 1) /
+                                          static_cast<int>(TIMER_HEAP_ARITY));
+  if (heap->timers[parent].deadline > entry.deadline) {
+    adjust_upwards(heap->timers, i, entry);
   } else {
-    adjust_downwards(heap->timers, i, heap->timer_count, timer);
+    adjust_downwards(heap->timers, i, heap->timer_count, entry);
   }
 }
 
@@ -98,11 +120,12 @@ bool grpc_timer_heap_add(grpc_timer_heap* heap, grpc_timer* timer) {
   if (heap->timer_count == heap->timer_capacity) {
     heap->timer_capacity =
         std::max(heap->timer_capacity + 1, heap->timer_capacity * 3 / 2);
-    heap->timers = static_cast<grpc_timer**>(
-        gpr_realloc(heap->timers, heap->timer_capacity * sizeof(grpc_timer*)));
+    heap->timers = static_cast<grpc_timer_heap_entry*>(gpr_realloc(
+        heap->timers, heap->timer_capacity * sizeof(grpc_timer_heap_entry)));
   }
+  grpc_timer_heap_entry entry = {timer->deadline, timer};
   timer->heap_index = heap->timer_count;
-  adjust_upwards(heap->timers, heap->timer_count, timer);
+  adjust_upwards(heap->timers, heap->timer_count, entry);
   heap->timer_count++;
   return timer->heap_index == 0;
 }
@@ -115,7 +138,7 @@ void grpc_timer_heap_remove(grpc_timer_heap* heap, grpc_timer* timer) {
     return;
   }
   heap->timers[i] = heap->timers[heap->timer_count - 1];
-  heap->timers[i]->heap_index = i;
+  heap->timers[i].timer->heap_index = i;
   heap->timer_count--;
   maybe_shrink(heap);
   note_changed_priority(heap, heap->timers[i]);
@@ -126,9 +149,20 @@ bool grpc_timer_heap_is_empty(grpc_timer_heap* heap) {
 }
 
 grpc_timer* grpc_timer_heap_top(grpc_timer_heap* heap) {
-  return heap->timers[0];
+  return heap->timers[0].timer;
 }
 
 void grpc_timer_heap_pop(grpc_timer_heap* heap) {
   grpc_timer_heap_remove(heap, grpc_timer_heap_top(heap));
 }
+
+size_t grpc_timer_heap_pop_expired(grpc_timer_heap* heap, grpc_millis now,
+                                   grpc_timer** out, size_t max_timers) {
+  size_t n = 0;
+  while (n < max_timers && heap->timer_count > 0 &&
+         heap->timers[0].deadline <= now) {
+    out[n++] = heap->timers[0].timer;
+    grpc_timer_heap_remove(heap, heap->timers[0].timer);
+  }
+  return n;
+}
@@ -23,8 +23,17 @@
 
 #include "src/core/lib/iomgr/timer.h"
 
+/* One heap slot. The deadline is a copy of timer->deadline, taken when the
+   timer is added: deadlines are immutable while a timer sits in the heap,
+   and the copy lets sift operations compare entries within the flat array
+   instead of dereferencing each timer. */
+struct grpc_timer_heap_entry {
+  grpc_millis deadline;
+  grpc_timer* timer;
+};
+
 struct grpc_timer_heap {
-  grpc_timer** timers;
+  grpc_timer_heap_entry* timers;
   uint32_t timer_count;
   uint32_t timer_capacity;
 };
@@ -38,6 +47,13 @@ void grpc_timer_heap_remove(grpc_timer_heap* heap, grpc_timer* timer);
 grpc_timer* grpc_timer_heap_top(grpc_timer_heap* heap);
 void grpc_timer_heap_pop(grpc_timer_heap* heap);
 
+/* Pops timers with deadline <= now into out (earliest first) until the heap
+   has no more expired timers or max_timers have been stored. Returns the
+   number stored; a return value equal to max_timers means there may be
+   more. */
+size_t grpc_timer_heap_pop_expired(grpc_timer_heap* heap, grpc_millis now,
+                                   grpc_timer** out, size_t max_timers);
+
 bool grpc_timer_heap_is_empty(grpc_timer_heap* heap);
 
 #endif /* GRPC_CORE_LIB_IOMGR_TIMER_HEAP_H */
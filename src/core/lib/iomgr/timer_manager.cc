@@ -23,6 +23,7 @@
 #include <inttypes.h>
 
 #include <grpc/support/alloc.h>
+#include <grpc/support/atm.h>
 #include <grpc/support/log.h>
 
 #include "src/core/lib/debug/trace.h"
@@ -36,6 +37,15 @@ struct completed_thread {
 
 extern grpc_core::TraceFlag grpc_timer_check_trace;
 
+// A cooperative timer check (grpc_timer_check called from a pollset worker or
+// some other busy thread) stays fresh for this long. While fresh checks keep
+// arriving, the timed waiter pushes its wakeup one freshness window past the
+// next deadline and lets the cooperating threads fire timers instead.
+#define COOPERATIVE_CHECK_FRESHNESS_MILLIS 10
+// Maximum slack added to a timed wakeup so that a single wakeup fires every
+// timer due within the slack window, rather than waking once per nearby timer.
+#define MAX_WAKEUP_SLACK_MILLIS 10
+
 // global mutex
 static gpr_mu g_mu;
 // are we multi-threaded
@@ -61,6 +71,10 @@ static grpc_millis g_timed_waiter_deadline;
 static uint64_t g_timed_waiter_generation;
 // number of timer wakeups
 static uint64_t g_wakeups;
+// time of the most recent cooperative timer check by a non-timer-manager
+// thread; really a grpc_millis, accessed atomically (see the note on
+// g_shared_mutables.min_timer in timer_generic.cc for the cast rationale)
+static gpr_atm g_cooperative_check_time;
 
 static void timer_thread(void* completed_thread_ptr);
 
@@ -178,6 +192,23 @@ static bool wait_until(grpc_millis next) {
        (in which case the thread with earlier 'next' takes over as the new timed
        waiter) */
     if (next != GRPC_MILLIS_INF_FUTURE) {
+      grpc_millis now = grpc_core::ExecCtx::Get()->Now();
+      // Batch nearby expirations: pad the wakeup with a little slack so that
+      // a single wakeup fires every timer due within the slack window,
+      // instead of waking once per timer.
+      grpc_millis slack = (next - now) / 16;
+      if (slack > MAX_WAKEUP_SLACK_MILLIS) slack = MAX_WAKEUP_SLACK_MILLIS;
+      // If some other thread checked timers cooperatively a moment ago, it is
+      // very likely to check again before 'next' and fire the due timers
+      // itself; push our wakeup one freshness window past the deadline as a
+      // safety net and otherwise stay quiesced.
+      grpc_millis cooperative_check = static_cast<grpc_millis>(
+          gpr_atm_no_barrier_load(&g_cooperative_check_time));
+      if (cooperative_check != 0 &&
+          now - cooperative_check <= COOPERATIVE_CHECK_FRESHNESS_MILLIS) {
+        slack += COOPERATIVE_CHECK_FRESHNESS_MILLIS;
+      }
+      next += slack;
       if (!g_has_timed_waiter || (next < g_timed_waiter_deadline)) {
         my_timed_waiter_generation = ++g_timed_waiter_generation;
         g_has_timed_waiter = true;
@@ -307,6 +338,7 @@ void grpc_timer_manager_init(void) {
 
   g_has_timed_waiter = false;
   g_timed_waiter_deadline = GRPC_MILLIS_INF_FUTURE;
+  gpr_atm_no_barrier_store(&g_cooperative_check_time, 0);
 
   start_threads();
 }
@@ -360,4 +392,9 @@ void grpc_kick_poller(void) {
   gpr_mu_unlock(&g_mu);
 }
 
+void grpc_timer_manager_note_cooperative_check(void) {
+  gpr_atm_no_barrier_store(&g_cooperative_check_time,
+                           (gpr_atm)grpc_core::ExecCtx::Get()->Now());
+}
+
 uint64_t grpc_timer_manager_get_wakeups_testonly(void) { return g_wakeups; }
@@ -35,6 +35,10 @@ void grpc_timer_manager_set_threading(bool enabled);
 /* explicitly perform one tick of the timer system - for when threading is
  * disabled */
 void grpc_timer_manager_tick(void);
+/* record that a thread other than a timer manager thread has just checked
+ * timers; while such cooperative checks keep arriving, the timer manager
+ * relaxes its own wakeups and lets the cooperating threads fire timers */
+void grpc_timer_manager_note_cooperative_check(void);
 /* get global counter that tracks timer wakeups */
 uint64_t grpc_timer_manager_get_wakeups_testonly(void);
 
@@ -405,6 +405,18 @@ static int prepare_socket(grpc_socket_factory* socket_factory, int fd,
     }
   }
 
+  /* Enable UDP_GRO where available so that the kernel hands the handler's
+   * recvmsg() a train of coalesced datagrams per syscall. Handlers recover
+   * the datagram boundaries from the UDP_GRO cmsg. Best effort: older
+   * kernels simply leave one-datagram-per-read behavior in place. */
+  if (!grpc_is_unix_socket(addr)) {
+    grpc_error_handle gro_err = grpc_set_socket_udp_gro_if_possible(fd);
+    if (gro_err != GRPC_ERROR_NONE) {
+      gpr_log(GPR_INFO, "Failed to enable UDP_GRO on fd %d", fd);
+      GRPC_ERROR_UNREF(gro_err);
+    }
+  }
+
   if (so_reuseport && !grpc_is_unix_socket(addr) &&
       grpc_set_socket_reuse_port(fd, 1) != GRPC_ERROR_NONE) {
     gpr_log(GPR_ERROR, "Failed to set SO_REUSEPORT for fd %d", fd);
@@ -28,6 +28,7 @@
 #include <grpc/support/log.h>
 
 #include "src/core/lib/json/json.h"
+#include "src/core/lib/json/json_sax.h"
 
 #define GRPC_JSON_MAX_DEPTH 255
 #define GRPC_JSON_MAX_ERRORS 16
@@ -36,9 +37,12 @@ namespace grpc_core {
 
 namespace {
 
+// The lexer/state machine. It owns no document representation of its
+// own: every parse event is delivered to a JsonSaxHandler.
 class JsonReader {
  public:
-  static grpc_error_handle Parse(absl::string_view input, Json* output);
+  static grpc_error_handle Parse(absl::string_view input,
+                                 JsonSaxHandler* handler);
 
  private:
   enum class Status {
@@ -84,10 +88,11 @@ class JsonReader {
    */
   static constexpr uint32_t GRPC_JSON_READ_CHAR_EOF = 0x7ffffff0;
 
-  explicit JsonReader(absl::string_view input)
+  JsonReader(absl::string_view input, JsonSaxHandler* handler)
       : original_input_(reinterpret_cast<const uint8_t*>(input.data())),
         input_(original_input_),
-        remaining_input_(input.size()) {}
+        remaining_input_(input.size()),
+        handler_(handler) {}
 
   Status Run();
   uint32_t ReadChar();
@@ -98,15 +103,17 @@ class JsonReader {
   void StringAddChar(uint32_t c);
   void StringAddUtf32(uint32_t c);
 
-  Json* CreateAndLinkValue();
+  // Each of these delivers the corresponding event to the handler and
+  // returns false if the handler aborted the parse (or, for
+  // StartContainer, if the maximum nesting depth was exceeded).
   bool StartContainer(Json::Type type);
-  void EndContainer();
-  void SetKey();
-  void SetString();
+  bool EndContainer();
+  bool SetKey();
+  bool SetString();
   bool SetNumber();
-  void SetTrue();
-  void SetFalse();
-  void SetNull();
+  bool SetTrue();
+  bool SetFalse();
+  bool SetNull();
 
   const uint8_t* original_input_;
   const uint8_t* input_;
@@ -119,11 +126,12 @@ class JsonReader {
   uint16_t unicode_high_surrogate_ = 0;
   std::vector<grpc_error_handle> errors_;
   bool truncated_errors_ = false;
+  bool aborted_by_handler_ = false;
 
-  Json root_value_;
-  std::vector<Json*> stack_;
+  JsonSaxHandler* handler_;
+  // Types (OBJECT or ARRAY) of the containers we are nested in.
+  std::vector<Json::Type> stack_;
 
-  std::string key_;
   std::string string_;
 };
 
@@ -169,32 +177,6 @@ uint32_t JsonReader::ReadChar() {
   return r;
 }
 
-Json* JsonReader::CreateAndLinkValue() {
-  Json* value;
-  if (stack_.empty()) {
-    value = &root_value_;
-  } else {
-    Json* parent = stack_.back();
-    if (parent->type() == Json::Type::OBJECT) {
-      if (parent->object_value().find(key_) != parent->object_value().end()) {
-        if (errors_.size() == GRPC_JSON_MAX_ERRORS) {
-          truncated_errors_ = true;
-        } else {
-          errors_.push_back(GRPC_ERROR_CREATE_FROM_CPP_STRING(
-              absl::StrFormat("duplicate key \"%s\" at index %" PRIuPTR, key_,
-                              CurrentIndex())));
-        }
-      }
-      value = &(*parent->mutable_object())[std::move(key_)];
-    } else {
-      GPR_ASSERT(parent->type() == Json::Type::ARRAY);
-      parent->mutable_array()->emplace_back();
-      value = &parent->mutable_array()->back();
-    }
-  }
-  return value;
-}
-
 bool JsonReader::StartContainer(Json::Type type) {
   if (stack_.size() == GRPC_JSON_MAX_DEPTH) {
     if (errors_.size() == GRPC_JSON_MAX_ERRORS) {
@@ -206,53 +188,68 @@ bool JsonReader::StartContainer(Json::Type type) {
     }
     return false;
   }
-  Json* value = CreateAndLinkValue();
+  stack_.push_back(type);
+  bool ok;
   if (type == Json::Type::OBJECT) {
-    *value = Json::Object();
+    ok = handler_->OnObjectBegin();
   } else {
     GPR_ASSERT(type == Json::Type::ARRAY);
-    *value = Json::Array();
+    ok = handler_->OnArrayBegin();
   }
-  stack_.push_back(value);
-  return true;
+  if (!ok) aborted_by_handler_ = true;
+  return ok;
 }
 
-void JsonReader::EndContainer() {
+bool JsonReader::EndContainer() {
   GPR_ASSERT(!stack_.empty());
+  Json::Type type = stack_.back();
   stack_.pop_back();
+  bool ok = type == Json::Type::OBJECT ? handler_->OnObjectEnd()
+                                       : handler_->OnArrayEnd();
+  if (!ok) aborted_by_handler_ = true;
+  return ok;
 }
 
-void JsonReader::SetKey() {
-  key_ = std::move(string_);
+bool JsonReader::SetKey() {
+  bool ok = handler_->OnKey(string_);
+  if (!ok) aborted_by_handler_ = true;
   string_.clear();
+  return ok;
 }
 
-void JsonReader::SetString() {
-  Json* value = CreateAndLinkValue();
-  *value = std::move(string_);
+bool JsonReader::SetString() {
+  bool ok = handler_->OnString(string_);
+  if (!ok) aborted_by_handler_ = true;
   string_.clear();
+  return ok;
 }
 
 bool JsonReader::SetNumber() {
-  Json* value = CreateAndLinkValue();
-  *value = Json(string_, /*is_number=*/true);
+  bool ok = handler_->OnNumber(string_);
+  if (!ok) aborted_by_handler_ = true;
   string_.clear();
-  return true;
+  return ok;
 }
 
-void JsonReader::SetTrue() {
-  Json* value = CreateAndLinkValue();
-  *value = true;
+bool JsonReader::SetTrue() {
+  bool ok = handler_->OnBoolean(true);
+  if (!ok) aborted_by_handler_ = true;
   string_.clear();
+  return ok;
 }
 
-void JsonReader::SetFalse() {
-  Json* value = CreateAndLinkValue();
-  *value = false;
+bool JsonReader::SetFalse() {
+  bool ok = handler_->OnBoolean(false);
+  if (!ok) aborted_by_handler_ = true;
   string_.clear();
+  return ok;
 }
 
-void JsonReader::SetNull() { CreateAndLinkValue(); }
+bool JsonReader::SetNull() {
+  bool ok = handler_->OnNull();
+  if (!ok) aborted_by_handler_ = true;
+  return ok;
+}
 
 bool JsonReader::IsComplete() {
   return (stack_.empty() && (state_ == State::GRPC_JSON_STATE_END ||
@@ -334,10 +331,9 @@ JsonReader::Status JsonReader::Run() {
           case State::GRPC_JSON_STATE_VALUE_NUMBER_EPM:
             if (stack_.empty()) {
               return Status::GRPC_JSON_PARSE_ERROR;
-            } else if (c == '}' &&
-                       stack_.back()->type() != Json::Type::OBJECT) {
+            } else if (c == '}' && stack_.back() != Json::Type::OBJECT) {
               return Status::GRPC_JSON_PARSE_ERROR;
-            } else if (c == ']' && stack_.back()->type() != Json::Type::ARRAY) {
+            } else if (c == ']' && stack_.back() != Json::Type::ARRAY) {
               return Status::GRPC_JSON_PARSE_ERROR;
             }
             if (!SetNumber()) return Status::GRPC_JSON_PARSE_ERROR;
@@ -351,11 +347,10 @@ JsonReader::Status JsonReader::Run() {
               if (state_ != State::GRPC_JSON_STATE_VALUE_END) {
                 return Status::GRPC_JSON_PARSE_ERROR;
               }
-              if (!stack_.empty() &&
-                  stack_.back()->type() == Json::Type::OBJECT) {
+              if (!stack_.empty() && stack_.back() == Json::Type::OBJECT) {
                 state_ = State::GRPC_JSON_STATE_OBJECT_KEY_BEGIN;
               } else if (!stack_.empty() &&
-                         stack_.back()->type() == Json::Type::ARRAY) {
+                         stack_.back() == Json::Type::ARRAY) {
                 state_ = State::GRPC_JSON_STATE_VALUE_BEGIN;
               } else {
                 return Status::GRPC_JSON_PARSE_ERROR;
@@ -364,7 +359,7 @@ JsonReader::Status JsonReader::Run() {
               if (stack_.empty()) {
                 return Status::GRPC_JSON_PARSE_ERROR;
               }
-              if (c == '}' && stack_.back()->type() != Json::Type::OBJECT) {
+              if (c == '}' && stack_.back() != Json::Type::OBJECT) {
                 return Status::GRPC_JSON_PARSE_ERROR;
               }
               if (c == '}' &&
@@ -372,7 +367,7 @@ JsonReader::Status JsonReader::Run() {
                   !container_just_begun_) {
                 return Status::GRPC_JSON_PARSE_ERROR;
               }
-              if (c == ']' && stack_.back()->type() != Json::Type::ARRAY) {
+              if (c == ']' && stack_.back() != Json::Type::ARRAY) {
                 return Status::GRPC_JSON_PARSE_ERROR;
               }
               if (c == ']' && state_ == State::GRPC_JSON_STATE_VALUE_BEGIN &&
@@ -380,7 +375,7 @@ JsonReader::Status JsonReader::Run() {
                 return Status::GRPC_JSON_PARSE_ERROR;
               }
               state_ = State::GRPC_JSON_STATE_VALUE_END;
-              EndContainer();
+              if (!EndContainer()) return Status::GRPC_JSON_PARSE_ERROR;
               if (stack_.empty()) {
                 state_ = State::GRPC_JSON_STATE_END;
               }
@@ -437,7 +432,7 @@ JsonReader::Status JsonReader::Run() {
             }
             if (c == '"') {
               state_ = State::GRPC_JSON_STATE_OBJECT_KEY_END;
-              SetKey();
+              if (!SetKey()) return Status::GRPC_JSON_PARSE_ERROR;
             } else {
               if (c < 32) return Status::GRPC_JSON_PARSE_ERROR;
               StringAddChar(c);
@@ -450,7 +445,7 @@ JsonReader::Status JsonReader::Run() {
             }
             if (c == '"') {
               state_ = State::GRPC_JSON_STATE_VALUE_END;
-              SetString();
+              if (!SetString()) return Status::GRPC_JSON_PARSE_ERROR;
             } else {
               if (c < 32) return Status::GRPC_JSON_PARSE_ERROR;
               StringAddChar(c);
@@ -750,7 +745,7 @@ JsonReader::Status JsonReader::Run() {
 
           case State::GRPC_JSON_STATE_VALUE_TRUE_E:
             if (c != 'e') return Status::GRPC_JSON_PARSE_ERROR;
-            SetTrue();
+            if (!SetTrue()) return Status::GRPC_JSON_PARSE_ERROR;
             state_ = State::GRPC_JSON_STATE_VALUE_END;
             break;
 
@@ -771,7 +766,7 @@ JsonReader::Status JsonReader::Run() {
 
           case State::GRPC_JSON_STATE_VALUE_FALSE_E:
             if (c != 'e') return Status::GRPC_JSON_PARSE_ERROR;
-            SetFalse();
+            if (!SetFalse()) return Status::GRPC_JSON_PARSE_ERROR;
             state_ = State::GRPC_JSON_STATE_VALUE_END;
             break;
 
@@ -787,7 +782,7 @@ JsonReader::Status JsonReader::Run() {
 
           case State::GRPC_JSON_STATE_VALUE_NULL_L2:
             if (c != 'l') return Status::GRPC_JSON_PARSE_ERROR;
-            SetNull();
+            if (!SetNull()) return Status::GRPC_JSON_PARSE_ERROR;
             state_ = State::GRPC_JSON_STATE_VALUE_END;
             break;
 
@@ -815,8 +810,9 @@ JsonReader::Status JsonReader::Run() {
   GPR_UNREACHABLE_CODE(return Status::GRPC_JSON_INTERNAL_ERROR);
 }
 
-grpc_error_handle JsonReader::Parse(absl::string_view input, Json* output) {
-  JsonReader reader(input);
+grpc_error_handle JsonReader::Parse(absl::string_view input,
+                                    JsonSaxHandler* handler) {
+  JsonReader reader(input, handler);
   Status status = reader.Run();
   if (reader.truncated_errors_) {
     reader.errors_.push_back(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
@@ -827,22 +823,138 @@ grpc_error_handle JsonReader::Parse(absl::string_view input, Json* output) {
     reader.errors_.push_back(GRPC_ERROR_CREATE_FROM_CPP_STRING(absl::StrCat(
         "internal error in JSON parser at index ", reader.CurrentIndex())));
   } else if (status == Status::GRPC_JSON_PARSE_ERROR) {
-    reader.errors_.push_back(GRPC_ERROR_CREATE_FROM_CPP_STRING(
-        absl::StrCat("JSON parse error at index ", reader.CurrentIndex())));
+    if (reader.aborted_by_handler_) {
+      reader.errors_.push_back(GRPC_ERROR_CREATE_FROM_CPP_STRING(absl::StrCat(
+          "JSON parsing aborted by handler at index ", reader.CurrentIndex())));
+    } else {
+      reader.errors_.push_back(GRPC_ERROR_CREATE_FROM_CPP_STRING(
+          absl::StrCat("JSON parse error at index ", reader.CurrentIndex())));
+    }
   }
   if (!reader.errors_.empty()) {
     return GRPC_ERROR_CREATE_FROM_VECTOR("JSON parsing failed",
                                          &reader.errors_);
   }
-  *output = std::move(reader.root_value_);
   return GRPC_ERROR_NONE;
 }
 
+// A JsonSaxHandler that materializes the full Json tree, reproducing the
+// behavior Json::Parse() has always had, including reporting duplicate
+// object keys.
+class JsonTreeBuilder : public JsonSaxHandler {
+ public:
+  JsonTreeBuilder(Json* output, std::vector<grpc_error_handle>* errors)
+      : output_(output), errors_(errors) {}
+
+  bool OnObjectBegin() override {
+    stack_.push_back(CreateAndLinkValue());
+    *stack_.back() = Json::Object();
+    return true;
+  }
+
+  bool OnObjectEnd() override {
+    stack_.pop_back();
+    return true;
+  }
+
+  bool OnArrayBegin() override {
+    stack_.push_back(CreateAndLinkValue());
+    *stack_.back() = Json::Array();
+    return true;
+  }
+
+  bool OnArrayEnd() override {
+    stack_.pop_back();
+    return true;
+  }
+
+  bool OnKey(absl::string_view key) override {
+    key_.assign(key.data(), key.size());
+    return true;
+  }
+
+  bool OnString(absl::string_view value) override {
+    *CreateAndLinkValue() = std::string(value);
+    return true;
+  }
+
+  bool OnNumber(absl::string_view value) override {
+    *CreateAndLinkValue() = Json(std::string(value), /*is_number=*/true);
+    return true;
+  }
+
+  bool OnBoolean(bool value) override {
+    *CreateAndLinkValue() = value;
+    return true;
+  }
+
+  bool OnNull() override {
+    CreateAndLinkValue();
+    return true;
+  }
+
+  bool truncated_errors() const { return truncated_errors_; }
+
+ private:
+  Json* CreateAndLinkValue() {
+    Json* value;
+    if (stack_.empty()) {
+      value = output_;
+    } else {
+      Json* parent = stack_.back();
+      if (parent->type() == Json::Type::OBJECT) {
+        if (parent->object_value().find(key_) !=
+            parent->object_value().end()) {
+          if (errors_->size() == GRPC_JSON_MAX_ERRORS) {
+            truncated_errors_ = true;
+          } else {
+            errors_->push_back(GRPC_ERROR_CREATE_FROM_CPP_STRING(
+                absl::StrFormat("duplicate key \"%s\"", key_)));
+          }
+        }
+        value = &(*parent->mutable_object())[std::move(key_)];
+      } else {
+        GPR_ASSERT(parent->type() == Json::Type::ARRAY);
+        parent->mutable_array()->emplace_back();
+        value = &parent->mutable_array()->back();
+      }
+    }
+    return value;
+  }
+
+  Json* output_;
+  std::vector<grpc_error_handle>* errors_;
+  bool truncated_errors_ = false;
+  std::vector<Json*> stack_;
+  std::string key_;
+};
+
 }  // namespace
 
+grpc_error_handle JsonSaxParse(absl::string_view input,
+                               JsonSaxHandler* handler) {
+  return JsonReader::Parse(input, handler);
+}
+
 Json Json::Parse(absl::string_view json_str, grpc_error_handle* error) {
   Json value;
-  *error = JsonReader::Parse(json_str, &value);
+  std::vector<grpc_error_handle> errors;
+  JsonTreeBuilder builder(&value, &errors);
+  grpc_error_handle parse_error = JsonReader::Parse(json_str, &builder);
+  if (builder.truncated_errors()) {
+    errors.push_back(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+        "too many errors encountered during JSON parsing -- fix reported "
+        "errors and try again to see additional errors"));
+  }
+  if (errors.empty()) {
+    *error = parse_error;
+  } else {
+    if (parse_error != GRPC_ERROR_NONE) {
+      errors.push_back(parse_error);
+    }
+    *error = GRPC_ERROR_CREATE_FROM_VECTOR("JSON parsing failed", &errors);
+  }
+  if (*error != GRPC_ERROR_NONE) value = Json();
   return value;
 }
 
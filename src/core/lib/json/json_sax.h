@@ -0,0 +1,65 @@
+//
+// Copyright 2021 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_CORE_LIB_JSON_JSON_SAX_H
+#define GRPC_CORE_LIB_JSON_JSON_SAX_H
+
+#include <grpc/support/port_platform.h>
+
+#include "absl/strings/string_view.h"
+
+#include "src/core/lib/iomgr/error.h"
+
+namespace grpc_core {
+
+// Event-based (SAX-style) JSON parsing interface.
+//
+// Consumers that know the shape of the document they expect (e.g., a
+// service config or an xds bootstrap file) can implement this interface
+// to build their typed representation directly, without materializing
+// the intermediate Json tree that Json::Parse() produces.
+//
+// The string_views passed to OnKey(), OnString(), and OnNumber() point
+// into the parser's scratch buffer and are valid only for the duration
+// of the callback; copy them if they need to outlive it. Numbers are
+// delivered as their verbatim JSON text.
+//
+// Each callback returns true to continue the parse or false to abort
+// it; an aborted parse is reported as an error by JsonSaxParse().
+class JsonSaxHandler {
+ public:
+  virtual ~JsonSaxHandler() = default;
+
+  virtual bool OnObjectBegin() = 0;
+  virtual bool OnObjectEnd() = 0;
+  virtual bool OnArrayBegin() = 0;
+  virtual bool OnArrayEnd() = 0;
+  virtual bool OnKey(absl::string_view key) = 0;
+  virtual bool OnString(absl::string_view value) = 0;
+  virtual bool OnNumber(absl::string_view value) = 0;
+  virtual bool OnBoolean(bool value) = 0;
+  virtual bool OnNull() = 0;
+};
+
+// Parses \a input as JSON (a strict implementation of ECMA-404),
+// delivering each parse event to \a handler. Returns an error on
+// malformed input or if the handler aborts the parse.
+grpc_error_handle JsonSaxParse(absl::string_view input,
+                               JsonSaxHandler* handler);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_LIB_JSON_JSON_SAX_H
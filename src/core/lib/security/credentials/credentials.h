@@ -64,6 +64,11 @@ typedef enum {
 
 #define GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS 60
 
+/* Inside the refresh window, cached tokens are still served (with a refresh
+   running in the background) until they get this close to actually
+   expiring; after that, calls queue behind the fetch. */
+#define GRPC_SECURE_TOKEN_HARD_EXPIRY_MARGIN_SECS 30
+
 #define GRPC_COMPUTE_ENGINE_METADATA_HOST "metadata.google.internal."
 #define GRPC_COMPUTE_ENGINE_METADATA_TOKEN_PATH \
   "/computeMetadata/v1/instance/service-accounts/default/token"
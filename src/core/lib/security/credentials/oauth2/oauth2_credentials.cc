@@ -283,16 +283,40 @@ bool grpc_oauth2_token_fetcher_credentials::get_request_metadata(
   grpc_millis refresh_threshold =
       GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS * GPR_MS_PER_SEC;
   grpc_mdelem cached_access_token_md = GRPC_MDNULL;
+  bool start_prefetch = false;
   gpr_mu_lock(&mu_);
-  if (!GRPC_MDISNULL(access_token_md_) &&
-      gpr_time_cmp(
-          gpr_time_sub(token_expiration_, gpr_now(GPR_CLOCK_MONOTONIC)),
-          gpr_time_from_seconds(GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS,
+  if (!GRPC_MDISNULL(access_token_md_)) {
+    gpr_timespec remaining =
+        gpr_time_sub(token_expiration_, gpr_now(GPR_CLOCK_MONOTONIC));
+    if (gpr_time_cmp(remaining,
+                     gpr_time_from_seconds(
+                         GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS,
+                         GPR_TIMESPAN)) > 0) {
+      cached_access_token_md = GRPC_MDELEM_REF(access_token_md_);
+    } else if (gpr_time_cmp(remaining,
+                            gpr_time_from_seconds(
+                                GRPC_SECURE_TOKEN_HARD_EXPIRY_MARGIN_SECS,
                                 GPR_TIMESPAN)) > 0) {
-    cached_access_token_md = GRPC_MDELEM_REF(access_token_md_);
+      // The token is inside the refresh window but still valid: serve it
+      // and refresh in the background, so that calls never stall behind
+      // the fetch. Only once the hard expiry margin is reached do calls
+      // queue until a fresh token arrives.
+      cached_access_token_md = GRPC_MDELEM_REF(access_token_md_);
+      if (!token_fetch_pending_) {
+        token_fetch_pending_ = true;
+        start_prefetch = true;
+      }
+    }
   }
   if (!GRPC_MDISNULL(cached_access_token_md)) {
     gpr_mu_unlock(&mu_);
+    if (start_prefetch) {
+      Ref().release();
+      fetch_oauth2(grpc_credentials_metadata_request_create(this->Ref()),
+                   &httpcli_context_, &pollent_,
+                   on_oauth2_token_fetcher_http_response,
+                   grpc_core::ExecCtx::Get()->Now() + refresh_threshold);
+    }
     grpc_credentials_mdelem_array_add(md_array, cached_access_token_md);
     GRPC_MDELEM_UNREF(cached_access_token_md);
     return true;
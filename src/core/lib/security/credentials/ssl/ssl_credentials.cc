@@ -79,10 +79,12 @@ grpc_ssl_credentials::create_security_connector(
           static_cast<tsi_ssl_session_cache*>(arg->value.pointer.p);
     }
   }
+  const bool enable_early_data = grpc_channel_args_find_bool(
+      args, GRPC_ARG_EXPERIMENTAL_TLS_ENABLE_EARLY_DATA, false);
   grpc_core::RefCountedPtr<grpc_channel_security_connector> sc =
       grpc_ssl_channel_security_connector_create(
           this->Ref(), std::move(call_creds), &config_, target,
-          overridden_target_name, ssl_session_cache);
+          overridden_target_name, ssl_session_cache, enable_early_data);
   if (sc == nullptr) {
     return sc;
   }
@@ -18,6 +18,14 @@
 
 #include "src/core/lib/security/credentials/tls/grpc_tls_certificate_provider.h"
 
+#ifdef GPR_LINUX
+#include <errno.h>
+#include <limits.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
 #include <openssl/ssl.h>
 
 #include <grpc/support/alloc.h>
@@ -93,6 +101,14 @@ gpr_timespec TimeoutSecondsToDeadline(int64_t seconds) {
                       gpr_time_from_seconds(seconds, GPR_TIMESPAN));
 }
 
+// This helper function gets the last-modified time of |filename|. When failed,
+// it logs the error and returns 0.
+time_t GetModificationTime(const char* filename) {
+  time_t ts = 0;
+  absl::Status status = grpc_core::GetFileModificationTime(filename, &ts);
+  return ts;
+}
+
 }  // namespace
 
 FileWatcherCertificateProvider::FileWatcherCertificateProvider(
@@ -108,18 +124,18 @@ FileWatcherCertificateProvider::FileWatcherCertificateProvider(
   // Must be watching either root or identity certs.
   GPR_ASSERT(!private_key_path_.empty() || !root_cert_path_.empty());
   gpr_event_init(&shutdown_event_);
+  // Register for file events before the initial read, so that an update
+  // arriving in between cannot be missed.
+  StartFileEventWatch();
   ForceUpdate();
   auto thread_lambda = [](void* arg) {
     FileWatcherCertificateProvider* provider =
         static_cast<FileWatcherCertificateProvider*>(arg);
     GPR_ASSERT(provider != nullptr);
     while (true) {
-      void* value = gpr_event_wait(
-          &provider->shutdown_event_,
-          TimeoutSecondsToDeadline(provider->refresh_interval_sec_));
-      if (value != nullptr) {
+      if (provider->WaitForUpdate()) {
         return;
-      };
+      }
       provider->ForceUpdate();
     }
   };
@@ -175,10 +191,126 @@ FileWatcherCertificateProvider::~FileWatcherCertificateProvider() {
   // again after this object(provider) is destroyed.
   distributor_->SetWatchStatusCallback(nullptr);
   gpr_event_set(&shutdown_event_, reinterpret_cast<void*>(1));
+#ifdef GPR_LINUX
+  if (wakeup_fds_[1] >= 0) {
+    // Wake up the refreshing thread if it is blocked in poll().
+    char byte = 0;
+    while (write(wakeup_fds_[1], &byte, 1) < 0 && errno == EINTR) {
+    }
+  }
+#endif
   refresh_thread_.Join();
+  StopFileEventWatch();
+}
+
+void FileWatcherCertificateProvider::StartFileEventWatch() {
+#ifdef GPR_LINUX
+  inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (inotify_fd_ < 0) return;
+  if (pipe(wakeup_fds_) != 0) {
+    close(inotify_fd_);
+    inotify_fd_ = -1;
+    return;
+  }
+  // Watch the parent directories rather than the files themselves, so that
+  // atomic rotations (writing to a temporary name and renaming it over the
+  // watched file, as Kubernetes does for secret volumes) are observed even
+  // though they replace the inode.
+  auto watch_parent_directory = [this](const std::string& path) {
+    if (path.empty() || inotify_fd_ < 0) return;
+    size_t last_slash = path.rfind('/');
+    std::string directory =
+        last_slash == std::string::npos ? "." : path.substr(0, last_slash);
+    if (directory.empty()) directory = "/";
+    if (inotify_add_watch(inotify_fd_, directory.c_str(),
+                          IN_CLOSE_WRITE | IN_CREATE | IN_DELETE |
+                              IN_MOVED_FROM | IN_MOVED_TO | IN_MOVE_SELF) < 0) {
+      gpr_log(GPR_ERROR,
+              "inotify watch on %s failed; falling back to polling every %u "
+              "seconds.",
+              directory.c_str(), refresh_interval_sec_);
+      StopFileEventWatch();
+    }
+  };
+  watch_parent_directory(private_key_path_);
+  watch_parent_directory(identity_certificate_path_);
+  watch_parent_directory(root_cert_path_);
+#endif
+}
+
+void FileWatcherCertificateProvider::StopFileEventWatch() {
+#ifdef GPR_LINUX
+  if (inotify_fd_ >= 0) {
+    close(inotify_fd_);
+    inotify_fd_ = -1;
+  }
+  for (int& fd : wakeup_fds_) {
+    if (fd >= 0) {
+      close(fd);
+      fd = -1;
+    }
+  }
+#endif
+}
+
+bool FileWatcherCertificateProvider::WaitForUpdate() {
+#ifdef GPR_LINUX
+  if (inotify_fd_ >= 0) {
+    // Sleep until a file event arrives, keeping the refresh interval as a
+    // backstop in case an event is dropped (e.g. on queue overflow).
+    pollfd pfds[2];
+    pfds[0].fd = inotify_fd_;
+    pfds[0].events = POLLIN;
+    pfds[1].fd = wakeup_fds_[0];
+    pfds[1].events = POLLIN;
+    const int timeout_ms =
+        refresh_interval_sec_ > static_cast<unsigned int>(INT_MAX) / 1000
+            ? INT_MAX
+            : static_cast<int>(refresh_interval_sec_) * 1000;
+    int r;
+    do {
+      r = poll(pfds, 2, timeout_ms);
+    } while (r < 0 && errno == EINTR);
+    if (gpr_event_get(&shutdown_event_) != nullptr) return true;
+    if (r > 0 && (pfds[0].revents & POLLIN) != 0) {
+      // Drain the queued events. Their contents do not matter:
+      // ForceUpdate() re-checks the files' modification times itself, so a
+      // spurious wakeup for an unrelated file in the directory is cheap.
+      alignas(inotify_event) char buf[4096];
+      while (read(inotify_fd_, buf, sizeof(buf)) > 0) {
+      }
+    }
+    return false;
+  }
+#endif
+  return gpr_event_wait(&shutdown_event_,
+                        TimeoutSecondsToDeadline(refresh_interval_sec_)) !=
+         nullptr;
 }
 
 void FileWatcherCertificateProvider::ForceUpdate() {
+  // Check the files' modification times first and skip the read and PEM
+  // parse entirely when nothing changed since the last successful read;
+  // certificate rotations are rare relative to the refresh interval.
+  const time_t read_time = time(nullptr);
+  time_t root_cert_ts = 0;
+  time_t private_key_ts = 0;
+  time_t identity_cert_ts = 0;
+  if (!root_cert_path_.empty()) {
+    root_cert_ts = GetModificationTime(root_cert_path_.c_str());
+  }
+  if (!private_key_path_.empty()) {
+    private_key_ts = GetModificationTime(private_key_path_.c_str());
+    identity_cert_ts = GetModificationTime(identity_certificate_path_.c_str());
+  }
+  if ((root_cert_path_.empty() ||
+       (root_cert_ts != 0 && root_cert_ts == root_cert_mod_time_)) &&
+      (private_key_path_.empty() ||
+       (private_key_ts != 0 && private_key_ts == private_key_mod_time_ &&
+        identity_cert_ts != 0 &&
+        identity_cert_ts == identity_cert_mod_time_))) {
+    return;
+  }
   absl::optional<std::string> root_certificate;
   absl::optional<grpc_core::PemKeyCertPairList> pem_key_cert_pairs;
   if (!root_cert_path_.empty()) {
@@ -188,6 +320,17 @@ void FileWatcherCertificateProvider::ForceUpdate() {
     pem_key_cert_pairs = ReadIdentityKeyCertPairFromFiles(
         private_key_path_, identity_certificate_path_);
   }
+  // Only trust a timestamp once it is strictly older than the time of the
+  // read: mtime has second granularity, so a file modified in the same
+  // second we read it could change again without the timestamp moving.
+  root_cert_mod_time_ =
+      root_certificate.has_value() && root_cert_ts < read_time ? root_cert_ts
+                                                               : 0;
+  const bool identity_ts_trusted = pem_key_cert_pairs.has_value() &&
+                                   private_key_ts < read_time &&
+                                   identity_cert_ts < read_time;
+  private_key_mod_time_ = identity_ts_trusted ? private_key_ts : 0;
+  identity_cert_mod_time_ = identity_ts_trusted ? identity_cert_ts : 0;
   grpc_core::MutexLock lock(&mu_);
   const bool root_cert_changed =
       (!root_certificate.has_value() && !root_certificate_.empty()) ||
@@ -273,18 +416,6 @@ FileWatcherCertificateProvider::ReadRootCertificatesFromFile(
   return root_cert;
 }
 
-namespace {
-
-// This helper function gets the last-modified time of |filename|. When failed,
-// it logs the error and returns 0.
-time_t GetModificationTime(const char* filename) {
-  time_t ts = 0;
-  absl::Status status = grpc_core::GetFileModificationTime(filename, &ts);
-  return ts;
-}
-
-}  // namespace
-
 absl::optional<PemKeyCertPairList>
 FileWatcherCertificateProvider::ReadIdentityKeyCertPairFromFiles(
     const std::string& private_key_path,
@@ -20,6 +20,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <string.h>
+#include <time.h>
 
 #include "absl/container/inlined_vector.h"
 #include "absl/status/statusor.h"
@@ -104,8 +105,18 @@ class FileWatcherCertificateProvider final
     bool root_being_watched = false;
     bool identity_being_watched = false;
   };
-  // Force an update from the file system regardless of the interval.
+  // Re-reads the credential files and updates the distributor. Skips the
+  // read and PEM parse entirely when the modification times show that none
+  // of the watched files changed since the last successful read.
   void ForceUpdate();
+  // Sets up/tears down the inotify descriptors used to get notified about
+  // file changes without polling. No-ops on platforms without inotify.
+  void StartFileEventWatch();
+  void StopFileEventWatch();
+  // Blocks until the refresh interval elapses, one of the watched files
+  // changes (on platforms with inotify), or the provider is shut down.
+  // Returns true if the provider is shutting down.
+  bool WaitForUpdate();
   // Read the root certificates from files and update the distributor.
   absl::optional<std::string> ReadRootCertificatesFromFile(
       const std::string& root_cert_full_path);
@@ -121,6 +132,20 @@ class FileWatcherCertificateProvider final
   std::string root_cert_path_;
   unsigned int refresh_interval_sec_ = 0;
 
+  // The modification times observed at the last successful read of each
+  // file, or 0 if the last read failed or the timestamp is not yet trusted.
+  // Only accessed from the refreshing thread (and the constructor).
+  time_t root_cert_mod_time_ = 0;
+  time_t private_key_mod_time_ = 0;
+  time_t identity_cert_mod_time_ = 0;
+
+  // inotify descriptor watching the parent directories of the credential
+  // files, and a pipe used to wake up the refreshing thread on shutdown.
+  // Both stay at -1 on platforms without inotify or if setup fails, in
+  // which case the refreshing thread falls back to pure interval polling.
+  int inotify_fd_ = -1;
+  int wakeup_fds_[2] = {-1, -1};
+
   RefCountedPtr<grpc_tls_certificate_distributor> distributor_;
   grpc_core::Thread refresh_thread_;
   gpr_event shutdown_event_;
@@ -89,7 +89,7 @@ class grpc_ssl_channel_security_connector final
   grpc_security_status InitializeHandshakerFactory(
       const grpc_ssl_config* config, const char* pem_root_certs,
       const tsi_ssl_root_certs_store* root_store,
-      tsi_ssl_session_cache* ssl_session_cache) {
+      tsi_ssl_session_cache* ssl_session_cache, bool enable_early_data) {
     bool has_key_cert_pair =
         config->pem_key_cert_pair != nullptr &&
         config->pem_key_cert_pair->private_key != nullptr &&
@@ -107,6 +107,7 @@ class grpc_ssl_channel_security_connector final
     options.session_cache = ssl_session_cache;
     options.min_tls_version = grpc_get_tsi_tls_version(config->min_tls_version);
     options.max_tls_version = grpc_get_tsi_tls_version(config->max_tls_version);
+    options.enable_early_data = enable_early_data;
     const tsi_result result =
         tsi_create_ssl_client_handshaker_factory_with_options(
             &options, &client_handshaker_factory_);
@@ -405,7 +406,7 @@ grpc_ssl_channel_security_connector_create(
     grpc_core::RefCountedPtr<grpc_call_credentials> request_metadata_creds,
     const grpc_ssl_config* config, const char* target_name,
     const char* overridden_target_name,
-    tsi_ssl_session_cache* ssl_session_cache) {
+    tsi_ssl_session_cache* ssl_session_cache, bool enable_early_data) {
   if (config == nullptr || target_name == nullptr) {
     gpr_log(GPR_ERROR, "An ssl channel needs a config and a target name.");
     return nullptr;
@@ -431,7 +432,7 @@ grpc_ssl_channel_security_connector_create(
           std::move(channel_creds), std::move(request_metadata_creds), config,
           target_name, overridden_target_name);
   const grpc_security_status result = c->InitializeHandshakerFactory(
-      config, pem_root_certs, root_store, ssl_session_cache);
+      config, pem_root_certs, root_store, ssl_session_cache, enable_early_data);
   if (result != GRPC_SECURITY_OK) {
     return nullptr;
   }
@@ -411,11 +411,37 @@ void grpc_shallow_peer_destruct(tsi_peer* peer) {
   if (peer->properties != nullptr) gpr_free(peer->properties);
 }
 
+// Returns the process-wide TLS session cache shared by all client channels
+// whose credentials do not carry their own cache, or nullptr if disabled via
+// GRPC_DEFAULT_SSL_SESSION_CACHE_SIZE=0. The cache is created on first use
+// and intentionally kept alive for the life of the process so abbreviated
+// handshakes survive subchannel and channel churn (e.g. reconnect storms
+// after a rollout).
+static gpr_once g_shared_session_cache_once = GPR_ONCE_INIT;
+static tsi_ssl_session_cache* g_shared_session_cache = nullptr;
+
+static void init_shared_session_cache(void) {
+  int32_t capacity =
+      GPR_GLOBAL_CONFIG_GET(grpc_default_ssl_session_cache_size);
+  if (capacity > 0) {
+    g_shared_session_cache =
+        tsi_ssl_session_cache_create_lru(static_cast<size_t>(capacity));
+  }
+}
+
+static tsi_ssl_session_cache* grpc_ssl_shared_session_cache(void) {
+  gpr_once_init(&g_shared_session_cache_once, init_shared_session_cache);
+  return g_shared_session_cache;
+}
+
 grpc_security_status grpc_ssl_tsi_client_handshaker_factory_init(
     tsi_ssl_pem_key_cert_pair* pem_key_cert_pair, const char* pem_root_certs,
     bool skip_server_certificate_verification, tsi_tls_version min_tls_version,
     tsi_tls_version max_tls_version, tsi_ssl_session_cache* ssl_session_cache,
     tsi_ssl_client_handshaker_factory** handshaker_factory) {
+  if (ssl_session_cache == nullptr) {
+    ssl_session_cache = grpc_ssl_shared_session_cache();
+  }
   const char* root_certs;
   const tsi_ssl_root_certs_store* root_store;
   if (pem_root_certs == nullptr) {
@@ -30,3 +30,11 @@ GPR_GLOBAL_CONFIG_DEFINE_STRING(grpc_default_ssl_roots_file_path, "",
     certificates from the OS trust store. */
 GPR_GLOBAL_CONFIG_DEFINE_BOOL(grpc_not_use_system_ssl_roots, false,
                               "Disable loading system root certificates.");
+
+/** Config variable that sets the capacity (in sessions) of the process-wide
+    TLS session cache shared by client channels whose credentials do not
+    provide their own cache via GRPC_SSL_SESSION_CACHE_ARG. Set to 0 to
+    disable the shared cache and perform a full handshake per connection. */
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_default_ssl_session_cache_size, 1024,
+    "Capacity of the shared TLS session cache (0 disables it).");
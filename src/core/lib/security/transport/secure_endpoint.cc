@@ -38,7 +38,12 @@
 #include "src/core/lib/slice/slice_string_helpers.h"
 #include "src/core/tsi/transport_security_grpc.h"
 
-#define STAGING_BUFFER_SIZE 8192
+/* Staging buffers are sized adaptively between these bounds, based on the
+   amount of data being protected or unprotected in each call, so that large
+   TLS records are not fragmented across many slices and small records do not
+   pin large buffers. */
+#define MIN_STAGING_BUFFER_SIZE 8192
+#define MAX_STAGING_BUFFER_SIZE (64 * 1024)
 
 static void on_read(void* user_data, grpc_error_handle error);
 
@@ -62,6 +67,12 @@ struct secure_endpoint {
                             grpc_slice_ref_internal(leftover_slices[i]));
     }
     grpc_slice_buffer_init(&output_buffer);
+    /* The zero-copy protector moves data between slice buffers directly, so
+       the staging buffers are only needed for a frame protector. */
+    if (zero_copy_protector == nullptr) {
+      read_staging_buffer = GRPC_SLICE_MALLOC(MIN_STAGING_BUFFER_SIZE);
+      write_staging_buffer = GRPC_SLICE_MALLOC(MIN_STAGING_BUFFER_SIZE);
+    }
     gpr_ref_init(&ref, 1);
   }
 
@@ -90,9 +101,9 @@ struct secure_endpoint {
   grpc_slice_buffer source_buffer;
   /* saved handshaker leftover data to unprotect. */
   grpc_slice_buffer leftover_bytes;
-  /* buffers for read and write */
-  grpc_slice read_staging_buffer = GRPC_SLICE_MALLOC(STAGING_BUFFER_SIZE);
-  grpc_slice write_staging_buffer = GRPC_SLICE_MALLOC(STAGING_BUFFER_SIZE);
+  /* buffers for read and write; unused (empty) with a zero-copy protector */
+  grpc_slice read_staging_buffer = grpc_empty_slice();
+  grpc_slice write_staging_buffer = grpc_empty_slice();
   grpc_slice_buffer output_buffer;
 
   gpr_refcount ref;
@@ -143,10 +154,32 @@ static void secure_endpoint_unref(secure_endpoint* ep) {
 static void secure_endpoint_ref(secure_endpoint* ep) { gpr_ref(&ep->ref); }
 #endif
 
+/* Returns the staging buffer size to use for a payload of the given size:
+   the smallest power-of-two multiple of MIN_STAGING_BUFFER_SIZE that holds
+   the payload, capped at MAX_STAGING_BUFFER_SIZE. */
+static size_t staging_buffer_size_for(size_t payload_size) {
+  size_t size = MIN_STAGING_BUFFER_SIZE;
+  while (size < payload_size && size < MAX_STAGING_BUFFER_SIZE) size *= 2;
+  return size;
+}
+
+/* Sizes the staging buffer for the given payload.  Called at the start of a
+   read or write, when the staging buffer holds no data (any partial output
+   was split off and handed up by the previous call), so it also restores
+   full capacity to a buffer that was shortened by grpc_slice_split_head(). */
+static void maybe_resize_staging_buffer(grpc_slice* staging,
+                                        size_t payload_size) {
+  size_t target = staging_buffer_size_for(payload_size);
+  if (GRPC_SLICE_LENGTH(*staging) == target) return;
+  grpc_slice_unref_internal(*staging);
+  *staging = GRPC_SLICE_MALLOC(target);
+}
+
 static void flush_read_staging_buffer(secure_endpoint* ep, uint8_t** cur,
                                       uint8_t** end) {
+  size_t size = GRPC_SLICE_LENGTH(ep->read_staging_buffer);
   grpc_slice_buffer_add(ep->read_buffer, ep->read_staging_buffer);
-  ep->read_staging_buffer = GRPC_SLICE_MALLOC(STAGING_BUFFER_SIZE);
+  ep->read_staging_buffer = GRPC_SLICE_MALLOC(size);
   *cur = GRPC_SLICE_START_PTR(ep->read_staging_buffer);
   *end = GRPC_SLICE_END_PTR(ep->read_staging_buffer);
 }
@@ -171,8 +204,6 @@ static void on_read(void* user_data, grpc_error_handle error) {
   uint8_t keep_looping = 0;
   tsi_result result = TSI_OK;
   secure_endpoint* ep = static_cast<secure_endpoint*>(user_data);
-  uint8_t* cur = GRPC_SLICE_START_PTR(ep->read_staging_buffer);
-  uint8_t* end = GRPC_SLICE_END_PTR(ep->read_staging_buffer);
 
   if (error != GRPC_ERROR_NONE) {
     grpc_slice_buffer_reset_and_unref_internal(ep->read_buffer);
@@ -187,6 +218,12 @@ static void on_read(void* user_data, grpc_error_handle error) {
         ep->zero_copy_protector, &ep->source_buffer, ep->read_buffer);
   } else {
     // Use frame protector to unprotect.
+    /* Size the staging buffer for the data at hand; the decrypted output is
+       no larger than the ciphertext. */
+    maybe_resize_staging_buffer(&ep->read_staging_buffer,
+                                ep->source_buffer.length);
+    uint8_t* cur = GRPC_SLICE_START_PTR(ep->read_staging_buffer);
+    uint8_t* end = GRPC_SLICE_END_PTR(ep->read_staging_buffer);
     /* TODO(yangg) check error, maybe bail out early */
     for (i = 0; i < ep->source_buffer.count; i++) {
       grpc_slice encrypted = ep->source_buffer.slices[i];
@@ -271,8 +308,9 @@ static void endpoint_read(grpc_endpoint* secure_ep, grpc_slice_buffer* slices,
 
 static void flush_write_staging_buffer(secure_endpoint* ep, uint8_t** cur,
                                        uint8_t** end) {
+  size_t size = GRPC_SLICE_LENGTH(ep->write_staging_buffer);
   grpc_slice_buffer_add(&ep->output_buffer, ep->write_staging_buffer);
-  ep->write_staging_buffer = GRPC_SLICE_MALLOC(STAGING_BUFFER_SIZE);
+  ep->write_staging_buffer = GRPC_SLICE_MALLOC(size);
   *cur = GRPC_SLICE_START_PTR(ep->write_staging_buffer);
   *end = GRPC_SLICE_END_PTR(ep->write_staging_buffer);
 }
@@ -284,8 +322,6 @@ static void endpoint_write(grpc_endpoint* secure_ep, grpc_slice_buffer* slices,
   unsigned i;
   tsi_result result = TSI_OK;
   secure_endpoint* ep = reinterpret_cast<secure_endpoint*>(secure_ep);
-  uint8_t* cur = GRPC_SLICE_START_PTR(ep->write_staging_buffer);
-  uint8_t* end = GRPC_SLICE_END_PTR(ep->write_staging_buffer);
 
   grpc_slice_buffer_reset_and_unref_internal(&ep->output_buffer);
 
@@ -304,6 +340,12 @@ static void endpoint_write(grpc_endpoint* secure_ep, grpc_slice_buffer* slices,
                                                   slices, &ep->output_buffer);
   } else {
     // Use frame protector to protect.
+    /* Size the staging buffer for the data at hand (plus some room for the
+       protector's framing overhead). */
+    maybe_resize_staging_buffer(&ep->write_staging_buffer,
+                                slices->length + slices->length / 8);
+    uint8_t* cur = GRPC_SLICE_START_PTR(ep->write_staging_buffer);
+    uint8_t* end = GRPC_SLICE_END_PTR(ep->write_staging_buffer);
     for (i = 0; i < slices->count; i++) {
       grpc_slice plain = slices->slices[i];
       uint8_t* message_bytes = GRPC_SLICE_START_PTR(plain);
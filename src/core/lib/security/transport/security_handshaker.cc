@@ -27,13 +27,16 @@
 
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
+#include <grpc/support/sync.h>
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/channel/handshaker.h"
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/iomgr/executor/threadpool.h"
 #include "src/core/lib/security/context/security_context.h"
 #include "src/core/lib/security/transport/secure_endpoint.h"
 #include "src/core/lib/security/transport/tsi_error.h"
@@ -46,6 +49,24 @@ namespace grpc_core {
 
 namespace {
 
+// Thread pool on which tsi_handshaker_next() is run, so that handshake
+// crypto does not monopolize pollset threads during accept bursts.
+// Created lazily on the first handshake, sized by core count, and
+// intentionally never destroyed: the worker threads just sleep on the
+// queue while no handshakes are in flight.
+gpr_once g_handshake_pool_once = GPR_ONCE_INIT;
+ThreadPool* g_handshake_pool = nullptr;
+
+void HandshakePoolInit() {
+  g_handshake_pool =
+      new ThreadPool(static_cast<int>(gpr_cpu_num_cores()), "handshake");
+}
+
+ThreadPool* HandshakePool() {
+  gpr_once_init(&g_handshake_pool_once, HandshakePoolInit);
+  return g_handshake_pool;
+}
+
 class SecurityHandshaker : public Handshaker {
  public:
   SecurityHandshaker(tsi_handshaker* handshaker,
@@ -59,8 +80,19 @@ class SecurityHandshaker : public Handshaker {
   const char* name() const override { return "security"; }
 
  private:
+  // A unit of tsi_handshaker_next() work dispatched to the handshake
+  // offload pool.  Owns a ref to the handshaker until it runs.
+  struct HandshakerNextJob {
+    grpc_completion_queue_functor functor;
+    RefCountedPtr<SecurityHandshaker> handshaker;
+    size_t bytes_received_size;
+  };
+
   grpc_error_handle DoHandshakerNextLocked(const unsigned char* bytes_received,
                                            size_t bytes_received_size);
+  void OffloadHandshakerNextLocked(size_t bytes_received_size);
+  static void RunHandshakerNextJob(grpc_completion_queue_functor* functor,
+                                   int ok);
 
   grpc_error_handle OnHandshakeNextDoneLocked(
       tsi_result result, const unsigned char* bytes_to_send,
@@ -232,48 +264,54 @@ void SecurityHandshaker::OnPeerCheckedInner(grpc_error_handle error) {
     HandshakeFailedLocked(error);
     return;
   }
-  // Create zero-copy frame protector, if implemented.
-  tsi_zero_copy_grpc_protector* zero_copy_protector = nullptr;
-  tsi_result result = tsi_handshaker_result_create_zero_copy_grpc_protector(
-      handshaker_result_, max_frame_size_ == 0 ? nullptr : &max_frame_size_,
-      &zero_copy_protector);
-  if (result != TSI_OK && result != TSI_UNIMPLEMENTED) {
-    error = grpc_set_tsi_error_result(
-        GRPC_ERROR_CREATE_FROM_STATIC_STRING(
-            "Zero-copy frame protector creation failed"),
-        result);
-    HandshakeFailedLocked(error);
-    return;
-  }
-  // Create frame protector if zero-copy frame protector is NULL.
-  tsi_frame_protector* protector = nullptr;
-  if (zero_copy_protector == nullptr) {
-    result = tsi_handshaker_result_create_frame_protector(
+  // If the handshaker result offloaded traffic protection below us (e.g.
+  // kernel TLS programmed on the underlying socket), the endpoint already
+  // carries plaintext, so skip protector creation and leave the endpoint
+  // unwrapped. Such results are required not to hold unused bytes.
+  if (tsi_handshaker_result_protection_is_offloaded(handshaker_result_) == 0) {
+    // Create zero-copy frame protector, if implemented.
+    tsi_zero_copy_grpc_protector* zero_copy_protector = nullptr;
+    tsi_result result = tsi_handshaker_result_create_zero_copy_grpc_protector(
         handshaker_result_, max_frame_size_ == 0 ? nullptr : &max_frame_size_,
-        &protector);
-    if (result != TSI_OK) {
-      error = grpc_set_tsi_error_result(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
-                                            "Frame protector creation failed"),
-                                        result);
+        &zero_copy_protector);
+    if (result != TSI_OK && result != TSI_UNIMPLEMENTED) {
+      error = grpc_set_tsi_error_result(
+          GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+              "Zero-copy frame protector creation failed"),
+          result);
       HandshakeFailedLocked(error);
       return;
     }
-  }
-  // Get unused bytes.
-  const unsigned char* unused_bytes = nullptr;
-  size_t unused_bytes_size = 0;
-  result = tsi_handshaker_result_get_unused_bytes(
-      handshaker_result_, &unused_bytes, &unused_bytes_size);
-  // Create secure endpoint.
-  if (unused_bytes_size > 0) {
-    grpc_slice slice = grpc_slice_from_copied_buffer(
-        reinterpret_cast<const char*>(unused_bytes), unused_bytes_size);
-    args_->endpoint = grpc_secure_endpoint_create(
-        protector, zero_copy_protector, args_->endpoint, &slice, 1);
-    grpc_slice_unref_internal(slice);
-  } else {
-    args_->endpoint = grpc_secure_endpoint_create(
-        protector, zero_copy_protector, args_->endpoint, nullptr, 0);
+    // Create frame protector if zero-copy frame protector is NULL.
+    tsi_frame_protector* protector = nullptr;
+    if (zero_copy_protector == nullptr) {
+      result = tsi_handshaker_result_create_frame_protector(
+          handshaker_result_, max_frame_size_ == 0 ? nullptr : &max_frame_size_,
+          &protector);
+      if (result != TSI_OK) {
+        error = grpc_set_tsi_error_result(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+                                              "Frame protector creation failed"),
+                                          result);
+        HandshakeFailedLocked(error);
+        return;
+      }
+    }
+    // Get unused bytes.
+    const unsigned char* unused_bytes = nullptr;
+    size_t unused_bytes_size = 0;
+    result = tsi_handshaker_result_get_unused_bytes(
+        handshaker_result_, &unused_bytes, &unused_bytes_size);
+    // Create secure endpoint.
+    if (unused_bytes_size > 0) {
+      grpc_slice slice = grpc_slice_from_copied_buffer(
+          reinterpret_cast<const char*>(unused_bytes), unused_bytes_size);
+      args_->endpoint = grpc_secure_endpoint_create(
+          protector, zero_copy_protector, args_->endpoint, &slice, 1);
+      grpc_slice_unref_internal(slice);
+    } else {
+      args_->endpoint = grpc_secure_endpoint_create(
+          protector, zero_copy_protector, args_->endpoint, nullptr, 0);
+    }
   }
   tsi_handshaker_result_destroy(handshaker_result_);
   handshaker_result_ = nullptr;
@@ -404,6 +442,43 @@ grpc_error_handle SecurityHandshaker::DoHandshakerNextLocked(
                                    hs_result);
 }
 
+// Dispatches the next handshaker step to the offload pool, so that the
+// handshake crypto runs off the pollset thread that advanced the
+// handshake.  Takes a new ref to this handshaker, which the job either
+// releases into the follow-up callback chain or drops on failure.
+void SecurityHandshaker::OffloadHandshakerNextLocked(
+    size_t bytes_received_size) {
+  HandshakerNextJob* job = new HandshakerNextJob();
+  job->functor.functor_run = &SecurityHandshaker::RunHandshakerNextJob;
+  job->functor.inlineable = false;
+  job->functor.internal_success = true;
+  job->handshaker = Ref();
+  job->bytes_received_size = bytes_received_size;
+  HandshakePool()->Add(&job->functor);
+}
+
+void SecurityHandshaker::RunHandshakerNextJob(
+    grpc_completion_queue_functor* functor, int /*ok*/) {
+  HandshakerNextJob* job = reinterpret_cast<HandshakerNextJob*>(functor);
+  ExecCtx exec_ctx;
+  RefCountedPtr<SecurityHandshaker> h = std::move(job->handshaker);
+  const size_t bytes_received_size = job->bytes_received_size;
+  delete job;
+  MutexLock lock(&h->mu_);
+  if (h->is_shutdown_) {
+    // HandshakeFailedLocked() synthesizes the shutdown error.
+    h->HandshakeFailedLocked(GRPC_ERROR_NONE);
+    return;
+  }
+  grpc_error_handle error =
+      h->DoHandshakerNextLocked(h->handshake_buffer_, bytes_received_size);
+  if (error != GRPC_ERROR_NONE) {
+    h->HandshakeFailedLocked(error);
+  } else {
+    h.release();  // Avoid unref
+  }
+}
+
 // This callback might be run inline while we are still holding on to the mutex,
 // so schedule OnHandshakeDataReceivedFromPeerFn on ExecCtx to avoid a deadlock.
 void SecurityHandshaker::OnHandshakeDataReceivedFromPeerFnScheduler(
@@ -428,14 +503,9 @@ void SecurityHandshaker::OnHandshakeDataReceivedFromPeerFn(
   }
   // Copy all slices received.
   size_t bytes_received_size = h->MoveReadBufferIntoHandshakeBuffer();
-  // Call TSI handshaker.
-  error = h->DoHandshakerNextLocked(h->handshake_buffer_, bytes_received_size);
-
-  if (error != GRPC_ERROR_NONE) {
-    h->HandshakeFailedLocked(error);
-  } else {
-    h.release();  // Avoid unref
-  }
+  // Hand the TSI handshaker step to the offload pool; the job carries its
+  // own ref, so ours is dropped here.
+  h->OffloadHandshakerNextLocked(bytes_received_size);
 }
 
 // This callback might be run inline while we are still holding on to the mutex,
@@ -498,18 +568,13 @@ void SecurityHandshaker::Shutdown(grpc_error_handle why) {
 void SecurityHandshaker::DoHandshake(grpc_tcp_server_acceptor* /*acceptor*/,
                                      grpc_closure* on_handshake_done,
                                      HandshakerArgs* args) {
-  auto ref = Ref();
   MutexLock lock(&mu_);
   args_ = args;
   on_handshake_done_ = on_handshake_done;
   size_t bytes_received_size = MoveReadBufferIntoHandshakeBuffer();
-  grpc_error_handle error =
-      DoHandshakerNextLocked(handshake_buffer_, bytes_received_size);
-  if (error != GRPC_ERROR_NONE) {
-    HandshakeFailedLocked(error);
-  } else {
-    ref.release();  // Avoid unref
-  }
+  // Hand the first TSI handshaker step to the offload pool, which holds
+  // the ref that drives the rest of the handshake.
+  OffloadHandshakerNextLocked(bytes_received_size);
 }
 
 //
@@ -23,6 +23,10 @@
 #include <stdint.h>
 #include <string.h>
 
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
@@ -56,6 +60,58 @@ static const char base64_url_safe_chars[] =
 
 /* --- base64 functions. --- */
 
+#if defined(__SSSE3__)
+/* Encodes 12 input bytes into 16 base64 characters per iteration using the
+   SSSE3 algorithm by Wojciech Mula
+   (http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html). Consumes as
+   many full 12-byte blocks as can be loaded with in-bounds 16-byte reads and
+   returns the number of input bytes consumed; the caller's scalar loop
+   finishes the remainder. Not used for multiline output, which needs CRLF
+   breaks between blocks. */
+static size_t grpc_base64_encode_ssse3(char** current_ptr,
+                                       const unsigned char* data,
+                                       size_t data_size, int url_safe) {
+  const __m128i group_shuffle =
+      _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+  /* Per-range offsets from a 6-bit value to its base64 character code. */
+  const __m128i shift_lut =
+      url_safe ? _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52,
+                               '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                               '0' - 52, '0' - 52, '0' - 52, '-' - 62,
+                               '_' - 63, 'A', 0, 0)
+               : _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52,
+                               '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                               '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                               '/' - 63, 'A', 0, 0);
+  char* current = *current_ptr;
+  size_t consumed = 0;
+  while (data_size - consumed >= 16) {
+    __m128i in = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(data + consumed));
+    /* Spread four 3-byte groups into four 32-bit lanes. */
+    in = _mm_shuffle_epi8(in, group_shuffle);
+    /* Isolate the four 6-bit indices of each group. */
+    const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(t1, t3);
+    /* Classify each index into one of the 13 offset ranges and add the
+       matching offset to get the output character. */
+    __m128i ranges = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    ranges = _mm_or_si128(ranges, _mm_and_si128(less, _mm_set1_epi8(13)));
+    const __m128i chars =
+        _mm_add_epi8(_mm_shuffle_epi8(shift_lut, ranges), indices);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(current), chars);
+    current += 16;
+    consumed += 12;
+  }
+  *current_ptr = current;
+  return consumed;
+}
+#endif /* defined(__SSSE3__) */
+
 char* grpc_base64_encode(const void* vdata, size_t data_size, int url_safe,
                          int multiline) {
   size_t result_projected_size =
@@ -86,6 +142,15 @@ void grpc_base64_encode_core(char* result, const void* vdata, size_t data_size,
   size_t num_blocks = 0;
   size_t i = 0;
 
+#if defined(__SSSE3__)
+  if (!multiline) {
+    const size_t consumed =
+        grpc_base64_encode_ssse3(&current, data, data_size, url_safe);
+    data_size -= consumed;
+    i += consumed;
+  }
+#endif
+
   /* Encode each block. */
   while (data_size >= 3) {
     *current++ = base64_chars[(data[i] >> 2) & 0x3F];
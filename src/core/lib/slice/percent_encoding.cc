@@ -21,6 +21,11 @@
 #include "src/core/lib/slice/percent_encoding.h"
 
 #include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #include <grpc/support/log.h>
 
@@ -76,6 +81,35 @@ const BitSet<256>& LookupTableForPercentEncodingType(PercentEncodingType type) {
   // Crash if a bad PercentEncodingType was passed in.
   GPR_UNREACHABLE_CODE(abort());
 }
+
+#if defined(__SSE2__)
+// Returns the length of the prefix of [p, end) made up entirely of bytes the
+// Compatible table marks legal (printable ASCII other than '%'), examining 16
+// bytes per step. The common case - a status message that needs no escaping -
+// reduces to this scan plus a memcpy. Stops short of the trailing <16 bytes,
+// which the caller's scalar loop handles.
+size_t CompatibleLegalPrefix(const uint8_t* p, const uint8_t* end) {
+  const uint8_t* start = p;
+  const __m128i percent = _mm_set1_epi8('%');
+  const __m128i space_minus_one = _mm_set1_epi8(' ' - 1);
+  const __m128i del = _mm_set1_epi8(127);
+  while (end - p >= 16) {
+    const __m128i bytes =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    // Legal iff 32 <= byte <= 126 and byte != '%'. Bytes >= 128 are negative
+    // under signed compare and correctly fail the lower bound.
+    __m128i ok = _mm_and_si128(_mm_cmpgt_epi8(bytes, space_minus_one),
+                               _mm_cmplt_epi8(bytes, del));
+    ok = _mm_andnot_si128(_mm_cmpeq_epi8(bytes, percent), ok);
+    const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(ok));
+    if (mask != 0xffff) {
+      return static_cast<size_t>(p - start) + __builtin_ctz(~mask & 0xffff);
+    }
+    p += 16;
+  }
+  return static_cast<size_t>(p - start);
+}
+#endif /* defined(__SSE2__) */
 }  // namespace
 
 grpc_slice PercentEncodeSlice(const grpc_slice& slice,
@@ -88,12 +122,21 @@ grpc_slice PercentEncodeSlice(const grpc_slice& slice,
   size_t output_length = 0;
   const uint8_t* slice_start = GRPC_SLICE_START_PTR(slice);
   const uint8_t* slice_end = GRPC_SLICE_END_PTR(slice);
-  const uint8_t* p;
+  const uint8_t* p = slice_start;
   bool any_reserved_bytes = false;
-  for (p = slice_start; p < slice_end; p++) {
+  while (p < slice_end) {
+#if defined(__SSE2__)
+    if (type == PercentEncodingType::Compatible) {
+      const size_t run = CompatibleLegalPrefix(p, slice_end);
+      output_length += run;
+      p += run;
+      if (p == slice_end) break;
+    }
+#endif
     bool unres = lut.is_set(*p);
     output_length += unres ? 1 : 3;
     any_reserved_bytes |= !unres;
+    p++;
   }
   // no unreserved bytes: return the string unmodified
   if (!any_reserved_bytes) {
@@ -102,13 +145,24 @@ grpc_slice PercentEncodeSlice(const grpc_slice& slice,
   // second pass: actually encode
   grpc_slice out = GRPC_SLICE_MALLOC(output_length);
   uint8_t* q = GRPC_SLICE_START_PTR(out);
-  for (p = slice_start; p < slice_end; p++) {
+  p = slice_start;
+  while (p < slice_end) {
+#if defined(__SSE2__)
+    if (type == PercentEncodingType::Compatible) {
+      const size_t run = CompatibleLegalPrefix(p, slice_end);
+      memcpy(q, p, run);
+      q += run;
+      p += run;
+      if (p == slice_end) break;
+    }
+#endif
     if (lut.is_set(*p)) {
-      *q++ = *p;
+      *q++ = *p++;
     } else {
       *q++ = '%';
       *q++ = hex[*p >> 4];
       *q++ = hex[*p & 15];
+      p++;
     }
   }
   GPR_ASSERT(q == GRPC_SLICE_END_PTR(out));
@@ -134,6 +134,20 @@ size_t grpc_slice_buffer_add_indexed(grpc_slice_buffer* sb, grpc_slice s) {
 
 void grpc_slice_buffer_add(grpc_slice_buffer* sb, grpc_slice s) {
   size_t n = sb->count;
+  /* if the slice being added is refcounted but small enough to be carried
+     inside the slice data structure, copy it and drop the ref so that it
+     can be packed together with its neighbors below: header frames produce
+     many 9-30 byte refcounted slices, and keeping each one as a distinct
+     entry inflates the iovec count of the eventual writev */
+  if (s.refcount && GRPC_SLICE_LENGTH(s) <= GRPC_SLICE_INLINED_SIZE) {
+    grpc_slice copy;
+    copy.refcount = nullptr;
+    copy.data.inlined.length = static_cast<uint8_t>(GRPC_SLICE_LENGTH(s));
+    memcpy(copy.data.inlined.bytes, GRPC_SLICE_START_PTR(s),
+           GRPC_SLICE_LENGTH(s));
+    grpc_slice_unref(s); /* may be called without an ExecCtx */
+    s = copy;
+  }
   /* if both the last slice in the slice buffer and the slice being added
      are inlined (that is, that they carry their data inside the slice data
      structure), and the back slice is not full, then concatenate directly
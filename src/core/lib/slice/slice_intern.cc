@@ -23,8 +23,11 @@
 
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
+#include <grpc/support/string_util.h>
 
 #include "src/core/lib/gpr/murmur_hash.h"
+#include "src/core/lib/gpr/spinlock.h"
+#include "src/core/lib/gpr/tls.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/iomgr_internal.h" /* for iomgr_abort_on_leaks() */
 #include "src/core/lib/profiling/timers.h"
@@ -59,6 +62,25 @@ static static_metadata_hash_ent
     static_metadata_hash[4 * GRPC_STATIC_MDSTR_COUNT];
 static uint32_t max_static_metadata_hash_probe;
 uint32_t grpc_static_metadata_hash_values[GRPC_STATIC_MDSTR_COUNT];
+uint32_t grpc_static_mdelem_hash_values[GRPC_STATIC_MDELEM_COUNT];
+
+/* Second interning tier: strings registered via
+   grpc_slice_register_well_known_string() before grpc_init() are
+   pre-interned at initialization into a fixed open-addressed table that is
+   immutable while the library is initialized. Lookups mirror the generated
+   static metadata table above, so registered application headers get the
+   same lock-free fast path as gRPC's own static strings. The registration
+   list persists across init/shutdown cycles; the table does not. */
+struct well_known_slice_hash_ent {
+  uint32_t hash;
+  InternedSliceRefcount* refcount;
+};
+static char** g_well_known_strings = nullptr;
+static size_t g_well_known_string_count = 0;
+static size_t g_well_known_string_capacity = 0;
+static well_known_slice_hash_ent* g_well_known_hash = nullptr;
+static size_t g_well_known_hash_size = 0;
+static uint32_t g_max_well_known_hash_probe = 0;
 
 namespace grpc_core {
 
@@ -174,6 +196,43 @@ static const grpc_core::StaticMetadataSlice* MatchStaticSlice(
   return nullptr;
 }
 
+// Attempt to see if the provided slice or string matches a registered
+// well-known slice. SliceArgs is either a const grpc_slice& or a
+// const pair<const char*, size_t>&; hash is the pre-computed hash value.
+//
+// Returns: a new ref to the matching pre-interned slice, or null.
+template <typename SliceArgs>
+static InternedSliceRefcount* MatchWellKnownSlice(uint32_t hash,
+                                                  const SliceArgs& args) {
+  if (g_well_known_hash == nullptr) return nullptr;
+  for (uint32_t i = 0; i <= g_max_well_known_hash_probe; i++) {
+    well_known_slice_hash_ent ent =
+        g_well_known_hash[(hash + i) % g_well_known_hash_size];
+    if (ent.refcount != nullptr && ent.hash == hash &&
+        grpc_core::InternedSlice(ent.refcount) == args) {
+      /* the table's own ref keeps the entry alive until shutdown, so this
+         ref cannot race with destruction */
+      ent.refcount->refcnt.Ref();
+      return ent.refcount;
+    }
+  }
+  return nullptr;
+}
+
+void grpc_slice_register_well_known_string(const char* str) {
+  /* like grpc_register_plugin, registration is only legal before
+     grpc_init() and needs no synchronization */
+  if (g_well_known_string_count == g_well_known_string_capacity) {
+    g_well_known_string_capacity = g_well_known_string_capacity == 0
+                                       ? 8
+                                       : g_well_known_string_capacity * 2;
+    g_well_known_strings = static_cast<char**>(gpr_realloc(
+        g_well_known_strings,
+        sizeof(*g_well_known_strings) * g_well_known_string_capacity));
+  }
+  g_well_known_strings[g_well_known_string_count++] = gpr_strdup(str);
+}
+
 // Helper methods to enable us to select appropriately overloaded slice methods
 // whether we're dealing with a slice, or a buffer with length, when interning
 // strings. Helpers for FindOrCreateInternedSlice().
@@ -220,6 +279,118 @@ static InternedSliceRefcount* InternNewStringLocked(slice_shard* shard,
   return s;
 }
 
+/* Per-thread lookaside cache consulted before the sharded intern table.
+   Each worker thread tends to see the same small set of header keys over
+   and over, so a tiny direct-mapped cache avoids the shared shard locks
+   on the hot path. Each cached entry holds a strong ref; caches are kept
+   on a global registry so grpc_slice_intern_shutdown() can flush those
+   refs before scanning for leaks. Cache structs are never freed (the
+   owning thread's TLS pointer must stay valid across init/shutdown
+   cycles), so the number of caches is capped. */
+#define LOG2_INTERN_CACHE_SIZE 6
+#define INTERN_CACHE_SIZE (1 << LOG2_INTERN_CACHE_SIZE)
+
+namespace {
+
+struct InternLookasideCache {
+  /* taken by the owning thread per lookup and by the shutdown flush;
+     almost always uncontended */
+  gpr_spinlock lock;
+  InternedSliceRefcount* entries[INTERN_CACHE_SIZE];
+  InternLookasideCache* next;
+};
+
+constexpr size_t kMaxInternCaches = 256;
+
+gpr_spinlock g_intern_cache_registry_lock = GPR_SPINLOCK_STATIC_INITIALIZER;
+InternLookasideCache* g_intern_cache_registry = nullptr;
+size_t g_intern_cache_count = 0;
+/* lock permanently held: trylock always fails, disabling caching for
+   threads created after the registry cap is reached */
+InternLookasideCache g_intern_cache_disabled = {{1}, {}, nullptr};
+GPR_THREAD_LOCAL(InternLookasideCache*) g_intern_cache;
+
+InternLookasideCache* InternCacheGet() {
+  InternLookasideCache* cache = g_intern_cache;
+  if (GPR_UNLIKELY(cache == nullptr)) {
+    gpr_spinlock_lock(&g_intern_cache_registry_lock);
+    if (g_intern_cache_count == kMaxInternCaches) {
+      cache = &g_intern_cache_disabled;
+    } else {
+      cache = static_cast<InternLookasideCache*>(gpr_zalloc(sizeof(*cache)));
+      cache->next = g_intern_cache_registry;
+      g_intern_cache_registry = cache;
+      g_intern_cache_count++;
+    }
+    gpr_spinlock_unlock(&g_intern_cache_registry_lock);
+    g_intern_cache = cache;
+  }
+  return cache;
+}
+
+void InternCacheUnrefEntry(InternedSliceRefcount* s) {
+  if (s->refcnt.Unref()) {
+    InternedSliceRefcount::Destroy(s);
+  }
+}
+
+// Attempt to find the provided slice or string in the calling thread's
+// lookaside cache. SliceArgs is either a const grpc_slice& or a const
+// pair<const char*, size_t>&; hash is the pre-computed hash value.
+//
+// Returns: a new ref to the matching interned slice, or null.
+template <typename SliceArgs>
+InternedSliceRefcount* InternCacheLookup(uint32_t hash,
+                                         const SliceArgs& args) {
+  InternLookasideCache* cache = InternCacheGet();
+  InternedSliceRefcount* s = nullptr;
+  if (!gpr_spinlock_trylock(&cache->lock)) return nullptr;
+  InternedSliceRefcount* e = cache->entries[hash & (INTERN_CACHE_SIZE - 1)];
+  if (e != nullptr && e->hash == hash && grpc_core::InternedSlice(e) == args) {
+    /* the cache's own ref keeps e alive, so this ref cannot race with
+       destruction */
+    e->refcnt.Ref();
+    s = e;
+  }
+  gpr_spinlock_unlock(&cache->lock);
+  return s;
+}
+
+// Record an interned slice in the calling thread's lookaside cache,
+// evicting whatever previously occupied its slot.
+void InternCacheInsert(uint32_t hash, InternedSliceRefcount* s) {
+  InternLookasideCache* cache = g_intern_cache; /* created by lookup */
+  if (cache == nullptr) return;
+  if (!gpr_spinlock_trylock(&cache->lock)) return;
+  InternedSliceRefcount** slot =
+      &cache->entries[hash & (INTERN_CACHE_SIZE - 1)];
+  InternedSliceRefcount* evicted = *slot;
+  s->refcnt.Ref();
+  *slot = s;
+  gpr_spinlock_unlock(&cache->lock);
+  if (evicted != nullptr) InternCacheUnrefEntry(evicted);
+}
+
+// Drop the refs held by all threads' lookaside caches. Called at
+// shutdown so cached entries are not reported as leaks.
+void InternCacheFlushAll() {
+  gpr_spinlock_lock(&g_intern_cache_registry_lock);
+  for (InternLookasideCache* cache = g_intern_cache_registry; cache != nullptr;
+       cache = cache->next) {
+    gpr_spinlock_lock(&cache->lock);
+    for (size_t i = 0; i < INTERN_CACHE_SIZE; i++) {
+      if (cache->entries[i] != nullptr) {
+        InternCacheUnrefEntry(cache->entries[i]);
+        cache->entries[i] = nullptr;
+      }
+    }
+    gpr_spinlock_unlock(&cache->lock);
+  }
+  gpr_spinlock_unlock(&g_intern_cache_registry_lock);
+}
+
+}  // namespace
+
 // Attempt to see if the provided slice or string matches an existing interned
 // slice. SliceArgs... is either a const grpc_slice& or a string and length. In
 // either case, hash is the pre-computed hash value.  We must already hold the
@@ -254,13 +425,18 @@ static InternedSliceRefcount* MatchInternedSliceLocked(uint32_t hash,
 template <typename SliceArgs>
 static InternedSliceRefcount* FindOrCreateInternedSlice(uint32_t hash,
                                                         const SliceArgs& args) {
-  slice_shard* shard = &g_shards[SHARD_IDX(hash)];
-  grpc_core::MutexLock lock(&shard->mu);
-  const size_t idx = TABLE_IDX(hash, shard->capacity);
-  InternedSliceRefcount* s = MatchInternedSliceLocked(hash, idx, args);
-  if (s == nullptr) {
-    s = InternNewStringLocked(shard, idx, hash, args);
+  InternedSliceRefcount* s = InternCacheLookup(hash, args);
+  if (s != nullptr) return s;
+  {
+    slice_shard* shard = &g_shards[SHARD_IDX(hash)];
+    grpc_core::MutexLock lock(&shard->mu);
+    const size_t idx = TABLE_IDX(hash, shard->capacity);
+    s = MatchInternedSliceLocked(hash, idx, args);
+    if (s == nullptr) {
+      s = InternNewStringLocked(shard, idx, hash, args);
+    }
   }
+  InternCacheInsert(hash, s);
   return s;
 }
 
@@ -275,6 +451,12 @@ grpc_core::ManagedMemorySlice::ManagedMemorySlice(const char* buf, size_t len) {
       MatchStaticSlice(hash, std::pair<const char*, size_t>(buf, len));
   if (static_slice) {
     *this = *static_slice;
+    return;
+  }
+  InternedSliceRefcount* well_known =
+      MatchWellKnownSlice(hash, std::pair<const char*, size_t>(buf, len));
+  if (well_known != nullptr) {
+    *this = grpc_core::InternedSlice(well_known);
   } else {
     *this = grpc_core::InternedSlice(FindOrCreateInternedSlice(
         hash, std::pair<const char*, size_t>(buf, len)));
@@ -292,6 +474,11 @@ grpc_core::ManagedMemorySlice::ManagedMemorySlice(const grpc_slice* slice_ptr) {
   const StaticMetadataSlice* static_slice = MatchStaticSlice(hash, slice);
   if (static_slice) {
     *this = *static_slice;
+    return;
+  }
+  InternedSliceRefcount* well_known = MatchWellKnownSlice(hash, slice);
+  if (well_known != nullptr) {
+    *this = grpc_core::InternedSlice(well_known);
   } else {
     *this = grpc_core::InternedSlice(FindOrCreateInternedSlice(hash, slice));
   }
@@ -336,13 +523,67 @@ void grpc_slice_intern_init(void) {
       }
     }
   }
-  // Handle KV hash for all static mdelems.
+  // Handle KV hash for all static mdelems. The table itself is constant
+  // initialized into read-only memory, so the seeded hashes live in a side
+  // array instead.
   for (size_t i = 0; i < GRPC_STATIC_MDELEM_COUNT; ++i) {
-    grpc_core::g_static_mdelem_table[i].HashInit();
+    const grpc_mdelem_data& kv = grpc_core::g_static_mdelem_table[i].data();
+    grpc_static_mdelem_hash_values[i] = GRPC_MDSTR_KV_HASH(
+        grpc_slice_hash_internal(kv.key), grpc_slice_hash_internal(kv.value));
+  }
+  // Build the second-tier table for registered well-known strings. Each
+  // table slot holds a ref that keeps its entry pre-interned (and therefore
+  // safe to hand out without a lock) until shutdown.
+  if (g_well_known_string_count > 0) {
+    g_well_known_hash_size = 4 * g_well_known_string_count;
+    g_well_known_hash = static_cast<well_known_slice_hash_ent*>(gpr_zalloc(
+        sizeof(*g_well_known_hash) * g_well_known_hash_size));
+    g_max_well_known_hash_probe = 0;
+    for (size_t i = 0; i < g_well_known_string_count; i++) {
+      const char* str = g_well_known_strings[i];
+      const std::pair<const char*, size_t> args(str, strlen(str));
+      const uint32_t hash =
+          gpr_murmur_hash3(str, args.second, grpc_core::g_hash_seed);
+      // Strings already covered by the generated static table need no entry.
+      if (MatchStaticSlice(hash, args) != nullptr) continue;
+      InternedSliceRefcount* s = FindOrCreateInternedSlice(hash, args);
+      bool inserted = false;
+      for (size_t j = 0; j < g_well_known_hash_size; j++) {
+        well_known_slice_hash_ent* ent =
+            &g_well_known_hash[(hash + j) % g_well_known_hash_size];
+        if (ent->refcount == s) break;  // duplicate registration
+        if (ent->refcount == nullptr) {
+          ent->hash = hash;
+          ent->refcount = s;
+          if (j > g_max_well_known_hash_probe) {
+            g_max_well_known_hash_probe = static_cast<uint32_t>(j);
+          }
+          inserted = true;
+          break;
+        }
+      }
+      if (!inserted) {
+        // Duplicate: the table already holds a ref for this string.
+        if (s->refcnt.Unref()) InternedSliceRefcount::Destroy(s);
+      }
+    }
   }
 }
 
 void grpc_slice_intern_shutdown(void) {
+  InternCacheFlushAll();
+  if (g_well_known_hash != nullptr) {
+    for (size_t i = 0; i < g_well_known_hash_size; i++) {
+      InternedSliceRefcount* s = g_well_known_hash[i].refcount;
+      if (s != nullptr && s->refcnt.Unref()) {
+        InternedSliceRefcount::Destroy(s);
+      }
+    }
+    gpr_free(g_well_known_hash);
+    g_well_known_hash = nullptr;
+    g_well_known_hash_size = 0;
+    g_max_well_known_hash_probe = 0;
+  }
   for (size_t i = 0; i < SHARD_COUNT; i++) {
     slice_shard* shard = &g_shards[i];
     /* TODO(ctiller): GPR_ASSERT(shard->count == 0); */
@@ -15,3 +15,54 @@
 #include <grpc/support/port_platform.h>
 
 #include "src/core/lib/slice/slice_refcount.h"
+
+namespace grpc_core {
+namespace slice_ref_deferral_detail {
+
+GPR_THREAD_LOCAL(DeferredUnrefTable*) g_deferred_unrefs;
+
+bool DeferUnref(grpc_slice_refcount* refcount) {
+  DeferredUnrefTable* table = g_deferred_unrefs;
+  for (size_t i = 0; i < table->num_entries; i++) {
+    if (table->entries[i].refcount == refcount) {
+      table->entries[i].count++;
+      return true;
+    }
+  }
+  if (table->num_entries == DeferredUnrefTable::kMaxEntries) return false;
+  table->entries[table->num_entries++] = {refcount, 1};
+  return true;
+}
+
+bool CancelDeferredUnref(grpc_slice_refcount* refcount) {
+  DeferredUnrefTable* table = g_deferred_unrefs;
+  for (size_t i = 0; i < table->num_entries; i++) {
+    if (table->entries[i].refcount == refcount) {
+      if (--table->entries[i].count == 0) {
+        table->entries[i] = table->entries[--table->num_entries];
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace slice_ref_deferral_detail
+
+SliceRefDeferralScope::SliceRefDeferralScope()
+    : prev_(slice_ref_deferral_detail::g_deferred_unrefs) {
+  table_.num_entries = 0;
+  slice_ref_deferral_detail::g_deferred_unrefs = &table_;
+}
+
+SliceRefDeferralScope::~SliceRefDeferralScope() {
+  // Pop the table before flushing so that unrefs issued by destructors run
+  // from UnrefBatch() land in the enclosing scope (or run immediately)
+  // rather than in this dying table.
+  slice_ref_deferral_detail::g_deferred_unrefs = prev_;
+  for (size_t i = 0; i < table_.num_entries; i++) {
+    table_.entries[i].refcount->UnrefBatch(table_.entries[i].count);
+  }
+}
+
+}  // namespace grpc_core
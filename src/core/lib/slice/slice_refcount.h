@@ -17,6 +17,8 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
+
 #include "src/core/lib/slice/slice_refcount_base.h"
 #include "src/core/lib/slice/static_slice.h"
 
@@ -51,6 +53,9 @@ struct InternedSliceRefcount {
   RefCount refcnt;
   const uint32_t hash;
   InternedSliceRefcount* bucket_next;
+  // Memoized header-legality bits for this slice's (immutable) bytes; see
+  // validate_metadata.cc. Zero means nothing has been validated yet.
+  std::atomic<uint8_t> validation_cache{0};
 };
 
 }  // namespace grpc_core
@@ -19,6 +19,7 @@
 
 #include <grpc/slice.h>
 
+#include "src/core/lib/gpr/tls.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 
 // grpc_slice_refcount : A reference count for grpc_slice.
@@ -81,6 +82,39 @@
 // where the cost of sending the data dominates.
 // TODO(arjunroy): Investigate if this can be removed with strongly typed
 // grpc_slices.
+
+namespace grpc_core {
+namespace slice_ref_deferral_detail {
+
+// Per-thread table of deferred slice unrefs for the innermost active
+// SliceRefDeferralScope (declared below), or null when no scope is active.
+// The table is deliberately small and scanned linearly: on the paths that
+// open a scope (the chttp2 read path) almost all unrefs hit one or two
+// distinct refcounts - chiefly the shared sub-refcount of the transport's
+// read buffer.
+struct DeferredUnrefTable {
+  static constexpr size_t kMaxEntries = 8;
+  struct Entry {
+    grpc_slice_refcount* refcount;
+    size_t count;
+  };
+  Entry entries[kMaxEntries];
+  size_t num_entries;
+};
+
+extern GPR_THREAD_LOCAL(DeferredUnrefTable*) g_deferred_unrefs;
+
+// Records one deferred unref of \a refcount in the active table. Returns
+// false if the table is full; the caller then unrefs immediately.
+bool DeferUnref(grpc_slice_refcount* refcount);
+// Consumes one pending deferred unref of \a refcount, transferring the
+// still-live reference it represents to the caller. Returns false if none
+// is pending.
+bool CancelDeferredUnref(grpc_slice_refcount* refcount);
+
+}  // namespace slice_ref_deferral_detail
+}  // namespace grpc_core
+
 struct grpc_slice_refcount {
  public:
   enum class Type {
@@ -125,8 +159,9 @@ struct grpc_slice_refcount {
         sub_refcount_(sub),
         dest_fn_(destroyer_fn),
         destroy_fn_arg_(destroyer_arg) {}
-  // Initializer for static refcounts.
-  grpc_slice_refcount(grpc_slice_refcount* sub, Type type)
+  // Initializer for static refcounts. constexpr so that the generated
+  // static slice tables can be constant-initialized (see static_slice.cc).
+  constexpr grpc_slice_refcount(grpc_slice_refcount* sub, Type type)
       : ref_type_(type), sub_refcount_(sub) {}
 
   Type GetType() const { return ref_type_; }
@@ -136,14 +171,33 @@ struct grpc_slice_refcount {
   uint32_t Hash(const grpc_slice& slice);
   void Ref() {
     if (ref_ == nullptr) return;
+    // A pending deferred unref (see SliceRefDeferralScope below) represents
+    // a live reference this thread still owns; consume it instead of
+    // touching the atomic counter.
+    if (grpc_core::slice_ref_deferral_detail::g_deferred_unrefs != nullptr &&
+        grpc_core::slice_ref_deferral_detail::CancelDeferredUnref(this)) {
+      return;
+    }
     ref_->RefNonZero();
   }
   void Unref() {
     if (ref_ == nullptr) return;
+    if (grpc_core::slice_ref_deferral_detail::g_deferred_unrefs != nullptr &&
+        grpc_core::slice_ref_deferral_detail::DeferUnref(this)) {
+      return;
+    }
     if (ref_->Unref()) {
       dest_fn_(destroy_fn_arg_);
     }
   }
+  // Drops \a count references with a single atomic operation. Called by
+  // SliceRefDeferralScope when reconciling its table; the table only ever
+  // holds refcounts with a non-null underlying counter.
+  void UnrefBatch(size_t count) {
+    if (ref_->Unref(static_cast<grpc_core::RefCount::Value>(count))) {
+      dest_fn_(destroy_fn_arg_);
+    }
+  }
 
   grpc_slice_refcount* sub_refcount() const { return sub_refcount_; }
 
@@ -160,7 +214,7 @@ namespace grpc_core {
 struct StaticSliceRefcount {
   static grpc_slice_refcount kStaticSubRefcount;
 
-  explicit StaticSliceRefcount(uint32_t index)
+  constexpr explicit StaticSliceRefcount(uint32_t index)
       : base(&kStaticSubRefcount, grpc_slice_refcount::Type::STATIC),
         index(index) {}
 
@@ -168,6 +222,43 @@ struct StaticSliceRefcount {
   const uint32_t index;
 };
 
+// Scoped activation of a deferred refcounting tier for slices.
+//
+// Most slice ref/unref pairs on the chttp2 read path happen on one thread
+// within one ExecCtx: the parser refs sub-slices of the read buffer into
+// streams, and deframing unrefs them shortly afterwards. Each of those is
+// an atomic RMW on a refcount that is typically shared by many slices (the
+// stream/read-buffer sub-refcount), so the atomics dominate the cost of
+// slice bookkeeping there.
+//
+// While a SliceRefDeferralScope is active on the current thread:
+//  - Unref() appends to a small per-thread table instead of touching the
+//    atomic counter. Deferring an unref is always safe: it only delays the
+//    point at which the count can reach zero.
+//  - Ref() first tries to cancel a pending deferred unref of the same
+//    refcount. That is sound because the pending unref proves this thread
+//    still owns a live reference it has not yet given up; cancelling it
+//    transfers that reference to the caller. Absent a pending unref the
+//    ref is performed atomically as usual - deferring refs in general
+//    would let another thread observe a premature zero count.
+//
+// When the scope ends the table is reconciled with one atomic operation
+// per distinct refcount. Destruction of data whose last unref was deferred
+// is correspondingly delayed until scope exit. Scopes nest; an inner scope
+// gets its own table.
+class SliceRefDeferralScope {
+ public:
+  SliceRefDeferralScope();
+  ~SliceRefDeferralScope();
+
+  SliceRefDeferralScope(const SliceRefDeferralScope&) = delete;
+  SliceRefDeferralScope& operator=(const SliceRefDeferralScope&) = delete;
+
+ private:
+  slice_ref_deferral_detail::DeferredUnrefTable table_;
+  slice_ref_deferral_detail::DeferredUnrefTable* const prev_;
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_CORE_LIB_SLICE_SLICE_REFCOUNT_BASE_H
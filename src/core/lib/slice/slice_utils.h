@@ -106,6 +106,13 @@ struct ManagedMemorySlice : public grpc_slice {
     data.refcounted.bytes = nullptr;
     data.refcounted.length = 0;
   }
+  // Constant-expression initializer, used by StaticMetadataSlice so that the
+  // generated static slice tables can be constant-initialized. Aggregate-
+  // initializing the grpc_slice base is the only way to populate the union in
+  // a C++14 constant expression.
+  constexpr ManagedMemorySlice(grpc_slice_refcount* ref, size_t length,
+                               uint8_t* bytes)
+      : grpc_slice{ref, {{length, bytes}}} {}
   explicit ManagedMemorySlice(const char* string);
   ManagedMemorySlice(const char* buf, size_t len);
   explicit ManagedMemorySlice(const grpc_slice* slice);
@@ -172,15 +179,12 @@ struct ExternallyManagedSlice : public UnmanagedMemorySlice {
 };
 
 struct StaticMetadataSlice : public ManagedMemorySlice {
-  StaticMetadataSlice(grpc_slice_refcount* ref, size_t length,
-                      const uint8_t* bytes) {
-    refcount = ref;
-    data.refcounted.length = length;
-    // NB: grpc_slice may or may not point to a static slice, but we are
-    // definitely pointing to static data here. Since we are not changing
-    // the underlying C-type, we need a const_cast here.
-    data.refcounted.bytes = const_cast<uint8_t*>(bytes);
-  }
+  // NB: grpc_slice may or may not point to a static slice, but we are
+  // definitely pointing to static data here. Since we are not changing
+  // the underlying C-type, we need a const_cast here.
+  constexpr StaticMetadataSlice(grpc_slice_refcount* ref, size_t length,
+                                const uint8_t* bytes)
+      : ManagedMemorySlice(ref, length, const_cast<uint8_t*>(bytes)) {}
 };
 
 struct InternedSliceRefcount;
@@ -192,7 +192,7 @@ StaticSliceRefcount g_static_metadata_slice_refcounts[GRPC_STATIC_MDSTR_COUNT] =
         StaticSliceRefcount(108), StaticSliceRefcount(109),
 };
 
-const StaticMetadataSlice
+constexpr StaticMetadataSlice
     g_static_metadata_slice_table[GRPC_STATIC_MDSTR_COUNT] = {
 
         grpc_core::StaticMetadataSlice(
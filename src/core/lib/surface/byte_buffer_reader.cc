@@ -23,13 +23,19 @@
 #include <grpc/byte_buffer.h>
 #include <grpc/byte_buffer_reader.h>
 #include <grpc/grpc.h>
+#include <grpc/grpc_posix.h>
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/port.h"
 #include "src/core/lib/slice/slice_internal.h"
 
+#ifdef GRPC_POSIX_SOCKET
+#include <sys/uio.h>
+#endif
+
 int grpc_byte_buffer_reader_init(grpc_byte_buffer_reader* reader,
                                  grpc_byte_buffer* buffer) {
   reader->buffer_in = buffer;
@@ -99,3 +105,66 @@ grpc_slice grpc_byte_buffer_reader_readall(grpc_byte_buffer_reader* reader) {
 
   return out_slice;
 }
+
+#ifdef GRPC_POSIX_SOCKET
+
+struct grpc_byte_buffer_iovec_handle {
+  grpc_slice* slices;
+  struct iovec* iov;
+  size_t count;
+};
+
+grpc_byte_buffer_iovec_handle* grpc_byte_buffer_export_iovec(
+    grpc_byte_buffer* buffer, struct iovec** iov, size_t* iov_count) {
+  if (buffer == nullptr || buffer->type != GRPC_BB_RAW ||
+      buffer->data.raw.compression != GRPC_COMPRESS_NONE) {
+    return nullptr;
+  }
+  grpc_slice_buffer* slice_buffer = &buffer->data.raw.slice_buffer;
+  grpc_byte_buffer_iovec_handle* handle =
+      static_cast<grpc_byte_buffer_iovec_handle*>(gpr_malloc(sizeof(*handle)));
+  handle->count = slice_buffer->count;
+  handle->slices = static_cast<grpc_slice*>(
+      gpr_malloc(sizeof(grpc_slice) * handle->count));
+  handle->iov = static_cast<struct iovec*>(
+      gpr_malloc(sizeof(struct iovec) * handle->count));
+  for (size_t i = 0; i < handle->count; i++) {
+    /* The handle's copy keeps inlined slice payloads (which live inside the
+       slice struct itself) valid, and its reference keeps refcounted
+       payloads alive, after the buffer is destroyed. */
+    handle->slices[i] = grpc_slice_ref_internal(slice_buffer->slices[i]);
+    handle->iov[i].iov_base = GRPC_SLICE_START_PTR(handle->slices[i]);
+    handle->iov[i].iov_len = GRPC_SLICE_LENGTH(handle->slices[i]);
+  }
+  *iov = handle->iov;
+  *iov_count = handle->count;
+  return handle;
+}
+
+void grpc_byte_buffer_iovec_handle_destroy(
+    grpc_byte_buffer_iovec_handle* handle) {
+  if (handle == nullptr) return;
+  grpc_core::ExecCtx exec_ctx;
+  for (size_t i = 0; i < handle->count; i++) {
+    grpc_slice_unref_internal(handle->slices[i]);
+  }
+  gpr_free(handle->iov);
+  gpr_free(handle->slices);
+  gpr_free(handle);
+}
+
+#else  // !GRPC_POSIX_SOCKET
+
+grpc_byte_buffer_iovec_handle* grpc_byte_buffer_export_iovec(
+    grpc_byte_buffer* /* buffer */, struct iovec** /* iov */,
+    size_t* /* iov_count */) {
+  GPR_ASSERT(0);
+  return nullptr;
+}
+
+void grpc_byte_buffer_iovec_handle_destroy(
+    grpc_byte_buffer_iovec_handle* /* handle */) {
+  GPR_ASSERT(0);
+}
+
+#endif  // GRPC_POSIX_SOCKET
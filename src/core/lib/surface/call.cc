@@ -44,6 +44,7 @@
 #include "src/core/lib/gpr/alloc.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gpr/time_precise.h"
+#include "src/core/lib/gpr/tls.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/arena.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
@@ -138,13 +139,23 @@ struct child_call {
 #define RECV_NONE ((gpr_atm)0)
 #define RECV_INITIAL_METADATA_FIRST ((gpr_atm)1)
 
+/* One in how many calls is sampled for the call_*_us stage latency
+   histograms (see stats_data.yaml). The counter is thread local so that
+   the sampling decision costs neither an atomic op nor a syscall. */
+#define CALL_LATENCY_SAMPLE_PERIOD 64
+
+static GPR_THREAD_LOCAL(uint32_t) g_call_latency_sample_counter;
+
 struct grpc_call {
   grpc_call(grpc_core::Arena* arena, const grpc_call_create_args& args)
       : arena(arena),
         cq(args.cq),
         channel(args.channel),
+        registered_method(args.registered_method),
         is_client(args.server_transport_data == nullptr),
-        stream_op_payload(context) {}
+        stream_op_payload(context) {
+    gpr_mu_init(&readahead_mu);
+  }
 
   ~grpc_call() {
     for (int i = 0; i < GRPC_CONTEXT_COUNT; ++i) {
@@ -152,6 +163,12 @@ struct grpc_call {
         context[i].destroy(context[i].value);
       }
     }
+    while (readahead_count > 0) {
+      grpc_byte_buffer_destroy(readahead_queue[readahead_head]);
+      readahead_head = (readahead_head + 1) % readahead_limit;
+      readahead_count--;
+    }
+    gpr_mu_destroy(&readahead_mu);
     gpr_free(static_cast<void*>(const_cast<char*>(final_info.error_string)));
   }
 
@@ -161,7 +178,15 @@ struct grpc_call {
   grpc_completion_queue* cq;
   grpc_polling_entity pollent;
   grpc_channel* channel;
+  /* the registered method this call was created from, if any; its per-method
+     call size estimate outlives the call (registrations live as long as the
+     channel) */
+  grpc_core::RegisteredCall* registered_method;
   gpr_cycle_counter start_time = gpr_get_cycle_counter();
+  /* stage latency sampling: set for one in CALL_LATENCY_SAMPLE_PERIOD
+     calls; stage timestamps are taken as deltas against start_time */
+  bool latency_sampled = false;
+  bool sampled_first_recv_message = false;
   /* parent_call* */ gpr_atm parent_call_atm = 0;
   child_call* child = nullptr;
 
@@ -234,6 +259,23 @@ struct grpc_call {
   grpc_closure receiving_initial_metadata_ready;
   grpc_closure receiving_trailing_metadata_ready;
   uint32_t test_only_last_message_flags = 0;
+
+  /* Receive-side message readahead (see maybe_start_readahead()). All
+     fields below other than the limit, batch and closures are guarded by
+     readahead_mu; the mutex is only taken when readahead_limit > 0. */
+  uint8_t readahead_limit = 0;      /* 0 = disabled */
+  uint8_t readahead_head = 0;       /* oldest buffered message */
+  uint8_t readahead_count = 0;      /* buffered messages */
+  bool readahead_in_flight = false; /* internal recv_message op pending */
+  bool readahead_eos = false;       /* stream finished or failed */
+  grpc_byte_buffer** readahead_queue = nullptr; /* arena; limit slots */
+  grpc_byte_buffer* readahead_slot = nullptr;   /* message being assembled */
+  batch_control* readahead_waiter = nullptr;    /* read waiting on the pull */
+  gpr_mu readahead_mu;
+  grpc_transport_stream_op_batch readahead_batch;
+  grpc_closure readahead_stream_ready;
+  grpc_closure readahead_slice_ready;
+  grpc_closure readahead_start_batch;
   // Status about operation of call
   bool sent_server_trailing_metadata = false;
   gpr_atm cancelled_with_error = 0;
@@ -300,6 +342,7 @@ static void receiving_slice_ready(void* bctlp, grpc_error_handle error);
 static void set_final_status(grpc_call* call, grpc_error_handle error);
 static void process_data_after_md(batch_control* bctl);
 static void post_batch_completion(batch_control* bctl);
+static void maybe_start_readahead(grpc_call* call);
 
 static void add_init_error(grpc_error_handle* composite,
                            grpc_error_handle new_err) {
@@ -340,6 +383,14 @@ size_t grpc_call_get_initial_size_estimate() {
          sizeof(grpc_linked_mdelem) * ESTIMATED_MDELEM_COUNT;
 }
 
+/* Microseconds elapsed since the call was created; used only for sampled
+   calls, so precision is preferred over cost here. */
+static int64_t call_elapsed_micros(grpc_call* call) {
+  const gpr_timespec elapsed =
+      gpr_cycle_counter_sub(gpr_get_cycle_counter(), call->start_time);
+  return elapsed.tv_sec * GPR_US_PER_SEC + elapsed.tv_nsec / GPR_NS_PER_US;
+}
+
 grpc_error_handle grpc_call_create(const grpc_call_create_args* args,
                                    grpc_call** out_call) {
   GPR_TIMER_SCOPE("grpc_call_create", 0);
@@ -351,7 +402,8 @@ grpc_error_handle grpc_call_create(const grpc_call_create_args* args,
   grpc_error_handle error = GRPC_ERROR_NONE;
   grpc_channel_stack* channel_stack =
       grpc_channel_get_channel_stack(args->channel);
-  size_t initial_size = grpc_channel_get_call_size_estimate(args->channel);
+  size_t initial_size = grpc_channel_get_call_size_estimate(
+      args->channel, args->registered_method);
   GRPC_STATS_INC_CALL_INITIAL_SIZE(initial_size);
   size_t call_and_stack_size =
       GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(grpc_call)) +
@@ -364,6 +416,17 @@ grpc_error_handle grpc_call_create(const grpc_call_create_args* args,
   arena = arena_with_call.first;
   call = new (arena_with_call.second) grpc_call(arena, *args);
   *out_call = call;
+  if (GPR_UNLIKELY(++g_call_latency_sample_counter >=
+                   CALL_LATENCY_SAMPLE_PERIOD)) {
+    g_call_latency_sample_counter = 0;
+    call->latency_sampled = true;
+  }
+  const int readahead = grpc_channel_recv_message_readahead(args->channel);
+  if (readahead > 0) {
+    call->readahead_limit = static_cast<uint8_t>(readahead);
+    call->readahead_queue = static_cast<grpc_byte_buffer**>(
+        arena->Alloc(sizeof(grpc_byte_buffer*) * readahead));
+  }
   grpc_slice path = grpc_empty_slice();
   if (call->is_client) {
     call->final_op.client.status_details = nullptr;
@@ -532,9 +595,26 @@ void grpc_call_internal_unref(grpc_call* c REF_ARG) {
 static void release_call(void* call, grpc_error_handle /*error*/) {
   grpc_call* c = static_cast<grpc_call*>(call);
   grpc_channel* channel = c->channel;
+  grpc_core::RegisteredCall* registered_method = c->registered_method;
   grpc_core::Arena* arena = c->arena;
+  // The server's channelz node must be captured before the call is
+  // destroyed; it stays valid below because the channel (still ref'd) holds
+  // the server alive.
+  grpc_core::channelz::ServerNode* channelz_server = nullptr;
+  if (!c->is_client && c->final_op.server.core_server != nullptr) {
+    channelz_server = c->final_op.server.core_server->channelz_node();
+  }
   c->~grpc_call();
-  grpc_channel_update_call_size_estimate(channel, arena->Destroy());
+  const size_t arena_bytes = arena->Destroy();
+  grpc_channel_update_call_size_estimate(channel, registered_method,
+                                         arena_bytes);
+  grpc_core::channelz::ChannelNode* channelz_channel =
+      grpc_channel_get_channelz_node(channel);
+  if (channelz_channel != nullptr) {
+    channelz_channel->RecordCallArenaDestroyed(arena_bytes);
+  } else if (channelz_server != nullptr) {
+    channelz_server->RecordCallArenaDestroyed(arena_bytes);
+  }
   GRPC_CHANNEL_INTERNAL_UNREF(channel, "call");
 }
 
@@ -563,6 +643,11 @@ static void destroy_call(void* call, grpc_error_handle /*error*/) {
   c->status_error.set(GRPC_ERROR_NONE);
   c->final_info.stats.latency =
       gpr_cycle_counter_sub(gpr_get_cycle_counter(), c->start_time);
+  if (GPR_UNLIKELY(c->latency_sampled)) {
+    const gpr_timespec latency = c->final_info.stats.latency;
+    GRPC_STATS_INC_CALL_COMPLETION_US(latency.tv_sec * GPR_US_PER_SEC +
+                                      latency.tv_nsec / GPR_NS_PER_US);
+  }
   grpc_call_stack_destroy(CALL_STACK_FROM_CALL(c), &c->final_info,
                           GRPC_CLOSURE_INIT(&c->release_call, release_call, c,
                                             grpc_schedule_on_exec_ctx));
@@ -895,12 +980,10 @@ static grpc_metadata* get_md_elem(grpc_metadata* metadata,
   return res;
 }
 
-static int prepare_application_metadata(grpc_call* call, int count,
-                                        grpc_metadata* metadata,
-                                        int is_trailing,
-                                        int prepend_extra_metadata,
-                                        grpc_metadata* additional_metadata,
-                                        int additional_metadata_count) {
+static int prepare_application_metadata(
+    grpc_call* call, int count, grpc_metadata* metadata, int is_trailing,
+    int prepend_extra_metadata, grpc_metadata* additional_metadata,
+    int additional_metadata_count, bool no_copy_metadata) {
   int total_count = count + additional_metadata_count;
   int i;
   grpc_metadata_batch* batch =
@@ -909,6 +992,14 @@ static int prepare_application_metadata(grpc_call* call, int count,
     grpc_metadata* md = get_md_elem(metadata, additional_metadata, i, count);
     grpc_linked_mdelem* l = linked_from_md(md);
     GPR_ASSERT(sizeof(grpc_linked_mdelem) == sizeof(md->internal_data));
+    if (no_copy_metadata && i < count) {
+      // Pre-validated via grpc_validated_metadata_create() and backed by
+      // application-owned slices that outlive the call: reference the slices
+      // in place, skipping validation and the interning probes.
+      l->md = grpc_mdelem_create(md->key, md->value,
+                                 reinterpret_cast<grpc_mdelem_data*>(md));
+      continue;
+    }
     if (!GRPC_LOG_IF_ERROR("validate_metadata",
                            grpc_validate_header_key_is_legal(md->key))) {
       break;
@@ -1245,6 +1336,23 @@ static void finish_batch_step(batch_control* bctl) {
   }
 }
 
+/* Allocates the application-visible byte buffer for the message currently
+   held in call->receiving_stream, honoring incoming compression. */
+static grpc_byte_buffer* create_incoming_byte_buffer(grpc_call* call) {
+  call->test_only_last_message_flags = call->receiving_stream->flags();
+  if ((call->receiving_stream->flags() & GRPC_WRITE_INTERNAL_COMPRESS) &&
+      (call->incoming_message_compression_algorithm >
+       GRPC_MESSAGE_COMPRESS_NONE)) {
+    grpc_compression_algorithm algo;
+    GPR_ASSERT(
+        grpc_compression_algorithm_from_message_stream_compression_algorithm(
+            &algo, call->incoming_message_compression_algorithm,
+            (grpc_stream_compression_algorithm)0));
+    return grpc_raw_compressed_byte_buffer_create(nullptr, 0, algo);
+  }
+  return grpc_raw_byte_buffer_create(nullptr, 0);
+}
+
 static void continue_receiving_slices(batch_control* bctl) {
   grpc_error_handle error;
   grpc_call* call = bctl->call;
@@ -1255,6 +1363,7 @@ static void continue_receiving_slices(batch_control* bctl) {
       call->receiving_message = false;
       call->receiving_stream.reset();
       finish_batch_step(bctl);
+      maybe_start_readahead(call);
       return;
     }
     if (call->receiving_stream->Next(remaining, &call->receiving_slice_ready)) {
@@ -1315,22 +1424,19 @@ static void process_data_after_md(batch_control* bctl) {
   if (call->receiving_stream == nullptr) {
     *call->receiving_buffer = nullptr;
     call->receiving_message = false;
+    if (call->readahead_limit > 0) {
+      gpr_mu_lock(&call->readahead_mu);
+      call->readahead_eos = true;
+      gpr_mu_unlock(&call->readahead_mu);
+    }
     finish_batch_step(bctl);
   } else {
-    call->test_only_last_message_flags = call->receiving_stream->flags();
-    if ((call->receiving_stream->flags() & GRPC_WRITE_INTERNAL_COMPRESS) &&
-        (call->incoming_message_compression_algorithm >
-         GRPC_MESSAGE_COMPRESS_NONE)) {
-      grpc_compression_algorithm algo;
-      GPR_ASSERT(
-          grpc_compression_algorithm_from_message_stream_compression_algorithm(
-              &algo, call->incoming_message_compression_algorithm,
-              (grpc_stream_compression_algorithm)0));
-      *call->receiving_buffer =
-          grpc_raw_compressed_byte_buffer_create(nullptr, 0, algo);
-    } else {
-      *call->receiving_buffer = grpc_raw_byte_buffer_create(nullptr, 0);
+    if (GPR_UNLIKELY(call->latency_sampled) &&
+        !call->sampled_first_recv_message) {
+      call->sampled_first_recv_message = true;
+      GRPC_STATS_INC_CALL_FIRST_RECV_MSG_US(call_elapsed_micros(call));
     }
+    *call->receiving_buffer = create_incoming_byte_buffer(call);
     GRPC_CLOSURE_INIT(&call->receiving_slice_ready, receiving_slice_ready, bctl,
                       grpc_schedule_on_exec_ctx);
     continue_receiving_slices(bctl);
@@ -1368,6 +1474,178 @@ static void receiving_stream_ready_in_call_combiner(void* bctlp,
   receiving_stream_ready(bctlp, error);
 }
 
+/* ---- Receive-side message readahead ----
+
+   When GRPC_ARG_EXPERIMENTAL_RECV_MESSAGE_READAHEAD is positive, the call
+   keeps pulling messages from the transport after the first application
+   read completes and buffers up to readahead_limit of them, so streaming
+   reads are served from the buffer instead of waiting a full application/
+   transport round trip per message.
+
+   The internal pull reuses the recv_message payload slots and the shared
+   receiving_stream, so it is never in flight at the same time as an
+   application-armed recv_message op: an application read either takes a
+   buffered message, registers itself as the waiter for the in-flight pull,
+   or (only when the pipeline is empty and idle) arms the transport itself.
+   Readahead starts only after the first application read has finished,
+   which guarantees that the initial-metadata ordering dance in
+   receiving_initial_metadata_ready() has already run. */
+
+/* Ends readahead after a transport error; takes ownership of error. */
+static void readahead_fail(grpc_call* call, grpc_error_handle error) {
+  gpr_mu_lock(&call->readahead_mu);
+  call->readahead_eos = true;
+  call->readahead_in_flight = false;
+  batch_control* waiter = call->readahead_waiter;
+  call->readahead_waiter = nullptr;
+  gpr_mu_unlock(&call->readahead_mu);
+  if (waiter != nullptr) {
+    if (waiter->batch_error.ok()) {
+      waiter->batch_error.set(error);
+    }
+    *call->receiving_buffer = nullptr;
+    call->receiving_message = false;
+    finish_batch_step(waiter);
+  }
+  cancel_with_error(call, error);
+  GRPC_CALL_INTERNAL_UNREF(call, "readahead");
+}
+
+/* The internal pull observed end of stream. */
+static void readahead_finish_eos(grpc_call* call) {
+  gpr_mu_lock(&call->readahead_mu);
+  call->readahead_eos = true;
+  call->readahead_in_flight = false;
+  batch_control* waiter = call->readahead_waiter;
+  call->readahead_waiter = nullptr;
+  gpr_mu_unlock(&call->readahead_mu);
+  if (waiter != nullptr) {
+    *call->receiving_buffer = nullptr;
+    call->receiving_message = false;
+    finish_batch_step(waiter);
+  }
+  GRPC_CALL_INTERNAL_UNREF(call, "readahead");
+}
+
+/* A readahead message has been fully assembled in readahead_slot: hand it
+   to a waiting read if there is one, otherwise buffer it, then keep the
+   pipeline full. */
+static void readahead_message_complete(grpc_call* call) {
+  grpc_byte_buffer* message = call->readahead_slot;
+  call->readahead_slot = nullptr;
+  gpr_mu_lock(&call->readahead_mu);
+  call->readahead_in_flight = false;
+  batch_control* waiter = call->readahead_waiter;
+  call->readahead_waiter = nullptr;
+  if (waiter == nullptr) {
+    call->readahead_queue[(call->readahead_head + call->readahead_count) %
+                          call->readahead_limit] = message;
+    call->readahead_count++;
+  }
+  gpr_mu_unlock(&call->readahead_mu);
+  if (waiter != nullptr) {
+    *call->receiving_buffer = message;
+    call->receiving_message = false;
+    finish_batch_step(waiter);
+  }
+  maybe_start_readahead(call);
+  GRPC_CALL_INTERNAL_UNREF(call, "readahead");
+}
+
+static void readahead_continue_slices(grpc_call* call) {
+  grpc_error_handle error;
+  for (;;) {
+    size_t remaining = call->receiving_stream->length() -
+                       call->readahead_slot->data.raw.slice_buffer.length;
+    if (remaining == 0) {
+      call->receiving_stream.reset();
+      readahead_message_complete(call);
+      return;
+    }
+    if (call->receiving_stream->Next(remaining, &call->readahead_slice_ready)) {
+      error = call->receiving_stream->Pull(&call->receiving_slice);
+      if (error == GRPC_ERROR_NONE) {
+        grpc_slice_buffer_add(&call->readahead_slot->data.raw.slice_buffer,
+                              call->receiving_slice);
+      } else {
+        call->receiving_stream.reset();
+        grpc_byte_buffer_destroy(call->readahead_slot);
+        call->readahead_slot = nullptr;
+        readahead_fail(call, error);
+        return;
+      }
+    } else {
+      return;
+    }
+  }
+}
+
+static void readahead_slice_ready(void* callp, grpc_error_handle error) {
+  grpc_call* call = static_cast<grpc_call*>(callp);
+  if (error == GRPC_ERROR_NONE) {
+    grpc_slice slice;
+    error = call->receiving_stream->Pull(&slice);
+    if (error == GRPC_ERROR_NONE) {
+      grpc_slice_buffer_add(&call->readahead_slot->data.raw.slice_buffer,
+                            slice);
+      readahead_continue_slices(call);
+      return;
+    }
+    /* Error returned by ByteStream::Pull() is owned; fall through. */
+  } else {
+    GRPC_ERROR_REF(error);
+  }
+  call->receiving_stream.reset();
+  grpc_byte_buffer_destroy(call->readahead_slot);
+  call->readahead_slot = nullptr;
+  readahead_fail(call, error);
+}
+
+static void readahead_stream_ready_in_call_combiner(void* callp,
+                                                    grpc_error_handle error) {
+  grpc_call* call = static_cast<grpc_call*>(callp);
+  GRPC_CALL_COMBINER_STOP(&call->call_combiner, "readahead_recv_message_ready");
+  if (error != GRPC_ERROR_NONE) {
+    call->receiving_stream.reset();
+    readahead_fail(call, GRPC_ERROR_REF(error));
+    return;
+  }
+  if (call->receiving_stream == nullptr) {
+    readahead_finish_eos(call);
+    return;
+  }
+  call->readahead_slot = create_incoming_byte_buffer(call);
+  GRPC_CLOSURE_INIT(&call->readahead_slice_ready, readahead_slice_ready, call,
+                    grpc_schedule_on_exec_ctx);
+  readahead_continue_slices(call);
+}
+
+/* Called after a message has been delivered to the application (or after a
+   readahead pull completes) to keep the pipeline full. */
+static void maybe_start_readahead(grpc_call* call) {
+  if (call->readahead_limit == 0) return;
+  gpr_mu_lock(&call->readahead_mu);
+  const bool start = !call->readahead_in_flight && !call->readahead_eos &&
+                     call->readahead_count < call->readahead_limit;
+  if (start) call->readahead_in_flight = true;
+  gpr_mu_unlock(&call->readahead_mu);
+  if (!start) return;
+  GRPC_CALL_INTERNAL_REF(call, "readahead");
+  grpc_transport_stream_op_batch* batch = &call->readahead_batch;
+  *batch = {};
+  batch->payload = &call->stream_op_payload;
+  batch->recv_message = true;
+  call->stream_op_payload.recv_message.recv_message = &call->receiving_stream;
+  call->stream_op_payload.recv_message.call_failed_before_recv_message =
+      &call->call_failed_before_recv_message;
+  GRPC_CLOSURE_INIT(&call->readahead_stream_ready,
+                    readahead_stream_ready_in_call_combiner, call,
+                    grpc_schedule_on_exec_ctx);
+  call->stream_op_payload.recv_message.recv_message_ready =
+      &call->readahead_stream_ready;
+  execute_batch(call, batch, &call->readahead_start_batch);
+}
+
 static void GPR_ATTRIBUTE_NOINLINE
 handle_both_stream_and_msg_compression_set(grpc_call* call) {
   std::string error_msg = absl::StrFormat(
@@ -1554,6 +1832,11 @@ static grpc_call_error call_start_batch(grpc_call* call, const grpc_op* ops,
   grpc_call_error error = GRPC_CALL_OK;
   grpc_transport_stream_op_batch* stream_op;
   grpc_transport_stream_op_batch_payload* stream_op_payload;
+  /* recv_message op satisfied from the readahead queue; delivery is
+     deferred until the whole batch has validated */
+  bool readahead_served = false;
+  grpc_byte_buffer* readahead_message = nullptr;
+  grpc_byte_buffer** readahead_target = nullptr;
 
   GRPC_CALL_LOG_BATCH(GPR_INFO, ops, nops);
 
@@ -1645,10 +1928,14 @@ static grpc_call_error call_start_batch(grpc_call* call, const grpc_op* ops,
         }
         stream_op->send_initial_metadata = true;
         call->sent_initial_metadata = true;
+        if (GPR_UNLIKELY(call->latency_sampled)) {
+          GRPC_STATS_INC_CALL_FIRST_SEND_US(call_elapsed_micros(call));
+        }
         if (!prepare_application_metadata(
                 call, static_cast<int>(op->data.send_initial_metadata.count),
                 op->data.send_initial_metadata.metadata, 0, call->is_client,
-                &compression_md, static_cast<int>(additional_metadata_count))) {
+                &compression_md, static_cast<int>(additional_metadata_count),
+                (op->flags & GRPC_WRITE_METADATA_NO_COPY) != 0)) {
           error = GRPC_CALL_ERROR_INVALID_METADATA;
           goto done_with_error;
         }
@@ -1776,7 +2063,7 @@ static grpc_call_error call_start_batch(grpc_call* call, const grpc_op* ops,
                 static_cast<int>(
                     op->data.send_status_from_server.trailing_metadata_count),
                 op->data.send_status_from_server.trailing_metadata, 1, 1,
-                nullptr, 0)) {
+                nullptr, 0, /*no_copy_metadata=*/false)) {
           for (int n = 0; n < call->send_extra_metadata_count; n++) {
             GRPC_MDELEM_UNREF(call->send_extra_metadata[n].md);
           }
@@ -1832,6 +2119,43 @@ static grpc_call_error call_start_batch(grpc_call* call, const grpc_op* ops,
           error = GRPC_CALL_ERROR_TOO_MANY_OPERATIONS;
           goto done_with_error;
         }
+        if (call->readahead_limit > 0) {
+          /* Take a buffered message (or the end-of-stream marker), or wait
+             on the in-flight pull, before falling back to arming the
+             transport. */
+          grpc_byte_buffer* message = nullptr;
+          bool served = false;
+          bool waiting = false;
+          gpr_mu_lock(&call->readahead_mu);
+          if (call->readahead_count > 0) {
+            message = call->readahead_queue[call->readahead_head];
+            call->readahead_head =
+                (call->readahead_head + 1) % call->readahead_limit;
+            call->readahead_count--;
+            served = true;
+          } else if (call->readahead_eos) {
+            served = true;
+          } else if (call->readahead_in_flight) {
+            call->receiving_buffer = op->data.recv_message.recv_message;
+            call->readahead_waiter = bctl;
+            waiting = true;
+          }
+          if (served || waiting) call->receiving_message = true;
+          gpr_mu_unlock(&call->readahead_mu);
+          if (served) {
+            /* Already complete: contributes no step and no transport op.
+               Delivery happens after the whole batch validates. */
+            readahead_served = true;
+            readahead_message = message;
+            readahead_target = op->data.recv_message.recv_message;
+            break;
+          }
+          if (waiting) {
+            /* The in-flight pull will complete this op's step. */
+            ++num_recv_ops;
+            break;
+          }
+        }
         call->receiving_message = true;
         stream_op->recv_message = true;
         call->receiving_buffer = op->data.recv_message.recv_message;
@@ -1914,11 +2238,16 @@ static grpc_call_error call_start_batch(grpc_call* call, const grpc_op* ops,
     }
   }
 
+  if (readahead_served) {
+    *readahead_target = readahead_message;
+    call->receiving_message = false;
+    maybe_start_readahead(call);
+  }
+
   GRPC_CALL_INTERNAL_REF(call, "completion");
   if (!is_notify_tag_closure) {
     GPR_ASSERT(grpc_cq_begin_op(call->cq, notify_tag));
   }
-  bctl->set_num_steps_to_complete((has_send_ops ? 1 : 0) + num_recv_ops);
 
   if (has_send_ops) {
     GRPC_CLOSURE_INIT(&bctl->finish_batch, finish_batch, bctl,
@@ -1927,13 +2256,45 @@ static grpc_call_error call_start_batch(grpc_call* call, const grpc_op* ops,
   }
 
   gpr_atm_rel_store(&call->any_ops_sent_atm, 1);
-  execute_batch(call, stream_op, &bctl->start_batch);
+  if ((has_send_ops ? 1 : 0) + num_recv_ops == 0) {
+    /* Every op in the batch was served from the readahead queue; complete
+       it at the surface without involving the transport. */
+    bctl->set_num_steps_to_complete(1);
+    finish_batch_step(bctl);
+  } else {
+    bctl->set_num_steps_to_complete((has_send_ops ? 1 : 0) + num_recv_ops);
+    if (has_send_ops || stream_op->recv_initial_metadata ||
+        stream_op->recv_message || stream_op->recv_trailing_metadata) {
+      execute_batch(call, stream_op, &bctl->start_batch);
+    }
+    /* else: a readahead waiter with no other ops; the in-flight pull will
+       complete the batch. */
+  }
 
 done:
   return error;
 
 done_with_error:
   /* reverse any mutations that occurred */
+  if (call->readahead_limit > 0) {
+    gpr_mu_lock(&call->readahead_mu);
+    if (call->readahead_waiter == bctl) {
+      call->readahead_waiter = nullptr;
+      call->receiving_message = false;
+    }
+    if (readahead_served) {
+      if (readahead_message != nullptr) {
+        /* put the message back at the front of the queue */
+        call->readahead_head =
+            (call->readahead_head + call->readahead_limit - 1) %
+            call->readahead_limit;
+        call->readahead_queue[call->readahead_head] = readahead_message;
+        call->readahead_count++;
+      }
+      call->receiving_message = false;
+    }
+    gpr_mu_unlock(&call->readahead_mu);
+  }
   if (stream_op->send_initial_metadata) {
     call->sent_initial_metadata = false;
     call->metadata_batch[0][0].Clear();
@@ -33,6 +33,10 @@
 typedef void (*grpc_ioreq_completion_func)(grpc_call* call, int success,
                                            void* user_data);
 
+namespace grpc_core {
+struct RegisteredCall;
+}
+
 typedef struct grpc_call_create_args {
   grpc_channel* channel;
   grpc_core::Server* server;
@@ -50,6 +54,10 @@ typedef struct grpc_call_create_args {
   size_t add_initial_metadata_count;
 
   grpc_millis send_deadline;
+
+  /* if not NULL, the registered method this call was created from; used to
+     track a per-method call size estimate */
+  grpc_core::RegisteredCall* registered_method;
 } grpc_call_create_args;
 
 /* Create a new call based on \a args.
@@ -104,6 +104,7 @@ grpc_channel* grpc_channel_create_with_builder(
           grpc_call_get_initial_size_estimate());
 
   grpc_compression_options_init(&channel->compression_options);
+  channel->recv_message_readahead = 0;
   for (size_t i = 0; i < args->num_args; i++) {
     if (0 ==
         strcmp(args->args[i].key, GRPC_COMPRESSION_CHANNEL_DEFAULT_LEVEL)) {
@@ -126,6 +127,10 @@ grpc_channel* grpc_channel_create_with_builder(
       channel->compression_options.enabled_algorithms_bitset =
           static_cast<uint32_t>(args->args[i].value.integer) |
           0x1; /* always support no compression */
+    } else if (0 == strcmp(args->args[i].key,
+                           GRPC_ARG_EXPERIMENTAL_RECV_MESSAGE_READAHEAD)) {
+      channel->recv_message_readahead =
+          grpc_channel_arg_get_integer(&args->args[i], {0, 0, 64});
     } else if (0 == strcmp(args->args[i].key, GRPC_ARG_CHANNELZ_CHANNEL_NODE)) {
       if (args->args[i].type == GRPC_ARG_POINTER) {
         GPR_ASSERT(args->args[i].value.pointer.p != nullptr);
@@ -293,7 +298,7 @@ grpc_channel* grpc_channel_create(const char* target,
   return channel;
 }
 
-size_t grpc_channel_get_call_size_estimate(grpc_channel* channel) {
+static size_t round_up_call_size_estimate(size_t estimate) {
 #define ROUND_UP_SIZE 256
   /* We round up our current estimate to the NEXT value of ROUND_UP_SIZE.
      This ensures:
@@ -301,20 +306,30 @@ size_t grpc_channel_get_call_size_estimate(grpc_channel* channel) {
          (which is common) - which tends to help most allocators reuse memory
       2. a small amount of allowed growth over the estimate without hitting
          the arena size doubling case, reducing overall memory usage */
-  return (static_cast<size_t>(
-              gpr_atm_no_barrier_load(&channel->call_size_estimate)) +
-          2 * ROUND_UP_SIZE) &
+  return (estimate + 2 * ROUND_UP_SIZE) &
          ~static_cast<size_t>(ROUND_UP_SIZE - 1);
 }
 
-void grpc_channel_update_call_size_estimate(grpc_channel* channel,
-                                            size_t size) {
-  size_t cur = static_cast<size_t>(
-      gpr_atm_no_barrier_load(&channel->call_size_estimate));
+size_t grpc_channel_get_call_size_estimate(
+    grpc_channel* channel, grpc_core::RegisteredCall* registered_method) {
+  if (registered_method != nullptr) {
+    size_t method_estimate = static_cast<size_t>(
+        gpr_atm_no_barrier_load(&registered_method->call_size_estimate));
+    if (method_estimate != 0) {
+      return round_up_call_size_estimate(method_estimate);
+    }
+    /* No call on this method has completed yet: fall back to the channel-wide
+       estimate. */
+  }
+  return round_up_call_size_estimate(static_cast<size_t>(
+      gpr_atm_no_barrier_load(&channel->call_size_estimate)));
+}
+
+static void update_call_size_estimate(gpr_atm* estimate, size_t size) {
+  size_t cur = static_cast<size_t>(gpr_atm_no_barrier_load(estimate));
   if (cur < size) {
     /* size grew: update estimate */
-    gpr_atm_no_barrier_cas(&channel->call_size_estimate,
-                           static_cast<gpr_atm>(cur),
+    gpr_atm_no_barrier_cas(estimate, static_cast<gpr_atm>(cur),
                            static_cast<gpr_atm>(size));
     /* if we lose: never mind, something else will likely update soon enough */
   } else if (cur == size) {
@@ -322,12 +337,26 @@ void grpc_channel_update_call_size_estimate(grpc_channel* channel,
   } else if (cur > 0) {
     /* size shrank: decrease estimate */
     gpr_atm_no_barrier_cas(
-        &channel->call_size_estimate, static_cast<gpr_atm>(cur),
+        estimate, static_cast<gpr_atm>(cur),
         static_cast<gpr_atm>(std::min(cur - 1, (255 * cur + size) / 256)));
     /* if we lose: never mind, something else will likely update soon enough */
   }
 }
 
+void grpc_channel_update_call_size_estimate(
+    grpc_channel* channel, grpc_core::RegisteredCall* registered_method,
+    size_t size) {
+  if (registered_method != nullptr) {
+    /* Registered calls feed their own estimate so that, e.g., a streaming
+       method does not inflate the arenas of a tiny unary method sharing the
+       channel. The first completed call seeds the estimate via the grow
+       branch in update_call_size_estimate. */
+    update_call_size_estimate(&registered_method->call_size_estimate, size);
+    return;
+  }
+  update_call_size_estimate(&channel->call_size_estimate, size);
+}
+
 char* grpc_channel_get_target(grpc_channel* channel) {
   GRPC_API_TRACE("grpc_channel_get_target(channel=%p)", 1, (channel));
   return gpr_strdup(channel->target);
@@ -358,7 +387,7 @@ static grpc_call* grpc_channel_create_call_internal(
     grpc_channel* channel, grpc_call* parent_call, uint32_t propagation_mask,
     grpc_completion_queue* cq, grpc_pollset_set* pollset_set_alternative,
     grpc_mdelem path_mdelem, grpc_mdelem authority_mdelem,
-    grpc_millis deadline) {
+    grpc_millis deadline, grpc_core::RegisteredCall* registered_method) {
   grpc_mdelem send_metadata[2];
   size_t num_metadata = 0;
 
@@ -381,6 +410,7 @@ static grpc_call* grpc_channel_create_call_internal(
   args.add_initial_metadata = send_metadata;
   args.add_initial_metadata_count = num_metadata;
   args.send_deadline = deadline;
+  args.registered_method = registered_method;
 
   grpc_call* call;
   GRPC_LOG_IF_ERROR("call_create", grpc_call_create(&args, &call));
@@ -401,7 +431,7 @@ grpc_call* grpc_channel_create_call(grpc_channel* channel,
       grpc_mdelem_create(GRPC_MDSTR_PATH, method, nullptr),
       host != nullptr ? grpc_mdelem_create(GRPC_MDSTR_AUTHORITY, *host, nullptr)
                       : GRPC_MDNULL,
-      grpc_timespec_to_millis_round_up(deadline));
+      grpc_timespec_to_millis_round_up(deadline), /*registered_method=*/nullptr);
 
   return call;
 }
@@ -416,7 +446,7 @@ grpc_call* grpc_channel_create_pollset_set_call(
       grpc_mdelem_create(GRPC_MDSTR_PATH, method, nullptr),
       host != nullptr ? grpc_mdelem_create(GRPC_MDSTR_AUTHORITY, *host, nullptr)
                       : GRPC_MDNULL,
-      deadline);
+      deadline, /*registered_method=*/nullptr);
 }
 
 namespace grpc_core {
@@ -504,7 +534,7 @@ grpc_call* grpc_channel_create_registered_call(
   grpc_call* call = grpc_channel_create_call_internal(
       channel, parent_call, propagation_mask, completion_queue, nullptr,
       GRPC_MDELEM_REF(rc->path), GRPC_MDELEM_REF(rc->authority),
-      grpc_timespec_to_millis_round_up(deadline));
+      grpc_timespec_to_millis_round_up(deadline), rc);
 
   return call;
 }
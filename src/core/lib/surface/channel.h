@@ -76,8 +76,21 @@ grpc_channel_stack* grpc_channel_get_channel_stack(grpc_channel* channel);
 grpc_core::channelz::ChannelNode* grpc_channel_get_channelz_node(
     grpc_channel* channel);
 
-size_t grpc_channel_get_call_size_estimate(grpc_channel* channel);
-void grpc_channel_update_call_size_estimate(grpc_channel* channel, size_t size);
+namespace grpc_core {
+struct RegisteredCall;
+}
+
+/// Returns the initial arena size estimate for a new call. If \a
+/// registered_method is non-null and calls on that method have completed
+/// before, the method's own estimate is used; otherwise the channel-wide
+/// estimate is used. This keeps a channel that mixes tiny unary calls with
+/// large streaming calls from over-allocating the former or re-allocating
+/// mid-call for the latter.
+size_t grpc_channel_get_call_size_estimate(
+    grpc_channel* channel, grpc_core::RegisteredCall* registered_method);
+void grpc_channel_update_call_size_estimate(
+    grpc_channel* channel, grpc_core::RegisteredCall* registered_method,
+    size_t size);
 
 namespace grpc_core {
 
@@ -90,6 +103,11 @@ struct RegisteredCall {
   grpc_mdelem path;
   grpc_mdelem authority;
 
+  // Per-method call size estimate; 0 until the first call on this method
+  // completes, after which it tracks the arena high-water mark of calls
+  // created from this registration.
+  gpr_atm call_size_estimate = 0;
+
   explicit RegisteredCall(const char* method_arg, const char* host_arg);
   // TODO(vjpai): delete copy constructor once all supported compilers allow
   //              std::map value_type to be MoveConstructible.
@@ -116,6 +134,10 @@ struct CallRegistrationTable {
 struct grpc_channel {
   int is_client;
   grpc_compression_options compression_options;
+  /* max decoded incoming messages calls may buffer ahead of application
+     reads; 0 disables readahead (see
+     GRPC_ARG_EXPERIMENTAL_RECV_MESSAGE_READAHEAD) */
+  int recv_message_readahead;
 
   gpr_atm call_size_estimate;
   grpc_resource_user* resource_user;
@@ -139,6 +161,10 @@ inline grpc_compression_options grpc_channel_compression_options(
   return channel->compression_options;
 }
 
+inline int grpc_channel_recv_message_readahead(const grpc_channel* channel) {
+  return channel->recv_message_readahead;
+}
+
 inline grpc_channel_stack* grpc_channel_get_channel_stack(
     grpc_channel* channel) {
   return CHANNEL_STACK_FROM_CHANNEL(channel);
@@ -20,7 +20,14 @@
 
 #include "src/core/lib/surface/channel_init.h"
 
+#include <string.h>
+
 #include <grpc/support/alloc.h>
+#include <grpc/support/sync.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/surface/init.h"
+#include "src/core/lib/transport/transport_impl.h"
 
 typedef struct stage_slot {
   grpc_channel_init_stage fn;
@@ -38,12 +45,40 @@ typedef struct stage_slots {
 static stage_slots g_slots[GRPC_NUM_CHANNEL_STACK_TYPES];
 static bool g_finalized;
 
+/* The filter list the stages produce is a pure function of the stack type,
+   the channel args and the transport's vtable: every registered stage
+   consults only those inputs (channel_init.h already requires that
+   GRPC_CLIENT_SUBCHANNEL stages be distinguishable by args alone). Building
+   the same kind of channel repeatedly therefore re-derives the same list, so
+   we memoize it and replay it on later builds, skipping stage evaluation. */
+
+#define MAX_CACHED_STACKS_PER_TYPE 32
+
+typedef struct cached_stack {
+  struct cached_stack* next;
+  grpc_channel_args* args;    /* normalized copy, owned */
+  const char* transport_name; /* static vtable name, or null */
+  grpc_channel_stack_builder_filter_entry* filters;
+  /* filters[i].user_data pointed at the transport when recorded (the
+     connected filter binds it for post-init) and must be rebound to the
+     current builder's transport when replayed */
+  bool* rebind_transport;
+  size_t num_filters;
+} cached_stack;
+
+static gpr_mu g_cached_stacks_mu;
+static cached_stack* g_cached_stacks[GRPC_NUM_CHANNEL_STACK_TYPES];
+static size_t g_num_cached_stacks[GRPC_NUM_CHANNEL_STACK_TYPES];
+
 void grpc_channel_init_init(void) {
   for (int i = 0; i < GRPC_NUM_CHANNEL_STACK_TYPES; i++) {
     g_slots[i].slots = nullptr;
     g_slots[i].num_slots = 0;
     g_slots[i].cap_slots = 0;
+    g_cached_stacks[i] = nullptr;
+    g_num_cached_stacks[i] = 0;
   }
+  gpr_mu_init(&g_cached_stacks_mu);
   g_finalized = false;
 }
 
@@ -89,16 +124,122 @@ void grpc_channel_init_shutdown(void) {
     gpr_free(g_slots[i].slots);
     g_slots[i].slots =
         static_cast<stage_slot*>(reinterpret_cast<void*>(0xdeadbeef));
+    cached_stack* c = g_cached_stacks[i];
+    while (c != nullptr) {
+      cached_stack* next = c->next;
+      grpc_channel_args_destroy(c->args);
+      gpr_free(c->filters);
+      gpr_free(c->rebind_transport);
+      gpr_free(c);
+      c = next;
+    }
+    g_cached_stacks[i] = nullptr;
+    g_num_cached_stacks[i] = 0;
   }
+  gpr_mu_destroy(&g_cached_stacks_mu);
+}
+
+static const char* builder_transport_name(grpc_channel_stack_builder* builder) {
+  grpc_transport* transport = grpc_channel_stack_builder_get_transport(builder);
+  return transport == nullptr ? nullptr : transport->vtable->name;
+}
+
+/* grpc_channel_args_normalize requires non-null input; builders for lame
+   channels can legitimately carry no args at all. */
+static grpc_channel_args* normalized_builder_args(
+    grpc_channel_stack_builder* builder) {
+  const grpc_channel_args* args =
+      grpc_channel_stack_builder_get_channel_arguments(builder);
+  return args == nullptr ? nullptr : grpc_channel_args_normalize(args);
+}
+
+static cached_stack* find_cached_stack_locked(grpc_channel_stack_type type,
+                                              const char* transport_name,
+                                              const grpc_channel_args* args) {
+  for (cached_stack* c = g_cached_stacks[type]; c != nullptr; c = c->next) {
+    if ((c->transport_name == nullptr) != (transport_name == nullptr)) continue;
+    if (transport_name != nullptr &&
+        strcmp(c->transport_name, transport_name) != 0) {
+      continue;
+    }
+    if (grpc_channel_args_compare(c->args, args) == 0) return c;
+  }
+  return nullptr;
+}
+
+/* If a previous build with the same inputs was recorded, append its filter
+   list to \a builder and return true; otherwise return false and leave the
+   builder untouched. */
+static bool replay_cached_stack(grpc_channel_stack_builder* builder,
+                                grpc_channel_stack_type type) {
+  grpc_channel_args* args = normalized_builder_args(builder);
+  bool replayed = false;
+  gpr_mu_lock(&g_cached_stacks_mu);
+  cached_stack* c =
+      find_cached_stack_locked(type, builder_transport_name(builder), args);
+  if (c != nullptr) {
+    grpc_transport* transport =
+        grpc_channel_stack_builder_get_transport(builder);
+    for (size_t i = 0; i < c->num_filters; i++) {
+      const grpc_channel_stack_builder_filter_entry* e = &c->filters[i];
+      GPR_ASSERT(grpc_channel_stack_builder_append_filter(
+          builder, e->filter, e->post_init_func,
+          c->rebind_transport[i] ? transport : e->user_data));
+    }
+    replayed = true;
+  }
+  gpr_mu_unlock(&g_cached_stacks_mu);
+  grpc_channel_args_destroy(args);
+  return replayed;
+}
+
+static void record_cached_stack(grpc_channel_stack_builder* builder,
+                                grpc_channel_stack_type type) {
+  const char* transport_name = builder_transport_name(builder);
+  grpc_transport* transport = grpc_channel_stack_builder_get_transport(builder);
+  grpc_channel_args* args = normalized_builder_args(builder);
+  gpr_mu_lock(&g_cached_stacks_mu);
+  /* The size cap keeps the cache bounded: distinct pointer-valued args
+     (credentials, resource quotas, ...) compare unequal, and each cached
+     entry pins a copy of its args until shutdown. A concurrent build of the
+     same stack may have raced us here, so re-check for a match too. */
+  if (g_num_cached_stacks[type] >= MAX_CACHED_STACKS_PER_TYPE ||
+      find_cached_stack_locked(type, transport_name, args) != nullptr) {
+    gpr_mu_unlock(&g_cached_stacks_mu);
+    grpc_channel_args_destroy(args);
+    return;
+  }
+  cached_stack* c = static_cast<cached_stack*>(gpr_malloc(sizeof(*c)));
+  c->args = args;
+  c->transport_name = transport_name;
+  c->num_filters = grpc_channel_stack_builder_num_filters(builder);
+  c->filters = static_cast<grpc_channel_stack_builder_filter_entry*>(
+      gpr_malloc(sizeof(*c->filters) * c->num_filters));
+  grpc_channel_stack_builder_export_filters(builder, c->filters);
+  c->rebind_transport =
+      static_cast<bool*>(gpr_malloc(sizeof(bool) * c->num_filters));
+  for (size_t i = 0; i < c->num_filters; i++) {
+    c->rebind_transport[i] =
+        transport != nullptr && c->filters[i].user_data == transport;
+  }
+  c->next = g_cached_stacks[type];
+  g_cached_stacks[type] = c;
+  g_num_cached_stacks[type]++;
+  gpr_mu_unlock(&g_cached_stacks_mu);
 }
 
 bool grpc_channel_init_create_stack(grpc_channel_stack_builder* builder,
                                     grpc_channel_stack_type type) {
+  /* plugin loading (which registers the stages below) is deferred from
+     grpc_init() to first use */
+  grpc_ensure_plugins_loaded();
   GPR_ASSERT(g_finalized);
 
   grpc_channel_stack_builder_set_name(builder,
                                       grpc_channel_stack_type_string(type));
 
+  if (replay_cached_stack(builder, type)) return true;
+
   for (size_t i = 0; i < g_slots[type].num_slots; i++) {
     const stage_slot* slot = &g_slots[type].slots[i];
     if (!slot->fn(builder, slot->arg)) {
@@ -106,5 +247,6 @@ bool grpc_channel_init_create_stack(grpc_channel_stack_builder* builder,
     }
   }
 
+  record_cached_stack(builder, type);
   return true;
 }
@@ -26,6 +26,16 @@
 #include <atomic>
 #include <vector>
 
+#ifdef GPR_LINUX
+#include <errno.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+/* Park non-polling cq workers directly on a futex word instead of a
+   pthread condvar. */
+#define GRPC_CQ_FUTEX_WAIT 1
+#endif
+
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_join.h"
 
@@ -39,6 +49,8 @@
 #include "src/core/lib/gpr/spinlock.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gpr/tls.h"
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/iomgr/executor.h"
 #include "src/core/lib/iomgr/pollset.h"
 #include "src/core/lib/iomgr/timer.h"
@@ -51,6 +63,14 @@ grpc_core::TraceFlag grpc_trace_operation_failures(false, "op_failure");
 grpc_core::DebugOnlyTraceFlag grpc_trace_pending_tags(false, "pending_tags");
 grpc_core::DebugOnlyTraceFlag grpc_trace_cq_refcount(false, "cq_refcount");
 
+GPR_GLOBAL_CONFIG_DEFINE_BOOL(
+    grpc_cq_inline_callback_dispatch, false,
+    "If set, functors marked inlineable on a callback completion queue are "
+    "run on the thread that generated the completion instead of being handed "
+    "to the executor. This removes a thread hop per reaction at the cost of "
+    "running the callback on a transport thread; enable only when callbacks "
+    "are short and never block.");
+
 namespace {
 
 // Specifies a cq thread local cache.
@@ -78,12 +98,58 @@ struct cq_poller_vtable {
   void (*destroy)(grpc_pollset* pollset);
 };
 typedef struct non_polling_worker {
+#ifdef GRPC_CQ_FUTEX_WAIT
+  /* futex word: 0 while parked, becomes 1 once signaled */
+  std::atomic<uint32_t> wake{0};
+#else
   gpr_cv cv;
+#endif
   bool kicked;
   struct non_polling_worker* next;
   struct non_polling_worker* prev;
 } non_polling_worker;
 
+#ifdef GRPC_CQ_FUTEX_WAIT
+/* Block the calling worker on its futex word until it is signaled or \a
+   deadline_ts (monotonic) passes; \a mu is released while blocked, mirroring
+   gpr_cv_wait. Returns true on timeout, false otherwise (including spurious
+   wakeups, which the caller's loop absorbs by re-checking its predicate). */
+static bool non_polling_worker_wait(non_polling_worker* w, gpr_mu* mu,
+                                    gpr_timespec deadline_ts) {
+  struct timespec ts;
+  struct timespec* tsp = nullptr;
+  bool timed_out = false;
+  if (gpr_time_cmp(deadline_ts, gpr_inf_future(GPR_CLOCK_MONOTONIC)) < 0) {
+    gpr_timespec delta =
+        gpr_time_sub(deadline_ts, gpr_now(GPR_CLOCK_MONOTONIC));
+    if (gpr_time_cmp(delta, gpr_time_0(GPR_TIMESPAN)) <= 0) {
+      return true;
+    }
+    ts.tv_sec = static_cast<time_t>(delta.tv_sec);
+    ts.tv_nsec = delta.tv_nsec;
+    tsp = &ts;
+  }
+  gpr_mu_unlock(mu);
+  /* The wake word makes a signal sent between the unlock above and the
+     syscall below observable: FUTEX_WAIT returns immediately once the word
+     is no longer 0. */
+  if (w->wake.load(std::memory_order_acquire) == 0) {
+    int rc = static_cast<int>(
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&w->wake),
+                FUTEX_WAIT | FUTEX_PRIVATE_FLAG, 0, tsp, nullptr, 0));
+    timed_out = rc != 0 && errno == ETIMEDOUT;
+  }
+  gpr_mu_lock(mu);
+  return timed_out;
+}
+
+static void non_polling_worker_signal(non_polling_worker* w) {
+  w->wake.store(1, std::memory_order_release);
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(&w->wake),
+          FUTEX_WAKE | FUTEX_PRIVATE_FLAG, 1, nullptr, nullptr, 0);
+}
+#endif /* GRPC_CQ_FUTEX_WAIT */
+
 struct non_polling_poller {
   gpr_mu mu;
   bool kicked_without_poller;
@@ -113,7 +179,9 @@ grpc_error_handle non_polling_poller_work(grpc_pollset* pollset,
     return GRPC_ERROR_NONE;
   }
   non_polling_worker w;
+#ifndef GRPC_CQ_FUTEX_WAIT
   gpr_cv_init(&w.cv);
+#endif
   if (worker != nullptr) *worker = reinterpret_cast<grpc_pollset_worker*>(&w);
   if (npp->root == nullptr) {
     npp->root = w.next = w.prev = &w;
@@ -125,9 +193,15 @@ grpc_error_handle non_polling_poller_work(grpc_pollset* pollset,
   w.kicked = false;
   gpr_timespec deadline_ts =
       grpc_millis_to_timespec(deadline, GPR_CLOCK_MONOTONIC);
+#ifdef GRPC_CQ_FUTEX_WAIT
+  while (!npp->shutdown && !w.kicked &&
+         !non_polling_worker_wait(&w, &npp->mu, deadline_ts)) {
+  }
+#else
   while (!npp->shutdown && !w.kicked &&
          !gpr_cv_wait(&w.cv, &npp->mu, deadline_ts)) {
   }
+#endif
   grpc_core::ExecCtx::Get()->InvalidateNow();
   if (&w == npp->root) {
     npp->root = w.next;
@@ -140,7 +214,9 @@ grpc_error_handle non_polling_poller_work(grpc_pollset* pollset,
   }
   w.next->prev = w.prev;
   w.prev->next = w.next;
+#ifndef GRPC_CQ_FUTEX_WAIT
   gpr_cv_destroy(&w.cv);
+#endif
   if (worker != nullptr) *worker = nullptr;
   return GRPC_ERROR_NONE;
 }
@@ -156,7 +232,11 @@ grpc_error_handle non_polling_poller_kick(
         reinterpret_cast<non_polling_worker*>(specific_worker);
     if (!w->kicked) {
       w->kicked = true;
+#ifdef GRPC_CQ_FUTEX_WAIT
+      non_polling_worker_signal(w);
+#else
       gpr_cv_signal(&w->cv);
+#endif
     }
   } else {
     p->kicked_without_poller = true;
@@ -173,7 +253,11 @@ void non_polling_poller_shutdown(grpc_pollset* pollset, grpc_closure* closure) {
   } else {
     non_polling_worker* w = p->root;
     do {
+#ifdef GRPC_CQ_FUTEX_WAIT
+      non_polling_worker_signal(w);
+#else
       gpr_cv_signal(&w->cv);
+#endif
       w = w->next;
     } while (w != p->root);
   }
@@ -212,9 +296,33 @@ struct cq_vtable {
 
 namespace {
 
+/* Ordinal handed to each thread the first time it pops from a CqEventQueue,
+   used to give every consumer thread a home shard. 0 means unassigned. */
+std::atomic<uint32_t> g_cq_consumer_ordinal_source{0};
+GPR_THREAD_LOCAL(uint32_t) g_cq_consumer_ordinal;
+
+uint32_t CqConsumerOrdinal() {
+  uint32_t ordinal = g_cq_consumer_ordinal;
+  if (GPR_UNLIKELY(ordinal == 0)) {
+    ordinal =
+        g_cq_consumer_ordinal_source.fetch_add(1, std::memory_order_relaxed) +
+        1;
+    g_cq_consumer_ordinal = ordinal;
+  }
+  return ordinal;
+}
+
 /* Queue that holds the cq_completion_events. Internally uses
  * MultiProducerSingleConsumerQueue (a lockfree multiproducer single consumer
- * queue). It uses a queue_lock to support multiple consumers.
+ * queue), with a queue_lock to support multiple consumers. So that several
+ * threads calling grpc_completion_queue_next() on the same cq do not
+ * serialize on one lock (or contend one MPSC tail), the events are spread
+ * over a small fixed set of such queues: producers pick a shard by hashing
+ * the completion storage address (keeping any one batch's events on one
+ * shard) and each consumer thread tries a home shard first, scanning the
+ * remaining shards only when its own is empty. The completion queue API
+ * makes no ordering promises across distinct operations, so cross-shard
+ * reordering is not observable as a semantic change.
  * Only used in completion queues whose completion_type is GRPC_CQ_NEXT */
 class CqEventQueue {
  public:
@@ -231,14 +339,22 @@ class CqEventQueue {
   grpc_cq_completion* Pop();
 
  private:
-  /* Spinlock to serialize consumers i.e pop() operations */
-  gpr_spinlock queue_lock_ = GPR_SPINLOCK_INITIALIZER;
+  static constexpr size_t kNumShards = 8;
+
+  struct Shard {
+    /* Spinlock to serialize consumers i.e pop() operations */
+    gpr_spinlock queue_lock = GPR_SPINLOCK_INITIALIZER;
 
-  grpc_core::MultiProducerSingleConsumerQueue queue_;
+    grpc_core::MultiProducerSingleConsumerQueue queue;
+  };
 
-  /* A lazy counter of number of items in the queue. This is NOT atomically
-     incremented/decremented along with push/pop operations and hence is only
-     eventually consistent */
+  static grpc_cq_completion* PopFromShard(Shard* shard);
+
+  Shard shards_[kNumShards];
+
+  /* A lazy counter of number of items across all shards. This is NOT
+     atomically incremented/decremented along with push/pop operations and
+     hence is only eventually consistent */
   std::atomic<intptr_t> num_queue_items_{0};
 };
 
@@ -310,7 +426,9 @@ struct cq_pluck_data {
 
 struct cq_callback_data {
   explicit cq_callback_data(grpc_completion_queue_functor* shutdown_callback)
-      : shutdown_callback(shutdown_callback) {}
+      : inline_dispatch(
+            GPR_GLOBAL_CONFIG_GET(grpc_cq_inline_callback_dispatch)),
+        shutdown_callback(shutdown_callback) {}
 
   ~cq_callback_data() {
 #ifndef NDEBUG
@@ -320,6 +438,10 @@ struct cq_callback_data {
 #endif
   }
 
+  /** Whether inlineable functors may be run directly on the thread that
+      generated the completion (read once at CQ creation). */
+  const bool inline_dispatch;
+
   /** No actual completed events queue, unlike other types */
 
   /** Number of pending events (+1 if we're not shutdown).
@@ -474,20 +596,22 @@ int grpc_completion_queue_thread_local_cache_flush(grpc_completion_queue* cq,
 }
 
 bool CqEventQueue::Push(grpc_cq_completion* c) {
-  queue_.Push(
+  Shard* shard = &shards_[grpc_core::HashPointer(c, kNumShards)];
+  shard->queue.Push(
       reinterpret_cast<grpc_core::MultiProducerSingleConsumerQueue::Node*>(c));
   return num_queue_items_.fetch_add(1, std::memory_order_relaxed) == 0;
 }
 
-grpc_cq_completion* CqEventQueue::Pop() {
+grpc_cq_completion* CqEventQueue::PopFromShard(Shard* shard) {
   grpc_cq_completion* c = nullptr;
 
-  if (gpr_spinlock_trylock(&queue_lock_)) {
+  if (gpr_spinlock_trylock(&shard->queue_lock)) {
     GRPC_STATS_INC_CQ_EV_QUEUE_TRYLOCK_SUCCESSES();
 
     bool is_empty = false;
-    c = reinterpret_cast<grpc_cq_completion*>(queue_.PopAndCheckEnd(&is_empty));
-    gpr_spinlock_unlock(&queue_lock_);
+    c = reinterpret_cast<grpc_cq_completion*>(
+        shard->queue.PopAndCheckEnd(&is_empty));
+    gpr_spinlock_unlock(&shard->queue_lock);
 
     if (c == nullptr && !is_empty) {
       GRPC_STATS_INC_CQ_EV_QUEUE_TRANSIENT_POP_FAILURES();
@@ -496,6 +620,16 @@ grpc_cq_completion* CqEventQueue::Pop() {
     GRPC_STATS_INC_CQ_EV_QUEUE_TRYLOCK_FAILURES();
   }
 
+  return c;
+}
+
+grpc_cq_completion* CqEventQueue::Pop() {
+  const uint32_t home = CqConsumerOrdinal();
+  grpc_cq_completion* c = nullptr;
+  for (size_t i = 0; i < kNumShards && c == nullptr; i++) {
+    c = PopFromShard(&shards_[(home + i) % kNumShards]);
+  }
+
   if (c) {
     num_queue_items_.fetch_sub(1, std::memory_order_relaxed);
   }
@@ -877,6 +1011,20 @@ static void cq_end_op_for_callback(
     return;
   }
 
+  // If the CQ opted in to inline dispatch and the functor is marked
+  // inlineable, run it here on the thread that generated the completion
+  // instead of hopping to the executor. The stack-local
+  // ApplicationCallbackExecCtx turns any callbacks generated further down
+  // the stack into an iterative drain at scope exit, so inline dispatch
+  // does not recurse.
+  if (cqd->inline_dispatch && functor->inlineable) {
+    grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+    grpc_core::ApplicationCallbackExecCtx::Enqueue(functor,
+                                                   (error == GRPC_ERROR_NONE));
+    GRPC_ERROR_UNREF(error);
+    return;
+  }
+
   // Schedule the callback on a closure if not internal or triggered
   // from a background poller thread.
   grpc_core::Executor::Run(
@@ -1126,6 +1274,26 @@ grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
   return cq->vtable->next(cq, deadline, reserved);
 }
 
+size_t grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                        grpc_event* events, size_t max_events,
+                                        gpr_timespec deadline,
+                                        void* reserved) {
+  if (max_events == 0) return 0;
+  /* Only the first event may block; the remainder of the batch is drained
+     with an immediate deadline, which pops straight off the cq's event queue
+     without re-entering the pollset. */
+  events[0] = cq->vtable->next(cq, deadline, reserved);
+  size_t n = 1;
+  if (events[0].type != GRPC_OP_COMPLETE) return n;
+  const gpr_timespec drain_deadline = gpr_inf_past(GPR_CLOCK_REALTIME);
+  while (n < max_events) {
+    grpc_event ev = cq->vtable->next(cq, drain_deadline, reserved);
+    if (ev.type != GRPC_OP_COMPLETE) break;
+    events[n++] = ev;
+  }
+  return n;
+}
+
 static int add_plucker(grpc_completion_queue* cq, void* tag,
                        grpc_pollset_worker** worker) {
   cq_pluck_data* cqd = static_cast<cq_pluck_data*> DATA_FROM_CQ(cq);
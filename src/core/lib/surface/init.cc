@@ -23,6 +23,8 @@
 #include <limits.h>
 #include <memory.h>
 
+#include <atomic>
+
 #include <grpc/fork.h>
 #include <grpc/grpc.h>
 #include <grpc/support/alloc.h>
@@ -67,9 +69,13 @@ static int g_initializations ABSL_GUARDED_BY(g_init_mu) = 0;
 static grpc_core::CondVar* g_shutting_down_cv;
 static bool g_shutting_down ABSL_GUARDED_BY(g_init_mu) = false;
 
+static grpc_core::Mutex* g_plugin_mu;
+static std::atomic<bool> g_plugins_loaded{false};
+
 static void do_basic_init(void) {
   gpr_log_verbosity_init();
   g_init_mu = new grpc_core::Mutex();
+  g_plugin_mu = new grpc_core::Mutex();
   g_shutting_down_cv = new grpc_core::CondVar();
   grpc_register_built_in_plugins();
   grpc_cq_global_init();
@@ -122,6 +128,33 @@ void grpc_register_plugin(void (*init)(void), void (*destroy)(void)) {
   g_number_of_plugins++;
 }
 
+void grpc_ensure_plugins_loaded(void) {
+  if (g_plugins_loaded.load(std::memory_order_acquire)) return;
+  grpc_core::MutexLock lock(g_plugin_mu);
+  if (g_plugins_loaded.load(std::memory_order_relaxed)) return;
+  /* Note: plugin initializers may only register factories and filters;
+     they must not consult the registries they populate (doing so here
+     would deadlock). */
+  for (int i = 0; i < g_number_of_plugins; i++) {
+    if (g_all_of_the_plugins[i].init != nullptr) {
+      g_all_of_the_plugins[i].init();
+    }
+  }
+  /* register channel finalization AFTER all plugins, to ensure that it's run
+   * at the appropriate time */
+  grpc_register_security_filters();
+  register_builtin_channel_init();
+  /* no more changes to channel init pipelines */
+  grpc_channel_init_finalize();
+  g_plugins_loaded.store(true, std::memory_order_release);
+}
+
+void grpc_prewarm(void) {
+  GRPC_API_TRACE("grpc_prewarm(void)", 0, ());
+  GPR_ASSERT(grpc_is_initialized());
+  grpc_ensure_plugins_loaded();
+}
+
 void grpc_init(void) {
   gpr_once_init(&g_basic_init, do_basic_init);
 
@@ -143,18 +176,10 @@ void grpc_init(void) {
     grpc_core::ExecCtx::GlobalInit();
     grpc_iomgr_init();
     gpr_timers_global_init();
-    for (int i = 0; i < g_number_of_plugins; i++) {
-      if (g_all_of_the_plugins[i].init != nullptr) {
-        g_all_of_the_plugins[i].init();
-      }
-    }
-    /* register channel finalization AFTER all plugins, to ensure that it's run
-     * at the appropriate time */
-    grpc_register_security_filters();
-    register_builtin_channel_init();
+    /* Plugin initializers (and the channel-init finalization that must
+       follow them) are deferred to first use: see
+       grpc_ensure_plugins_loaded(). */
     grpc_tracer_init();
-    /* no more changes to channel init pipelines */
-    grpc_channel_init_finalize();
     grpc_iomgr_start();
   }
 
@@ -169,10 +194,15 @@ void grpc_shutdown_internal_locked(void)
     grpc_iomgr_shutdown_background_closure();
     {
       grpc_timer_manager_set_threading(false);  // shutdown timer_manager thread
-      for (i = g_number_of_plugins; i >= 0; i--) {
-        if (g_all_of_the_plugins[i].destroy != nullptr) {
-          g_all_of_the_plugins[i].destroy();
+      if (g_plugins_loaded.load(std::memory_order_acquire)) {
+        for (i = g_number_of_plugins; i >= 0; i--) {
+          if (g_all_of_the_plugins[i].destroy != nullptr) {
+            g_all_of_the_plugins[i].destroy();
+          }
         }
+        // The next init cycle re-registers channel init stages, so plugins
+        // must be re-run for it.
+        g_plugins_loaded.store(false, std::memory_order_release);
       }
     }
     grpc_iomgr_shutdown();
@@ -32,4 +32,12 @@ void grpc_register_security_filters(void);
 void grpc_security_pre_init(void);
 void grpc_maybe_wait_for_async_shutdown(void);
 
+/* Runs all registered plugin initializers, plus the channel-init
+   finalization that must follow them. grpc_init() defers this work so that
+   processes that never create a channel (or exit quickly) don't pay for
+   it; it is triggered on first use - channel stack creation, resolver or
+   LB policy registry lookups, server creation - or eagerly via
+   grpc_prewarm(). May only be called once the library is initialized. */
+void grpc_ensure_plugins_loaded(void);
+
 #endif /* GRPC_CORE_LIB_SURFACE_INIT_H */
@@ -34,6 +34,7 @@
 #include "src/core/lib/surface/call.h"
 #include "src/core/lib/surface/channel.h"
 #include "src/core/lib/transport/connectivity_state.h"
+#include "src/core/lib/transport/error_utils.h"
 #include "src/core/lib/transport/static_metadata.h"
 
 #define GRPC_ARG_LAME_FILTER_ERROR "grpc.lame_filter_error"
@@ -69,6 +70,13 @@ static void lame_start_transport_stream_op_batch(
       op, GRPC_ERROR_REF(chand->error), calld->call_combiner);
 }
 
+static Promise<absl::Status> lame_make_call_promise(
+    grpc_channel_element* elem, CallArgs /*call_args*/,
+    NextPromiseFactory /*next_promise_factory*/) {
+  ChannelData* chand = static_cast<ChannelData*>(elem->channel_data);
+  return Immediate(grpc_error_to_absl_status(chand->error));
+}
+
 static void lame_get_channel_info(grpc_channel_element* /*elem*/,
                                   const grpc_channel_info* /*channel_info*/) {}
 
@@ -166,6 +174,7 @@ const grpc_channel_filter grpc_lame_filter = {
     grpc_core::lame_destroy_channel_elem,
     grpc_core::lame_get_channel_info,
     "lame-client",
+    grpc_core::lame_make_call_promise,
 };
 
 #define CHANNEL_STACK_FROM_CHANNEL(c) ((grpc_channel_stack*)((c) + 1))
@@ -24,12 +24,13 @@
 
 #include <algorithm>
 #include <atomic>
+#include <deque>
 #include <iterator>
 #include <list>
-#include <queue>
 #include <utility>
 #include <vector>
 
+#include "absl/container/inlined_vector.h"
 #include "absl/memory/memory.h"
 #include "absl/types/optional.h"
 
@@ -189,12 +190,14 @@ class Server::RequestMatcherInterface {
 // The RealRequestMatcher is an implementation of RequestMatcherInterface that
 // actually uses all the features of RequestMatcherInterface: expecting the
 // application to explicitly request RPCs and then matching those to incoming
-// RPCs, along with a slow path by which incoming RPCs are put on a locked
-// pending list if they aren't able to be matched to an application request.
+// RPCs, along with a slow path by which incoming RPCs are put on a lock-free
+// pending queue if they aren't able to be matched to an application request.
 class Server::RealRequestMatcher : public RequestMatcherInterface {
  public:
   explicit RealRequestMatcher(Server* server)
-      : server_(server), requests_per_cq_(server->cqs_.size()) {}
+      : server_(server),
+        max_pending_(server->max_pending_requests_),
+        requests_per_cq_(server->cqs_.size()) {}
 
   ~RealRequestMatcher() override {
     for (LockedMultiProducerSingleConsumerQueue& queue : requests_per_cq_) {
@@ -203,11 +206,10 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
   }
 
   void ZombifyPending() override {
-    while (!pending_.empty()) {
-      CallData* calld = pending_.front();
+    CallData* calld;
+    while ((calld = PopPending()) != nullptr) {
       calld->SetState(CallData::CallState::ZOMBIED);
       calld->KillZombie();
-      pending_.pop();
     }
   }
 
@@ -229,37 +231,9 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
   void RequestCallWithPossiblePublish(size_t request_queue_index,
                                       RequestedCall* call) override {
     if (requests_per_cq_[request_queue_index].Push(&call->mpscq_node)) {
-      /* this was the first queued request: we need to lock and start
-         matching calls */
-      struct PendingCall {
-        RequestedCall* rc = nullptr;
-        CallData* calld;
-      };
-      auto pop_next_pending = [this, request_queue_index] {
-        PendingCall pending_call;
-        {
-          MutexLock lock(&server_->mu_call_);
-          if (!pending_.empty()) {
-            pending_call.rc = reinterpret_cast<RequestedCall*>(
-                requests_per_cq_[request_queue_index].Pop());
-            if (pending_call.rc != nullptr) {
-              pending_call.calld = pending_.front();
-              pending_.pop();
-            }
-          }
-        }
-        return pending_call;
-      };
-      while (true) {
-        PendingCall next_pending = pop_next_pending();
-        if (next_pending.rc == nullptr) break;
-        if (!next_pending.calld->MaybeActivate()) {
-          // Zombied Call
-          next_pending.calld->KillZombie();
-        } else {
-          next_pending.calld->Publish(request_queue_index, next_pending.rc);
-        }
-      }
+      /* this was the first queued request: match it against any calls that
+         went pending while no requests were available */
+      MatchPendingCalls(request_queue_index);
     }
   }
 
@@ -278,39 +252,135 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
     }
     // No cq to take the request found; queue it on the slow list.
     GRPC_STATS_INC_SERVER_SLOWPATH_REQUESTS_QUEUED();
-    // We need to ensure that all the queues are empty.  We do this under
-    // the server mu_call_ lock to ensure that if something is added to
-    // an empty request queue, it will block until the call is actually
-    // added to the pending list.
-    RequestedCall* rc = nullptr;
-    size_t cq_idx = 0;
-    size_t loop_count;
-    {
-      MutexLock lock(&server_->mu_call_);
+    // Queue the call first and only then re-scan the request queues.
+    // RequestCallWithPossiblePublish symmetrically makes its request
+    // visible before re-scanning the pending queue, so for any racing
+    // call/request pair at least one side observes the other and no
+    // pairing is missed; this replaces the mu_call_ critical section
+    // that used to close this race.
+    calld->SetState(CallData::CallState::PENDING);
+    if (max_pending_ == 0) {
+      pending_count_.fetch_add(1, std::memory_order_acq_rel);
+      pending_.Push(&calld->pending_queue_entry);
+    } else {
+      PushPendingBounded(calld);
+    }
+    MatchPendingCalls(start_request_queue_index);
+  }
+
+  Server* server() const override { return server_; }
+
+ private:
+  // Pairs queued application requests with pending calls until either side
+  // is observed empty. Both producers call this after making their own item
+  // visible; concurrent invocations are safe because both queues allow
+  // popping from multiple threads.
+  void MatchPendingCalls(size_t start_request_queue_index) {
+    while (pending_count_.load(std::memory_order_acquire) > 0) {
+      RequestedCall* rc = nullptr;
+      size_t cq_idx = 0;
+      size_t loop_count;
       for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
         cq_idx =
             (start_request_queue_index + loop_count) % requests_per_cq_.size();
         rc = reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].Pop());
-        if (rc != nullptr) {
-          break;
-        }
+        if (rc != nullptr) break;
       }
-      if (rc == nullptr) {
-        calld->SetState(CallData::CallState::PENDING);
-        pending_.push(calld);
-        return;
+      if (rc == nullptr) return;
+      CallData* calld = PopPending();
+      if (calld == nullptr) {
+        // Another matcher drained the pending queue while we held the
+        // request: return it and re-check, since a call that went pending
+        // in between may have missed the request while it was popped.
+        requests_per_cq_[cq_idx].Push(&rc->mpscq_node);
+        continue;
+      }
+      if (!calld->MaybeActivate()) {
+        // Zombied call: the request slot is still usable.
+        calld->KillZombie();
+        requests_per_cq_[cq_idx].Push(&rc->mpscq_node);
+        continue;
       }
+      GRPC_STATS_INC_SERVER_CQS_CHECKED(loop_count + requests_per_cq_.size());
+      calld->Publish(cq_idx, rc);
     }
-    GRPC_STATS_INC_SERVER_CQS_CHECKED(loop_count + requests_per_cq_.size());
-    calld->SetState(CallData::CallState::ACTIVATED);
-    calld->Publish(cq_idx, rc);
   }
 
-  Server* server() const override { return server_; }
+  // Pops one pending call; returns nullptr only once the pending queue has
+  // been observed empty. The count is incremented before the corresponding
+  // push, so a transient Pop failure with a non-zero count just means a
+  // push (or a competing pop) is in flight and will resolve shortly.
+  CallData* PopPending() {
+    while (pending_count_.load(std::memory_order_acquire) > 0) {
+      if (max_pending_ == 0) {
+        auto* entry =
+            static_cast<CallData::PendingQueueEntry*>(pending_.Pop());
+        if (entry == nullptr) continue;
+        pending_count_.fetch_sub(1, std::memory_order_acq_rel);
+        return entry->calld;
+      }
+      CallData* calld = nullptr;
+      {
+        MutexLock lock(&pending_bounded_mu_);
+        if (!pending_bounded_.empty()) {
+          // LIFO: the most recently arrived call has the most deadline
+          // budget left, so an overloaded server matches it first instead
+          // of burning request slots draining a stale backlog.
+          calld = pending_bounded_.front();
+          pending_bounded_.pop_front();
+          pending_count_.fetch_sub(1, std::memory_order_acq_rel);
+        }
+      }
+      if (calld != nullptr) return calld;
+    }
+    return nullptr;
+  }
+
+  // Queues a call on the bounded pending deque (newest at the front). To
+  // stay within the bound, calls are shed from the tail: deadline-expired
+  // calls first - their clients have already given up - and, if the queue
+  // is still full, the oldest still-live call, which is cancelled with
+  // RESOURCE_EXHAUSTED before any further per-call work is done.
+  void PushPendingBounded(CallData* calld) {
+    grpc_millis now = ExecCtx::Get()->Now();
+    absl::InlinedVector<CallData*, 4> expired;
+    CallData* overflow = nullptr;
+    {
+      MutexLock lock(&pending_bounded_mu_);
+      while (!pending_bounded_.empty() &&
+             pending_bounded_.back()->deadline() < now) {
+        expired.push_back(pending_bounded_.back());
+        pending_bounded_.pop_back();
+        pending_count_.fetch_sub(1, std::memory_order_acq_rel);
+      }
+      if (pending_bounded_.size() >= max_pending_) {
+        overflow = pending_bounded_.back();
+        pending_bounded_.pop_back();
+        pending_count_.fetch_sub(1, std::memory_order_acq_rel);
+      }
+      pending_count_.fetch_add(1, std::memory_order_acq_rel);
+      pending_bounded_.push_front(calld);
+    }
+    // Cancel shed calls outside the lock; cancellation runs call-stack code.
+    for (CallData* c : expired) {
+      c->ShedPendingCall(GRPC_STATUS_RESOURCE_EXHAUSTED,
+                         "Deadline expired while call was pending");
+    }
+    if (overflow != nullptr) {
+      overflow->ShedPendingCall(GRPC_STATUS_RESOURCE_EXHAUSTED,
+                                "Server pending request queue is full");
+    }
+  }
 
- private:
   Server* const server_;
-  std::queue<CallData*> pending_;
+  // Bound on pending calls from GRPC_ARG_SERVER_MAX_PENDING_REQUESTS; 0
+  // selects the unbounded lock-free FIFO, non-zero the bounded LIFO deque.
+  // Each registered method owns its own matcher, so the bound is per method.
+  const size_t max_pending_;
+  std::atomic<size_t> pending_count_{0};
+  LockedMultiProducerSingleConsumerQueue pending_;
+  Mutex pending_bounded_mu_;
+  std::deque<CallData*> pending_bounded_ ABSL_GUARDED_BY(pending_bounded_mu_);
   std::vector<LockedMultiProducerSingleConsumerQueue> requests_per_cq_;
 };
 
@@ -534,7 +604,14 @@ RefCountedPtr<channelz::ServerNode> CreateChannelzNode(
 
 Server::Server(const grpc_channel_args* args)
     : channel_args_(grpc_channel_args_copy(args)),
-      channelz_node_(CreateChannelzNode(args)) {}
+      channelz_node_(CreateChannelzNode(args)),
+      max_pending_requests_(static_cast<size_t>(grpc_channel_args_find_integer(
+          args, GRPC_ARG_SERVER_MAX_PENDING_REQUESTS, {0, 0, INT_MAX}))),
+      early_routing_handler_(
+          grpc_channel_args_find_pointer<grpc_server_early_routing_handler>(
+              args, GRPC_ARG_SERVER_EARLY_ROUTING_HANDLER)),
+      shutdown_drain_timeout_ms_(grpc_channel_args_find_integer(
+          args, GRPC_ARG_SERVER_SHUTDOWN_DRAIN_TIMEOUT_MS, {0, 0, INT_MAX})) {}
 
 Server::~Server() {
   grpc_channel_args_destroy(channel_args_);
@@ -735,6 +812,10 @@ void Server::MaybeFinishShutdown() {
     return;
   }
   shutdown_published_ = true;
+  if (drain_budget_timer_set_) {
+    drain_budget_timer_set_ = false;
+    grpc_timer_cancel(&drain_budget_timer_);
+  }
   for (auto& shutdown_tag : shutdown_tags_) {
     Ref().release();
     grpc_cq_end_op(shutdown_tag.cq, shutdown_tag.tag, GRPC_ERROR_NONE,
@@ -821,6 +902,17 @@ void Server::ShutdownAndNotify(grpc_completion_queue* cq, void* tag) {
           GRPC_ERROR_CREATE_FROM_STATIC_STRING("Server Shutdown"));
     }
     ShutdownUnrefOnShutdownCall();
+    // Bound the drain: after the budget, still-open connections get their
+    // remaining streams cancelled and are disconnected.
+    if (shutdown_drain_timeout_ms_ > 0) {
+      Ref().release();  // Ref held by drain_budget_timer_.
+      drain_budget_timer_set_ = true;
+      GRPC_CLOSURE_INIT(&on_drain_budget_expired_, OnDrainBudgetExpired, this,
+                        grpc_schedule_on_exec_ctx);
+      grpc_timer_init(&drain_budget_timer_,
+                      ExecCtx::Get()->Now() + shutdown_drain_timeout_ms_,
+                      &on_drain_budget_expired_);
+    }
   }
   // Shutdown listeners.
   for (auto& listener : listeners_) {
@@ -849,6 +941,25 @@ void Server::CancelAllCalls() {
       GRPC_ERROR_CREATE_FROM_STATIC_STRING("Cancelling all calls"));
 }
 
+void Server::OnDrainBudgetExpired(void* arg, grpc_error_handle error) {
+  Server* server = static_cast<Server*>(arg);
+  if (error == GRPC_ERROR_NONE) {
+    // GOAWAYs went out when shutdown started; anything still open now
+    // cannot finish within the budget, so cancel it and disconnect. The
+    // resulting channel teardown drives MaybeFinishShutdown as usual.
+    ChannelBroadcaster broadcaster;
+    {
+      MutexLock lock(&server->mu_global_);
+      broadcaster.FillChannelsLocked(server->GetChannelsLocked());
+    }
+    broadcaster.BroadcastShutdown(
+        /*send_goaway=*/false,
+        GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+            "Server shutdown drain budget exhausted"));
+  }
+  server->Unref();
+}
+
 void Server::Orphan() {
   {
     MutexLock lock(&mu_global_);
@@ -1019,36 +1130,80 @@ void Server::ChannelData::InitTransport(RefCountedPtr<Server> server,
   // to quickly find registered methods.
   size_t num_registered_methods = server_->registered_methods_.size();
   if (num_registered_methods > 0) {
-    uint32_t max_probes = 0;
-    size_t slots = 2 * num_registered_methods;
-    registered_methods_ =
-        absl::make_unique<std::vector<ChannelRegisteredMethod>>(slots);
-    for (std::unique_ptr<RegisteredMethod>& rm : server_->registered_methods_) {
+    // Size the table to a power of two (so lookups mask instead of dividing)
+    // and map hashes to slots with a multiply-shift. A handful of multipliers
+    // are tried in search of one that places every method without collisions;
+    // at load factor <= 0.5 one is almost always found, making method
+    // resolution a single multiply-shift plus one slice comparison.
+    size_t slots = 2;
+    uint32_t shift = 63;
+    while (slots < 2 * num_registered_methods) {
+      slots <<= 1;
+      shift--;
+    }
+    GPR_ASSERT(slots <= UINT32_MAX);
+    registered_method_shift_ = shift;
+    struct MethodEntry {
+      uint32_t hash;
       ExternallyManagedSlice host;
-      ExternallyManagedSlice method(rm->method.c_str());
-      const bool has_host = !rm->host.empty();
-      if (has_host) {
-        host = ExternallyManagedSlice(rm->host.c_str());
+      ExternallyManagedSlice method;
+      bool has_host;
+      RegisteredMethod* rm;
+    };
+    std::vector<MethodEntry> entries;
+    entries.reserve(num_registered_methods);
+    for (std::unique_ptr<RegisteredMethod>& rm : server_->registered_methods_) {
+      MethodEntry entry;
+      entry.method = ExternallyManagedSlice(rm->method.c_str());
+      entry.has_host = !rm->host.empty();
+      if (entry.has_host) {
+        entry.host = ExternallyManagedSlice(rm->host.c_str());
       }
-      uint32_t hash =
-          GRPC_MDSTR_KV_HASH(has_host ? host.Hash() : 0, method.Hash());
+      entry.hash = GRPC_MDSTR_KV_HASH(entry.has_host ? entry.host.Hash() : 0,
+                                      entry.method.Hash());
+      entry.rm = rm.get();
+      entries.push_back(entry);
+    }
+    uint64_t multiplier = 0x9e3779b97f4a7c15u;  // 2^64 / golden ratio
+    std::vector<bool> used(slots);
+    bool collision_free = false;
+    for (int attempt = 0; attempt < 64 && !collision_free; attempt++) {
+      std::fill(used.begin(), used.end(), false);
+      collision_free = true;
+      for (const MethodEntry& entry : entries) {
+        size_t slot = static_cast<size_t>(
+            (static_cast<uint64_t>(entry.hash) * multiplier) >> shift);
+        if (used[slot]) {
+          collision_free = false;
+          multiplier += 0x9e3779b97f4a7c15u * 2;  // stays odd
+          break;
+        }
+        used[slot] = true;
+      }
+    }
+    registered_method_multiplier_ = multiplier;
+    registered_methods_ =
+        absl::make_unique<std::vector<ChannelRegisteredMethod>>(slots);
+    // With a collision-free multiplier every method lands with zero probes;
+    // linear probing remains as the fallback when the search failed.
+    uint32_t max_probes = 0;
+    for (const MethodEntry& entry : entries) {
       uint32_t probes = 0;
-      for (probes = 0; (*registered_methods_)[(hash + probes) % slots]
-                           .server_registered_method != nullptr;
-           probes++) {
+      while ((*registered_methods_)[MethodTableSlot(entry.hash, probes)]
+                 .server_registered_method != nullptr) {
+        probes++;
       }
       if (probes > max_probes) max_probes = probes;
       ChannelRegisteredMethod* crm =
-          &(*registered_methods_)[(hash + probes) % slots];
-      crm->server_registered_method = rm.get();
-      crm->flags = rm->flags;
-      crm->has_host = has_host;
-      if (has_host) {
-        crm->host = host;
+          &(*registered_methods_)[MethodTableSlot(entry.hash, probes)];
+      crm->server_registered_method = entry.rm;
+      crm->flags = entry.rm->flags;
+      crm->has_host = entry.has_host;
+      if (entry.has_host) {
+        crm->host = entry.host;
       }
-      crm->method = method;
+      crm->method = entry.method;
     }
-    GPR_ASSERT(slots <= UINT32_MAX);
     registered_method_max_probes_ = max_probes;
   }
   // Publish channel.
@@ -1070,16 +1225,29 @@ void Server::ChannelData::InitTransport(RefCountedPtr<Server> server,
   grpc_transport_perform_op(transport, op);
 }
 
+size_t Server::ChannelData::MethodTableSlot(uint32_t hash,
+                                            size_t probe) const {
+  const uint64_t mapped =
+      (static_cast<uint64_t>(hash) * registered_method_multiplier_) >>
+      registered_method_shift_;
+  return (static_cast<size_t>(mapped) + probe) &
+         (registered_methods_->size() - 1);
+}
+
 Server::ChannelRegisteredMethod* Server::ChannelData::GetRegisteredMethod(
     const grpc_slice& host, const grpc_slice& path, bool is_idempotent) {
   if (registered_methods_ == nullptr) return nullptr;
   /* TODO(ctiller): unify these two searches */
+  /* Interned slices (the common case: hpack-parsed paths) carry the hash
+     computed at parse time, so grpc_slice_hash_internal just reads it; the
+     path hash is reused by the wildcard pass below either way. */
+  const uint32_t path_hash = grpc_slice_hash_internal(path);
   /* check for an exact match with host */
-  uint32_t hash = GRPC_MDSTR_KV_HASH(grpc_slice_hash_internal(host),
-                                     grpc_slice_hash_internal(path));
+  uint32_t hash =
+      GRPC_MDSTR_KV_HASH(grpc_slice_hash_internal(host), path_hash);
   for (size_t i = 0; i <= registered_method_max_probes_; i++) {
     ChannelRegisteredMethod* rm =
-        &(*registered_methods_)[(hash + i) % registered_methods_->size()];
+        &(*registered_methods_)[MethodTableSlot(hash, i)];
     if (rm->server_registered_method == nullptr) break;
     if (!rm->has_host) continue;
     if (rm->host != host) continue;
@@ -1091,10 +1259,10 @@ Server::ChannelRegisteredMethod* Server::ChannelData::GetRegisteredMethod(
     return rm;
   }
   /* check for a wildcard method definition (no host set) */
-  hash = GRPC_MDSTR_KV_HASH(0, grpc_slice_hash_internal(path));
+  hash = GRPC_MDSTR_KV_HASH(0, path_hash);
   for (size_t i = 0; i <= registered_method_max_probes_; i++) {
     ChannelRegisteredMethod* rm =
-        &(*registered_methods_)[(hash + i) % registered_methods_->size()];
+        &(*registered_methods_)[MethodTableSlot(hash, i)];
     if (rm->server_registered_method == nullptr) break;
     if (rm->has_host) continue;
     if (rm->method != path) continue;
@@ -1122,6 +1290,7 @@ void Server::ChannelData::AcceptStream(void* arg, grpc_transport* /*transport*/,
   args.add_initial_metadata = nullptr;
   args.add_initial_metadata_count = 0;
   args.send_deadline = GRPC_MILLIS_INF_FUTURE;
+  args.registered_method = nullptr;
   grpc_call* call;
   grpc_error_handle error = grpc_call_create(&args, &call);
   grpc_call_element* elem =
@@ -1186,6 +1355,7 @@ Server::CallData::CallData(grpc_call_element* elem,
     : server_(std::move(server)),
       call_(grpc_call_from_top_element(elem)),
       call_combiner_(args.call_combiner) {
+  pending_queue_entry.calld = this;
   GRPC_CLOSURE_INIT(&recv_initial_metadata_ready_, RecvInitialMetadataReady,
                     elem, grpc_schedule_on_exec_ctx);
   GRPC_CLOSURE_INIT(&recv_trailing_metadata_ready_, RecvTrailingMetadataReady,
@@ -1285,7 +1455,12 @@ void Server::CallData::PublishNewRpc(void* arg, grpc_error_handle error) {
     calld->KillZombie();
     return;
   }
-  rm->MatchOrQueue(chand->cq_idx(), calld);
+  size_t start_cq_idx = chand->cq_idx();
+  const int preferred_cq_idx = calld->early_routing_decision_.cq_index;
+  if (preferred_cq_idx >= 0 && !server->cqs_.empty()) {
+    start_cq_idx = static_cast<size_t>(preferred_cq_idx) % server->cqs_.size();
+  }
+  rm->MatchOrQueue(start_cq_idx, calld);
 }
 
 namespace {
@@ -1302,6 +1477,19 @@ void Server::CallData::KillZombie() {
   ExecCtx::Run(DEBUG_LOCATION, &kill_zombie_closure_, GRPC_ERROR_NONE);
 }
 
+void Server::CallData::ShedPendingCall(grpc_status_code status,
+                                       const char* reason) {
+  if (MaybeActivate()) {
+    // We now own the call exclusively and it was never published to the
+    // application, so cancel it before it incurs any further work.
+    grpc_call_cancel_with_status(call_, status, reason, nullptr);
+    SetState(CallState::ZOMBIED);
+  }
+  // If activation failed the call was already zombied (e.g. by
+  // FailCallCreation) and only needs reaping.
+  KillZombie();
+}
+
 void Server::CallData::StartNewRpc(grpc_call_element* elem) {
   auto* chand = static_cast<ChannelData*>(elem->channel_data);
   if (server_->ShutdownCalled()) {
@@ -1309,6 +1497,20 @@ void Server::CallData::StartNewRpc(grpc_call_element* elem) {
     KillZombie();
     return;
   }
+  if (early_routing_decision_.reject) {
+    // The early routing handler turned this call away: terminate it with the
+    // requested status without matching it against application requests or
+    // waking any completion queue.
+    state_.store(CallState::ZOMBIED, std::memory_order_relaxed);
+    grpc_call_cancel_with_status(
+        call_, early_routing_decision_.reject_status,
+        early_routing_decision_.reject_reason == nullptr
+            ? "Rejected by server routing handler"
+            : early_routing_decision_.reject_reason,
+        nullptr);
+    KillZombie();
+    return;
+  }
   // Find request matcher.
   matcher_ = server_->unregistered_request_matcher_.get();
   grpc_server_register_method_payload_handling payload_handling =
@@ -1390,6 +1592,15 @@ void Server::CallData::RecvInitialMetadataReady(void* arg,
         calld->recv_initial_metadata_->legacy_index()->named.path->md)));
     calld->host_.emplace(grpc_slice_ref_internal(GRPC_MDVALUE(
         calld->recv_initial_metadata_->legacy_index()->named.authority->md)));
+    grpc_server_early_routing_handler* routing_handler =
+        calld->server_->early_routing_handler();
+    if (routing_handler != nullptr) {
+      // Let the handler peek at the still-intact metadata batch (and at the
+      // routing pseudo-headers, which are filtered out of the batch below).
+      routing_handler->route(routing_handler->user_data,
+                             calld->recv_initial_metadata_, &*calld->host_,
+                             &*calld->path_, &calld->early_routing_decision_);
+    }
     calld->recv_initial_metadata_->Remove(GRPC_BATCH_PATH);
     calld->recv_initial_metadata_->Remove(GRPC_BATCH_AUTHORITY);
   } else {
@@ -1464,6 +1675,23 @@ void Server::CallData::StartTransportStreamOpBatch(
 
 }  // namespace grpc_core
 
+static void* early_routing_handler_arg_copy(void* p) { return p; }
+static void early_routing_handler_arg_destroy(void* /*p*/) {}
+static int early_routing_handler_arg_cmp(void* a, void* b) {
+  return grpc_core::QsortCompare(a, b);
+}
+
+static const grpc_arg_pointer_vtable early_routing_handler_arg_vtable = {
+    early_routing_handler_arg_copy, early_routing_handler_arg_destroy,
+    early_routing_handler_arg_cmp};
+
+grpc_arg grpc_server_early_routing_handler_to_arg(
+    grpc_server_early_routing_handler* handler) {
+  return grpc_channel_arg_pointer_create(
+      const_cast<char*>(GRPC_ARG_SERVER_EARLY_ROUTING_HANDLER), handler,
+      &early_routing_handler_arg_vtable);
+}
+
 //
 // C-core API
 //
@@ -1471,6 +1699,10 @@ void Server::CallData::StartTransportStreamOpBatch(
 grpc_server* grpc_server_create(const grpc_channel_args* args, void* reserved) {
   grpc_core::ExecCtx exec_ctx;
   GRPC_API_TRACE("grpc_server_create(%p, %p)", 2, (args, reserved));
+  // Load plugins now (rather than on first use) so that anything they
+  // install process-wide - e.g. the c-ares resolver override used when
+  // binding listener addresses - is in place before ports are added.
+  grpc_ensure_plugins_loaded();
   grpc_server* c_server = new grpc_server;
   c_server->core_server = grpc_core::MakeOrphanable<grpc_core::Server>(args);
   return c_server;
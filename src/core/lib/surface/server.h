@@ -32,10 +32,52 @@
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gprpp/mpscq.h"
 #include "src/core/lib/iomgr/resolve_address.h"
+#include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/surface/completion_queue.h"
 #include "src/core/lib/transport/transport.h"
 
+// Channel arg (pointer): a grpc_server_early_routing_handler consulted for
+// each incoming RPC as soon as its initial metadata has been decoded, before
+// the call is matched against application requests. Use
+// grpc_server_early_routing_handler_to_arg to construct the arg. The handler
+// must outlive the server.
+#define GRPC_ARG_SERVER_EARLY_ROUTING_HANDLER \
+  "grpc.server_early_routing_handler"
+
+// Routing verdict filled in by an early routing handler. The defaults
+// describe normal handling; the handler mutates only the fields it cares
+// about.
+typedef struct grpc_server_early_routing_decision {
+  // If true, the call is terminated with reject_status/reject_reason without
+  // ever being matched, published to a completion queue, or surfaced to the
+  // application.
+  bool reject;
+  grpc_status_code reject_status;
+  // May be null; must point to statically allocated text otherwise.
+  const char* reject_reason;
+  // If >= 0, index of the server completion queue to prefer when matching
+  // this call (taken modulo the number of registered queues). A negative
+  // value keeps the connection's default round-robin starting point.
+  int cq_index;
+} grpc_server_early_routing_decision;
+
+// Early routing hook: route() is invoked on the transport's receive path
+// with zero-copy access to the call's decoded initial metadata, plus the
+// already-extracted :authority and :path values (which are filtered out of
+// the batch immediately afterwards). It must be fast, must not block, and
+// must not retain any of the pointers past the invocation.
+typedef struct grpc_server_early_routing_handler {
+  void (*route)(void* user_data, const grpc_metadata_batch* initial_metadata,
+                const grpc_slice* host, const grpc_slice* path,
+                grpc_server_early_routing_decision* decision);
+  void* user_data;
+} grpc_server_early_routing_handler;
+
+grpc_arg grpc_server_early_routing_handler_to_arg(
+    grpc_server_early_routing_handler* handler);
+
 namespace grpc_core {
 
 extern TraceFlag grpc_server_channel_trace;
@@ -98,6 +140,9 @@ class Server : public InternallyRefCounted<Server> {
 
   const grpc_channel_args* channel_args() const { return channel_args_; }
   channelz::ServerNode* channelz_node() const { return channelz_node_.get(); }
+  grpc_server_early_routing_handler* early_routing_handler() const {
+    return early_routing_handler_;
+  }
 
   // Do not call this before Start(). Returns the pollsets. The
   // vector itself is immutable, but the pollsets inside are mutable. The
@@ -211,6 +256,9 @@ class Server : public InternallyRefCounted<Server> {
     static void AcceptStream(void* arg, grpc_transport* /*transport*/,
                              const void* transport_server_data);
 
+    // Slot of registered_methods_ probed i-th for a method hash.
+    size_t MethodTableSlot(uint32_t hash, size_t probe) const;
+
     void Destroy() ABSL_EXCLUSIVE_LOCKS_REQUIRED(server_->mu_global_);
 
     static void FinishDestroy(void* arg, grpc_error_handle error);
@@ -227,6 +275,12 @@ class Server : public InternallyRefCounted<Server> {
     // use, etc.)
     std::unique_ptr<std::vector<ChannelRegisteredMethod>> registered_methods_;
     uint32_t registered_method_max_probes_;
+    // Multiply-shift parameters mapping a method's 32-bit hash to a slot of
+    // registered_methods_ (a power-of-two table). InitTransport searches for
+    // a multiplier that places every method collision-free, in which case
+    // max_probes is 0 and lookup is one multiply-shift and one comparison.
+    uint64_t registered_method_multiplier_ = 0;
+    uint32_t registered_method_shift_ = 0;
     grpc_closure finish_destroy_channel_closure_;
     intptr_t channelz_socket_uuid_;
   };
@@ -262,6 +316,20 @@ class Server : public InternallyRefCounted<Server> {
 
     void FailCallCreation();
 
+    // Cancels a call that was removed from a pending queue without being
+    // matched (shed to honor GRPC_ARG_SERVER_MAX_PENDING_REQUESTS or because
+    // its deadline expired while pending) and reaps it.
+    void ShedPendingCall(grpc_status_code status, const char* reason);
+
+    grpc_millis deadline() const { return deadline_; }
+
+    // Intrusive entry linking this call into RealRequestMatcher's lock-free
+    // pending-call queue while the call waits for an application request.
+    struct PendingQueueEntry : public MultiProducerSingleConsumerQueue::Node {
+      CallData* calld = nullptr;
+    };
+    PendingQueueEntry pending_queue_entry;
+
     // Filter vtable functions.
     static grpc_error_handle InitCallElement(
         grpc_call_element* elem, const grpc_call_element_args* args);
@@ -299,6 +367,11 @@ class Server : public InternallyRefCounted<Server> {
     RequestMatcherInterface* matcher_ = nullptr;
     grpc_byte_buffer* payload_ = nullptr;
 
+    // Verdict from the server's early routing handler (if any), captured in
+    // RecvInitialMetadataReady and applied before request matching.
+    grpc_server_early_routing_decision early_routing_decision_ = {
+        false, GRPC_STATUS_OK, nullptr, -1};
+
     grpc_closure kill_zombie_closure_;
 
     grpc_metadata_array initial_metadata_ =
@@ -345,6 +418,11 @@ class Server : public InternallyRefCounted<Server> {
 
   static void DoneRequestEvent(void* req, grpc_cq_completion* completion);
 
+  // Timer callback: the graceful-drain budget set by
+  // GRPC_ARG_SERVER_SHUTDOWN_DRAIN_TIMEOUT_MS ran out with connections still
+  // open; cancels their remaining streams and disconnects them.
+  static void OnDrainBudgetExpired(void* arg, grpc_error_handle error);
+
   void FailCall(size_t cq_idx, RequestedCall* rc, grpc_error_handle error);
   grpc_call_error QueueRequestedCall(size_t cq_idx, RequestedCall* rc);
 
@@ -398,6 +476,16 @@ class Server : public InternallyRefCounted<Server> {
 
   grpc_channel_args* const channel_args_;
   RefCountedPtr<channelz::ServerNode> channelz_node_;
+  // Bound on unmatched incoming calls held pending by each request matcher
+  // (and therefore per registered method, since every method owns its own
+  // matcher), from GRPC_ARG_SERVER_MAX_PENDING_REQUESTS; 0 means unbounded.
+  const size_t max_pending_requests_;
+  // Optional hook consulted before request matching, from
+  // GRPC_ARG_SERVER_EARLY_ROUTING_HANDLER; null for almost all servers.
+  grpc_server_early_routing_handler* const early_routing_handler_;
+  // Bound on graceful drain after ShutdownAndNotify, from
+  // GRPC_ARG_SERVER_SHUTDOWN_DRAIN_TIMEOUT_MS; 0 means drain without limit.
+  const int shutdown_drain_timeout_ms_;
   std::unique_ptr<grpc_server_config_fetcher> config_fetcher_;
 
   std::vector<grpc_completion_queue*> cqs_;
@@ -433,6 +521,11 @@ class Server : public InternallyRefCounted<Server> {
   std::atomic<int> shutdown_refs_{1};
   bool shutdown_published_ ABSL_GUARDED_BY(mu_global_) = false;
   std::vector<ShutdownTag> shutdown_tags_ ABSL_GUARDED_BY(mu_global_);
+  // Bounds the drain that follows ShutdownAndNotify's GOAWAY broadcast;
+  // armed only when shutdown_drain_timeout_ms_ is non-zero.
+  grpc_timer drain_budget_timer_;
+  bool drain_budget_timer_set_ ABSL_GUARDED_BY(mu_global_) = false;
+  grpc_closure on_drain_budget_expired_;
 
   std::list<ChannelData*> channels_;
 
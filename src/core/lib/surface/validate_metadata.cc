@@ -26,12 +26,20 @@
 #include <grpc/grpc.h>
 #include <grpc/support/alloc.h>
 
+#include <atomic>
+
 #include "src/core/lib/gprpp/bitset.h"
 #include "src/core/lib/gprpp/memory.h"
 #include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/slice/slice_internal.h"
+#include "src/core/lib/slice/slice_refcount.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
 #if __cplusplus > 201103l
 #define GRPC_VALIDATE_METADATA_CONSTEXPR_FN constexpr
 #define GRPC_VALIDATE_METADATA_CONSTEXPR_VALUE constexpr
@@ -40,11 +48,67 @@
 #define GRPC_VALIDATE_METADATA_CONSTEXPR_VALUE const
 #endif
 
+namespace {
+// 16-entry nibble table for the SSSE3 classification fast path: entry lo
+// holds a bitmask of which high nibbles (0..7) make the byte (hi<<4)|lo
+// legal. Every byte >= 0x80 is illegal in both tables used below, which is
+// what lets the high-nibble side fit in an 8-bit mask.
+struct LegalCharNibbleLut {
+  uint8_t lo[16];
+};
+
+GRPC_VALIDATE_METADATA_CONSTEXPR_FN LegalCharNibbleLut MakeNibbleLut(
+    const grpc_core::BitSet<256>& bits) {
+  LegalCharNibbleLut lut{};
+  for (int lo = 0; lo < 16; lo++) {
+    uint8_t mask = 0;
+    for (int hi = 0; hi < 8; hi++) {
+      if (bits.is_set((hi << 4) | lo)) mask |= static_cast<uint8_t>(1 << hi);
+    }
+    lut.lo[lo] = mask;
+  }
+  return lut;
+}
+}  // namespace
+
+#if defined(__SSSE3__)
+// Skips over legal bytes 16 at a time. Returns a pointer no further than the
+// first illegal byte; the caller's scalar loop reports the exact offset.
+static const uint8_t* skip_legal_prefix(const uint8_t* p, const uint8_t* e,
+                                        const LegalCharNibbleLut& lut) {
+  const __m128i lo_lut =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut.lo));
+  const __m128i hi_bit = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0,
+                                       0, 0, 0, 0, 0);
+  const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+  const __m128i zero = _mm_setzero_si128();
+  while (e - p >= 16) {
+    const __m128i bytes =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    const __m128i lo = _mm_and_si128(bytes, nibble_mask);
+    const __m128i hi = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble_mask);
+    // A lane ends up zero iff its byte is illegal; bytes >= 0x80 get zero
+    // from the hi_bit shuffle (entries 8..15 are zero).
+    const __m128i legal = _mm_and_si128(_mm_shuffle_epi8(lo_lut, lo),
+                                        _mm_shuffle_epi8(hi_bit, hi));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(legal, zero)) != 0) break;
+    p += 16;
+  }
+  return p;
+}
+#endif /* __SSSE3__ */
+
 static grpc_error_handle conforms_to(const grpc_slice& slice,
                                      const grpc_core::BitSet<256>& legal_bits,
+                                     const LegalCharNibbleLut& legal_lut,
                                      const char* err_desc) {
   const uint8_t* p = GRPC_SLICE_START_PTR(slice);
   const uint8_t* e = GRPC_SLICE_END_PTR(slice);
+#if defined(__SSSE3__)
+  p = skip_legal_prefix(p, e, legal_lut);
+#else
+  (void)legal_lut;
+#endif
   for (; p != e; p++) {
     if (!legal_bits.is_set(*p)) {
       grpc_error_handle error = grpc_error_set_str(
@@ -65,6 +129,37 @@ static int error2int(grpc_error_handle error) {
   return r;
 }
 
+namespace {
+// Interned and static slices carry immutable bytes and a stable identity,
+// so their legality is a fixed property: memoize it per slice so repeated
+// keys and values validate once instead of being rescanned on every call.
+// Illegal slices are deliberately not short-circuited -- rebuilding the
+// detailed error (offset, hex dump) needs the scan, and failures are the
+// cold path.
+constexpr uint8_t kKeyValidated = 1;
+constexpr uint8_t kKeyLegal = 2;
+constexpr uint8_t kNonBinValueValidated = 4;
+constexpr uint8_t kNonBinValueLegal = 8;
+
+std::atomic<uint8_t> g_static_slice_validation_cache[GRPC_STATIC_MDSTR_COUNT];
+
+std::atomic<uint8_t>* validation_cache_for(const grpc_slice& slice) {
+  if (slice.refcount == nullptr) return nullptr;
+  switch (slice.refcount->GetType()) {
+    case grpc_slice_refcount::Type::INTERNED:
+      // An INTERNED refcount is the base field of an InternedSliceRefcount.
+      return &reinterpret_cast<grpc_core::InternedSliceRefcount*>(
+                  slice.refcount)
+                  ->validation_cache;
+    case grpc_slice_refcount::Type::STATIC:
+      return &g_static_slice_validation_cache[GRPC_STATIC_METADATA_INDEX(
+          slice)];
+    default:
+      return nullptr;
+  }
+}
+}  // namespace
+
 namespace {
 class LegalHeaderKeyBits : public grpc_core::BitSet<256> {
  public:
@@ -78,6 +173,8 @@ class LegalHeaderKeyBits : public grpc_core::BitSet<256> {
 };
 static GRPC_VALIDATE_METADATA_CONSTEXPR_VALUE LegalHeaderKeyBits
     g_legal_header_key_bits;
+static GRPC_VALIDATE_METADATA_CONSTEXPR_VALUE LegalCharNibbleLut
+    g_legal_header_key_lut = MakeNibbleLut(g_legal_header_key_bits);
 }  // namespace
 
 grpc_error_handle grpc_validate_header_key_is_legal(const grpc_slice& slice) {
@@ -93,7 +190,20 @@ grpc_error_handle grpc_validate_header_key_is_legal(const grpc_slice& slice) {
     return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
         "Metadata keys cannot start with :");
   }
-  return conforms_to(slice, g_legal_header_key_bits, "Illegal header key");
+  std::atomic<uint8_t>* cache = validation_cache_for(slice);
+  if (cache != nullptr) {
+    const uint8_t bits = cache->load(std::memory_order_relaxed);
+    if ((bits & kKeyValidated) && (bits & kKeyLegal)) return GRPC_ERROR_NONE;
+  }
+  grpc_error_handle error = conforms_to(
+      slice, g_legal_header_key_bits, g_legal_header_key_lut,
+      "Illegal header key");
+  if (cache != nullptr) {
+    cache->fetch_or(
+        kKeyValidated | (error == GRPC_ERROR_NONE ? kKeyLegal : 0),
+        std::memory_order_relaxed);
+  }
+  return error;
 }
 
 int grpc_header_key_is_legal(grpc_slice slice) {
@@ -111,12 +221,29 @@ class LegalHeaderNonBinValueBits : public grpc_core::BitSet<256> {
 };
 static GRPC_VALIDATE_METADATA_CONSTEXPR_VALUE LegalHeaderNonBinValueBits
     g_legal_header_non_bin_value_bits;
+static GRPC_VALIDATE_METADATA_CONSTEXPR_VALUE LegalCharNibbleLut
+    g_legal_header_non_bin_value_lut =
+        MakeNibbleLut(g_legal_header_non_bin_value_bits);
 }  // namespace
 
 grpc_error_handle grpc_validate_header_nonbin_value_is_legal(
     const grpc_slice& slice) {
-  return conforms_to(slice, g_legal_header_non_bin_value_bits,
-                     "Illegal header value");
+  std::atomic<uint8_t>* cache = validation_cache_for(slice);
+  if (cache != nullptr) {
+    const uint8_t bits = cache->load(std::memory_order_relaxed);
+    if ((bits & kNonBinValueValidated) && (bits & kNonBinValueLegal)) {
+      return GRPC_ERROR_NONE;
+    }
+  }
+  grpc_error_handle error =
+      conforms_to(slice, g_legal_header_non_bin_value_bits,
+                  g_legal_header_non_bin_value_lut, "Illegal header value");
+  if (cache != nullptr) {
+    cache->fetch_or(kNonBinValueValidated |
+                        (error == GRPC_ERROR_NONE ? kNonBinValueLegal : 0),
+                    std::memory_order_relaxed);
+  }
+  return error;
 }
 
 int grpc_header_nonbin_value_is_legal(grpc_slice slice) {
@@ -131,3 +258,49 @@ int grpc_is_binary_header_internal(const grpc_slice& slice) {
 int grpc_is_binary_header(grpc_slice slice) {
   return grpc_is_binary_header_internal(slice);
 }
+
+struct grpc_validated_metadata {
+  grpc_metadata* elements;
+  size_t count;
+};
+
+grpc_validated_metadata* grpc_validated_metadata_create(
+    const grpc_metadata* metadata, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    const grpc_metadata* md = &metadata[i];
+    grpc_error_handle error = grpc_validate_header_key_is_legal(md->key);
+    if (error == GRPC_ERROR_NONE && !grpc_is_binary_header_internal(md->key)) {
+      error = grpc_validate_header_nonbin_value_is_legal(md->value);
+    }
+    if (error == GRPC_ERROR_NONE &&
+        GRPC_SLICE_LENGTH(md->value) >= UINT32_MAX) {
+      // HTTP2 hpack encoding has a maximum limit.
+      error = GRPC_ERROR_CREATE_FROM_STATIC_STRING("Metadata value too large");
+    }
+    if (error != GRPC_ERROR_NONE) {
+      GRPC_LOG_IF_ERROR("validated_metadata_create", error);
+      return nullptr;
+    }
+  }
+  grpc_validated_metadata* validated = static_cast<grpc_validated_metadata*>(
+      gpr_malloc(sizeof(grpc_validated_metadata)));
+  validated->elements = static_cast<grpc_metadata*>(
+      gpr_malloc(sizeof(grpc_metadata) * count));
+  validated->count = count;
+  for (size_t i = 0; i < count; i++) {
+    validated->elements[i].key = grpc_slice_ref_internal(metadata[i].key);
+    validated->elements[i].value = grpc_slice_ref_internal(metadata[i].value);
+  }
+  return validated;
+}
+
+void grpc_validated_metadata_destroy(grpc_validated_metadata* validated) {
+  if (validated == nullptr) return;
+  grpc_core::ExecCtx exec_ctx;
+  for (size_t i = 0; i < validated->count; i++) {
+    grpc_slice_unref_internal(validated->elements[i].key);
+    grpc_slice_unref_internal(validated->elements[i].value);
+  }
+  gpr_free(validated->elements);
+  gpr_free(validated);
+}
@@ -81,6 +81,9 @@ class AsyncConnectivityStateWatcherInterface::Notifier {
               self->status_.ToString().c_str());
     }
     self->watcher_->OnConnectivityStateChange(self->state_, self->status_);
+    if (self->watcher_->coalescing_window_ > 0) {
+      self->watcher_->NotificationDelivered(self->state_);
+    }
     delete self;
   }
 
@@ -92,10 +95,75 @@ class AsyncConnectivityStateWatcherInterface::Notifier {
 
 void AsyncConnectivityStateWatcherInterface::Notify(
     grpc_connectivity_state state, const absl::Status& status) {
+  if (coalescing_window_ <= 0) {
+    new Notifier(Ref(), state, status,
+                 work_serializer_);  // Deletes itself when done.
+    return;
+  }
+  {
+    MutexLock lock(&mu_);
+    if (delivery_or_window_active_) {
+      // A notification was delivered recently; batch this one.  Only the
+      // most recent state matters, so earlier batched states are simply
+      // overwritten.
+      pending_state_ = state;
+      pending_status_ = status;
+      have_pending_state_ = true;
+      return;
+    }
+    delivery_or_window_active_ = true;
+  }
   new Notifier(Ref(), state, status,
                work_serializer_);  // Deletes itself when done.
 }
 
+void AsyncConnectivityStateWatcherInterface::NotificationDelivered(
+    grpc_connectivity_state state) {
+  {
+    MutexLock lock(&mu_);
+    last_delivered_state_ = state;
+  }
+  // Keep the coalescing window open for coalescing_window_; state changes
+  // arriving in the meantime are batched in Notify().  The timer holds a
+  // ref so that the watcher outlives it.
+  Ref().release();
+  GRPC_CLOSURE_INIT(&on_coalescing_window_closed_, OnCoalescingWindowClosed,
+                    this, grpc_schedule_on_exec_ctx);
+  grpc_timer_init(&coalescing_timer_,
+                  ExecCtx::Get()->Now() + coalescing_window_,
+                  &on_coalescing_window_closed_);
+}
+
+void AsyncConnectivityStateWatcherInterface::OnCoalescingWindowClosed(
+    void* arg, grpc_error_handle /*error*/) {
+  auto* self = static_cast<AsyncConnectivityStateWatcherInterface*>(arg);
+  bool deliver = false;
+  grpc_connectivity_state state = GRPC_CHANNEL_IDLE;
+  absl::Status status;
+  {
+    MutexLock lock(&self->mu_);
+    if (self->have_pending_state_ &&
+        self->pending_state_ != self->last_delivered_state_) {
+      // Deliver the most recent batched state; this re-arms the window
+      // once the notification lands.
+      state = self->pending_state_;
+      status = self->pending_status_;
+      deliver = true;
+    } else {
+      // Either no state change arrived during the window, or the state
+      // flapped back to what was last delivered; drop it.
+      self->delivery_or_window_active_ = false;
+    }
+    self->have_pending_state_ = false;
+    self->pending_status_ = absl::Status();
+  }
+  if (deliver) {
+    new Notifier(self->Ref(), state, status,
+                 self->work_serializer_);  // Deletes itself when done.
+  }
+  self->Unref();  // Ref held by the timer.
+}
+
 //
 // ConnectivityStateTracker
 //
@@ -161,6 +229,7 @@ void ConnectivityStateTracker::SetState(grpc_connectivity_state state,
             ConnectivityStateName(state), reason, status.ToString().c_str());
   }
   state_.store(state, std::memory_order_relaxed);
+  epoch_.fetch_add(1, std::memory_order_release);
   status_ = status;
   for (const auto& p : watchers_) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_connectivity_state_trace)) {
@@ -31,8 +31,10 @@
 
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/iomgr/work_serializer.h"
 
 namespace grpc_core {
@@ -72,6 +74,16 @@ class AsyncConnectivityStateWatcherInterface
   void Notify(grpc_connectivity_state new_state,
               const absl::Status& status) final;
 
+  // Enables batched notification delivery: after a notification is
+  // delivered, further state changes arriving within \a window are
+  // coalesced, and only the most recent state is delivered once the
+  // window closes (and only if it differs from the last state
+  // delivered).  This collapses rapid READY/IDLE flaps into at most one
+  // notification per window.  A window of 0 (the default) delivers
+  // every notification immediately.
+  // Must be called before the watcher is registered.
+  void SetCoalescingWindow(grpc_millis window) { coalescing_window_ = window; }
+
  protected:
   class Notifier;
 
@@ -86,7 +98,25 @@ class AsyncConnectivityStateWatcherInterface
                                          const absl::Status& status) = 0;
 
  private:
+  // Invoked by Notifier after a notification is delivered when
+  // coalescing is enabled; arms the coalescing window timer.
+  void NotificationDelivered(grpc_connectivity_state state);
+  static void OnCoalescingWindowClosed(void* arg, grpc_error_handle error);
+
   std::shared_ptr<WorkSerializer> work_serializer_;
+  // Coalescing state; unused (and mu_ uncontended) when
+  // coalescing_window_ is 0.
+  grpc_millis coalescing_window_ = 0;
+  Mutex mu_;
+  bool delivery_or_window_active_ ABSL_GUARDED_BY(mu_) = false;
+  bool have_pending_state_ ABSL_GUARDED_BY(mu_) = false;
+  grpc_connectivity_state last_delivered_state_ ABSL_GUARDED_BY(mu_) =
+      GRPC_CHANNEL_IDLE;
+  grpc_connectivity_state pending_state_ ABSL_GUARDED_BY(mu_) =
+      GRPC_CHANNEL_IDLE;
+  absl::Status pending_status_ ABSL_GUARDED_BY(mu_);
+  grpc_timer coalescing_timer_;
+  grpc_closure on_coalescing_window_closed_;
 };
 
 // Tracks connectivity state.  Maintains a list of watchers that are
@@ -125,6 +155,16 @@ class ConnectivityStateTracker {
   // Thread safe; no need to use an external lock.
   grpc_connectivity_state state() const;
 
+  // Like state(), but also returns an epoch stamp that increases on
+  // every state change.  Two reads returning the same state but
+  // different epochs indicate intervening transitions (e.g. a
+  // READY->IDLE->READY flap) that a plain state() read would miss.
+  // Thread safe; no need to use an external lock.
+  grpc_connectivity_state state(uint64_t* epoch) const {
+    *epoch = epoch_.load(std::memory_order_acquire);
+    return state();
+  }
+
   // Get the current status.
   // Not thread safe; access must be serialized with an external lock.
   absl::Status status() const { return status_; }
@@ -132,6 +172,7 @@ class ConnectivityStateTracker {
  private:
   const char* name_;
   std::atomic<grpc_connectivity_state> state_{grpc_connectivity_state()};
+  std::atomic<uint64_t> epoch_{0};
   absl::Status status_;
   // TODO(roth): Once we can use C++-14 heterogeneous lookups, this can
   // be a set instead of a map.
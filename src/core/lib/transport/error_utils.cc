@@ -139,7 +139,51 @@ void grpc_error_get_status(grpc_error_handle error, grpc_millis deadline,
   }
 }
 
+#ifndef GRPC_ERROR_IS_ABSEIL_STATUS
+namespace {
+
+// Interned statuses for the special (non-allocated) errors: one immutable
+// absl::Status per grpc_status_code, built on first use with the same code
+// and message grpc_error_get_status would produce for that error. Copying
+// an absl::Status is a refcount bump, so converting GRPC_ERROR_CANCELLED
+// or an inline status error becomes a table fetch instead of a fresh
+// string allocation - cancellation-heavy workloads perform millions of
+// these identical conversions.
+const absl::Status& special_error_to_absl_status(grpc_error_handle error) {
+  static const absl::Status* const table = [] {
+    absl::Status* t = new absl::Status[GRPC_STATUS_UNAUTHENTICATED + 1];
+    for (intptr_t code = GRPC_STATUS_OK; code <= GRPC_STATUS_UNAUTHENTICATED;
+         ++code) {
+      grpc_error_handle err =
+          grpc_error_from_inline_status(static_cast<grpc_status_code>(code));
+      grpc_slice msg;
+      GPR_ASSERT(grpc_error_get_str(err, GRPC_ERROR_STR_GRPC_MESSAGE, &msg));
+      t[code] = absl::Status(
+          static_cast<absl::StatusCode>(code),
+          absl::string_view(
+              reinterpret_cast<const char*>(GRPC_SLICE_START_PTR(msg)),
+              GRPC_SLICE_LENGTH(msg)));
+      grpc_slice_unref_internal(msg);
+    }
+    return t;
+  }();
+  intptr_t code = GRPC_STATUS_OK;
+  grpc_error_get_int(error, GRPC_ERROR_INT_GRPC_STATUS, &code);
+  return table[code];
+}
+
+}  // namespace
+#endif  // GRPC_ERROR_IS_ABSEIL_STATUS
+
 absl::Status grpc_error_to_absl_status(grpc_error_handle error) {
+#ifndef GRPC_ERROR_IS_ABSEIL_STATUS
+  // Special errors (GRPC_ERROR_NONE, GRPC_ERROR_CANCELLED, GRPC_ERROR_OOM
+  // and the inline status codes) always convert to the same immutable
+  // status; return the interned copy.
+  if (grpc_error_is_special(error)) {
+    return special_error_to_absl_status(error);
+  }
+#endif
   grpc_status_code status;
   // TODO(yashykt): This should be updated once we decide on how to use the
   // absl::Status payload to capture all the contents of grpc_error.
@@ -157,6 +201,11 @@ grpc_error_handle absl_status_to_grpc_error(absl::Status status) {
   if (status.ok()) {
     return GRPC_ERROR_NONE;
   }
+  // A status carrying nothing but a code needs no allocation.
+  if (status.message().empty()) {
+    return grpc_error_from_inline_status(
+        static_cast<grpc_status_code>(status.code()));
+  }
   return grpc_error_set_int(
       GRPC_ERROR_CREATE_FROM_STRING_VIEW(status.message()),
       GRPC_ERROR_INT_GRPC_STATUS, static_cast<grpc_status_code>(status.code()));
@@ -101,12 +101,6 @@ void grpc_mdelem_trace_unref(void* md, const grpc_slice& key,
 #define TABLE_IDX(hash, capacity) (((hash) >> (LOG2_SHARD_COUNT)) % (capacity))
 #define SHARD_IDX(hash) ((hash) & ((1 << (LOG2_SHARD_COUNT)) - 1))
 
-void StaticMetadata::HashInit() {
-  uint32_t k_hash = grpc_slice_hash_internal(kv_.key);
-  uint32_t v_hash = grpc_slice_hash_internal(kv_.value);
-  hash_ = GRPC_MDSTR_KV_HASH(k_hash, v_hash);
-}
-
 AllocatedMetadata::AllocatedMetadata(const grpc_slice& key,
                                      const grpc_slice& value)
     : RefcountedMdBase(grpc_slice_ref_internal(key),
@@ -315,6 +309,17 @@ static void gc_mdtab(mdtab_shard* shard) {
                                -static_cast<intptr_t>(num_freed));
 }
 
+void grpc_mdctx_gc(void) {
+  for (size_t i = 0; i < SHARD_COUNT; i++) {
+    mdtab_shard* shard = &g_shards[i];
+    if (gpr_atm_no_barrier_load(&shard->free_estimate) > 0) {
+      gpr_mu_lock(&shard->mu);
+      gc_mdtab(shard);
+      gpr_mu_unlock(&shard->mu);
+    }
+  }
+}
+
 static void grow_mdtab(mdtab_shard* shard) {
   GPR_TIMER_SCOPE("grow_mdtab", 0);
 
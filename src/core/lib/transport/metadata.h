@@ -197,6 +197,13 @@ void grpc_mdelem_trace_unref(void* md, const grpc_slice& key,
                              const grpc_slice& value, intptr_t refcnt,
                              const char* file, int line);
 #endif
+
+/* KV hashes of the entries of the generated static mdelem table, in table
+   order. Filled in during grpc_init; the hashes depend on the per-process
+   hash seed, so they live beside rather than inside the (constant
+   initialized, read-only) table itself. */
+extern uint32_t grpc_static_mdelem_hash_values[];
+
 namespace grpc_core {
 
 typedef void (*destroy_user_data_func)(void* data);
@@ -209,20 +216,19 @@ struct UserData {
 
 class StaticMetadata {
  public:
-  StaticMetadata(const grpc_slice& key, const grpc_slice& value, uintptr_t idx)
-      : kv_({key, value}), hash_(0), static_idx_(idx) {}
+  constexpr StaticMetadata(const grpc_slice& key, const grpc_slice& value,
+                           uintptr_t idx)
+      : kv_({key, value}), static_idx_(idx) {}
 
   const grpc_mdelem_data& data() const { return kv_; }
 
-  void HashInit();
-  uint32_t hash() { return hash_; }
-  uintptr_t StaticIndex() { return static_idx_; }
+  uint32_t hash() const { return grpc_static_mdelem_hash_values[static_idx_]; }
+  uintptr_t StaticIndex() const { return static_idx_; }
 
  private:
   grpc_mdelem_data kv_;
 
   /* private only data */
-  uint32_t hash_;
   uintptr_t static_idx_;
 };
 
@@ -415,6 +421,11 @@ inline void grpc_mdelem_unref(grpc_mdelem gmd) {
 void grpc_mdctx_global_init(void);
 void grpc_mdctx_global_shutdown();
 
+/* Sweep unreferenced interned metadata out of the global table. Invoked by
+   resource quota reclaimers under memory pressure; reclaiming this cold
+   cache is far cheaper than anything connection-visible. */
+void grpc_mdctx_gc(void);
+
 /* Like grpc_mdelem_from_slices, but we know that key is a static or interned
    slice and value is not static or interned. This gives us an inlinable
    fastpath - we know we must allocate metadata now, and that we do not need to
@@ -31,7 +31,7 @@
 #include "src/core/lib/slice/slice_internal.h"
 
 namespace grpc_core {
-StaticMetadata g_static_mdelem_table[GRPC_STATIC_MDELEM_COUNT] = {
+constexpr StaticMetadata g_static_mdelem_table[GRPC_STATIC_MDELEM_COUNT] = {
     StaticMetadata(grpc_core::StaticMetadataSlice(
                        &g_static_metadata_slice_refcounts[3].base, 10,
                        g_static_metadata_bytes + 19),
@@ -37,7 +37,7 @@
 #define GRPC_STATIC_MDELEM_COUNT 85
 
 namespace grpc_core {
-extern StaticMetadata g_static_mdelem_table[GRPC_STATIC_MDELEM_COUNT];
+extern const StaticMetadata g_static_mdelem_table[GRPC_STATIC_MDELEM_COUNT];
 extern grpc_mdelem g_static_mdelem_manifested[GRPC_STATIC_MDELEM_COUNT];
 }  // namespace grpc_core
 
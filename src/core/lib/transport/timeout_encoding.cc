@@ -23,8 +23,6 @@
 #include <stdio.h>
 #include <string.h>
 
-#include "src/core/lib/gpr/string.h"
-
 static int64_t round_up(int64_t x, int64_t divisor) {
   return (x / divisor + (x % divisor != 0)) * divisor;
 }
@@ -47,8 +45,42 @@ static void enc_tiny(char* buffer) { memcpy(buffer, "1n", 3); }
 /* encode our maximum timeout value, about 1157 days */
 static void enc_huge(char* buffer) { memcpy(buffer, "99999999S", 10); }
 
+static const char kTwoDigits[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/* write the decimal digits of value into buffer, two digits per step via a
+   pair lookup table; returns the number of digits written. All encodable
+   timeout values fit in the tmp buffer below. */
+static int enc_digits(char* buffer, int64_t value) {
+  char tmp[GRPC_HTTP2_TIMEOUT_ENCODE_MIN_BUFSIZE];
+  char* p = tmp + sizeof(tmp);
+  while (value >= 100) {
+    p -= 2;
+    memcpy(p, kTwoDigits + 2 * (value % 100), 2);
+    value /= 100;
+  }
+  if (value >= 10) {
+    p -= 2;
+    memcpy(p, kTwoDigits + 2 * value, 2);
+  } else {
+    *--p = static_cast<char>('0' + value);
+  }
+  const int n = static_cast<int>(tmp + sizeof(tmp) - p);
+  memcpy(buffer, p, static_cast<size_t>(n));
+  return n;
+}
+
 static void enc_ext(char* buffer, int64_t value, char ext) {
-  int n = int64_ttoa(value, buffer);
+  int n = enc_digits(buffer, value);
   buffer[n] = ext;
   buffer[n + 1] = 0;
 }
@@ -77,6 +109,20 @@ static void enc_millis(char* buffer, int64_t x) {
   }
 }
 
+grpc_millis grpc_http2_round_timeout(grpc_millis timeout) {
+  const grpc_millis kMaxTimeout = 99999999000;
+  if (timeout <= 0) return 0;
+  if (timeout < 1000 * GPR_MS_PER_SEC) {
+    return round_up_to_three_sig_figs(timeout);
+  }
+  if (timeout >= kMaxTimeout) return kMaxTimeout;
+  const grpc_millis rounded =
+      round_up_to_three_sig_figs(timeout / GPR_MS_PER_SEC +
+                                 (timeout % GPR_MS_PER_SEC != 0)) *
+      GPR_MS_PER_SEC;
+  return rounded < kMaxTimeout ? rounded : kMaxTimeout;
+}
+
 void grpc_http2_encode_timeout(grpc_millis timeout, char* buffer) {
   const grpc_millis kMaxTimeout = 99999999000;
   if (timeout <= 0) {
@@ -29,6 +29,11 @@
 
 #define GRPC_HTTP2_TIMEOUT_ENCODE_MIN_BUFSIZE 10
 
+/* Round a timeout to the coarse bucket that encoding will put on the wire:
+   two timeouts that round to the same bucket always encode identically, so
+   the bucket can serve as a cache key for pre-built header values. */
+grpc_millis grpc_http2_round_timeout(grpc_millis timeout);
+
 /* Encode/decode timeouts to the GRPC over HTTP/2 format;
    encoding may round up arbitrarily. If the timeout is larger than about 1157
    days, it will be capped and "99999999S" will be sent on the wire. */
@@ -113,6 +113,26 @@ grpc_status_code gsec_aead_crypter_decrypt_iovec(
   return GRPC_STATUS_INVALID_ARGUMENT;
 }
 
+grpc_status_code gsec_aead_crypter_decrypt_in_place(
+    gsec_aead_crypter* crypter, const uint8_t* nonce, size_t nonce_length,
+    const struct iovec* aad_vec, size_t aad_vec_length,
+    struct iovec* ciphertext_vec, size_t ciphertext_vec_length,
+    size_t* plaintext_bytes_written, char** error_details) {
+  if (crypter != nullptr && crypter->vtable != nullptr) {
+    if (crypter->vtable->decrypt_in_place == nullptr) {
+      /* In-place decryption is optional; callers should fall back to
+         gsec_aead_crypter_decrypt_iovec. */
+      return GRPC_STATUS_UNIMPLEMENTED;
+    }
+    return crypter->vtable->decrypt_in_place(
+        crypter, nonce, nonce_length, aad_vec, aad_vec_length, ciphertext_vec,
+        ciphertext_vec_length, plaintext_bytes_written, error_details);
+  }
+  /* An error occurred. */
+  maybe_copy_error_msg(vtable_error_msg, error_details);
+  return GRPC_STATUS_INVALID_ARGUMENT;
+}
+
 grpc_status_code gsec_aead_crypter_max_ciphertext_and_tag_length(
     const gsec_aead_crypter* crypter, size_t plaintext_length,
     size_t* max_ciphertext_and_tag_length_to_return, char** error_details) {
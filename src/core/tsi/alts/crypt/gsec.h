@@ -156,6 +156,12 @@ typedef struct gsec_aead_crypter_vtable {
       const struct iovec* ciphertext_vec, size_t ciphertext_vec_length,
       struct iovec plaintext_vec, size_t* plaintext_bytes_written,
       char** error_details);
+  /* Optional, may be nullptr if the implementation cannot decrypt in place. */
+  grpc_status_code (*decrypt_in_place)(
+      gsec_aead_crypter* crypter, const uint8_t* nonce, size_t nonce_length,
+      const struct iovec* aad_vec, size_t aad_vec_length,
+      struct iovec* ciphertext_vec, size_t ciphertext_vec_length,
+      size_t* plaintext_bytes_written, char** error_details);
   grpc_status_code (*max_ciphertext_and_tag_length)(
       const gsec_aead_crypter* crypter, size_t plaintext_length,
       size_t* max_ciphertext_and_tag_length_to_return, char** error_details);
@@ -320,6 +326,40 @@ grpc_status_code gsec_aead_crypter_decrypt_iovec(
     struct iovec plaintext_vec, size_t* plaintext_bytes_written,
     char** error_details);
 
+/**
+ * This method performs an AEAD decrypt operation in place.
+ *
+ * - crypter: AEAD crypter instance.
+ * - nonce: buffer containing a nonce with its size equal to nonce_length.
+ * - nonce_length: size of nonce buffer, and must be equal to the value returned
+ *   from method gsec_aead_crypter_nonce_length.
+ * - aad_vec: an iovec array containing data that needs to be authenticated but
+ *   not encrypted.
+ * - aad_vec_length: the array length of aad_vec.
+ * - ciphertext_vec: an iovec array containing the ciphertext and tag. On
+ *   success, the ciphertext bytes are overwritten with the plaintext and the
+ *   trailing tag bytes are left unspecified; on failure, the buffers are
+ *   zeroed. Callers must own the buffers exclusively.
+ * - ciphertext_vec_length: the array length of ciphertext_vec.
+ * - plaintext_bytes_written: the actual number of plaintext bytes written to
+ *   ciphertext_vec.
+ * - error_details: a buffer containing an error message if the method does not
+ *   function correctly. It is legal to pass nullptr into error_details, and
+ *   otherwise, the parameter should be freed with gpr_free.
+ *
+ * On the success of decryption, the method returns GRPC_STATUS_OK. If the
+ * crypter implementation does not support in-place decryption, the method
+ * returns GRPC_STATUS_UNIMPLEMENTED without touching the buffers, and callers
+ * should fall back to gsec_aead_crypter_decrypt_iovec. Otherwise, it returns
+ * an error status code along with its details specified in error_details (if
+ * error_details is not nullptr).
+ */
+grpc_status_code gsec_aead_crypter_decrypt_in_place(
+    gsec_aead_crypter* crypter, const uint8_t* nonce, size_t nonce_length,
+    const struct iovec* aad_vec, size_t aad_vec_length,
+    struct iovec* ciphertext_vec, size_t ciphertext_vec_length,
+    size_t* plaintext_bytes_written, char** error_details);
+
 /**
  * This method computes the size of ciphertext+tag buffer that must be passed to
  * gsec_aead_crypter_encrypt function to ensure correct encryption of a
@@ -20,12 +20,28 @@
 
 #include "src/core/tsi/alts/handshaker/alts_shared_resource.h"
 
+#include <string.h>
+
+#include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
+#include <grpc/support/string_util.h>
 
+#include "src/core/lib/surface/channel.h"
 #include "src/core/tsi/alts/handshaker/alts_handshaker_client.h"
 
 static alts_shared_resource_dedicated g_alts_resource_dedicated;
 
+/* Channel to the handshaker service shared by all in-flight non-dedicated
+ * handshakes; destroyed when the last user releases it, so nothing is left
+ * behind at grpc_shutdown(). */
+static gpr_once g_shared_channel_once = GPR_ONCE_INIT;
+static gpr_mu g_shared_channel_mu;
+static grpc_channel* g_shared_channel = nullptr;
+static char* g_shared_channel_url = nullptr;
+static size_t g_shared_channel_refs = 0;
+
+static void shared_channel_mu_init(void) { gpr_mu_init(&g_shared_channel_mu); }
+
 alts_shared_resource_dedicated* grpc_alts_get_shared_resource_dedicated(void) {
   return &g_alts_resource_dedicated;
 }
@@ -69,6 +85,53 @@ void grpc_alts_shared_resource_dedicated_start(
   gpr_mu_unlock(&g_alts_resource_dedicated.mu);
 }
 
+grpc_channel* grpc_alts_shared_handshaker_channel_get(
+    const char* handshaker_service_url) {
+  gpr_once_init(&g_shared_channel_once, shared_channel_mu_init);
+  gpr_mu_lock(&g_shared_channel_mu);
+  if (g_shared_channel != nullptr &&
+      strcmp(g_shared_channel_url, handshaker_service_url) == 0) {
+    g_shared_channel_refs++;
+    grpc_channel* channel = g_shared_channel;
+    gpr_mu_unlock(&g_shared_channel_mu);
+    return channel;
+  }
+  if (g_shared_channel == nullptr) {
+    g_shared_channel =
+        grpc_insecure_channel_create(handshaker_service_url, nullptr, nullptr);
+    g_shared_channel_url = gpr_strdup(handshaker_service_url);
+    g_shared_channel_refs = 1;
+    grpc_channel* channel = g_shared_channel;
+    gpr_mu_unlock(&g_shared_channel_mu);
+    return channel;
+  }
+  /* The cached channel points at a different url and is still in use;
+   * hand out an unshared channel, recognized (and destroyed) by pointer
+   * inequality in grpc_alts_shared_handshaker_channel_release(). */
+  gpr_mu_unlock(&g_shared_channel_mu);
+  return grpc_insecure_channel_create(handshaker_service_url, nullptr, nullptr);
+}
+
+void grpc_alts_shared_handshaker_channel_release(grpc_channel* channel) {
+  if (channel == nullptr) {
+    return;
+  }
+  gpr_once_init(&g_shared_channel_once, shared_channel_mu_init);
+  gpr_mu_lock(&g_shared_channel_mu);
+  if (channel == g_shared_channel) {
+    if (--g_shared_channel_refs == 0) {
+      grpc_channel_destroy_internal(g_shared_channel);
+      g_shared_channel = nullptr;
+      gpr_free(g_shared_channel_url);
+      g_shared_channel_url = nullptr;
+    }
+    gpr_mu_unlock(&g_shared_channel_mu);
+    return;
+  }
+  gpr_mu_unlock(&g_shared_channel_mu);
+  grpc_channel_destroy_internal(channel);
+}
+
 void grpc_alts_shared_resource_dedicated_shutdown() {
   if (g_alts_resource_dedicated.cq != nullptr) {
     grpc_pollset_set_del_pollset(g_alts_resource_dedicated.interested_parties,
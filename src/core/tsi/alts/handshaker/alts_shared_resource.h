@@ -69,5 +69,22 @@ void grpc_alts_shared_resource_dedicated_init();
 void grpc_alts_shared_resource_dedicated_start(
     const char* handshaker_service_url);
 
+/**
+ * This method returns a channel to the handshaker service at
+ * handshaker_service_url, shared by all concurrently running TSI
+ * handshakes that use the same url, so that a reconnect storm does not
+ * open one connection to the handshaker service per handshake. Each call
+ * must be balanced by grpc_alts_shared_handshaker_channel_release().
+ */
+grpc_channel* grpc_alts_shared_handshaker_channel_get(
+    const char* handshaker_service_url);
+
+/**
+ * This method releases a channel obtained from
+ * grpc_alts_shared_handshaker_channel_get(). The underlying channel is
+ * destroyed when its last user releases it.
+ */
+void grpc_alts_shared_handshaker_channel_release(grpc_channel* channel);
+
 #endif /* GRPC_CORE_TSI_ALTS_HANDSHAKER_ALTS_SHARED_RESOURCE_H \
         */
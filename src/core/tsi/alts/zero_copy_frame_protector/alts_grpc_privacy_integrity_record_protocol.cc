@@ -80,29 +80,50 @@ static tsi_result alts_grpc_privacy_integrity_unprotect(
         "Invalid nullptr arguments to alts_grpc_record_protocol unprotect.");
     return TSI_INVALID_ARGUMENT;
   }
-  /* Allocates memory for output frame. In privacy-integrity unprotect, the
-   * unprotected data are stored in a newly allocated buffer.  */
   if (protected_slices->length < rp->header_length + rp->tag_length) {
     gpr_log(GPR_ERROR, "Protected slices do not have sufficient data.");
     return TSI_INVALID_ARGUMENT;
   }
-  size_t unprotected_frame_size =
-      protected_slices->length - rp->header_length - rp->tag_length;
-  grpc_slice unprotected_slice = GRPC_SLICE_MALLOC(unprotected_frame_size);
-  iovec_t unprotected_iovec = {GRPC_SLICE_START_PTR(unprotected_slice),
-                               GRPC_SLICE_LENGTH(unprotected_slice)};
   /* Strips frame header from protected slices.  */
   grpc_slice_buffer_reset_and_unref_internal(&rp->header_sb);
   grpc_slice_buffer_move_first(protected_slices, rp->header_length,
                                &rp->header_sb);
   iovec_t header_iovec = alts_grpc_record_protocol_get_header_iovec(rp);
-  /* Calls alts_iovec_record_protocol unprotect.  */
   char* error_details = nullptr;
   alts_grpc_record_protocol_convert_slice_buffer_to_iovec(rp, protected_slices);
+  /* First tries decrypting the protected slices in place: the slices come off
+   * the wire and are exclusively owned, and on success they are handed
+   * through to unprotected_slices without a staging frame allocation.  */
   grpc_status_code status =
-      alts_iovec_record_protocol_privacy_integrity_unprotect(
+      alts_iovec_record_protocol_privacy_integrity_unprotect_in_place(
           rp->iovec_rp, header_iovec, rp->iovec_buf, protected_slices->count,
-          unprotected_iovec, &error_details);
+          &error_details);
+  if (status == GRPC_STATUS_OK) {
+    /* Discards the header and the trailing tag, and hands the decrypted
+     * slices through.  */
+    grpc_slice_buffer_reset_and_unref_internal(&rp->header_sb);
+    grpc_slice_buffer_trim_end(protected_slices, rp->tag_length,
+                               &rp->header_sb);
+    grpc_slice_buffer_reset_and_unref_internal(&rp->header_sb);
+    grpc_slice_buffer_move_into(protected_slices, unprotected_slices);
+    return TSI_OK;
+  }
+  if (status != GRPC_STATUS_UNIMPLEMENTED) {
+    gpr_log(GPR_ERROR, "Failed to unprotect, %s", error_details);
+    gpr_free(error_details);
+    return TSI_INTERNAL_ERROR;
+  }
+  /* The crypter cannot decrypt in place. Allocates memory for the output
+   * frame and decrypts into the newly allocated buffer instead.  */
+  size_t unprotected_frame_size =
+      protected_slices->length - rp->tag_length;
+  grpc_slice unprotected_slice = GRPC_SLICE_MALLOC(unprotected_frame_size);
+  iovec_t unprotected_iovec = {GRPC_SLICE_START_PTR(unprotected_slice),
+                               GRPC_SLICE_LENGTH(unprotected_slice)};
+  /* Calls alts_iovec_record_protocol unprotect.  */
+  status = alts_iovec_record_protocol_privacy_integrity_unprotect(
+      rp->iovec_rp, header_iovec, rp->iovec_buf, protected_slices->count,
+      unprotected_iovec, &error_details);
   if (status != GRPC_STATUS_OK) {
     gpr_log(GPR_ERROR, "Failed to unprotect, %s", error_details);
     gpr_free(error_details);
@@ -159,6 +159,32 @@ grpc_status_code alts_iovec_record_protocol_privacy_integrity_unprotect(
     const iovec_t* protected_vec, size_t protected_vec_length,
     iovec_t unprotected_data, char** error_details);
 
+/**
+ * This method performs privacy-integrity unprotect operation on a
+ * alts_iovec_record_protocol instance in place, i.e., the protected data
+ * buffers are overwritten with the unprotected data. The caller must own the
+ * protected data buffers exclusively.
+ *
+ * - rp: an alts_iovec_record_protocol instance.
+ * - header: an iovec containing the frame header.
+ * - protected_vec: an iovec array containing protected data including the tag.
+ *   On success, the data bytes hold the unprotected data and the trailing tag
+ *   bytes are left unspecified; on failure, the buffers are zeroed.
+ * - protected_vec_length: the array length of protected_vec.
+ * - error_details: a buffer containing an error message if the method does not
+ *   function correctly. It is OK to pass nullptr into error_details.
+ *
+ * On success, the method returns GRPC_STATUS_OK. If the underlying crypter
+ * does not support in-place decryption, the method returns
+ * GRPC_STATUS_UNIMPLEMENTED without touching the buffers, and the caller
+ * should fall back to alts_iovec_record_protocol_privacy_integrity_unprotect.
+ * Otherwise, it returns an error status code along with its details specified
+ * in error_details (if error_details is not nullptr).
+ */
+grpc_status_code alts_iovec_record_protocol_privacy_integrity_unprotect_in_place(
+    alts_iovec_record_protocol* rp, iovec_t header, iovec_t* protected_vec,
+    size_t protected_vec_length, char** error_details);
+
 /**
  * This method creates an alts_iovec_record_protocol instance, given a
  * gsec_aead_crypter instance, a flag indicating if the created instance will be
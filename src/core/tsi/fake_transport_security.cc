@@ -552,6 +552,7 @@ static const tsi_handshaker_result_vtable handshaker_result_vtable = {
     fake_handshaker_result_create_zero_copy_grpc_protector,
     fake_handshaker_result_create_frame_protector,
     fake_handshaker_result_get_unused_bytes,
+    nullptr, /* protection_is_offloaded */
     fake_handshaker_result_destroy,
 };
 
@@ -127,6 +127,16 @@ static tsi_result handshaker_result_create_zero_copy_grpc_protector(
   return ok;
 }
 
+static int handshaker_result_protection_is_offloaded(
+    const tsi_handshaker_result* /*self*/) {
+  /* The local handshake exchanges no bytes and negotiates no cryptography,
+   * so the endpoint already carries plaintext and there are never unused
+   * bytes to hand off. Reporting protection as offloaded makes the security
+   * handshaker skip secure endpoint wrapping entirely (as insecure channels
+   * do), saving a staging copy in each direction. */
+  return 1;
+}
+
 static void handshaker_result_destroy(tsi_handshaker_result* self) {
   if (self == nullptr) {
     return;
@@ -142,6 +152,7 @@ static const tsi_handshaker_result_vtable result_vtable = {
     handshaker_result_create_zero_copy_grpc_protector,
     nullptr, /* handshaker_result_create_frame_protector */
     nullptr, /* handshaker_result_get_unused_bytes */
+    handshaker_result_protection_is_offloaded,
     handshaker_result_destroy};
 
 static tsi_result create_handshaker_result(bool is_client,
@@ -1371,6 +1371,7 @@ static const tsi_handshaker_result_vtable handshaker_result_vtable = {
     nullptr, /* create_zero_copy_grpc_protector */
     ssl_handshaker_result_create_frame_protector,
     ssl_handshaker_result_get_unused_bytes,
+    nullptr, /* protection_is_offloaded */
     ssl_handshaker_result_destroy,
 };
 
@@ -1951,6 +1952,17 @@ tsi_result tsi_create_ssl_client_handshaker_factory_with_options(
                             server_handshaker_factory_new_session_callback);
     SSL_CTX_set_session_cache_mode(ssl_context, SSL_SESS_CACHE_CLIENT);
   }
+  if (options->enable_early_data) {
+#if defined(OPENSSL_IS_BORINGSSL)
+    SSL_CTX_set_early_data_enabled(ssl_context, 1);
+#else
+    // OpenSSL clients must drive early data through SSL_write_early_data,
+    // which does not fit the transparent handshake loop used here.
+    gpr_log(GPR_INFO,
+            "TLS early data requested but not supported by this SSL "
+            "implementation; continuing without it.");
+#endif
+  }
 
   do {
     result = populate_ssl_context(ssl_context, options->pem_key_cert_pair,
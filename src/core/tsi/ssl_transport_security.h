@@ -158,6 +158,15 @@ struct tsi_ssl_client_handshaker_options {
   tsi_tls_version min_tls_version;
   tsi_tls_version max_tls_version;
 
+  /* If true and the SSL implementation supports it (currently BoringSSL
+     only), TLS 1.3 session-ticket resumptions offer 0-RTT early data:
+     the handshake reports completion after the ClientHello, and bytes the
+     application writes before the server's response are sent as early
+     data. If the server rejects the early data the connection fails and
+     the caller reconnects with a full handshake, so this should only be
+     enabled for traffic that tolerates replay. */
+  bool enable_early_data;
+
   tsi_ssl_client_handshaker_options()
       : pem_key_cert_pair(nullptr),
         pem_root_certs(nullptr),
@@ -168,7 +177,8 @@ struct tsi_ssl_client_handshaker_options {
         session_cache(nullptr),
         skip_server_certificate_verification(false),
         min_tls_version(tsi_tls_version::TSI_TLS1_2),
-        max_tls_version(tsi_tls_version::TSI_TLS1_3) {}
+        max_tls_version(tsi_tls_version::TSI_TLS1_3),
+        enable_early_data(false) {}
 };
 
 /* Creates a client handshaker factory.
@@ -273,6 +273,13 @@ tsi_result tsi_handshaker_result_get_unused_bytes(
   return self->vtable->get_unused_bytes(self, bytes, bytes_size);
 }
 
+int tsi_handshaker_result_protection_is_offloaded(
+    const tsi_handshaker_result* self) {
+  if (self == nullptr || self->vtable == nullptr) return 0;
+  if (self->vtable->protection_is_offloaded == nullptr) return 0;
+  return self->vtable->protection_is_offloaded(self);
+}
+
 void tsi_handshaker_result_destroy(tsi_handshaker_result* self) {
   if (self == nullptr) return;
   self->vtable->destroy(self);
@@ -101,6 +101,7 @@ struct tsi_handshaker_result_vtable {
   tsi_result (*get_unused_bytes)(const tsi_handshaker_result* self,
                                  const unsigned char** bytes,
                                  size_t* bytes_size);
+  int (*protection_is_offloaded)(const tsi_handshaker_result* self);
   void (*destroy)(tsi_handshaker_result* self);
 };
 struct tsi_handshaker_result {
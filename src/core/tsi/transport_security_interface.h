@@ -249,6 +249,15 @@ tsi_result tsi_handshaker_result_get_unused_bytes(
     const tsi_handshaker_result* self, const unsigned char** bytes,
     size_t* bytes_size);
 
+/* Returns 1 if the handshaker result has arranged for traffic protection to
+   happen below the TSI frame protectors -- e.g. kernel TLS programmed on the
+   underlying socket -- so the caller should transfer plaintext directly on
+   the wrapped transport instead of creating a protected endpoint. Results
+   reporting offloaded protection must not hold unused handshake bytes.
+   Returns 0 when unimplemented.  */
+int tsi_handshaker_result_protection_is_offloaded(
+    const tsi_handshaker_result* self);
+
 /* This method releases the tsi_handshaker_handshaker object. After this method
    is called, no other method can be called on the object.  */
 void tsi_handshaker_result_destroy(tsi_handshaker_result* self);
@@ -152,6 +152,29 @@ void ClientContext::TryCancel() {
   }
 }
 
+void ClientContext::Reset() {
+  internal::MutexLock lock(&mu_);
+  // Per the API contract the previous call (if any) has fully completed, so
+  // dropping our ref is the only cleanup it needs from us.
+  if (call_ != nullptr) {
+    grpc_call_unref(call_);
+    call_ = nullptr;
+  }
+  call_canceled_ = false;
+  initial_metadata_received_ = false;
+  deadline_ = gpr_inf_future(GPR_CLOCK_REALTIME);
+  channel_.reset();
+  auth_context_.reset();
+  recv_initial_metadata_.Reset();
+  trailing_metadata_.Reset();
+  debug_error_string_.clear();
+  // Everything else - send_initial_metadata_, creds_, authority_,
+  // compression, propagation setup, census context and the various initial
+  // metadata flags - is deliberately retained: it is configuration rather
+  // than call state, and re-deriving it is what context recycling is meant
+  // to avoid.
+}
+
 void ClientContext::SendCancelToInterceptors() {
   internal::CancelInterceptorBatchMethods cancel_methods;
   for (size_t i = 0; i < rpc_info_.interceptors_.size(); i++) {
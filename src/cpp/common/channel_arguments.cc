@@ -148,6 +148,10 @@ void ChannelArguments::SetResourceQuota(
                        grpc_resource_quota_arg_vtable());
 }
 
+void ChannelArguments::SetSubchannelShards(int num_shards) {
+  SetInt(GRPC_ARG_SUBCHANNEL_SHARDS, num_shards);
+}
+
 void ChannelArguments::SetMaxReceiveMessageSize(int size) {
   SetInt(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH, size);
 }
@@ -28,6 +28,7 @@
 #include "src/core/lib/gprpp/manual_constructor.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/thd.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 
 namespace grpc {
 namespace {
@@ -88,8 +89,18 @@ struct CallbackAlternativeCQ {
                 // thread is definitely running on a background thread, does not
                 // hold any application locks before executing the callback,
                 // and cannot be entered recursively.
+                //
+                // The scoped ApplicationCallbackExecCtx additionally keeps
+                // continuations on this thread: completions generated while
+                // the callback runs (e.g. a reactor immediately starting its
+                // next operation) enqueue onto this thread's work queue and
+                // drain iteratively when the scope exits, instead of paying
+                // an Executor hop and wakeup per chained callback. Scoping it
+                // per event bounds each drain to the chain spawned by that
+                // event, so one RPC cannot monopolize a nexting thread.
                 auto* functor =
                     static_cast<grpc_completion_queue_functor*>(ev.tag);
+                grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
                 functor->functor_run(functor, ev.success);
               }
             },
@@ -162,6 +173,25 @@ CompletionQueue::NextStatus CompletionQueue::AsyncNextInternal(
   }
 }
 
+size_t CompletionQueue::NextBatch(void** tags, bool* oks, size_t max_events) {
+  size_t n = 0;
+  while (n < max_events) {
+    // Only the first read may block; the rest use an immediate deadline so
+    // the batch ends as soon as the queue has nothing ready.
+    const gpr_timespec deadline = n == 0 ? gpr_inf_future(GPR_CLOCK_REALTIME)
+                                         : gpr_inf_past(GPR_CLOCK_REALTIME);
+    switch (AsyncNextInternal(&tags[n], &oks[n], deadline)) {
+      case GOT_EVENT:
+        ++n;
+        break;
+      case TIMEOUT:
+      case SHUTDOWN:
+        return n;
+    }
+  }
+  return n;
+}
+
 CompletionQueue::CompletionQueueTLSCache::CompletionQueueTLSCache(
     CompletionQueue* cq)
     : cq_(cq), flushed_(false) {
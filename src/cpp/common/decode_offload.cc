@@ -0,0 +1,96 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpcpp/support/decode_offload.h>
+
+#include <queue>
+#include <vector>
+
+#include <grpc/support/log.h>
+
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/thd.h"
+
+namespace grpc {
+namespace internal {
+
+DecodeOffloadPoolInterface* g_decode_offload_pool = nullptr;
+size_t g_decode_offload_threshold = 0;
+
+}  // namespace internal
+
+namespace {
+
+// Fixed-size pool of decoder threads draining a shared work queue. The
+// pool lives for the rest of the process once installed, so there is no
+// shutdown path.
+class DecodeOffloadPool final : public internal::DecodeOffloadPoolInterface {
+ public:
+  explicit DecodeOffloadPool(size_t num_threads) {
+    threads_.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; i++) {
+      threads_.emplace_back(
+          "grpcpp_decode_offload",
+          [](void* arg) { static_cast<DecodeOffloadPool*>(arg)->ThreadFunc(); },
+          this);
+      threads_.back().Start();
+    }
+  }
+
+  void Schedule(std::function<void()> work) override {
+    grpc_core::MutexLock lock(&mu_);
+    work_.push(std::move(work));
+    cv_.Signal();
+  }
+
+ private:
+  void ThreadFunc() {
+    for (;;) {
+      std::function<void()> work;
+      {
+        grpc_core::MutexLock lock(&mu_);
+        while (work_.empty()) {
+          cv_.Wait(&mu_);
+        }
+        work = std::move(work_.front());
+        work_.pop();
+      }
+      work();
+    }
+  }
+
+  grpc_core::Mutex mu_;
+  grpc_core::CondVar cv_;
+  std::queue<std::function<void()>> work_ /* GUARDED_BY(mu_) */;
+  std::vector<grpc_core::Thread> threads_;
+};
+
+}  // namespace
+
+namespace experimental {
+
+void EnableDecodeOffload(size_t num_decoder_threads,
+                         size_t min_message_bytes) {
+  GPR_ASSERT(num_decoder_threads > 0);
+  GPR_ASSERT(internal::g_decode_offload_pool == nullptr);
+  internal::g_decode_offload_threshold = min_message_bytes;
+  internal::g_decode_offload_pool = new DecodeOffloadPool(num_decoder_threads);
+}
+
+}  // namespace experimental
+}  // namespace grpc
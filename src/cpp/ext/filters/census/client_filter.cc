@@ -141,12 +141,15 @@ void OpenCensusCallTracer::OpenCensusCallAttemptTracer::
         absl::Status status, grpc_metadata_batch* recv_trailing_metadata,
         const grpc_transport_stream_stats& transport_stream_stats) {
   FilterTrailingMetadata(recv_trailing_metadata, &elapsed_time_);
+  status_code_ = status.code();
+  // Unsampled calls still consume the server stats above (the metadata must
+  // be filtered out either way) but skip all stats recording.
+  if (!parent_->record_stats_) return;
   const uint64_t request_size = transport_stream_stats.outgoing.data_bytes;
   const uint64_t response_size = transport_stream_stats.incoming.data_bytes;
   std::vector<std::pair<opencensus::tags::TagKey, std::string>> tags =
       context_.tags().tags();
   tags.emplace_back(ClientMethodTagKey(), std::string(parent_->method_));
-  status_code_ = status.code();
   std::string final_status = absl::StatusCodeToString(status_code_);
   tags.emplace_back(ClientStatusTagKey(), final_status);
   ::opencensus::stats::Record(
@@ -165,16 +168,18 @@ void OpenCensusCallTracer::OpenCensusCallAttemptTracer::RecordCancel(
 
 void OpenCensusCallTracer::OpenCensusCallAttemptTracer::RecordEnd(
     const gpr_timespec& /* latency */) {
-  double latency_ms = absl::ToDoubleMilliseconds(absl::Now() - start_time_);
-  std::vector<std::pair<opencensus::tags::TagKey, std::string>> tags =
-      context_.tags().tags();
-  tags.emplace_back(ClientMethodTagKey(), std::string(parent_->method_));
-  tags.emplace_back(ClientStatusTagKey(), StatusCodeToString(status_code_));
-  ::opencensus::stats::Record(
-      {{RpcClientRoundtripLatency(), latency_ms},
-       {RpcClientSentMessagesPerRpc(), sent_message_count_},
-       {RpcClientReceivedMessagesPerRpc(), recv_message_count_}},
-      tags);
+  if (parent_->record_stats_) {
+    double latency_ms = absl::ToDoubleMilliseconds(absl::Now() - start_time_);
+    std::vector<std::pair<opencensus::tags::TagKey, std::string>> tags =
+        context_.tags().tags();
+    tags.emplace_back(ClientMethodTagKey(), std::string(parent_->method_));
+    tags.emplace_back(ClientStatusTagKey(), StatusCodeToString(status_code_));
+    ::opencensus::stats::Record(
+        {{RpcClientRoundtripLatency(), latency_ms},
+         {RpcClientSentMessagesPerRpc(), sent_message_count_},
+         {RpcClientReceivedMessagesPerRpc(), recv_message_count_}},
+        tags);
+  }
   if (status_code_ != absl::StatusCode::kOk) {
     context_.Span().SetStatus(opencensus::trace::StatusCode(status_code_),
                               StatusCodeToString(status_code_));
@@ -197,19 +202,22 @@ void OpenCensusCallTracer::OpenCensusCallAttemptTracer::RecordEnd(
 
 OpenCensusCallTracer::OpenCensusCallTracer(const grpc_call_element_args* args)
     : call_context_(args->context),
+      record_stats_(OpenCensusStatsSampleNewCall()),
       path_(grpc_slice_ref_internal(args->path)),
       method_(GetMethod(&path_)),
       arena_(args->arena) {}
 
 OpenCensusCallTracer::~OpenCensusCallTracer() {
-  std::vector<std::pair<opencensus::tags::TagKey, std::string>> tags =
-      context_.tags().tags();
-  tags.emplace_back(ClientMethodTagKey(), std::string(method_));
-  ::opencensus::stats::Record(
-      {{RpcClientRetriesPerCall(), retries_ - 1},  // exclude first attempt
-       {RpcClientTransparentRetriesPerCall(), transparent_retries_},
-       {RpcClientRetryDelayPerCall(), ToDoubleMilliseconds(retry_delay_)}},
-      tags);
+  if (record_stats_) {
+    std::vector<std::pair<opencensus::tags::TagKey, std::string>> tags =
+        context_.tags().tags();
+    tags.emplace_back(ClientMethodTagKey(), std::string(method_));
+    ::opencensus::stats::Record(
+        {{RpcClientRetriesPerCall(), retries_ - 1},  // exclude first attempt
+         {RpcClientTransparentRetriesPerCall(), transparent_retries_},
+         {RpcClientRetryDelayPerCall(), ToDoubleMilliseconds(retry_delay_)}},
+        tags);
+  }
   grpc_slice_unref_internal(path_);
 }
 
@@ -20,6 +20,9 @@
 
 #include "src/cpp/ext/filters/census/grpc_plugin.h"
 
+#include <atomic>
+
+#include "absl/time/clock.h"
 #include "opencensus/tags/tag_key.h"
 #include "opencensus/trace/span.h"
 
@@ -59,6 +62,47 @@ void RegisterOpenCensusPlugin() {
   RpcServerReceivedMessagesPerRpc();
 }
 
+namespace {
+
+// The sampling probability, scaled to a uint32_t threshold so that the
+// per-call decision is a relaxed load and an integer compare against a cheap
+// thread-local PRNG. UINT32_MAX means "record every call" and is
+// special-cased so the default configuration never touches the PRNG.
+std::atomic<uint32_t> g_stats_sampling_threshold{UINT32_MAX};
+
+// xorshift64* -- not cryptographic, but plenty for sampling, and avoids
+// taking any locks or making any allocations on the call path.
+uint32_t SamplingRand() {
+  thread_local uint64_t state =
+      absl::ToUnixNanos(absl::Now()) ^
+      reinterpret_cast<uintptr_t>(&state);
+  state ^= state >> 12;
+  state ^= state << 25;
+  state ^= state >> 27;
+  return static_cast<uint32_t>((state * 0x2545F4914F6CDD1Dull) >> 32);
+}
+
+}  // namespace
+
+void SetOpenCensusStatsSamplingProbability(double probability) {
+  uint32_t threshold;
+  if (probability >= 1.0) {
+    threshold = UINT32_MAX;
+  } else if (probability <= 0.0) {
+    threshold = 0;
+  } else {
+    threshold = static_cast<uint32_t>(probability * UINT32_MAX);
+  }
+  g_stats_sampling_threshold.store(threshold, std::memory_order_relaxed);
+}
+
+bool OpenCensusStatsSampleNewCall() {
+  const uint32_t threshold =
+      g_stats_sampling_threshold.load(std::memory_order_relaxed);
+  if (threshold == UINT32_MAX) return true;
+  return SamplingRand() < threshold;
+}
+
 ::opencensus::trace::Span GetSpanFromServerContext(
     grpc::ServerContext* context) {
   if (context == nullptr) return opencensus::trace::Span::BlankSpan();
@@ -29,6 +29,14 @@
 
 namespace grpc {
 
+// Makes the head-based stats sampling decision for a new call, using the
+// probability set via SetOpenCensusStatsSamplingProbability(). The result is
+// cached for the lifetime of the call (in OpenCensusCallTracer on the client
+// and CensusServerCallData on the server) so that all measures for a call are
+// either recorded together or skipped together. With the default probability
+// of 1.0 this is a single relaxed atomic load.
+bool OpenCensusStatsSampleNewCall();
+
 // The tag keys set when recording RPC stats.
 ::opencensus::tags::TagKey ClientMethodTagKey();
 ::opencensus::tags::TagKey ClientStatusTagKey();
@@ -88,6 +88,10 @@ class OpenCensusCallTracer : public grpc_core::CallTracer {
 
  private:
   const grpc_call_context_element* call_context_;
+  // Whether stats are recorded for this call. The head-based sampling
+  // decision is made once at call creation and shared by all attempts, so
+  // it is immutable and read without taking `mu_`.
+  const bool record_stats_;
   // Client method.
   grpc_slice path_;
   absl::string_view method_;
@@ -159,6 +159,7 @@ void CensusServerCallData::StartTransportStreamOpBatch(
 grpc_error_handle CensusServerCallData::Init(
     grpc_call_element* elem, const grpc_call_element_args* args) {
   start_time_ = absl::Now();
+  record_stats_ = OpenCensusStatsSampleNewCall();
   gc_ =
       grpc_call_from_top_element(grpc_call_stack_element(args->call_stack, 0));
   GRPC_CLOSURE_INIT(&on_done_recv_initial_metadata_,
@@ -173,18 +174,20 @@ grpc_error_handle CensusServerCallData::Init(
 void CensusServerCallData::Destroy(grpc_call_element* /*elem*/,
                                    const grpc_call_final_info* final_info,
                                    grpc_closure* /*then_call_closure*/) {
-  const uint64_t request_size = GetOutgoingDataSize(final_info);
-  const uint64_t response_size = GetIncomingDataSize(final_info);
-  double elapsed_time_ms = absl::ToDoubleMilliseconds(elapsed_time_);
   grpc_auth_context_release(auth_context_);
-  ::opencensus::stats::Record(
-      {{RpcServerSentBytesPerRpc(), static_cast<double>(response_size)},
-       {RpcServerReceivedBytesPerRpc(), static_cast<double>(request_size)},
-       {RpcServerServerLatency(), elapsed_time_ms},
-       {RpcServerSentMessagesPerRpc(), sent_message_count_},
-       {RpcServerReceivedMessagesPerRpc(), recv_message_count_}},
-      {{ServerMethodTagKey(), method_},
-       {ServerStatusTagKey(), StatusCodeToString(final_info->final_status)}});
+  if (record_stats_) {
+    const uint64_t request_size = GetOutgoingDataSize(final_info);
+    const uint64_t response_size = GetIncomingDataSize(final_info);
+    double elapsed_time_ms = absl::ToDoubleMilliseconds(elapsed_time_);
+    ::opencensus::stats::Record(
+        {{RpcServerSentBytesPerRpc(), static_cast<double>(response_size)},
+         {RpcServerReceivedBytesPerRpc(), static_cast<double>(request_size)},
+         {RpcServerServerLatency(), elapsed_time_ms},
+         {RpcServerSentMessagesPerRpc(), sent_message_count_},
+         {RpcServerReceivedMessagesPerRpc(), recv_message_count_}},
+        {{ServerMethodTagKey(), method_},
+         {ServerStatusTagKey(), StatusCodeToString(final_info->final_status)}});
+  }
   grpc_slice_unref_internal(path_);
   context_.EndSpan();
 }
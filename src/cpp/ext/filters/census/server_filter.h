@@ -49,7 +49,8 @@ class CensusServerCallData : public CallData {
         initial_on_done_recv_message_(nullptr),
         recv_message_(nullptr),
         recv_message_count_(0),
-        sent_message_count_(0) {
+        sent_message_count_(0),
+        record_stats_(true) {
     memset(&census_bin_, 0, sizeof(grpc_linked_mdelem));
     memset(&path_, 0, sizeof(grpc_slice));
     memset(&on_done_recv_initial_metadata_, 0, sizeof(grpc_closure));
@@ -94,6 +95,9 @@ class CensusServerCallData : public CallData {
   grpc_core::OrphanablePtr<grpc_core::ByteStream>* recv_message_;
   uint64_t recv_message_count_;
   uint64_t sent_message_count_;
+  // Whether stats are recorded for this call; the head-based sampling
+  // decision is made once in Init() and never changes afterwards.
+  bool record_stats_;
   // Buffer needed for grpc_slice to reference it when adding metatdata to
   // response.
   char stats_buf_[kMaxServerStatsLen];
@@ -20,6 +20,8 @@
 
 #include <climits>
 
+#include "absl/time/time.h"
+
 #include <grpc/support/log.h>
 
 #include "src/core/lib/gprpp/thd.h"
@@ -27,6 +29,13 @@
 
 namespace grpc {
 
+namespace {
+// How long a surplus worker thread lingers parked before it actually exits.
+// This puts hysteresis on pool shrink: an oscillating load reuses parked
+// threads instead of continually destroying and recreating them.
+constexpr int64_t kParkedThreadGraceMs = 1000;
+}  // namespace
+
 ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr)
     : thd_mgr_(thd_mgr) {
   // Make thread creation exclusive with respect to its join happening in
@@ -55,6 +64,8 @@ ThreadManager::ThreadManager(const char* name,
                              int min_pollers, int max_pollers)
     : shutdown_(false),
       num_pollers_(0),
+      num_parked_(0),
+      parked_wakeups_(0),
       min_pollers_(min_pollers),
       max_pollers_(max_pollers == -1 ? INT_MAX : max_pollers),
       num_threads_(0),
@@ -84,6 +95,9 @@ void ThreadManager::Wait() {
 void ThreadManager::Shutdown() {
   grpc_core::MutexLock lock(&mu_);
   shutdown_ = true;
+  // Parked threads only exit once their grace period elapses; wake them all
+  // so that shutdown is not delayed by it
+  parked_cv_.SignalAll();
 }
 
 bool ThreadManager::IsShutdown() {
@@ -173,7 +187,15 @@ void ThreadManager::MainWorkLoop() {
         // quota available to create a new thread, start a new poller thread
         bool resource_exhausted = false;
         if (!shutdown_ && num_pollers_ < min_pollers_) {
-          if (grpc_resource_user_allocate_threads(resource_user_, 1)) {
+          if (num_parked_ > parked_wakeups_) {
+            // Hand our polling slot to a parked thread: waking a warm thread
+            // is much cheaper than creating one. We bump num_pollers_ on its
+            // behalf; it claims the slot when it wakes up.
+            num_pollers_++;
+            parked_wakeups_++;
+            parked_cv_.Signal();
+            lock.Release();
+          } else if (grpc_resource_user_allocate_threads(resource_user_, 1)) {
             // We can allocate a new poller thread
             num_pollers_++;
             num_threads_++;
@@ -225,11 +247,12 @@ void ThreadManager::MainWorkLoop() {
     // Otherwise go back to polling as long as it doesn't exceed max_pollers_
     //
     // **WARNING**:
-    // There is a possibility of threads thrashing here (i.e excessive thread
-    // shutdowns and creations than the ideal case). This happens if max_poller_
-    // count is small and the rate of incoming requests is also small. In such
-    // scenarios we can possibly configure max_pollers_ to a higher value and/or
-    // increase the cq timeout.
+    // There is a possibility of threads thrashing here (i.e more thread
+    // parks/unparks - and, once grace periods expire, shutdowns and creations
+    // - than the ideal case). This happens if max_poller_ count is small and
+    // the rate of incoming requests is also small. In such scenarios we can
+    // possibly configure max_pollers_ to a higher value and/or increase the
+    // cq timeout.
     //
     // However, not doing this check here and unconditionally incrementing
     // num_pollers (and hoping that the system will eventually settle down) has
@@ -251,9 +274,29 @@ void ThreadManager::MainWorkLoop() {
     // avalanche.
     if (num_pollers_ < max_pollers_) {
       num_pollers_++;
-    } else {
-      break;
+      continue;
+    }
+
+    // We have enough pollers. Rather than exiting right away (and paying for
+    // a pthread_create the next time load ticks up), park this thread for a
+    // grace period: a thread that finds work while we are parked hands us its
+    // polling slot instead of spawning a fresh thread. Only threads that stay
+    // parked for the full grace period actually exit.
+    num_parked_++;
+    bool timed_out = false;
+    while (!shutdown_ && parked_wakeups_ == 0 && !timed_out) {
+      timed_out = parked_cv_.WaitWithTimeout(
+          &mu_, absl::Milliseconds(kParkedThreadGraceMs));
+    }
+    num_parked_--;
+    if (parked_wakeups_ > 0) {
+      // A working thread handed us its polling slot (num_pollers_ was already
+      // incremented on our behalf); go straight back to polling. On shutdown
+      // the next PollForWork() will return SHUTDOWN and finish the thread.
+      parked_wakeups_--;
+      continue;
     }
+    break;
   };
 
   // This thread is exiting. Do some cleanup work i.e delete already completed
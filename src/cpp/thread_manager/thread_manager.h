@@ -141,8 +141,8 @@ class ThreadManager {
   void MarkAsCompleted(WorkerThread* thd);
   void CleanupCompletedThreads();
 
-  // Protects shutdown_, num_pollers_, num_threads_ and
-  // max_active_threads_sofar_
+  // Protects shutdown_, num_pollers_, num_threads_, num_parked_,
+  // parked_wakeups_ and max_active_threads_sofar_
   grpc_core::Mutex mu_;
 
   bool shutdown_;
@@ -159,6 +159,19 @@ class ThreadManager {
   // Number of threads doing polling
   int num_pollers_;
 
+  // Number of threads that found themselves surplus to max_pollers_ and are
+  // parked for a grace period, so that a subsequent ramp in load can reuse
+  // them instead of creating fresh threads
+  int num_parked_;
+
+  // Number of parked threads that have been handed a polling slot but have
+  // not yet woken up to claim it
+  int parked_wakeups_;
+
+  // Signalled to wake parked threads, either for a polling handoff or for
+  // shutdown
+  grpc_core::CondVar parked_cv_;
+
   // The minimum and maximum number of threads that should be doing polling
   int min_pollers_;
   int max_pollers_;
@@ -74,6 +74,12 @@ extern grpc_metadata_array_init_type grpc_metadata_array_init_import;
 typedef void(*grpc_metadata_array_destroy_type)(grpc_metadata_array* array);
 extern grpc_metadata_array_destroy_type grpc_metadata_array_destroy_import;
 #define grpc_metadata_array_destroy grpc_metadata_array_destroy_import
+typedef grpc_validated_metadata*(*grpc_validated_metadata_create_type)(const grpc_metadata* metadata, size_t count);
+extern grpc_validated_metadata_create_type grpc_validated_metadata_create_import;
+#define grpc_validated_metadata_create grpc_validated_metadata_create_import
+typedef void(*grpc_validated_metadata_destroy_type)(grpc_validated_metadata* validated);
+extern grpc_validated_metadata_destroy_type grpc_validated_metadata_destroy_import;
+#define grpc_validated_metadata_destroy grpc_validated_metadata_destroy_import
 typedef void(*grpc_call_details_init_type)(grpc_call_details* details);
 extern grpc_call_details_init_type grpc_call_details_init_import;
 #define grpc_call_details_init grpc_call_details_init_import
@@ -89,6 +95,9 @@ extern grpc_init_type grpc_init_import;
 typedef void(*grpc_shutdown_type)(void);
 extern grpc_shutdown_type grpc_shutdown_import;
 #define grpc_shutdown grpc_shutdown_import
+typedef void(*grpc_prewarm_type)(void);
+extern grpc_prewarm_type grpc_prewarm_import;
+#define grpc_prewarm grpc_prewarm_import
 typedef int(*grpc_is_initialized_type)(void);
 extern grpc_is_initialized_type grpc_is_initialized_import;
 #define grpc_is_initialized grpc_is_initialized_import
@@ -119,6 +128,9 @@ extern grpc_completion_queue_create_type grpc_completion_queue_create_import;
 typedef grpc_event(*grpc_completion_queue_next_type)(grpc_completion_queue* cq, gpr_timespec deadline, void* reserved);
 extern grpc_completion_queue_next_type grpc_completion_queue_next_import;
 #define grpc_completion_queue_next grpc_completion_queue_next_import
+typedef size_t(*grpc_completion_queue_next_batch_type)(grpc_completion_queue* cq, grpc_event* events, size_t max_events, gpr_timespec deadline, void* reserved);
+extern grpc_completion_queue_next_batch_type grpc_completion_queue_next_batch_import;
+#define grpc_completion_queue_next_batch grpc_completion_queue_next_batch_import
 typedef grpc_event(*grpc_completion_queue_pluck_type)(grpc_completion_queue* cq, void* tag, gpr_timespec deadline, void* reserved);
 extern grpc_completion_queue_pluck_type grpc_completion_queue_pluck_import;
 #define grpc_completion_queue_pluck grpc_completion_queue_pluck_import
@@ -305,6 +317,12 @@ extern grpc_authorization_policy_provider_arg_vtable_type grpc_authorization_pol
 typedef grpc_channel*(*grpc_insecure_channel_create_from_fd_type)(const char* target, int fd, const grpc_channel_args* args);
 extern grpc_insecure_channel_create_from_fd_type grpc_insecure_channel_create_from_fd_import;
 #define grpc_insecure_channel_create_from_fd grpc_insecure_channel_create_from_fd_import
+typedef grpc_byte_buffer_iovec_handle*(*grpc_byte_buffer_export_iovec_type)(grpc_byte_buffer* buffer, struct iovec** iov, size_t* iov_count);
+extern grpc_byte_buffer_export_iovec_type grpc_byte_buffer_export_iovec_import;
+#define grpc_byte_buffer_export_iovec grpc_byte_buffer_export_iovec_import
+typedef void(*grpc_byte_buffer_iovec_handle_destroy_type)(grpc_byte_buffer_iovec_handle* handle);
+extern grpc_byte_buffer_iovec_handle_destroy_type grpc_byte_buffer_iovec_handle_destroy_import;
+#define grpc_byte_buffer_iovec_handle_destroy grpc_byte_buffer_iovec_handle_destroy_import
 typedef void(*grpc_server_add_insecure_channel_from_fd_type)(grpc_server* server, void* reserved, int fd);
 extern grpc_server_add_insecure_channel_from_fd_type grpc_server_add_insecure_channel_from_fd_import;
 #define grpc_server_add_insecure_channel_from_fd grpc_server_add_insecure_channel_from_fd_import
@@ -614,6 +632,9 @@ extern grpc_slice_malloc_large_type grpc_slice_malloc_large_import;
 typedef grpc_slice(*grpc_slice_intern_type)(grpc_slice slice);
 extern grpc_slice_intern_type grpc_slice_intern_import;
 #define grpc_slice_intern grpc_slice_intern_import
+typedef void(*grpc_slice_register_well_known_string_type)(const char* str);
+extern grpc_slice_register_well_known_string_type grpc_slice_register_well_known_string_import;
+#define grpc_slice_register_well_known_string grpc_slice_register_well_known_string_import
 typedef grpc_slice(*grpc_slice_from_copied_string_type)(const char* source);
 extern grpc_slice_from_copied_string_type grpc_slice_from_copied_string_import;
 #define grpc_slice_from_copied_string grpc_slice_from_copied_string_import
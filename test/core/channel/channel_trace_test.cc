@@ -50,7 +50,7 @@ class ChannelNodePeer {
   ChannelNode* node_;
 };
 
-size_t GetSizeofTraceEvent() { return sizeof(ChannelTrace::TraceEvent); }
+size_t GetSizeofTraceEvent() { return sizeof(ChannelTrace::EventRecord); }
 
 namespace {
 
@@ -280,7 +280,7 @@ TEST(ChannelTracerTest, TestEviction) {
   }
 }
 
-TEST(ChannelTracerTest, TestMultipleEviction) {
+TEST(ChannelTracerTest, TestLongDescription) {
   grpc_core::ExecCtx exec_ctx;
   const int kTraceEventSize = GetSizeofTraceEvent();
   const int kNumEvents = 5;
@@ -289,17 +289,17 @@ TEST(ChannelTracerTest, TestMultipleEviction) {
     AddSimpleTrace(&tracer);
     ValidateChannelTrace(&tracer, i);
   }
-  // at this point the list is full, and each subsequent enntry will cause an
-  // eviction. We will now add in a trace event that has a copied string. This
-  // uses more memory, so it will cause a double eviciction
+  // at this point the ring is full. Since descriptions are stored inline
+  // in fixed-size records, a long description is truncated rather than
+  // causing extra evictions, so exactly one old event is replaced.
   tracer.AddTraceEvent(
       ChannelTrace::Severity::Info,
       grpc_slice_from_copied_string(
-          "long enough string to trigger a multiple eviction"));
-  ValidateChannelTraceCustom(&tracer, kNumEvents + 1, kNumEvents - 1);
+          "long enough string to overflow the inline description"));
+  ValidateChannelTraceCustom(&tracer, kNumEvents + 1, kNumEvents);
 }
 
-TEST(ChannelTracerTest, TestTotalEviction) {
+TEST(ChannelTracerTest, TestHugeDescription) {
   grpc_core::ExecCtx exec_ctx;
   const int kTraceEventSize = GetSizeofTraceEvent();
   const int kNumEvents = 5;
@@ -308,11 +308,12 @@ TEST(ChannelTracerTest, TestTotalEviction) {
     AddSimpleTrace(&tracer);
     ValidateChannelTrace(&tracer, i);
   }
-  // at this point the list is full. Now we add such a big slice that
-  // everything gets evicted.
-  grpc_slice huge_slice = grpc_slice_malloc(kTraceEventSize * (kNumEvents + 1));
-  tracer.AddTraceEvent(ChannelTrace::Severity::Info, huge_slice);
-  ValidateChannelTraceCustom(&tracer, kNumEvents + 1, 0);
+  // even a description bigger than the whole memory limit only truncates;
+  // it never evicts more than the one record it overwrites.
+  std::string huge(kTraceEventSize * (kNumEvents + 1), 'a');
+  tracer.AddTraceEvent(ChannelTrace::Severity::Info,
+                       grpc_slice_from_copied_string(huge.c_str()));
+  ValidateChannelTraceCustom(&tracer, kNumEvents + 1, kNumEvents);
 }
 
 }  // namespace testing
@@ -0,0 +1,273 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Tests GRPC_ARG_EXPERIMENTAL_SHARE_RESOLVER: channels that opt in get a
+ * proxy onto a process-wide shared resolver keyed by target, with results
+ * fanned out to every subscriber, re-resolution requests coalesced, and
+ * the inner resolver torn down when the last subscriber goes away. The
+ * fake resolver plays the part of the inner resolver. */
+
+#include <string.h>
+
+#include <memory>
+#include <string>
+
+#include "absl/strings/str_format.h"
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
+
+#include "src/core/ext/filters/client_channel/resolver/fake/fake_resolver.h"
+#include "src/core/ext/filters/client_channel/resolver_registry.h"
+#include "src/core/ext/filters/client_channel/server_address.h"
+#include "src/core/lib/address_utils/parse_address.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/thd.h"
+#include "src/core/lib/iomgr/work_serializer.h"
+#include "test/core/util/test_config.h"
+
+// Checks that each result delivered was expected: a result arriving with no
+// expectation set (e.g. after the owning proxy was shut down) aborts.
+class ResultHandler : public grpc_core::Resolver::ResultHandler {
+ public:
+  void SetExpectedAndEvent(grpc_core::Resolver::Result expected,
+                           gpr_event* ev) {
+    GPR_ASSERT(ev_ == nullptr);
+    expected_ = std::move(expected);
+    ev_ = ev;
+  }
+
+  void ReturnResult(grpc_core::Resolver::Result actual) override {
+    GPR_ASSERT(ev_ != nullptr);
+    // Only the addresses are compared; that's all the test sets via
+    // FakeResolverResponseGenerator::SetResponse().
+    GPR_ASSERT(actual.addresses.size() == expected_.addresses.size());
+    for (size_t i = 0; i < expected_.addresses.size(); ++i) {
+      GPR_ASSERT(actual.addresses[i] == expected_.addresses[i]);
+    }
+    gpr_event_set(ev_, reinterpret_cast<void*>(1));
+    ev_ = nullptr;
+  }
+
+  void ReturnError(grpc_error_handle /*error*/) override {}
+
+ private:
+  grpc_core::Resolver::Result expected_;
+  gpr_event* ev_ = nullptr;
+};
+
+// A proxy onto the shared resolver plus the per-channel pieces a client
+// channel would own: a pollset_set, a work serializer, and a result
+// handler.
+struct subscriber {
+  grpc_core::OrphanablePtr<grpc_core::Resolver> resolver;
+  grpc_pollset_set* pollset_set = nullptr;
+  std::shared_ptr<grpc_core::WorkSerializer> work_serializer;
+  ResultHandler* result_handler = nullptr;  // Owned by resolver.
+};
+
+// Creates a sharing subscriber for \a target whose inner resolver (created
+// for the first subscriber only) is driven by \a response_generator.
+static subscriber create_subscriber(
+    const char* target,
+    grpc_core::FakeResolverResponseGenerator* response_generator) {
+  subscriber sub;
+  sub.pollset_set = grpc_pollset_set_create();
+  sub.work_serializer = std::make_shared<grpc_core::WorkSerializer>();
+  sub.result_handler = new ResultHandler();
+  grpc_arg args_to_add[2];
+  args_to_add[0] = grpc_core::FakeResolverResponseGenerator::MakeChannelArg(
+      response_generator);
+  args_to_add[1] = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_ARG_EXPERIMENTAL_SHARE_RESOLVER), 1);
+  grpc_channel_args channel_args = {GPR_ARRAY_SIZE(args_to_add), args_to_add};
+  sub.resolver = grpc_core::ResolverRegistry::CreateResolver(
+      target, &channel_args, sub.pollset_set, sub.work_serializer,
+      std::unique_ptr<grpc_core::Resolver::ResultHandler>(sub.result_handler));
+  GPR_ASSERT(sub.resolver != nullptr);
+  return sub;
+}
+
+static void destroy_subscriber(subscriber* sub) {
+  sub->resolver.reset();
+  grpc_pollset_set_destroy(sub->pollset_set);
+}
+
+// Creates a new resolution containing 2 addresses.
+static grpc_core::Resolver::Result create_new_resolver_result() {
+  static size_t test_counter = 0;
+  const size_t num_addresses = 2;
+  grpc_core::Resolver::Result result;
+  for (size_t i = 0; i < num_addresses; ++i) {
+    std::string uri_string = absl::StrFormat("ipv4:127.0.0.1:100%" PRIuPTR,
+                                             test_counter * num_addresses + i);
+    absl::StatusOr<grpc_core::URI> uri = grpc_core::URI::Parse(uri_string);
+    GPR_ASSERT(uri.ok());
+    grpc_resolved_address address;
+    GPR_ASSERT(grpc_parse_uri(*uri, &address));
+    result.addresses.emplace_back(
+        address.addr, address.len,
+        grpc_channel_args_copy_and_add(nullptr, nullptr, 0));
+  }
+  ++test_counter;
+  return result;
+}
+
+// A subscriber that joins after the shared resolver has returned a result
+// must get the cached result without new name-service traffic, and a
+// re-resolution requested by one subscriber must fan its result out to all
+// of them.
+static void test_shared_resolver_fan_out() {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::RefCountedPtr<grpc_core::FakeResolverResponseGenerator>
+      response_generator =
+          grpc_core::MakeRefCounted<grpc_core::FakeResolverResponseGenerator>();
+  // First subscriber: starts the inner resolver and sees its result.
+  gpr_log(GPR_INFO, "TEST: fan-out: first subscriber");
+  subscriber sub1 = create_subscriber("fake:shared", response_generator.get());
+  sub1.resolver->StartLocked();
+  grpc_core::Resolver::Result result = create_new_resolver_result();
+  gpr_event ev1;
+  gpr_event_init(&ev1);
+  sub1.result_handler->SetExpectedAndEvent(result, &ev1);
+  response_generator->SetResponse(result);
+  grpc_core::ExecCtx::Get()->Flush();
+  GPR_ASSERT(gpr_event_wait(&ev1, grpc_timeout_seconds_to_deadline(5)) !=
+             nullptr);
+  // Second subscriber joins mid-stream: the cached result is replayed to
+  // it; the fake resolver is not asked again.
+  gpr_log(GPR_INFO, "TEST: fan-out: second subscriber gets cached result");
+  subscriber sub2 = create_subscriber("fake:shared", response_generator.get());
+  gpr_event ev2;
+  gpr_event_init(&ev2);
+  sub2.result_handler->SetExpectedAndEvent(result, &ev2);
+  sub2.resolver->StartLocked();
+  grpc_core::ExecCtx::Get()->Flush();
+  GPR_ASSERT(gpr_event_wait(&ev2, grpc_timeout_seconds_to_deadline(5)) !=
+             nullptr);
+  // One subscriber requests re-resolution; both receive the new result.
+  gpr_log(GPR_INFO, "TEST: fan-out: re-resolution reaches all subscribers");
+  grpc_core::Resolver::Result reresolution_result =
+      create_new_resolver_result();
+  gpr_event ev3;
+  gpr_event ev4;
+  gpr_event_init(&ev3);
+  gpr_event_init(&ev4);
+  sub1.result_handler->SetExpectedAndEvent(reresolution_result, &ev3);
+  sub2.result_handler->SetExpectedAndEvent(reresolution_result, &ev4);
+  response_generator->SetReresolutionResponse(std::move(reresolution_result));
+  grpc_core::ExecCtx::Get()->Flush();
+  sub1.resolver->RequestReresolutionLocked();
+  grpc_core::ExecCtx::Get()->Flush();
+  GPR_ASSERT(gpr_event_wait(&ev3, grpc_timeout_seconds_to_deadline(5)) !=
+             nullptr);
+  GPR_ASSERT(gpr_event_wait(&ev4, grpc_timeout_seconds_to_deadline(5)) !=
+             nullptr);
+  destroy_subscriber(&sub1);
+  destroy_subscriber(&sub2);
+}
+
+struct blocked_shutdown_args {
+  subscriber* sub;
+  gpr_event* in_callback;
+  gpr_event* result_queued;
+};
+
+// Runs on the subscriber's work serializer from a separate thread: holds
+// the serializer so that the fan-out of the next result queues behind it,
+// then shuts the proxy down from inside the serializer (the way a client
+// channel would) with that delivery still in flight.
+static void blocked_shutdown_thread(void* arg) {
+  blocked_shutdown_args* a = static_cast<blocked_shutdown_args*>(arg);
+  grpc_core::ExecCtx exec_ctx;
+  a->sub->work_serializer->Run(
+      [a]() {
+        gpr_event_set(a->in_callback, reinterpret_cast<void*>(1));
+        GPR_ASSERT(gpr_event_wait(a->result_queued,
+                                  grpc_timeout_seconds_to_deadline(5)) !=
+                   nullptr);
+        a->sub->resolver.reset();
+      },
+      DEBUG_LOCATION);
+}
+
+// Destroys the last subscriber while a resolution callback is still in
+// flight: the queued fan-out must be dropped, not delivered to a dead
+// handler (ReturnResult aborts if it runs), and the shared state for the
+// target must be torn down so that a later subscriber starts fresh.
+static void test_shared_resolver_shutdown_with_result_in_flight() {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::RefCountedPtr<grpc_core::FakeResolverResponseGenerator>
+      response_generator =
+          grpc_core::MakeRefCounted<grpc_core::FakeResolverResponseGenerator>();
+  gpr_log(GPR_INFO, "TEST: shutdown with result in flight");
+  subscriber sub =
+      create_subscriber("fake:shared_shutdown", response_generator.get());
+  sub.resolver->StartLocked();
+  grpc_core::ExecCtx::Get()->Flush();
+  gpr_event in_callback;
+  gpr_event result_queued;
+  gpr_event_init(&in_callback);
+  gpr_event_init(&result_queued);
+  blocked_shutdown_args args = {&sub, &in_callback, &result_queued};
+  grpc_core::Thread thd("shared_resolver_shutdown", blocked_shutdown_thread,
+                        &args);
+  thd.Start();
+  GPR_ASSERT(gpr_event_wait(&in_callback,
+                            grpc_timeout_seconds_to_deadline(5)) != nullptr);
+  // With the subscriber's serializer held by the thread above, this
+  // result's fan-out queues behind its callback instead of running inline.
+  response_generator->SetResponse(create_new_resolver_result());
+  grpc_core::ExecCtx::Get()->Flush();
+  gpr_event_set(&result_queued, reinterpret_cast<void*>(1));
+  thd.Join();
+  grpc_core::ExecCtx::Get()->Flush();
+  grpc_pollset_set_destroy(sub.pollset_set);
+  // The last subscriber's departure removed the shared state: a new
+  // subscriber must not see the stale cached result, and must be served by
+  // a freshly created inner resolver.
+  gpr_log(GPR_INFO, "TEST: shutdown: later subscriber starts fresh");
+  grpc_core::RefCountedPtr<grpc_core::FakeResolverResponseGenerator>
+      fresh_generator =
+          grpc_core::MakeRefCounted<grpc_core::FakeResolverResponseGenerator>();
+  subscriber sub3 =
+      create_subscriber("fake:shared_shutdown", fresh_generator.get());
+  sub3.resolver->StartLocked();
+  grpc_core::ExecCtx::Get()->Flush();
+  grpc_core::Resolver::Result result = create_new_resolver_result();
+  gpr_event ev;
+  gpr_event_init(&ev);
+  sub3.result_handler->SetExpectedAndEvent(result, &ev);
+  fresh_generator->SetResponse(std::move(result));
+  grpc_core::ExecCtx::Get()->Flush();
+  GPR_ASSERT(gpr_event_wait(&ev, grpc_timeout_seconds_to_deadline(5)) !=
+             nullptr);
+  destroy_subscriber(&sub3);
+}
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  grpc_init();
+
+  test_shared_resolver_fan_out();
+  test_shared_resolver_shutdown_with_result_in_flight();
+
+  grpc_shutdown();
+  return 0;
+}
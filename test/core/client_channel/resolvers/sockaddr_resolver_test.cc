@@ -22,7 +22,9 @@
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
 
+#include "src/core/ext/filters/client_channel/resolver/sockaddr/sockaddr_resolver.h"
 #include "src/core/ext/filters/client_channel/resolver_registry.h"
+#include "src/core/lib/address_utils/parse_address.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/work_serializer.h"
 #include "test/core/util/test_config.h"
@@ -80,6 +82,37 @@ static void test_fails(grpc_core::ResolverFactory* factory,
   GPR_ASSERT(resolver == nullptr);
 }
 
+/* create a resolver from pre-built sockaddrs passed via channel args rather
+   than a parsed target path */
+static void test_pre_resolved(grpc_core::ResolverFactory* factory) {
+  gpr_log(GPR_DEBUG, "test: pre-resolved addresses with scheme-only target");
+  grpc_core::ExecCtx exec_ctx;
+  absl::StatusOr<grpc_core::URI> address_uri =
+      grpc_core::URI::Parse("ipv4:127.0.0.1:5000");
+  GPR_ASSERT(address_uri.ok());
+  grpc_resolved_address addr;
+  GPR_ASSERT(grpc_parse_ipv4(*address_uri, &addr));
+  grpc_core::ServerAddressList addresses;
+  addresses.emplace_back(addr, nullptr);
+  auto list = grpc_core::MakeRefCounted<grpc_core::PreResolvedAddressList>(
+      std::move(addresses));
+  grpc_arg arg =
+      grpc_core::PreResolvedAddressList::MakeChannelArg(list.get());
+  grpc_channel_args channel_args = {1, &arg};
+  absl::StatusOr<grpc_core::URI> uri = grpc_core::URI::Parse("ipv4:");
+  GPR_ASSERT(uri.ok());
+  grpc_core::ResolverArgs args;
+  args.uri = std::move(*uri);
+  args.args = &channel_args;
+  args.work_serializer = *g_work_serializer;
+  args.result_handler = absl::make_unique<ResultHandler>();
+  grpc_core::OrphanablePtr<grpc_core::Resolver> resolver =
+      factory->CreateResolver(std::move(args));
+  GPR_ASSERT(resolver != nullptr);
+  resolver->StartLocked();
+  grpc_core::ExecCtx::Get()->Flush();
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
@@ -99,6 +132,9 @@ int main(int argc, char** argv) {
   test_fails(ipv4, "ipv4:www.google.com");
   test_fails(ipv4, "ipv4:[");
   test_fails(ipv4, "ipv4://8.8.8.8/8.8.8.8:8888");
+  /* scheme-only target: addresses are supplied out of band */
+  test_succeeds(ipv4, "ipv4:");
+  test_pre_resolved(ipv4);
 
   test_fails(ipv6, "ipv6:[");
   test_fails(ipv6, "ipv6:[::]");
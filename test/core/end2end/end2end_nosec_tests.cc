@@ -79,6 +79,16 @@ extern void filter_status_code(grpc_end2end_test_config config);
 extern void filter_status_code_pre_init(void);
 extern void graceful_server_shutdown(grpc_end2end_test_config config);
 extern void graceful_server_shutdown_pre_init(void);
+extern void hedging(grpc_end2end_test_config config);
+extern void hedging_pre_init(void);
+extern void hedging_on_failure(grpc_end2end_test_config config);
+extern void hedging_on_failure_pre_init(void);
+extern void hedging_server_pushback_delay(grpc_end2end_test_config config);
+extern void hedging_server_pushback_delay_pre_init(void);
+extern void hedging_throttled(grpc_end2end_test_config config);
+extern void hedging_throttled_pre_init(void);
+extern void hedging_too_many_attempts(grpc_end2end_test_config config);
+extern void hedging_too_many_attempts_pre_init(void);
 extern void high_initial_seqno(grpc_end2end_test_config config);
 extern void high_initial_seqno_pre_init(void);
 extern void hpack_size(grpc_end2end_test_config config);
@@ -115,6 +125,8 @@ extern void ping_pong_streaming(grpc_end2end_test_config config);
 extern void ping_pong_streaming_pre_init(void);
 extern void proxy_auth(grpc_end2end_test_config config);
 extern void proxy_auth_pre_init(void);
+extern void recv_message_readahead(grpc_end2end_test_config config);
+extern void recv_message_readahead_pre_init(void);
 extern void registered_call(grpc_end2end_test_config config);
 extern void registered_call_pre_init(void);
 extern void request_with_flags(grpc_end2end_test_config config);
@@ -236,6 +248,11 @@ void grpc_end2end_tests_pre_init(void) {
   filter_latency_pre_init();
   filter_status_code_pre_init();
   graceful_server_shutdown_pre_init();
+  hedging_pre_init();
+  hedging_on_failure_pre_init();
+  hedging_server_pushback_delay_pre_init();
+  hedging_throttled_pre_init();
+  hedging_too_many_attempts_pre_init();
   high_initial_seqno_pre_init();
   hpack_size_pre_init();
   idempotent_request_pre_init();
@@ -254,6 +271,7 @@ void grpc_end2end_tests_pre_init(void) {
   ping_pre_init();
   ping_pong_streaming_pre_init();
   proxy_auth_pre_init();
+  recv_message_readahead_pre_init();
   registered_call_pre_init();
   request_with_flags_pre_init();
   request_with_payload_pre_init();
@@ -335,6 +353,11 @@ void grpc_end2end_tests(int argc, char **argv,
     filter_latency(config);
     filter_status_code(config);
     graceful_server_shutdown(config);
+    hedging(config);
+    hedging_on_failure(config);
+    hedging_server_pushback_delay(config);
+    hedging_throttled(config);
+    hedging_too_many_attempts(config);
     high_initial_seqno(config);
     hpack_size(config);
     idempotent_request(config);
@@ -353,6 +376,7 @@ void grpc_end2end_tests(int argc, char **argv,
     ping(config);
     ping_pong_streaming(config);
     proxy_auth(config);
+    recv_message_readahead(config);
     registered_call(config);
     request_with_flags(config);
     request_with_payload(config);
@@ -503,6 +527,26 @@ void grpc_end2end_tests(int argc, char **argv,
       graceful_server_shutdown(config);
       continue;
     }
+    if (0 == strcmp("hedging", argv[i])) {
+      hedging(config);
+      continue;
+    }
+    if (0 == strcmp("hedging_on_failure", argv[i])) {
+      hedging_on_failure(config);
+      continue;
+    }
+    if (0 == strcmp("hedging_server_pushback_delay", argv[i])) {
+      hedging_server_pushback_delay(config);
+      continue;
+    }
+    if (0 == strcmp("hedging_throttled", argv[i])) {
+      hedging_throttled(config);
+      continue;
+    }
+    if (0 == strcmp("hedging_too_many_attempts", argv[i])) {
+      hedging_too_many_attempts(config);
+      continue;
+    }
     if (0 == strcmp("high_initial_seqno", argv[i])) {
       high_initial_seqno(config);
       continue;
@@ -575,6 +619,10 @@ void grpc_end2end_tests(int argc, char **argv,
       proxy_auth(config);
       continue;
     }
+    if (0 == strcmp("recv_message_readahead", argv[i])) {
+      recv_message_readahead(config);
+      continue;
+    }
     if (0 == strcmp("registered_call", argv[i])) {
       registered_call(config);
       continue;
@@ -104,6 +104,14 @@ typedef struct proxy_connection {
   bool server_shutdown : 1;
 
   grpc_slice_buffer client_read_buffer;
+  // Bytes that the client pipelined behind its CONNECT request, to be
+  // forwarded to the backend once the tunnel is established.
+  grpc_slice_buffer client_early_data_buffer;
+  // True when GRPC_ARG_HTTP_PROXY_DROPS_EARLY_DATA is set; client bytes
+  // received before the CONNECT response has been written are discarded.
+  bool drops_early_data;
+  // Set once the CONNECT response write has completed.
+  bool response_written;
   grpc_slice_buffer client_deferred_write_buffer;
   bool client_is_writing;
   grpc_slice_buffer client_write_buffer;
@@ -133,6 +141,7 @@ static void proxy_connection_unref(proxy_connection* conn,
     }
     grpc_pollset_set_destroy(conn->pollset_set);
     grpc_slice_buffer_destroy_internal(&conn->client_read_buffer);
+    grpc_slice_buffer_destroy_internal(&conn->client_early_data_buffer);
     grpc_slice_buffer_destroy_internal(&conn->client_deferred_write_buffer);
     grpc_slice_buffer_destroy_internal(&conn->client_write_buffer);
     grpc_slice_buffer_destroy_internal(&conn->server_read_buffer);
@@ -318,6 +327,41 @@ static void on_client_read_done(void* arg, grpc_error_handle error) {
   conn->proxy->combiner->Run(&conn->on_client_read_done, GRPC_ERROR_REF(error));
 }
 
+static void on_discard_early_data(void* arg, grpc_error_handle error);
+
+// Callback for reading client data in early-data-dropping mode: bytes read
+// before the CONNECT response has been written are thrown away, the way
+// some real proxies drop data sent before the tunnel is established.  Once
+// the response is out, the loop turns into the normal client->server
+// forwarding loop.
+static void on_discard_early_data_locked(void* arg, grpc_error_handle error) {
+  proxy_connection* conn = static_cast<proxy_connection*>(arg);
+  if (error != GRPC_ERROR_NONE) {
+    proxy_connection_failed(conn, CLIENT_READ_FAILED,
+                            "HTTP proxy discard early data",
+                            GRPC_ERROR_REF(error));
+    return;
+  }
+  if (conn->response_written) {
+    // The client could have seen the CONNECT response by now, so this is
+    // no longer early data; forward it.
+    on_client_read_done_locked(conn, GRPC_ERROR_NONE);
+    return;
+  }
+  grpc_slice_buffer_reset_and_unref(&conn->client_read_buffer);
+  GRPC_CLOSURE_INIT(&conn->on_client_read_done, on_discard_early_data, conn,
+                    grpc_schedule_on_exec_ctx);
+  grpc_endpoint_read(conn->client_endpoint, &conn->client_read_buffer,
+                     &conn->on_client_read_done, /*urgent=*/false);
+}
+
+static void on_discard_early_data(void* arg, grpc_error_handle error) {
+  proxy_connection* conn = static_cast<proxy_connection*>(arg);
+  GRPC_CLOSURE_INIT(&conn->on_client_read_done, on_discard_early_data_locked,
+                    conn, nullptr);
+  conn->proxy->combiner->Run(&conn->on_client_read_done, GRPC_ERROR_REF(error));
+}
+
 // Callback for reading data from the backend server, which will be
 // proxied to the client.
 static void on_server_read_done_locked(void* arg, grpc_error_handle error) {
@@ -371,16 +415,33 @@ static void on_write_response_done_locked(void* arg, grpc_error_handle error) {
   }
   // Clear write buffer.
   grpc_slice_buffer_reset_and_unref(&conn->client_write_buffer);
+  conn->response_written = true;
+  // If the client pipelined bytes behind its CONNECT request, forward
+  // them to the backend now that the tunnel is established.
+  if (conn->client_early_data_buffer.length > 0) {
+    grpc_slice_buffer_move_into(&conn->client_early_data_buffer,
+                                &conn->server_write_buffer);
+    proxy_connection_ref(conn, "early_data_write");
+    conn->server_is_writing = true;
+    GRPC_CLOSURE_INIT(&conn->on_server_write_done, on_server_write_done, conn,
+                      grpc_schedule_on_exec_ctx);
+    grpc_endpoint_write(conn->server_endpoint, &conn->server_write_buffer,
+                        &conn->on_server_write_done, nullptr);
+  }
   // Start reading from both client and server.  One of the read
   // requests inherits our ref to conn, but we need to take a new ref
-  // for the other one.
-  proxy_connection_ref(conn, "client_read");
+  // for the other one.  In early-data-dropping mode the discard loop
+  // already owns the client reads and will switch to forwarding on its
+  // next wakeup, so only the server read is started here.
+  if (!conn->drops_early_data) {
+    proxy_connection_ref(conn, "client_read");
+    GRPC_CLOSURE_INIT(&conn->on_client_read_done, on_client_read_done, conn,
+                      grpc_schedule_on_exec_ctx);
+    grpc_endpoint_read(conn->client_endpoint, &conn->client_read_buffer,
+                       &conn->on_client_read_done, /*urgent=*/false);
+  }
   proxy_connection_ref(conn, "server_read");
   proxy_connection_unref(conn, "write_response");
-  GRPC_CLOSURE_INIT(&conn->on_client_read_done, on_client_read_done, conn,
-                    grpc_schedule_on_exec_ctx);
-  grpc_endpoint_read(conn->client_endpoint, &conn->client_read_buffer,
-                     &conn->on_client_read_done, /*urgent=*/false);
   GRPC_CLOSURE_INIT(&conn->on_server_read_done, on_server_read_done, conn,
                     grpc_schedule_on_exec_ctx);
   grpc_endpoint_read(conn->server_endpoint, &conn->server_read_buffer,
@@ -395,6 +456,30 @@ static void on_write_response_done(void* arg, grpc_error_handle error) {
                              GRPC_ERROR_REF(error));
 }
 
+// Callback to finish writing a non-2xx response for a rejected CONNECT
+// request; the connection is closed once the response is out.
+static void on_write_reject_response_done_locked(void* arg,
+                                                 grpc_error_handle error) {
+  proxy_connection* conn = static_cast<proxy_connection*>(arg);
+  conn->client_is_writing = false;
+  if (error == GRPC_ERROR_NONE) {
+    error = GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+        "HTTP proxy rejected CONNECT request");
+  } else {
+    error = GRPC_ERROR_REF(error);
+  }
+  proxy_connection_failed(conn, SETUP_FAILED, "HTTP proxy reject response",
+                          error);
+}
+
+static void on_write_reject_response_done(void* arg, grpc_error_handle error) {
+  proxy_connection* conn = static_cast<proxy_connection*>(arg);
+  GRPC_CLOSURE_INIT(&conn->on_write_response_done,
+                    on_write_reject_response_done_locked, conn, nullptr);
+  conn->proxy->combiner->Run(&conn->on_write_response_done,
+                             GRPC_ERROR_REF(error));
+}
+
 // Callback to connect to the backend server specified by the HTTP
 // CONNECT request.
 static void on_server_connect_done_locked(void* arg, grpc_error_handle error) {
@@ -468,14 +553,38 @@ static void on_read_request_done_locked(void* arg, grpc_error_handle error) {
   // Read request and feed it to the parser.
   for (size_t i = 0; i < conn->client_read_buffer.count; ++i) {
     if (GRPC_SLICE_LENGTH(conn->client_read_buffer.slices[i]) > 0) {
-      error = grpc_http_parser_parse(
-          &conn->http_parser, conn->client_read_buffer.slices[i], nullptr);
+      size_t body_start_offset = 0;
+      error = grpc_http_parser_parse(&conn->http_parser,
+                                     conn->client_read_buffer.slices[i],
+                                     &body_start_offset);
       if (error != GRPC_ERROR_NONE) {
         proxy_connection_failed(conn, SETUP_FAILED, "HTTP proxy request parse",
                                 GRPC_ERROR_REF(error));
         GRPC_ERROR_UNREF(error);
         return;
       }
+      if (conn->http_parser.state == GRPC_HTTP_BODY) {
+        // Anything beyond the end of the request head is not part of the
+        // CONNECT request: it is data the client pipelined behind it in
+        // the expectation that the tunnel would be established.  Save it
+        // for forwarding once the tunnel is up (or drop it, if that's
+        // what this proxy is configured to do).
+        if (!conn->drops_early_data) {
+          if (body_start_offset <
+              GRPC_SLICE_LENGTH(conn->client_read_buffer.slices[i])) {
+            grpc_slice_buffer_add(
+                &conn->client_early_data_buffer,
+                grpc_slice_split_tail(&conn->client_read_buffer.slices[i],
+                                      body_start_offset));
+          }
+          for (size_t j = i + 1; j < conn->client_read_buffer.count; ++j) {
+            grpc_slice_buffer_add(
+                &conn->client_early_data_buffer,
+                grpc_slice_ref_internal(conn->client_read_buffer.slices[j]));
+          }
+        }
+        break;
+      }
     }
   }
   grpc_slice_buffer_reset_and_unref(&conn->client_read_buffer);
@@ -518,6 +627,37 @@ static void on_read_request_done_locked(void* arg, grpc_error_handle error) {
       return;
     }
   }
+  // If the proxy is configured to reject CONNECT requests, send back the
+  // configured non-2xx status and close the connection without contacting
+  // the backend.
+  const grpc_arg* reject_status_arg = grpc_channel_args_find(
+      conn->proxy->channel_args, GRPC_ARG_HTTP_PROXY_CONNECT_RESPONSE_STATUS);
+  const int reject_status =
+      grpc_channel_arg_get_integer(reject_status_arg, {0, 0, 599});
+  if (reject_status != 0) {
+    // The write callback inherits our reference to conn.
+    std::string response =
+        absl::StrCat("HTTP/1.0 ", reject_status, " rejected\r\n\r\n");
+    grpc_slice_buffer_add(&conn->client_write_buffer,
+                          grpc_slice_from_cpp_string(std::move(response)));
+    conn->client_is_writing = true;
+    GRPC_CLOSURE_INIT(&conn->on_write_response_done,
+                      on_write_reject_response_done, conn,
+                      grpc_schedule_on_exec_ctx);
+    grpc_endpoint_write(conn->client_endpoint, &conn->client_write_buffer,
+                        &conn->on_write_response_done, nullptr);
+    return;
+  }
+  // In early-data-dropping mode, keep reading (and discarding) client data
+  // while the tunnel is being set up; the loop switches to forwarding once
+  // the CONNECT response has been written.
+  if (conn->drops_early_data) {
+    proxy_connection_ref(conn, "discard_early_data");
+    GRPC_CLOSURE_INIT(&conn->on_client_read_done, on_discard_early_data, conn,
+                      grpc_schedule_on_exec_ctx);
+    grpc_endpoint_read(conn->client_endpoint, &conn->client_read_buffer,
+                       &conn->on_client_read_done, /*urgent=*/false);
+  }
   // Resolve address.
   grpc_resolved_addresses* resolved_addresses = nullptr;
   error = grpc_blocking_resolve_address(conn->http_request.path, "80",
@@ -566,6 +706,11 @@ static void on_accept(void* arg, grpc_endpoint* endpoint,
   grpc_pollset_set_add_pollset(conn->pollset_set, proxy->pollset[0]);
   grpc_endpoint_add_to_pollset_set(endpoint, conn->pollset_set);
   grpc_slice_buffer_init(&conn->client_read_buffer);
+  grpc_slice_buffer_init(&conn->client_early_data_buffer);
+  conn->drops_early_data = grpc_channel_arg_get_bool(
+      grpc_channel_args_find(proxy->channel_args,
+                             GRPC_ARG_HTTP_PROXY_DROPS_EARLY_DATA),
+      false);
   grpc_slice_buffer_init(&conn->client_deferred_write_buffer);
   conn->client_is_writing = false;
   grpc_slice_buffer_init(&conn->client_write_buffer);
@@ -30,6 +30,21 @@
  */
 #define GRPC_ARG_HTTP_PROXY_AUTH_CREDS "grpc.test.proxy_auth"
 
+/* A channel arg key used to make the proxy respond to CONNECT requests with
+ * the given HTTP status (integer) instead of 200, and then close the
+ * connection without contacting the backend.
+ */
+#define GRPC_ARG_HTTP_PROXY_CONNECT_RESPONSE_STATUS \
+  "grpc.test.proxy_connect_response_status"
+
+/* A channel arg key (boolean) used to make the proxy discard any bytes the
+ * client sends before the proxy has written its CONNECT response, the way
+ * some real proxies do, instead of forwarding them to the backend once the
+ * tunnel is established.
+ */
+#define GRPC_ARG_HTTP_PROXY_DROPS_EARLY_DATA \
+  "grpc.test.proxy_drops_early_data"
+
 typedef struct grpc_end2end_http_proxy grpc_end2end_http_proxy;
 
 grpc_end2end_http_proxy* grpc_end2end_http_proxy_create(
@@ -240,6 +240,11 @@ END2END_TESTS = {
     "filter_init_fails": _test_options(),
     "filter_context": _test_options(),
     "graceful_server_shutdown": _test_options(exclude_inproc = True),
+    "hedging": _test_options(needs_client_channel = True),
+    "hedging_on_failure": _test_options(needs_client_channel = True),
+    "hedging_server_pushback_delay": _test_options(needs_client_channel = True),
+    "hedging_throttled": _test_options(needs_client_channel = True),
+    "hedging_too_many_attempts": _test_options(needs_client_channel = True),
     "hpack_size": _test_options(
         proxyable = False,
         traceable = False,
@@ -269,6 +274,7 @@ END2END_TESTS = {
     "ping_pong_streaming": _test_options(),
     "ping": _test_options(needs_fullstack = True, proxyable = False),
     "proxy_auth": _test_options(needs_proxy_auth = True),
+    "recv_message_readahead": _test_options(),
     "registered_call": _test_options(),
     "request_with_flags": _test_options(proxyable = False),
     "request_with_payload": _test_options(),
@@ -0,0 +1,262 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Tests the pipelined HTTP CONNECT handshake
+ * (GRPC_ARG_HTTP_CONNECT_PIPELINE) against the test HTTP proxy: the client
+ * sends its first post-tunnel bytes without waiting for the proxy's
+ * CONNECT response, so the proxy sees them as early data. */
+
+#include <string.h>
+
+#include <string>
+
+#include "absl/strings/str_cat.h"
+
+#include <grpc/grpc.h>
+#include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
+
+#include "src/core/ext/filters/client_channel/http_connect_handshaker.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gpr/env.h"
+#include "src/core/lib/gprpp/host_port.h"
+#include "test/core/end2end/cq_verifier.h"
+#include "test/core/end2end/fixtures/http_proxy_fixture.h"
+#include "test/core/util/port.h"
+#include "test/core/util/test_config.h"
+
+static void* tag(intptr_t t) { return reinterpret_cast<void*>(t); }
+
+namespace {
+
+// Bundles the client, proxy, and (optional) backend server used by each
+// test, so that setup and teardown are not repeated three times.
+struct test_state {
+  grpc_end2end_http_proxy* proxy = nullptr;
+  std::string server_addr;
+  grpc_server* server = nullptr;
+  grpc_channel* channel = nullptr;
+  grpc_completion_queue* cq = nullptr;
+  grpc_completion_queue* shutdown_cq = nullptr;
+  cq_verifier* cqv = nullptr;
+};
+
+void setup_test(test_state* state, grpc_channel_args* proxy_args,
+                bool start_backend) {
+  grpc_init();
+  state->proxy = grpc_end2end_http_proxy_create(proxy_args);
+  const int server_port = grpc_pick_unused_port_or_die();
+  state->server_addr = grpc_core::JoinHostPort("localhost", server_port);
+  state->cq = grpc_completion_queue_create_for_next(nullptr);
+  state->shutdown_cq = grpc_completion_queue_create_for_pluck(nullptr);
+  state->cqv = cq_verifier_create(state->cq);
+  if (start_backend) {
+    state->server = grpc_server_create(nullptr, nullptr);
+    grpc_server_register_completion_queue(state->server, state->cq, nullptr);
+    GPR_ASSERT(grpc_server_add_insecure_http2_port(
+        state->server, state->server_addr.c_str()));
+    grpc_server_start(state->server);
+  }
+  // Point the client at the proxy and enable handshake pipelining.
+  std::string proxy_uri = absl::StrCat(
+      "http://", grpc_end2end_http_proxy_get_proxy_name(state->proxy));
+  gpr_setenv("http_proxy", proxy_uri.c_str());
+  grpc_arg client_arg = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_ARG_HTTP_CONNECT_PIPELINE), 1);
+  grpc_channel_args client_args = {1, &client_arg};
+  state->channel = grpc_insecure_channel_create(state->server_addr.c_str(),
+                                                &client_args, nullptr);
+  GPR_ASSERT(state->channel != nullptr);
+}
+
+void teardown_test(test_state* state) {
+  if (state->server != nullptr) {
+    grpc_server_shutdown_and_notify(state->server, state->shutdown_cq,
+                                    tag(1000));
+    GPR_ASSERT(grpc_completion_queue_pluck(
+                   state->shutdown_cq, tag(1000),
+                   grpc_timeout_seconds_to_deadline(5), nullptr)
+                   .type == GRPC_OP_COMPLETE);
+    grpc_server_destroy(state->server);
+  }
+  grpc_channel_destroy(state->channel);
+  grpc_completion_queue_shutdown(state->cq);
+  grpc_event ev;
+  do {
+    ev = grpc_completion_queue_next(
+        state->cq, grpc_timeout_seconds_to_deadline(5), nullptr);
+  } while (ev.type != GRPC_QUEUE_SHUTDOWN);
+  grpc_completion_queue_destroy(state->cq);
+  grpc_completion_queue_destroy(state->shutdown_cq);
+  cq_verifier_destroy(state->cqv);
+  grpc_end2end_http_proxy_destroy(state->proxy);
+  grpc_shutdown();
+}
+
+// Issues a unary call with the given deadline and returns its final status.
+grpc_status_code send_rpc(test_state* state, int deadline_seconds,
+                          bool expect_server_call) {
+  grpc_call* c;
+  grpc_call* s = nullptr;
+  grpc_op ops[6];
+  grpc_op* op;
+  grpc_metadata_array initial_metadata_recv;
+  grpc_metadata_array trailing_metadata_recv;
+  grpc_metadata_array request_metadata_recv;
+  grpc_call_details call_details;
+  grpc_status_code status;
+  grpc_slice details;
+  int was_cancelled = 2;
+
+  grpc_metadata_array_init(&initial_metadata_recv);
+  grpc_metadata_array_init(&trailing_metadata_recv);
+  grpc_metadata_array_init(&request_metadata_recv);
+  grpc_call_details_init(&call_details);
+
+  gpr_timespec deadline = grpc_timeout_seconds_to_deadline(deadline_seconds);
+  c = grpc_channel_create_call(state->channel, nullptr, GRPC_PROPAGATE_DEFAULTS,
+                               state->cq, grpc_slice_from_static_string("/foo"),
+                               nullptr, deadline, nullptr);
+  GPR_ASSERT(c);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  op->data.recv_status_on_client.trailing_metadata = &trailing_metadata_recv;
+  op->data.recv_status_on_client.status = &status;
+  op->data.recv_status_on_client.status_details = &details;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  GPR_ASSERT(GRPC_CALL_OK == grpc_call_start_batch(c, ops,
+                                                   static_cast<size_t>(op - ops),
+                                                   tag(1), nullptr));
+
+  if (expect_server_call) {
+    GPR_ASSERT(GRPC_CALL_OK ==
+               grpc_server_request_call(state->server, &s, &call_details,
+                                        &request_metadata_recv, state->cq,
+                                        state->cq, tag(101)));
+    CQ_EXPECT_COMPLETION(state->cqv, tag(101), 1);
+    cq_verify(state->cqv);
+
+    memset(ops, 0, sizeof(ops));
+    op = ops;
+    op->op = GRPC_OP_SEND_INITIAL_METADATA;
+    op->data.send_initial_metadata.count = 0;
+    op->flags = 0;
+    op->reserved = nullptr;
+    op++;
+    op->op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+    op->data.send_status_from_server.trailing_metadata_count = 0;
+    op->data.send_status_from_server.status = GRPC_STATUS_UNIMPLEMENTED;
+    grpc_slice status_details = grpc_slice_from_static_string("xyz");
+    op->data.send_status_from_server.status_details = &status_details;
+    op->flags = 0;
+    op->reserved = nullptr;
+    op++;
+    op->op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+    op->data.recv_close_on_server.cancelled = &was_cancelled;
+    op->flags = 0;
+    op->reserved = nullptr;
+    op++;
+    GPR_ASSERT(GRPC_CALL_OK ==
+               grpc_call_start_batch(s, ops, static_cast<size_t>(op - ops),
+                                     tag(102), nullptr));
+    CQ_EXPECT_COMPLETION(state->cqv, tag(102), 1);
+  }
+  CQ_EXPECT_COMPLETION(state->cqv, tag(1), 1);
+  cq_verify(state->cqv, 15);
+
+  if (expect_server_call) {
+    GPR_ASSERT(0 == grpc_slice_str_cmp(call_details.method, "/foo"));
+    GPR_ASSERT(was_cancelled == 0);
+    grpc_call_unref(s);
+  }
+
+  grpc_slice_unref(details);
+  grpc_metadata_array_destroy(&initial_metadata_recv);
+  grpc_metadata_array_destroy(&trailing_metadata_recv);
+  grpc_metadata_array_destroy(&request_metadata_recv);
+  grpc_call_details_destroy(&call_details);
+  grpc_call_unref(c);
+  return status;
+}
+
+// A call through a proxy that accepts the CONNECT request succeeds: the
+// proxy must deliver the early data (the client's HTTP/2 preface, sent
+// before the proxy responded) to the backend once the tunnel is up.
+void test_pipelined_connect_success() {
+  gpr_log(GPR_INFO, "TEST: pipelined CONNECT success");
+  test_state state;
+  setup_test(&state, nullptr, /*start_backend=*/true);
+  GPR_ASSERT(send_rpc(&state, 5, /*expect_server_call=*/true) ==
+             GRPC_STATUS_UNIMPLEMENTED);
+  teardown_test(&state);
+}
+
+// A non-2xx CONNECT response must abort the speculative handshake even
+// though the client has already sent early data, and fail the call.
+void test_pipelined_connect_rejected() {
+  gpr_log(GPR_INFO, "TEST: pipelined CONNECT rejected");
+  grpc_arg proxy_arg = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_ARG_HTTP_PROXY_CONNECT_RESPONSE_STATUS), 407);
+  grpc_channel_args proxy_args = {1, &proxy_arg};
+  test_state state;
+  setup_test(&state, &proxy_args, /*start_backend=*/false);
+  GPR_ASSERT(send_rpc(&state, 5, /*expect_server_call=*/false) ==
+             GRPC_STATUS_UNAVAILABLE);
+  teardown_test(&state);
+}
+
+// A proxy that drops early data swallows the client's HTTP/2 preface, so
+// the connection never becomes usable and the call fails.  This is why
+// pipelining is off by default.
+void test_pipelined_connect_early_data_dropped() {
+  gpr_log(GPR_INFO, "TEST: pipelined CONNECT with early data dropped");
+  grpc_arg proxy_arg = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_ARG_HTTP_PROXY_DROPS_EARLY_DATA), 1);
+  grpc_channel_args proxy_args = {1, &proxy_arg};
+  test_state state;
+  setup_test(&state, &proxy_args, /*start_backend=*/true);
+  // Depending on how quickly the backend tears down the broken connection,
+  // the call fails either with UNAVAILABLE or at its deadline.
+  grpc_status_code status = send_rpc(&state, 3, /*expect_server_call=*/false);
+  GPR_ASSERT(status == GRPC_STATUS_UNAVAILABLE ||
+             status == GRPC_STATUS_DEADLINE_EXCEEDED);
+  teardown_test(&state);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  test_pipelined_connect_success();
+  test_pipelined_connect_rejected();
+  test_pipelined_connect_early_data_dropped();
+  return 0;
+}
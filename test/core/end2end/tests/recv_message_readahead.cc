@@ -0,0 +1,535 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Tests GRPC_ARG_EXPERIMENTAL_RECV_MESSAGE_READAHEAD: once the application
+ * has issued its first read on a call, the receiving side keeps pulling
+ * messages from the transport and buffers them so that later reads complete
+ * without a transport round trip. */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <grpc/byte_buffer.h>
+#include <grpc/compression.h>
+#include <grpc/grpc.h>
+#include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/compression/compression_args.h"
+#include "test/core/end2end/cq_verifier.h"
+#include "test/core/end2end/end2end_tests.h"
+
+static void* tag(intptr_t t) { return reinterpret_cast<void*>(t); }
+
+static grpc_end2end_test_fixture begin_test(grpc_end2end_test_config config,
+                                            const char* test_name,
+                                            grpc_channel_args* client_args,
+                                            grpc_channel_args* server_args) {
+  grpc_end2end_test_fixture f;
+  gpr_log(GPR_INFO, "Running test: %s/%s", test_name, config.name);
+  f = config.create_fixture(client_args, server_args);
+  config.init_server(&f, server_args);
+  config.init_client(&f, client_args);
+  return f;
+}
+
+static gpr_timespec n_seconds_from_now(int n) {
+  return grpc_timeout_seconds_to_deadline(n);
+}
+
+static gpr_timespec five_seconds_from_now(void) {
+  return n_seconds_from_now(5);
+}
+
+static void drain_cq(grpc_completion_queue* cq) {
+  grpc_event ev;
+  do {
+    ev = grpc_completion_queue_next(cq, five_seconds_from_now(), nullptr);
+  } while (ev.type != GRPC_QUEUE_SHUTDOWN);
+}
+
+static void shutdown_server(grpc_end2end_test_fixture* f) {
+  if (!f->server) return;
+  grpc_server_shutdown_and_notify(f->server, f->shutdown_cq, tag(1000));
+  GPR_ASSERT(grpc_completion_queue_pluck(f->shutdown_cq, tag(1000),
+                                         grpc_timeout_seconds_to_deadline(5),
+                                         nullptr)
+                 .type == GRPC_OP_COMPLETE);
+  grpc_server_destroy(f->server);
+  f->server = nullptr;
+}
+
+static void shutdown_client(grpc_end2end_test_fixture* f) {
+  if (!f->client) return;
+  grpc_channel_destroy(f->client);
+  f->client = nullptr;
+}
+
+static void end_test(grpc_end2end_test_fixture* f) {
+  shutdown_server(f);
+  shutdown_client(f);
+
+  grpc_completion_queue_shutdown(f->cq);
+  drain_cq(f->cq);
+  grpc_completion_queue_destroy(f->cq);
+  grpc_completion_queue_destroy(f->shutdown_cq);
+}
+
+// Builds client channel args enabling readahead of up to `readahead`
+// messages, plus an optional receive size limit.
+static grpc_channel_args* make_client_args(int readahead,
+                                           int max_receive_size) {
+  grpc_arg args[2];
+  size_t num_args = 0;
+  args[num_args++] = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_ARG_EXPERIMENTAL_RECV_MESSAGE_READAHEAD),
+      readahead);
+  if (max_receive_size >= 0) {
+    args[num_args++] = grpc_channel_arg_integer_create(
+        const_cast<char*>(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH),
+        max_receive_size);
+  }
+  grpc_channel_args tmp = {num_args, args};
+  return grpc_channel_args_copy(&tmp);
+}
+
+// Starts a server-streaming call: the client sends initial metadata and
+// half-closes, the server accepts and sends its initial metadata.  On
+// return tag(1) (client) and tag(101) (server) have completed.
+static void start_streaming_call(grpc_end2end_test_fixture* f,
+                                 cq_verifier* cqv, grpc_call** c,
+                                 grpc_call** s,
+                                 grpc_metadata_array* initial_metadata_recv,
+                                 grpc_metadata_array* request_metadata_recv,
+                                 grpc_call_details* call_details) {
+  grpc_op ops[6];
+  grpc_op* op;
+  gpr_timespec deadline = five_seconds_from_now();
+
+  *c = grpc_channel_create_call(f->client, nullptr, GRPC_PROPAGATE_DEFAULTS,
+                                f->cq, grpc_slice_from_static_string("/foo"),
+                                nullptr, deadline, nullptr);
+  GPR_ASSERT(*c);
+
+  grpc_metadata_array_init(initial_metadata_recv);
+  grpc_metadata_array_init(request_metadata_recv);
+  grpc_call_details_init(call_details);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_INITIAL_METADATA;
+  op->data.recv_initial_metadata.recv_initial_metadata = initial_metadata_recv;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  GPR_ASSERT(GRPC_CALL_OK == grpc_call_start_batch(*c, ops,
+                                                   static_cast<size_t>(op -
+                                                                       ops),
+                                                   tag(1), nullptr));
+
+  GPR_ASSERT(GRPC_CALL_OK ==
+             grpc_server_request_call(f->server, s, call_details,
+                                      request_metadata_recv, f->cq, f->cq,
+                                      tag(100)));
+  CQ_EXPECT_COMPLETION(cqv, tag(100), true);
+  cq_verify(cqv);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  GPR_ASSERT(GRPC_CALL_OK == grpc_call_start_batch(*s, ops,
+                                                   static_cast<size_t>(op -
+                                                                       ops),
+                                                   tag(101), nullptr));
+  CQ_EXPECT_COMPLETION(cqv, tag(101), true);
+  CQ_EXPECT_COMPLETION(cqv, tag(1), true);
+  cq_verify(cqv);
+}
+
+// Sends one message from the server, waiting for the write to complete.
+static void server_send_message(grpc_call* s, cq_verifier* cqv,
+                                grpc_byte_buffer* payload) {
+  grpc_op ops[6];
+  grpc_op* op;
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_MESSAGE;
+  op->data.send_message.send_message = payload;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  GPR_ASSERT(GRPC_CALL_OK == grpc_call_start_batch(s, ops,
+                                                   static_cast<size_t>(op -
+                                                                       ops),
+                                                   tag(103), nullptr));
+  CQ_EXPECT_COMPLETION(cqv, tag(103), true);
+  cq_verify(cqv);
+}
+
+// Receives one message on the client, returning the (possibly null) byte
+// buffer.  With readahead enabled, all reads after the first should be
+// satisfied from the internal buffer.
+static grpc_byte_buffer* client_recv_message(grpc_call* c, cq_verifier* cqv) {
+  grpc_byte_buffer* response_payload_recv = nullptr;
+  grpc_op ops[6];
+  grpc_op* op;
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_RECV_MESSAGE;
+  op->data.recv_message.recv_message = &response_payload_recv;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  GPR_ASSERT(GRPC_CALL_OK == grpc_call_start_batch(c, ops,
+                                                   static_cast<size_t>(op -
+                                                                       ops),
+                                                   tag(2), nullptr));
+  CQ_EXPECT_COMPLETION(cqv, tag(2), true);
+  cq_verify(cqv);
+  return response_payload_recv;
+}
+
+// Streams several messages from the server to a client whose channel buffers
+// up to four messages ahead of the application, and verifies that every
+// message arrives intact and in order, followed by a clean end-of-stream and
+// the server's status.  With use_compression set, the server compresses the
+// messages, checking that readahead buffers the decompressed payloads.
+static void test_readahead_streaming(grpc_end2end_test_config config,
+                                     bool use_compression) {
+  const int kNumMessages = 6;
+  grpc_call* c;
+  grpc_call* s;
+  grpc_channel_args* client_args = make_client_args(4, -1);
+  grpc_channel_args* server_args = nullptr;
+  if (use_compression) {
+    server_args = grpc_channel_args_set_channel_default_compression_algorithm(
+        nullptr, GRPC_COMPRESS_GZIP);
+  }
+  grpc_end2end_test_fixture f =
+      begin_test(config,
+                 use_compression ? "test_readahead_streaming_compressed"
+                                 : "test_readahead_streaming",
+                 client_args, server_args);
+  cq_verifier* cqv = cq_verifier_create(f.cq);
+  grpc_op ops[6];
+  grpc_op* op;
+  grpc_metadata_array initial_metadata_recv;
+  grpc_metadata_array trailing_metadata_recv;
+  grpc_metadata_array request_metadata_recv;
+  grpc_call_details call_details;
+  grpc_status_code status;
+  grpc_slice details;
+  int was_cancelled = 2;
+
+  grpc_metadata_array_init(&trailing_metadata_recv);
+  start_streaming_call(&f, cqv, &c, &s, &initial_metadata_recv,
+                       &request_metadata_recv, &call_details);
+
+  // The server writes the whole response stream up front, so that by the
+  // time the client reads, everything is available for readahead to pull.
+  for (int i = 0; i < kNumMessages; i++) {
+    char text[32];
+    snprintf(text, sizeof(text), "message %d", i);
+    grpc_slice slice = grpc_slice_from_copied_string(text);
+    grpc_byte_buffer* payload = grpc_raw_byte_buffer_create(&slice, 1);
+    grpc_slice_unref(slice);
+    server_send_message(s, cqv, payload);
+    grpc_byte_buffer_destroy(payload);
+  }
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+  op->data.send_status_from_server.trailing_metadata_count = 0;
+  op->data.send_status_from_server.status = GRPC_STATUS_OK;
+  grpc_slice status_details = grpc_slice_from_static_string("xyz");
+  op->data.send_status_from_server.status_details = &status_details;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+  op->data.recv_close_on_server.cancelled = &was_cancelled;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  GPR_ASSERT(GRPC_CALL_OK == grpc_call_start_batch(s, ops,
+                                                   static_cast<size_t>(op -
+                                                                       ops),
+                                                   tag(104), nullptr));
+
+  // Read the stream back one message at a time; the first read arms the
+  // readahead machinery and the rest drain its buffer.
+  for (int i = 0; i < kNumMessages; i++) {
+    char text[32];
+    snprintf(text, sizeof(text), "message %d", i);
+    grpc_byte_buffer* response_payload_recv = client_recv_message(c, cqv);
+    GPR_ASSERT(response_payload_recv != nullptr);
+    GPR_ASSERT(byte_buffer_eq_string(response_payload_recv, text));
+    grpc_byte_buffer_destroy(response_payload_recv);
+  }
+  // One read past the end of the stream yields a null message.
+  GPR_ASSERT(client_recv_message(c, cqv) == nullptr);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  op->data.recv_status_on_client.trailing_metadata = &trailing_metadata_recv;
+  op->data.recv_status_on_client.status = &status;
+  op->data.recv_status_on_client.status_details = &details;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  GPR_ASSERT(GRPC_CALL_OK == grpc_call_start_batch(c, ops,
+                                                   static_cast<size_t>(op -
+                                                                       ops),
+                                                   tag(3), nullptr));
+  CQ_EXPECT_COMPLETION(cqv, tag(3), true);
+  CQ_EXPECT_COMPLETION(cqv, tag(104), true);
+  cq_verify(cqv);
+
+  GPR_ASSERT(status == GRPC_STATUS_OK);
+  GPR_ASSERT(0 == grpc_slice_str_cmp(details, "xyz"));
+  GPR_ASSERT(was_cancelled == 0);
+
+  grpc_slice_unref(details);
+  grpc_metadata_array_destroy(&initial_metadata_recv);
+  grpc_metadata_array_destroy(&trailing_metadata_recv);
+  grpc_metadata_array_destroy(&request_metadata_recv);
+  grpc_call_details_destroy(&call_details);
+  grpc_call_unref(c);
+  grpc_call_unref(s);
+  cq_verifier_destroy(cqv);
+  end_test(&f);
+  config.tear_down_data(&f);
+  grpc_channel_args_destroy(client_args);
+  grpc_channel_args_destroy(server_args);
+}
+
+// Cancels a call while the readahead buffer still holds undelivered
+// messages: the buffered messages must be released when the call is
+// destroyed (this test is primarily interesting under asan/msan).
+static void test_readahead_cancel_with_buffered_messages(
+    grpc_end2end_test_config config) {
+  const int kNumMessages = 5;
+  grpc_call* c;
+  grpc_call* s;
+  grpc_channel_args* client_args = make_client_args(4, -1);
+  grpc_end2end_test_fixture f = begin_test(
+      config, "test_readahead_cancel_with_buffered_messages", client_args,
+      nullptr);
+  cq_verifier* cqv = cq_verifier_create(f.cq);
+  grpc_op ops[6];
+  grpc_op* op;
+  grpc_metadata_array initial_metadata_recv;
+  grpc_metadata_array trailing_metadata_recv;
+  grpc_metadata_array request_metadata_recv;
+  grpc_call_details call_details;
+  grpc_status_code status;
+  grpc_slice details;
+  int was_cancelled = 2;
+
+  grpc_metadata_array_init(&trailing_metadata_recv);
+  start_streaming_call(&f, cqv, &c, &s, &initial_metadata_recv,
+                       &request_metadata_recv, &call_details);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+  op->data.recv_close_on_server.cancelled = &was_cancelled;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  GPR_ASSERT(GRPC_CALL_OK == grpc_call_start_batch(s, ops,
+                                                   static_cast<size_t>(op -
+                                                                       ops),
+                                                   tag(102), nullptr));
+
+  for (int i = 0; i < kNumMessages; i++) {
+    grpc_slice slice = grpc_slice_from_copied_string("hello world");
+    grpc_byte_buffer* payload = grpc_raw_byte_buffer_create(&slice, 1);
+    grpc_slice_unref(slice);
+    server_send_message(s, cqv, payload);
+    grpc_byte_buffer_destroy(payload);
+  }
+
+  // Read a single message to start the readahead pulls, then give them a
+  // moment to buffer the rest of the stream before cancelling.
+  grpc_byte_buffer* response_payload_recv = client_recv_message(c, cqv);
+  GPR_ASSERT(response_payload_recv != nullptr);
+  grpc_byte_buffer_destroy(response_payload_recv);
+  cq_verify_empty_timeout(cqv, 1);
+
+  GPR_ASSERT(GRPC_CALL_OK == grpc_call_cancel(c, nullptr));
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  op->data.recv_status_on_client.trailing_metadata = &trailing_metadata_recv;
+  op->data.recv_status_on_client.status = &status;
+  op->data.recv_status_on_client.status_details = &details;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  GPR_ASSERT(GRPC_CALL_OK == grpc_call_start_batch(c, ops,
+                                                   static_cast<size_t>(op -
+                                                                       ops),
+                                                   tag(3), nullptr));
+  CQ_EXPECT_COMPLETION(cqv, tag(3), true);
+  CQ_EXPECT_COMPLETION(cqv, tag(102), true);
+  cq_verify(cqv);
+
+  GPR_ASSERT(status == GRPC_STATUS_CANCELLED);
+  GPR_ASSERT(was_cancelled == 1);
+
+  grpc_slice_unref(details);
+  grpc_metadata_array_destroy(&initial_metadata_recv);
+  grpc_metadata_array_destroy(&trailing_metadata_recv);
+  grpc_metadata_array_destroy(&request_metadata_recv);
+  grpc_call_details_destroy(&call_details);
+  grpc_call_unref(c);
+  grpc_call_unref(s);
+  cq_verifier_destroy(cqv);
+  end_test(&f);
+  config.tear_down_data(&f);
+  grpc_channel_args_destroy(client_args);
+}
+
+// Verifies that the max receive message size is enforced on messages pulled
+// by readahead, not just on application-requested reads: an oversized
+// message buffered internally must fail the call with RESOURCE_EXHAUSTED
+// and surface a null message to the waiting read.
+static void test_readahead_max_receive_size(grpc_end2end_test_config config) {
+  const int kMaxReceiveSize = 1024;
+  const size_t kLargeSize = 16384;
+  grpc_call* c;
+  grpc_call* s;
+  grpc_channel_args* client_args = make_client_args(4, kMaxReceiveSize);
+  grpc_end2end_test_fixture f = begin_test(
+      config, "test_readahead_max_receive_size", client_args, nullptr);
+  cq_verifier* cqv = cq_verifier_create(f.cq);
+  grpc_op ops[6];
+  grpc_op* op;
+  grpc_metadata_array initial_metadata_recv;
+  grpc_metadata_array trailing_metadata_recv;
+  grpc_metadata_array request_metadata_recv;
+  grpc_call_details call_details;
+  grpc_status_code status;
+  grpc_slice details;
+  int was_cancelled = 2;
+
+  grpc_metadata_array_init(&trailing_metadata_recv);
+  start_streaming_call(&f, cqv, &c, &s, &initial_metadata_recv,
+                       &request_metadata_recv, &call_details);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+  op->data.recv_close_on_server.cancelled = &was_cancelled;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  GPR_ASSERT(GRPC_CALL_OK == grpc_call_start_batch(s, ops,
+                                                   static_cast<size_t>(op -
+                                                                       ops),
+                                                   tag(102), nullptr));
+
+  // An acceptable message followed by one over the limit.
+  {
+    grpc_slice slice = grpc_slice_from_copied_string("hello");
+    grpc_byte_buffer* payload = grpc_raw_byte_buffer_create(&slice, 1);
+    grpc_slice_unref(slice);
+    server_send_message(s, cqv, payload);
+    grpc_byte_buffer_destroy(payload);
+  }
+  {
+    grpc_slice slice = grpc_slice_malloc(kLargeSize);
+    memset(GRPC_SLICE_START_PTR(slice), 'a', GRPC_SLICE_LENGTH(slice));
+    grpc_byte_buffer* payload = grpc_raw_byte_buffer_create(&slice, 1);
+    grpc_slice_unref(slice);
+    server_send_message(s, cqv, payload);
+    grpc_byte_buffer_destroy(payload);
+  }
+
+  // The first read succeeds; the readahead pull behind it hits the
+  // oversized message, which cancels the call, so the second read yields a
+  // null message.
+  grpc_byte_buffer* response_payload_recv = client_recv_message(c, cqv);
+  GPR_ASSERT(response_payload_recv != nullptr);
+  GPR_ASSERT(byte_buffer_eq_string(response_payload_recv, "hello"));
+  grpc_byte_buffer_destroy(response_payload_recv);
+  GPR_ASSERT(client_recv_message(c, cqv) == nullptr);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  op->data.recv_status_on_client.trailing_metadata = &trailing_metadata_recv;
+  op->data.recv_status_on_client.status = &status;
+  op->data.recv_status_on_client.status_details = &details;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  GPR_ASSERT(GRPC_CALL_OK == grpc_call_start_batch(c, ops,
+                                                   static_cast<size_t>(op -
+                                                                       ops),
+                                                   tag(3), nullptr));
+  CQ_EXPECT_COMPLETION(cqv, tag(3), true);
+  CQ_EXPECT_COMPLETION(cqv, tag(102), true);
+  cq_verify(cqv);
+
+  GPR_ASSERT(status == GRPC_STATUS_RESOURCE_EXHAUSTED);
+  GPR_ASSERT(0 == grpc_slice_str_cmp(
+                      details, "Received message larger than max (16384 vs. "
+                               "1024)"));
+  GPR_ASSERT(was_cancelled == 1);
+
+  grpc_slice_unref(details);
+  grpc_metadata_array_destroy(&initial_metadata_recv);
+  grpc_metadata_array_destroy(&trailing_metadata_recv);
+  grpc_metadata_array_destroy(&request_metadata_recv);
+  grpc_call_details_destroy(&call_details);
+  grpc_call_unref(c);
+  grpc_call_unref(s);
+  cq_verifier_destroy(cqv);
+  end_test(&f);
+  config.tear_down_data(&f);
+  grpc_channel_args_destroy(client_args);
+}
+
+void recv_message_readahead(grpc_end2end_test_config config) {
+  test_readahead_streaming(config, /*use_compression=*/false);
+  test_readahead_streaming(config, /*use_compression=*/true);
+  test_readahead_cancel_with_buffered_messages(config);
+  test_readahead_max_receive_size(config);
+}
+
+void recv_message_readahead_pre_init(void) {}
@@ -0,0 +1,102 @@
+// Copyright 2021 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/gprpp/flat_map.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace grpc_core {
+namespace testing {
+
+TEST(FlatMap, Empty) {
+  FlatMap<int, int> m;
+  EXPECT_TRUE(m.Empty());
+  EXPECT_EQ(m.Size(), 0u);
+  EXPECT_EQ(m.Lookup(42), nullptr);
+  EXPECT_EQ(m.begin(), m.end());
+}
+
+TEST(FlatMap, AddAndLookup) {
+  FlatMap<std::string, int> m;
+  m = m.Add("b", 2);
+  m = m.Add("a", 1);
+  m = m.Add("c", 3);
+  EXPECT_EQ(m.Size(), 3u);
+  ASSERT_NE(m.Lookup("a"), nullptr);
+  EXPECT_EQ(*m.Lookup("a"), 1);
+  ASSERT_NE(m.Lookup("b"), nullptr);
+  EXPECT_EQ(*m.Lookup("b"), 2);
+  ASSERT_NE(m.Lookup("c"), nullptr);
+  EXPECT_EQ(*m.Lookup("c"), 3);
+  EXPECT_EQ(m.Lookup("d"), nullptr);
+}
+
+TEST(FlatMap, AddReplaces) {
+  FlatMap<std::string, int> m;
+  m = m.Add("a", 1);
+  m = m.Add("a", 2);
+  EXPECT_EQ(m.Size(), 1u);
+  ASSERT_NE(m.Lookup("a"), nullptr);
+  EXPECT_EQ(*m.Lookup("a"), 2);
+}
+
+TEST(FlatMap, Remove) {
+  FlatMap<std::string, int> m;
+  m = m.Add("a", 1);
+  m = m.Add("b", 2);
+  m = m.Remove("a");
+  EXPECT_EQ(m.Size(), 1u);
+  EXPECT_EQ(m.Lookup("a"), nullptr);
+  ASSERT_NE(m.Lookup("b"), nullptr);
+  EXPECT_EQ(*m.Lookup("b"), 2);
+  // Removing an absent key leaves the map untouched.
+  m = m.Remove("nope");
+  EXPECT_EQ(m.Size(), 1u);
+}
+
+TEST(FlatMap, MutationsDoNotAffectSnapshots) {
+  FlatMap<int, int> m;
+  m = m.Add(1, 10);
+  FlatMap<int, int> snapshot = m;
+  m = m.Add(2, 20);
+  m = m.Remove(1);
+  EXPECT_EQ(snapshot.Size(), 1u);
+  ASSERT_NE(snapshot.Lookup(1), nullptr);
+  EXPECT_EQ(*snapshot.Lookup(1), 10);
+  EXPECT_EQ(snapshot.Lookup(2), nullptr);
+}
+
+TEST(FlatMap, IterationIsSorted) {
+  FlatMap<int, int> m;
+  m = m.Add(3, 30);
+  m = m.Add(1, 10);
+  m = m.Add(2, 20);
+  int expected_key = 1;
+  for (const auto& entry : m) {
+    EXPECT_EQ(entry.first, expected_key);
+    EXPECT_EQ(entry.second, expected_key * 10);
+    ++expected_key;
+  }
+  EXPECT_EQ(expected_key, 4);
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
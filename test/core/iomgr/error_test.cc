@@ -216,6 +216,39 @@ static void test_overflow() {
 #endif
 }
 
+static void test_inline_status() {
+  // absl::Status stores code-only statuses without allocation natively
+#ifndef GRPC_ERROR_IS_ABSEIL_STATUS
+  grpc_error_handle error =
+      grpc_error_from_inline_status(GRPC_STATUS_UNAVAILABLE);
+  GPR_ASSERT(error != GRPC_ERROR_NONE);
+  GPR_ASSERT(grpc_error_is_special(error));
+  GPR_ASSERT(grpc_error_is_inline_status(error));
+  // OK and CANCELLED canonicalize to the existing special values.
+  GPR_ASSERT(grpc_error_from_inline_status(GRPC_STATUS_OK) == GRPC_ERROR_NONE);
+  GPR_ASSERT(grpc_error_from_inline_status(GRPC_STATUS_CANCELLED) ==
+             GRPC_ERROR_CANCELLED);
+
+  intptr_t i = 0;
+  GPR_ASSERT(grpc_error_get_int(error, GRPC_ERROR_INT_GRPC_STATUS, &i));
+  GPR_ASSERT(i == GRPC_STATUS_UNAVAILABLE);
+  grpc_slice str;
+  GPR_ASSERT(grpc_error_get_str(error, GRPC_ERROR_STR_GRPC_MESSAGE, &str));
+  GPR_ASSERT(!strncmp((char*)GRPC_SLICE_START_PTR(str), "UNAVAILABLE",
+                      GRPC_SLICE_LENGTH(str)));
+
+  // Attaching an attribute expands into a full heap-allocated error that
+  // keeps the status code.
+  error = grpc_error_set_int(error, GRPC_ERROR_INT_HTTP2_ERROR, 5);
+  GPR_ASSERT(!grpc_error_is_special(error));
+  GPR_ASSERT(grpc_error_get_int(error, GRPC_ERROR_INT_GRPC_STATUS, &i));
+  GPR_ASSERT(i == GRPC_STATUS_UNAVAILABLE);
+  GPR_ASSERT(grpc_error_get_int(error, GRPC_ERROR_INT_HTTP2_ERROR, &i));
+  GPR_ASSERT(i == 5);
+  GRPC_ERROR_UNREF(error);
+#endif
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
@@ -228,6 +261,7 @@ int main(int argc, char** argv) {
   test_create_referencing();
   test_create_referencing_many();
   test_overflow();
+  test_inline_status();
   grpc_shutdown();
 
   return 0;
@@ -152,6 +152,64 @@ static void test_load_big_file(void) {
   gpr_free(buffer);
 }
 
+static void test_load_mmap_file(void) {
+  FILE* tmp = nullptr;
+  grpc_slice slice;
+  grpc_slice slice_copy;
+  grpc_error_handle error;
+  char* tmp_name;
+  static const size_t buffer_size = 124631;
+  unsigned char* buffer = static_cast<unsigned char*>(gpr_malloc(buffer_size));
+  unsigned char* current;
+  size_t i;
+
+  LOG_TEST_NAME("test_load_mmap_file");
+
+  memset(buffer, 42, buffer_size);
+
+  tmp = gpr_tmpfile(prefix, &tmp_name);
+  GPR_ASSERT(tmp != nullptr);
+  GPR_ASSERT(tmp_name != nullptr);
+  GPR_ASSERT(fwrite(buffer, 1, buffer_size, tmp) == buffer_size);
+  fclose(tmp);
+
+  error = grpc_load_file_mmap(tmp_name, &slice);
+  GPR_ASSERT(error == GRPC_ERROR_NONE);
+  GPR_ASSERT(GRPC_SLICE_LENGTH(slice) == buffer_size);
+  current = GRPC_SLICE_START_PTR(slice);
+  for (i = 0; i < buffer_size; i++) {
+    GPR_ASSERT(current[i] == 42);
+  }
+  /* the mapping must survive additional refs being taken and dropped */
+  slice_copy = grpc_slice_ref(slice);
+  grpc_slice_unref(slice);
+  GPR_ASSERT(GRPC_SLICE_START_PTR(slice_copy)[0] == 42);
+  grpc_slice_unref(slice_copy);
+
+  /* empty files take the fallback path */
+  remove(tmp_name);
+  gpr_free(tmp_name);
+  tmp = gpr_tmpfile(prefix, &tmp_name);
+  GPR_ASSERT(tmp != nullptr);
+  GPR_ASSERT(tmp_name != nullptr);
+  fclose(tmp);
+  error = grpc_load_file_mmap(tmp_name, &slice);
+  GPR_ASSERT(error == GRPC_ERROR_NONE);
+  GPR_ASSERT(GRPC_SLICE_LENGTH(slice) == 0);
+  grpc_slice_unref(slice);
+
+  /* missing files report an error */
+  remove(tmp_name);
+  error = grpc_load_file_mmap(tmp_name, &slice);
+  GPR_ASSERT(error != GRPC_ERROR_NONE);
+  GRPC_ERROR_UNREF(error);
+  GPR_ASSERT(GRPC_SLICE_LENGTH(slice) == 0);
+  grpc_slice_unref(slice);
+
+  gpr_free(tmp_name);
+  gpr_free(buffer);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
@@ -159,6 +217,7 @@ int main(int argc, char** argv) {
   test_load_failure();
   test_load_small_file();
   test_load_big_file();
+  test_load_mmap_file();
   grpc_shutdown();
   return 0;
 }
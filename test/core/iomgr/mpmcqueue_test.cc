@@ -38,7 +38,7 @@ struct WorkItem {
 // produced items on destructing.
 class ProducerThread {
  public:
-  ProducerThread(grpc_core::InfLenFIFOQueue* queue, int start_index,
+  ProducerThread(grpc_core::MPMCQueueInterface* queue, int start_index,
                  int num_items)
       : start_index_(start_index), num_items_(num_items), queue_(queue) {
     items_ = nullptr;
@@ -69,7 +69,7 @@ class ProducerThread {
 
   int start_index_;
   int num_items_;
-  grpc_core::InfLenFIFOQueue* queue_;
+  grpc_core::MPMCQueueInterface* queue_;
   grpc_core::Thread thd_;
   WorkItem** items_;
 };
@@ -77,7 +77,8 @@ class ProducerThread {
 // Thread to pull out items from queue
 class ConsumerThread {
  public:
-  explicit ConsumerThread(grpc_core::InfLenFIFOQueue* queue) : queue_(queue) {
+  explicit ConsumerThread(grpc_core::MPMCQueueInterface* queue)
+      : queue_(queue) {
     thd_ = grpc_core::Thread(
         "mpmcq_test_consumer_thd",
         [](void* th) { static_cast<ConsumerThread*>(th)->Run(); }, this);
@@ -101,7 +102,7 @@ class ConsumerThread {
 
     gpr_log(GPR_DEBUG, "ConsumerThread: %d times of Get() called.", count);
   }
-  grpc_core::InfLenFIFOQueue* queue_;
+  grpc_core::MPMCQueueInterface* queue_;
   grpc_core::Thread thd_;
 };
 
@@ -219,12 +220,81 @@ static void test_many_thread(void) {
   gpr_log(GPR_DEBUG, "Done.");
 }
 
+static void test_lock_free_FIFO(void) {
+  gpr_log(GPR_INFO, "test_lock_free_FIFO");
+  grpc_core::LockFreeMPMCQueue queue;
+  // Puts two laps of the ring plus some extra so that both the ring wrap
+  // and the overflow list get exercised.
+  const int num_items = queue.ring_size() * 2 + 500;
+  for (int i = 0; i < num_items; ++i) {
+    queue.Put(static_cast<void*>(new WorkItem(i)));
+  }
+  GPR_ASSERT(queue.count() == num_items);
+  for (int i = 0; i < num_items; ++i) {
+    WorkItem* item = static_cast<WorkItem*>(queue.Get(nullptr));
+    GPR_ASSERT(i == item->index);
+    delete item;
+  }
+  GPR_ASSERT(queue.count() == 0);
+}
+
+static void test_lock_free_many_thread(void) {
+  gpr_log(GPR_INFO, "test_lock_free_many_thread");
+  const int num_producer_threads = 10;
+  const int num_consumer_threads = 20;
+  grpc_core::LockFreeMPMCQueue queue;
+  ProducerThread** producer_threads = static_cast<ProducerThread**>(
+      gpr_zalloc(num_producer_threads * sizeof(ProducerThread*)));
+  ConsumerThread** consumer_threads = static_cast<ConsumerThread**>(
+      gpr_zalloc(num_consumer_threads * sizeof(ConsumerThread*)));
+
+  gpr_log(GPR_DEBUG, "Fork ProducerThreads...");
+  for (int i = 0; i < num_producer_threads; ++i) {
+    producer_threads[i] =
+        new ProducerThread(&queue, i * TEST_NUM_ITEMS, TEST_NUM_ITEMS);
+    producer_threads[i]->Start();
+  }
+  gpr_log(GPR_DEBUG, "ProducerThreads Started.");
+  gpr_log(GPR_DEBUG, "Fork ConsumerThreads...");
+  for (int i = 0; i < num_consumer_threads; ++i) {
+    consumer_threads[i] = new ConsumerThread(&queue);
+    consumer_threads[i]->Start();
+  }
+  gpr_log(GPR_DEBUG, "ConsumerThreads Started.");
+  gpr_log(GPR_DEBUG, "Waiting ProducerThreads to finish...");
+  for (int i = 0; i < num_producer_threads; ++i) {
+    producer_threads[i]->Join();
+  }
+  gpr_log(GPR_DEBUG, "All ProducerThreads Terminated.");
+  gpr_log(GPR_DEBUG, "Terminating ConsumerThreads...");
+  for (int i = 0; i < num_consumer_threads; ++i) {
+    queue.Put(nullptr);
+  }
+  for (int i = 0; i < num_consumer_threads; ++i) {
+    consumer_threads[i]->Join();
+  }
+  gpr_log(GPR_DEBUG, "All ConsumerThreads Terminated.");
+  gpr_log(GPR_DEBUG, "Checking WorkItems and Cleaning Up...");
+  for (int i = 0; i < num_producer_threads; ++i) {
+    // Destructor of ProducerThread will do the check of WorkItems
+    delete producer_threads[i];
+  }
+  gpr_free(producer_threads);
+  for (int i = 0; i < num_consumer_threads; ++i) {
+    delete consumer_threads[i];
+  }
+  gpr_free(consumer_threads);
+  gpr_log(GPR_DEBUG, "Done.");
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
   test_FIFO();
   test_space_efficiency();
   test_many_thread();
+  test_lock_free_FIFO();
+  test_lock_free_many_thread();
   grpc_shutdown();
   return 0;
 }
@@ -43,7 +43,7 @@ static grpc_timer* create_test_elements(size_t num_elements) {
 static int contains(grpc_timer_heap* pq, grpc_timer* el) {
   size_t i;
   for (i = 0; i < pq->timer_count; i++) {
-    if (pq->timers[i] == el) return 1;
+    if (pq->timers[i].timer == el) return 1;
   }
   return 0;
 }
@@ -51,13 +51,13 @@ static int contains(grpc_timer_heap* pq, grpc_timer* el) {
 static void check_valid(grpc_timer_heap* pq) {
   size_t i;
   for (i = 0; i < pq->timer_count; ++i) {
-    size_t left_child = 1u + 2u * i;
-    size_t right_child = left_child + 1u;
-    if (left_child < pq->timer_count) {
-      GPR_ASSERT(pq->timers[i]->deadline <= pq->timers[left_child]->deadline);
-    }
-    if (right_child < pq->timer_count) {
-      GPR_ASSERT(pq->timers[i]->deadline <= pq->timers[right_child]->deadline);
+    size_t child;
+    GPR_ASSERT(pq->timers[i].deadline == pq->timers[i].timer->deadline);
+    GPR_ASSERT(pq->timers[i].timer->heap_index == i);
+    for (child = 4u * i + 1u; child <= 4u * i + 4u; ++child) {
+      if (child < pq->timer_count) {
+        GPR_ASSERT(pq->timers[i].deadline <= pq->timers[child].deadline);
+      }
     }
   }
 }
@@ -223,6 +223,46 @@ static void test2(void) {
   gpr_free(elems);
 }
 
+static void pop_expired_test(void) {
+  gpr_log(GPR_INFO, "pop_expired_test");
+
+  grpc_timer_heap pq;
+  const size_t num_test_elements = 200;
+  const grpc_millis cutoff = RAND_MAX / 2;
+  grpc_timer* test_elements = create_test_elements(num_test_elements);
+  grpc_timer* out[32];
+  size_t num_expired = 0;
+  size_t num_popped = 0;
+  size_t i;
+
+  grpc_timer_heap_init(&pq);
+  for (i = 0; i < num_test_elements; ++i) {
+    grpc_timer_heap_add(&pq, &test_elements[i]);
+    if (test_elements[i].deadline <= cutoff) num_expired++;
+  }
+
+  for (;;) {
+    size_t n =
+        grpc_timer_heap_pop_expired(&pq, cutoff, out, GPR_ARRAY_SIZE(out));
+    for (i = 0; i < n; ++i) {
+      GPR_ASSERT(out[i]->deadline <= cutoff);
+      GPR_ASSERT(!contains(&pq, out[i]));
+    }
+    check_valid(&pq);
+    num_popped += n;
+    if (n < GPR_ARRAY_SIZE(out)) break;
+  }
+
+  /* Everything at or below the cutoff came out; everything above stayed. */
+  GPR_ASSERT(num_popped == num_expired);
+  for (i = 0; i < pq.timer_count; ++i) {
+    GPR_ASSERT(pq.timers[i].deadline > cutoff);
+  }
+
+  grpc_timer_heap_destroy(&pq);
+  gpr_free(test_elements);
+}
+
 static void shrink_test(void) {
   gpr_log(GPR_INFO, "shrink_test");
 
@@ -245,7 +285,7 @@ static void shrink_test(void) {
 
   /* Remove elements until the Size is 1/4 the original size. */
   while (pq.timer_count > num_elements / 4) {
-    grpc_timer* const te = pq.timers[pq.timer_count - 1];
+    grpc_timer* const te = pq.timers[pq.timer_count - 1].timer;
     grpc_timer_heap_remove(&pq, te);
     gpr_free(te);
   }
@@ -262,7 +302,7 @@ static void shrink_test(void) {
   expected_size = pq.timer_count;
   while (pq.timer_count > 0) {
     const size_t which = static_cast<size_t>(rand()) % pq.timer_count;
-    grpc_timer* te = pq.timers[which];
+    grpc_timer* te = pq.timers[which].timer;
     grpc_timer_heap_remove(&pq, te);
     gpr_free(te);
     expected_size--;
@@ -290,6 +330,7 @@ int main(int argc, char** argv) {
   for (i = 0; i < 5; i++) {
     test1();
     test2();
+    pop_expired_test();
     shrink_test();
   }
 
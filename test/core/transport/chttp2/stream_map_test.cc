@@ -69,16 +69,18 @@ static void test_basic_add_find(uint32_t n) {
   grpc_chttp2_stream_map_destroy(&map);
 }
 
-/* verify that for_each gets the right values during test_delete_evens_XXX */
+/* verify that for_each gets the right values during test_delete_evens_XXX;
+   iteration order is unspecified, so tally the keys seen instead */
 static void verify_for_each(void* user_data, uint32_t stream_id, void* ptr) {
-  uint32_t* for_each_check = static_cast<uint32_t*>(user_data);
+  uint64_t* for_each_sum = static_cast<uint64_t*>(user_data);
   GPR_ASSERT(ptr);
-  GPR_ASSERT(*for_each_check == stream_id);
-  *for_each_check += 2;
+  GPR_ASSERT(stream_id & 1);
+  *for_each_sum += stream_id;
 }
 
 static void check_delete_evens(grpc_chttp2_stream_map* map, uint32_t n) {
-  uint32_t for_each_check = 1;
+  uint64_t for_each_sum = 0;
+  uint64_t num_odd;
   uint32_t i;
   size_t got;
 
@@ -93,12 +95,10 @@ static void check_delete_evens(grpc_chttp2_stream_map* map, uint32_t n) {
     }
   }
 
-  grpc_chttp2_stream_map_for_each(map, verify_for_each, &for_each_check);
-  if (n & 1) {
-    GPR_ASSERT(for_each_check == n + 2);
-  } else {
-    GPR_ASSERT(for_each_check == n + 1);
-  }
+  grpc_chttp2_stream_map_for_each(map, verify_for_each, &for_each_sum);
+  /* the sum of the first m odd numbers is m^2 */
+  num_odd = (n + 1) / 2;
+  GPR_ASSERT(for_each_sum == num_odd * num_odd);
 }
 
 /* add a bunch of keys, delete the even ones, and make sure the map is
@@ -143,6 +143,23 @@ static void test_delete_evens_incremental(uint32_t n) {
   grpc_chttp2_stream_map_destroy(&map);
 }
 
+/* find a key (priming the one-entry cache), delete it, and make sure the
+   stale cached entry is not returned afterwards */
+static void test_cached_find_after_delete(void) {
+  grpc_chttp2_stream_map map;
+
+  LOG_TEST("test_cached_find_after_delete");
+
+  grpc_chttp2_stream_map_init(&map, 8);
+  grpc_chttp2_stream_map_add(&map, 1, reinterpret_cast<void*>(1));
+  grpc_chttp2_stream_map_add(&map, 3, reinterpret_cast<void*>(3));
+  GPR_ASSERT((void*)1 == grpc_chttp2_stream_map_find(&map, 1));
+  GPR_ASSERT((void*)1 == grpc_chttp2_stream_map_delete(&map, 1));
+  GPR_ASSERT(nullptr == grpc_chttp2_stream_map_find(&map, 1));
+  GPR_ASSERT((void*)3 == grpc_chttp2_stream_map_find(&map, 3));
+  grpc_chttp2_stream_map_destroy(&map);
+}
+
 /* add a bunch of keys, delete old ones after some time, ensure the
    backing array does not grow */
 static void test_periodic_compaction(uint32_t n) {
@@ -176,6 +193,7 @@ int main(int argc, char** argv) {
 
   test_no_op();
   test_empty_find();
+  test_cached_find_after_delete();
 
   while (n < 100000) {
     test_basic_add_find(n);
@@ -0,0 +1,180 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "src/core/ext/transport/shm/shm_ring_buffer.h"
+
+#include <grpc/support/port_platform.h>
+
+#ifdef GPR_LINUX
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+TEST(ShmRingBufferTest, CreateRoundsCapacityUpToPowerOfTwo) {
+  auto ring = ShmRingBuffer::Create(1000);
+  ASSERT_NE(ring, nullptr);
+  EXPECT_EQ(ring->capacity(), 1024u);
+}
+
+TEST(ShmRingBufferTest, WriteThenRead) {
+  auto ring = ShmRingBuffer::Create(64);
+  ASSERT_NE(ring, nullptr);
+  const char msg[] = "hello shm ring";
+  EXPECT_EQ(ring->Write(msg, sizeof(msg)), sizeof(msg));
+  char buf[sizeof(msg)];
+  EXPECT_EQ(ring->Read(buf, sizeof(buf)), sizeof(buf));
+  EXPECT_EQ(memcmp(buf, msg, sizeof(msg)), 0);
+  // Ring is empty again.
+  EXPECT_EQ(ring->Read(buf, sizeof(buf)), 0u);
+}
+
+TEST(ShmRingBufferTest, WriteStopsAtFullAndWrapsAround) {
+  auto ring = ShmRingBuffer::Create(64);
+  ASSERT_NE(ring, nullptr);
+  const size_t cap = ring->capacity();
+  std::vector<uint8_t> data(2 * cap);
+  for (size_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<uint8_t>(i);
+  }
+  // Fill the ring completely; further writes make no progress.
+  EXPECT_EQ(ring->Write(data.data(), data.size()), cap);
+  EXPECT_EQ(ring->Write(data.data(), 1), 0u);
+  // Drain half, refill past the physical end of the data region.
+  std::vector<uint8_t> out(data.size());
+  EXPECT_EQ(ring->Read(out.data(), cap / 2), cap / 2);
+  EXPECT_EQ(ring->Write(data.data() + cap, cap / 2), cap / 2);
+  EXPECT_EQ(ring->Read(out.data() + cap / 2, cap), cap);
+  EXPECT_EQ(memcmp(out.data(), data.data(), cap + cap / 2), 0);
+}
+
+TEST(ShmRingBufferTest, AttachSeesPeerWrites) {
+  auto ring = ShmRingBuffer::Create(64);
+  ASSERT_NE(ring, nullptr);
+  int fd = fcntl(ring->fd(), F_DUPFD_CLOEXEC, 0);
+  ASSERT_GE(fd, 0);
+  auto peer = ShmRingBuffer::Attach(fd);
+  ASSERT_NE(peer, nullptr);
+  EXPECT_EQ(peer->capacity(), ring->capacity());
+  const char msg[] = "cross-mapping";
+  EXPECT_EQ(ring->Write(msg, sizeof(msg)), sizeof(msg));
+  char buf[sizeof(msg)];
+  EXPECT_EQ(peer->Read(buf, sizeof(buf)), sizeof(buf));
+  EXPECT_EQ(memcmp(buf, msg, sizeof(msg)), 0);
+}
+
+TEST(ShmRingBufferTest, AttachRejectsInvalidFd) {
+  int fd = open("/dev/null", O_RDONLY);
+  ASSERT_GE(fd, 0);
+  EXPECT_EQ(ShmRingBuffer::Attach(fd), nullptr);
+}
+
+TEST(ShmRingBufferTest, WaitForDataTimesOutOnEmptyRing) {
+  auto ring = ShmRingBuffer::Create(64);
+  ASSERT_NE(ring, nullptr);
+  EXPECT_FALSE(ring->WaitForData(20));
+}
+
+TEST(ShmRingBufferTest, WaitForSpaceTimesOutOnFullRing) {
+  auto ring = ShmRingBuffer::Create(64);
+  ASSERT_NE(ring, nullptr);
+  std::vector<uint8_t> data(ring->capacity(), 0xab);
+  ASSERT_EQ(ring->Write(data.data(), data.size()), data.size());
+  EXPECT_FALSE(ring->WaitForSpace(20));
+}
+
+// Streams far more data than the ring holds through a tiny ring, with both
+// sides blocking indefinitely on the futex doorbells. A tiny ring maximizes
+// empty<->full transitions, which is exactly where a missed doorbell (the
+// Dekker store-load race between publishing an index and deciding whether to
+// wake the peer) would deadlock both threads; the fences in Write()/Read()
+// and the wait loops are what this test leans on.
+TEST(ShmRingBufferTest, StressBlockingProducerConsumer) {
+  auto ring = ShmRingBuffer::Create(64);
+  ASSERT_NE(ring, nullptr);
+  int fd = fcntl(ring->fd(), F_DUPFD_CLOEXEC, 0);
+  ASSERT_GE(fd, 0);
+  auto peer = ShmRingBuffer::Attach(fd);
+  ASSERT_NE(peer, nullptr);
+  constexpr size_t kTotalBytes = 4 * 1024 * 1024;
+  std::thread producer([&ring]() {
+    uint8_t next = 0;
+    uint8_t buf[97];  // deliberately not a divisor of the ring size
+    size_t sent = 0;
+    while (sent < kTotalBytes) {
+      const size_t want = std::min(sizeof(buf), kTotalBytes - sent);
+      for (size_t i = 0; i < want; i++) {
+        buf[i] = static_cast<uint8_t>(next + i);
+      }
+      size_t written = 0;
+      while (written < want) {
+        const size_t n = ring->Write(buf + written, want - written);
+        if (n == 0) {
+          ring->WaitForSpace(-1);
+          continue;
+        }
+        written += n;
+      }
+      next = static_cast<uint8_t>(next + want);
+      sent += want;
+    }
+  });
+  uint8_t expected = 0;
+  size_t received = 0;
+  uint8_t buf[64];
+  while (received < kTotalBytes) {
+    const size_t n = peer->Read(buf, sizeof(buf));
+    if (n == 0) {
+      peer->WaitForData(-1);
+      continue;
+    }
+    for (size_t i = 0; i < n; i++) {
+      ASSERT_EQ(buf[i], expected) << "at offset " << received + i;
+      expected = static_cast<uint8_t>(expected + 1);
+    }
+    received += n;
+  }
+  producer.join();
+  // Everything was consumed.
+  EXPECT_EQ(ring->Read(buf, sizeof(buf)), 0u);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+#endif  // GPR_LINUX
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
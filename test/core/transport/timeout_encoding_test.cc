@@ -70,6 +70,31 @@ void test_encoding(void) {
   assert_encodes_as(100000000000, "99999999S");
 }
 
+static void assert_rounding_consistent(grpc_millis ts) {
+  char direct[GRPC_HTTP2_TIMEOUT_ENCODE_MIN_BUFSIZE];
+  char rounded[GRPC_HTTP2_TIMEOUT_ENCODE_MIN_BUFSIZE];
+  grpc_millis bucket = grpc_http2_round_timeout(ts);
+  grpc_http2_encode_timeout(ts, direct);
+  grpc_http2_encode_timeout(bucket, rounded);
+  GPR_ASSERT(0 == strcmp(direct, rounded));
+  GPR_ASSERT(bucket == grpc_http2_round_timeout(bucket));
+}
+
+void test_rounding(void) {
+  LOG_TEST("test_rounding");
+  /* rounding must be idempotent and agree with the wire encoding, so that a
+     rounded bucket can stand in for every timeout that maps to it */
+  for (grpc_millis ts = -10; ts <= 200000; ts++) {
+    assert_rounding_consistent(ts);
+  }
+  for (grpc_millis ts = 1; ts < 99000000000; ts = ts * 3 + 7) {
+    assert_rounding_consistent(ts);
+  }
+  /* timeouts at and beyond the cap all round to the capped wire value */
+  assert_encodes_as(grpc_http2_round_timeout(99999999000), "99999999S");
+  assert_encodes_as(grpc_http2_round_timeout(100000000000), "99999999S");
+}
+
 static void assert_decodes_as(const char* buffer, grpc_millis expected) {
   grpc_millis got;
   uint32_t hash = gpr_murmur_hash3(buffer, strlen(buffer), 0);
@@ -158,6 +183,7 @@ void test_decoding_fails(void) {
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   test_encoding();
+  test_rounding();
   test_decoding();
   test_decoding_fails();
   return 0;
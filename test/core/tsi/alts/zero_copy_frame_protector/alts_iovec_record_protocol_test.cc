@@ -448,6 +448,35 @@ static void privacy_integrity_random_seal_unseal(
   }
 }
 
+static void privacy_integrity_random_seal_unseal_in_place(
+    alts_iovec_record_protocol* sender, alts_iovec_record_protocol* receiver) {
+  for (size_t i = 0; i < kSealRepeatTimes; i++) {
+    alts_iovec_record_protocol_test_var* var =
+        alts_iovec_record_protocol_test_var_create();
+    /* Seals and then unseals in place.  */
+    grpc_status_code status =
+        alts_iovec_record_protocol_privacy_integrity_protect(
+            sender, var->data_iovec, var->data_iovec_length,
+            var->protected_iovec, nullptr);
+    GPR_ASSERT(status == GRPC_STATUS_OK);
+    iovec_t header_iovec = {var->protected_buf, var->header_length};
+    gpr_free(var->data_iovec);
+    /* Randomly slices protected buffer, excluding the header.  */
+    randomly_slice(var->protected_buf + var->header_length,
+                   var->data_length + var->tag_length, &var->data_iovec,
+                   &var->data_iovec_length);
+    status = alts_iovec_record_protocol_privacy_integrity_unprotect_in_place(
+        receiver, header_iovec, var->data_iovec, var->data_iovec_length,
+        nullptr);
+    GPR_ASSERT(status == GRPC_STATUS_OK);
+    /* The ciphertext in the protected buffer has been overwritten with the
+     * unprotected data.  */
+    GPR_ASSERT(memcmp(var->protected_buf + var->header_length, var->dup_buf,
+                      var->data_length) == 0);
+    alts_iovec_record_protocol_test_var_destroy(var);
+  }
+}
+
 static void privacy_integrity_empty_seal_unseal(
     alts_iovec_record_protocol* sender, alts_iovec_record_protocol* receiver) {
   alts_iovec_record_protocol_test_var* var =
@@ -755,6 +784,10 @@ static void alts_iovec_record_protocol_random_seal_unseal_tests() {
                                        fixture->server_unprotect);
   privacy_integrity_random_seal_unseal(fixture->server_protect,
                                        fixture->client_unprotect);
+  privacy_integrity_random_seal_unseal_in_place(fixture->client_protect,
+                                                fixture->server_unprotect);
+  privacy_integrity_random_seal_unseal_in_place(fixture->server_protect,
+                                                fixture->client_unprotect);
   alts_iovec_record_protocol_test_fixture_destroy(fixture);
 
   fixture = alts_iovec_record_protocol_test_fixture_create(
@@ -763,6 +796,10 @@ static void alts_iovec_record_protocol_random_seal_unseal_tests() {
                                        fixture->server_unprotect);
   privacy_integrity_random_seal_unseal(fixture->server_protect,
                                        fixture->client_unprotect);
+  privacy_integrity_random_seal_unseal_in_place(fixture->client_protect,
+                                                fixture->server_unprotect);
+  privacy_integrity_random_seal_unseal_in_place(fixture->server_protect,
+                                                fixture->client_unprotect);
   alts_iovec_record_protocol_test_fixture_destroy(fixture);
 }
 
@@ -1669,6 +1669,118 @@ TEST_F(ClientLbEnd2endTest, ChannelIdleness) {
   EXPECT_EQ(channel->GetState(false), GRPC_CHANNEL_READY);
 }
 
+TEST_F(ClientLbEnd2endTest, WeightedRoundRobin) {
+  // Start servers and send one RPC per server.
+  const int kNumServers = 3;
+  StartServers(kNumServers);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel =
+      BuildChannel("weighted_round_robin_experimental", response_generator);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(GetServersPorts());
+  // Wait until all backends are ready.
+  do {
+    CheckRpcSendOk(stub, DEBUG_LOCATION);
+  } while (!SeenAllServers());
+  ResetCounters();
+  // None of the backends has sent a load report, so they all carry the
+  // default weight and the policy degenerates to plain round-robin: over
+  // any multiple of kNumServers picks, each backend is picked the same
+  // number of times.
+  const int kNumRpcsPerServer = 3;
+  for (int i = 0; i < kNumRpcsPerServer * kNumServers; ++i) {
+    CheckRpcSendOk(stub, DEBUG_LOCATION);
+  }
+  for (size_t i = 0; i < servers_.size(); ++i) {
+    EXPECT_EQ(kNumRpcsPerServer, servers_[i]->service_.request_count())
+        << "server " << i;
+  }
+  // Check LB policy name for the channel.
+  EXPECT_EQ("weighted_round_robin_experimental",
+            channel->GetLoadBalancingPolicyName());
+}
+
+TEST_F(ClientLbEnd2endTest, WeightedRoundRobinWeightsFromLoadReports) {
+  const int kNumServers = 2;
+  StartServers(kNumServers);
+  // Backend 1 reports 3x the weight of backend 0 (same CPU, 3x the QPS),
+  // so it should receive 3x the traffic.
+  udpa::data::orca::v1::OrcaLoadReport load_report_0;
+  load_report_0.set_cpu_utilization(0.5);
+  load_report_0.set_rps(100);
+  servers_[0]->service_.set_load_report(&load_report_0);
+  udpa::data::orca::v1::OrcaLoadReport load_report_1;
+  load_report_1.set_cpu_utilization(0.5);
+  load_report_1.set_rps(300);
+  servers_[1]->service_.set_load_report(&load_report_1);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel =
+      BuildChannel("weighted_round_robin_experimental", response_generator);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(GetServersPorts());
+  // Wait until both backends are ready and have had a report merged into
+  // their weight (the first report replaces the default weight outright).
+  do {
+    CheckRpcSendOk(stub, DEBUG_LOCATION);
+  } while (!SeenAllServers());
+  ResetCounters();
+  // With weights in a 1:3 ratio the smooth weighted round-robin rotation
+  // sends 1 of every 4 picks to backend 0; allow a little slop for where
+  // in the rotation we start.
+  const int kNumRpcs = 40;
+  for (int i = 0; i < kNumRpcs; ++i) {
+    CheckRpcSendOk(stub, DEBUG_LOCATION);
+  }
+  EXPECT_NEAR(kNumRpcs / 4, servers_[0]->service_.request_count(), 2);
+  EXPECT_NEAR(3 * kNumRpcs / 4, servers_[1]->service_.request_count(), 2);
+  // Now swap the reports. The EWMA needs a handful of reports per backend
+  // to converge, so burn some RPCs before measuring again.
+  load_report_0.set_rps(300);
+  load_report_1.set_rps(100);
+  for (int i = 0; i < 50; ++i) {
+    CheckRpcSendOk(stub, DEBUG_LOCATION);
+  }
+  ResetCounters();
+  for (int i = 0; i < kNumRpcs; ++i) {
+    CheckRpcSendOk(stub, DEBUG_LOCATION);
+  }
+  EXPECT_NEAR(3 * kNumRpcs / 4, servers_[0]->service_.request_count(), 4);
+  EXPECT_NEAR(kNumRpcs / 4, servers_[1]->service_.request_count(), 4);
+}
+
+TEST_F(ClientLbEnd2endTest, WeightedRoundRobinFreshBackendGetsAverageWeight) {
+  const int kNumServers = 3;
+  StartServers(kNumServers);
+  // Backends 0 and 1 report weights of 100 and 300; backend 2 never
+  // reports. It should be treated as carrying the average weight of its
+  // peers (200), i.e. neither starved nor flooded while it warms up.
+  udpa::data::orca::v1::OrcaLoadReport load_report_0;
+  load_report_0.set_cpu_utilization(1.0);
+  load_report_0.set_rps(100);
+  servers_[0]->service_.set_load_report(&load_report_0);
+  udpa::data::orca::v1::OrcaLoadReport load_report_1;
+  load_report_1.set_cpu_utilization(1.0);
+  load_report_1.set_rps(300);
+  servers_[1]->service_.set_load_report(&load_report_1);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel =
+      BuildChannel("weighted_round_robin_experimental", response_generator);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(GetServersPorts());
+  do {
+    CheckRpcSendOk(stub, DEBUG_LOCATION);
+  } while (!SeenAllServers());
+  ResetCounters();
+  // Effective weights 100:300:200 out of 600 total.
+  const int kNumRpcs = 60;
+  for (int i = 0; i < kNumRpcs; ++i) {
+    CheckRpcSendOk(stub, DEBUG_LOCATION);
+  }
+  EXPECT_NEAR(kNumRpcs / 6, servers_[0]->service_.request_count(), 3);
+  EXPECT_NEAR(kNumRpcs / 2, servers_[1]->service_.request_count(), 3);
+  EXPECT_NEAR(kNumRpcs / 3, servers_[2]->service_.request_count(), 3);
+}
+
 class ClientLbPickArgsTest : public ClientLbEnd2endTest {
  protected:
   void SetUp() override {
@@ -849,6 +849,29 @@ TEST_P(End2endTest, MultipleRpcs) {
   }
 }
 
+TEST_P(End2endTest, MultipleRpcsReusedContext) {
+  ResetStub();
+  EchoRequest request;
+  EchoResponse response;
+  request.set_message("Hello hello hello hello");
+
+  request.mutable_param()->set_echo_metadata(true);
+
+  ClientContext context;
+  context.AddMetadata("custom-header", "custom value");
+  for (int i = 0; i < 10; ++i) {
+    if (i != 0) context.Reset();
+    Status s = stub_->Echo(&context, request, &response);
+    EXPECT_EQ(response.message(), request.message());
+    EXPECT_TRUE(s.ok());
+    // Metadata added before the first RPC carries over to later ones.
+    auto trailers = context.GetServerTrailingMetadata();
+    auto iter = trailers.find("custom-header");
+    ASSERT_TRUE(iter != trailers.end());
+    EXPECT_EQ("custom value", ToString(iter->second));
+  }
+}
+
 TEST_P(End2endTest, ManyStubs) {
   ResetStub();
   ChannelTestPeer peer(channel_.get());
@@ -1016,6 +1039,25 @@ TEST_P(End2endTest, ResponseStreamWithCoalescingApi) {
   EXPECT_TRUE(s.ok());
 }
 
+TEST_P(End2endTest, ResponseStreamWithWriteAhead) {
+  ResetStub();
+  EchoRequest request;
+  EchoResponse response;
+  ClientContext context;
+  request.set_message("hello");
+  context.AddMetadata(kServerUseWriteAhead, "1");
+
+  auto stream = stub_->ResponseStream(&context, request);
+  for (int i = 0; i < kServerDefaultResponseStreamsToSend; ++i) {
+    EXPECT_TRUE(stream->Read(&response));
+    EXPECT_EQ(response.message(), request.message() + std::to_string(i));
+  }
+  EXPECT_FALSE(stream->Read(&response));
+
+  Status s = stream->Finish();
+  EXPECT_TRUE(s.ok());
+}
+
 // This was added to prevent regression from issue:
 // https://github.com/grpc/grpc/issues/11546
 TEST_P(End2endTest, ResponseStreamWithEverythingCoalesced) {
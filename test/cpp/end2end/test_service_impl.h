@@ -46,6 +46,7 @@ const char* const kClientTryCancelRequest = "client_try_cancel";
 const char* const kDebugInfoTrailerKey = "debug-info-bin";
 const char* const kServerFinishAfterNReads = "server_finish_after_n_reads";
 const char* const kServerUseCoalescingApi = "server_use_coalescing_api";
+const char* const kServerUseWriteAhead = "server_use_write_ahead";
 const char* const kCheckClientInitialMetadataKey = "custom_client_metadata";
 const char* const kCheckClientInitialMetadataVal = "Value for client metadata";
 
@@ -325,6 +326,9 @@ class TestMultipleServiceImpl : public RpcService {
     int server_coalescing_api = internal::GetIntValueFromMetadata(
         kServerUseCoalescingApi, context->client_metadata(), 0);
 
+    int server_write_ahead = internal::GetIntValueFromMetadata(
+        kServerUseWriteAhead, context->client_metadata(), 0);
+
     int server_responses_to_send = internal::GetIntValueFromMetadata(
         kServerResponseStreamsToSend, context->client_metadata(),
         kServerDefaultResponseStreamsToSend);
@@ -345,6 +349,8 @@ class TestMultipleServiceImpl : public RpcService {
       response.set_message(request->message() + std::to_string(i));
       if (i == server_responses_to_send - 1 && server_coalescing_api != 0) {
         writer->WriteLast(response, WriteOptions());
+      } else if (server_write_ahead != 0) {
+        writer->Write(response, WriteOptions().set_write_ahead());
       } else {
         writer->Write(response);
       }
@@ -104,7 +104,7 @@ static void BM_HpackEncoderEncodeDeadline(benchmark::State& state) {
 }
 BENCHMARK(BM_HpackEncoderEncodeDeadline);
 
-template <class Fixture>
+template <class Fixture, bool kEnableAdaptiveIndexing = false>
 static void BM_HpackEncoderEncodeHeader(benchmark::State& state) {
   TrackCounters track_counters;
   grpc_core::ExecCtx exec_ctx;
@@ -119,6 +119,7 @@ static void BM_HpackEncoderEncodeHeader(benchmark::State& state) {
   }
 
   grpc_core::HPackCompressor c;
+  c.SetAdaptiveIndexing(kEnableAdaptiveIndexing);
   grpc_transport_one_way_stats stats;
   stats = {};
   grpc_slice_buffer outbuf;
@@ -416,6 +417,16 @@ BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
                    RepresentativeServerTrailingMetadata)
     ->Args({1, 16384});
 
+// sketch-based adaptive table insertion (GRPC_ARG_HTTP2_HPACK_ADAPTIVE_INDEXING)
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleInternedElem, true)
+    ->Args({0, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
+                   RepresentativeClientInitialMetadata, true)
+    ->Args({0, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
+                   MoreRepresentativeClientInitialMetadata, true)
+    ->Args({0, 16384});
+
 }  // namespace hpack_encoder_fixtures
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,136 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark base64 and percent-encoding slice codecs */
+
+#include <benchmark/benchmark.h>
+
+#include <grpc/grpc.h>
+#include <grpc/support/alloc.h>
+
+#include "src/core/lib/slice/b64.h"
+#include "src/core/lib/slice/percent_encoding.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+static grpc_slice MakeBinarySlice(size_t length) {
+  grpc_slice slice = GRPC_SLICE_MALLOC(length);
+  uint8_t* p = GRPC_SLICE_START_PTR(slice);
+  for (size_t i = 0; i < length; i++) {
+    p[i] = static_cast<uint8_t>(i * 31 + 7);
+  }
+  return slice;
+}
+
+static grpc_slice MakeAsciiSlice(size_t length) {
+  grpc_slice slice = GRPC_SLICE_MALLOC(length);
+  uint8_t* p = GRPC_SLICE_START_PTR(slice);
+  for (size_t i = 0; i < length; i++) {
+    p[i] = static_cast<uint8_t>('a' + (i % 26));
+  }
+  return slice;
+}
+
+static void BM_Base64Encode(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_slice input = MakeBinarySlice(state.range(0));
+  for (auto _ : state) {
+    gpr_free(grpc_base64_encode(GRPC_SLICE_START_PTR(input),
+                                GRPC_SLICE_LENGTH(input), /*url_safe=*/true,
+                                /*multiline=*/0));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  grpc_slice_unref_internal(input);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_Base64Encode)->Range(8, 4096);
+
+static void BM_Base64Decode(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_slice input = MakeBinarySlice(state.range(0));
+  char* encoded = grpc_base64_encode(GRPC_SLICE_START_PTR(input),
+                                     GRPC_SLICE_LENGTH(input),
+                                     /*url_safe=*/true, /*multiline=*/0);
+  for (auto _ : state) {
+    grpc_slice_unref_internal(grpc_base64_decode(encoded, /*url_safe=*/true));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  gpr_free(encoded);
+  grpc_slice_unref_internal(input);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_Base64Decode)->Range(8, 4096);
+
+static void BM_PercentEncodeClean(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_slice input = MakeAsciiSlice(state.range(0));
+  for (auto _ : state) {
+    grpc_slice_unref_internal(grpc_core::PercentEncodeSlice(
+        input, grpc_core::PercentEncodingType::Compatible));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  grpc_slice_unref_internal(input);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_PercentEncodeClean)->Range(8, 4096);
+
+static void BM_PercentEncodeBinary(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_slice input = MakeBinarySlice(state.range(0));
+  for (auto _ : state) {
+    grpc_slice_unref_internal(grpc_core::PercentEncodeSlice(
+        input, grpc_core::PercentEncodingType::Compatible));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  grpc_slice_unref_internal(input);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_PercentEncodeBinary)->Range(8, 4096);
+
+static void BM_PercentDecode(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_slice input = MakeBinarySlice(state.range(0));
+  grpc_slice encoded = grpc_core::PercentEncodeSlice(
+      input, grpc_core::PercentEncodingType::Compatible);
+  for (auto _ : state) {
+    grpc_slice_unref_internal(*grpc_core::PercentDecodeSlice(
+        encoded, grpc_core::PercentEncodingType::Compatible));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  grpc_slice_unref_internal(encoded);
+  grpc_slice_unref_internal(input);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_PercentDecode)->Range(8, 4096);
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  ::grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
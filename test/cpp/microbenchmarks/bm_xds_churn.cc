@@ -0,0 +1,235 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Microbenchmarks around xds control-plane churn: the per-update work the
+   client performs when the management server re-sends EDS resources. */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <grpc/support/log.h>
+
+#include "absl/strings/str_cat.h"
+
+#include "envoy/config/core/v3/address.upb.h"
+#include "envoy/config/core/v3/base.upb.h"
+#include "envoy/config/endpoint/v3/endpoint.upb.h"
+#include "envoy/config/endpoint/v3/endpoint_components.upb.h"
+#include "envoy/service/discovery/v3/discovery.upb.h"
+#include "google/protobuf/any.upb.h"
+#include "google/protobuf/wrappers.upb.h"
+#include "upb/upb.hpp"
+
+#include "src/core/ext/xds/xds_api.h"
+#include "src/core/ext/xds/xds_client.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+constexpr char kEdsServiceName[] = "bm_eds_service";
+
+grpc_core::XdsBootstrap::XdsServer MakeXdsServer() {
+  grpc_core::XdsBootstrap::XdsServer server;
+  server.server_uri = "fake:///xds_server";
+  server.server_features.insert("xds_v3");
+  return server;
+}
+
+// Builds a serialized DiscoveryResponse carrying one ClusterLoadAssignment
+// with \a num_endpoints endpoints in a single locality, the shape an EDS
+// flap re-delivers on every management server push.
+grpc_slice MakeEdsResponse(size_t num_endpoints, const char* version) {
+  upb::Arena arena;
+  envoy_service_discovery_v3_DiscoveryResponse* response =
+      envoy_service_discovery_v3_DiscoveryResponse_new(arena.ptr());
+  envoy_service_discovery_v3_DiscoveryResponse_set_type_url(
+      response, upb_strview_makez(grpc_core::XdsApi::kEdsTypeUrl));
+  envoy_service_discovery_v3_DiscoveryResponse_set_version_info(
+      response, upb_strview_makez(version));
+  envoy_service_discovery_v3_DiscoveryResponse_set_nonce(
+      response, upb_strview_makez("nonce"));
+  envoy_config_endpoint_v3_ClusterLoadAssignment* cla =
+      envoy_config_endpoint_v3_ClusterLoadAssignment_new(arena.ptr());
+  envoy_config_endpoint_v3_ClusterLoadAssignment_set_cluster_name(
+      cla, upb_strview_makez(kEdsServiceName));
+  envoy_config_endpoint_v3_LocalityLbEndpoints* locality =
+      envoy_config_endpoint_v3_ClusterLoadAssignment_add_endpoints(cla,
+                                                                   arena.ptr());
+  envoy_config_core_v3_Locality* locality_name =
+      envoy_config_endpoint_v3_LocalityLbEndpoints_mutable_locality(
+          locality, arena.ptr());
+  envoy_config_core_v3_Locality_set_region(locality_name,
+                                           upb_strview_makez("region"));
+  google_protobuf_UInt32Value* lb_weight =
+      envoy_config_endpoint_v3_LocalityLbEndpoints_mutable_load_balancing_weight(
+          locality, arena.ptr());
+  google_protobuf_UInt32Value_set_value(lb_weight, 1);
+  // The upb setters retain pointers into these strings, so keep them
+  // alive until the response is serialized.
+  std::vector<std::string> addresses;
+  addresses.reserve(num_endpoints);
+  for (size_t i = 0; i < num_endpoints; ++i) {
+    envoy_config_endpoint_v3_LbEndpoint* lb_endpoint =
+        envoy_config_endpoint_v3_LocalityLbEndpoints_add_lb_endpoints(
+            locality, arena.ptr());
+    envoy_config_endpoint_v3_Endpoint* endpoint =
+        envoy_config_endpoint_v3_LbEndpoint_mutable_endpoint(lb_endpoint,
+                                                             arena.ptr());
+    envoy_config_core_v3_Address* address =
+        envoy_config_endpoint_v3_Endpoint_mutable_address(endpoint,
+                                                          arena.ptr());
+    envoy_config_core_v3_SocketAddress* socket_address =
+        envoy_config_core_v3_Address_mutable_socket_address(address,
+                                                            arena.ptr());
+    addresses.push_back(absl::StrCat("10.0.", i / 256, ".", i % 256));
+    envoy_config_core_v3_SocketAddress_set_address(
+        socket_address,
+        upb_strview_make(addresses.back().data(), addresses.back().size()));
+    envoy_config_core_v3_SocketAddress_set_port_value(socket_address, 443);
+  }
+  size_t cla_length;
+  char* cla_bytes = envoy_config_endpoint_v3_ClusterLoadAssignment_serialize(
+      cla, arena.ptr(), &cla_length);
+  google_protobuf_Any* resource =
+      envoy_service_discovery_v3_DiscoveryResponse_add_resources(response,
+                                                                 arena.ptr());
+  google_protobuf_Any_set_type_url(
+      resource, upb_strview_makez(grpc_core::XdsApi::kEdsTypeUrl));
+  google_protobuf_Any_set_value(resource,
+                                upb_strview_make(cla_bytes, cla_length));
+  size_t response_length;
+  char* response_bytes = envoy_service_discovery_v3_DiscoveryResponse_serialize(
+      response, arena.ptr(), &response_length);
+  return grpc_slice_from_copied_buffer(response_bytes, response_length);
+}
+
+// Measures full EDS update processing: protobuf decode plus resource
+// validation down to the EdsUpdate handed to the cluster watchers.
+void BM_EdsResponseParse(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::CertificateProviderStore::PluginDefinitionMap definition_map;
+  grpc_core::XdsApi api(nullptr, &grpc_core::grpc_xds_client_trace, nullptr,
+                        &definition_map);
+  const grpc_core::XdsBootstrap::XdsServer server = MakeXdsServer();
+  const grpc_slice response =
+      MakeEdsResponse(static_cast<size_t>(state.range(0)), "1");
+  const std::set<absl::string_view> no_names;
+  const std::set<absl::string_view> eds_names = {kEdsServiceName};
+  const grpc_core::XdsApi::ResourceSerializedProtoMap no_cache;
+  for (auto _ : state) {
+    grpc_core::XdsApi::AdsParseResult result = api.ParseAdsResponse(
+        server, response, no_names, no_names, no_names, eds_names, no_cache,
+        no_cache, no_cache, no_cache);
+    GPR_ASSERT(result.parse_error == GRPC_ERROR_NONE);
+    GPR_ASSERT(result.eds_update_map.size() == 1);
+  }
+  grpc_slice_unref(response);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_EdsResponseParse)->Arg(100)->Arg(1000)->Arg(5000);
+
+// An EDS flap commonly re-sends byte-identical resources under a new
+// version; this measures the serialized-proto cache hit that skips
+// re-validation of an unchanged resource.
+void BM_EdsResponseParseUnchanged(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::CertificateProviderStore::PluginDefinitionMap definition_map;
+  grpc_core::XdsApi api(nullptr, &grpc_core::grpc_xds_client_trace, nullptr,
+                        &definition_map);
+  const grpc_core::XdsBootstrap::XdsServer server = MakeXdsServer();
+  const grpc_slice response =
+      MakeEdsResponse(static_cast<size_t>(state.range(0)), "2");
+  const std::set<absl::string_view> no_names;
+  const std::set<absl::string_view> eds_names = {kEdsServiceName};
+  const grpc_core::XdsApi::ResourceSerializedProtoMap no_cache;
+  grpc_core::XdsApi::AdsParseResult accepted = api.ParseAdsResponse(
+      server, response, no_names, no_names, no_names, eds_names, no_cache,
+      no_cache, no_cache, no_cache);
+  GPR_ASSERT(accepted.parse_error == GRPC_ERROR_NONE);
+  const std::string& serialized_proto =
+      accepted.eds_update_map[kEdsServiceName].serialized_proto;
+  grpc_core::XdsApi::ResourceSerializedProtoMap cached_protos = {
+      {kEdsServiceName, serialized_proto}};
+  for (auto _ : state) {
+    grpc_core::XdsApi::AdsParseResult result = api.ParseAdsResponse(
+        server, response, no_names, no_names, no_names, eds_names, no_cache,
+        no_cache, no_cache, cached_protos);
+    GPR_ASSERT(result.parse_error == GRPC_ERROR_NONE);
+    GPR_ASSERT(result.eds_update_map[kEdsServiceName].unchanged);
+  }
+  grpc_slice_unref(response);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_EdsResponseParseUnchanged)->Arg(100)->Arg(1000)->Arg(5000);
+
+// Measures the update comparison the XdsClient uses to decide whether a
+// re-delivered resource should be propagated to watchers (and hence
+// whether LB policy children get rebuilt).
+void BM_EdsUpdateCompare(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::CertificateProviderStore::PluginDefinitionMap definition_map;
+  grpc_core::XdsApi api(nullptr, &grpc_core::grpc_xds_client_trace, nullptr,
+                        &definition_map);
+  const grpc_core::XdsBootstrap::XdsServer server = MakeXdsServer();
+  const grpc_slice response =
+      MakeEdsResponse(static_cast<size_t>(state.range(0)), "3");
+  const std::set<absl::string_view> no_names;
+  const std::set<absl::string_view> eds_names = {kEdsServiceName};
+  const grpc_core::XdsApi::ResourceSerializedProtoMap no_cache;
+  grpc_core::XdsApi::AdsParseResult result = api.ParseAdsResponse(
+      server, response, no_names, no_names, no_names, eds_names, no_cache,
+      no_cache, no_cache, no_cache);
+  GPR_ASSERT(result.parse_error == GRPC_ERROR_NONE);
+  const grpc_core::XdsApi::EdsUpdate& update =
+      result.eds_update_map[kEdsServiceName].resource;
+  const grpc_core::XdsApi::EdsUpdate copy = update;
+  for (auto _ : state) {
+    bool equal = update == copy;
+    benchmark::DoNotOptimize(equal);
+    GPR_ASSERT(equal);
+  }
+  grpc_slice_unref(response);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_EdsUpdateCompare)->Arg(100)->Arg(1000)->Arg(5000);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  ::grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -18,8 +18,17 @@
 
 #include "test/cpp/microbenchmarks/helpers.h"
 
+#include <stdlib.h>
 #include <string.h>
 
+#ifdef GPR_LINUX
+#include <linux/perf_event.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 static grpc::internal::GrpcLibraryInitializer g_gli_initializer;
 static LibraryInitializer* g_libraryInitializer;
 
@@ -44,7 +53,97 @@ LibraryInitializer& LibraryInitializer::get() {
   return *g_libraryInitializer;
 }
 
+#ifdef GPR_LINUX
+namespace {
+
+struct PerfCounterSpec {
+  const char* name;
+  uint64_t config;
+};
+
+const PerfCounterSpec kPerfCounters[] = {
+    {"cache_misses/iter", PERF_COUNT_HW_CACHE_MISSES},
+    {"branch_misses/iter", PERF_COUNT_HW_BRANCH_MISSES},
+    {"stalled_cycles/iter", PERF_COUNT_HW_STALLED_CYCLES_FRONTEND},
+};
+
+bool PerfCountersRequested() {
+  static const bool requested =
+      getenv("GRPC_BENCHMARK_PERF_COUNTERS") != nullptr;
+  return requested;
+}
+
+// Counts the named hardware event for the calling thread only, userspace
+// only. Returns -1 where perf_event_open is unavailable (permissions,
+// containers, missing PMU); the counter is then silently omitted.
+int OpenPerfCounter(uint64_t config) {
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof(attr);
+  attr.config = config;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return static_cast<int>(
+      syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+// Pins the calling (benchmark) thread to the cpu named by
+// GRPC_BENCHMARK_PIN_CPU. Background threads spawned during grpc_init
+// keep the full affinity mask, so the measured thread runs isolated from
+// them. A no-op when the variable is unset.
+void MaybePinBenchmarkThread() {
+  const char* cpu_str = getenv("GRPC_BENCHMARK_PIN_CPU");
+  if (cpu_str == nullptr) return;
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  CPU_SET(atoi(cpu_str), &cpu_set);
+  sched_setaffinity(0, sizeof(cpu_set), &cpu_set);
+}
+
+}  // namespace
+#endif  // GPR_LINUX
+
+TrackCounters::TrackCounters() {
+  grpc_stats_collect(&stats_begin_);
+#ifdef GPR_LINUX
+  MaybePinBenchmarkThread();
+  if (PerfCountersRequested()) {
+    for (size_t i = 0; i < kNumPerfCounters; i++) {
+      perf_fds_[i] = OpenPerfCounter(kPerfCounters[i].config);
+      if (perf_fds_[i] >= 0) {
+        ioctl(perf_fds_[i], PERF_EVENT_IOC_RESET, 0);
+        ioctl(perf_fds_[i], PERF_EVENT_IOC_ENABLE, 0);
+      }
+    }
+  }
+#endif
+}
+
+TrackCounters::~TrackCounters() {
+#ifdef GPR_LINUX
+  for (size_t i = 0; i < kNumPerfCounters; i++) {
+    if (perf_fds_[i] >= 0) close(perf_fds_[i]);
+  }
+#endif
+}
+
 void TrackCounters::Finish(benchmark::State& state) {
+#ifdef GPR_LINUX
+  for (size_t i = 0; i < kNumPerfCounters; i++) {
+    if (perf_fds_[i] < 0) continue;
+    ioctl(perf_fds_[i], PERF_EVENT_IOC_DISABLE, 0);
+    uint64_t value = 0;
+    if (read(perf_fds_[i], &value, sizeof(value)) ==
+        static_cast<ssize_t>(sizeof(value))) {
+      state.counters[kPerfCounters[i].name] = benchmark::Counter(
+          static_cast<double>(value), benchmark::Counter::kAvgIterations);
+    }
+    close(perf_fds_[i]);
+    perf_fds_[i] = -1;
+  }
+#endif
   std::ostringstream out;
   for (const auto& l : labels_) {
     out << l << ' ';
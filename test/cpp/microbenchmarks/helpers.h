@@ -49,10 +49,17 @@ extern gpr_atm gpr_counter_atm_add;
 extern gpr_atm gpr_now_call_count;
 #endif
 
+// On Linux two environment variables extend the instrumentation:
+// GRPC_BENCHMARK_PERF_COUNTERS enables perf_event_open-based hardware
+// counters (cache misses, branch mispredicts, stalled frontend cycles)
+// reported per iteration as UserCounters, and GRPC_BENCHMARK_PIN_CPU=<n>
+// pins the benchmark thread to cpu n so that timer/executor background
+// threads (which inherit the full affinity mask at grpc_init time) do
+// not pollute its caches.
 class TrackCounters {
  public:
-  TrackCounters() { grpc_stats_collect(&stats_begin_); }
-  virtual ~TrackCounters() {}
+  TrackCounters();
+  virtual ~TrackCounters();
   virtual void Finish(benchmark::State& state);
   virtual void AddLabel(const std::string& label);
   virtual void AddToLabel(std::ostream& out, benchmark::State& state);
@@ -60,6 +67,10 @@ class TrackCounters {
  private:
   grpc_stats_data stats_begin_;
   std::vector<std::string> labels_;
+#ifdef GPR_LINUX
+  static constexpr size_t kNumPerfCounters = 3;
+  int perf_fds_[kNumPerfCounters] = {-1, -1, -1};
+#endif
 #ifdef GPR_LOW_LEVEL_COUNTERS
   const size_t mu_locks_at_start_ = gpr_atm_no_barrier_load(&gpr_mu_locks);
   const size_t atm_cas_at_start_ =
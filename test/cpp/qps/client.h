@@ -19,10 +19,12 @@
 #ifndef TEST_QPS_CLIENT_H
 #define TEST_QPS_CLIENT_H
 
+#include <math.h>
 #include <stdlib.h>
 
 #include <condition_variable>
 #include <mutex>
+#include <random>
 #include <thread>
 #include <unordered_map>
 #include <vector>
@@ -33,6 +35,7 @@
 #include <grpc/support/log.h>
 #include <grpc/support/time.h>
 #include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
 #include <grpcpp/support/byte_buffer.h>
 #include <grpcpp/support/channel_arguments.h>
 #include <grpcpp/support/slice.h>
@@ -82,6 +85,21 @@ class ClientRequestCreator<SimpleRequest> {
       req->mutable_payload()->set_body(body.get(), size);
     } else if (payload_config.has_complex_params()) {
       GPR_ASSERT(false);  // not appropriate for this specialization
+    } else if (payload_config.has_lognormal_params()) {
+      // Per-call payload sizes are sampled by the client; seed the shared
+      // request with the distribution's median so single-request paths
+      // (e.g. server-streaming) still carry a representative payload.
+      req->set_response_type(grpc::testing::PayloadType::COMPRESSABLE);
+      req->set_response_size(payload_config.lognormal_params().resp_size());
+      req->mutable_payload()->set_type(
+          grpc::testing::PayloadType::COMPRESSABLE);
+      int size =
+          static_cast<int>(exp(payload_config.lognormal_params().log_mean()));
+      if (size < 1) size = 1;
+      const int max_size = payload_config.lognormal_params().max_size();
+      if (max_size > 0 && size > max_size) size = max_size;
+      std::unique_ptr<char[]> body(new char[size]);
+      req->mutable_payload()->set_body(body.get(), size);
     } else {
       // default should be simple proto without payloads
       req->set_response_type(grpc::testing::PayloadType::COMPRESSABLE);
@@ -383,6 +401,50 @@ class Client {
             gpr_time_from_nanos(interarrival_timer_.next(i), GPR_TIMESPAN)));
       }
     }
+
+    // Pre-build the metadata padding attached to each RPC, if the scenario
+    // weighs calls with metadata.
+    if (config.metadata_bytes_per_call() > 0) {
+      metadata_padding_.assign(config.metadata_bytes_per_call(), 'x');
+    }
+
+    // Set up the payload size sampler for lognormal payload mixes.
+    if (config.payload_config().has_lognormal_params()) {
+      const auto& params = config.payload_config().lognormal_params();
+      payload_size_dist_ =
+          absl::make_unique<std::lognormal_distribution<double>>(
+              params.log_mean(), params.log_sigma());
+      payload_size_max_ = params.max_size();
+    }
+  }
+
+  // Attaches any per-call metadata configured for this scenario. Must be
+  // called before the RPC is started on the context.
+  void MaybeSetCallMetadata(ClientContext* context) {
+    if (!metadata_padding_.empty()) {
+      context->AddMetadata("x-qps-metadata-padding", metadata_padding_);
+    }
+  }
+
+  // If the scenario uses a lognormal payload mix, samples the payload size
+  // for the next request into *size and returns true. Returns false when
+  // payload sizes are fixed.
+  bool SamplePayloadSize(int* size) {
+    if (payload_size_dist_ == nullptr) {
+      return false;
+    }
+    double sampled;
+    {
+      std::lock_guard<std::mutex> g(payload_size_mu_);
+      sampled = (*payload_size_dist_)(payload_size_rng_);
+    }
+    int sz = static_cast<int>(sampled);
+    if (sz < 1) sz = 1;
+    if (payload_size_max_ > 0 && sz > payload_size_max_) {
+      sz = payload_size_max_;
+    }
+    *size = sz;
+    return true;
   }
 
   std::function<gpr_timespec()> NextIssuer(int thread_idx) {
@@ -407,6 +469,15 @@ class Client {
 
   int last_reset_poll_count_;
 
+  // Padding metadata added to every call; empty if unused.
+  std::string metadata_padding_;
+
+  // Lognormal payload size sampler; null if payload sizes are fixed.
+  std::mutex payload_size_mu_;
+  std::unique_ptr<std::lognormal_distribution<double>> payload_size_dist_;
+  std::mt19937 payload_size_rng_;
+  int payload_size_max_ = 0;
+
   void MaybeStartRequests() {
     if (!started_requests_) {
       started_requests_ = true;
@@ -423,6 +494,20 @@ class Client {
   }
 };
 
+// Rebuilds the request payload at a new size, for lognormal payload mixes.
+inline void ResizeRequestPayload(SimpleRequest* req, int size) {
+  std::unique_ptr<char[]> body(new char[size]);
+  memset(body.get(), 0, size);
+  req->mutable_payload()->set_body(body.get(), size);
+}
+
+inline void ResizeRequestPayload(ByteBuffer* req, int size) {
+  std::unique_ptr<char[]> buf(new char[size]);
+  memset(buf.get(), 0, size);
+  Slice slice(buf.get(), size);
+  *req = ByteBuffer(&slice, 1);
+}
+
 template <class StubType, class RequestType>
 class ClientImpl : public Client {
  public:
@@ -503,6 +588,20 @@ class ClientImpl : public Client {
   const int cores_;
   RequestType request_;
 
+  // Returns the request to send next: the shared pre-built request, or
+  // *scratch rebuilt with a freshly sampled payload size when the scenario
+  // uses a lognormal payload mix. The returned pointer must stay valid for
+  // the duration of the call, so *scratch must outlive it.
+  const RequestType* NextRequest(RequestType* scratch) {
+    int size;
+    if (!SamplePayloadSize(&size)) {
+      return &request_;
+    }
+    *scratch = request_;
+    ResizeRequestPayload(scratch, size);
+    return scratch;
+  }
+
   class ClientChannelInfo {
    public:
     ClientChannelInfo(
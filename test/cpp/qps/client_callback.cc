@@ -54,6 +54,9 @@ struct CallbackClientRpcContext {
   ClientContext context_;
   std::unique_ptr<Alarm> alarm_;
   BenchmarkService::Stub* stub_;
+  // Scratch request used when payload sizes are sampled per call; must live
+  // as long as the RPC, hence part of the per-RPC context.
+  SimpleRequest request_scratch_;
 };
 
 static std::unique_ptr<BenchmarkService::Stub> BenchmarkStubCreator(
@@ -188,8 +191,11 @@ class CallbackUnaryClient final : public CallbackClient {
   void IssueUnaryCallbackRpc(Thread* t, size_t vector_idx) {
     GPR_TIMER_SCOPE("CallbackUnaryClient::ThreadFunc", 0);
     double start = UsageTimer::Now();
+    MaybeSetCallMetadata(&ctx_[vector_idx]->context_);
     ctx_[vector_idx]->stub_->async()->UnaryCall(
-        (&ctx_[vector_idx]->context_), &request_, &ctx_[vector_idx]->response_,
+        (&ctx_[vector_idx]->context_),
+        NextRequest(&ctx_[vector_idx]->request_scratch_),
+        &ctx_[vector_idx]->response_,
         [this, t, start, vector_idx](grpc::Status s) {
           // Update Histogram with data from the callback run
           HistogramEntry entry;
@@ -127,8 +127,10 @@ class SynchronousUnaryClient final : public SynchronousClient {
     double start = UsageTimer::Now();
     GPR_TIMER_SCOPE("SynchronousUnaryClient::ThreadFunc", 0);
     grpc::ClientContext context;
-    grpc::Status s =
-        stub->UnaryCall(&context, request_, &responses_[thread_idx]);
+    MaybeSetCallMetadata(&context);
+    SimpleRequest scratch;
+    grpc::Status s = stub->UnaryCall(&context, *NextRequest(&scratch),
+                                     &responses_[thread_idx]);
     if (s.ok()) {
       entry->set_value((UsageTimer::Now() - start) * 1e9);
     }
@@ -151,6 +153,9 @@ class SynchronousStreamingClient : public SynchronousClient {
         shutdown_(num_threads_),
         messages_per_stream_(config.messages_per_stream()),
         messages_issued_(num_threads_) {
+    for (auto& context : context_) {
+      MaybeSetCallMetadata(&context);
+    }
     StartThreads(num_threads_);
   }
   ~SynchronousStreamingClient() override {
@@ -189,6 +194,7 @@ class SynchronousStreamingClient : public SynchronousClient {
     std::lock_guard<std::mutex> l(stream_mu_[thread_idx]);
     context_[thread_idx].~ClientContext();
     new (&context_[thread_idx]) ClientContext();
+    MaybeSetCallMetadata(&context_[thread_idx]);
   }
 
   void CleanupAllStreams(const std::function<void(size_t)>& cleaner) {
@@ -245,7 +251,8 @@ class SynchronousStreamingPingPongClient final
     }
     GPR_TIMER_SCOPE("SynchronousStreamingPingPongClient::ThreadFunc", 0);
     double start = UsageTimer::Now();
-    if (stream_[thread_idx]->Write(request_) &&
+    SimpleRequest scratch;
+    if (stream_[thread_idx]->Write(*NextRequest(&scratch)) &&
         stream_[thread_idx]->Read(&responses_[thread_idx])) {
       entry->set_value((UsageTimer::Now() - start) * 1e9);
       // don't set the status since there isn't one yet
@@ -305,7 +312,8 @@ class SynchronousStreamingFromClientClient final
       return true;
     }
     GPR_TIMER_SCOPE("SynchronousStreamingFromClientClient::ThreadFunc", 0);
-    if (stream_[thread_idx]->Write(request_)) {
+    SimpleRequest scratch;
+    if (stream_[thread_idx]->Write(*NextRequest(&scratch))) {
       double now = UsageTimer::Now();
       entry->set_value((now - last_issue_[thread_idx]) * 1e9);
       last_issue_[thread_idx] = now;
@@ -444,12 +444,24 @@ std::unique_ptr<ScenarioResult> RunScenario(
           local_workers[i]->InProcessChannel(channel_args));
     }
 
-    const ServerConfig& server_config = initial_server_config;
+    ServerConfig server_config = initial_server_config;
     if (server_config.core_limit() != 0) {
       gpr_log(GPR_ERROR,
               "server config core limit is set but ignored by driver");
       GPR_ASSERT(false);
     }
+    if (server_config.connection_age_ms() > 0) {
+      // Express connection churn as server-side max connection age: the
+      // server GOAWAYs each connection after roughly connection_age_ms, so
+      // clients continuously re-establish connections mid-run without
+      // losing in-flight RPCs.
+      ChannelArg* arg = server_config.add_channel_args();
+      arg->set_name(GRPC_ARG_MAX_CONNECTION_AGE_MS);
+      arg->set_int_value(server_config.connection_age_ms());
+      arg = server_config.add_channel_args();
+      arg->set_name(GRPC_ARG_MAX_CONNECTION_AGE_GRACE_MS);
+      arg->set_int_value(server_config.connection_age_ms());
+    }
 
     ServerArgs args;
     *args.mutable_setup() = server_config;
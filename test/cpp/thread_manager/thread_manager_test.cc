@@ -154,7 +154,13 @@ TestThreadManagerSettings scenarios[] = {
      INT_MAX /* thread_limit */, 1 /* thread_manager_count */},
     {1 /* min_pollers */, 1 /* max_pollers */, 1 /* poll_duration_ms */,
      10 /* work_duration_ms */, 50 /* max_poll_calls */, 3 /* thread_limit */,
-     2 /* thread_manager_count */}};
+     2 /* thread_manager_count */},
+    // min == max with fast polls and slower work: drives workers through the
+    // surplus-poller path repeatedly, exercising thread parking and polling
+    // slot handoff to parked threads
+    {2 /* min_pollers */, 2 /* max_pollers */, 1 /* poll_duration_ms */,
+     5 /* work_duration_ms */, 200 /* max_poll_calls */,
+     INT_MAX /* thread_limit */, 1 /* thread_manager_count */}};
 
 INSTANTIATE_TEST_SUITE_P(ThreadManagerTest, ThreadManagerTest,
                          ::testing::ValuesIn(scenarios));
@@ -486,7 +486,7 @@ for i, elem in enumerate(all_strs):
 print('};', file=STR_C)  # static slice refcounts
 print('', file=STR_C)
 print('''
-  const StaticMetadataSlice
+  constexpr StaticMetadataSlice
     g_static_metadata_slice_table[GRPC_STATIC_MDSTR_COUNT] = {
 ''',
       file=STR_C)
@@ -494,8 +494,10 @@ for i, elem in enumerate(all_strs):
     print(slice_def_for_ctx(i) + ',', file=STR_C)
 print('};', file=STR_C)  # static slices
 print('namespace grpc_core {', file=MD_C)
-print('StaticMetadata g_static_mdelem_table[GRPC_STATIC_MDELEM_COUNT] = {',
-      file=MD_C)
+print(
+    'constexpr StaticMetadata g_static_mdelem_table[GRPC_STATIC_MDELEM_COUNT]'
+    ' = {',
+    file=MD_C)
 for idx, (a, b) in enumerate(all_elems):
     print('StaticMetadata(%s,%s, %d),' %
           (slice_def_for_ctx(str_idx(a)), slice_def_for_ctx(str_idx(b)), idx),
@@ -553,7 +555,7 @@ for i, elem in enumerate(all_elems):
 print('#define GRPC_STATIC_MDELEM_COUNT %d' % len(all_elems), file=MD_H)
 print('''
 namespace grpc_core {
-extern StaticMetadata g_static_mdelem_table[GRPC_STATIC_MDELEM_COUNT];
+extern const StaticMetadata g_static_mdelem_table[GRPC_STATIC_MDELEM_COUNT];
 extern grpc_mdelem g_static_mdelem_manifested[GRPC_STATIC_MDELEM_COUNT];
 }
 ''',
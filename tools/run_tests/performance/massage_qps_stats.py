@@ -317,6 +317,15 @@ def massage_qps_stats(scenario_result):
             stats[
                 "core_cq_ev_queue_transient_pop_failures"] = massage_qps_stats_helpers.counter(
                     core_stats, "cq_ev_queue_transient_pop_failures")
+            stats[
+                "core_http2_transport_window_stalls"] = massage_qps_stats_helpers.counter(
+                    core_stats, "http2_transport_window_stalls")
+            stats[
+                "core_http2_stream_window_stalls"] = massage_qps_stats_helpers.counter(
+                    core_stats, "http2_stream_window_stalls")
+            stats[
+                "core_tcp_backpressure_writes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "tcp_backpressure_writes")
             h = massage_qps_stats_helpers.histogram(core_stats,
                                                     "call_initial_size")
             stats["core_call_initial_size"] = ",".join(
@@ -509,3 +518,106 @@ def massage_qps_stats(scenario_result):
             stats[
                 "core_server_cqs_checked_99p"] = massage_qps_stats_helpers.percentile(
                     h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(core_stats, "call_pick_us")
+            stats["core_call_pick_us"] = ",".join("%f" % x for x in h.buckets)
+            stats["core_call_pick_us_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_call_pick_us_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_call_pick_us_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_call_pick_us_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(core_stats,
+                                                    "call_first_send_us")
+            stats["core_call_first_send_us"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_call_first_send_us_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_call_first_send_us_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_call_first_send_us_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_call_first_send_us_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(core_stats,
+                                                    "call_first_recv_msg_us")
+            stats["core_call_first_recv_msg_us"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_call_first_recv_msg_us_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_call_first_recv_msg_us_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_call_first_recv_msg_us_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_call_first_recv_msg_us_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(core_stats,
+                                                    "call_completion_us")
+            stats["core_call_completion_us"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_call_completion_us_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_call_completion_us_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_call_completion_us_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_call_completion_us_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(
+                core_stats, "http2_transport_window_stall_ms")
+            stats["core_http2_transport_window_stall_ms"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_http2_transport_window_stall_ms_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_http2_transport_window_stall_ms_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_http2_transport_window_stall_ms_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_http2_transport_window_stall_ms_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(
+                core_stats, "http2_stream_window_stall_ms")
+            stats["core_http2_stream_window_stall_ms"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_http2_stream_window_stall_ms_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_http2_stream_window_stall_ms_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_http2_stream_window_stall_ms_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_http2_stream_window_stall_ms_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(core_stats,
+                                                    "tcp_backpressure_stall_ms")
+            stats["core_tcp_backpressure_stall_ms"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_tcp_backpressure_stall_ms_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_tcp_backpressure_stall_ms_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_tcp_backpressure_stall_ms_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_tcp_backpressure_stall_ms_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)